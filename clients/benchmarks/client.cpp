@@ -35,45 +35,81 @@
 
 // Level2
 #include "testing_bsrmv.hpp"
+#include "testing_bsrmv_dot.hpp"
+#include "testing_bsrmv_mixed.hpp"
 #include "testing_bsrsv.hpp"
 #include "testing_coomv.hpp"
+#include "testing_coomv_mixed.hpp"
+#include "testing_csrdcmv.hpp"
 #include "testing_csrmv.hpp"
+#include "testing_csrmv_dot.hpp"
+#include "testing_csrmv_format.hpp"
+#include "testing_csrmv_i64.hpp"
+#include "testing_csrmv_mixed.hpp"
+#include "testing_csrmv_strided_batched.hpp"
 #include "testing_csrsv.hpp"
+#include "testing_csrsv_i64.hpp"
+#include "testing_csrsv_mixed.hpp"
+#include "testing_csrsv_strided_batched.hpp"
+#include "testing_diamv.hpp"
 #include "testing_ellmv.hpp"
+#include "testing_ellmv_dot.hpp"
+#include "testing_ellmv_mixed.hpp"
 #include "testing_hybmv.hpp"
+#include "testing_vbrmv.hpp"
 
 // Level3
 #include "testing_bsrmm.hpp"
+#include "testing_bsrsm.hpp"
+#include "testing_coosddmm.hpp"
 #include "testing_csrmm.hpp"
+#include "testing_csrmm_mixed.hpp"
+#include "testing_csrsddmm.hpp"
 #include "testing_csrsm.hpp"
+#include "testing_csrsm_mixed.hpp"
 #include "testing_gemmi.hpp"
 
 // Extra
 #include "testing_csrgeam.hpp"
 #include "testing_csrgemm.hpp"
+#include "testing_csrgemm_i64.hpp"
+#include "testing_csrrap.hpp"
 
 // Preconditioner
 #include "testing_bsric0.hpp"
+#include "testing_bsrilu0.hpp"
 #include "testing_csric0.hpp"
+#include "testing_csric0_mixed.hpp"
 #include "testing_csrilu0.hpp"
+#include "testing_csrilu0_mixed.hpp"
+#include "testing_csrilu0_strided_batched.hpp"
 
 // Conversion
 #include "testing_bsr2csr.hpp"
 #include "testing_coo2csr.hpp"
+#include "testing_coo2csr_i64.hpp"
 #include "testing_coosort.hpp"
 #include "testing_csc2dense.hpp"
 #include "testing_cscsort.hpp"
 #include "testing_csr2bsr.hpp"
+#include "testing_csr2bsr_block_dim_analysis.hpp"
 #include "testing_csr2coo.hpp"
+#include "testing_csr2csrdc.hpp"
+#include "testing_csr2coo_i64.hpp"
 #include "testing_csr2csc.hpp"
+#include "testing_csr2csc_i64.hpp"
 #include "testing_csr2csr_compress.hpp"
 #include "testing_csr2dense.hpp"
+#include "testing_csr2dia.hpp"
 #include "testing_csr2ell.hpp"
 #include "testing_csr2hyb.hpp"
+#include "testing_csr2vbr.hpp"
 #include "testing_csrsort.hpp"
 #include "testing_dense2csc.hpp"
 #include "testing_dense2csr.hpp"
+#include "testing_dia2csr.hpp"
 #include "testing_ell2csr.hpp"
+#include "testing_handle.hpp"
 #include "testing_hyb2csr.hpp"
 #include "testing_identity.hpp"
 #include "testing_nnz.hpp"
@@ -107,9 +143,15 @@ int main(int argc, char* argv[])
     char          diag;
     char          uplo;
     char          apol;
+    char          mattype;
     rocsparse_int dir;
+    rocsparse_int orderA;
+    rocsparse_int orderB;
+    rocsparse_int orderC;
 
     std::vector<rocsparse_int> laplace(3, 0);
+    std::vector<rocsparse_int> genparam(3, 0);
+    std::string                generator;
 
     rocsparse_int device_id;
 
@@ -133,12 +175,22 @@ int main(int argc, char* argv[])
         ("sizennz,z",
          po::value<rocsparse_int>(&arg.nnz)->default_value(32),
          "Specific vector size testing, LEVEL-1: the number of non-zero elements "
-         "of the sparse vector.")
+         "of the sparse vector. csr2bsr_block_dim_analysis: the number of sampled block "
+         "rows, 0 for all block rows. csrsddmm & coosddmm: the number of non-zero "
+         "elements per row of the random sampling pattern.")
 
         ("blockdim",
          po::value<rocsparse_int>(&arg.block_dim)->default_value(2),
          "BSR block dimension (default: 2)")
 
+        ("batch_count",
+         po::value<rocsparse_int>(&arg.batch_count)->default_value(1),
+         "Number of matrices of a batch, where each matrix is of size M x N (default: 1)")
+
+        ("deltabits",
+         po::value<rocsparse_int>(&arg.delta_bits)->default_value(8),
+         "Number of bits per column delta of the CSRDC format, 8 or 16 (default: 8)")
+
         ("mtx",
          po::value<std::string>(&filename)->default_value(""), "read from matrix "
          "market (.mtx) format. This will override parameters -m, -n, and -z.")
@@ -152,6 +204,17 @@ int main(int argc, char* argv[])
          "laplacian matrix with dimensions <dimx dimy dimz>. dimz is optional. This "
          "will override parameters -m, -n, -z and --mtx.")
 
+        ("generator",
+         po::value<std::string>(&generator)->default_value(""), "synthetic matrix "
+         "generator: rmat, banded, block or fem3d. This will override parameters -z, "
+         "--mtx and --laplacian-dim.")
+
+        ("generator-param",
+         po::value<std::vector<rocsparse_int> >(&genparam)->multitoken(), "generator "
+         "parameters: rmat <edge factor>, banded <max bandwidth>, block <block dim> "
+         "<max blocks per block row>, fem3d <dimx dimy dimz>. Zero selects the default. "
+         "fem3d overrides parameters -m and -n.")
+
         ("alpha", 
           po::value<double>(&arg.alpha)->default_value(1.0), "specifies the scalar alpha")
 
@@ -191,6 +254,11 @@ int main(int argc, char* argv[])
           "0 = rocsparse_hyb_partition_auto, 1 = rocsparse_hyb_partition_user,\n"
           "2 = rocsparse_hyb_partition_max, (default: 0)")
 
+        ("format-iter",
+          po::value<uint32_t>(&arg.algo)->default_value(0),
+          "csrmv_format: csrmv calls timed per storage format during the analysis,\n"
+          "0 = select the storage format by the cost model, (default: 0)")
+
         ("diag",
           po::value<char>(&diag)->default_value('N'),
           "N = non-unit diagonal, U = unit diagonal, (default = N)")
@@ -203,6 +271,10 @@ int main(int argc, char* argv[])
           po::value<char>(&apol)->default_value('R'),
           "R = reuse meta data, F = force re-build, (default = R)")
 
+        ("mattype",
+          po::value<char>(&mattype)->default_value('G'),
+          "G = general, S = symmetric, H = hermitian, T = triangular, (default = G)")
+
 //        ("spolicy",
 //          po::value<char>(&spol)->default_value('A'),
 //          "A = auto, (default = A)")
@@ -211,18 +283,26 @@ int main(int argc, char* argv[])
          po::value<std::string>(&function)->default_value("axpyi"),
          "SPARSE function to test. Options:\n"
          "  Level1: axpyi, doti, dotci, gthr, gthrz, roti, sctr\n"
-         "  Level2: bsrmv, bsrsv, coomv, csrmv, csrsv, ellmv, hybmv\n"
-         "  Level3: bsrmm, csrmm, csrsm, gemmi\n"
-         "  Extra: csrgeam, csrgemm\n"
-         "  Preconditioner: bsric0, csric0, csrilu0\n"
-         "  Conversion: csr2coo, csr2csc, csr2ell, csr2hyb, csr2bsr\n"
+         "  Level2: bsrmv, bsrmv_dot, bsrmv_mixed, bsrsv, coomv, coomv_mixed, csrdcmv, csrmv,\n"
+         "          csrmv_dot, csrmv_format, csrmv_i64, csrmv_mixed, csrmv_strided_batched,\n"
+         "          csrsv, csrsv_i64, csrsv_mixed, csrsv_strided_batched, diamv, ellmv,\n"
+         "          ellmv_dot, ellmv_mixed, hybmv, vbrmv\n"
+         "  Level3: bsrmm, bsrsm, csrmm, csrmm_mixed, csrsm, csrsm_mixed, gemmi, csrsddmm,\n"
+         "          coosddmm\n"
+         "  Extra: csrgeam, csrgemm, csrgemm_i64, csrrap\n"
+         "  Preconditioner: bsric0, bsrilu0, csric0, csric0_mixed, csrilu0, csrilu0_mixed,\n"
+         "                  csrilu0_strided_batched\n"
+         "  Conversion: csr2coo, csr2csc, csr2ell, csr2hyb, csr2bsr, csr2vbr\n"
+         "              csr2coo_i64, csr2csc_i64, coo2csr_i64\n"
          "              coo2csr, ell2csr, hyb2csr, dense2csr, dense2csc\n"
          "              csr2dense, csc2dense, bsr2csr, csr2csr_compress\n"
+         "              csr2bsr_block_dim_analysis, csr2csrdc, csr2dia, dia2csr\n"
          "  Sorting: cscsort, csrsort, coosort\n"
-         "  Misc: identity, nnz")
+         "  Misc: identity, nnz, create_handle")
 
         ("precision,r",
-         po::value<char>(&precision)->default_value('s'), "Options: s,d,c,z")
+         po::value<char>(&precision)->default_value('s'),
+         "Options: s,d,c,z,h,b (h,b only for *_mixed)")
 
         ("verify,v",
          po::value<rocsparse_int>(&arg.unit_check)->default_value(0),
@@ -232,6 +312,11 @@ int main(int argc, char* argv[])
          po::value<int>(&arg.iters)->default_value(10),
          "Iterations to run inside timing loop")
 
+        ("memstat",
+         po::value<rocsparse_int>(&arg.memstat)->default_value(0),
+         "Print the device memory held by the analysis meta data, relative to the "
+         "matrix itself? 0 = No, 1 = Yes (default: No)")
+
         ("device,d",
          po::value<rocsparse_int>(&device_id)->default_value(0),
          "Set default device to be used for subsequent program runs")
@@ -240,6 +325,18 @@ int main(int argc, char* argv[])
          po::value<rocsparse_int>(&dir)->default_value(rocsparse_direction_row),
          "Indicates whether a dense matrix should be parsed by rows or by columns, assuming column-major storage: row = 0, column = 1 (default: 0)")
 
+        ("orderA",
+         po::value<rocsparse_int>(&orderA)->default_value(rocsparse_order_column),
+         "Indicates the storage order of the dense matrix A: row = 0, column = 1 (default: 1)")
+
+        ("orderB",
+         po::value<rocsparse_int>(&orderB)->default_value(rocsparse_order_column),
+         "Indicates the storage order of the dense matrix B: row = 0, column = 1 (default: 1)")
+
+        ("orderC",
+         po::value<rocsparse_int>(&orderC)->default_value(rocsparse_order_column),
+         "Indicates the storage order of the dense matrix C: row = 0, column = 1 (default: 1)")
+
         ("denseld",
          po::value<rocsparse_int>(&arg.denseld)->default_value(128),
          "Indicates the leading dimension of a dense matrix >= M, assuming a column-oriented storage.");
@@ -262,7 +359,26 @@ int main(int argc, char* argv[])
         return -1;
     }
 
-    if(precision != 's' && precision != 'd' && precision != 'c' && precision != 'z')
+    if(orderA != rocsparse_order_row && orderA != rocsparse_order_column)
+    {
+        std::cerr << "Invalid value for --orderA" << std::endl;
+        return -1;
+    }
+
+    if(orderB != rocsparse_order_row && orderB != rocsparse_order_column)
+    {
+        std::cerr << "Invalid value for --orderB" << std::endl;
+        return -1;
+    }
+
+    if(orderC != rocsparse_order_row && orderC != rocsparse_order_column)
+    {
+        std::cerr << "Invalid value for --orderC" << std::endl;
+        return -1;
+    }
+
+    if(precision != 's' && precision != 'd' && precision != 'c' && precision != 'z'
+       && precision != 'h' && precision != 'b')
     {
         std::cerr << "Invalid value for --precision" << std::endl;
         return -1;
@@ -310,6 +426,14 @@ int main(int argc, char* argv[])
     arg.spol = rocsparse_solve_policy_auto;
     arg.direction
         = (dir == rocsparse_direction_row) ? rocsparse_direction_row : rocsparse_direction_column;
+    arg.matrix_type = (mattype == 'S')   ? rocsparse_matrix_type_symmetric
+                      : (mattype == 'H') ? rocsparse_matrix_type_hermitian
+                      : (mattype == 'T') ? rocsparse_matrix_type_triangular
+                                         : rocsparse_matrix_type_general;
+
+    arg.orderA = (orderA == rocsparse_order_row) ? rocsparse_order_row : rocsparse_order_column;
+    arg.orderB = (orderB == rocsparse_order_row) ? rocsparse_order_row : rocsparse_order_column;
+    arg.orderC = (orderC == rocsparse_order_row) ? rocsparse_order_row : rocsparse_order_column;
 
     // Set laplace dimensions
     arg.dimx = laplace[0];
@@ -322,6 +446,36 @@ int main(int argc, char* argv[])
         strcpy(arg.filename, rocalution.c_str());
         arg.matrix = rocsparse_matrix_file_rocalution;
     }
+    else if(generator != "")
+    {
+        genparam.resize(3, 0);
+
+        arg.dimx = genparam[0];
+        arg.dimy = genparam[1];
+        arg.dimz = genparam[2];
+
+        if(generator == "rmat")
+        {
+            arg.matrix = rocsparse_matrix_rmat;
+        }
+        else if(generator == "banded")
+        {
+            arg.matrix = rocsparse_matrix_banded;
+        }
+        else if(generator == "block")
+        {
+            arg.matrix = rocsparse_matrix_block;
+        }
+        else if(generator == "fem3d")
+        {
+            arg.matrix = rocsparse_matrix_fem_3d;
+        }
+        else
+        {
+            std::cerr << "Invalid value for --generator" << std::endl;
+            return -1;
+        }
+    }
     else if(arg.dimx != 0 && arg.dimy != 0 && arg.dimz != 0)
     {
         arg.matrix = rocsparse_matrix_laplace_3d;
@@ -412,12 +566,24 @@ int main(int argc, char* argv[])
         return -1;
     }
 
-    if(arg.block_dim < 2)
+    if(arg.block_dim < 1)
     {
         std::cerr << "Invalid value for --blockdim" << std::endl;
         return -1;
     }
 
+    if(arg.batch_count < 1)
+    {
+        std::cerr << "Invalid value for --batch_count" << std::endl;
+        return -1;
+    }
+
+    if(arg.delta_bits != 8 && arg.delta_bits != 16)
+    {
+        std::cerr << "Invalid value for --deltabits" << std::endl;
+        return -1;
+    }
+
     // Level1
     if(function == "axpyi")
     {
@@ -503,6 +669,24 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_bsrmv<rocsparse_double_complex>(arg);
     }
+    else if(function == "bsrmv_dot")
+    {
+        if(precision == 's')
+            testing_bsrmv_dot<float>(arg);
+        else if(precision == 'd')
+            testing_bsrmv_dot<double>(arg);
+        else if(precision == 'c')
+            testing_bsrmv_dot<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_bsrmv_dot<rocsparse_double_complex>(arg);
+    }
+    else if(function == "bsrmv_mixed")
+    {
+        if(precision == 'h')
+            testing_bsrmv_mixed<float, rocsparse_half>(arg);
+        else if(precision == 'b')
+            testing_bsrmv_mixed<float, rocsparse_bfloat16>(arg);
+    }
     else if(function == "bsrsv")
     {
         if(precision == 's')
@@ -525,6 +709,13 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_coomv<rocsparse_double_complex>(arg);
     }
+    else if(function == "coomv_mixed")
+    {
+        if(precision == 'h')
+            testing_coomv_mixed<float, rocsparse_half>(arg);
+        else if(precision == 'b')
+            testing_coomv_mixed<float, rocsparse_bfloat16>(arg);
+    }
     else if(function == "csrmv")
     {
         arg.algo = 1;
@@ -537,6 +728,59 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_csrmv<rocsparse_double_complex>(arg);
     }
+    else if(function == "csrmv_i64")
+    {
+        arg.algo = 1;
+        if(precision == 's')
+            testing_csrmv_i64<float>(arg);
+        else if(precision == 'd')
+            testing_csrmv_i64<double>(arg);
+        else if(precision == 'c')
+            testing_csrmv_i64<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrmv_i64<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrmv_dot")
+    {
+        if(precision == 's')
+            testing_csrmv_dot<float>(arg);
+        else if(precision == 'd')
+            testing_csrmv_dot<double>(arg);
+        else if(precision == 'c')
+            testing_csrmv_dot<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrmv_dot<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrmv_format")
+    {
+        if(precision == 's')
+            testing_csrmv_format<float>(arg);
+        else if(precision == 'd')
+            testing_csrmv_format<double>(arg);
+        else if(precision == 'c')
+            testing_csrmv_format<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrmv_format<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrmv_mixed")
+    {
+        arg.algo = 1;
+        if(precision == 'h')
+            testing_csrmv_mixed<float, rocsparse_half>(arg);
+        else if(precision == 'b')
+            testing_csrmv_mixed<float, rocsparse_bfloat16>(arg);
+    }
+    else if(function == "csrmv_strided_batched")
+    {
+        if(precision == 's')
+            testing_csrmv_strided_batched<float>(arg);
+        else if(precision == 'd')
+            testing_csrmv_strided_batched<double>(arg);
+        else if(precision == 'c')
+            testing_csrmv_strided_batched<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrmv_strided_batched<rocsparse_double_complex>(arg);
+    }
     else if(function == "csrsv")
     {
         if(precision == 's')
@@ -548,6 +792,35 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_csrsv<rocsparse_double_complex>(arg);
     }
+    else if(function == "csrsv_i64")
+    {
+        if(precision == 's')
+            testing_csrsv_i64<float>(arg);
+        else if(precision == 'd')
+            testing_csrsv_i64<double>(arg);
+        else if(precision == 'c')
+            testing_csrsv_i64<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrsv_i64<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrsv_mixed")
+    {
+        if(precision == 'd')
+            testing_csrsv_mixed<double, float>(arg);
+        else if(precision == 'z')
+            testing_csrsv_mixed<rocsparse_double_complex, rocsparse_float_complex>(arg);
+    }
+    else if(function == "csrsv_strided_batched")
+    {
+        if(precision == 's')
+            testing_csrsv_strided_batched<float>(arg);
+        else if(precision == 'd')
+            testing_csrsv_strided_batched<double>(arg);
+        else if(precision == 'c')
+            testing_csrsv_strided_batched<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrsv_strided_batched<rocsparse_double_complex>(arg);
+    }
     else if(function == "ellmv")
     {
         if(precision == 's')
@@ -559,6 +832,24 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_ellmv<rocsparse_double_complex>(arg);
     }
+    else if(function == "ellmv_dot")
+    {
+        if(precision == 's')
+            testing_ellmv_dot<float>(arg);
+        else if(precision == 'd')
+            testing_ellmv_dot<double>(arg);
+        else if(precision == 'c')
+            testing_ellmv_dot<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_ellmv_dot<rocsparse_double_complex>(arg);
+    }
+    else if(function == "ellmv_mixed")
+    {
+        if(precision == 'h')
+            testing_ellmv_mixed<float, rocsparse_half>(arg);
+        else if(precision == 'b')
+            testing_ellmv_mixed<float, rocsparse_bfloat16>(arg);
+    }
     else if(function == "hybmv")
     {
         if(precision == 's')
@@ -570,6 +861,39 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_hybmv<rocsparse_double_complex>(arg);
     }
+    else if(function == "csrdcmv")
+    {
+        if(precision == 's')
+            testing_csrdcmv<float>(arg);
+        else if(precision == 'd')
+            testing_csrdcmv<double>(arg);
+        else if(precision == 'c')
+            testing_csrdcmv<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrdcmv<rocsparse_double_complex>(arg);
+    }
+    else if(function == "diamv")
+    {
+        if(precision == 's')
+            testing_diamv<float>(arg);
+        else if(precision == 'd')
+            testing_diamv<double>(arg);
+        else if(precision == 'c')
+            testing_diamv<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_diamv<rocsparse_double_complex>(arg);
+    }
+    else if(function == "vbrmv")
+    {
+        if(precision == 's')
+            testing_vbrmv<float>(arg);
+        else if(precision == 'd')
+            testing_vbrmv<double>(arg);
+        else if(precision == 'c')
+            testing_vbrmv<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_vbrmv<rocsparse_double_complex>(arg);
+    }
     else if(function == "bsrmm")
     {
         if(precision == 's')
@@ -581,6 +905,17 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_bsrmm<rocsparse_double_complex>(arg);
     }
+    else if(function == "bsrsm")
+    {
+        if(precision == 's')
+            testing_bsrsm<float>(arg);
+        else if(precision == 'd')
+            testing_bsrsm<double>(arg);
+        else if(precision == 'c')
+            testing_bsrsm<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_bsrsm<rocsparse_double_complex>(arg);
+    }
     else if(function == "csrmm")
     {
         if(precision == 's')
@@ -592,6 +927,13 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_csrmm<rocsparse_double_complex>(arg);
     }
+    else if(function == "csrmm_mixed")
+    {
+        if(precision == 'h')
+            testing_csrmm_mixed<float, rocsparse_half>(arg);
+        else if(precision == 'b')
+            testing_csrmm_mixed<float, rocsparse_bfloat16>(arg);
+    }
     else if(function == "csrsm")
     {
         if(precision == 's')
@@ -603,6 +945,13 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_csrsm<rocsparse_double_complex>(arg);
     }
+    else if(function == "csrsm_mixed")
+    {
+        if(precision == 'd')
+            testing_csrsm_mixed<double, float>(arg);
+        else if(precision == 'z')
+            testing_csrsm_mixed<rocsparse_double_complex, rocsparse_float_complex>(arg);
+    }
     else if(function == "gemmi")
     {
         if(precision == 's')
@@ -614,6 +963,28 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_gemmi<rocsparse_double_complex>(arg);
     }
+    else if(function == "csrsddmm")
+    {
+        if(precision == 's')
+            testing_csrsddmm<float>(arg);
+        else if(precision == 'd')
+            testing_csrsddmm<double>(arg);
+        else if(precision == 'c')
+            testing_csrsddmm<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrsddmm<rocsparse_double_complex>(arg);
+    }
+    else if(function == "coosddmm")
+    {
+        if(precision == 's')
+            testing_coosddmm<float>(arg);
+        else if(precision == 'd')
+            testing_coosddmm<double>(arg);
+        else if(precision == 'c')
+            testing_coosddmm<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_coosddmm<rocsparse_double_complex>(arg);
+    }
     else if(function == "csrgeam")
     {
         if(precision == 's')
@@ -641,6 +1012,33 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_csrgemm<rocsparse_double_complex>(arg);
     }
+    else if(function == "csrgemm_i64")
+    {
+        // TODO workaround until fully implemented
+        if(arg.beta == 0.0)
+        {
+            arg.beta = -99;
+        }
+        if(precision == 's')
+            testing_csrgemm_i64<float>(arg);
+        else if(precision == 'd')
+            testing_csrgemm_i64<double>(arg);
+        else if(precision == 'c')
+            testing_csrgemm_i64<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrgemm_i64<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrrap")
+    {
+        if(precision == 's')
+            testing_csrrap<float>(arg);
+        else if(precision == 'd')
+            testing_csrrap<double>(arg);
+        else if(precision == 'c')
+            testing_csrrap<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrrap<rocsparse_double_complex>(arg);
+    }
     else if(function == "bsric0")
     {
         if(precision == 's')
@@ -652,6 +1050,17 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_bsric0<rocsparse_double_complex>(arg);
     }
+    else if(function == "bsrilu0")
+    {
+        if(precision == 's')
+            testing_bsrilu0<float>(arg);
+        else if(precision == 'd')
+            testing_bsrilu0<double>(arg);
+        else if(precision == 'c')
+            testing_bsrilu0<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_bsrilu0<rocsparse_double_complex>(arg);
+    }
     else if(function == "csric0")
     {
         if(precision == 's')
@@ -663,6 +1072,13 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_csric0<rocsparse_double_complex>(arg);
     }
+    else if(function == "csric0_mixed")
+    {
+        if(precision == 'd')
+            testing_csric0_mixed<double, float>(arg);
+        else if(precision == 'z')
+            testing_csric0_mixed<rocsparse_double_complex, rocsparse_float_complex>(arg);
+    }
     else if(function == "csrilu0")
     {
         if(precision == 's')
@@ -674,6 +1090,24 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_csrilu0<rocsparse_double_complex>(arg);
     }
+    else if(function == "csrilu0_mixed")
+    {
+        if(precision == 'd')
+            testing_csrilu0_mixed<double, float>(arg);
+        else if(precision == 'z')
+            testing_csrilu0_mixed<rocsparse_double_complex, rocsparse_float_complex>(arg);
+    }
+    else if(function == "csrilu0_strided_batched")
+    {
+        if(precision == 's')
+            testing_csrilu0_strided_batched<float>(arg);
+        else if(precision == 'd')
+            testing_csrilu0_strided_batched<double>(arg);
+        else if(precision == 'c')
+            testing_csrilu0_strided_batched<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrilu0_strided_batched<rocsparse_double_complex>(arg);
+    }
     else if(function == "nnz")
     {
         if(precision == 's')
@@ -733,6 +1167,10 @@ int main(int argc, char* argv[])
     {
         testing_csr2coo<float>(arg);
     }
+    else if(function == "csr2coo_i64")
+    {
+        testing_csr2coo_i64<float>(arg);
+    }
     else if(function == "csr2csc")
     {
         if(precision == 's')
@@ -744,6 +1182,17 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_csr2csc<rocsparse_double_complex>(arg);
     }
+    else if(function == "csr2csc_i64")
+    {
+        if(precision == 's')
+            testing_csr2csc_i64<float>(arg);
+        else if(precision == 'd')
+            testing_csr2csc_i64<double>(arg);
+        else if(precision == 'c')
+            testing_csr2csc_i64<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csr2csc_i64<rocsparse_double_complex>(arg);
+    }
     else if(function == "csr2ell")
     {
         if(precision == 's')
@@ -777,10 +1226,51 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_csr2bsr<rocsparse_double_complex>(arg);
     }
+    else if(function == "csr2bsr_block_dim_analysis")
+    {
+        if(precision == 's')
+            testing_csr2bsr_block_dim_analysis<float>(arg);
+        else if(precision == 'd')
+            testing_csr2bsr_block_dim_analysis<double>(arg);
+        else if(precision == 'c')
+            testing_csr2bsr_block_dim_analysis<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csr2bsr_block_dim_analysis<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csr2vbr")
+    {
+        if(precision == 's')
+            testing_csr2vbr<float>(arg);
+        else if(precision == 'd')
+            testing_csr2vbr<double>(arg);
+        else if(precision == 'c')
+            testing_csr2vbr<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csr2vbr<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csr2csrdc")
+    {
+        testing_csr2csrdc<float>(arg);
+    }
+    else if(function == "csr2dia")
+    {
+        if(precision == 's')
+            testing_csr2dia<float>(arg);
+        else if(precision == 'd')
+            testing_csr2dia<double>(arg);
+        else if(precision == 'c')
+            testing_csr2dia<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csr2dia<rocsparse_double_complex>(arg);
+    }
     else if(function == "coo2csr")
     {
         testing_coo2csr<float>(arg);
     }
+    else if(function == "coo2csr_i64")
+    {
+        testing_coo2csr_i64<float>(arg);
+    }
     else if(function == "ell2csr")
     {
         if(precision == 's')
@@ -792,6 +1282,17 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_ell2csr<rocsparse_double_complex>(arg);
     }
+    else if(function == "dia2csr")
+    {
+        if(precision == 's')
+            testing_dia2csr<float>(arg);
+        else if(precision == 'd')
+            testing_dia2csr<double>(arg);
+        else if(precision == 'c')
+            testing_dia2csr<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_dia2csr<rocsparse_double_complex>(arg);
+    }
     else if(function == "hyb2csr")
     {
         if(precision == 's')
@@ -841,6 +1342,10 @@ int main(int argc, char* argv[])
     {
         testing_identity<float>(arg);
     }
+    else if(function == "create_handle")
+    {
+        testing_create_handle<float>(arg);
+    }
     else
     {
         std::cerr << "Invalid value for --function" << std::endl;
@@ -430,6 +430,442 @@ rocsparse_status rocsparse_bsrmv(rocsparse_handle                handle,
                             y);
 }
 
+template <>
+rocsparse_status rocsparse_bsrmv_mixed(rocsparse_handle          handle,
+                                       rocsparse_direction       dir,
+                                       rocsparse_operation       trans,
+                                       rocsparse_int             mb,
+                                       rocsparse_int             nb,
+                                       rocsparse_int             nnzb,
+                                       const float*              alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_half*     bsr_val,
+                                       const rocsparse_int*      bsr_row_ptr,
+                                       const rocsparse_int*      bsr_col_ind,
+                                       rocsparse_int             bsr_dim,
+                                       const float*              x,
+                                       const float*              beta,
+                                       float*                    y)
+{
+    return rocsparse_shbsrmv(handle,
+                             dir,
+                             trans,
+                             mb,
+                             nb,
+                             nnzb,
+                             alpha,
+                             descr,
+                             bsr_val,
+                             bsr_row_ptr,
+                             bsr_col_ind,
+                             bsr_dim,
+                             x,
+                             beta,
+                             y);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmv_mixed(rocsparse_handle          handle,
+                                       rocsparse_direction       dir,
+                                       rocsparse_operation       trans,
+                                       rocsparse_int             mb,
+                                       rocsparse_int             nb,
+                                       rocsparse_int             nnzb,
+                                       const float*              alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_bfloat16* bsr_val,
+                                       const rocsparse_int*      bsr_row_ptr,
+                                       const rocsparse_int*      bsr_col_ind,
+                                       rocsparse_int             bsr_dim,
+                                       const float*              x,
+                                       const float*              beta,
+                                       float*                    y)
+{
+    return rocsparse_sbbsrmv(handle,
+                             dir,
+                             trans,
+                             mb,
+                             nb,
+                             nnzb,
+                             alpha,
+                             descr,
+                             bsr_val,
+                             bsr_row_ptr,
+                             bsr_col_ind,
+                             bsr_dim,
+                             x,
+                             beta,
+                             y);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmv_ex_analysis(rocsparse_handle          handle,
+                                             rocsparse_direction       dir,
+                                             rocsparse_operation       trans,
+                                             rocsparse_int             mb,
+                                             rocsparse_int             nb,
+                                             rocsparse_int             nnzb,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              bsr_val,
+                                             const rocsparse_int*      bsr_row_ptr,
+                                             const rocsparse_int*      bsr_col_ind,
+                                             rocsparse_int             bsr_dim,
+                                             rocsparse_mat_info        info)
+{
+    return rocsparse_sbsrmv_ex_analysis(
+        handle, dir, trans, mb, nb, nnzb, descr, bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmv_ex_analysis(rocsparse_handle          handle,
+                                             rocsparse_direction       dir,
+                                             rocsparse_operation       trans,
+                                             rocsparse_int             mb,
+                                             rocsparse_int             nb,
+                                             rocsparse_int             nnzb,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             bsr_val,
+                                             const rocsparse_int*      bsr_row_ptr,
+                                             const rocsparse_int*      bsr_col_ind,
+                                             rocsparse_int             bsr_dim,
+                                             rocsparse_mat_info        info)
+{
+    return rocsparse_dbsrmv_ex_analysis(
+        handle, dir, trans, mb, nb, nnzb, descr, bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmv_ex_analysis(rocsparse_handle               handle,
+                                             rocsparse_direction            dir,
+                                             rocsparse_operation            trans,
+                                             rocsparse_int                  mb,
+                                             rocsparse_int                  nb,
+                                             rocsparse_int                  nnzb,
+                                             const rocsparse_mat_descr      descr,
+                                             const rocsparse_float_complex* bsr_val,
+                                             const rocsparse_int*           bsr_row_ptr,
+                                             const rocsparse_int*           bsr_col_ind,
+                                             rocsparse_int                  bsr_dim,
+                                             rocsparse_mat_info             info)
+{
+    return rocsparse_cbsrmv_ex_analysis(
+        handle, dir, trans, mb, nb, nnzb, descr, bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmv_ex_analysis(rocsparse_handle                handle,
+                                             rocsparse_direction             dir,
+                                             rocsparse_operation             trans,
+                                             rocsparse_int                   mb,
+                                             rocsparse_int                   nb,
+                                             rocsparse_int                   nnzb,
+                                             const rocsparse_mat_descr       descr,
+                                             const rocsparse_double_complex* bsr_val,
+                                             const rocsparse_int*            bsr_row_ptr,
+                                             const rocsparse_int*            bsr_col_ind,
+                                             rocsparse_int                   bsr_dim,
+                                             rocsparse_mat_info              info)
+{
+    return rocsparse_zbsrmv_ex_analysis(
+        handle, dir, trans, mb, nb, nnzb, descr, bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmv_ex(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_operation       trans,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nb,
+                                    rocsparse_int             nnzb,
+                                    const float*              alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              bsr_val,
+                                    const rocsparse_int*      bsr_row_ptr,
+                                    const rocsparse_int*      bsr_col_ind,
+                                    rocsparse_int             bsr_dim,
+                                    rocsparse_mat_info        info,
+                                    const float*              x,
+                                    const float*              beta,
+                                    float*                    y)
+{
+    return rocsparse_sbsrmv_ex(handle,
+                               dir,
+                               trans,
+                               mb,
+                               nb,
+                               nnzb,
+                               alpha,
+                               descr,
+                               bsr_val,
+                               bsr_row_ptr,
+                               bsr_col_ind,
+                               bsr_dim,
+                               info,
+                               x,
+                               beta,
+                               y);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmv_ex(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_operation       trans,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nb,
+                                    rocsparse_int             nnzb,
+                                    const double*             alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             bsr_val,
+                                    const rocsparse_int*      bsr_row_ptr,
+                                    const rocsparse_int*      bsr_col_ind,
+                                    rocsparse_int             bsr_dim,
+                                    rocsparse_mat_info        info,
+                                    const double*             x,
+                                    const double*             beta,
+                                    double*                   y)
+{
+    return rocsparse_dbsrmv_ex(handle,
+                               dir,
+                               trans,
+                               mb,
+                               nb,
+                               nnzb,
+                               alpha,
+                               descr,
+                               bsr_val,
+                               bsr_row_ptr,
+                               bsr_col_ind,
+                               bsr_dim,
+                               info,
+                               x,
+                               beta,
+                               y);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmv_ex(rocsparse_handle               handle,
+                                    rocsparse_direction            dir,
+                                    rocsparse_operation            trans,
+                                    rocsparse_int                  mb,
+                                    rocsparse_int                  nb,
+                                    rocsparse_int                  nnzb,
+                                    const rocsparse_float_complex* alpha,
+                                    const rocsparse_mat_descr      descr,
+                                    const rocsparse_float_complex* bsr_val,
+                                    const rocsparse_int*           bsr_row_ptr,
+                                    const rocsparse_int*           bsr_col_ind,
+                                    rocsparse_int                  bsr_dim,
+                                    rocsparse_mat_info             info,
+                                    const rocsparse_float_complex* x,
+                                    const rocsparse_float_complex* beta,
+                                    rocsparse_float_complex*       y)
+{
+    return rocsparse_cbsrmv_ex(handle,
+                               dir,
+                               trans,
+                               mb,
+                               nb,
+                               nnzb,
+                               alpha,
+                               descr,
+                               bsr_val,
+                               bsr_row_ptr,
+                               bsr_col_ind,
+                               bsr_dim,
+                               info,
+                               x,
+                               beta,
+                               y);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmv_ex(rocsparse_handle                handle,
+                                    rocsparse_direction             dir,
+                                    rocsparse_operation             trans,
+                                    rocsparse_int                   mb,
+                                    rocsparse_int                   nb,
+                                    rocsparse_int                   nnzb,
+                                    const rocsparse_double_complex* alpha,
+                                    const rocsparse_mat_descr       descr,
+                                    const rocsparse_double_complex* bsr_val,
+                                    const rocsparse_int*            bsr_row_ptr,
+                                    const rocsparse_int*            bsr_col_ind,
+                                    rocsparse_int                   bsr_dim,
+                                    rocsparse_mat_info              info,
+                                    const rocsparse_double_complex* x,
+                                    const rocsparse_double_complex* beta,
+                                    rocsparse_double_complex*       y)
+{
+    return rocsparse_zbsrmv_ex(handle,
+                               dir,
+                               trans,
+                               mb,
+                               nb,
+                               nnzb,
+                               alpha,
+                               descr,
+                               bsr_val,
+                               bsr_row_ptr,
+                               bsr_col_ind,
+                               bsr_dim,
+                               info,
+                               x,
+                               beta,
+                               y);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmv_dot(rocsparse_handle          handle,
+                                     rocsparse_direction       dir,
+                                     rocsparse_operation       trans,
+                                     rocsparse_int             mb,
+                                     rocsparse_int             nb,
+                                     rocsparse_int             nnzb,
+                                     const float*              alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const float*              bsr_val,
+                                     const rocsparse_int*      bsr_row_ptr,
+                                     const rocsparse_int*      bsr_col_ind,
+                                     rocsparse_int             bsr_dim,
+                                     const float*              x,
+                                     const float*              beta,
+                                     float*                    y,
+                                     float*                    dot_xy,
+                                     float*                    dot_yy)
+{
+    return rocsparse_sbsrmv_dot(handle,
+                                dir,
+                                trans,
+                                mb,
+                                nb,
+                                nnzb,
+                                alpha,
+                                descr,
+                                bsr_val,
+                                bsr_row_ptr,
+                                bsr_col_ind,
+                                bsr_dim,
+                                x,
+                                beta,
+                                y,
+                                dot_xy,
+                                dot_yy);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmv_dot(rocsparse_handle          handle,
+                                     rocsparse_direction       dir,
+                                     rocsparse_operation       trans,
+                                     rocsparse_int             mb,
+                                     rocsparse_int             nb,
+                                     rocsparse_int             nnzb,
+                                     const double*             alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const double*             bsr_val,
+                                     const rocsparse_int*      bsr_row_ptr,
+                                     const rocsparse_int*      bsr_col_ind,
+                                     rocsparse_int             bsr_dim,
+                                     const double*             x,
+                                     const double*             beta,
+                                     double*                   y,
+                                     double*                   dot_xy,
+                                     double*                   dot_yy)
+{
+    return rocsparse_dbsrmv_dot(handle,
+                                dir,
+                                trans,
+                                mb,
+                                nb,
+                                nnzb,
+                                alpha,
+                                descr,
+                                bsr_val,
+                                bsr_row_ptr,
+                                bsr_col_ind,
+                                bsr_dim,
+                                x,
+                                beta,
+                                y,
+                                dot_xy,
+                                dot_yy);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmv_dot(rocsparse_handle               handle,
+                                     rocsparse_direction            dir,
+                                     rocsparse_operation            trans,
+                                     rocsparse_int                  mb,
+                                     rocsparse_int                  nb,
+                                     rocsparse_int                  nnzb,
+                                     const rocsparse_float_complex* alpha,
+                                     const rocsparse_mat_descr      descr,
+                                     const rocsparse_float_complex* bsr_val,
+                                     const rocsparse_int*           bsr_row_ptr,
+                                     const rocsparse_int*           bsr_col_ind,
+                                     rocsparse_int                  bsr_dim,
+                                     const rocsparse_float_complex* x,
+                                     const rocsparse_float_complex* beta,
+                                     rocsparse_float_complex*       y,
+                                     rocsparse_float_complex*       dot_xy,
+                                     rocsparse_float_complex*       dot_yy)
+{
+    return rocsparse_cbsrmv_dot(handle,
+                                dir,
+                                trans,
+                                mb,
+                                nb,
+                                nnzb,
+                                alpha,
+                                descr,
+                                bsr_val,
+                                bsr_row_ptr,
+                                bsr_col_ind,
+                                bsr_dim,
+                                x,
+                                beta,
+                                y,
+                                dot_xy,
+                                dot_yy);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmv_dot(rocsparse_handle                handle,
+                                     rocsparse_direction             dir,
+                                     rocsparse_operation             trans,
+                                     rocsparse_int                   mb,
+                                     rocsparse_int                   nb,
+                                     rocsparse_int                   nnzb,
+                                     const rocsparse_double_complex* alpha,
+                                     const rocsparse_mat_descr       descr,
+                                     const rocsparse_double_complex* bsr_val,
+                                     const rocsparse_int*            bsr_row_ptr,
+                                     const rocsparse_int*            bsr_col_ind,
+                                     rocsparse_int                   bsr_dim,
+                                     const rocsparse_double_complex* x,
+                                     const rocsparse_double_complex* beta,
+                                     rocsparse_double_complex*       y,
+                                     rocsparse_double_complex*       dot_xy,
+                                     rocsparse_double_complex*       dot_yy)
+{
+    return rocsparse_zbsrmv_dot(handle,
+                                dir,
+                                trans,
+                                mb,
+                                nb,
+                                nnzb,
+                                alpha,
+                                descr,
+                                bsr_val,
+                                bsr_row_ptr,
+                                bsr_col_ind,
+                                bsr_dim,
+                                x,
+                                beta,
+                                y,
+                                dot_xy,
+                                dot_yy);
+}
+
 // bsrsv
 template <>
 rocsparse_status rocsparse_bsrsv_buffer_size(rocsparse_handle          handle,
@@ -892,6 +1328,44 @@ rocsparse_status rocsparse_coomv(rocsparse_handle                handle,
         handle, trans, m, n, nnz, alpha, descr, coo_val, coo_row_ind, coo_col_ind, x, beta, y);
 }
 
+template <>
+rocsparse_status rocsparse_coomv_mixed(rocsparse_handle          handle,
+                                       rocsparse_operation       trans,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       rocsparse_int             nnz,
+                                       const float*              alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_half*     coo_val,
+                                       const rocsparse_int*      coo_row_ind,
+                                       const rocsparse_int*      coo_col_ind,
+                                       const float*              x,
+                                       const float*              beta,
+                                       float*                    y)
+{
+    return rocsparse_shcoomv(
+        handle, trans, m, n, nnz, alpha, descr, coo_val, coo_row_ind, coo_col_ind, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_coomv_mixed(rocsparse_handle          handle,
+                                       rocsparse_operation       trans,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       rocsparse_int             nnz,
+                                       const float*              alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_bfloat16* coo_val,
+                                       const rocsparse_int*      coo_row_ind,
+                                       const rocsparse_int*      coo_col_ind,
+                                       const float*              x,
+                                       const float*              beta,
+                                       float*                    y)
+{
+    return rocsparse_sbcoomv(
+        handle, trans, m, n, nnz, alpha, descr, coo_val, coo_row_ind, coo_col_ind, x, beta, y);
+}
+
 // csrmv
 template <>
 rocsparse_status rocsparse_csrmv_analysis(rocsparse_handle          handle,
@@ -957,6 +1431,102 @@ rocsparse_status rocsparse_csrmv_analysis(rocsparse_handle                handle
         handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
 }
 
+template <>
+rocsparse_status rocsparse_csrmv_analysis_i64(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              int32_t                   m,
+                                              int32_t                   n,
+                                              int64_t                   nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const float*              csr_val,
+                                              const int64_t*            csr_row_ptr,
+                                              const int32_t*            csr_col_ind,
+                                              rocsparse_mat_info        info)
+{
+    return rocsparse_scsrmv_analysis_i64(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_analysis_i64(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              int32_t                   m,
+                                              int32_t                   n,
+                                              int64_t                   nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const double*             csr_val,
+                                              const int64_t*            csr_row_ptr,
+                                              const int32_t*            csr_col_ind,
+                                              rocsparse_mat_info        info)
+{
+    return rocsparse_dcsrmv_analysis_i64(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_analysis_i64(rocsparse_handle               handle,
+                                              rocsparse_operation            trans,
+                                              int32_t                        m,
+                                              int32_t                        n,
+                                              int64_t                        nnz,
+                                              const rocsparse_mat_descr      descr,
+                                              const rocsparse_float_complex* csr_val,
+                                              const int64_t*                 csr_row_ptr,
+                                              const int32_t*                 csr_col_ind,
+                                              rocsparse_mat_info             info)
+{
+    return rocsparse_ccsrmv_analysis_i64(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_analysis_i64(rocsparse_handle                handle,
+                                              rocsparse_operation             trans,
+                                              int32_t                         m,
+                                              int32_t                         n,
+                                              int64_t                         nnz,
+                                              const rocsparse_mat_descr       descr,
+                                              const rocsparse_double_complex* csr_val,
+                                              const int64_t*                  csr_row_ptr,
+                                              const int32_t*                  csr_col_ind,
+                                              rocsparse_mat_info              info)
+{
+    return rocsparse_zcsrmv_analysis_i64(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_analysis(rocsparse_handle          handle,
+                                          rocsparse_operation       trans,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          rocsparse_int             nnz,
+                                          const rocsparse_mat_descr descr,
+                                          const rocsparse_half*     csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          rocsparse_mat_info        info)
+{
+    return rocsparse_shcsrmv_analysis(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_analysis(rocsparse_handle          handle,
+                                          rocsparse_operation       trans,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          rocsparse_int             nnz,
+                                          const rocsparse_mat_descr descr,
+                                          const rocsparse_bfloat16* csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          rocsparse_mat_info        info)
+{
+    return rocsparse_sbcsrmv_analysis(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
 template <>
 rocsparse_status rocsparse_csrmv(rocsparse_handle          handle,
                                  rocsparse_operation       trans,
@@ -1085,6 +1655,682 @@ rocsparse_status rocsparse_csrmv(rocsparse_handle                handle,
                             y);
 }
 
+template <>
+rocsparse_status rocsparse_csrmv_i64(rocsparse_handle          handle,
+                                     rocsparse_operation       trans,
+                                     int32_t                   m,
+                                     int32_t                   n,
+                                     int64_t                   nnz,
+                                     const float*              alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const float*              csr_val,
+                                     const int64_t*            csr_row_ptr,
+                                     const int32_t*            csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     const float*              x,
+                                     const float*              beta,
+                                     float*                    y)
+{
+    return rocsparse_scsrmv_i64(handle,
+                                trans,
+                                m,
+                                n,
+                                nnz,
+                                alpha,
+                                descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                info,
+                                x,
+                                beta,
+                                y);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_i64(rocsparse_handle          handle,
+                                     rocsparse_operation       trans,
+                                     int32_t                   m,
+                                     int32_t                   n,
+                                     int64_t                   nnz,
+                                     const double*             alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const double*             csr_val,
+                                     const int64_t*            csr_row_ptr,
+                                     const int32_t*            csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     const double*             x,
+                                     const double*             beta,
+                                     double*                   y)
+{
+    return rocsparse_dcsrmv_i64(handle,
+                                trans,
+                                m,
+                                n,
+                                nnz,
+                                alpha,
+                                descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                info,
+                                x,
+                                beta,
+                                y);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_i64(rocsparse_handle               handle,
+                                     rocsparse_operation            trans,
+                                     int32_t                        m,
+                                     int32_t                        n,
+                                     int64_t                        nnz,
+                                     const rocsparse_float_complex* alpha,
+                                     const rocsparse_mat_descr      descr,
+                                     const rocsparse_float_complex* csr_val,
+                                     const int64_t*                 csr_row_ptr,
+                                     const int32_t*                 csr_col_ind,
+                                     rocsparse_mat_info             info,
+                                     const rocsparse_float_complex* x,
+                                     const rocsparse_float_complex* beta,
+                                     rocsparse_float_complex*       y)
+{
+    return rocsparse_ccsrmv_i64(handle,
+                                trans,
+                                m,
+                                n,
+                                nnz,
+                                alpha,
+                                descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                info,
+                                x,
+                                beta,
+                                y);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_i64(rocsparse_handle                handle,
+                                     rocsparse_operation             trans,
+                                     int32_t                         m,
+                                     int32_t                         n,
+                                     int64_t                         nnz,
+                                     const rocsparse_double_complex* alpha,
+                                     const rocsparse_mat_descr       descr,
+                                     const rocsparse_double_complex* csr_val,
+                                     const int64_t*                  csr_row_ptr,
+                                     const int32_t*                  csr_col_ind,
+                                     rocsparse_mat_info              info,
+                                     const rocsparse_double_complex* x,
+                                     const rocsparse_double_complex* beta,
+                                     rocsparse_double_complex*       y)
+{
+    return rocsparse_zcsrmv_i64(handle,
+                                trans,
+                                m,
+                                n,
+                                nnz,
+                                alpha,
+                                descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                info,
+                                x,
+                                beta,
+                                y);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_mixed(rocsparse_handle          handle,
+                                       rocsparse_operation       trans,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       rocsparse_int             nnz,
+                                       const float*              alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_half*     csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_mat_info        info,
+                                       const float*              x,
+                                       const float*              beta,
+                                       float*                    y)
+{
+    return rocsparse_shcsrmv(handle,
+                             trans,
+                             m,
+                             n,
+                             nnz,
+                             alpha,
+                             descr,
+                             csr_val,
+                             csr_row_ptr,
+                             csr_col_ind,
+                             info,
+                             x,
+                             beta,
+                             y);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_mixed(rocsparse_handle          handle,
+                                       rocsparse_operation       trans,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       rocsparse_int             nnz,
+                                       const float*              alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_bfloat16* csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_mat_info        info,
+                                       const float*              x,
+                                       const float*              beta,
+                                       float*                    y)
+{
+    return rocsparse_sbcsrmv(handle,
+                             trans,
+                             m,
+                             n,
+                             nnz,
+                             alpha,
+                             descr,
+                             csr_val,
+                             csr_row_ptr,
+                             csr_col_ind,
+                             info,
+                             x,
+                             beta,
+                             y);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_dot(rocsparse_handle          handle,
+                                     rocsparse_operation       trans,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             nnz,
+                                     const float*              alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const float*              csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     const float*              x,
+                                     const float*              beta,
+                                     float*                    y,
+                                     float*                    dot_xy,
+                                     float*                    dot_yy)
+{
+    return rocsparse_scsrmv_dot(handle,
+                                trans,
+                                m,
+                                n,
+                                nnz,
+                                alpha,
+                                descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                x,
+                                beta,
+                                y,
+                                dot_xy,
+                                dot_yy);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_dot(rocsparse_handle          handle,
+                                     rocsparse_operation       trans,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             nnz,
+                                     const double*             alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const double*             csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     const double*             x,
+                                     const double*             beta,
+                                     double*                   y,
+                                     double*                   dot_xy,
+                                     double*                   dot_yy)
+{
+    return rocsparse_dcsrmv_dot(handle,
+                                trans,
+                                m,
+                                n,
+                                nnz,
+                                alpha,
+                                descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                x,
+                                beta,
+                                y,
+                                dot_xy,
+                                dot_yy);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_dot(rocsparse_handle               handle,
+                                     rocsparse_operation            trans,
+                                     rocsparse_int                  m,
+                                     rocsparse_int                  n,
+                                     rocsparse_int                  nnz,
+                                     const rocsparse_float_complex* alpha,
+                                     const rocsparse_mat_descr      descr,
+                                     const rocsparse_float_complex* csr_val,
+                                     const rocsparse_int*           csr_row_ptr,
+                                     const rocsparse_int*           csr_col_ind,
+                                     const rocsparse_float_complex* x,
+                                     const rocsparse_float_complex* beta,
+                                     rocsparse_float_complex*       y,
+                                     rocsparse_float_complex*       dot_xy,
+                                     rocsparse_float_complex*       dot_yy)
+{
+    return rocsparse_ccsrmv_dot(handle,
+                                trans,
+                                m,
+                                n,
+                                nnz,
+                                alpha,
+                                descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                x,
+                                beta,
+                                y,
+                                dot_xy,
+                                dot_yy);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_dot(rocsparse_handle                handle,
+                                     rocsparse_operation             trans,
+                                     rocsparse_int                   m,
+                                     rocsparse_int                   n,
+                                     rocsparse_int                   nnz,
+                                     const rocsparse_double_complex* alpha,
+                                     const rocsparse_mat_descr       descr,
+                                     const rocsparse_double_complex* csr_val,
+                                     const rocsparse_int*            csr_row_ptr,
+                                     const rocsparse_int*            csr_col_ind,
+                                     const rocsparse_double_complex* x,
+                                     const rocsparse_double_complex* beta,
+                                     rocsparse_double_complex*       y,
+                                     rocsparse_double_complex*       dot_xy,
+                                     rocsparse_double_complex*       dot_yy)
+{
+    return rocsparse_zcsrmv_dot(handle,
+                                trans,
+                                m,
+                                n,
+                                nnz,
+                                alpha,
+                                descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                x,
+                                beta,
+                                y,
+                                dot_xy,
+                                dot_yy);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_format_analysis(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const float*              csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 rocsparse_int             benchmark_iter,
+                                                 rocsparse_mat_info        info)
+{
+    return rocsparse_scsrmv_format_analysis(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, benchmark_iter, info);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_format_analysis(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const double*             csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 rocsparse_int             benchmark_iter,
+                                                 rocsparse_mat_info        info)
+{
+    return rocsparse_dcsrmv_format_analysis(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, benchmark_iter, info);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_format_analysis(rocsparse_handle               handle,
+                                                 rocsparse_operation            trans,
+                                                 rocsparse_int                  m,
+                                                 rocsparse_int                  n,
+                                                 rocsparse_int                  nnz,
+                                                 const rocsparse_mat_descr      descr,
+                                                 const rocsparse_float_complex* csr_val,
+                                                 const rocsparse_int*           csr_row_ptr,
+                                                 const rocsparse_int*           csr_col_ind,
+                                                 rocsparse_int                  benchmark_iter,
+                                                 rocsparse_mat_info             info)
+{
+    return rocsparse_ccsrmv_format_analysis(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, benchmark_iter, info);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_format_analysis(rocsparse_handle                handle,
+                                                 rocsparse_operation             trans,
+                                                 rocsparse_int                   m,
+                                                 rocsparse_int                   n,
+                                                 rocsparse_int                   nnz,
+                                                 const rocsparse_mat_descr       descr,
+                                                 const rocsparse_double_complex* csr_val,
+                                                 const rocsparse_int*            csr_row_ptr,
+                                                 const rocsparse_int*            csr_col_ind,
+                                                 rocsparse_int                   benchmark_iter,
+                                                 rocsparse_mat_info              info)
+{
+    return rocsparse_zcsrmv_format_analysis(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, benchmark_iter, info);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_format(rocsparse_handle          handle,
+                                        rocsparse_operation       trans,
+                                        rocsparse_int             m,
+                                        rocsparse_int             n,
+                                        rocsparse_int             nnz,
+                                        const float*              alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const float*              csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        const float*              x,
+                                        const float*              beta,
+                                        float*                    y)
+{
+    return rocsparse_scsrmv_format(handle,
+                                   trans,
+                                   m,
+                                   n,
+                                   nnz,
+                                   alpha,
+                                   descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   info,
+                                   x,
+                                   beta,
+                                   y);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_format(rocsparse_handle          handle,
+                                        rocsparse_operation       trans,
+                                        rocsparse_int             m,
+                                        rocsparse_int             n,
+                                        rocsparse_int             nnz,
+                                        const double*             alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const double*             csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        const double*             x,
+                                        const double*             beta,
+                                        double*                   y)
+{
+    return rocsparse_dcsrmv_format(handle,
+                                   trans,
+                                   m,
+                                   n,
+                                   nnz,
+                                   alpha,
+                                   descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   info,
+                                   x,
+                                   beta,
+                                   y);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_format(rocsparse_handle               handle,
+                                        rocsparse_operation            trans,
+                                        rocsparse_int                  m,
+                                        rocsparse_int                  n,
+                                        rocsparse_int                  nnz,
+                                        const rocsparse_float_complex* alpha,
+                                        const rocsparse_mat_descr      descr,
+                                        const rocsparse_float_complex* csr_val,
+                                        const rocsparse_int*           csr_row_ptr,
+                                        const rocsparse_int*           csr_col_ind,
+                                        rocsparse_mat_info             info,
+                                        const rocsparse_float_complex* x,
+                                        const rocsparse_float_complex* beta,
+                                        rocsparse_float_complex*       y)
+{
+    return rocsparse_ccsrmv_format(handle,
+                                   trans,
+                                   m,
+                                   n,
+                                   nnz,
+                                   alpha,
+                                   descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   info,
+                                   x,
+                                   beta,
+                                   y);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_format(rocsparse_handle                handle,
+                                        rocsparse_operation             trans,
+                                        rocsparse_int                   m,
+                                        rocsparse_int                   n,
+                                        rocsparse_int                   nnz,
+                                        const rocsparse_double_complex* alpha,
+                                        const rocsparse_mat_descr       descr,
+                                        const rocsparse_double_complex* csr_val,
+                                        const rocsparse_int*            csr_row_ptr,
+                                        const rocsparse_int*            csr_col_ind,
+                                        rocsparse_mat_info              info,
+                                        const rocsparse_double_complex* x,
+                                        const rocsparse_double_complex* beta,
+                                        rocsparse_double_complex*       y)
+{
+    return rocsparse_zcsrmv_format(handle,
+                                   trans,
+                                   m,
+                                   n,
+                                   nnz,
+                                   alpha,
+                                   descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   info,
+                                   x,
+                                   beta,
+                                   y);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_strided_batched(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             nnz,
+                                                 const float*              alpha,
+                                                 const rocsparse_mat_descr descr,
+                                                 const float*              csr_val,
+                                                 rocsparse_int             stride_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 const float*              x,
+                                                 rocsparse_int             stride_x,
+                                                 const float*              beta,
+                                                 float*                    y,
+                                                 rocsparse_int             stride_y,
+                                                 rocsparse_int             batch_count)
+{
+    return rocsparse_scsrmv_strided_batched(handle,
+                                            trans,
+                                            m,
+                                            n,
+                                            nnz,
+                                            alpha,
+                                            descr,
+                                            csr_val,
+                                            stride_val,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            x,
+                                            stride_x,
+                                            beta,
+                                            y,
+                                            stride_y,
+                                            batch_count);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_strided_batched(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             nnz,
+                                                 const double*             alpha,
+                                                 const rocsparse_mat_descr descr,
+                                                 const double*             csr_val,
+                                                 rocsparse_int             stride_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 const double*             x,
+                                                 rocsparse_int             stride_x,
+                                                 const double*             beta,
+                                                 double*                   y,
+                                                 rocsparse_int             stride_y,
+                                                 rocsparse_int             batch_count)
+{
+    return rocsparse_dcsrmv_strided_batched(handle,
+                                            trans,
+                                            m,
+                                            n,
+                                            nnz,
+                                            alpha,
+                                            descr,
+                                            csr_val,
+                                            stride_val,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            x,
+                                            stride_x,
+                                            beta,
+                                            y,
+                                            stride_y,
+                                            batch_count);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_strided_batched(rocsparse_handle               handle,
+                                                 rocsparse_operation            trans,
+                                                 rocsparse_int                  m,
+                                                 rocsparse_int                  n,
+                                                 rocsparse_int                  nnz,
+                                                 const rocsparse_float_complex* alpha,
+                                                 const rocsparse_mat_descr      descr,
+                                                 const rocsparse_float_complex* csr_val,
+                                                 rocsparse_int                  stride_val,
+                                                 const rocsparse_int*           csr_row_ptr,
+                                                 const rocsparse_int*           csr_col_ind,
+                                                 const rocsparse_float_complex* x,
+                                                 rocsparse_int                  stride_x,
+                                                 const rocsparse_float_complex* beta,
+                                                 rocsparse_float_complex*       y,
+                                                 rocsparse_int                  stride_y,
+                                                 rocsparse_int                  batch_count)
+{
+    return rocsparse_ccsrmv_strided_batched(handle,
+                                            trans,
+                                            m,
+                                            n,
+                                            nnz,
+                                            alpha,
+                                            descr,
+                                            csr_val,
+                                            stride_val,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            x,
+                                            stride_x,
+                                            beta,
+                                            y,
+                                            stride_y,
+                                            batch_count);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_strided_batched(rocsparse_handle                handle,
+                                                 rocsparse_operation             trans,
+                                                 rocsparse_int                   m,
+                                                 rocsparse_int                   n,
+                                                 rocsparse_int                   nnz,
+                                                 const rocsparse_double_complex* alpha,
+                                                 const rocsparse_mat_descr       descr,
+                                                 const rocsparse_double_complex* csr_val,
+                                                 rocsparse_int                   stride_val,
+                                                 const rocsparse_int*            csr_row_ptr,
+                                                 const rocsparse_int*            csr_col_ind,
+                                                 const rocsparse_double_complex* x,
+                                                 rocsparse_int                   stride_x,
+                                                 const rocsparse_double_complex* beta,
+                                                 rocsparse_double_complex*       y,
+                                                 rocsparse_int                   stride_y,
+                                                 rocsparse_int                   batch_count)
+{
+    return rocsparse_zcsrmv_strided_batched(handle,
+                                            trans,
+                                            m,
+                                            n,
+                                            nnz,
+                                            alpha,
+                                            descr,
+                                            csr_val,
+                                            stride_val,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            x,
+                                            stride_x,
+                                            beta,
+                                            y,
+                                            stride_y,
+                                            batch_count);
+}
+
 // csrsv
 template <>
 rocsparse_status rocsparse_csrsv_buffer_size(rocsparse_handle          handle,
@@ -1151,10 +2397,74 @@ rocsparse_status rocsparse_csrsv_buffer_size(rocsparse_handle                han
 }
 
 template <>
-rocsparse_status rocsparse_csrsv_analysis(rocsparse_handle          handle,
-                                          rocsparse_operation       trans,
-                                          rocsparse_int             m,
-                                          rocsparse_int             nnz,
+rocsparse_status rocsparse_csrsv_buffer_size_i64(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 int32_t                   m,
+                                                 int64_t                   nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const float*              csr_val,
+                                                 const int64_t*            csr_row_ptr,
+                                                 const int32_t*            csr_col_ind,
+                                                 rocsparse_mat_info        info,
+                                                 size_t*                   buffer_size)
+{
+    return rocsparse_scsrsv_buffer_size_i64(
+        handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_buffer_size_i64(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 int32_t                   m,
+                                                 int64_t                   nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const double*             csr_val,
+                                                 const int64_t*            csr_row_ptr,
+                                                 const int32_t*            csr_col_ind,
+                                                 rocsparse_mat_info        info,
+                                                 size_t*                   buffer_size)
+{
+    return rocsparse_dcsrsv_buffer_size_i64(
+        handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_buffer_size_i64(rocsparse_handle               handle,
+                                                 rocsparse_operation            trans,
+                                                 int32_t                        m,
+                                                 int64_t                        nnz,
+                                                 const rocsparse_mat_descr      descr,
+                                                 const rocsparse_float_complex* csr_val,
+                                                 const int64_t*                 csr_row_ptr,
+                                                 const int32_t*                 csr_col_ind,
+                                                 rocsparse_mat_info             info,
+                                                 size_t*                        buffer_size)
+{
+    return rocsparse_ccsrsv_buffer_size_i64(
+        handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_buffer_size_i64(rocsparse_handle                handle,
+                                                 rocsparse_operation             trans,
+                                                 int32_t                         m,
+                                                 int64_t                         nnz,
+                                                 const rocsparse_mat_descr       descr,
+                                                 const rocsparse_double_complex* csr_val,
+                                                 const int64_t*                  csr_row_ptr,
+                                                 const int32_t*                  csr_col_ind,
+                                                 rocsparse_mat_info              info,
+                                                 size_t*                         buffer_size)
+{
+    return rocsparse_zcsrsv_buffer_size_i64(
+        handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_analysis(rocsparse_handle          handle,
+                                          rocsparse_operation       trans,
+                                          rocsparse_int             m,
+                                          rocsparse_int             nnz,
                                           const rocsparse_mat_descr descr,
                                           const float*              csr_val,
                                           const rocsparse_int*      csr_row_ptr,
@@ -1262,6 +2572,118 @@ rocsparse_status rocsparse_csrsv_analysis(rocsparse_handle                handle
                                      temp_buffer);
 }
 
+template <>
+rocsparse_status rocsparse_csrsv_analysis_i64(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              int32_t                   m,
+                                              int64_t                   nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const float*              csr_val,
+                                              const int64_t*            csr_row_ptr,
+                                              const int32_t*            csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              rocsparse_analysis_policy analysis,
+                                              rocsparse_solve_policy    solve,
+                                              void*                     temp_buffer)
+{
+    return rocsparse_scsrsv_analysis_i64(handle,
+                                         trans,
+                                         m,
+                                         nnz,
+                                         descr,
+                                         csr_val,
+                                         csr_row_ptr,
+                                         csr_col_ind,
+                                         info,
+                                         analysis,
+                                         solve,
+                                         temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_analysis_i64(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              int32_t                   m,
+                                              int64_t                   nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const double*             csr_val,
+                                              const int64_t*            csr_row_ptr,
+                                              const int32_t*            csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              rocsparse_analysis_policy analysis,
+                                              rocsparse_solve_policy    solve,
+                                              void*                     temp_buffer)
+{
+    return rocsparse_dcsrsv_analysis_i64(handle,
+                                         trans,
+                                         m,
+                                         nnz,
+                                         descr,
+                                         csr_val,
+                                         csr_row_ptr,
+                                         csr_col_ind,
+                                         info,
+                                         analysis,
+                                         solve,
+                                         temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_analysis_i64(rocsparse_handle               handle,
+                                              rocsparse_operation            trans,
+                                              int32_t                        m,
+                                              int64_t                        nnz,
+                                              const rocsparse_mat_descr      descr,
+                                              const rocsparse_float_complex* csr_val,
+                                              const int64_t*                 csr_row_ptr,
+                                              const int32_t*                 csr_col_ind,
+                                              rocsparse_mat_info             info,
+                                              rocsparse_analysis_policy      analysis,
+                                              rocsparse_solve_policy         solve,
+                                              void*                          temp_buffer)
+{
+    return rocsparse_ccsrsv_analysis_i64(handle,
+                                         trans,
+                                         m,
+                                         nnz,
+                                         descr,
+                                         csr_val,
+                                         csr_row_ptr,
+                                         csr_col_ind,
+                                         info,
+                                         analysis,
+                                         solve,
+                                         temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_analysis_i64(rocsparse_handle                handle,
+                                              rocsparse_operation             trans,
+                                              int32_t                         m,
+                                              int64_t                         nnz,
+                                              const rocsparse_mat_descr       descr,
+                                              const rocsparse_double_complex* csr_val,
+                                              const int64_t*                  csr_row_ptr,
+                                              const int32_t*                  csr_col_ind,
+                                              rocsparse_mat_info              info,
+                                              rocsparse_analysis_policy       analysis,
+                                              rocsparse_solve_policy          solve,
+                                              void*                           temp_buffer)
+{
+    return rocsparse_zcsrsv_analysis_i64(handle,
+                                         trans,
+                                         m,
+                                         nnz,
+                                         descr,
+                                         csr_val,
+                                         csr_row_ptr,
+                                         csr_col_ind,
+                                         info,
+                                         analysis,
+                                         solve,
+                                         temp_buffer);
+}
+
 template <>
 rocsparse_status rocsparse_csrsv_solve(rocsparse_handle          handle,
                                        rocsparse_operation       trans,
@@ -1390,6 +2812,537 @@ rocsparse_status rocsparse_csrsv_solve(rocsparse_handle                handle,
                                   temp_buffer);
 }
 
+template <>
+rocsparse_status rocsparse_csrsv_solve_i64(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           int32_t                   m,
+                                           int64_t                   nnz,
+                                           const float*              alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              csr_val,
+                                           const int64_t*            csr_row_ptr,
+                                           const int32_t*            csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           const float*              x,
+                                           float*                    y,
+                                           rocsparse_solve_policy    policy,
+                                           void*                     temp_buffer)
+{
+    return rocsparse_scsrsv_solve_i64(handle,
+                                      trans,
+                                      m,
+                                      nnz,
+                                      alpha,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      x,
+                                      y,
+                                      policy,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_solve_i64(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           int32_t                   m,
+                                           int64_t                   nnz,
+                                           const double*             alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             csr_val,
+                                           const int64_t*            csr_row_ptr,
+                                           const int32_t*            csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           const double*             x,
+                                           double*                   y,
+                                           rocsparse_solve_policy    policy,
+                                           void*                     temp_buffer)
+{
+    return rocsparse_dcsrsv_solve_i64(handle,
+                                      trans,
+                                      m,
+                                      nnz,
+                                      alpha,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      x,
+                                      y,
+                                      policy,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_solve_i64(rocsparse_handle               handle,
+                                           rocsparse_operation            trans,
+                                           int32_t                        m,
+                                           int64_t                        nnz,
+                                           const rocsparse_float_complex* alpha,
+                                           const rocsparse_mat_descr      descr,
+                                           const rocsparse_float_complex* csr_val,
+                                           const int64_t*                 csr_row_ptr,
+                                           const int32_t*                 csr_col_ind,
+                                           rocsparse_mat_info             info,
+                                           const rocsparse_float_complex* x,
+                                           rocsparse_float_complex*       y,
+                                           rocsparse_solve_policy         policy,
+                                           void*                          temp_buffer)
+{
+    return rocsparse_ccsrsv_solve_i64(handle,
+                                      trans,
+                                      m,
+                                      nnz,
+                                      alpha,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      x,
+                                      y,
+                                      policy,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_solve_i64(rocsparse_handle                handle,
+                                           rocsparse_operation             trans,
+                                           int32_t                         m,
+                                           int64_t                         nnz,
+                                           const rocsparse_double_complex* alpha,
+                                           const rocsparse_mat_descr       descr,
+                                           const rocsparse_double_complex* csr_val,
+                                           const int64_t*                  csr_row_ptr,
+                                           const int32_t*                  csr_col_ind,
+                                           rocsparse_mat_info              info,
+                                           const rocsparse_double_complex* x,
+                                           rocsparse_double_complex*       y,
+                                           rocsparse_solve_policy          policy,
+                                           void*                           temp_buffer)
+{
+    return rocsparse_zcsrsv_solve_i64(handle,
+                                      trans,
+                                      m,
+                                      nnz,
+                                      alpha,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      x,
+                                      y,
+                                      policy,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_solve_mixed(rocsparse_handle          handle,
+                                             rocsparse_operation       trans,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const double*             alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             const double*             x,
+                                             double*                   y,
+                                             rocsparse_solve_policy    policy,
+                                             void*                     temp_buffer)
+{
+    return rocsparse_dscsrsv_solve(handle,
+                                   trans,
+                                   m,
+                                   nnz,
+                                   alpha,
+                                   descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   info,
+                                   x,
+                                   y,
+                                   policy,
+                                   temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_solve_mixed(rocsparse_handle                handle,
+                                             rocsparse_operation             trans,
+                                             rocsparse_int                   m,
+                                             rocsparse_int                   nnz,
+                                             const rocsparse_double_complex* alpha,
+                                             const rocsparse_mat_descr       descr,
+                                             const rocsparse_float_complex*  csr_val,
+                                             const rocsparse_int*            csr_row_ptr,
+                                             const rocsparse_int*            csr_col_ind,
+                                             rocsparse_mat_info              info,
+                                             const rocsparse_double_complex* x,
+                                             rocsparse_double_complex*       y,
+                                             rocsparse_solve_policy          policy,
+                                             void*                           temp_buffer)
+{
+    return rocsparse_zccsrsv_solve(handle,
+                                   trans,
+                                   m,
+                                   nnz,
+                                   alpha,
+                                   descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   info,
+                                   x,
+                                   y,
+                                   policy,
+                                   temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_strided_batched_buffer_size(rocsparse_handle          handle,
+                                                             rocsparse_operation       trans,
+                                                             rocsparse_int             m,
+                                                             rocsparse_int             nnz,
+                                                             const rocsparse_mat_descr descr,
+                                                             const float*              csr_val,
+                                                             const rocsparse_int*      csr_row_ptr,
+                                                             const rocsparse_int*      csr_col_ind,
+                                                             rocsparse_mat_info        info,
+                                                             rocsparse_int             batch_count,
+                                                             size_t*                   buffer_size)
+{
+    return rocsparse_scsrsv_strided_batched_buffer_size(handle,
+                                                        trans,
+                                                        m,
+                                                        nnz,
+                                                        descr,
+                                                        csr_val,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        info,
+                                                        batch_count,
+                                                        buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_strided_batched_buffer_size(rocsparse_handle          handle,
+                                                             rocsparse_operation       trans,
+                                                             rocsparse_int             m,
+                                                             rocsparse_int             nnz,
+                                                             const rocsparse_mat_descr descr,
+                                                             const double*             csr_val,
+                                                             const rocsparse_int*      csr_row_ptr,
+                                                             const rocsparse_int*      csr_col_ind,
+                                                             rocsparse_mat_info        info,
+                                                             rocsparse_int             batch_count,
+                                                             size_t*                   buffer_size)
+{
+    return rocsparse_dcsrsv_strided_batched_buffer_size(handle,
+                                                        trans,
+                                                        m,
+                                                        nnz,
+                                                        descr,
+                                                        csr_val,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        info,
+                                                        batch_count,
+                                                        buffer_size);
+}
+
+template <>
+rocsparse_status
+    rocsparse_csrsv_strided_batched_buffer_size(rocsparse_handle               handle,
+                                                rocsparse_operation            trans,
+                                                rocsparse_int                  m,
+                                                rocsparse_int                  nnz,
+                                                const rocsparse_mat_descr      descr,
+                                                const rocsparse_float_complex* csr_val,
+                                                const rocsparse_int*           csr_row_ptr,
+                                                const rocsparse_int*           csr_col_ind,
+                                                rocsparse_mat_info             info,
+                                                rocsparse_int                  batch_count,
+                                                size_t*                        buffer_size)
+{
+    return rocsparse_ccsrsv_strided_batched_buffer_size(handle,
+                                                        trans,
+                                                        m,
+                                                        nnz,
+                                                        descr,
+                                                        csr_val,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        info,
+                                                        batch_count,
+                                                        buffer_size);
+}
+
+template <>
+rocsparse_status
+    rocsparse_csrsv_strided_batched_buffer_size(rocsparse_handle                handle,
+                                                rocsparse_operation             trans,
+                                                rocsparse_int                   m,
+                                                rocsparse_int                   nnz,
+                                                const rocsparse_mat_descr       descr,
+                                                const rocsparse_double_complex* csr_val,
+                                                const rocsparse_int*            csr_row_ptr,
+                                                const rocsparse_int*            csr_col_ind,
+                                                rocsparse_mat_info              info,
+                                                rocsparse_int                   batch_count,
+                                                size_t*                         buffer_size)
+{
+    return rocsparse_zcsrsv_strided_batched_buffer_size(handle,
+                                                        trans,
+                                                        m,
+                                                        nnz,
+                                                        descr,
+                                                        csr_val,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        info,
+                                                        batch_count,
+                                                        buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_solve_strided_batched(rocsparse_handle          handle,
+                                                       rocsparse_operation       trans,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             nnz,
+                                                       const float*              alpha,
+                                                       const rocsparse_mat_descr descr,
+                                                       const float*              csr_val,
+                                                       rocsparse_int             stride_val,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       rocsparse_mat_info        info,
+                                                       const float*              x,
+                                                       rocsparse_int             stride_x,
+                                                       float*                    y,
+                                                       rocsparse_int             stride_y,
+                                                       rocsparse_int             batch_count,
+                                                       rocsparse_solve_policy    policy,
+                                                       void*                     temp_buffer)
+{
+    return rocsparse_scsrsv_solve_strided_batched(handle,
+                                                  trans,
+                                                  m,
+                                                  nnz,
+                                                  alpha,
+                                                  descr,
+                                                  csr_val,
+                                                  stride_val,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  info,
+                                                  x,
+                                                  stride_x,
+                                                  y,
+                                                  stride_y,
+                                                  batch_count,
+                                                  policy,
+                                                  temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_solve_strided_batched(rocsparse_handle          handle,
+                                                       rocsparse_operation       trans,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             nnz,
+                                                       const double*             alpha,
+                                                       const rocsparse_mat_descr descr,
+                                                       const double*             csr_val,
+                                                       rocsparse_int             stride_val,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       rocsparse_mat_info        info,
+                                                       const double*             x,
+                                                       rocsparse_int             stride_x,
+                                                       double*                   y,
+                                                       rocsparse_int             stride_y,
+                                                       rocsparse_int             batch_count,
+                                                       rocsparse_solve_policy    policy,
+                                                       void*                     temp_buffer)
+{
+    return rocsparse_dcsrsv_solve_strided_batched(handle,
+                                                  trans,
+                                                  m,
+                                                  nnz,
+                                                  alpha,
+                                                  descr,
+                                                  csr_val,
+                                                  stride_val,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  info,
+                                                  x,
+                                                  stride_x,
+                                                  y,
+                                                  stride_y,
+                                                  batch_count,
+                                                  policy,
+                                                  temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_solve_strided_batched(rocsparse_handle               handle,
+                                                       rocsparse_operation            trans,
+                                                       rocsparse_int                  m,
+                                                       rocsparse_int                  nnz,
+                                                       const rocsparse_float_complex* alpha,
+                                                       const rocsparse_mat_descr      descr,
+                                                       const rocsparse_float_complex* csr_val,
+                                                       rocsparse_int                  stride_val,
+                                                       const rocsparse_int*           csr_row_ptr,
+                                                       const rocsparse_int*           csr_col_ind,
+                                                       rocsparse_mat_info             info,
+                                                       const rocsparse_float_complex* x,
+                                                       rocsparse_int                  stride_x,
+                                                       rocsparse_float_complex*       y,
+                                                       rocsparse_int                  stride_y,
+                                                       rocsparse_int                  batch_count,
+                                                       rocsparse_solve_policy         policy,
+                                                       void*                          temp_buffer)
+{
+    return rocsparse_ccsrsv_solve_strided_batched(handle,
+                                                  trans,
+                                                  m,
+                                                  nnz,
+                                                  alpha,
+                                                  descr,
+                                                  csr_val,
+                                                  stride_val,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  info,
+                                                  x,
+                                                  stride_x,
+                                                  y,
+                                                  stride_y,
+                                                  batch_count,
+                                                  policy,
+                                                  temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_solve_strided_batched(rocsparse_handle                handle,
+                                                       rocsparse_operation             trans,
+                                                       rocsparse_int                   m,
+                                                       rocsparse_int                   nnz,
+                                                       const rocsparse_double_complex* alpha,
+                                                       const rocsparse_mat_descr       descr,
+                                                       const rocsparse_double_complex* csr_val,
+                                                       rocsparse_int                   stride_val,
+                                                       const rocsparse_int*            csr_row_ptr,
+                                                       const rocsparse_int*            csr_col_ind,
+                                                       rocsparse_mat_info              info,
+                                                       const rocsparse_double_complex* x,
+                                                       rocsparse_int                   stride_x,
+                                                       rocsparse_double_complex*       y,
+                                                       rocsparse_int                   stride_y,
+                                                       rocsparse_int                   batch_count,
+                                                       rocsparse_solve_policy          policy,
+                                                       void*                           temp_buffer)
+{
+    return rocsparse_zcsrsv_solve_strided_batched(handle,
+                                                  trans,
+                                                  m,
+                                                  nnz,
+                                                  alpha,
+                                                  descr,
+                                                  csr_val,
+                                                  stride_val,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  info,
+                                                  x,
+                                                  stride_x,
+                                                  y,
+                                                  stride_y,
+                                                  batch_count,
+                                                  policy,
+                                                  temp_buffer);
+}
+
+// diamv
+template <>
+rocsparse_status rocsparse_diamv(rocsparse_handle          handle,
+                                 rocsparse_operation       trans,
+                                 rocsparse_int             m,
+                                 rocsparse_int             n,
+                                 const float*              alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const float*              dia_val,
+                                 const rocsparse_int*      dia_offset,
+                                 rocsparse_int             dia_num_diag,
+                                 const float*              x,
+                                 const float*              beta,
+                                 float*                    y)
+{
+    return rocsparse_sdiamv(
+        handle, trans, m, n, alpha, descr, dia_val, dia_offset, dia_num_diag, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_diamv(rocsparse_handle          handle,
+                                 rocsparse_operation       trans,
+                                 rocsparse_int             m,
+                                 rocsparse_int             n,
+                                 const double*             alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const double*             dia_val,
+                                 const rocsparse_int*      dia_offset,
+                                 rocsparse_int             dia_num_diag,
+                                 const double*             x,
+                                 const double*             beta,
+                                 double*                   y)
+{
+    return rocsparse_ddiamv(
+        handle, trans, m, n, alpha, descr, dia_val, dia_offset, dia_num_diag, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_diamv(rocsparse_handle               handle,
+                                 rocsparse_operation            trans,
+                                 rocsparse_int                  m,
+                                 rocsparse_int                  n,
+                                 const rocsparse_float_complex* alpha,
+                                 const rocsparse_mat_descr      descr,
+                                 const rocsparse_float_complex* dia_val,
+                                 const rocsparse_int*           dia_offset,
+                                 rocsparse_int                  dia_num_diag,
+                                 const rocsparse_float_complex* x,
+                                 const rocsparse_float_complex* beta,
+                                 rocsparse_float_complex*       y)
+{
+    return rocsparse_cdiamv(
+        handle, trans, m, n, alpha, descr, dia_val, dia_offset, dia_num_diag, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_diamv(rocsparse_handle                handle,
+                                 rocsparse_operation             trans,
+                                 rocsparse_int                   m,
+                                 rocsparse_int                   n,
+                                 const rocsparse_double_complex* alpha,
+                                 const rocsparse_mat_descr       descr,
+                                 const rocsparse_double_complex* dia_val,
+                                 const rocsparse_int*            dia_offset,
+                                 rocsparse_int                   dia_num_diag,
+                                 const rocsparse_double_complex* x,
+                                 const rocsparse_double_complex* beta,
+                                 rocsparse_double_complex*       y)
+{
+    return rocsparse_zdiamv(
+        handle, trans, m, n, alpha, descr, dia_val, dia_offset, dia_num_diag, x, beta, y);
+}
+
 // ellmv
 template <>
 rocsparse_status rocsparse_ellmv(rocsparse_handle          handle,
@@ -1463,6 +3416,170 @@ rocsparse_status rocsparse_ellmv(rocsparse_handle                handle,
         handle, trans, m, n, alpha, descr, ell_val, ell_col_ind, ell_width, x, beta, y);
 }
 
+template <>
+rocsparse_status rocsparse_ellmv_mixed(rocsparse_handle          handle,
+                                       rocsparse_operation       trans,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       const float*              alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_half*     ell_val,
+                                       const rocsparse_int*      ell_col_ind,
+                                       rocsparse_int             ell_width,
+                                       const float*              x,
+                                       const float*              beta,
+                                       float*                    y)
+{
+    return rocsparse_shellmv(
+        handle, trans, m, n, alpha, descr, ell_val, ell_col_ind, ell_width, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_ellmv_mixed(rocsparse_handle          handle,
+                                       rocsparse_operation       trans,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       const float*              alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_bfloat16* ell_val,
+                                       const rocsparse_int*      ell_col_ind,
+                                       rocsparse_int             ell_width,
+                                       const float*              x,
+                                       const float*              beta,
+                                       float*                    y)
+{
+    return rocsparse_sbellmv(
+        handle, trans, m, n, alpha, descr, ell_val, ell_col_ind, ell_width, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_ellmv_dot(rocsparse_handle          handle,
+                                     rocsparse_operation       trans,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     const float*              alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const float*              ell_val,
+                                     const rocsparse_int*      ell_col_ind,
+                                     rocsparse_int             ell_width,
+                                     const float*              x,
+                                     const float*              beta,
+                                     float*                    y,
+                                     float*                    dot_xy,
+                                     float*                    dot_yy)
+{
+    return rocsparse_sellmv_dot(handle,
+                                trans,
+                                m,
+                                n,
+                                alpha,
+                                descr,
+                                ell_val,
+                                ell_col_ind,
+                                ell_width,
+                                x,
+                                beta,
+                                y,
+                                dot_xy,
+                                dot_yy);
+}
+
+template <>
+rocsparse_status rocsparse_ellmv_dot(rocsparse_handle          handle,
+                                     rocsparse_operation       trans,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     const double*             alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const double*             ell_val,
+                                     const rocsparse_int*      ell_col_ind,
+                                     rocsparse_int             ell_width,
+                                     const double*             x,
+                                     const double*             beta,
+                                     double*                   y,
+                                     double*                   dot_xy,
+                                     double*                   dot_yy)
+{
+    return rocsparse_dellmv_dot(handle,
+                                trans,
+                                m,
+                                n,
+                                alpha,
+                                descr,
+                                ell_val,
+                                ell_col_ind,
+                                ell_width,
+                                x,
+                                beta,
+                                y,
+                                dot_xy,
+                                dot_yy);
+}
+
+template <>
+rocsparse_status rocsparse_ellmv_dot(rocsparse_handle               handle,
+                                     rocsparse_operation            trans,
+                                     rocsparse_int                  m,
+                                     rocsparse_int                  n,
+                                     const rocsparse_float_complex* alpha,
+                                     const rocsparse_mat_descr      descr,
+                                     const rocsparse_float_complex* ell_val,
+                                     const rocsparse_int*           ell_col_ind,
+                                     rocsparse_int                  ell_width,
+                                     const rocsparse_float_complex* x,
+                                     const rocsparse_float_complex* beta,
+                                     rocsparse_float_complex*       y,
+                                     rocsparse_float_complex*       dot_xy,
+                                     rocsparse_float_complex*       dot_yy)
+{
+    return rocsparse_cellmv_dot(handle,
+                                trans,
+                                m,
+                                n,
+                                alpha,
+                                descr,
+                                ell_val,
+                                ell_col_ind,
+                                ell_width,
+                                x,
+                                beta,
+                                y,
+                                dot_xy,
+                                dot_yy);
+}
+
+template <>
+rocsparse_status rocsparse_ellmv_dot(rocsparse_handle                handle,
+                                     rocsparse_operation             trans,
+                                     rocsparse_int                   m,
+                                     rocsparse_int                   n,
+                                     const rocsparse_double_complex* alpha,
+                                     const rocsparse_mat_descr       descr,
+                                     const rocsparse_double_complex* ell_val,
+                                     const rocsparse_int*            ell_col_ind,
+                                     rocsparse_int                   ell_width,
+                                     const rocsparse_double_complex* x,
+                                     const rocsparse_double_complex* beta,
+                                     rocsparse_double_complex*       y,
+                                     rocsparse_double_complex*       dot_xy,
+                                     rocsparse_double_complex*       dot_yy)
+{
+    return rocsparse_zellmv_dot(handle,
+                                trans,
+                                m,
+                                n,
+                                alpha,
+                                descr,
+                                ell_val,
+                                ell_col_ind,
+                                ell_width,
+                                x,
+                                beta,
+                                y,
+                                dot_xy,
+                                dot_yy);
+}
+
 // hybmv
 template <>
 rocsparse_status rocsparse_hybmv(rocsparse_handle          handle,
@@ -1516,24 +3633,330 @@ rocsparse_status rocsparse_hybmv(rocsparse_handle                handle,
     return rocsparse_zhybmv(handle, trans, alpha, descr, hyb, x, beta, y);
 }
 
-/*
- * ===========================================================================
- *    level 3 SPARSE
- * ===========================================================================
- */
-// bsrmm
+// vbrmv
 template <>
-rocsparse_status rocsparse_bsrmm(rocsparse_handle          handle,
+rocsparse_status rocsparse_vbrmv(rocsparse_handle          handle,
                                  rocsparse_direction       dir,
-                                 rocsparse_operation       trans_A,
-                                 rocsparse_operation       trans_B,
+                                 rocsparse_operation       trans,
                                  rocsparse_int             mb,
-                                 rocsparse_int             n,
-                                 rocsparse_int             kb,
+                                 rocsparse_int             nb,
                                  rocsparse_int             nnzb,
                                  const float*              alpha,
                                  const rocsparse_mat_descr descr,
-                                 const float*              bsr_val,
+                                 const float*              vbr_val,
+                                 const rocsparse_int*      vbr_val_ptr,
+                                 const rocsparse_int*      vbr_row_ptr,
+                                 const rocsparse_int*      vbr_col_ind,
+                                 const rocsparse_int*      vbr_row_ptn,
+                                 const rocsparse_int*      vbr_col_ptn,
+                                 const float*              x,
+                                 const float*              beta,
+                                 float*                    y)
+{
+    return rocsparse_svbrmv(handle,
+                            dir,
+                            trans,
+                            mb,
+                            nb,
+                            nnzb,
+                            alpha,
+                            descr,
+                            vbr_val,
+                            vbr_val_ptr,
+                            vbr_row_ptr,
+                            vbr_col_ind,
+                            vbr_row_ptn,
+                            vbr_col_ptn,
+                            x,
+                            beta,
+                            y);
+}
+
+template <>
+rocsparse_status rocsparse_vbrmv(rocsparse_handle          handle,
+                                 rocsparse_direction       dir,
+                                 rocsparse_operation       trans,
+                                 rocsparse_int             mb,
+                                 rocsparse_int             nb,
+                                 rocsparse_int             nnzb,
+                                 const double*             alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const double*             vbr_val,
+                                 const rocsparse_int*      vbr_val_ptr,
+                                 const rocsparse_int*      vbr_row_ptr,
+                                 const rocsparse_int*      vbr_col_ind,
+                                 const rocsparse_int*      vbr_row_ptn,
+                                 const rocsparse_int*      vbr_col_ptn,
+                                 const double*             x,
+                                 const double*             beta,
+                                 double*                   y)
+{
+    return rocsparse_dvbrmv(handle,
+                            dir,
+                            trans,
+                            mb,
+                            nb,
+                            nnzb,
+                            alpha,
+                            descr,
+                            vbr_val,
+                            vbr_val_ptr,
+                            vbr_row_ptr,
+                            vbr_col_ind,
+                            vbr_row_ptn,
+                            vbr_col_ptn,
+                            x,
+                            beta,
+                            y);
+}
+
+template <>
+rocsparse_status rocsparse_vbrmv(rocsparse_handle               handle,
+                                 rocsparse_direction            dir,
+                                 rocsparse_operation            trans,
+                                 rocsparse_int                  mb,
+                                 rocsparse_int                  nb,
+                                 rocsparse_int                  nnzb,
+                                 const rocsparse_float_complex* alpha,
+                                 const rocsparse_mat_descr      descr,
+                                 const rocsparse_float_complex* vbr_val,
+                                 const rocsparse_int*           vbr_val_ptr,
+                                 const rocsparse_int*           vbr_row_ptr,
+                                 const rocsparse_int*           vbr_col_ind,
+                                 const rocsparse_int*           vbr_row_ptn,
+                                 const rocsparse_int*           vbr_col_ptn,
+                                 const rocsparse_float_complex* x,
+                                 const rocsparse_float_complex* beta,
+                                 rocsparse_float_complex*       y)
+{
+    return rocsparse_cvbrmv(handle,
+                            dir,
+                            trans,
+                            mb,
+                            nb,
+                            nnzb,
+                            alpha,
+                            descr,
+                            vbr_val,
+                            vbr_val_ptr,
+                            vbr_row_ptr,
+                            vbr_col_ind,
+                            vbr_row_ptn,
+                            vbr_col_ptn,
+                            x,
+                            beta,
+                            y);
+}
+
+template <>
+rocsparse_status rocsparse_vbrmv(rocsparse_handle                handle,
+                                 rocsparse_direction             dir,
+                                 rocsparse_operation             trans,
+                                 rocsparse_int                   mb,
+                                 rocsparse_int                   nb,
+                                 rocsparse_int                   nnzb,
+                                 const rocsparse_double_complex* alpha,
+                                 const rocsparse_mat_descr       descr,
+                                 const rocsparse_double_complex* vbr_val,
+                                 const rocsparse_int*            vbr_val_ptr,
+                                 const rocsparse_int*            vbr_row_ptr,
+                                 const rocsparse_int*            vbr_col_ind,
+                                 const rocsparse_int*            vbr_row_ptn,
+                                 const rocsparse_int*            vbr_col_ptn,
+                                 const rocsparse_double_complex* x,
+                                 const rocsparse_double_complex* beta,
+                                 rocsparse_double_complex*       y)
+{
+    return rocsparse_zvbrmv(handle,
+                            dir,
+                            trans,
+                            mb,
+                            nb,
+                            nnzb,
+                            alpha,
+                            descr,
+                            vbr_val,
+                            vbr_val_ptr,
+                            vbr_row_ptr,
+                            vbr_col_ind,
+                            vbr_row_ptn,
+                            vbr_col_ptn,
+                            x,
+                            beta,
+                            y);
+}
+
+// csrdcmv
+template <>
+rocsparse_status rocsparse_csrdcmv(rocsparse_handle          handle,
+                                   rocsparse_operation       trans,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             nnz,
+                                   const float*              alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const float*              csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   rocsparse_int             delta_bits,
+                                   const rocsparse_int*      csrdc_col_base,
+                                   const void*               csrdc_delta,
+                                   const rocsparse_int*      csrdc_exc_ptr,
+                                   const rocsparse_int*      csrdc_exc_col,
+                                   const float*              x,
+                                   const float*              beta,
+                                   float*                    y)
+{
+    return rocsparse_scsrdcmv(handle,
+                              trans,
+                              m,
+                              n,
+                              nnz,
+                              alpha,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              delta_bits,
+                              csrdc_col_base,
+                              csrdc_delta,
+                              csrdc_exc_ptr,
+                              csrdc_exc_col,
+                              x,
+                              beta,
+                              y);
+}
+
+template <>
+rocsparse_status rocsparse_csrdcmv(rocsparse_handle          handle,
+                                   rocsparse_operation       trans,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             nnz,
+                                   const double*             alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const double*             csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   rocsparse_int             delta_bits,
+                                   const rocsparse_int*      csrdc_col_base,
+                                   const void*               csrdc_delta,
+                                   const rocsparse_int*      csrdc_exc_ptr,
+                                   const rocsparse_int*      csrdc_exc_col,
+                                   const double*             x,
+                                   const double*             beta,
+                                   double*                   y)
+{
+    return rocsparse_dcsrdcmv(handle,
+                              trans,
+                              m,
+                              n,
+                              nnz,
+                              alpha,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              delta_bits,
+                              csrdc_col_base,
+                              csrdc_delta,
+                              csrdc_exc_ptr,
+                              csrdc_exc_col,
+                              x,
+                              beta,
+                              y);
+}
+
+template <>
+rocsparse_status rocsparse_csrdcmv(rocsparse_handle               handle,
+                                   rocsparse_operation            trans,
+                                   rocsparse_int                  m,
+                                   rocsparse_int                  n,
+                                   rocsparse_int                  nnz,
+                                   const rocsparse_float_complex* alpha,
+                                   const rocsparse_mat_descr      descr,
+                                   const rocsparse_float_complex* csr_val,
+                                   const rocsparse_int*           csr_row_ptr,
+                                   rocsparse_int                  delta_bits,
+                                   const rocsparse_int*           csrdc_col_base,
+                                   const void*                    csrdc_delta,
+                                   const rocsparse_int*           csrdc_exc_ptr,
+                                   const rocsparse_int*           csrdc_exc_col,
+                                   const rocsparse_float_complex* x,
+                                   const rocsparse_float_complex* beta,
+                                   rocsparse_float_complex*       y)
+{
+    return rocsparse_ccsrdcmv(handle,
+                              trans,
+                              m,
+                              n,
+                              nnz,
+                              alpha,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              delta_bits,
+                              csrdc_col_base,
+                              csrdc_delta,
+                              csrdc_exc_ptr,
+                              csrdc_exc_col,
+                              x,
+                              beta,
+                              y);
+}
+
+template <>
+rocsparse_status rocsparse_csrdcmv(rocsparse_handle                handle,
+                                   rocsparse_operation             trans,
+                                   rocsparse_int                   m,
+                                   rocsparse_int                   n,
+                                   rocsparse_int                   nnz,
+                                   const rocsparse_double_complex* alpha,
+                                   const rocsparse_mat_descr       descr,
+                                   const rocsparse_double_complex* csr_val,
+                                   const rocsparse_int*            csr_row_ptr,
+                                   rocsparse_int                   delta_bits,
+                                   const rocsparse_int*            csrdc_col_base,
+                                   const void*                     csrdc_delta,
+                                   const rocsparse_int*            csrdc_exc_ptr,
+                                   const rocsparse_int*            csrdc_exc_col,
+                                   const rocsparse_double_complex* x,
+                                   const rocsparse_double_complex* beta,
+                                   rocsparse_double_complex*       y)
+{
+    return rocsparse_zcsrdcmv(handle,
+                              trans,
+                              m,
+                              n,
+                              nnz,
+                              alpha,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              delta_bits,
+                              csrdc_col_base,
+                              csrdc_delta,
+                              csrdc_exc_ptr,
+                              csrdc_exc_col,
+                              x,
+                              beta,
+                              y);
+}
+
+/*
+ * ===========================================================================
+ *    level 3 SPARSE
+ * ===========================================================================
+ */
+// bsrmm
+template <>
+rocsparse_status rocsparse_bsrmm(rocsparse_handle          handle,
+                                 rocsparse_direction       dir,
+                                 rocsparse_operation       trans_A,
+                                 rocsparse_operation       trans_B,
+                                 rocsparse_int             mb,
+                                 rocsparse_int             n,
+                                 rocsparse_int             kb,
+                                 rocsparse_int             nnzb,
+                                 const float*              alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const float*              bsr_val,
                                  const rocsparse_int*      bsr_row_ptr,
                                  const rocsparse_int*      bsr_col_ind,
                                  rocsparse_int             block_dim,
@@ -1690,65 +4113,370 @@ rocsparse_status rocsparse_bsrmm(rocsparse_handle                handle,
                             ldc);
 }
 
-// csrmm
+// bsrmm_ex
 template <>
-rocsparse_status rocsparse_csrmm(rocsparse_handle          handle,
-                                 rocsparse_operation       trans_A,
-                                 rocsparse_operation       trans_B,
-                                 rocsparse_int             m,
-                                 rocsparse_int             n,
-                                 rocsparse_int             k,
-                                 rocsparse_int             nnz,
-                                 const float*              alpha,
-                                 const rocsparse_mat_descr descr,
-                                 const float*              csr_val,
-                                 const rocsparse_int*      csr_row_ptr,
-                                 const rocsparse_int*      csr_col_ind,
-                                 const float*              B,
-                                 rocsparse_int             ldb,
-                                 const float*              beta,
-                                 float*                    C,
-                                 rocsparse_int             ldc)
+rocsparse_status rocsparse_bsrmm_ex_analysis(rocsparse_handle          handle,
+                                             rocsparse_direction       dir,
+                                             rocsparse_operation       trans_A,
+                                             rocsparse_int             mb,
+                                             rocsparse_int             kb,
+                                             rocsparse_int             nnzb,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              bsr_val,
+                                             const rocsparse_int*      bsr_row_ptr,
+                                             const rocsparse_int*      bsr_col_ind,
+                                             rocsparse_int             block_dim,
+                                             rocsparse_mat_info        info)
 {
-    return rocsparse_scsrmm(handle,
-                            trans_A,
-                            trans_B,
-                            m,
-                            n,
-                            k,
-                            nnz,
-                            alpha,
-                            descr,
-                            csr_val,
-                            csr_row_ptr,
-                            csr_col_ind,
-                            B,
-                            ldb,
-                            beta,
-                            C,
-                            ldc);
+    return rocsparse_sbsrmm_ex_analysis(handle,
+                                        dir,
+                                        trans_A,
+                                        mb,
+                                        kb,
+                                        nnzb,
+                                        descr,
+                                        bsr_val,
+                                        bsr_row_ptr,
+                                        bsr_col_ind,
+                                        block_dim,
+                                        info);
 }
 
 template <>
-rocsparse_status rocsparse_csrmm(rocsparse_handle          handle,
-                                 rocsparse_operation       trans_A,
-                                 rocsparse_operation       trans_B,
-                                 rocsparse_int             m,
-                                 rocsparse_int             n,
-                                 rocsparse_int             k,
-                                 rocsparse_int             nnz,
-                                 const double*             alpha,
-                                 const rocsparse_mat_descr descr,
-                                 const double*             csr_val,
-                                 const rocsparse_int*      csr_row_ptr,
-                                 const rocsparse_int*      csr_col_ind,
-                                 const double*             B,
-                                 rocsparse_int             ldb,
-                                 const double*             beta,
-                                 double*                   C,
-                                 rocsparse_int             ldc)
-{
-    return rocsparse_dcsrmm(handle,
+rocsparse_status rocsparse_bsrmm_ex_analysis(rocsparse_handle          handle,
+                                             rocsparse_direction       dir,
+                                             rocsparse_operation       trans_A,
+                                             rocsparse_int             mb,
+                                             rocsparse_int             kb,
+                                             rocsparse_int             nnzb,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             bsr_val,
+                                             const rocsparse_int*      bsr_row_ptr,
+                                             const rocsparse_int*      bsr_col_ind,
+                                             rocsparse_int             block_dim,
+                                             rocsparse_mat_info        info)
+{
+    return rocsparse_dbsrmm_ex_analysis(handle,
+                                        dir,
+                                        trans_A,
+                                        mb,
+                                        kb,
+                                        nnzb,
+                                        descr,
+                                        bsr_val,
+                                        bsr_row_ptr,
+                                        bsr_col_ind,
+                                        block_dim,
+                                        info);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmm_ex_analysis(rocsparse_handle               handle,
+                                             rocsparse_direction            dir,
+                                             rocsparse_operation            trans_A,
+                                             rocsparse_int                  mb,
+                                             rocsparse_int                  kb,
+                                             rocsparse_int                  nnzb,
+                                             const rocsparse_mat_descr      descr,
+                                             const rocsparse_float_complex* bsr_val,
+                                             const rocsparse_int*           bsr_row_ptr,
+                                             const rocsparse_int*           bsr_col_ind,
+                                             rocsparse_int                  block_dim,
+                                             rocsparse_mat_info             info)
+{
+    return rocsparse_cbsrmm_ex_analysis(handle,
+                                        dir,
+                                        trans_A,
+                                        mb,
+                                        kb,
+                                        nnzb,
+                                        descr,
+                                        bsr_val,
+                                        bsr_row_ptr,
+                                        bsr_col_ind,
+                                        block_dim,
+                                        info);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmm_ex_analysis(rocsparse_handle                handle,
+                                             rocsparse_direction             dir,
+                                             rocsparse_operation             trans_A,
+                                             rocsparse_int                   mb,
+                                             rocsparse_int                   kb,
+                                             rocsparse_int                   nnzb,
+                                             const rocsparse_mat_descr       descr,
+                                             const rocsparse_double_complex* bsr_val,
+                                             const rocsparse_int*            bsr_row_ptr,
+                                             const rocsparse_int*            bsr_col_ind,
+                                             rocsparse_int                   block_dim,
+                                             rocsparse_mat_info              info)
+{
+    return rocsparse_zbsrmm_ex_analysis(handle,
+                                        dir,
+                                        trans_A,
+                                        mb,
+                                        kb,
+                                        nnzb,
+                                        descr,
+                                        bsr_val,
+                                        bsr_row_ptr,
+                                        bsr_col_ind,
+                                        block_dim,
+                                        info);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmm_ex(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_operation       trans_A,
+                                    rocsparse_operation       trans_B,
+                                    rocsparse_order           order_B,
+                                    rocsparse_order           order_C,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             n,
+                                    rocsparse_int             kb,
+                                    rocsparse_int             nnzb,
+                                    const float*              alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              bsr_val,
+                                    const rocsparse_int*      bsr_row_ptr,
+                                    const rocsparse_int*      bsr_col_ind,
+                                    rocsparse_int             block_dim,
+                                    rocsparse_mat_info        info,
+                                    const float*              B,
+                                    rocsparse_int             ldb,
+                                    const float*              beta,
+                                    float*                    C,
+                                    rocsparse_int             ldc)
+{
+    return rocsparse_sbsrmm_ex(handle,
+                               dir,
+                               trans_A,
+                               trans_B,
+                               order_B,
+                               order_C,
+                               mb,
+                               n,
+                               kb,
+                               nnzb,
+                               alpha,
+                               descr,
+                               bsr_val,
+                               bsr_row_ptr,
+                               bsr_col_ind,
+                               block_dim,
+                               info,
+                               B,
+                               ldb,
+                               beta,
+                               C,
+                               ldc);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmm_ex(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_operation       trans_A,
+                                    rocsparse_operation       trans_B,
+                                    rocsparse_order           order_B,
+                                    rocsparse_order           order_C,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             n,
+                                    rocsparse_int             kb,
+                                    rocsparse_int             nnzb,
+                                    const double*             alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             bsr_val,
+                                    const rocsparse_int*      bsr_row_ptr,
+                                    const rocsparse_int*      bsr_col_ind,
+                                    rocsparse_int             block_dim,
+                                    rocsparse_mat_info        info,
+                                    const double*             B,
+                                    rocsparse_int             ldb,
+                                    const double*             beta,
+                                    double*                   C,
+                                    rocsparse_int             ldc)
+{
+    return rocsparse_dbsrmm_ex(handle,
+                               dir,
+                               trans_A,
+                               trans_B,
+                               order_B,
+                               order_C,
+                               mb,
+                               n,
+                               kb,
+                               nnzb,
+                               alpha,
+                               descr,
+                               bsr_val,
+                               bsr_row_ptr,
+                               bsr_col_ind,
+                               block_dim,
+                               info,
+                               B,
+                               ldb,
+                               beta,
+                               C,
+                               ldc);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmm_ex(rocsparse_handle               handle,
+                                    rocsparse_direction            dir,
+                                    rocsparse_operation            trans_A,
+                                    rocsparse_operation            trans_B,
+                                    rocsparse_order                order_B,
+                                    rocsparse_order                order_C,
+                                    rocsparse_int                  mb,
+                                    rocsparse_int                  n,
+                                    rocsparse_int                  kb,
+                                    rocsparse_int                  nnzb,
+                                    const rocsparse_float_complex* alpha,
+                                    const rocsparse_mat_descr      descr,
+                                    const rocsparse_float_complex* bsr_val,
+                                    const rocsparse_int*           bsr_row_ptr,
+                                    const rocsparse_int*           bsr_col_ind,
+                                    rocsparse_int                  block_dim,
+                                    rocsparse_mat_info             info,
+                                    const rocsparse_float_complex* B,
+                                    rocsparse_int                  ldb,
+                                    const rocsparse_float_complex* beta,
+                                    rocsparse_float_complex*       C,
+                                    rocsparse_int                  ldc)
+{
+    return rocsparse_cbsrmm_ex(handle,
+                               dir,
+                               trans_A,
+                               trans_B,
+                               order_B,
+                               order_C,
+                               mb,
+                               n,
+                               kb,
+                               nnzb,
+                               alpha,
+                               descr,
+                               bsr_val,
+                               bsr_row_ptr,
+                               bsr_col_ind,
+                               block_dim,
+                               info,
+                               B,
+                               ldb,
+                               beta,
+                               C,
+                               ldc);
+}
+
+template <>
+rocsparse_status rocsparse_bsrmm_ex(rocsparse_handle                handle,
+                                    rocsparse_direction             dir,
+                                    rocsparse_operation             trans_A,
+                                    rocsparse_operation             trans_B,
+                                    rocsparse_order                 order_B,
+                                    rocsparse_order                 order_C,
+                                    rocsparse_int                   mb,
+                                    rocsparse_int                   n,
+                                    rocsparse_int                   kb,
+                                    rocsparse_int                   nnzb,
+                                    const rocsparse_double_complex* alpha,
+                                    const rocsparse_mat_descr       descr,
+                                    const rocsparse_double_complex* bsr_val,
+                                    const rocsparse_int*            bsr_row_ptr,
+                                    const rocsparse_int*            bsr_col_ind,
+                                    rocsparse_int                   block_dim,
+                                    rocsparse_mat_info              info,
+                                    const rocsparse_double_complex* B,
+                                    rocsparse_int                   ldb,
+                                    const rocsparse_double_complex* beta,
+                                    rocsparse_double_complex*       C,
+                                    rocsparse_int                   ldc)
+{
+    return rocsparse_zbsrmm_ex(handle,
+                               dir,
+                               trans_A,
+                               trans_B,
+                               order_B,
+                               order_C,
+                               mb,
+                               n,
+                               kb,
+                               nnzb,
+                               alpha,
+                               descr,
+                               bsr_val,
+                               bsr_row_ptr,
+                               bsr_col_ind,
+                               block_dim,
+                               info,
+                               B,
+                               ldb,
+                               beta,
+                               C,
+                               ldc);
+}
+
+// csrmm
+template <>
+rocsparse_status rocsparse_csrmm(rocsparse_handle          handle,
+                                 rocsparse_operation       trans_A,
+                                 rocsparse_operation       trans_B,
+                                 rocsparse_int             m,
+                                 rocsparse_int             n,
+                                 rocsparse_int             k,
+                                 rocsparse_int             nnz,
+                                 const float*              alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const float*              csr_val,
+                                 const rocsparse_int*      csr_row_ptr,
+                                 const rocsparse_int*      csr_col_ind,
+                                 const float*              B,
+                                 rocsparse_int             ldb,
+                                 const float*              beta,
+                                 float*                    C,
+                                 rocsparse_int             ldc)
+{
+    return rocsparse_scsrmm(handle,
+                            trans_A,
+                            trans_B,
+                            m,
+                            n,
+                            k,
+                            nnz,
+                            alpha,
+                            descr,
+                            csr_val,
+                            csr_row_ptr,
+                            csr_col_ind,
+                            B,
+                            ldb,
+                            beta,
+                            C,
+                            ldc);
+}
+
+template <>
+rocsparse_status rocsparse_csrmm(rocsparse_handle          handle,
+                                 rocsparse_operation       trans_A,
+                                 rocsparse_operation       trans_B,
+                                 rocsparse_int             m,
+                                 rocsparse_int             n,
+                                 rocsparse_int             k,
+                                 rocsparse_int             nnz,
+                                 const double*             alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const double*             csr_val,
+                                 const rocsparse_int*      csr_row_ptr,
+                                 const rocsparse_int*      csr_col_ind,
+                                 const double*             B,
+                                 rocsparse_int             ldb,
+                                 const double*             beta,
+                                 double*                   C,
+                                 rocsparse_int             ldc)
+{
+    return rocsparse_dcsrmm(handle,
                             trans_A,
                             trans_B,
                             m,
@@ -1843,6 +4571,323 @@ rocsparse_status rocsparse_csrmm(rocsparse_handle                handle,
                             ldc);
 }
 
+template <>
+rocsparse_status rocsparse_csrmm_mixed(rocsparse_handle          handle,
+                                       rocsparse_operation       trans_A,
+                                       rocsparse_operation       trans_B,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       rocsparse_int             k,
+                                       rocsparse_int             nnz,
+                                       const float*              alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_half*     csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       const float*              B,
+                                       rocsparse_int             ldb,
+                                       const float*              beta,
+                                       float*                    C,
+                                       rocsparse_int             ldc)
+{
+    return rocsparse_shcsrmm(handle,
+                             trans_A,
+                             trans_B,
+                             m,
+                             n,
+                             k,
+                             nnz,
+                             alpha,
+                             descr,
+                             csr_val,
+                             csr_row_ptr,
+                             csr_col_ind,
+                             B,
+                             ldb,
+                             beta,
+                             C,
+                             ldc);
+}
+
+template <>
+rocsparse_status rocsparse_csrmm_mixed(rocsparse_handle          handle,
+                                       rocsparse_operation       trans_A,
+                                       rocsparse_operation       trans_B,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       rocsparse_int             k,
+                                       rocsparse_int             nnz,
+                                       const float*              alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_bfloat16* csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       const float*              B,
+                                       rocsparse_int             ldb,
+                                       const float*              beta,
+                                       float*                    C,
+                                       rocsparse_int             ldc)
+{
+    return rocsparse_sbcsrmm(handle,
+                             trans_A,
+                             trans_B,
+                             m,
+                             n,
+                             k,
+                             nnz,
+                             alpha,
+                             descr,
+                             csr_val,
+                             csr_row_ptr,
+                             csr_col_ind,
+                             B,
+                             ldb,
+                             beta,
+                             C,
+                             ldc);
+}
+
+// csrmm_ex
+template <>
+rocsparse_status rocsparse_csrmm_ex_analysis(rocsparse_handle          handle,
+                                             rocsparse_operation       trans_A,
+                                             rocsparse_int             m,
+                                             rocsparse_int             k,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info)
+{
+    return rocsparse_scsrmm_ex_analysis(
+        handle, trans_A, m, k, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+template <>
+rocsparse_status rocsparse_csrmm_ex_analysis(rocsparse_handle          handle,
+                                             rocsparse_operation       trans_A,
+                                             rocsparse_int             m,
+                                             rocsparse_int             k,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info)
+{
+    return rocsparse_dcsrmm_ex_analysis(
+        handle, trans_A, m, k, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+template <>
+rocsparse_status rocsparse_csrmm_ex_analysis(rocsparse_handle               handle,
+                                             rocsparse_operation            trans_A,
+                                             rocsparse_int                  m,
+                                             rocsparse_int                  k,
+                                             rocsparse_int                  nnz,
+                                             const rocsparse_mat_descr      descr,
+                                             const rocsparse_float_complex* csr_val,
+                                             const rocsparse_int*           csr_row_ptr,
+                                             const rocsparse_int*           csr_col_ind,
+                                             rocsparse_mat_info             info)
+{
+    return rocsparse_ccsrmm_ex_analysis(
+        handle, trans_A, m, k, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+template <>
+rocsparse_status rocsparse_csrmm_ex_analysis(rocsparse_handle                handle,
+                                             rocsparse_operation             trans_A,
+                                             rocsparse_int                   m,
+                                             rocsparse_int                   k,
+                                             rocsparse_int                   nnz,
+                                             const rocsparse_mat_descr       descr,
+                                             const rocsparse_double_complex* csr_val,
+                                             const rocsparse_int*            csr_row_ptr,
+                                             const rocsparse_int*            csr_col_ind,
+                                             rocsparse_mat_info              info)
+{
+    return rocsparse_zcsrmm_ex_analysis(
+        handle, trans_A, m, k, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+template <>
+rocsparse_status rocsparse_csrmm_ex(rocsparse_handle          handle,
+                                    rocsparse_operation       trans_A,
+                                    rocsparse_operation       trans_B,
+                                    rocsparse_order           order_B,
+                                    rocsparse_order           order_C,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             k,
+                                    rocsparse_int             nnz,
+                                    const float*              alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    const float*              B,
+                                    rocsparse_int             ldb,
+                                    const float*              beta,
+                                    float*                    C,
+                                    rocsparse_int             ldc)
+{
+    return rocsparse_scsrmm_ex(handle,
+                               trans_A,
+                               trans_B,
+                               order_B,
+                               order_C,
+                               m,
+                               n,
+                               k,
+                               nnz,
+                               alpha,
+                               descr,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               info,
+                               B,
+                               ldb,
+                               beta,
+                               C,
+                               ldc);
+}
+
+template <>
+rocsparse_status rocsparse_csrmm_ex(rocsparse_handle          handle,
+                                    rocsparse_operation       trans_A,
+                                    rocsparse_operation       trans_B,
+                                    rocsparse_order           order_B,
+                                    rocsparse_order           order_C,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             k,
+                                    rocsparse_int             nnz,
+                                    const double*             alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    const double*             B,
+                                    rocsparse_int             ldb,
+                                    const double*             beta,
+                                    double*                   C,
+                                    rocsparse_int             ldc)
+{
+    return rocsparse_dcsrmm_ex(handle,
+                               trans_A,
+                               trans_B,
+                               order_B,
+                               order_C,
+                               m,
+                               n,
+                               k,
+                               nnz,
+                               alpha,
+                               descr,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               info,
+                               B,
+                               ldb,
+                               beta,
+                               C,
+                               ldc);
+}
+
+template <>
+rocsparse_status rocsparse_csrmm_ex(rocsparse_handle               handle,
+                                    rocsparse_operation            trans_A,
+                                    rocsparse_operation            trans_B,
+                                    rocsparse_order                order_B,
+                                    rocsparse_order                order_C,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  n,
+                                    rocsparse_int                  k,
+                                    rocsparse_int                  nnz,
+                                    const rocsparse_float_complex* alpha,
+                                    const rocsparse_mat_descr      descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    const rocsparse_int*           csr_col_ind,
+                                    rocsparse_mat_info             info,
+                                    const rocsparse_float_complex* B,
+                                    rocsparse_int                  ldb,
+                                    const rocsparse_float_complex* beta,
+                                    rocsparse_float_complex*       C,
+                                    rocsparse_int                  ldc)
+{
+    return rocsparse_ccsrmm_ex(handle,
+                               trans_A,
+                               trans_B,
+                               order_B,
+                               order_C,
+                               m,
+                               n,
+                               k,
+                               nnz,
+                               alpha,
+                               descr,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               info,
+                               B,
+                               ldb,
+                               beta,
+                               C,
+                               ldc);
+}
+
+template <>
+rocsparse_status rocsparse_csrmm_ex(rocsparse_handle                handle,
+                                    rocsparse_operation             trans_A,
+                                    rocsparse_operation             trans_B,
+                                    rocsparse_order                 order_B,
+                                    rocsparse_order                 order_C,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   n,
+                                    rocsparse_int                   k,
+                                    rocsparse_int                   nnz,
+                                    const rocsparse_double_complex* alpha,
+                                    const rocsparse_mat_descr       descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    const rocsparse_int*            csr_col_ind,
+                                    rocsparse_mat_info              info,
+                                    const rocsparse_double_complex* B,
+                                    rocsparse_int                   ldb,
+                                    const rocsparse_double_complex* beta,
+                                    rocsparse_double_complex*       C,
+                                    rocsparse_int                   ldc)
+{
+    return rocsparse_zcsrmm_ex(handle,
+                               trans_A,
+                               trans_B,
+                               order_B,
+                               order_C,
+                               m,
+                               n,
+                               k,
+                               nnz,
+                               alpha,
+                               descr,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               info,
+                               B,
+                               ldb,
+                               beta,
+                               C,
+                               ldc);
+}
+
 // csrsm
 template <>
 rocsparse_status rocsparse_csrsm_buffer_size(rocsparse_handle          handle,
@@ -1970,17 +5015,694 @@ rocsparse_status rocsparse_csrsm_buffer_size(rocsparse_handle                han
                                              rocsparse_solve_policy          policy,
                                              size_t*                         buffer_size)
 {
-    return rocsparse_zcsrsm_buffer_size(handle,
+    return rocsparse_zcsrsm_buffer_size(handle,
+                                        trans_A,
+                                        trans_B,
+                                        m,
+                                        nrhs,
+                                        nnz,
+                                        alpha,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        B,
+                                        ldb,
+                                        info,
+                                        policy,
+                                        buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrsm_analysis(rocsparse_handle          handle,
+                                          rocsparse_operation       trans_A,
+                                          rocsparse_operation       trans_B,
+                                          rocsparse_int             m,
+                                          rocsparse_int             nrhs,
+                                          rocsparse_int             nnz,
+                                          const float*              alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const float*              csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          const float*              B,
+                                          rocsparse_int             ldb,
+                                          rocsparse_mat_info        info,
+                                          rocsparse_analysis_policy analysis,
+                                          rocsparse_solve_policy    solve,
+                                          void*                     temp_buffer)
+{
+    return rocsparse_scsrsm_analysis(handle,
+                                     trans_A,
+                                     trans_B,
+                                     m,
+                                     nrhs,
+                                     nnz,
+                                     alpha,
+                                     descr,
+                                     csr_val,
+                                     csr_row_ptr,
+                                     csr_col_ind,
+                                     B,
+                                     ldb,
+                                     info,
+                                     analysis,
+                                     solve,
+                                     temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsm_analysis(rocsparse_handle          handle,
+                                          rocsparse_operation       trans_A,
+                                          rocsparse_operation       trans_B,
+                                          rocsparse_int             m,
+                                          rocsparse_int             nrhs,
+                                          rocsparse_int             nnz,
+                                          const double*             alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const double*             csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          const double*             B,
+                                          rocsparse_int             ldb,
+                                          rocsparse_mat_info        info,
+                                          rocsparse_analysis_policy analysis,
+                                          rocsparse_solve_policy    solve,
+                                          void*                     temp_buffer)
+{
+    return rocsparse_dcsrsm_analysis(handle,
+                                     trans_A,
+                                     trans_B,
+                                     m,
+                                     nrhs,
+                                     nnz,
+                                     alpha,
+                                     descr,
+                                     csr_val,
+                                     csr_row_ptr,
+                                     csr_col_ind,
+                                     B,
+                                     ldb,
+                                     info,
+                                     analysis,
+                                     solve,
+                                     temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsm_analysis(rocsparse_handle               handle,
+                                          rocsparse_operation            trans_A,
+                                          rocsparse_operation            trans_B,
+                                          rocsparse_int                  m,
+                                          rocsparse_int                  nrhs,
+                                          rocsparse_int                  nnz,
+                                          const rocsparse_float_complex* alpha,
+                                          const rocsparse_mat_descr      descr,
+                                          const rocsparse_float_complex* csr_val,
+                                          const rocsparse_int*           csr_row_ptr,
+                                          const rocsparse_int*           csr_col_ind,
+                                          const rocsparse_float_complex* B,
+                                          rocsparse_int                  ldb,
+                                          rocsparse_mat_info             info,
+                                          rocsparse_analysis_policy      analysis,
+                                          rocsparse_solve_policy         solve,
+                                          void*                          temp_buffer)
+{
+    return rocsparse_ccsrsm_analysis(handle,
+                                     trans_A,
+                                     trans_B,
+                                     m,
+                                     nrhs,
+                                     nnz,
+                                     alpha,
+                                     descr,
+                                     csr_val,
+                                     csr_row_ptr,
+                                     csr_col_ind,
+                                     B,
+                                     ldb,
+                                     info,
+                                     analysis,
+                                     solve,
+                                     temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsm_analysis(rocsparse_handle                handle,
+                                          rocsparse_operation             trans_A,
+                                          rocsparse_operation             trans_B,
+                                          rocsparse_int                   m,
+                                          rocsparse_int                   nrhs,
+                                          rocsparse_int                   nnz,
+                                          const rocsparse_double_complex* alpha,
+                                          const rocsparse_mat_descr       descr,
+                                          const rocsparse_double_complex* csr_val,
+                                          const rocsparse_int*            csr_row_ptr,
+                                          const rocsparse_int*            csr_col_ind,
+                                          const rocsparse_double_complex* B,
+                                          rocsparse_int                   ldb,
+                                          rocsparse_mat_info              info,
+                                          rocsparse_analysis_policy       analysis,
+                                          rocsparse_solve_policy          solve,
+                                          void*                           temp_buffer)
+{
+    return rocsparse_zcsrsm_analysis(handle,
+                                     trans_A,
+                                     trans_B,
+                                     m,
+                                     nrhs,
+                                     nnz,
+                                     alpha,
+                                     descr,
+                                     csr_val,
+                                     csr_row_ptr,
+                                     csr_col_ind,
+                                     B,
+                                     ldb,
+                                     info,
+                                     analysis,
+                                     solve,
+                                     temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsm_solve(rocsparse_handle          handle,
+                                       rocsparse_operation       trans_A,
+                                       rocsparse_operation       trans_B,
+                                       rocsparse_int             m,
+                                       rocsparse_int             nrhs,
+                                       rocsparse_int             nnz,
+                                       const float*              alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const float*              csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       float*                    B,
+                                       rocsparse_int             ldb,
+                                       rocsparse_mat_info        info,
+                                       rocsparse_solve_policy    policy,
+                                       void*                     temp_buffer)
+{
+    return rocsparse_scsrsm_solve(handle,
+                                  trans_A,
+                                  trans_B,
+                                  m,
+                                  nrhs,
+                                  nnz,
+                                  alpha,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  B,
+                                  ldb,
+                                  info,
+                                  policy,
+                                  temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsm_solve(rocsparse_handle          handle,
+                                       rocsparse_operation       trans_A,
+                                       rocsparse_operation       trans_B,
+                                       rocsparse_int             m,
+                                       rocsparse_int             nrhs,
+                                       rocsparse_int             nnz,
+                                       const double*             alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const double*             csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       double*                   B,
+                                       rocsparse_int             ldb,
+                                       rocsparse_mat_info        info,
+                                       rocsparse_solve_policy    policy,
+                                       void*                     temp_buffer)
+{
+    return rocsparse_dcsrsm_solve(handle,
+                                  trans_A,
+                                  trans_B,
+                                  m,
+                                  nrhs,
+                                  nnz,
+                                  alpha,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  B,
+                                  ldb,
+                                  info,
+                                  policy,
+                                  temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsm_solve(rocsparse_handle               handle,
+                                       rocsparse_operation            trans_A,
+                                       rocsparse_operation            trans_B,
+                                       rocsparse_int                  m,
+                                       rocsparse_int                  nrhs,
+                                       rocsparse_int                  nnz,
+                                       const rocsparse_float_complex* alpha,
+                                       const rocsparse_mat_descr      descr,
+                                       const rocsparse_float_complex* csr_val,
+                                       const rocsparse_int*           csr_row_ptr,
+                                       const rocsparse_int*           csr_col_ind,
+                                       rocsparse_float_complex*       B,
+                                       rocsparse_int                  ldb,
+                                       rocsparse_mat_info             info,
+                                       rocsparse_solve_policy         policy,
+                                       void*                          temp_buffer)
+{
+    return rocsparse_ccsrsm_solve(handle,
+                                  trans_A,
+                                  trans_B,
+                                  m,
+                                  nrhs,
+                                  nnz,
+                                  alpha,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  B,
+                                  ldb,
+                                  info,
+                                  policy,
+                                  temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsm_solve(rocsparse_handle                handle,
+                                       rocsparse_operation             trans_A,
+                                       rocsparse_operation             trans_B,
+                                       rocsparse_int                   m,
+                                       rocsparse_int                   nrhs,
+                                       rocsparse_int                   nnz,
+                                       const rocsparse_double_complex* alpha,
+                                       const rocsparse_mat_descr       descr,
+                                       const rocsparse_double_complex* csr_val,
+                                       const rocsparse_int*            csr_row_ptr,
+                                       const rocsparse_int*            csr_col_ind,
+                                       rocsparse_double_complex*       B,
+                                       rocsparse_int                   ldb,
+                                       rocsparse_mat_info              info,
+                                       rocsparse_solve_policy          policy,
+                                       void*                           temp_buffer)
+{
+    return rocsparse_zcsrsm_solve(handle,
+                                  trans_A,
+                                  trans_B,
+                                  m,
+                                  nrhs,
+                                  nnz,
+                                  alpha,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  B,
+                                  ldb,
+                                  info,
+                                  policy,
+                                  temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsm_buffer_size_mixed(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_B,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nrhs,
+                                                   rocsparse_int             nnz,
+                                                   const double*             alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const float*              csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   const double*             B,
+                                                   rocsparse_int             ldb,
+                                                   rocsparse_mat_info        info,
+                                                   rocsparse_solve_policy    policy,
+                                                   size_t*                   buffer_size)
+{
+    return rocsparse_dscsrsm_buffer_size(handle,
+                                         trans_A,
+                                         trans_B,
+                                         m,
+                                         nrhs,
+                                         nnz,
+                                         alpha,
+                                         descr,
+                                         csr_val,
+                                         csr_row_ptr,
+                                         csr_col_ind,
+                                         B,
+                                         ldb,
+                                         info,
+                                         policy,
+                                         buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrsm_buffer_size_mixed(rocsparse_handle                handle,
+                                                   rocsparse_operation             trans_A,
+                                                   rocsparse_operation             trans_B,
+                                                   rocsparse_int                   m,
+                                                   rocsparse_int                   nrhs,
+                                                   rocsparse_int                   nnz,
+                                                   const rocsparse_double_complex* alpha,
+                                                   const rocsparse_mat_descr       descr,
+                                                   const rocsparse_float_complex*  csr_val,
+                                                   const rocsparse_int*            csr_row_ptr,
+                                                   const rocsparse_int*            csr_col_ind,
+                                                   const rocsparse_double_complex* B,
+                                                   rocsparse_int                   ldb,
+                                                   rocsparse_mat_info              info,
+                                                   rocsparse_solve_policy          policy,
+                                                   size_t*                         buffer_size)
+{
+    return rocsparse_zccsrsm_buffer_size(handle,
+                                         trans_A,
+                                         trans_B,
+                                         m,
+                                         nrhs,
+                                         nnz,
+                                         alpha,
+                                         descr,
+                                         csr_val,
+                                         csr_row_ptr,
+                                         csr_col_ind,
+                                         B,
+                                         ldb,
+                                         info,
+                                         policy,
+                                         buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrsm_analysis_mixed(rocsparse_handle          handle,
+                                                rocsparse_operation       trans_A,
+                                                rocsparse_operation       trans_B,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nrhs,
+                                                rocsparse_int             nnz,
+                                                const double*             alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                const double*             B,
+                                                rocsparse_int             ldb,
+                                                rocsparse_mat_info        info,
+                                                rocsparse_analysis_policy analysis,
+                                                rocsparse_solve_policy    solve,
+                                                void*                     temp_buffer)
+{
+    return rocsparse_dscsrsm_analysis(handle,
+                                      trans_A,
+                                      trans_B,
+                                      m,
+                                      nrhs,
+                                      nnz,
+                                      alpha,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      B,
+                                      ldb,
+                                      info,
+                                      analysis,
+                                      solve,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsm_analysis_mixed(rocsparse_handle                handle,
+                                                rocsparse_operation             trans_A,
+                                                rocsparse_operation             trans_B,
+                                                rocsparse_int                   m,
+                                                rocsparse_int                   nrhs,
+                                                rocsparse_int                   nnz,
+                                                const rocsparse_double_complex* alpha,
+                                                const rocsparse_mat_descr       descr,
+                                                const rocsparse_float_complex*  csr_val,
+                                                const rocsparse_int*            csr_row_ptr,
+                                                const rocsparse_int*            csr_col_ind,
+                                                const rocsparse_double_complex* B,
+                                                rocsparse_int                   ldb,
+                                                rocsparse_mat_info              info,
+                                                rocsparse_analysis_policy       analysis,
+                                                rocsparse_solve_policy          solve,
+                                                void*                           temp_buffer)
+{
+    return rocsparse_zccsrsm_analysis(handle,
+                                      trans_A,
+                                      trans_B,
+                                      m,
+                                      nrhs,
+                                      nnz,
+                                      alpha,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      B,
+                                      ldb,
+                                      info,
+                                      analysis,
+                                      solve,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsm_solve_mixed(rocsparse_handle          handle,
+                                             rocsparse_operation       trans_A,
+                                             rocsparse_operation       trans_B,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nrhs,
+                                             rocsparse_int             nnz,
+                                             const double*             alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             double*                   B,
+                                             rocsparse_int             ldb,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_solve_policy    policy,
+                                             void*                     temp_buffer)
+{
+    return rocsparse_dscsrsm_solve(handle,
+                                   trans_A,
+                                   trans_B,
+                                   m,
+                                   nrhs,
+                                   nnz,
+                                   alpha,
+                                   descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   B,
+                                   ldb,
+                                   info,
+                                   policy,
+                                   temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsm_solve_mixed(rocsparse_handle                handle,
+                                             rocsparse_operation             trans_A,
+                                             rocsparse_operation             trans_B,
+                                             rocsparse_int                   m,
+                                             rocsparse_int                   nrhs,
+                                             rocsparse_int                   nnz,
+                                             const rocsparse_double_complex* alpha,
+                                             const rocsparse_mat_descr       descr,
+                                             const rocsparse_float_complex*  csr_val,
+                                             const rocsparse_int*            csr_row_ptr,
+                                             const rocsparse_int*            csr_col_ind,
+                                             rocsparse_double_complex*       B,
+                                             rocsparse_int                   ldb,
+                                             rocsparse_mat_info              info,
+                                             rocsparse_solve_policy          policy,
+                                             void*                           temp_buffer)
+{
+    return rocsparse_zccsrsm_solve(handle,
+                                   trans_A,
+                                   trans_B,
+                                   m,
+                                   nrhs,
+                                   nnz,
+                                   alpha,
+                                   descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   B,
+                                   ldb,
+                                   info,
+                                   policy,
+                                   temp_buffer);
+}
+
+// bsrsm
+template <>
+rocsparse_status rocsparse_bsrsm_buffer_size(rocsparse_handle          handle,
+                                             rocsparse_direction       dir,
+                                             rocsparse_operation       trans_A,
+                                             rocsparse_operation       trans_B,
+                                             rocsparse_int             mb,
+                                             rocsparse_int             nrhs,
+                                             rocsparse_int             nnzb,
+                                             const float*              alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              bsr_val,
+                                             const rocsparse_int*      bsr_row_ptr,
+                                             const rocsparse_int*      bsr_col_ind,
+                                             rocsparse_int             block_dim,
+                                             const float*              B,
+                                             rocsparse_int             ldb,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_solve_policy    policy,
+                                             size_t*                   buffer_size)
+{
+    return rocsparse_sbsrsm_buffer_size(handle,
+                                        dir,
+                                        trans_A,
+                                        trans_B,
+                                        mb,
+                                        nrhs,
+                                        nnzb,
+                                        alpha,
+                                        descr,
+                                        bsr_val,
+                                        bsr_row_ptr,
+                                        bsr_col_ind,
+                                        block_dim,
+                                        B,
+                                        ldb,
+                                        info,
+                                        policy,
+                                        buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsrsm_buffer_size(rocsparse_handle          handle,
+                                             rocsparse_direction       dir,
+                                             rocsparse_operation       trans_A,
+                                             rocsparse_operation       trans_B,
+                                             rocsparse_int             mb,
+                                             rocsparse_int             nrhs,
+                                             rocsparse_int             nnzb,
+                                             const double*             alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             bsr_val,
+                                             const rocsparse_int*      bsr_row_ptr,
+                                             const rocsparse_int*      bsr_col_ind,
+                                             rocsparse_int             block_dim,
+                                             const double*             B,
+                                             rocsparse_int             ldb,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_solve_policy    policy,
+                                             size_t*                   buffer_size)
+{
+    return rocsparse_dbsrsm_buffer_size(handle,
+                                        dir,
+                                        trans_A,
+                                        trans_B,
+                                        mb,
+                                        nrhs,
+                                        nnzb,
+                                        alpha,
+                                        descr,
+                                        bsr_val,
+                                        bsr_row_ptr,
+                                        bsr_col_ind,
+                                        block_dim,
+                                        B,
+                                        ldb,
+                                        info,
+                                        policy,
+                                        buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsrsm_buffer_size(rocsparse_handle               handle,
+                                             rocsparse_direction            dir,
+                                             rocsparse_operation            trans_A,
+                                             rocsparse_operation            trans_B,
+                                             rocsparse_int                  mb,
+                                             rocsparse_int                  nrhs,
+                                             rocsparse_int                  nnzb,
+                                             const rocsparse_float_complex* alpha,
+                                             const rocsparse_mat_descr      descr,
+                                             const rocsparse_float_complex* bsr_val,
+                                             const rocsparse_int*           bsr_row_ptr,
+                                             const rocsparse_int*           bsr_col_ind,
+                                             rocsparse_int                  block_dim,
+                                             const rocsparse_float_complex* B,
+                                             rocsparse_int                  ldb,
+                                             rocsparse_mat_info             info,
+                                             rocsparse_solve_policy         policy,
+                                             size_t*                        buffer_size)
+{
+    return rocsparse_cbsrsm_buffer_size(handle,
+                                        dir,
+                                        trans_A,
+                                        trans_B,
+                                        mb,
+                                        nrhs,
+                                        nnzb,
+                                        alpha,
+                                        descr,
+                                        bsr_val,
+                                        bsr_row_ptr,
+                                        bsr_col_ind,
+                                        block_dim,
+                                        B,
+                                        ldb,
+                                        info,
+                                        policy,
+                                        buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsrsm_buffer_size(rocsparse_handle                handle,
+                                             rocsparse_direction             dir,
+                                             rocsparse_operation             trans_A,
+                                             rocsparse_operation             trans_B,
+                                             rocsparse_int                   mb,
+                                             rocsparse_int                   nrhs,
+                                             rocsparse_int                   nnzb,
+                                             const rocsparse_double_complex* alpha,
+                                             const rocsparse_mat_descr       descr,
+                                             const rocsparse_double_complex* bsr_val,
+                                             const rocsparse_int*            bsr_row_ptr,
+                                             const rocsparse_int*            bsr_col_ind,
+                                             rocsparse_int                   block_dim,
+                                             const rocsparse_double_complex* B,
+                                             rocsparse_int                   ldb,
+                                             rocsparse_mat_info              info,
+                                             rocsparse_solve_policy          policy,
+                                             size_t*                         buffer_size)
+{
+    return rocsparse_zbsrsm_buffer_size(handle,
+                                        dir,
                                         trans_A,
                                         trans_B,
-                                        m,
+                                        mb,
                                         nrhs,
-                                        nnz,
+                                        nnzb,
                                         alpha,
                                         descr,
-                                        csr_val,
-                                        csr_row_ptr,
-                                        csr_col_ind,
+                                        bsr_val,
+                                        bsr_row_ptr,
+                                        bsr_col_ind,
+                                        block_dim,
                                         B,
                                         ldb,
                                         info,
@@ -1989,17 +5711,19 @@ rocsparse_status rocsparse_csrsm_buffer_size(rocsparse_handle                han
 }
 
 template <>
-rocsparse_status rocsparse_csrsm_analysis(rocsparse_handle          handle,
+rocsparse_status rocsparse_bsrsm_analysis(rocsparse_handle          handle,
+                                          rocsparse_direction       dir,
                                           rocsparse_operation       trans_A,
                                           rocsparse_operation       trans_B,
-                                          rocsparse_int             m,
+                                          rocsparse_int             mb,
                                           rocsparse_int             nrhs,
-                                          rocsparse_int             nnz,
+                                          rocsparse_int             nnzb,
                                           const float*              alpha,
                                           const rocsparse_mat_descr descr,
-                                          const float*              csr_val,
-                                          const rocsparse_int*      csr_row_ptr,
-                                          const rocsparse_int*      csr_col_ind,
+                                          const float*              bsr_val,
+                                          const rocsparse_int*      bsr_row_ptr,
+                                          const rocsparse_int*      bsr_col_ind,
+                                          rocsparse_int             block_dim,
                                           const float*              B,
                                           rocsparse_int             ldb,
                                           rocsparse_mat_info        info,
@@ -2007,17 +5731,19 @@ rocsparse_status rocsparse_csrsm_analysis(rocsparse_handle          handle,
                                           rocsparse_solve_policy    solve,
                                           void*                     temp_buffer)
 {
-    return rocsparse_scsrsm_analysis(handle,
+    return rocsparse_sbsrsm_analysis(handle,
+                                     dir,
                                      trans_A,
                                      trans_B,
-                                     m,
+                                     mb,
                                      nrhs,
-                                     nnz,
+                                     nnzb,
                                      alpha,
                                      descr,
-                                     csr_val,
-                                     csr_row_ptr,
-                                     csr_col_ind,
+                                     bsr_val,
+                                     bsr_row_ptr,
+                                     bsr_col_ind,
+                                     block_dim,
                                      B,
                                      ldb,
                                      info,
@@ -2027,17 +5753,19 @@ rocsparse_status rocsparse_csrsm_analysis(rocsparse_handle          handle,
 }
 
 template <>
-rocsparse_status rocsparse_csrsm_analysis(rocsparse_handle          handle,
+rocsparse_status rocsparse_bsrsm_analysis(rocsparse_handle          handle,
+                                          rocsparse_direction       dir,
                                           rocsparse_operation       trans_A,
                                           rocsparse_operation       trans_B,
-                                          rocsparse_int             m,
+                                          rocsparse_int             mb,
                                           rocsparse_int             nrhs,
-                                          rocsparse_int             nnz,
+                                          rocsparse_int             nnzb,
                                           const double*             alpha,
                                           const rocsparse_mat_descr descr,
-                                          const double*             csr_val,
-                                          const rocsparse_int*      csr_row_ptr,
-                                          const rocsparse_int*      csr_col_ind,
+                                          const double*             bsr_val,
+                                          const rocsparse_int*      bsr_row_ptr,
+                                          const rocsparse_int*      bsr_col_ind,
+                                          rocsparse_int             block_dim,
                                           const double*             B,
                                           rocsparse_int             ldb,
                                           rocsparse_mat_info        info,
@@ -2045,17 +5773,19 @@ rocsparse_status rocsparse_csrsm_analysis(rocsparse_handle          handle,
                                           rocsparse_solve_policy    solve,
                                           void*                     temp_buffer)
 {
-    return rocsparse_dcsrsm_analysis(handle,
+    return rocsparse_dbsrsm_analysis(handle,
+                                     dir,
                                      trans_A,
                                      trans_B,
-                                     m,
+                                     mb,
                                      nrhs,
-                                     nnz,
+                                     nnzb,
                                      alpha,
                                      descr,
-                                     csr_val,
-                                     csr_row_ptr,
-                                     csr_col_ind,
+                                     bsr_val,
+                                     bsr_row_ptr,
+                                     bsr_col_ind,
+                                     block_dim,
                                      B,
                                      ldb,
                                      info,
@@ -2065,17 +5795,19 @@ rocsparse_status rocsparse_csrsm_analysis(rocsparse_handle          handle,
 }
 
 template <>
-rocsparse_status rocsparse_csrsm_analysis(rocsparse_handle               handle,
+rocsparse_status rocsparse_bsrsm_analysis(rocsparse_handle               handle,
+                                          rocsparse_direction            dir,
                                           rocsparse_operation            trans_A,
                                           rocsparse_operation            trans_B,
-                                          rocsparse_int                  m,
+                                          rocsparse_int                  mb,
                                           rocsparse_int                  nrhs,
-                                          rocsparse_int                  nnz,
+                                          rocsparse_int                  nnzb,
                                           const rocsparse_float_complex* alpha,
                                           const rocsparse_mat_descr      descr,
-                                          const rocsparse_float_complex* csr_val,
-                                          const rocsparse_int*           csr_row_ptr,
-                                          const rocsparse_int*           csr_col_ind,
+                                          const rocsparse_float_complex* bsr_val,
+                                          const rocsparse_int*           bsr_row_ptr,
+                                          const rocsparse_int*           bsr_col_ind,
+                                          rocsparse_int                  block_dim,
                                           const rocsparse_float_complex* B,
                                           rocsparse_int                  ldb,
                                           rocsparse_mat_info             info,
@@ -2083,17 +5815,19 @@ rocsparse_status rocsparse_csrsm_analysis(rocsparse_handle               handle,
                                           rocsparse_solve_policy         solve,
                                           void*                          temp_buffer)
 {
-    return rocsparse_ccsrsm_analysis(handle,
+    return rocsparse_cbsrsm_analysis(handle,
+                                     dir,
                                      trans_A,
                                      trans_B,
-                                     m,
+                                     mb,
                                      nrhs,
-                                     nnz,
+                                     nnzb,
                                      alpha,
                                      descr,
-                                     csr_val,
-                                     csr_row_ptr,
-                                     csr_col_ind,
+                                     bsr_val,
+                                     bsr_row_ptr,
+                                     bsr_col_ind,
+                                     block_dim,
                                      B,
                                      ldb,
                                      info,
@@ -2103,17 +5837,19 @@ rocsparse_status rocsparse_csrsm_analysis(rocsparse_handle               handle,
 }
 
 template <>
-rocsparse_status rocsparse_csrsm_analysis(rocsparse_handle                handle,
+rocsparse_status rocsparse_bsrsm_analysis(rocsparse_handle                handle,
+                                          rocsparse_direction             dir,
                                           rocsparse_operation             trans_A,
                                           rocsparse_operation             trans_B,
-                                          rocsparse_int                   m,
+                                          rocsparse_int                   mb,
                                           rocsparse_int                   nrhs,
-                                          rocsparse_int                   nnz,
+                                          rocsparse_int                   nnzb,
                                           const rocsparse_double_complex* alpha,
                                           const rocsparse_mat_descr       descr,
-                                          const rocsparse_double_complex* csr_val,
-                                          const rocsparse_int*            csr_row_ptr,
-                                          const rocsparse_int*            csr_col_ind,
+                                          const rocsparse_double_complex* bsr_val,
+                                          const rocsparse_int*            bsr_row_ptr,
+                                          const rocsparse_int*            bsr_col_ind,
+                                          rocsparse_int                   block_dim,
                                           const rocsparse_double_complex* B,
                                           rocsparse_int                   ldb,
                                           rocsparse_mat_info              info,
@@ -2121,17 +5857,19 @@ rocsparse_status rocsparse_csrsm_analysis(rocsparse_handle                handle
                                           rocsparse_solve_policy          solve,
                                           void*                           temp_buffer)
 {
-    return rocsparse_zcsrsm_analysis(handle,
+    return rocsparse_zbsrsm_analysis(handle,
+                                     dir,
                                      trans_A,
                                      trans_B,
-                                     m,
+                                     mb,
                                      nrhs,
-                                     nnz,
+                                     nnzb,
                                      alpha,
                                      descr,
-                                     csr_val,
-                                     csr_row_ptr,
-                                     csr_col_ind,
+                                     bsr_val,
+                                     bsr_row_ptr,
+                                     bsr_col_ind,
+                                     block_dim,
                                      B,
                                      ldb,
                                      info,
@@ -2141,34 +5879,38 @@ rocsparse_status rocsparse_csrsm_analysis(rocsparse_handle                handle
 }
 
 template <>
-rocsparse_status rocsparse_csrsm_solve(rocsparse_handle          handle,
+rocsparse_status rocsparse_bsrsm_solve(rocsparse_handle          handle,
+                                       rocsparse_direction       dir,
                                        rocsparse_operation       trans_A,
                                        rocsparse_operation       trans_B,
-                                       rocsparse_int             m,
+                                       rocsparse_int             mb,
                                        rocsparse_int             nrhs,
-                                       rocsparse_int             nnz,
+                                       rocsparse_int             nnzb,
                                        const float*              alpha,
                                        const rocsparse_mat_descr descr,
-                                       const float*              csr_val,
-                                       const rocsparse_int*      csr_row_ptr,
-                                       const rocsparse_int*      csr_col_ind,
+                                       const float*              bsr_val,
+                                       const rocsparse_int*      bsr_row_ptr,
+                                       const rocsparse_int*      bsr_col_ind,
+                                       rocsparse_int             block_dim,
                                        float*                    B,
                                        rocsparse_int             ldb,
                                        rocsparse_mat_info        info,
                                        rocsparse_solve_policy    policy,
                                        void*                     temp_buffer)
 {
-    return rocsparse_scsrsm_solve(handle,
+    return rocsparse_sbsrsm_solve(handle,
+                                  dir,
                                   trans_A,
                                   trans_B,
-                                  m,
+                                  mb,
                                   nrhs,
-                                  nnz,
+                                  nnzb,
                                   alpha,
                                   descr,
-                                  csr_val,
-                                  csr_row_ptr,
-                                  csr_col_ind,
+                                  bsr_val,
+                                  bsr_row_ptr,
+                                  bsr_col_ind,
+                                  block_dim,
                                   B,
                                   ldb,
                                   info,
@@ -2177,34 +5919,38 @@ rocsparse_status rocsparse_csrsm_solve(rocsparse_handle          handle,
 }
 
 template <>
-rocsparse_status rocsparse_csrsm_solve(rocsparse_handle          handle,
+rocsparse_status rocsparse_bsrsm_solve(rocsparse_handle          handle,
+                                       rocsparse_direction       dir,
                                        rocsparse_operation       trans_A,
                                        rocsparse_operation       trans_B,
-                                       rocsparse_int             m,
+                                       rocsparse_int             mb,
                                        rocsparse_int             nrhs,
-                                       rocsparse_int             nnz,
+                                       rocsparse_int             nnzb,
                                        const double*             alpha,
                                        const rocsparse_mat_descr descr,
-                                       const double*             csr_val,
-                                       const rocsparse_int*      csr_row_ptr,
-                                       const rocsparse_int*      csr_col_ind,
+                                       const double*             bsr_val,
+                                       const rocsparse_int*      bsr_row_ptr,
+                                       const rocsparse_int*      bsr_col_ind,
+                                       rocsparse_int             block_dim,
                                        double*                   B,
                                        rocsparse_int             ldb,
                                        rocsparse_mat_info        info,
                                        rocsparse_solve_policy    policy,
                                        void*                     temp_buffer)
 {
-    return rocsparse_dcsrsm_solve(handle,
+    return rocsparse_dbsrsm_solve(handle,
+                                  dir,
                                   trans_A,
                                   trans_B,
-                                  m,
+                                  mb,
                                   nrhs,
-                                  nnz,
+                                  nnzb,
                                   alpha,
                                   descr,
-                                  csr_val,
-                                  csr_row_ptr,
-                                  csr_col_ind,
+                                  bsr_val,
+                                  bsr_row_ptr,
+                                  bsr_col_ind,
+                                  block_dim,
                                   B,
                                   ldb,
                                   info,
@@ -2213,34 +5959,38 @@ rocsparse_status rocsparse_csrsm_solve(rocsparse_handle          handle,
 }
 
 template <>
-rocsparse_status rocsparse_csrsm_solve(rocsparse_handle               handle,
+rocsparse_status rocsparse_bsrsm_solve(rocsparse_handle               handle,
+                                       rocsparse_direction            dir,
                                        rocsparse_operation            trans_A,
                                        rocsparse_operation            trans_B,
-                                       rocsparse_int                  m,
+                                       rocsparse_int                  mb,
                                        rocsparse_int                  nrhs,
-                                       rocsparse_int                  nnz,
+                                       rocsparse_int                  nnzb,
                                        const rocsparse_float_complex* alpha,
                                        const rocsparse_mat_descr      descr,
-                                       const rocsparse_float_complex* csr_val,
-                                       const rocsparse_int*           csr_row_ptr,
-                                       const rocsparse_int*           csr_col_ind,
+                                       const rocsparse_float_complex* bsr_val,
+                                       const rocsparse_int*           bsr_row_ptr,
+                                       const rocsparse_int*           bsr_col_ind,
+                                       rocsparse_int                  block_dim,
                                        rocsparse_float_complex*       B,
                                        rocsparse_int                  ldb,
                                        rocsparse_mat_info             info,
                                        rocsparse_solve_policy         policy,
                                        void*                          temp_buffer)
 {
-    return rocsparse_ccsrsm_solve(handle,
+    return rocsparse_cbsrsm_solve(handle,
+                                  dir,
                                   trans_A,
                                   trans_B,
-                                  m,
+                                  mb,
                                   nrhs,
-                                  nnz,
+                                  nnzb,
                                   alpha,
                                   descr,
-                                  csr_val,
-                                  csr_row_ptr,
-                                  csr_col_ind,
+                                  bsr_val,
+                                  bsr_row_ptr,
+                                  bsr_col_ind,
+                                  block_dim,
                                   B,
                                   ldb,
                                   info,
@@ -2249,34 +5999,38 @@ rocsparse_status rocsparse_csrsm_solve(rocsparse_handle               handle,
 }
 
 template <>
-rocsparse_status rocsparse_csrsm_solve(rocsparse_handle                handle,
+rocsparse_status rocsparse_bsrsm_solve(rocsparse_handle                handle,
+                                       rocsparse_direction             dir,
                                        rocsparse_operation             trans_A,
                                        rocsparse_operation             trans_B,
-                                       rocsparse_int                   m,
+                                       rocsparse_int                   mb,
                                        rocsparse_int                   nrhs,
-                                       rocsparse_int                   nnz,
+                                       rocsparse_int                   nnzb,
                                        const rocsparse_double_complex* alpha,
                                        const rocsparse_mat_descr       descr,
-                                       const rocsparse_double_complex* csr_val,
-                                       const rocsparse_int*            csr_row_ptr,
-                                       const rocsparse_int*            csr_col_ind,
+                                       const rocsparse_double_complex* bsr_val,
+                                       const rocsparse_int*            bsr_row_ptr,
+                                       const rocsparse_int*            bsr_col_ind,
+                                       rocsparse_int                   block_dim,
                                        rocsparse_double_complex*       B,
                                        rocsparse_int                   ldb,
                                        rocsparse_mat_info              info,
                                        rocsparse_solve_policy          policy,
                                        void*                           temp_buffer)
 {
-    return rocsparse_zcsrsm_solve(handle,
+    return rocsparse_zbsrsm_solve(handle,
+                                  dir,
                                   trans_A,
                                   trans_B,
-                                  m,
+                                  mb,
                                   nrhs,
-                                  nnz,
+                                  nnzb,
                                   alpha,
                                   descr,
-                                  csr_val,
-                                  csr_row_ptr,
-                                  csr_col_ind,
+                                  bsr_val,
+                                  bsr_row_ptr,
+                                  bsr_col_ind,
+                                  block_dim,
                                   B,
                                   ldb,
                                   info,
@@ -2437,6 +6191,312 @@ rocsparse_status rocsparse_gemmi(rocsparse_handle                handle,
                             ldc);
 }
 
+// csrsddmm
+template <>
+rocsparse_status rocsparse_csrsddmm(rocsparse_handle          handle,
+                                    rocsparse_order           order_A,
+                                    rocsparse_order           order_B,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             k,
+                                    const float*              alpha,
+                                    const float*              A,
+                                    rocsparse_int             lda,
+                                    const float*              B,
+                                    rocsparse_int             ldb,
+                                    const float*              beta,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_int             nnz,
+                                    float*                    csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind)
+{
+    return rocsparse_scsrsddmm(handle,
+                               order_A,
+                               order_B,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               descr,
+                               nnz,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_csrsddmm(rocsparse_handle          handle,
+                                    rocsparse_order           order_A,
+                                    rocsparse_order           order_B,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             k,
+                                    const double*             alpha,
+                                    const double*             A,
+                                    rocsparse_int             lda,
+                                    const double*             B,
+                                    rocsparse_int             ldb,
+                                    const double*             beta,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_int             nnz,
+                                    double*                   csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind)
+{
+    return rocsparse_dcsrsddmm(handle,
+                               order_A,
+                               order_B,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               descr,
+                               nnz,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_csrsddmm(rocsparse_handle               handle,
+                                    rocsparse_order                order_A,
+                                    rocsparse_order                order_B,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  n,
+                                    rocsparse_int                  k,
+                                    const rocsparse_float_complex* alpha,
+                                    const rocsparse_float_complex* A,
+                                    rocsparse_int                  lda,
+                                    const rocsparse_float_complex* B,
+                                    rocsparse_int                  ldb,
+                                    const rocsparse_float_complex* beta,
+                                    const rocsparse_mat_descr      descr,
+                                    rocsparse_int                  nnz,
+                                    rocsparse_float_complex*       csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    const rocsparse_int*           csr_col_ind)
+{
+    return rocsparse_ccsrsddmm(handle,
+                               order_A,
+                               order_B,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               descr,
+                               nnz,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_csrsddmm(rocsparse_handle                handle,
+                                    rocsparse_order                 order_A,
+                                    rocsparse_order                 order_B,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   n,
+                                    rocsparse_int                   k,
+                                    const rocsparse_double_complex* alpha,
+                                    const rocsparse_double_complex* A,
+                                    rocsparse_int                   lda,
+                                    const rocsparse_double_complex* B,
+                                    rocsparse_int                   ldb,
+                                    const rocsparse_double_complex* beta,
+                                    const rocsparse_mat_descr       descr,
+                                    rocsparse_int                   nnz,
+                                    rocsparse_double_complex*       csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    const rocsparse_int*            csr_col_ind)
+{
+    return rocsparse_zcsrsddmm(handle,
+                               order_A,
+                               order_B,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               descr,
+                               nnz,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind);
+}
+
+// coosddmm
+template <>
+rocsparse_status rocsparse_coosddmm(rocsparse_handle          handle,
+                                    rocsparse_order           order_A,
+                                    rocsparse_order           order_B,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             k,
+                                    const float*              alpha,
+                                    const float*              A,
+                                    rocsparse_int             lda,
+                                    const float*              B,
+                                    rocsparse_int             ldb,
+                                    const float*              beta,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_int             nnz,
+                                    float*                    coo_val,
+                                    const rocsparse_int*      coo_row_ind,
+                                    const rocsparse_int*      coo_col_ind)
+{
+    return rocsparse_scoosddmm(handle,
+                               order_A,
+                               order_B,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               descr,
+                               nnz,
+                               coo_val,
+                               coo_row_ind,
+                               coo_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_coosddmm(rocsparse_handle          handle,
+                                    rocsparse_order           order_A,
+                                    rocsparse_order           order_B,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             k,
+                                    const double*             alpha,
+                                    const double*             A,
+                                    rocsparse_int             lda,
+                                    const double*             B,
+                                    rocsparse_int             ldb,
+                                    const double*             beta,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_int             nnz,
+                                    double*                   coo_val,
+                                    const rocsparse_int*      coo_row_ind,
+                                    const rocsparse_int*      coo_col_ind)
+{
+    return rocsparse_dcoosddmm(handle,
+                               order_A,
+                               order_B,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               descr,
+                               nnz,
+                               coo_val,
+                               coo_row_ind,
+                               coo_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_coosddmm(rocsparse_handle               handle,
+                                    rocsparse_order                order_A,
+                                    rocsparse_order                order_B,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  n,
+                                    rocsparse_int                  k,
+                                    const rocsparse_float_complex* alpha,
+                                    const rocsparse_float_complex* A,
+                                    rocsparse_int                  lda,
+                                    const rocsparse_float_complex* B,
+                                    rocsparse_int                  ldb,
+                                    const rocsparse_float_complex* beta,
+                                    const rocsparse_mat_descr      descr,
+                                    rocsparse_int                  nnz,
+                                    rocsparse_float_complex*       coo_val,
+                                    const rocsparse_int*           coo_row_ind,
+                                    const rocsparse_int*           coo_col_ind)
+{
+    return rocsparse_ccoosddmm(handle,
+                               order_A,
+                               order_B,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               descr,
+                               nnz,
+                               coo_val,
+                               coo_row_ind,
+                               coo_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_coosddmm(rocsparse_handle                handle,
+                                    rocsparse_order                 order_A,
+                                    rocsparse_order                 order_B,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   n,
+                                    rocsparse_int                   k,
+                                    const rocsparse_double_complex* alpha,
+                                    const rocsparse_double_complex* A,
+                                    rocsparse_int                   lda,
+                                    const rocsparse_double_complex* B,
+                                    rocsparse_int                   ldb,
+                                    const rocsparse_double_complex* beta,
+                                    const rocsparse_mat_descr       descr,
+                                    rocsparse_int                   nnz,
+                                    rocsparse_double_complex*       coo_val,
+                                    const rocsparse_int*            coo_row_ind,
+                                    const rocsparse_int*            coo_col_ind)
+{
+    return rocsparse_zcoosddmm(handle,
+                               order_A,
+                               order_B,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               descr,
+                               nnz,
+                               coo_val,
+                               coo_row_ind,
+                               coo_col_ind);
+}
+
 /*
  * ===========================================================================
  *    extra SPARSE
@@ -2804,6 +6864,198 @@ rocsparse_status rocsparse_csrgemm_buffer_size(rocsparse_handle                h
                                           buffer_size);
 }
 
+template <>
+rocsparse_status rocsparse_csrgemm_buffer_size_i64(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_B,
+                                                   int32_t                   m,
+                                                   int32_t                   n,
+                                                   int32_t                   k,
+                                                   const float*              alpha,
+                                                   const rocsparse_mat_descr descr_A,
+                                                   int64_t                   nnz_A,
+                                                   const int64_t*            csr_row_ptr_A,
+                                                   const int32_t*            csr_col_ind_A,
+                                                   const rocsparse_mat_descr descr_B,
+                                                   int64_t                   nnz_B,
+                                                   const int64_t*            csr_row_ptr_B,
+                                                   const int32_t*            csr_col_ind_B,
+                                                   const float*              beta,
+                                                   const rocsparse_mat_descr descr_D,
+                                                   int64_t                   nnz_D,
+                                                   const int64_t*            csr_row_ptr_D,
+                                                   const int32_t*            csr_col_ind_D,
+                                                   rocsparse_mat_info        info_C,
+                                                   size_t*                   buffer_size)
+{
+    return rocsparse_scsrgemm_buffer_size_i64(handle,
+                                              trans_A,
+                                              trans_B,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              descr_A,
+                                              nnz_A,
+                                              csr_row_ptr_A,
+                                              csr_col_ind_A,
+                                              descr_B,
+                                              nnz_B,
+                                              csr_row_ptr_B,
+                                              csr_col_ind_B,
+                                              beta,
+                                              descr_D,
+                                              nnz_D,
+                                              csr_row_ptr_D,
+                                              csr_col_ind_D,
+                                              info_C,
+                                              buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm_buffer_size_i64(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_B,
+                                                   int32_t                   m,
+                                                   int32_t                   n,
+                                                   int32_t                   k,
+                                                   const double*             alpha,
+                                                   const rocsparse_mat_descr descr_A,
+                                                   int64_t                   nnz_A,
+                                                   const int64_t*            csr_row_ptr_A,
+                                                   const int32_t*            csr_col_ind_A,
+                                                   const rocsparse_mat_descr descr_B,
+                                                   int64_t                   nnz_B,
+                                                   const int64_t*            csr_row_ptr_B,
+                                                   const int32_t*            csr_col_ind_B,
+                                                   const double*             beta,
+                                                   const rocsparse_mat_descr descr_D,
+                                                   int64_t                   nnz_D,
+                                                   const int64_t*            csr_row_ptr_D,
+                                                   const int32_t*            csr_col_ind_D,
+                                                   rocsparse_mat_info        info_C,
+                                                   size_t*                   buffer_size)
+{
+    return rocsparse_dcsrgemm_buffer_size_i64(handle,
+                                              trans_A,
+                                              trans_B,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              descr_A,
+                                              nnz_A,
+                                              csr_row_ptr_A,
+                                              csr_col_ind_A,
+                                              descr_B,
+                                              nnz_B,
+                                              csr_row_ptr_B,
+                                              csr_col_ind_B,
+                                              beta,
+                                              descr_D,
+                                              nnz_D,
+                                              csr_row_ptr_D,
+                                              csr_col_ind_D,
+                                              info_C,
+                                              buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm_buffer_size_i64(rocsparse_handle               handle,
+                                                   rocsparse_operation            trans_A,
+                                                   rocsparse_operation            trans_B,
+                                                   int32_t                        m,
+                                                   int32_t                        n,
+                                                   int32_t                        k,
+                                                   const rocsparse_float_complex* alpha,
+                                                   const rocsparse_mat_descr      descr_A,
+                                                   int64_t                        nnz_A,
+                                                   const int64_t*                 csr_row_ptr_A,
+                                                   const int32_t*                 csr_col_ind_A,
+                                                   const rocsparse_mat_descr      descr_B,
+                                                   int64_t                        nnz_B,
+                                                   const int64_t*                 csr_row_ptr_B,
+                                                   const int32_t*                 csr_col_ind_B,
+                                                   const rocsparse_float_complex* beta,
+                                                   const rocsparse_mat_descr      descr_D,
+                                                   int64_t                        nnz_D,
+                                                   const int64_t*                 csr_row_ptr_D,
+                                                   const int32_t*                 csr_col_ind_D,
+                                                   rocsparse_mat_info             info_C,
+                                                   size_t*                        buffer_size)
+{
+    return rocsparse_ccsrgemm_buffer_size_i64(handle,
+                                              trans_A,
+                                              trans_B,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              descr_A,
+                                              nnz_A,
+                                              csr_row_ptr_A,
+                                              csr_col_ind_A,
+                                              descr_B,
+                                              nnz_B,
+                                              csr_row_ptr_B,
+                                              csr_col_ind_B,
+                                              beta,
+                                              descr_D,
+                                              nnz_D,
+                                              csr_row_ptr_D,
+                                              csr_col_ind_D,
+                                              info_C,
+                                              buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm_buffer_size_i64(rocsparse_handle                handle,
+                                                   rocsparse_operation             trans_A,
+                                                   rocsparse_operation             trans_B,
+                                                   int32_t                         m,
+                                                   int32_t                         n,
+                                                   int32_t                         k,
+                                                   const rocsparse_double_complex* alpha,
+                                                   const rocsparse_mat_descr       descr_A,
+                                                   int64_t                         nnz_A,
+                                                   const int64_t*                  csr_row_ptr_A,
+                                                   const int32_t*                  csr_col_ind_A,
+                                                   const rocsparse_mat_descr       descr_B,
+                                                   int64_t                         nnz_B,
+                                                   const int64_t*                  csr_row_ptr_B,
+                                                   const int32_t*                  csr_col_ind_B,
+                                                   const rocsparse_double_complex* beta,
+                                                   const rocsparse_mat_descr       descr_D,
+                                                   int64_t                         nnz_D,
+                                                   const int64_t*                  csr_row_ptr_D,
+                                                   const int32_t*                  csr_col_ind_D,
+                                                   rocsparse_mat_info              info_C,
+                                                   size_t*                         buffer_size)
+{
+    return rocsparse_zcsrgemm_buffer_size_i64(handle,
+                                              trans_A,
+                                              trans_B,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              descr_A,
+                                              nnz_A,
+                                              csr_row_ptr_A,
+                                              csr_col_ind_A,
+                                              descr_B,
+                                              nnz_B,
+                                              csr_row_ptr_B,
+                                              csr_col_ind_B,
+                                              beta,
+                                              descr_D,
+                                              nnz_D,
+                                              csr_row_ptr_D,
+                                              csr_col_ind_D,
+                                              info_C,
+                                              buffer_size);
+}
+
 template <>
 rocsparse_status rocsparse_csrgemm(rocsparse_handle          handle,
                                    rocsparse_operation       trans_A,
@@ -3052,6 +7304,471 @@ rocsparse_status rocsparse_csrgemm(rocsparse_handle                handle,
                               temp_buffer);
 }
 
+template <>
+rocsparse_status rocsparse_csrgemm_i64(rocsparse_handle          handle,
+                                       rocsparse_operation       trans_A,
+                                       rocsparse_operation       trans_B,
+                                       int32_t                   m,
+                                       int32_t                   n,
+                                       int32_t                   k,
+                                       const float*              alpha,
+                                       const rocsparse_mat_descr descr_A,
+                                       int64_t                   nnz_A,
+                                       const float*              csr_val_A,
+                                       const int64_t*            csr_row_ptr_A,
+                                       const int32_t*            csr_col_ind_A,
+                                       const rocsparse_mat_descr descr_B,
+                                       int64_t                   nnz_B,
+                                       const float*              csr_val_B,
+                                       const int64_t*            csr_row_ptr_B,
+                                       const int32_t*            csr_col_ind_B,
+                                       const float*              beta,
+                                       const rocsparse_mat_descr descr_D,
+                                       int64_t                   nnz_D,
+                                       const float*              csr_val_D,
+                                       const int64_t*            csr_row_ptr_D,
+                                       const int32_t*            csr_col_ind_D,
+                                       const rocsparse_mat_descr descr_C,
+                                       float*                    csr_val_C,
+                                       const int64_t*            csr_row_ptr_C,
+                                       int32_t*                  csr_col_ind_C,
+                                       const rocsparse_mat_info  info_C,
+                                       void*                     temp_buffer)
+{
+    return rocsparse_scsrgemm_i64(handle,
+                                  trans_A,
+                                  trans_B,
+                                  m,
+                                  n,
+                                  k,
+                                  alpha,
+                                  descr_A,
+                                  nnz_A,
+                                  csr_val_A,
+                                  csr_row_ptr_A,
+                                  csr_col_ind_A,
+                                  descr_B,
+                                  nnz_B,
+                                  csr_val_B,
+                                  csr_row_ptr_B,
+                                  csr_col_ind_B,
+                                  beta,
+                                  descr_D,
+                                  nnz_D,
+                                  csr_val_D,
+                                  csr_row_ptr_D,
+                                  csr_col_ind_D,
+                                  descr_C,
+                                  csr_val_C,
+                                  csr_row_ptr_C,
+                                  csr_col_ind_C,
+                                  info_C,
+                                  temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm_i64(rocsparse_handle          handle,
+                                       rocsparse_operation       trans_A,
+                                       rocsparse_operation       trans_B,
+                                       int32_t                   m,
+                                       int32_t                   n,
+                                       int32_t                   k,
+                                       const double*             alpha,
+                                       const rocsparse_mat_descr descr_A,
+                                       int64_t                   nnz_A,
+                                       const double*             csr_val_A,
+                                       const int64_t*            csr_row_ptr_A,
+                                       const int32_t*            csr_col_ind_A,
+                                       const rocsparse_mat_descr descr_B,
+                                       int64_t                   nnz_B,
+                                       const double*             csr_val_B,
+                                       const int64_t*            csr_row_ptr_B,
+                                       const int32_t*            csr_col_ind_B,
+                                       const double*             beta,
+                                       const rocsparse_mat_descr descr_D,
+                                       int64_t                   nnz_D,
+                                       const double*             csr_val_D,
+                                       const int64_t*            csr_row_ptr_D,
+                                       const int32_t*            csr_col_ind_D,
+                                       const rocsparse_mat_descr descr_C,
+                                       double*                   csr_val_C,
+                                       const int64_t*            csr_row_ptr_C,
+                                       int32_t*                  csr_col_ind_C,
+                                       const rocsparse_mat_info  info_C,
+                                       void*                     temp_buffer)
+{
+    return rocsparse_dcsrgemm_i64(handle,
+                                  trans_A,
+                                  trans_B,
+                                  m,
+                                  n,
+                                  k,
+                                  alpha,
+                                  descr_A,
+                                  nnz_A,
+                                  csr_val_A,
+                                  csr_row_ptr_A,
+                                  csr_col_ind_A,
+                                  descr_B,
+                                  nnz_B,
+                                  csr_val_B,
+                                  csr_row_ptr_B,
+                                  csr_col_ind_B,
+                                  beta,
+                                  descr_D,
+                                  nnz_D,
+                                  csr_val_D,
+                                  csr_row_ptr_D,
+                                  csr_col_ind_D,
+                                  descr_C,
+                                  csr_val_C,
+                                  csr_row_ptr_C,
+                                  csr_col_ind_C,
+                                  info_C,
+                                  temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm_i64(rocsparse_handle               handle,
+                                       rocsparse_operation            trans_A,
+                                       rocsparse_operation            trans_B,
+                                       int32_t                        m,
+                                       int32_t                        n,
+                                       int32_t                        k,
+                                       const rocsparse_float_complex* alpha,
+                                       const rocsparse_mat_descr      descr_A,
+                                       int64_t                        nnz_A,
+                                       const rocsparse_float_complex* csr_val_A,
+                                       const int64_t*                 csr_row_ptr_A,
+                                       const int32_t*                 csr_col_ind_A,
+                                       const rocsparse_mat_descr      descr_B,
+                                       int64_t                        nnz_B,
+                                       const rocsparse_float_complex* csr_val_B,
+                                       const int64_t*                 csr_row_ptr_B,
+                                       const int32_t*                 csr_col_ind_B,
+                                       const rocsparse_float_complex* beta,
+                                       const rocsparse_mat_descr      descr_D,
+                                       int64_t                        nnz_D,
+                                       const rocsparse_float_complex* csr_val_D,
+                                       const int64_t*                 csr_row_ptr_D,
+                                       const int32_t*                 csr_col_ind_D,
+                                       const rocsparse_mat_descr      descr_C,
+                                       rocsparse_float_complex*       csr_val_C,
+                                       const int64_t*                 csr_row_ptr_C,
+                                       int32_t*                       csr_col_ind_C,
+                                       const rocsparse_mat_info       info_C,
+                                       void*                          temp_buffer)
+{
+    return rocsparse_ccsrgemm_i64(handle,
+                                  trans_A,
+                                  trans_B,
+                                  m,
+                                  n,
+                                  k,
+                                  alpha,
+                                  descr_A,
+                                  nnz_A,
+                                  csr_val_A,
+                                  csr_row_ptr_A,
+                                  csr_col_ind_A,
+                                  descr_B,
+                                  nnz_B,
+                                  csr_val_B,
+                                  csr_row_ptr_B,
+                                  csr_col_ind_B,
+                                  beta,
+                                  descr_D,
+                                  nnz_D,
+                                  csr_val_D,
+                                  csr_row_ptr_D,
+                                  csr_col_ind_D,
+                                  descr_C,
+                                  csr_val_C,
+                                  csr_row_ptr_C,
+                                  csr_col_ind_C,
+                                  info_C,
+                                  temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm_i64(rocsparse_handle                handle,
+                                       rocsparse_operation             trans_A,
+                                       rocsparse_operation             trans_B,
+                                       int32_t                         m,
+                                       int32_t                         n,
+                                       int32_t                         k,
+                                       const rocsparse_double_complex* alpha,
+                                       const rocsparse_mat_descr       descr_A,
+                                       int64_t                         nnz_A,
+                                       const rocsparse_double_complex* csr_val_A,
+                                       const int64_t*                  csr_row_ptr_A,
+                                       const int32_t*                  csr_col_ind_A,
+                                       const rocsparse_mat_descr       descr_B,
+                                       int64_t                         nnz_B,
+                                       const rocsparse_double_complex* csr_val_B,
+                                       const int64_t*                  csr_row_ptr_B,
+                                       const int32_t*                  csr_col_ind_B,
+                                       const rocsparse_double_complex* beta,
+                                       const rocsparse_mat_descr       descr_D,
+                                       int64_t                         nnz_D,
+                                       const rocsparse_double_complex* csr_val_D,
+                                       const int64_t*                  csr_row_ptr_D,
+                                       const int32_t*                  csr_col_ind_D,
+                                       const rocsparse_mat_descr       descr_C,
+                                       rocsparse_double_complex*       csr_val_C,
+                                       const int64_t*                  csr_row_ptr_C,
+                                       int32_t*                        csr_col_ind_C,
+                                       const rocsparse_mat_info        info_C,
+                                       void*                           temp_buffer)
+{
+    return rocsparse_zcsrgemm_i64(handle,
+                                  trans_A,
+                                  trans_B,
+                                  m,
+                                  n,
+                                  k,
+                                  alpha,
+                                  descr_A,
+                                  nnz_A,
+                                  csr_val_A,
+                                  csr_row_ptr_A,
+                                  csr_col_ind_A,
+                                  descr_B,
+                                  nnz_B,
+                                  csr_val_B,
+                                  csr_row_ptr_B,
+                                  csr_col_ind_B,
+                                  beta,
+                                  descr_D,
+                                  nnz_D,
+                                  csr_val_D,
+                                  csr_row_ptr_D,
+                                  csr_col_ind_D,
+                                  descr_C,
+                                  csr_val_C,
+                                  csr_row_ptr_C,
+                                  csr_col_ind_C,
+                                  info_C,
+                                  temp_buffer);
+}
+
+// csrrap
+template <>
+rocsparse_status rocsparse_csrrap(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_R,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  const rocsparse_mat_descr descr_R,
+                                  rocsparse_int             nnz_R,
+                                  const float*              csr_val_R,
+                                  const rocsparse_int*      csr_row_ptr_R,
+                                  const rocsparse_int*      csr_col_ind_R,
+                                  const rocsparse_mat_descr descr_A,
+                                  rocsparse_int             nnz_A,
+                                  const float*              csr_val_A,
+                                  const rocsparse_int*      csr_row_ptr_A,
+                                  const rocsparse_int*      csr_col_ind_A,
+                                  const rocsparse_mat_descr descr_P,
+                                  rocsparse_int             nnz_P,
+                                  const float*              csr_val_P,
+                                  const rocsparse_int*      csr_row_ptr_P,
+                                  const rocsparse_int*      csr_col_ind_P,
+                                  const rocsparse_mat_descr descr_C,
+                                  float*                    csr_val_C,
+                                  const rocsparse_int*      csr_row_ptr_C,
+                                  rocsparse_int*            csr_col_ind_C,
+                                  const rocsparse_mat_info  info_C)
+{
+    return rocsparse_scsrrap(handle,
+                             trans_R,
+                             m,
+                             n,
+                             k,
+                             descr_R,
+                             nnz_R,
+                             csr_val_R,
+                             csr_row_ptr_R,
+                             csr_col_ind_R,
+                             descr_A,
+                             nnz_A,
+                             csr_val_A,
+                             csr_row_ptr_A,
+                             csr_col_ind_A,
+                             descr_P,
+                             nnz_P,
+                             csr_val_P,
+                             csr_row_ptr_P,
+                             csr_col_ind_P,
+                             descr_C,
+                             csr_val_C,
+                             csr_row_ptr_C,
+                             csr_col_ind_C,
+                             info_C);
+}
+
+template <>
+rocsparse_status rocsparse_csrrap(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_R,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  const rocsparse_mat_descr descr_R,
+                                  rocsparse_int             nnz_R,
+                                  const double*             csr_val_R,
+                                  const rocsparse_int*      csr_row_ptr_R,
+                                  const rocsparse_int*      csr_col_ind_R,
+                                  const rocsparse_mat_descr descr_A,
+                                  rocsparse_int             nnz_A,
+                                  const double*             csr_val_A,
+                                  const rocsparse_int*      csr_row_ptr_A,
+                                  const rocsparse_int*      csr_col_ind_A,
+                                  const rocsparse_mat_descr descr_P,
+                                  rocsparse_int             nnz_P,
+                                  const double*             csr_val_P,
+                                  const rocsparse_int*      csr_row_ptr_P,
+                                  const rocsparse_int*      csr_col_ind_P,
+                                  const rocsparse_mat_descr descr_C,
+                                  double*                   csr_val_C,
+                                  const rocsparse_int*      csr_row_ptr_C,
+                                  rocsparse_int*            csr_col_ind_C,
+                                  const rocsparse_mat_info  info_C)
+{
+    return rocsparse_dcsrrap(handle,
+                             trans_R,
+                             m,
+                             n,
+                             k,
+                             descr_R,
+                             nnz_R,
+                             csr_val_R,
+                             csr_row_ptr_R,
+                             csr_col_ind_R,
+                             descr_A,
+                             nnz_A,
+                             csr_val_A,
+                             csr_row_ptr_A,
+                             csr_col_ind_A,
+                             descr_P,
+                             nnz_P,
+                             csr_val_P,
+                             csr_row_ptr_P,
+                             csr_col_ind_P,
+                             descr_C,
+                             csr_val_C,
+                             csr_row_ptr_C,
+                             csr_col_ind_C,
+                             info_C);
+}
+
+template <>
+rocsparse_status rocsparse_csrrap(rocsparse_handle               handle,
+                                  rocsparse_operation            trans_R,
+                                  rocsparse_int                  m,
+                                  rocsparse_int                  n,
+                                  rocsparse_int                  k,
+                                  const rocsparse_mat_descr      descr_R,
+                                  rocsparse_int                  nnz_R,
+                                  const rocsparse_float_complex* csr_val_R,
+                                  const rocsparse_int*           csr_row_ptr_R,
+                                  const rocsparse_int*           csr_col_ind_R,
+                                  const rocsparse_mat_descr      descr_A,
+                                  rocsparse_int                  nnz_A,
+                                  const rocsparse_float_complex* csr_val_A,
+                                  const rocsparse_int*           csr_row_ptr_A,
+                                  const rocsparse_int*           csr_col_ind_A,
+                                  const rocsparse_mat_descr      descr_P,
+                                  rocsparse_int                  nnz_P,
+                                  const rocsparse_float_complex* csr_val_P,
+                                  const rocsparse_int*           csr_row_ptr_P,
+                                  const rocsparse_int*           csr_col_ind_P,
+                                  const rocsparse_mat_descr      descr_C,
+                                  rocsparse_float_complex*       csr_val_C,
+                                  const rocsparse_int*           csr_row_ptr_C,
+                                  rocsparse_int*                 csr_col_ind_C,
+                                  const rocsparse_mat_info       info_C)
+{
+    return rocsparse_ccsrrap(handle,
+                             trans_R,
+                             m,
+                             n,
+                             k,
+                             descr_R,
+                             nnz_R,
+                             csr_val_R,
+                             csr_row_ptr_R,
+                             csr_col_ind_R,
+                             descr_A,
+                             nnz_A,
+                             csr_val_A,
+                             csr_row_ptr_A,
+                             csr_col_ind_A,
+                             descr_P,
+                             nnz_P,
+                             csr_val_P,
+                             csr_row_ptr_P,
+                             csr_col_ind_P,
+                             descr_C,
+                             csr_val_C,
+                             csr_row_ptr_C,
+                             csr_col_ind_C,
+                             info_C);
+}
+
+template <>
+rocsparse_status rocsparse_csrrap(rocsparse_handle                handle,
+                                  rocsparse_operation             trans_R,
+                                  rocsparse_int                   m,
+                                  rocsparse_int                   n,
+                                  rocsparse_int                   k,
+                                  const rocsparse_mat_descr       descr_R,
+                                  rocsparse_int                   nnz_R,
+                                  const rocsparse_double_complex* csr_val_R,
+                                  const rocsparse_int*            csr_row_ptr_R,
+                                  const rocsparse_int*            csr_col_ind_R,
+                                  const rocsparse_mat_descr       descr_A,
+                                  rocsparse_int                   nnz_A,
+                                  const rocsparse_double_complex* csr_val_A,
+                                  const rocsparse_int*            csr_row_ptr_A,
+                                  const rocsparse_int*            csr_col_ind_A,
+                                  const rocsparse_mat_descr       descr_P,
+                                  rocsparse_int                   nnz_P,
+                                  const rocsparse_double_complex* csr_val_P,
+                                  const rocsparse_int*            csr_row_ptr_P,
+                                  const rocsparse_int*            csr_col_ind_P,
+                                  const rocsparse_mat_descr       descr_C,
+                                  rocsparse_double_complex*       csr_val_C,
+                                  const rocsparse_int*            csr_row_ptr_C,
+                                  rocsparse_int*                  csr_col_ind_C,
+                                  const rocsparse_mat_info        info_C)
+{
+    return rocsparse_zcsrrap(handle,
+                             trans_R,
+                             m,
+                             n,
+                             k,
+                             descr_R,
+                             nnz_R,
+                             csr_val_R,
+                             csr_row_ptr_R,
+                             csr_col_ind_R,
+                             descr_A,
+                             nnz_A,
+                             csr_val_A,
+                             csr_row_ptr_A,
+                             csr_col_ind_A,
+                             descr_P,
+                             nnz_P,
+                             csr_val_P,
+                             csr_row_ptr_P,
+                             csr_col_ind_P,
+                             descr_C,
+                             csr_val_C,
+                             csr_row_ptr_C,
+                             csr_col_ind_C,
+                             info_C);
+}
+
 /*
  * ===========================================================================
  *    precond SPARSE
@@ -3394,6 +8111,343 @@ rocsparse_status rocsparse_bsric0(rocsparse_handle          handle,
                              temp_buffer);
 }
 
+// bsrilu0
+template <>
+rocsparse_status rocsparse_bsrilu0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_direction       dir,
+                                               rocsparse_int             mb,
+                                               rocsparse_int             nnzb,
+                                               const rocsparse_mat_descr descr,
+                                               const float*              bsr_val,
+                                               const rocsparse_int*      bsr_row_ptr,
+                                               const rocsparse_int*      bsr_col_ind,
+                                               rocsparse_int             block_dim,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size)
+{
+    return rocsparse_sbsrilu0_buffer_size(handle,
+                                          dir,
+                                          mb,
+                                          nnzb,
+                                          descr,
+                                          bsr_val,
+                                          bsr_row_ptr,
+                                          bsr_col_ind,
+                                          block_dim,
+                                          info,
+                                          buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_direction       dir,
+                                               rocsparse_int             mb,
+                                               rocsparse_int             nnzb,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             bsr_val,
+                                               const rocsparse_int*      bsr_row_ptr,
+                                               const rocsparse_int*      bsr_col_ind,
+                                               rocsparse_int             block_dim,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size)
+{
+    return rocsparse_dbsrilu0_buffer_size(handle,
+                                          dir,
+                                          mb,
+                                          nnzb,
+                                          descr,
+                                          bsr_val,
+                                          bsr_row_ptr,
+                                          bsr_col_ind,
+                                          block_dim,
+                                          info,
+                                          buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0_buffer_size(rocsparse_handle               handle,
+                                               rocsparse_direction            dir,
+                                               rocsparse_int                  mb,
+                                               rocsparse_int                  nnzb,
+                                               const rocsparse_mat_descr      descr,
+                                               const rocsparse_float_complex* bsr_val,
+                                               const rocsparse_int*           bsr_row_ptr,
+                                               const rocsparse_int*           bsr_col_ind,
+                                               rocsparse_int                  block_dim,
+                                               rocsparse_mat_info             info,
+                                               size_t*                        buffer_size)
+{
+    return rocsparse_cbsrilu0_buffer_size(handle,
+                                          dir,
+                                          mb,
+                                          nnzb,
+                                          descr,
+                                          (const rocsparse_float_complex*)bsr_val,
+                                          bsr_row_ptr,
+                                          bsr_col_ind,
+                                          block_dim,
+                                          info,
+                                          buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0_buffer_size(rocsparse_handle                handle,
+                                               rocsparse_direction             dir,
+                                               rocsparse_int                   mb,
+                                               rocsparse_int                   nnzb,
+                                               const rocsparse_mat_descr       descr,
+                                               const rocsparse_double_complex* bsr_val,
+                                               const rocsparse_int*            bsr_row_ptr,
+                                               const rocsparse_int*            bsr_col_ind,
+                                               rocsparse_int                   block_dim,
+                                               rocsparse_mat_info              info,
+                                               size_t*                         buffer_size)
+{
+    return rocsparse_zbsrilu0_buffer_size(handle,
+                                          dir,
+                                          mb,
+                                          nnzb,
+                                          descr,
+                                          (const rocsparse_double_complex*)bsr_val,
+                                          bsr_row_ptr,
+                                          bsr_col_ind,
+                                          block_dim,
+                                          info,
+                                          buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0_analysis(rocsparse_handle          handle,
+                                            rocsparse_direction       dir,
+                                            rocsparse_int             mb,
+                                            rocsparse_int             nnzb,
+                                            const rocsparse_mat_descr descr,
+                                            const float*              bsr_val,
+                                            const rocsparse_int*      bsr_row_ptr,
+                                            const rocsparse_int*      bsr_col_ind,
+                                            rocsparse_int             block_dim,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer)
+{
+    return rocsparse_sbsrilu0_analysis(handle,
+                                       dir,
+                                       mb,
+                                       nnzb,
+                                       descr,
+                                       bsr_val,
+                                       bsr_row_ptr,
+                                       bsr_col_ind,
+                                       block_dim,
+                                       info,
+                                       analysis,
+                                       solve,
+                                       temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0_analysis(rocsparse_handle          handle,
+                                            rocsparse_direction       dir,
+                                            rocsparse_int             mb,
+                                            rocsparse_int             nnzb,
+                                            const rocsparse_mat_descr descr,
+                                            const double*             bsr_val,
+                                            const rocsparse_int*      bsr_row_ptr,
+                                            const rocsparse_int*      bsr_col_ind,
+                                            rocsparse_int             block_dim,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer)
+{
+    return rocsparse_dbsrilu0_analysis(handle,
+                                       dir,
+                                       mb,
+                                       nnzb,
+                                       descr,
+                                       bsr_val,
+                                       bsr_row_ptr,
+                                       bsr_col_ind,
+                                       block_dim,
+                                       info,
+                                       analysis,
+                                       solve,
+                                       temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0_analysis(rocsparse_handle               handle,
+                                            rocsparse_direction            dir,
+                                            rocsparse_int                  mb,
+                                            rocsparse_int                  nnzb,
+                                            const rocsparse_mat_descr      descr,
+                                            const rocsparse_float_complex* bsr_val,
+                                            const rocsparse_int*           bsr_row_ptr,
+                                            const rocsparse_int*           bsr_col_ind,
+                                            rocsparse_int                  block_dim,
+                                            rocsparse_mat_info             info,
+                                            rocsparse_analysis_policy      analysis,
+                                            rocsparse_solve_policy         solve,
+                                            void*                          temp_buffer)
+{
+    return rocsparse_cbsrilu0_analysis(handle,
+                                       dir,
+                                       mb,
+                                       nnzb,
+                                       descr,
+                                       (const rocsparse_float_complex*)bsr_val,
+                                       bsr_row_ptr,
+                                       bsr_col_ind,
+                                       block_dim,
+                                       info,
+                                       analysis,
+                                       solve,
+                                       temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0_analysis(rocsparse_handle                handle,
+                                            rocsparse_direction             dir,
+                                            rocsparse_int                   mb,
+                                            rocsparse_int                   nnzb,
+                                            const rocsparse_mat_descr       descr,
+                                            const rocsparse_double_complex* bsr_val,
+                                            const rocsparse_int*            bsr_row_ptr,
+                                            const rocsparse_int*            bsr_col_ind,
+                                            rocsparse_int                   block_dim,
+                                            rocsparse_mat_info              info,
+                                            rocsparse_analysis_policy       analysis,
+                                            rocsparse_solve_policy          solve,
+                                            void*                           temp_buffer)
+{
+    return rocsparse_zbsrilu0_analysis(handle,
+                                       dir,
+                                       mb,
+                                       nnzb,
+                                       descr,
+                                       (const rocsparse_double_complex*)bsr_val,
+                                       bsr_row_ptr,
+                                       bsr_col_ind,
+                                       block_dim,
+                                       info,
+                                       analysis,
+                                       solve,
+                                       temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nnzb,
+                                   const rocsparse_mat_descr descr,
+                                   float*                    bsr_val,
+                                   const rocsparse_int*      bsr_row_ptr,
+                                   const rocsparse_int*      bsr_col_ind,
+                                   rocsparse_int             block_dim,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer)
+{
+    return rocsparse_sbsrilu0(handle,
+                              dir,
+                              mb,
+                              nnzb,
+                              descr,
+                              bsr_val,
+                              bsr_row_ptr,
+                              bsr_col_ind,
+                              block_dim,
+                              info,
+                              policy,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nnzb,
+                                   const rocsparse_mat_descr descr,
+                                   double*                   bsr_val,
+                                   const rocsparse_int*      bsr_row_ptr,
+                                   const rocsparse_int*      bsr_col_ind,
+                                   rocsparse_int             block_dim,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer)
+{
+    return rocsparse_dbsrilu0(handle,
+                              dir,
+                              mb,
+                              nnzb,
+                              descr,
+                              bsr_val,
+                              bsr_row_ptr,
+                              bsr_col_ind,
+                              block_dim,
+                              info,
+                              policy,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nnzb,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_float_complex*  bsr_val,
+                                   const rocsparse_int*      bsr_row_ptr,
+                                   const rocsparse_int*      bsr_col_ind,
+                                   rocsparse_int             block_dim,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer)
+{
+    return rocsparse_cbsrilu0(handle,
+                              dir,
+                              mb,
+                              nnzb,
+                              descr,
+                              (rocsparse_float_complex*)bsr_val,
+                              bsr_row_ptr,
+                              bsr_col_ind,
+                              block_dim,
+                              info,
+                              policy,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nnzb,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_double_complex* bsr_val,
+                                   const rocsparse_int*      bsr_row_ptr,
+                                   const rocsparse_int*      bsr_col_ind,
+                                   rocsparse_int             block_dim,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer)
+{
+    return rocsparse_zbsrilu0(handle,
+                              dir,
+                              mb,
+                              nnzb,
+                              descr,
+                              (rocsparse_double_complex*)bsr_val,
+                              bsr_row_ptr,
+                              bsr_col_ind,
+                              block_dim,
+                              info,
+                              policy,
+                              temp_buffer);
+}
+
 // csric0
 template <>
 rocsparse_status rocsparse_csric0_buffer_size(rocsparse_handle          handle,
@@ -3653,6 +8707,58 @@ rocsparse_status rocsparse_csric0(rocsparse_handle          handle,
                              temp_buffer);
 }
 
+template <>
+rocsparse_status rocsparse_csric0_mixed(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nnz,
+                                        const rocsparse_mat_descr descr,
+                                        const double*             csr_val,
+                                        float*                    ic_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        rocsparse_solve_policy    policy,
+                                        void*                     temp_buffer)
+{
+    return rocsparse_dscsric0(handle,
+                              m,
+                              nnz,
+                              descr,
+                              csr_val,
+                              ic_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              info,
+                              policy,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csric0_mixed(rocsparse_handle                handle,
+                                        rocsparse_int                   m,
+                                        rocsparse_int                   nnz,
+                                        const rocsparse_mat_descr       descr,
+                                        const rocsparse_double_complex* csr_val,
+                                        rocsparse_float_complex*        ic_val,
+                                        const rocsparse_int*            csr_row_ptr,
+                                        const rocsparse_int*            csr_col_ind,
+                                        rocsparse_mat_info              info,
+                                        rocsparse_solve_policy          policy,
+                                        void*                           temp_buffer)
+{
+    return rocsparse_zccsric0(handle,
+                              m,
+                              nnz,
+                              descr,
+                              csr_val,
+                              ic_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              info,
+                              policy,
+                              temp_buffer);
+}
+
 // csrilu0
 template <>
 rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle          handle,
@@ -3882,6 +8988,238 @@ rocsparse_status rocsparse_csrilu0(rocsparse_handle          handle,
         handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
 }
 
+template <>
+rocsparse_status rocsparse_csrilu0_mixed(rocsparse_handle          handle,
+                                         rocsparse_int             m,
+                                         rocsparse_int             nnz,
+                                         const rocsparse_mat_descr descr,
+                                         const double*             csr_val,
+                                         float*                    ilu_val,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         rocsparse_mat_info        info,
+                                         rocsparse_solve_policy    policy,
+                                         void*                     temp_buffer)
+{
+    return rocsparse_dscsrilu0(handle,
+                               m,
+                               nnz,
+                               descr,
+                               csr_val,
+                               ilu_val,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               info,
+                               policy,
+                               temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_mixed(rocsparse_handle                handle,
+                                         rocsparse_int                   m,
+                                         rocsparse_int                   nnz,
+                                         const rocsparse_mat_descr       descr,
+                                         const rocsparse_double_complex* csr_val,
+                                         rocsparse_float_complex*        ilu_val,
+                                         const rocsparse_int*            csr_row_ptr,
+                                         const rocsparse_int*            csr_col_ind,
+                                         rocsparse_mat_info              info,
+                                         rocsparse_solve_policy          policy,
+                                         void*                           temp_buffer)
+{
+    return rocsparse_zccsrilu0(handle,
+                               m,
+                               nnz,
+                               descr,
+                               csr_val,
+                               ilu_val,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               info,
+                               policy,
+                               temp_buffer);
+}
+
+template <>
+rocsparse_status
+    rocsparse_csrilu0_strided_batched_buffer_size(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const float*              csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_mat_info        info,
+                                                  rocsparse_int             batch_count,
+                                                  size_t*                   buffer_size)
+{
+    return rocsparse_scsrilu0_strided_batched_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, batch_count, buffer_size);
+}
+
+template <>
+rocsparse_status
+    rocsparse_csrilu0_strided_batched_buffer_size(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const double*             csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_mat_info        info,
+                                                  rocsparse_int             batch_count,
+                                                  size_t*                   buffer_size)
+{
+    return rocsparse_dcsrilu0_strided_batched_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, batch_count, buffer_size);
+}
+
+template <>
+rocsparse_status
+    rocsparse_csrilu0_strided_batched_buffer_size(rocsparse_handle               handle,
+                                                  rocsparse_int                  m,
+                                                  rocsparse_int                  nnz,
+                                                  const rocsparse_mat_descr      descr,
+                                                  const rocsparse_float_complex* csr_val,
+                                                  const rocsparse_int*           csr_row_ptr,
+                                                  const rocsparse_int*           csr_col_ind,
+                                                  rocsparse_mat_info             info,
+                                                  rocsparse_int                  batch_count,
+                                                  size_t*                        buffer_size)
+{
+    return rocsparse_ccsrilu0_strided_batched_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, batch_count, buffer_size);
+}
+
+template <>
+rocsparse_status
+    rocsparse_csrilu0_strided_batched_buffer_size(rocsparse_handle                handle,
+                                                  rocsparse_int                   m,
+                                                  rocsparse_int                   nnz,
+                                                  const rocsparse_mat_descr       descr,
+                                                  const rocsparse_double_complex* csr_val,
+                                                  const rocsparse_int*            csr_row_ptr,
+                                                  const rocsparse_int*            csr_col_ind,
+                                                  rocsparse_mat_info              info,
+                                                  rocsparse_int                   batch_count,
+                                                  size_t*                         buffer_size)
+{
+    return rocsparse_zcsrilu0_strided_batched_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, batch_count, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_strided_batched(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   float*                    csr_val,
+                                                   rocsparse_int             stride_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_mat_info        info,
+                                                   rocsparse_int             batch_count,
+                                                   rocsparse_solve_policy    policy,
+                                                   void*                     temp_buffer)
+{
+    return rocsparse_scsrilu0_strided_batched(handle,
+                                              m,
+                                              nnz,
+                                              descr,
+                                              csr_val,
+                                              stride_val,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              info,
+                                              batch_count,
+                                              policy,
+                                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_strided_batched(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   double*                   csr_val,
+                                                   rocsparse_int             stride_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_mat_info        info,
+                                                   rocsparse_int             batch_count,
+                                                   rocsparse_solve_policy    policy,
+                                                   void*                     temp_buffer)
+{
+    return rocsparse_dcsrilu0_strided_batched(handle,
+                                              m,
+                                              nnz,
+                                              descr,
+                                              csr_val,
+                                              stride_val,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              info,
+                                              batch_count,
+                                              policy,
+                                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_strided_batched(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   rocsparse_float_complex*  csr_val,
+                                                   rocsparse_int             stride_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_mat_info        info,
+                                                   rocsparse_int             batch_count,
+                                                   rocsparse_solve_policy    policy,
+                                                   void*                     temp_buffer)
+{
+    return rocsparse_ccsrilu0_strided_batched(handle,
+                                              m,
+                                              nnz,
+                                              descr,
+                                              csr_val,
+                                              stride_val,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              info,
+                                              batch_count,
+                                              policy,
+                                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_strided_batched(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   rocsparse_double_complex* csr_val,
+                                                   rocsparse_int             stride_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_mat_info        info,
+                                                   rocsparse_int             batch_count,
+                                                   rocsparse_solve_policy    policy,
+                                                   void*                     temp_buffer)
+{
+    return rocsparse_zcsrilu0_strided_batched(handle,
+                                              m,
+                                              nnz,
+                                              descr,
+                                              csr_val,
+                                              stride_val,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              info,
+                                              batch_count,
+                                              policy,
+                                              temp_buffer);
+}
+
 /*
  * ===========================================================================
  *    conversion SPARSE
@@ -4360,19 +9698,139 @@ rocsparse_status rocsparse_csr2csc(rocsparse_handle                handle,
                                    rocsparse_index_base            idx_base,
                                    void*                           temp_buffer)
 {
-    return rocsparse_zcsr2csc(handle,
-                              m,
-                              n,
-                              nnz,
-                              csr_val,
-                              csr_row_ptr,
-                              csr_col_ind,
-                              csc_val,
-                              csc_row_ind,
-                              csc_col_ptr,
-                              copy_values,
-                              idx_base,
-                              temp_buffer);
+    return rocsparse_zcsr2csc(handle,
+                              m,
+                              n,
+                              nnz,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              csc_val,
+                              csc_row_ind,
+                              csc_col_ptr,
+                              copy_values,
+                              idx_base,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csr2csc_i64(rocsparse_handle     handle,
+                                       int32_t              m,
+                                       int32_t              n,
+                                       int64_t              nnz,
+                                       const float*         csr_val,
+                                       const int64_t*       csr_row_ptr,
+                                       const int32_t*       csr_col_ind,
+                                       float*               csc_val,
+                                       int32_t*             csc_row_ind,
+                                       int64_t*             csc_col_ptr,
+                                       rocsparse_action     copy_values,
+                                       rocsparse_index_base idx_base,
+                                       void*                temp_buffer)
+{
+    return rocsparse_scsr2csc_i64(handle,
+                                  m,
+                                  n,
+                                  nnz,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  csc_val,
+                                  csc_row_ind,
+                                  csc_col_ptr,
+                                  copy_values,
+                                  idx_base,
+                                  temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csr2csc_i64(rocsparse_handle     handle,
+                                       int32_t              m,
+                                       int32_t              n,
+                                       int64_t              nnz,
+                                       const double*        csr_val,
+                                       const int64_t*       csr_row_ptr,
+                                       const int32_t*       csr_col_ind,
+                                       double*              csc_val,
+                                       int32_t*             csc_row_ind,
+                                       int64_t*             csc_col_ptr,
+                                       rocsparse_action     copy_values,
+                                       rocsparse_index_base idx_base,
+                                       void*                temp_buffer)
+{
+    return rocsparse_dcsr2csc_i64(handle,
+                                  m,
+                                  n,
+                                  nnz,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  csc_val,
+                                  csc_row_ind,
+                                  csc_col_ptr,
+                                  copy_values,
+                                  idx_base,
+                                  temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csr2csc_i64(rocsparse_handle               handle,
+                                       int32_t                        m,
+                                       int32_t                        n,
+                                       int64_t                        nnz,
+                                       const rocsparse_float_complex* csr_val,
+                                       const int64_t*                 csr_row_ptr,
+                                       const int32_t*                 csr_col_ind,
+                                       rocsparse_float_complex*       csc_val,
+                                       int32_t*                       csc_row_ind,
+                                       int64_t*                       csc_col_ptr,
+                                       rocsparse_action               copy_values,
+                                       rocsparse_index_base           idx_base,
+                                       void*                          temp_buffer)
+{
+    return rocsparse_ccsr2csc_i64(handle,
+                                  m,
+                                  n,
+                                  nnz,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  csc_val,
+                                  csc_row_ind,
+                                  csc_col_ptr,
+                                  copy_values,
+                                  idx_base,
+                                  temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csr2csc_i64(rocsparse_handle                handle,
+                                       int32_t                         m,
+                                       int32_t                         n,
+                                       int64_t                         nnz,
+                                       const rocsparse_double_complex* csr_val,
+                                       const int64_t*                  csr_row_ptr,
+                                       const int32_t*                  csr_col_ind,
+                                       rocsparse_double_complex*       csc_val,
+                                       int32_t*                        csc_row_ind,
+                                       int64_t*                        csc_col_ptr,
+                                       rocsparse_action                copy_values,
+                                       rocsparse_index_base            idx_base,
+                                       void*                           temp_buffer)
+{
+    return rocsparse_zcsr2csc_i64(handle,
+                                  m,
+                                  n,
+                                  nnz,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  csc_val,
+                                  csc_row_ind,
+                                  csc_col_ptr,
+                                  copy_values,
+                                  idx_base,
+                                  temp_buffer);
 }
 
 // csr2ell
@@ -4472,6 +9930,103 @@ rocsparse_status rocsparse_csr2ell(rocsparse_handle                handle,
                               ell_col_ind);
 }
 
+// csr2dia
+template <>
+rocsparse_status rocsparse_csr2dia(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   const rocsparse_mat_descr csr_descr,
+                                   const float*              csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_int             dia_num_diag,
+                                   float*                    dia_val,
+                                   rocsparse_int*            dia_offset)
+{
+    return rocsparse_scsr2dia(handle,
+                              m,
+                              n,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              dia_num_diag,
+                              dia_val,
+                              dia_offset);
+}
+
+template <>
+rocsparse_status rocsparse_csr2dia(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   const rocsparse_mat_descr csr_descr,
+                                   const double*             csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_int             dia_num_diag,
+                                   double*                   dia_val,
+                                   rocsparse_int*            dia_offset)
+{
+    return rocsparse_dcsr2dia(handle,
+                              m,
+                              n,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              dia_num_diag,
+                              dia_val,
+                              dia_offset);
+}
+
+template <>
+rocsparse_status rocsparse_csr2dia(rocsparse_handle               handle,
+                                   rocsparse_int                  m,
+                                   rocsparse_int                  n,
+                                   const rocsparse_mat_descr      csr_descr,
+                                   const rocsparse_float_complex* csr_val,
+                                   const rocsparse_int*           csr_row_ptr,
+                                   const rocsparse_int*           csr_col_ind,
+                                   rocsparse_int                  dia_num_diag,
+                                   rocsparse_float_complex*       dia_val,
+                                   rocsparse_int*                 dia_offset)
+{
+    return rocsparse_ccsr2dia(handle,
+                              m,
+                              n,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              dia_num_diag,
+                              dia_val,
+                              dia_offset);
+}
+
+template <>
+rocsparse_status rocsparse_csr2dia(rocsparse_handle                handle,
+                                   rocsparse_int                   m,
+                                   rocsparse_int                   n,
+                                   const rocsparse_mat_descr       csr_descr,
+                                   const rocsparse_double_complex* csr_val,
+                                   const rocsparse_int*            csr_row_ptr,
+                                   const rocsparse_int*            csr_col_ind,
+                                   rocsparse_int                   dia_num_diag,
+                                   rocsparse_double_complex*       dia_val,
+                                   rocsparse_int*                  dia_offset)
+{
+    return rocsparse_zcsr2dia(handle,
+                              m,
+                              n,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              dia_num_diag,
+                              dia_val,
+                              dia_offset);
+}
+
 // csr2hyb
 template <>
 rocsparse_status rocsparse_csr2hyb(rocsparse_handle          handle,
@@ -4569,6 +10124,59 @@ rocsparse_status rocsparse_csr2hyb(rocsparse_handle                handle,
                               partition_type);
 }
 
+// csr2hyb_ell_width_analysis
+template <>
+rocsparse_status
+    rocsparse_csr2hyb_ell_width_analysis<float>(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                const rocsparse_mat_descr descr,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                rocsparse_int*            ell_width,
+                                                rocsparse_int*            row_nnz_hist)
+{
+    return rocsparse_scsr2hyb_ell_width_analysis(
+        handle, m, descr, csr_row_ptr, ell_width, row_nnz_hist);
+}
+
+template <>
+rocsparse_status
+    rocsparse_csr2hyb_ell_width_analysis<double>(rocsparse_handle          handle,
+                                                 rocsparse_int             m,
+                                                 const rocsparse_mat_descr descr,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 rocsparse_int*            ell_width,
+                                                 rocsparse_int*            row_nnz_hist)
+{
+    return rocsparse_dcsr2hyb_ell_width_analysis(
+        handle, m, descr, csr_row_ptr, ell_width, row_nnz_hist);
+}
+
+template <>
+rocsparse_status rocsparse_csr2hyb_ell_width_analysis<rocsparse_float_complex>(
+    rocsparse_handle          handle,
+    rocsparse_int             m,
+    const rocsparse_mat_descr descr,
+    const rocsparse_int*      csr_row_ptr,
+    rocsparse_int*            ell_width,
+    rocsparse_int*            row_nnz_hist)
+{
+    return rocsparse_ccsr2hyb_ell_width_analysis(
+        handle, m, descr, csr_row_ptr, ell_width, row_nnz_hist);
+}
+
+template <>
+rocsparse_status rocsparse_csr2hyb_ell_width_analysis<rocsparse_double_complex>(
+    rocsparse_handle          handle,
+    rocsparse_int             m,
+    const rocsparse_mat_descr descr,
+    const rocsparse_int*      csr_row_ptr,
+    rocsparse_int*            ell_width,
+    rocsparse_int*            row_nnz_hist)
+{
+    return rocsparse_zcsr2hyb_ell_width_analysis(
+        handle, m, descr, csr_row_ptr, ell_width, row_nnz_hist);
+}
+
 // csr2bsr
 template <>
 rocsparse_status rocsparse_csr2bsr(rocsparse_handle          handle,
@@ -4690,6 +10298,276 @@ rocsparse_status rocsparse_csr2bsr(rocsparse_handle                handle,
                               bsr_col_ind);
 }
 
+// csr2bsr_block_dim_analysis
+template <>
+rocsparse_status
+    rocsparse_csr2bsr_block_dim_analysis<float>(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                const rocsparse_mat_descr csr_descr,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_int             num_block_dims,
+                                                const rocsparse_int*      block_dims,
+                                                rocsparse_int             sample_size,
+                                                rocsparse_int*            bsr_nnzb,
+                                                float*                    fill_ratio,
+                                                float*                    bsrmv_cost)
+{
+    return rocsparse_scsr2bsr_block_dim_analysis(handle,
+                                                 m,
+                                                 n,
+                                                 csr_descr,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 num_block_dims,
+                                                 block_dims,
+                                                 sample_size,
+                                                 bsr_nnzb,
+                                                 fill_ratio,
+                                                 bsrmv_cost);
+}
+
+template <>
+rocsparse_status
+    rocsparse_csr2bsr_block_dim_analysis<double>(rocsparse_handle          handle,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 const rocsparse_mat_descr csr_descr,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 rocsparse_int             num_block_dims,
+                                                 const rocsparse_int*      block_dims,
+                                                 rocsparse_int             sample_size,
+                                                 rocsparse_int*            bsr_nnzb,
+                                                 float*                    fill_ratio,
+                                                 float*                    bsrmv_cost)
+{
+    return rocsparse_dcsr2bsr_block_dim_analysis(handle,
+                                                 m,
+                                                 n,
+                                                 csr_descr,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 num_block_dims,
+                                                 block_dims,
+                                                 sample_size,
+                                                 bsr_nnzb,
+                                                 fill_ratio,
+                                                 bsrmv_cost);
+}
+
+template <>
+rocsparse_status rocsparse_csr2bsr_block_dim_analysis<rocsparse_float_complex>(
+    rocsparse_handle          handle,
+    rocsparse_int             m,
+    rocsparse_int             n,
+    const rocsparse_mat_descr csr_descr,
+    const rocsparse_int*      csr_row_ptr,
+    const rocsparse_int*      csr_col_ind,
+    rocsparse_int             num_block_dims,
+    const rocsparse_int*      block_dims,
+    rocsparse_int             sample_size,
+    rocsparse_int*            bsr_nnzb,
+    float*                    fill_ratio,
+    float*                    bsrmv_cost)
+{
+    return rocsparse_ccsr2bsr_block_dim_analysis(handle,
+                                                 m,
+                                                 n,
+                                                 csr_descr,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 num_block_dims,
+                                                 block_dims,
+                                                 sample_size,
+                                                 bsr_nnzb,
+                                                 fill_ratio,
+                                                 bsrmv_cost);
+}
+
+template <>
+rocsparse_status rocsparse_csr2bsr_block_dim_analysis<rocsparse_double_complex>(
+    rocsparse_handle          handle,
+    rocsparse_int             m,
+    rocsparse_int             n,
+    const rocsparse_mat_descr csr_descr,
+    const rocsparse_int*      csr_row_ptr,
+    const rocsparse_int*      csr_col_ind,
+    rocsparse_int             num_block_dims,
+    const rocsparse_int*      block_dims,
+    rocsparse_int             sample_size,
+    rocsparse_int*            bsr_nnzb,
+    float*                    fill_ratio,
+    float*                    bsrmv_cost)
+{
+    return rocsparse_zcsr2bsr_block_dim_analysis(handle,
+                                                 m,
+                                                 n,
+                                                 csr_descr,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 num_block_dims,
+                                                 block_dims,
+                                                 sample_size,
+                                                 bsr_nnzb,
+                                                 fill_ratio,
+                                                 bsrmv_cost);
+}
+
+// csr2vbr
+template <>
+rocsparse_status rocsparse_csr2vbr(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   const rocsparse_mat_descr csr_descr,
+                                   const float*              csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nb,
+                                   const rocsparse_mat_descr vbr_descr,
+                                   float*                    vbr_val,
+                                   rocsparse_int*            vbr_val_ptr,
+                                   rocsparse_int*            vbr_row_ptr,
+                                   rocsparse_int*            vbr_col_ind,
+                                   const rocsparse_int*      vbr_row_ptn,
+                                   const rocsparse_int*      vbr_col_ptn)
+{
+    return rocsparse_scsr2vbr(handle,
+                              dir,
+                              m,
+                              n,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              mb,
+                              nb,
+                              vbr_descr,
+                              vbr_val,
+                              vbr_val_ptr,
+                              vbr_row_ptr,
+                              vbr_col_ind,
+                              vbr_row_ptn,
+                              vbr_col_ptn);
+}
+
+template <>
+rocsparse_status rocsparse_csr2vbr(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   const rocsparse_mat_descr csr_descr,
+                                   const double*             csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nb,
+                                   const rocsparse_mat_descr vbr_descr,
+                                   double*                   vbr_val,
+                                   rocsparse_int*            vbr_val_ptr,
+                                   rocsparse_int*            vbr_row_ptr,
+                                   rocsparse_int*            vbr_col_ind,
+                                   const rocsparse_int*      vbr_row_ptn,
+                                   const rocsparse_int*      vbr_col_ptn)
+{
+    return rocsparse_dcsr2vbr(handle,
+                              dir,
+                              m,
+                              n,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              mb,
+                              nb,
+                              vbr_descr,
+                              vbr_val,
+                              vbr_val_ptr,
+                              vbr_row_ptr,
+                              vbr_col_ind,
+                              vbr_row_ptn,
+                              vbr_col_ptn);
+}
+
+template <>
+rocsparse_status rocsparse_csr2vbr(rocsparse_handle               handle,
+                                   rocsparse_direction            dir,
+                                   rocsparse_int                  m,
+                                   rocsparse_int                  n,
+                                   const rocsparse_mat_descr      csr_descr,
+                                   const rocsparse_float_complex* csr_val,
+                                   const rocsparse_int*           csr_row_ptr,
+                                   const rocsparse_int*           csr_col_ind,
+                                   rocsparse_int                  mb,
+                                   rocsparse_int                  nb,
+                                   const rocsparse_mat_descr      vbr_descr,
+                                   rocsparse_float_complex*       vbr_val,
+                                   rocsparse_int*                 vbr_val_ptr,
+                                   rocsparse_int*                 vbr_row_ptr,
+                                   rocsparse_int*                 vbr_col_ind,
+                                   const rocsparse_int*           vbr_row_ptn,
+                                   const rocsparse_int*           vbr_col_ptn)
+{
+    return rocsparse_ccsr2vbr(handle,
+                              dir,
+                              m,
+                              n,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              mb,
+                              nb,
+                              vbr_descr,
+                              vbr_val,
+                              vbr_val_ptr,
+                              vbr_row_ptr,
+                              vbr_col_ind,
+                              vbr_row_ptn,
+                              vbr_col_ptn);
+}
+
+template <>
+rocsparse_status rocsparse_csr2vbr(rocsparse_handle                handle,
+                                   rocsparse_direction             dir,
+                                   rocsparse_int                   m,
+                                   rocsparse_int                   n,
+                                   const rocsparse_mat_descr       csr_descr,
+                                   const rocsparse_double_complex* csr_val,
+                                   const rocsparse_int*            csr_row_ptr,
+                                   const rocsparse_int*            csr_col_ind,
+                                   rocsparse_int                   mb,
+                                   rocsparse_int                   nb,
+                                   const rocsparse_mat_descr       vbr_descr,
+                                   rocsparse_double_complex*       vbr_val,
+                                   rocsparse_int*                  vbr_val_ptr,
+                                   rocsparse_int*                  vbr_row_ptr,
+                                   rocsparse_int*                  vbr_col_ind,
+                                   const rocsparse_int*            vbr_row_ptn,
+                                   const rocsparse_int*            vbr_col_ptn)
+{
+    return rocsparse_zcsr2vbr(handle,
+                              dir,
+                              m,
+                              n,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              mb,
+                              nb,
+                              vbr_descr,
+                              vbr_val,
+                              vbr_val_ptr,
+                              vbr_row_ptr,
+                              vbr_col_ind,
+                              vbr_row_ptn,
+                              vbr_col_ptn);
+}
+
 // ell2csr
 template <>
 rocsparse_status rocsparse_ell2csr(rocsparse_handle          handle,
@@ -4795,6 +10673,103 @@ rocsparse_status rocsparse_ell2csr(rocsparse_handle                handle,
                               csr_col_ind);
 }
 
+// dia2csr
+template <>
+rocsparse_status rocsparse_dia2csr(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             dia_num_diag,
+                                   const float*              dia_val,
+                                   const rocsparse_int*      dia_offset,
+                                   const rocsparse_mat_descr csr_descr,
+                                   float*                    csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   rocsparse_int*            csr_col_ind)
+{
+    return rocsparse_sdia2csr(handle,
+                              m,
+                              n,
+                              dia_num_diag,
+                              dia_val,
+                              dia_offset,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_dia2csr(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             dia_num_diag,
+                                   const double*             dia_val,
+                                   const rocsparse_int*      dia_offset,
+                                   const rocsparse_mat_descr csr_descr,
+                                   double*                   csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   rocsparse_int*            csr_col_ind)
+{
+    return rocsparse_ddia2csr(handle,
+                              m,
+                              n,
+                              dia_num_diag,
+                              dia_val,
+                              dia_offset,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_dia2csr(rocsparse_handle               handle,
+                                   rocsparse_int                  m,
+                                   rocsparse_int                  n,
+                                   rocsparse_int                  dia_num_diag,
+                                   const rocsparse_float_complex* dia_val,
+                                   const rocsparse_int*           dia_offset,
+                                   const rocsparse_mat_descr      csr_descr,
+                                   rocsparse_float_complex*       csr_val,
+                                   const rocsparse_int*           csr_row_ptr,
+                                   rocsparse_int*                 csr_col_ind)
+{
+    return rocsparse_cdia2csr(handle,
+                              m,
+                              n,
+                              dia_num_diag,
+                              dia_val,
+                              dia_offset,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_dia2csr(rocsparse_handle                handle,
+                                   rocsparse_int                   m,
+                                   rocsparse_int                   n,
+                                   rocsparse_int                   dia_num_diag,
+                                   const rocsparse_double_complex* dia_val,
+                                   const rocsparse_int*            dia_offset,
+                                   const rocsparse_mat_descr       csr_descr,
+                                   rocsparse_double_complex*       csr_val,
+                                   const rocsparse_int*            csr_row_ptr,
+                                   rocsparse_int*                  csr_col_ind)
+{
+    return rocsparse_zdia2csr(handle,
+                              m,
+                              n,
+                              dia_num_diag,
+                              dia_val,
+                              dia_offset,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind);
+}
+
 // hyb2csr
 template <>
 rocsparse_status rocsparse_hyb2csr(rocsparse_handle          handle,
@@ -27,6 +27,8 @@
 #include <cstdlib>
 #include <cstring>
 #include <hip/hip_runtime_api.h>
+#include <iomanip>
+#include <iostream>
 #include <sys/time.h>
 
 // Random number generator
@@ -75,3 +77,86 @@ double get_time_us_sync(hipStream_t stream)
     gettimeofday(&tv, NULL);
     return (tv.tv_sec * 1000 * 1000) + tv.tv_usec;
 };
+
+/* ============================================================================================ */
+/*  memory footprint:*/
+
+/*! \brief  Print the device memory held by the meta data of each analysis stored in a matrix
+ *  info structure, relative to the device memory held by the matrix itself */
+void print_mat_info_size(rocsparse_mat_info info, size_t matrix_size)
+{
+    static const struct
+    {
+        rocsparse_info_component component;
+        const char*              name;
+    } components[] = {{rocsparse_info_component_csrmv, "csrmv"},
+                      {rocsparse_info_component_bsrmv, "bsrmv"},
+                      {rocsparse_info_component_csrmm, "csrmm"},
+                      {rocsparse_info_component_bsrmm, "bsrmm"},
+                      {rocsparse_info_component_csrmv_format, "csrmv_fmt"},
+                      {rocsparse_info_component_csrsv, "csrsv"},
+                      {rocsparse_info_component_csrsm, "csrsm"},
+                      {rocsparse_info_component_csrilu0, "csrilu0"},
+                      {rocsparse_info_component_csric0, "csric0"},
+                      {rocsparse_info_component_bsrsv, "bsrsv"},
+                      {rocsparse_info_component_bsrsm, "bsrsm"},
+                      {rocsparse_info_component_bsric0, "bsric0"},
+                      {rocsparse_info_component_bsrilu0, "bsrilu0"},
+                      {rocsparse_info_component_csrrap, "csrrap"},
+                      {rocsparse_info_component_csrgemm, "csrgemm"},
+                      {rocsparse_info_component_shared, "shared"},
+                      {rocsparse_info_component_total, "total"}};
+
+    std::cout.precision(2);
+    std::cout.setf(std::ios::fixed);
+    std::cout.setf(std::ios::left);
+
+    std::cout << std::setw(12) << "analysis" << std::setw(16) << "bytes" << std::setw(16)
+              << "overhead[%]" << std::endl;
+
+    std::cout << std::setw(12) << "matrix" << std::setw(16) << matrix_size << std::setw(16)
+              << 100.0 << std::endl;
+
+    for(const auto& c : components)
+    {
+        size_t size = 0;
+        rocsparse_get_mat_info_size(info, c.component, &size);
+
+        // Skip analysis that have not been performed
+        if(size == 0 && c.component != rocsparse_info_component_total)
+        {
+            continue;
+        }
+
+        std::cout << std::setw(12) << c.name << std::setw(16) << size << std::setw(16)
+                  << (matrix_size > 0 ? 100.0 * size / matrix_size : 0.0) << std::endl;
+    }
+}
+
+/*! \brief  Print the device memory held by a HYB matrix, relative to the device memory held by
+ *  the CSR matrix it has been converted from */
+void print_hyb_mat_size(rocsparse_hyb_mat hyb, size_t matrix_size)
+{
+    size_t ell_size = 0;
+    size_t coo_size = 0;
+    size_t size     = 0;
+
+    rocsparse_get_hyb_mat_size(hyb, &ell_size, &coo_size, &size);
+
+    std::cout.precision(2);
+    std::cout.setf(std::ios::fixed);
+    std::cout.setf(std::ios::left);
+
+    std::cout << std::setw(12) << "format" << std::setw(16) << "bytes" << std::setw(16)
+              << "relative[%]" << std::endl;
+
+    std::cout << std::setw(12) << "csr" << std::setw(16) << matrix_size << std::setw(16) << 100.0
+              << std::endl;
+
+    std::cout << std::setw(12) << "hyb (ell)" << std::setw(16) << ell_size << std::setw(16)
+              << (matrix_size > 0 ? 100.0 * ell_size / matrix_size : 0.0) << std::endl;
+    std::cout << std::setw(12) << "hyb (coo)" << std::setw(16) << coo_size << std::setw(16)
+              << (matrix_size > 0 ? 100.0 * coo_size / matrix_size : 0.0) << std::endl;
+    std::cout << std::setw(12) << "hyb" << std::setw(16) << size << std::setw(16)
+              << (matrix_size > 0 ? 100.0 * size / matrix_size : 0.0) << std::endl;
+}
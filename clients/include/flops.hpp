@@ -95,6 +95,12 @@ constexpr double
     return (3.0 * nnz_A * N + (beta ? nnz_C : 0)) / 1e9;
 }
 
+template <typename T>
+constexpr double sddmm_gflop_count(rocsparse_int K, rocsparse_int nnz_C, bool beta = false)
+{
+    return ((2.0 * K + 1.0) * nnz_C + (beta ? 2.0 * nnz_C : 0)) / 1e9;
+}
+
 /*
  * ===========================================================================
  *    extra SPARSE
@@ -132,32 +138,32 @@ constexpr double csrgeam_gflop_count(
     return flops / 1e9;
 }
 
-template <typename T>
-constexpr double csrgemm_gflop_count(rocsparse_int                     M,
-                                     const T*                          alpha,
-                                     const std::vector<rocsparse_int>& csr_row_ptr_A,
-                                     const std::vector<rocsparse_int>& csr_col_ind_A,
-                                     const std::vector<rocsparse_int>& csr_row_ptr_B,
-                                     const T*                          beta,
-                                     const std::vector<rocsparse_int>& csr_row_ptr_D,
-                                     rocsparse_index_base              baseA)
+template <typename T, typename I, typename J>
+constexpr double csrgemm_gflop_count(J                     M,
+                                     const T*              alpha,
+                                     const std::vector<I>& csr_row_ptr_A,
+                                     const std::vector<J>& csr_col_ind_A,
+                                     const std::vector<I>& csr_row_ptr_B,
+                                     const T*              beta,
+                                     const std::vector<I>& csr_row_ptr_D,
+                                     rocsparse_index_base  baseA)
 {
     // Flop counter
     double flops = 0.0;
 
     // Loop over rows of A
-    for(rocsparse_int i = 0; i < M; ++i)
+    for(J i = 0; i < M; ++i)
     {
         if(alpha)
         {
-            rocsparse_int row_begin_A = csr_row_ptr_A[i] - baseA;
-            rocsparse_int row_end_A   = csr_row_ptr_A[i + 1] - baseA;
+            I row_begin_A = csr_row_ptr_A[i] - baseA;
+            I row_end_A   = csr_row_ptr_A[i + 1] - baseA;
 
             // Loop over columns of A
-            for(rocsparse_int j = row_begin_A; j < row_end_A; ++j)
+            for(I j = row_begin_A; j < row_end_A; ++j)
             {
                 // Current column of A
-                rocsparse_int col_A = csr_col_ind_A[j] - baseA;
+                J col_A = csr_col_ind_A[j] - baseA;
 
                 // Count flops generated by alpha * A * B
                 flops += 2.0 * (csr_row_ptr_B[col_A + 1] - csr_row_ptr_B[col_A]) + 1.0;
@@ -174,4 +180,47 @@ constexpr double csrgemm_gflop_count(rocsparse_int                     M,
     return flops / 1e9;
 }
 
+template <typename T>
+constexpr double csrrap_gflop_count(rocsparse_int                     M,
+                                    const std::vector<rocsparse_int>& csr_row_ptr_R,
+                                    const std::vector<rocsparse_int>& csr_col_ind_R,
+                                    const std::vector<rocsparse_int>& csr_row_ptr_A,
+                                    const std::vector<rocsparse_int>& csr_col_ind_A,
+                                    const std::vector<rocsparse_int>& csr_row_ptr_P,
+                                    rocsparse_index_base              baseR,
+                                    rocsparse_index_base              baseA)
+{
+    // Flop counter
+    double flops = 0.0;
+
+    // Loop over rows of op(R)
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row_begin_R = csr_row_ptr_R[i] - baseR;
+        rocsparse_int row_end_R   = csr_row_ptr_R[i + 1] - baseR;
+
+        // Loop over columns of op(R)
+        for(rocsparse_int j = row_begin_R; j < row_end_R; ++j)
+        {
+            // Current column of op(R)
+            rocsparse_int col_R = csr_col_ind_R[j] - baseR;
+
+            rocsparse_int row_begin_A = csr_row_ptr_A[col_R] - baseA;
+            rocsparse_int row_end_A   = csr_row_ptr_A[col_R + 1] - baseA;
+
+            // Loop over columns of A in row col_R
+            for(rocsparse_int l = row_begin_A; l < row_end_A; ++l)
+            {
+                // Current column of A
+                rocsparse_int col_A = csr_col_ind_A[l] - baseA;
+
+                // Count flops generated by op(R) * A * P
+                flops += 2.0 * (csr_row_ptr_P[col_A + 1] - csr_row_ptr_P[col_A]) + 1.0;
+            }
+        }
+    }
+
+    return flops / 1e9;
+}
+
 #endif // FLOPS_HPP
@@ -91,6 +91,47 @@ constexpr double bsrmv_gbyte_count(rocsparse_int mb,
            / 1e9;
 }
 
+// Mixed precision, the sparse matrix values are stored in U
+template <typename T, typename U>
+constexpr double bsrmv_mixed_gbyte_count(rocsparse_int mb,
+                                         rocsparse_int nb,
+                                         rocsparse_int nnzb,
+                                         rocsparse_int bsr_dim,
+                                         bool          beta = false)
+{
+    return ((mb + 1 + nnzb) * sizeof(rocsparse_int)
+            + ((mb + nb) * bsr_dim + (beta ? mb * bsr_dim : 0)) * sizeof(T)
+            + nnzb * bsr_dim * bsr_dim * sizeof(U))
+           / 1e9;
+}
+
+template <typename T>
+constexpr double vbrmv_gbyte_count(rocsparse_int M,
+                                   rocsparse_int N,
+                                   rocsparse_int mb,
+                                   rocsparse_int nb,
+                                   rocsparse_int nnzb,
+                                   rocsparse_int vbr_nnz,
+                                   bool          beta = false)
+{
+    return ((mb + 1 + mb + 1 + nb + 1 + nnzb + nnzb + 1) * sizeof(rocsparse_int)
+            + (M + N + vbr_nnz + (beta ? M : 0)) * sizeof(T))
+           / 1e9;
+}
+
+template <typename T>
+constexpr double csrdcmv_gbyte_count(rocsparse_int M,
+                                     rocsparse_int N,
+                                     rocsparse_int nnz,
+                                     rocsparse_int nnz_exc,
+                                     rocsparse_int delta_bits,
+                                     bool          beta = false)
+{
+    return ((M + 1 + M + M + 1 + nnz_exc) * sizeof(rocsparse_int) + nnz * (delta_bits / 8)
+            + (M + N + nnz + (beta ? M : 0)) * sizeof(T))
+           / 1e9;
+}
+
 template <typename T>
 constexpr double
     coomv_gbyte_count(rocsparse_int M, rocsparse_int N, rocsparse_int nnz, bool beta = false)
@@ -98,6 +139,15 @@ constexpr double
     return (2.0 * nnz * sizeof(rocsparse_int) + (M + N + nnz + (beta ? M : 0)) * sizeof(T)) / 1e9;
 }
 
+template <typename T, typename U>
+constexpr double
+    coomv_mixed_gbyte_count(rocsparse_int M, rocsparse_int N, rocsparse_int nnz, bool beta = false)
+{
+    return (2.0 * nnz * sizeof(rocsparse_int) + (M + N + (beta ? M : 0)) * sizeof(T)
+            + nnz * sizeof(U))
+           / 1e9;
+}
+
 template <typename T>
 constexpr double
     csrmv_gbyte_count(rocsparse_int M, rocsparse_int N, rocsparse_int nnz, bool beta = false)
@@ -106,6 +156,37 @@ constexpr double
            / 1e9;
 }
 
+template <typename T>
+constexpr double
+    csrmv_i64_gbyte_count(rocsparse_int M, rocsparse_int N, int64_t nnz, bool beta = false)
+{
+    return ((M + 1) * sizeof(int64_t) + nnz * sizeof(int32_t)
+            + (M + N + nnz + (beta ? M : 0)) * sizeof(T))
+           / 1e9;
+}
+
+template <typename T, typename U>
+constexpr double
+    csrmv_mixed_gbyte_count(rocsparse_int M, rocsparse_int N, rocsparse_int nnz, bool beta = false)
+{
+    return ((M + 1 + nnz) * sizeof(rocsparse_int) + (M + N + (beta ? M : 0)) * sizeof(T)
+            + nnz * sizeof(U))
+           / 1e9;
+}
+
+// The sparsity pattern is shared by all matrices of the batch and read only once
+template <typename T>
+constexpr double csrmv_strided_batched_gbyte_count(rocsparse_int M,
+                                                   rocsparse_int N,
+                                                   rocsparse_int nnz,
+                                                   rocsparse_int batch_count,
+                                                   bool          beta = false)
+{
+    return ((M + 1 + nnz) * sizeof(rocsparse_int)
+            + (double)batch_count * (M + N + nnz + (beta ? M : 0)) * sizeof(T))
+           / 1e9;
+}
+
 template <typename T>
 constexpr double bsrsv_gbyte_count(rocsparse_int mb, rocsparse_int nnzb, rocsparse_int bsr_dim)
 {
@@ -120,6 +201,38 @@ constexpr double csrsv_gbyte_count(rocsparse_int M, rocsparse_int nnz)
     return ((M + 1 + nnz) * sizeof(rocsparse_int) + (M + M + nnz) * sizeof(T)) / 1e9;
 }
 
+template <typename T>
+constexpr double csrsv_i64_gbyte_count(rocsparse_int M, int64_t nnz)
+{
+    return ((M + 1) * sizeof(int64_t) + nnz * sizeof(int32_t) + (M + M + nnz) * sizeof(T)) / 1e9;
+}
+
+template <typename T, typename U>
+constexpr double csrsv_mixed_gbyte_count(rocsparse_int M, rocsparse_int nnz)
+{
+    return ((M + 1 + nnz) * sizeof(rocsparse_int) + (M + M) * sizeof(T) + nnz * sizeof(U)) / 1e9;
+}
+
+template <typename T>
+constexpr double csrsv_strided_batched_gbyte_count(rocsparse_int M,
+                                                   rocsparse_int nnz,
+                                                   rocsparse_int batch_count)
+{
+    return ((M + 1 + nnz) * sizeof(rocsparse_int) + (double)batch_count * (M + M + nnz) * sizeof(T))
+           / 1e9;
+}
+
+template <typename T>
+constexpr double diamv_gbyte_count(rocsparse_int M,
+                                   rocsparse_int N,
+                                   rocsparse_int dia_nnz,
+                                   rocsparse_int dia_num_diag,
+                                   bool          beta = false)
+{
+    return (dia_num_diag * sizeof(rocsparse_int) + (M + N + dia_nnz + (beta ? M : 0)) * sizeof(T))
+           / 1e9;
+}
+
 template <typename T>
 constexpr double
     ellmv_gbyte_count(rocsparse_int M, rocsparse_int N, rocsparse_int nnz, bool beta = false)
@@ -127,6 +240,24 @@ constexpr double
     return (nnz * sizeof(rocsparse_int) + (M + N + nnz + (beta ? M : 0)) * sizeof(T)) / 1e9;
 }
 
+template <typename T, typename U>
+constexpr double
+    ellmv_mixed_gbyte_count(rocsparse_int M, rocsparse_int N, rocsparse_int nnz, bool beta = false)
+{
+    return (nnz * sizeof(rocsparse_int) + (M + N + (beta ? M : 0)) * sizeof(T) + nnz * sizeof(U))
+           / 1e9;
+}
+
+// Additional traffic of the x^H * y and y^H * y reductions on top of the SpMV. Unfused,
+// x and y are read by a separate dot product and y again by a separate norm. Fused, the
+// reductions are computed while y is written and only x is read once more.
+template <typename T>
+constexpr double spmv_dot_gbyte_count(rocsparse_int M, bool dot_xy, bool dot_yy, bool fused)
+{
+    return ((dot_xy ? (fused ? M : 2 * M) : 0) + ((dot_yy && !fused) ? M : 0)) * sizeof(T)
+           / 1e9;
+}
+
 /*
  * ===========================================================================
  *    level 3 SPARSE
@@ -150,6 +281,18 @@ constexpr double bsrmm_gbyte_count(rocsparse_int Mb,
     return (reads + writes) / 1e9;
 }
 
+template <typename T>
+constexpr double bsrsm_gbyte_count(rocsparse_int mb,
+                                   rocsparse_int nnzb,
+                                   rocsparse_int block_dim,
+                                   rocsparse_int nrhs)
+{
+    // The matrix is read once for all right-hand sides, B is read and written
+    return ((mb + 1 + nnzb) * sizeof(rocsparse_int)
+            + (block_dim * block_dim * nnzb + 2.0 * mb * block_dim * nrhs) * sizeof(T))
+           / 1e9;
+}
+
 template <typename T>
 constexpr double csrmm_gbyte_count(rocsparse_int M,
                                    rocsparse_int nnz_A,
@@ -162,6 +305,38 @@ constexpr double csrmm_gbyte_count(rocsparse_int M,
            / 1e9;
 }
 
+template <typename T, typename U>
+constexpr double csrmm_mixed_gbyte_count(rocsparse_int M,
+                                         rocsparse_int nnz_A,
+                                         rocsparse_int nnz_B,
+                                         rocsparse_int nnz_C,
+                                         bool          beta = false)
+{
+    return ((M + 1 + nnz_A) * sizeof(rocsparse_int)
+            + (nnz_B + nnz_C + (beta ? nnz_C : 0)) * sizeof(T) + nnz_A * sizeof(U))
+           / 1e9;
+}
+
+template <typename T>
+constexpr double csrsddmm_gbyte_count(
+    rocsparse_int M, rocsparse_int N, rocsparse_int K, rocsparse_int nnz_C, bool beta = false)
+{
+    // A and B are read at least once
+    return ((M + 1 + nnz_C) * sizeof(rocsparse_int)
+            + ((double)M * K + (double)K * N + nnz_C + (beta ? nnz_C : 0)) * sizeof(T))
+           / 1e9;
+}
+
+template <typename T>
+constexpr double coosddmm_gbyte_count(
+    rocsparse_int M, rocsparse_int N, rocsparse_int K, rocsparse_int nnz_C, bool beta = false)
+{
+    // A and B are read at least once
+    return (2.0 * nnz_C * sizeof(rocsparse_int)
+            + ((double)M * K + (double)K * N + nnz_C + (beta ? nnz_C : 0)) * sizeof(T))
+           / 1e9;
+}
+
 /*
  * ===========================================================================
  *    extra SPARSE
@@ -201,6 +376,45 @@ constexpr double csrgemm_gbyte_count(rocsparse_int M,
     return (size_A + size_B + size_C + size_D) / 1e9;
 }
 
+template <typename T>
+constexpr double csrgemm_i64_gbyte_count(rocsparse_int M,
+                                         rocsparse_int N,
+                                         rocsparse_int K,
+                                         int64_t       nnz_A,
+                                         int64_t       nnz_B,
+                                         int64_t       nnz_C,
+                                         int64_t       nnz_D,
+                                         const T*      alpha,
+                                         const T*      beta)
+{
+    double size_A = alpha ? (M + 1.0) * sizeof(int64_t) + nnz_A * (sizeof(int32_t) + sizeof(T))
+                          : 0.0;
+    double size_B = alpha ? (K + 1.0) * sizeof(int64_t) + nnz_B * (sizeof(int32_t) + sizeof(T))
+                          : 0.0;
+    double size_C = (M + 1.0) * sizeof(int64_t) + nnz_C * (sizeof(int32_t) + sizeof(T));
+    double size_D = beta ? (M + 1.0) * sizeof(int64_t) + nnz_D * (sizeof(int32_t) + sizeof(T))
+                         : 0.0;
+
+    return (size_A + size_B + size_C + size_D) / 1e9;
+}
+
+template <typename T>
+constexpr double csrrap_gbyte_count(rocsparse_int M,
+                                    rocsparse_int N,
+                                    rocsparse_int K,
+                                    rocsparse_int nnz_R,
+                                    rocsparse_int nnz_A,
+                                    rocsparse_int nnz_P,
+                                    rocsparse_int nnz_C)
+{
+    double size_R = (M + 1.0 + nnz_R) * sizeof(rocsparse_int) + nnz_R * sizeof(T);
+    double size_A = (N + 1.0 + nnz_A) * sizeof(rocsparse_int) + nnz_A * sizeof(T);
+    double size_P = (N + 1.0 + nnz_P) * sizeof(rocsparse_int) + nnz_P * sizeof(T);
+    double size_C = (M + 1.0 + nnz_C) * sizeof(rocsparse_int) + nnz_C * sizeof(T);
+
+    return (size_R + size_A + size_P + size_C) / 1e9;
+}
+
 /*
  * ===========================================================================
  *    precond SPARSE
@@ -214,6 +428,14 @@ constexpr double bsric0_gbyte_count(rocsparse_int Mb, rocsparse_int block_dim, r
            / 1e9;
 }
 
+template <typename T>
+constexpr double bsrilu0_gbyte_count(rocsparse_int Mb, rocsparse_int block_dim, rocsparse_int nnzb)
+{
+    return ((Mb + 1 + nnzb) * sizeof(rocsparse_int)
+            + 2.0 * block_dim * block_dim * nnzb * sizeof(T))
+           / 1e9;
+}
+
 template <typename T>
 constexpr double csric0_gbyte_count(rocsparse_int M, rocsparse_int nnz)
 {
@@ -226,6 +448,20 @@ constexpr double csrilu0_gbyte_count(rocsparse_int M, rocsparse_int nnz)
     return ((M + 1 + nnz) * sizeof(rocsparse_int) + 2.0 * nnz * sizeof(T)) / 1e9;
 }
 
+template <typename T, typename U>
+constexpr double csrilu0_mixed_gbyte_count(rocsparse_int M, rocsparse_int nnz)
+{
+    return ((M + 1 + nnz) * sizeof(rocsparse_int) + nnz * sizeof(T) + 3.0 * nnz * sizeof(U)) / 1e9;
+}
+
+template <typename T>
+constexpr double csrilu0_strided_batched_gbyte_count(rocsparse_int M,
+                                                     rocsparse_int nnz,
+                                                     rocsparse_int batch_count)
+{
+    return ((M + 1 + nnz) * sizeof(rocsparse_int) + 2.0 * batch_count * nnz * sizeof(T)) / 1e9;
+}
+
 /*
  * ===========================================================================
  *    conversion SPARSE
@@ -276,6 +512,18 @@ constexpr double coo2csr_gbyte_count(rocsparse_int M, rocsparse_int nnz)
     return (M + 1 + nnz) * sizeof(rocsparse_int) / 1e9;
 }
 
+template <typename T>
+constexpr double csr2coo_i64_gbyte_count(rocsparse_int M, int64_t nnz)
+{
+    return ((M + 1) * sizeof(int64_t) + nnz * sizeof(int32_t)) / 1e9;
+}
+
+template <typename T>
+constexpr double coo2csr_i64_gbyte_count(rocsparse_int M, int64_t nnz)
+{
+    return ((M + 1) * sizeof(int64_t) + nnz * sizeof(int32_t)) / 1e9;
+}
+
 template <typename T>
 constexpr double csr2csc_gbyte_count(rocsparse_int    M,
                                      rocsparse_int    N,
@@ -287,6 +535,17 @@ constexpr double csr2csc_gbyte_count(rocsparse_int    M,
            / 1e9;
 }
 
+template <typename T>
+constexpr double csr2csc_i64_gbyte_count(rocsparse_int    M,
+                                         rocsparse_int    N,
+                                         int64_t          nnz,
+                                         rocsparse_action action)
+{
+    return ((M + N + 2) * sizeof(int64_t) + (2.0 * nnz) * sizeof(int32_t)
+            + (action == rocsparse_action_numeric ? (2.0 * nnz) * sizeof(T) : 0.0))
+           / 1e9;
+}
+
 template <typename T>
 constexpr double csr2ell_gbyte_count(rocsparse_int M, rocsparse_int nnz, rocsparse_int ell_nnz)
 {
@@ -299,6 +558,27 @@ constexpr double ell2csr_gbyte_count(rocsparse_int M, rocsparse_int csr_nnz, roc
     return ((M + 1.0 + ell_nnz) * sizeof(rocsparse_int) + (csr_nnz + ell_nnz) * sizeof(T)) / 1e9;
 }
 
+template <typename T>
+constexpr double csr2dia_gbyte_count(rocsparse_int M,
+                                     rocsparse_int nnz,
+                                     rocsparse_int dia_nnz,
+                                     rocsparse_int dia_num_diag)
+{
+    return ((M + 1.0 + nnz + dia_num_diag) * sizeof(rocsparse_int) + (nnz + dia_nnz) * sizeof(T))
+           / 1e9;
+}
+
+template <typename T>
+constexpr double dia2csr_gbyte_count(rocsparse_int M,
+                                     rocsparse_int csr_nnz,
+                                     rocsparse_int dia_nnz,
+                                     rocsparse_int dia_num_diag)
+{
+    return ((M + 1.0 + csr_nnz + dia_num_diag) * sizeof(rocsparse_int)
+            + (csr_nnz + dia_nnz) * sizeof(T))
+           / 1e9;
+}
+
 template <typename T>
 constexpr double csr2hyb_gbyte_count(rocsparse_int M,
                                      rocsparse_int nnz,
@@ -352,6 +632,23 @@ constexpr double csr2bsr_gbyte_count(rocsparse_int M,
     return (reads + writes) / 1e9;
 }
 
+template <typename T>
+constexpr double csr2vbr_gbyte_count(rocsparse_int M,
+                                     rocsparse_int mb,
+                                     rocsparse_int nb,
+                                     rocsparse_int nnz,
+                                     rocsparse_int nnzb,
+                                     rocsparse_int vbr_nnz)
+{
+    // reads
+    size_t reads = (M + 1 + nnz + mb + 1 + nb + 1) * sizeof(rocsparse_int) + nnz * sizeof(T);
+
+    // writes
+    size_t writes = (mb + 1 + nnzb + nnzb + 1) * sizeof(rocsparse_int) + vbr_nnz * sizeof(T);
+
+    return (reads + writes) / 1e9;
+}
+
 template <typename T>
 constexpr double
     csr2csr_compress_gbyte_count(rocsparse_int M, rocsparse_int nnz_A, rocsparse_int nnz_C)
@@ -363,6 +660,21 @@ constexpr double
     return (reads + writes) / 1e9;
 }
 
+template <typename T>
+constexpr double csr2csrdc_gbyte_count(rocsparse_int M,
+                                       rocsparse_int nnz,
+                                       rocsparse_int nnz_exc,
+                                       rocsparse_int delta_bits)
+{
+    // reads
+    size_t reads = (M + 1 + nnz + M + 1 + nnz + M + 1) * sizeof(rocsparse_int);
+
+    // writes
+    size_t writes = (M + 1 + M + nnz_exc) * sizeof(rocsparse_int) + nnz * (delta_bits / 8);
+
+    return (reads + writes) / 1e9;
+}
+
 template <typename T>
 constexpr double identity_gbyte_count(rocsparse_int N)
 {
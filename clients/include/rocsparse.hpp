@@ -134,6 +134,74 @@ rocsparse_status rocsparse_bsrmv(rocsparse_handle          handle,
                                  const T*                  beta,
                                  T*                        y);
 
+template <typename T, typename U>
+rocsparse_status rocsparse_bsrmv_mixed(rocsparse_handle          handle,
+                                       rocsparse_direction       dir,
+                                       rocsparse_operation       trans,
+                                       rocsparse_int             mb,
+                                       rocsparse_int             nb,
+                                       rocsparse_int             nnzb,
+                                       const T*                  alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const U*                  bsr_val,
+                                       const rocsparse_int*      bsr_row_ptr,
+                                       const rocsparse_int*      bsr_col_ind,
+                                       rocsparse_int             bsr_dim,
+                                       const T*                  x,
+                                       const T*                  beta,
+                                       T*                        y);
+
+template <typename T>
+rocsparse_status rocsparse_bsrmv_ex_analysis(rocsparse_handle          handle,
+                                             rocsparse_direction       dir,
+                                             rocsparse_operation       trans,
+                                             rocsparse_int             mb,
+                                             rocsparse_int             nb,
+                                             rocsparse_int             nnzb,
+                                             const rocsparse_mat_descr descr,
+                                             const T*                  bsr_val,
+                                             const rocsparse_int*      bsr_row_ptr,
+                                             const rocsparse_int*      bsr_col_ind,
+                                             rocsparse_int             bsr_dim,
+                                             rocsparse_mat_info        info);
+
+template <typename T>
+rocsparse_status rocsparse_bsrmv_ex(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_operation       trans,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nb,
+                                    rocsparse_int             nnzb,
+                                    const T*                  alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const T*                  bsr_val,
+                                    const rocsparse_int*      bsr_row_ptr,
+                                    const rocsparse_int*      bsr_col_ind,
+                                    rocsparse_int             bsr_dim,
+                                    rocsparse_mat_info        info,
+                                    const T*                  x,
+                                    const T*                  beta,
+                                    T*                        y);
+
+template <typename T>
+rocsparse_status rocsparse_bsrmv_dot(rocsparse_handle          handle,
+                                     rocsparse_direction       dir,
+                                     rocsparse_operation       trans,
+                                     rocsparse_int             mb,
+                                     rocsparse_int             nb,
+                                     rocsparse_int             nnzb,
+                                     const T*                  alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const T*                  bsr_val,
+                                     const rocsparse_int*      bsr_row_ptr,
+                                     const rocsparse_int*      bsr_col_ind,
+                                     rocsparse_int             bsr_dim,
+                                     const T*                  x,
+                                     const T*                  beta,
+                                     T*                        y,
+                                     T*                        dot_xy,
+                                     T*                        dot_yy);
+
 // bsrsv
 template <typename T>
 rocsparse_status rocsparse_bsrsv_buffer_size(rocsparse_handle          handle,
@@ -199,6 +267,21 @@ rocsparse_status rocsparse_coomv(rocsparse_handle          handle,
                                  const T*                  beta,
                                  T*                        y);
 
+template <typename T, typename U>
+rocsparse_status rocsparse_coomv_mixed(rocsparse_handle          handle,
+                                       rocsparse_operation       trans,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       rocsparse_int             nnz,
+                                       const T*                  alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const U*                  coo_val,
+                                       const rocsparse_int*      coo_row_ind,
+                                       const rocsparse_int*      coo_col_ind,
+                                       const T*                  x,
+                                       const T*                  beta,
+                                       T*                        y);
+
 // csrmv
 template <typename T>
 rocsparse_status rocsparse_csrmv_analysis(rocsparse_handle          handle,
@@ -212,6 +295,18 @@ rocsparse_status rocsparse_csrmv_analysis(rocsparse_handle          handle,
                                           const rocsparse_int*      csr_col_ind,
                                           rocsparse_mat_info        info);
 
+template <typename T>
+rocsparse_status rocsparse_csrmv_analysis_i64(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              int32_t                   m,
+                                              int32_t                   n,
+                                              int64_t                   nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const T*                  csr_val,
+                                              const int64_t*            csr_row_ptr,
+                                              const int32_t*            csr_col_ind,
+                                              rocsparse_mat_info        info);
+
 template <typename T>
 rocsparse_status rocsparse_csrmv(rocsparse_handle          handle,
                                  rocsparse_operation       trans,
@@ -228,6 +323,103 @@ rocsparse_status rocsparse_csrmv(rocsparse_handle          handle,
                                  const T*                  beta,
                                  T*                        y);
 
+template <typename T>
+rocsparse_status rocsparse_csrmv_i64(rocsparse_handle          handle,
+                                     rocsparse_operation       trans,
+                                     int32_t                   m,
+                                     int32_t                   n,
+                                     int64_t                   nnz,
+                                     const T*                  alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const T*                  csr_val,
+                                     const int64_t*            csr_row_ptr,
+                                     const int32_t*            csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     const T*                  x,
+                                     const T*                  beta,
+                                     T*                        y);
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrmv_mixed(rocsparse_handle          handle,
+                                       rocsparse_operation       trans,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       rocsparse_int             nnz,
+                                       const T*                  alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const U*                  csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_mat_info        info,
+                                       const T*                  x,
+                                       const T*                  beta,
+                                       T*                        y);
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_dot(rocsparse_handle          handle,
+                                     rocsparse_operation       trans,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             nnz,
+                                     const T*                  alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const T*                  csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     const T*                  x,
+                                     const T*                  beta,
+                                     T*                        y,
+                                     T*                        dot_xy,
+                                     T*                        dot_yy);
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_format_analysis(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const T*                  csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 rocsparse_int             benchmark_iter,
+                                                 rocsparse_mat_info        info);
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_format(rocsparse_handle          handle,
+                                        rocsparse_operation       trans,
+                                        rocsparse_int             m,
+                                        rocsparse_int             n,
+                                        rocsparse_int             nnz,
+                                        const T*                  alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const T*                  csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        const T*                  x,
+                                        const T*                  beta,
+                                        T*                        y);
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_strided_batched(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             nnz,
+                                                 const T*                  alpha,
+                                                 const rocsparse_mat_descr descr,
+                                                 const T*                  csr_val,
+                                                 rocsparse_int             stride_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 const T*                  x,
+                                                 rocsparse_int             stride_x,
+                                                 const T*                  beta,
+                                                 T*                        y,
+                                                 rocsparse_int             stride_y,
+                                                 rocsparse_int             batch_count);
+
 // csrsv
 template <typename T>
 rocsparse_status rocsparse_csrsv_buffer_size(rocsparse_handle          handle,
@@ -241,6 +433,18 @@ rocsparse_status rocsparse_csrsv_buffer_size(rocsparse_handle          handle,
                                              rocsparse_mat_info        info,
                                              size_t*                   buffer_size);
 
+template <typename T>
+rocsparse_status rocsparse_csrsv_buffer_size_i64(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 int32_t                   m,
+                                                 int64_t                   nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const T*                  csr_val,
+                                                 const int64_t*            csr_row_ptr,
+                                                 const int32_t*            csr_col_ind,
+                                                 rocsparse_mat_info        info,
+                                                 size_t*                   buffer_size);
+
 template <typename T>
 rocsparse_status rocsparse_csrsv_analysis(rocsparse_handle          handle,
                                           rocsparse_operation       trans,
@@ -255,6 +459,20 @@ rocsparse_status rocsparse_csrsv_analysis(rocsparse_handle          handle,
                                           rocsparse_solve_policy    solve,
                                           void*                     temp_buffer);
 
+template <typename T>
+rocsparse_status rocsparse_csrsv_analysis_i64(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              int32_t                   m,
+                                              int64_t                   nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const T*                  csr_val,
+                                              const int64_t*            csr_row_ptr,
+                                              const int32_t*            csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              rocsparse_analysis_policy analysis,
+                                              rocsparse_solve_policy    solve,
+                                              void*                     temp_buffer);
+
 template <typename T>
 rocsparse_status rocsparse_csrsv_solve(rocsparse_handle          handle,
                                        rocsparse_operation       trans,
@@ -271,6 +489,86 @@ rocsparse_status rocsparse_csrsv_solve(rocsparse_handle          handle,
                                        rocsparse_solve_policy    policy,
                                        void*                     temp_buffer);
 
+template <typename T>
+rocsparse_status rocsparse_csrsv_solve_i64(rocsparse_handle          handle,
+                                           rocsparse_operation       trans,
+                                           int32_t                   m,
+                                           int64_t                   nnz,
+                                           const T*                  alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const T*                  csr_val,
+                                           const int64_t*            csr_row_ptr,
+                                           const int32_t*            csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           const T*                  x,
+                                           T*                        y,
+                                           rocsparse_solve_policy    policy,
+                                           void*                     temp_buffer);
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrsv_solve_mixed(rocsparse_handle          handle,
+                                             rocsparse_operation       trans,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const T*                  alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const U*                  csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             const T*                  x,
+                                             T*                        y,
+                                             rocsparse_solve_policy    policy,
+                                             void*                     temp_buffer);
+
+template <typename T>
+rocsparse_status rocsparse_csrsv_strided_batched_buffer_size(rocsparse_handle          handle,
+                                                             rocsparse_operation       trans,
+                                                             rocsparse_int             m,
+                                                             rocsparse_int             nnz,
+                                                             const rocsparse_mat_descr descr,
+                                                             const T*                  csr_val,
+                                                             const rocsparse_int*      csr_row_ptr,
+                                                             const rocsparse_int*      csr_col_ind,
+                                                             rocsparse_mat_info        info,
+                                                             rocsparse_int             batch_count,
+                                                             size_t*                   buffer_size);
+
+template <typename T>
+rocsparse_status rocsparse_csrsv_solve_strided_batched(rocsparse_handle          handle,
+                                                       rocsparse_operation       trans,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             nnz,
+                                                       const T*                  alpha,
+                                                       const rocsparse_mat_descr descr,
+                                                       const T*                  csr_val,
+                                                       rocsparse_int             stride_val,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       rocsparse_mat_info        info,
+                                                       const T*                  x,
+                                                       rocsparse_int             stride_x,
+                                                       T*                        y,
+                                                       rocsparse_int             stride_y,
+                                                       rocsparse_int             batch_count,
+                                                       rocsparse_solve_policy    policy,
+                                                       void*                     temp_buffer);
+
+// diamv
+template <typename T>
+rocsparse_status rocsparse_diamv(rocsparse_handle          handle,
+                                 rocsparse_operation       trans,
+                                 rocsparse_int             m,
+                                 rocsparse_int             n,
+                                 const T*                  alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const T*                  dia_val,
+                                 const rocsparse_int*      dia_offset,
+                                 rocsparse_int             dia_num_diag,
+                                 const T*                  x,
+                                 const T*                  beta,
+                                 T*                        y);
+
 // ellmv
 template <typename T>
 rocsparse_status rocsparse_ellmv(rocsparse_handle          handle,
@@ -286,6 +584,36 @@ rocsparse_status rocsparse_ellmv(rocsparse_handle          handle,
                                  const T*                  beta,
                                  T*                        y);
 
+template <typename T, typename U>
+rocsparse_status rocsparse_ellmv_mixed(rocsparse_handle          handle,
+                                       rocsparse_operation       trans,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       const T*                  alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const U*                  ell_val,
+                                       const rocsparse_int*      ell_col_ind,
+                                       rocsparse_int             ell_width,
+                                       const T*                  x,
+                                       const T*                  beta,
+                                       T*                        y);
+
+template <typename T>
+rocsparse_status rocsparse_ellmv_dot(rocsparse_handle          handle,
+                                     rocsparse_operation       trans,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     const T*                  alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const T*                  ell_val,
+                                     const rocsparse_int*      ell_col_ind,
+                                     rocsparse_int             ell_width,
+                                     const T*                  x,
+                                     const T*                  beta,
+                                     T*                        y,
+                                     T*                        dot_xy,
+                                     T*                        dot_yy);
+
 // hybmv
 template <typename T>
 rocsparse_status rocsparse_hybmv(rocsparse_handle          handle,
@@ -297,6 +625,46 @@ rocsparse_status rocsparse_hybmv(rocsparse_handle          handle,
                                  const T*                  beta,
                                  T*                        y);
 
+// vbrmv
+template <typename T>
+rocsparse_status rocsparse_vbrmv(rocsparse_handle          handle,
+                                 rocsparse_direction       dir,
+                                 rocsparse_operation       trans,
+                                 rocsparse_int             mb,
+                                 rocsparse_int             nb,
+                                 rocsparse_int             nnzb,
+                                 const T*                  alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const T*                  vbr_val,
+                                 const rocsparse_int*      vbr_val_ptr,
+                                 const rocsparse_int*      vbr_row_ptr,
+                                 const rocsparse_int*      vbr_col_ind,
+                                 const rocsparse_int*      vbr_row_ptn,
+                                 const rocsparse_int*      vbr_col_ptn,
+                                 const T*                  x,
+                                 const T*                  beta,
+                                 T*                        y);
+
+// csrdcmv
+template <typename T>
+rocsparse_status rocsparse_csrdcmv(rocsparse_handle          handle,
+                                   rocsparse_operation       trans,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             nnz,
+                                   const T*                  alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const T*                  csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   rocsparse_int             delta_bits,
+                                   const rocsparse_int*      csrdc_col_base,
+                                   const void*               csrdc_delta,
+                                   const rocsparse_int*      csrdc_exc_ptr,
+                                   const rocsparse_int*      csrdc_exc_col,
+                                   const T*                  x,
+                                   const T*                  beta,
+                                   T*                        y);
+
 /*
  * ===========================================================================
  *    level 3 SPARSE
@@ -324,6 +692,45 @@ rocsparse_status rocsparse_bsrmm(rocsparse_handle          handle,
                                  T*                        C,
                                  rocsparse_int             ldc);
 
+// bsrmm_ex
+template <typename T>
+rocsparse_status rocsparse_bsrmm_ex_analysis(rocsparse_handle          handle,
+                                             rocsparse_direction       dir,
+                                             rocsparse_operation       trans_A,
+                                             rocsparse_int             mb,
+                                             rocsparse_int             kb,
+                                             rocsparse_int             nnzb,
+                                             const rocsparse_mat_descr descr,
+                                             const T*                  bsr_val,
+                                             const rocsparse_int*      bsr_row_ptr,
+                                             const rocsparse_int*      bsr_col_ind,
+                                             rocsparse_int             block_dim,
+                                             rocsparse_mat_info        info);
+
+template <typename T>
+rocsparse_status rocsparse_bsrmm_ex(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_operation       trans_A,
+                                    rocsparse_operation       trans_B,
+                                    rocsparse_order           order_B,
+                                    rocsparse_order           order_C,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             n,
+                                    rocsparse_int             kb,
+                                    rocsparse_int             nnzb,
+                                    const T*                  alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const T*                  bsr_val,
+                                    const rocsparse_int*      bsr_row_ptr,
+                                    const rocsparse_int*      bsr_col_ind,
+                                    rocsparse_int             block_dim,
+                                    rocsparse_mat_info        info,
+                                    const T*                  B,
+                                    rocsparse_int             ldb,
+                                    const T*                  beta,
+                                    T*                        C,
+                                    rocsparse_int             ldc);
+
 // csrmm
 template <typename T>
 rocsparse_status rocsparse_csrmm(rocsparse_handle          handle,
@@ -344,6 +751,60 @@ rocsparse_status rocsparse_csrmm(rocsparse_handle          handle,
                                  T*                        C,
                                  rocsparse_int             ldc);
 
+template <typename T, typename U>
+rocsparse_status rocsparse_csrmm_mixed(rocsparse_handle          handle,
+                                       rocsparse_operation       trans_A,
+                                       rocsparse_operation       trans_B,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       rocsparse_int             k,
+                                       rocsparse_int             nnz,
+                                       const T*                  alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const U*                  csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       const T*                  B,
+                                       rocsparse_int             ldb,
+                                       const T*                  beta,
+                                       T*                        C,
+                                       rocsparse_int             ldc);
+
+// csrmm_ex
+template <typename T>
+rocsparse_status rocsparse_csrmm_ex_analysis(rocsparse_handle          handle,
+                                             rocsparse_operation       trans_A,
+                                             rocsparse_int             m,
+                                             rocsparse_int             k,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const T*                  csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info);
+
+template <typename T>
+rocsparse_status rocsparse_csrmm_ex(rocsparse_handle          handle,
+                                    rocsparse_operation       trans_A,
+                                    rocsparse_operation       trans_B,
+                                    rocsparse_order           order_B,
+                                    rocsparse_order           order_C,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             k,
+                                    rocsparse_int             nnz,
+                                    const T*                  alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const T*                  csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    const T*                  B,
+                                    rocsparse_int             ldb,
+                                    const T*                  beta,
+                                    T*                        C,
+                                    rocsparse_int             ldc);
+
 // csrsm
 template <typename T>
 rocsparse_status rocsparse_csrsm_buffer_size(rocsparse_handle          handle,
@@ -400,6 +861,123 @@ rocsparse_status rocsparse_csrsm_solve(rocsparse_handle          handle,
                                        rocsparse_solve_policy    policy,
                                        void*                     temp_buffer);
 
+template <typename T, typename U>
+rocsparse_status rocsparse_csrsm_buffer_size_mixed(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_B,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nrhs,
+                                                   rocsparse_int             nnz,
+                                                   const T*                  alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const U*                  csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   const T*                  B,
+                                                   rocsparse_int             ldb,
+                                                   rocsparse_mat_info        info,
+                                                   rocsparse_solve_policy    policy,
+                                                   size_t*                   buffer_size);
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrsm_analysis_mixed(rocsparse_handle          handle,
+                                                rocsparse_operation       trans_A,
+                                                rocsparse_operation       trans_B,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nrhs,
+                                                rocsparse_int             nnz,
+                                                const T*                  alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const U*                  csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                const T*                  B,
+                                                rocsparse_int             ldb,
+                                                rocsparse_mat_info        info,
+                                                rocsparse_analysis_policy analysis,
+                                                rocsparse_solve_policy    solve,
+                                                void*                     temp_buffer);
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrsm_solve_mixed(rocsparse_handle          handle,
+                                             rocsparse_operation       trans_A,
+                                             rocsparse_operation       trans_B,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nrhs,
+                                             rocsparse_int             nnz,
+                                             const T*                  alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const U*                  csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             T*                        B,
+                                             rocsparse_int             ldb,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_solve_policy    policy,
+                                             void*                     temp_buffer);
+
+// bsrsm
+template <typename T>
+rocsparse_status rocsparse_bsrsm_buffer_size(rocsparse_handle          handle,
+                                             rocsparse_direction       dir,
+                                             rocsparse_operation       trans_A,
+                                             rocsparse_operation       trans_B,
+                                             rocsparse_int             mb,
+                                             rocsparse_int             nrhs,
+                                             rocsparse_int             nnzb,
+                                             const T*                  alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const T*                  bsr_val,
+                                             const rocsparse_int*      bsr_row_ptr,
+                                             const rocsparse_int*      bsr_col_ind,
+                                             rocsparse_int             block_dim,
+                                             const T*                  B,
+                                             rocsparse_int             ldb,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_solve_policy    policy,
+                                             size_t*                   buffer_size);
+
+template <typename T>
+rocsparse_status rocsparse_bsrsm_analysis(rocsparse_handle          handle,
+                                          rocsparse_direction       dir,
+                                          rocsparse_operation       trans_A,
+                                          rocsparse_operation       trans_B,
+                                          rocsparse_int             mb,
+                                          rocsparse_int             nrhs,
+                                          rocsparse_int             nnzb,
+                                          const T*                  alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const T*                  bsr_val,
+                                          const rocsparse_int*      bsr_row_ptr,
+                                          const rocsparse_int*      bsr_col_ind,
+                                          rocsparse_int             block_dim,
+                                          const T*                  B,
+                                          rocsparse_int             ldb,
+                                          rocsparse_mat_info        info,
+                                          rocsparse_analysis_policy analysis,
+                                          rocsparse_solve_policy    solve,
+                                          void*                     temp_buffer);
+
+template <typename T>
+rocsparse_status rocsparse_bsrsm_solve(rocsparse_handle          handle,
+                                       rocsparse_direction       dir,
+                                       rocsparse_operation       trans_A,
+                                       rocsparse_operation       trans_B,
+                                       rocsparse_int             mb,
+                                       rocsparse_int             nrhs,
+                                       rocsparse_int             nnzb,
+                                       const T*                  alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const T*                  bsr_val,
+                                       const rocsparse_int*      bsr_row_ptr,
+                                       const rocsparse_int*      bsr_col_ind,
+                                       rocsparse_int             block_dim,
+                                       T*                        B,
+                                       rocsparse_int             ldb,
+                                       rocsparse_mat_info        info,
+                                       rocsparse_solve_policy    policy,
+                                       void*                     temp_buffer);
+
 // gemmi
 template <typename T>
 rocsparse_status rocsparse_gemmi(rocsparse_handle          handle,
@@ -420,6 +998,46 @@ rocsparse_status rocsparse_gemmi(rocsparse_handle          handle,
                                  T*                        C,
                                  rocsparse_int             ldc);
 
+// csrsddmm
+template <typename T>
+rocsparse_status rocsparse_csrsddmm(rocsparse_handle          handle,
+                                    rocsparse_order           order_A,
+                                    rocsparse_order           order_B,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             k,
+                                    const T*                  alpha,
+                                    const T*                  A,
+                                    rocsparse_int             lda,
+                                    const T*                  B,
+                                    rocsparse_int             ldb,
+                                    const T*                  beta,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_int             nnz,
+                                    T*                        csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind);
+
+// coosddmm
+template <typename T>
+rocsparse_status rocsparse_coosddmm(rocsparse_handle          handle,
+                                    rocsparse_order           order_A,
+                                    rocsparse_order           order_B,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             k,
+                                    const T*                  alpha,
+                                    const T*                  A,
+                                    rocsparse_int             lda,
+                                    const T*                  B,
+                                    rocsparse_int             ldb,
+                                    const T*                  beta,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_int             nnz,
+                                    T*                        coo_val,
+                                    const rocsparse_int*      coo_row_ind,
+                                    const rocsparse_int*      coo_col_ind);
+
 /*
  * ===========================================================================
  *    extra SPARSE
@@ -472,6 +1090,30 @@ rocsparse_status rocsparse_csrgemm_buffer_size(rocsparse_handle          handle,
                                                rocsparse_mat_info        info_C,
                                                size_t*                   buffer_size);
 
+template <typename T>
+rocsparse_status rocsparse_csrgemm_buffer_size_i64(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_B,
+                                                   int32_t                   m,
+                                                   int32_t                   n,
+                                                   int32_t                   k,
+                                                   const T*                  alpha,
+                                                   const rocsparse_mat_descr descr_A,
+                                                   int64_t                   nnz_A,
+                                                   const int64_t*            csr_row_ptr_A,
+                                                   const int32_t*            csr_col_ind_A,
+                                                   const rocsparse_mat_descr descr_B,
+                                                   int64_t                   nnz_B,
+                                                   const int64_t*            csr_row_ptr_B,
+                                                   const int32_t*            csr_col_ind_B,
+                                                   const T*                  beta,
+                                                   const rocsparse_mat_descr descr_D,
+                                                   int64_t                   nnz_D,
+                                                   const int64_t*            csr_row_ptr_D,
+                                                   const int32_t*            csr_col_ind_D,
+                                                   rocsparse_mat_info        info_C,
+                                                   size_t*                   buffer_size);
+
 template <typename T>
 rocsparse_status rocsparse_csrgemm(rocsparse_handle          handle,
                                    rocsparse_operation       trans_A,
@@ -503,6 +1145,65 @@ rocsparse_status rocsparse_csrgemm(rocsparse_handle          handle,
                                    const rocsparse_mat_info  info_C,
                                    void*                     temp_buffer);
 
+template <typename T>
+rocsparse_status rocsparse_csrgemm_i64(rocsparse_handle          handle,
+                                       rocsparse_operation       trans_A,
+                                       rocsparse_operation       trans_B,
+                                       int32_t                   m,
+                                       int32_t                   n,
+                                       int32_t                   k,
+                                       const T*                  alpha,
+                                       const rocsparse_mat_descr descr_A,
+                                       int64_t                   nnz_A,
+                                       const T*                  csr_val_A,
+                                       const int64_t*            csr_row_ptr_A,
+                                       const int32_t*            csr_col_ind_A,
+                                       const rocsparse_mat_descr descr_B,
+                                       int64_t                   nnz_B,
+                                       const T*                  csr_val_B,
+                                       const int64_t*            csr_row_ptr_B,
+                                       const int32_t*            csr_col_ind_B,
+                                       const T*                  beta,
+                                       const rocsparse_mat_descr descr_D,
+                                       int64_t                   nnz_D,
+                                       const T*                  csr_val_D,
+                                       const int64_t*            csr_row_ptr_D,
+                                       const int32_t*            csr_col_ind_D,
+                                       const rocsparse_mat_descr descr_C,
+                                       T*                        csr_val_C,
+                                       const int64_t*            csr_row_ptr_C,
+                                       int32_t*                  csr_col_ind_C,
+                                       const rocsparse_mat_info  info_C,
+                                       void*                     temp_buffer);
+
+// csrrap
+template <typename T>
+rocsparse_status rocsparse_csrrap(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_R,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  const rocsparse_mat_descr descr_R,
+                                  rocsparse_int             nnz_R,
+                                  const T*                  csr_val_R,
+                                  const rocsparse_int*      csr_row_ptr_R,
+                                  const rocsparse_int*      csr_col_ind_R,
+                                  const rocsparse_mat_descr descr_A,
+                                  rocsparse_int             nnz_A,
+                                  const T*                  csr_val_A,
+                                  const rocsparse_int*      csr_row_ptr_A,
+                                  const rocsparse_int*      csr_col_ind_A,
+                                  const rocsparse_mat_descr descr_P,
+                                  rocsparse_int             nnz_P,
+                                  const T*                  csr_val_P,
+                                  const rocsparse_int*      csr_row_ptr_P,
+                                  const rocsparse_int*      csr_col_ind_P,
+                                  const rocsparse_mat_descr descr_C,
+                                  T*                        csr_val_C,
+                                  const rocsparse_int*      csr_row_ptr_C,
+                                  rocsparse_int*            csr_col_ind_C,
+                                  const rocsparse_mat_info  info_C);
+
 /*
  * ===========================================================================
  *    precond SPARSE
@@ -551,6 +1252,49 @@ rocsparse_status rocsparse_bsric0(rocsparse_handle          handle,
                                   rocsparse_solve_policy    policy,
                                   void*                     temp_buffer);
 
+// bsrilu0
+template <typename T>
+rocsparse_status rocsparse_bsrilu0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_direction       dir,
+                                               rocsparse_int             mb,
+                                               rocsparse_int             nnzb,
+                                               const rocsparse_mat_descr descr,
+                                               const T*                  bsr_val,
+                                               const rocsparse_int*      bsr_row_ptr,
+                                               const rocsparse_int*      bsr_col_ind,
+                                               rocsparse_int             block_dim,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size);
+
+template <typename T>
+rocsparse_status rocsparse_bsrilu0_analysis(rocsparse_handle          handle,
+                                            rocsparse_direction       dir,
+                                            rocsparse_int             mb,
+                                            rocsparse_int             nnzb,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  bsr_val,
+                                            const rocsparse_int*      bsr_row_ptr,
+                                            const rocsparse_int*      bsr_col_ind,
+                                            rocsparse_int             block_dim,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer);
+
+template <typename T>
+rocsparse_status rocsparse_bsrilu0(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nnzb,
+                                   const rocsparse_mat_descr descr,
+                                   T*                        bsr_val,
+                                   const rocsparse_int*      bsr_row_ptr,
+                                   const rocsparse_int*      bsr_col_ind,
+                                   rocsparse_int             block_dim,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+
 // csric0
 template <typename T>
 rocsparse_status rocsparse_csric0_buffer_size(rocsparse_handle          handle,
@@ -588,6 +1332,19 @@ rocsparse_status rocsparse_csric0(rocsparse_handle          handle,
                                   rocsparse_solve_policy    policy,
                                   void*                     temp_buffer);
 
+template <typename T, typename U>
+rocsparse_status rocsparse_csric0_mixed(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nnz,
+                                        const rocsparse_mat_descr descr,
+                                        const T*                  csr_val,
+                                        U*                        ic_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_mat_info        info,
+                                        rocsparse_solve_policy    policy,
+                                        void*                     temp_buffer);
+
 // csrilu0
 template <typename T>
 rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle          handle,
@@ -625,6 +1382,46 @@ rocsparse_status rocsparse_csrilu0(rocsparse_handle          handle,
                                    rocsparse_solve_policy    policy,
                                    void*                     temp_buffer);
 
+template <typename T, typename U>
+rocsparse_status rocsparse_csrilu0_mixed(rocsparse_handle          handle,
+                                         rocsparse_int             m,
+                                         rocsparse_int             nnz,
+                                         const rocsparse_mat_descr descr,
+                                         const T*                  csr_val,
+                                         U*                        ilu_val,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         rocsparse_mat_info        info,
+                                         rocsparse_solve_policy    policy,
+                                         void*                     temp_buffer);
+
+template <typename T>
+rocsparse_status
+    rocsparse_csrilu0_strided_batched_buffer_size(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const T*                  csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_mat_info        info,
+                                                  rocsparse_int             batch_count,
+                                                  size_t*                   buffer_size);
+
+template <typename T>
+rocsparse_status rocsparse_csrilu0_strided_batched(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   T*                        csr_val,
+                                                   rocsparse_int             stride_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_mat_info        info,
+                                                   rocsparse_int             batch_count,
+                                                   rocsparse_solve_policy    policy,
+                                                   void*                     temp_buffer);
+
 /*
  * ===========================================================================
  *    conversion SPARSE
@@ -720,6 +1517,21 @@ rocsparse_status rocsparse_csr2csc(rocsparse_handle     handle,
                                    rocsparse_index_base idx_base,
                                    void*                temp_buffer);
 
+template <typename T>
+rocsparse_status rocsparse_csr2csc_i64(rocsparse_handle     handle,
+                                       int32_t              m,
+                                       int32_t              n,
+                                       int64_t              nnz,
+                                       const T*             csr_val,
+                                       const int64_t*       csr_row_ptr,
+                                       const int32_t*       csr_col_ind,
+                                       T*                   csc_val,
+                                       int32_t*             csc_row_ind,
+                                       int64_t*             csc_col_ptr,
+                                       rocsparse_action     copy_values,
+                                       rocsparse_index_base idx_base,
+                                       void*                temp_buffer);
+
 // csr2ell
 template <typename T>
 rocsparse_status rocsparse_csr2ell(rocsparse_handle          handle,
@@ -733,6 +1545,19 @@ rocsparse_status rocsparse_csr2ell(rocsparse_handle          handle,
                                    T*                        ell_val,
                                    rocsparse_int*            ell_col_ind);
 
+// csr2dia
+template <typename T>
+rocsparse_status rocsparse_csr2dia(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   const rocsparse_mat_descr csr_descr,
+                                   const T*                  csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_int             dia_num_diag,
+                                   T*                        dia_val,
+                                   rocsparse_int*            dia_offset);
+
 // csr2hyb
 template <typename T>
 rocsparse_status rocsparse_csr2hyb(rocsparse_handle          handle,
@@ -746,6 +1571,15 @@ rocsparse_status rocsparse_csr2hyb(rocsparse_handle          handle,
                                    rocsparse_int             user_ell_width,
                                    rocsparse_hyb_partition   partition_type);
 
+// csr2hyb_ell_width_analysis
+template <typename T>
+rocsparse_status rocsparse_csr2hyb_ell_width_analysis(rocsparse_handle          handle,
+                                                      rocsparse_int             m,
+                                                      const rocsparse_mat_descr descr,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      rocsparse_int*            ell_width,
+                                                      rocsparse_int*            row_nnz_hist);
+
 // csr2bsr
 template <typename T>
 rocsparse_status rocsparse_csr2bsr(rocsparse_handle          handle,
@@ -762,6 +1596,41 @@ rocsparse_status rocsparse_csr2bsr(rocsparse_handle          handle,
                                    rocsparse_int*            bsr_row_ptr,
                                    rocsparse_int*            bsr_col_ind);
 
+// csr2bsr_block_dim_analysis
+template <typename T>
+rocsparse_status rocsparse_csr2bsr_block_dim_analysis(rocsparse_handle          handle,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             n,
+                                                      const rocsparse_mat_descr csr_descr,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      const rocsparse_int*      csr_col_ind,
+                                                      rocsparse_int             num_block_dims,
+                                                      const rocsparse_int*      block_dims,
+                                                      rocsparse_int             sample_size,
+                                                      rocsparse_int*            bsr_nnzb,
+                                                      float*                    fill_ratio,
+                                                      float*                    bsrmv_cost);
+
+// csr2vbr
+template <typename T>
+rocsparse_status rocsparse_csr2vbr(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   const rocsparse_mat_descr csr_descr,
+                                   const T*                  csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nb,
+                                   const rocsparse_mat_descr vbr_descr,
+                                   T*                        vbr_val,
+                                   rocsparse_int*            vbr_val_ptr,
+                                   rocsparse_int*            vbr_row_ptr,
+                                   rocsparse_int*            vbr_col_ind,
+                                   const rocsparse_int*      vbr_row_ptn,
+                                   const rocsparse_int*      vbr_col_ptn);
+
 // ell2csr
 template <typename T>
 rocsparse_status rocsparse_ell2csr(rocsparse_handle          handle,
@@ -776,6 +1645,19 @@ rocsparse_status rocsparse_ell2csr(rocsparse_handle          handle,
                                    const rocsparse_int*      csr_row_ptr,
                                    rocsparse_int*            csr_col_ind);
 
+// dia2csr
+template <typename T>
+rocsparse_status rocsparse_dia2csr(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             dia_num_diag,
+                                   const T*                  dia_val,
+                                   const rocsparse_int*      dia_offset,
+                                   const rocsparse_mat_descr csr_descr,
+                                   T*                        csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   rocsparse_int*            csr_col_ind);
+
 // hyb2csr
 template <typename T>
 rocsparse_status rocsparse_hyb2csr(rocsparse_handle          handle,
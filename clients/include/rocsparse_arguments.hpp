@@ -47,6 +47,8 @@ struct Arguments
     rocsparse_int K;
     rocsparse_int nnz;
     rocsparse_int block_dim;
+    rocsparse_int batch_count;
+    rocsparse_int delta_bits;
 
     rocsparse_int dimx;
     rocsparse_int dimy;
@@ -72,12 +74,17 @@ struct Arguments
     rocsparse_analysis_policy apol;
     rocsparse_solve_policy    spol;
     rocsparse_direction       direction;
+    rocsparse_order           orderA;
+    rocsparse_order           orderB;
+    rocsparse_order           orderC;
+    rocsparse_matrix_type     matrix_type;
 
     rocsparse_matrix_init matrix;
 
     rocsparse_int unit_check;
     rocsparse_int timing;
     rocsparse_int iters;
+    rocsparse_int memstat;
 
     rocsparse_int denseld;
 
@@ -130,6 +137,8 @@ struct Arguments
         ROCSPARSE_FORMAT_CHECK(K);
         ROCSPARSE_FORMAT_CHECK(nnz);
         ROCSPARSE_FORMAT_CHECK(block_dim);
+        ROCSPARSE_FORMAT_CHECK(batch_count);
+        ROCSPARSE_FORMAT_CHECK(delta_bits);
         ROCSPARSE_FORMAT_CHECK(dimx);
         ROCSPARSE_FORMAT_CHECK(dimy);
         ROCSPARSE_FORMAT_CHECK(dimz);
@@ -151,10 +160,15 @@ struct Arguments
         ROCSPARSE_FORMAT_CHECK(apol);
         ROCSPARSE_FORMAT_CHECK(spol);
         ROCSPARSE_FORMAT_CHECK(direction);
+        ROCSPARSE_FORMAT_CHECK(orderA);
+        ROCSPARSE_FORMAT_CHECK(orderB);
+        ROCSPARSE_FORMAT_CHECK(orderC);
+        ROCSPARSE_FORMAT_CHECK(matrix_type);
         ROCSPARSE_FORMAT_CHECK(matrix);
         ROCSPARSE_FORMAT_CHECK(unit_check);
         ROCSPARSE_FORMAT_CHECK(timing);
         ROCSPARSE_FORMAT_CHECK(iters);
+        ROCSPARSE_FORMAT_CHECK(memstat);
         ROCSPARSE_FORMAT_CHECK(denseld);
         ROCSPARSE_FORMAT_CHECK(algo);
         ROCSPARSE_FORMAT_CHECK(filename);
@@ -277,6 +291,8 @@ private:
         print("K", arg.K);
         print("nnz", arg.nnz);
         print("block_dim", arg.block_dim);
+        print("batch_count", arg.batch_count);
+        print("delta_bits", arg.delta_bits);
         print("dim_x", arg.dimx);
         print("dim_y", arg.dimy);
         print("dim_z", arg.dimz);
@@ -291,6 +307,10 @@ private:
         print("analysis_policy", rocsparse_analysis2string(arg.apol));
         print("solve_policy", rocsparse_solve2string(arg.spol));
         print("direction", rocsparse_direction2string(arg.direction));
+        print("orderA", rocsparse_order2string(arg.orderA));
+        print("orderB", rocsparse_order2string(arg.orderB));
+        print("orderC", rocsparse_order2string(arg.orderC));
+        print("matrix_type", rocsparse_matrixtype2string(arg.matrix_type));
         print("matrix", rocsparse_matrix2string(arg.matrix));
         print("file", arg.filename);
         print("algo", arg.algo);
@@ -299,6 +319,7 @@ private:
         print("unit_check", arg.unit_check);
         print("timing", arg.timing);
         print("iters", arg.iters);
+        print("memstat", arg.memstat);
         print("denseld", arg.denseld);
         return str << " }\n";
     }
@@ -127,7 +127,14 @@ inline void unit_check_general(rocsparse_int             M,
 
 template <>
 inline void unit_check_general(
-    rocsparse_int M, rocsparse_int N, rocsparse_int lda, rocsparse_int* hCPU, rocsparse_int* hGPU)
+    rocsparse_int M, rocsparse_int N, rocsparse_int lda, int32_t* hCPU, int32_t* hGPU)
+{
+    UNIT_CHECK(M, N, lda, hCPU, hGPU, ASSERT_EQ);
+}
+
+template <>
+inline void unit_check_general(
+    rocsparse_int M, rocsparse_int N, rocsparse_int lda, int64_t* hCPU, int64_t* hGPU)
 {
     UNIT_CHECK(M, N, lda, hCPU, hGPU, ASSERT_EQ);
 }
@@ -139,6 +146,13 @@ inline void unit_check_general(
     UNIT_CHECK(M, N, lda, hCPU, hGPU, ASSERT_EQ);
 }
 
+template <>
+inline void unit_check_general(
+    rocsparse_int M, rocsparse_int N, rocsparse_int lda, uint8_t* hCPU, uint8_t* hGPU)
+{
+    UNIT_CHECK(M, N, lda, hCPU, hGPU, ASSERT_EQ);
+}
+
 template <typename T>
 void near_check_general(rocsparse_int M, rocsparse_int N, rocsparse_int lda, T* hCPU, T* hGPU);
 
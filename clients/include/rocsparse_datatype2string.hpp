@@ -29,10 +29,12 @@
 
 typedef enum rocsparse_datatype_
 {
-    rocsparse_datatype_f32_r = 151, /**< 32 bit floating point, real */
-    rocsparse_datatype_f64_r = 152, /**< 64 bit floating point, real */
-    rocsparse_datatype_f32_c = 154, /**< 32 bit floating point, complex real */
-    rocsparse_datatype_f64_c = 155 /**< 64 bit floating point, complex real */
+    rocsparse_datatype_f16_r  = 150, /**< 16 bit floating point, real */
+    rocsparse_datatype_f32_r  = 151, /**< 32 bit floating point, real */
+    rocsparse_datatype_f64_r  = 152, /**< 64 bit floating point, real */
+    rocsparse_datatype_f32_c  = 154, /**< 32 bit floating point, complex real */
+    rocsparse_datatype_f64_c  = 155, /**< 64 bit floating point, complex real */
+    rocsparse_datatype_bf16_r = 168 /**< 16 bit bfloat16 floating point, real */
 } rocsparse_datatype;
 
 typedef enum rocsparse_matrix_init_
@@ -41,7 +43,11 @@ typedef enum rocsparse_matrix_init_
     rocsparse_matrix_laplace_2d      = 1, /**< Initialize 2D laplacian matrix */
     rocsparse_matrix_laplace_3d      = 2, /**< Initialize 3D laplacian matrix */
     rocsparse_matrix_file_mtx        = 3, /**< Read from .mtx (matrix market) file */
-    rocsparse_matrix_file_rocalution = 4 /**< Read from .csr (rocALUTION) file */
+    rocsparse_matrix_file_rocalution = 4, /**< Read from .csr (rocALUTION) file */
+    rocsparse_matrix_rmat            = 5, /**< Initialize R-MAT power-law matrix */
+    rocsparse_matrix_banded          = 6, /**< Initialize variable bandwidth matrix */
+    rocsparse_matrix_block           = 7, /**< Initialize matrix with dense sub-blocks */
+    rocsparse_matrix_fem_3d          = 8 /**< Initialize 3D tetrahedral mesh like matrix */
 } rocsparse_matrix_init;
 
 constexpr auto rocsparse_matrix2string(rocsparse_matrix_init matrix)
@@ -58,6 +64,14 @@ constexpr auto rocsparse_matrix2string(rocsparse_matrix_init matrix)
         return "mtx";
     case rocsparse_matrix_file_rocalution:
         return "csr";
+    case rocsparse_matrix_rmat:
+        return "rmat";
+    case rocsparse_matrix_banded:
+        return "band";
+    case rocsparse_matrix_block:
+        return "block";
+    case rocsparse_matrix_fem_3d:
+        return "FEM3D";
     default:
         return "invalid";
     }
@@ -67,6 +81,10 @@ constexpr auto rocsparse_datatype2string(rocsparse_datatype type)
 {
     switch(type)
     {
+    case rocsparse_datatype_f16_r:
+        return "f16_r";
+    case rocsparse_datatype_bf16_r:
+        return "bf16_r";
     case rocsparse_datatype_f32_r:
         return "f32_r";
     case rocsparse_datatype_f64_r:
@@ -199,4 +217,34 @@ constexpr auto rocsparse_direction2string(rocsparse_direction direction)
     }
 }
 
+constexpr auto rocsparse_order2string(rocsparse_order order)
+{
+    switch(order)
+    {
+    case rocsparse_order_row:
+        return "row";
+    case rocsparse_order_column:
+        return "column";
+    default:
+        return "invalid";
+    }
+}
+
+constexpr auto rocsparse_matrixtype2string(rocsparse_matrix_type type)
+{
+    switch(type)
+    {
+    case rocsparse_matrix_type_general:
+        return "general";
+    case rocsparse_matrix_type_symmetric:
+        return "symmetric";
+    case rocsparse_matrix_type_hermitian:
+        return "hermitian";
+    case rocsparse_matrix_type_triangular:
+        return "triangular";
+    default:
+        return "invalid";
+    }
+}
+
 #endif // ROCSPARSE_DATATYPE2STRING_HPP
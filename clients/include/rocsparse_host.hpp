@@ -39,18 +39,18 @@
 #endif
 
 // Forward declaration
-template <typename T>
-inline void host_csr_to_csc(rocsparse_int                     M,
-                            rocsparse_int                     N,
-                            rocsparse_int                     nnz,
-                            const std::vector<rocsparse_int>& csr_row_ptr,
-                            const std::vector<rocsparse_int>& csr_col_ind,
-                            const std::vector<T>&             csr_val,
-                            std::vector<rocsparse_int>&       csc_row_ind,
-                            std::vector<rocsparse_int>&       csc_col_ptr,
-                            std::vector<T>&                   csc_val,
-                            rocsparse_action                  action,
-                            rocsparse_index_base              base);
+template <typename T, typename I, typename J>
+inline void host_csr_to_csc(J                     M,
+                            J                     N,
+                            I                     nnz,
+                            const std::vector<I>& csr_row_ptr,
+                            const std::vector<J>& csr_col_ind,
+                            const std::vector<T>& csr_val,
+                            std::vector<J>&       csc_row_ind,
+                            std::vector<I>&       csc_col_ptr,
+                            std::vector<T>&       csc_val,
+                            rocsparse_action      action,
+                            rocsparse_index_base  base);
 
 template <typename T>
 inline void host_bsr_to_bsc(rocsparse_int                     mb,
@@ -376,6 +376,98 @@ inline void host_bsrmv(rocsparse_direction  dir,
     }
 }
 
+template <typename T>
+inline void host_bsrmv_atomic(rocsparse_direction   dir,
+                              rocsparse_operation   trans,
+                              rocsparse_matrix_type type,
+                              rocsparse_fill_mode   fill_mode,
+                              rocsparse_int         mb,
+                              rocsparse_int         nb,
+                              T                     alpha,
+                              const rocsparse_int*  bsr_row_ptr,
+                              const rocsparse_int*  bsr_col_ind,
+                              const T*              bsr_val,
+                              rocsparse_int         bsr_dim,
+                              const T*              x,
+                              T                     beta,
+                              T*                    y,
+                              rocsparse_index_base  base)
+{
+    bool general = (type == rocsparse_matrix_type_general);
+    bool herm    = (type == rocsparse_matrix_type_hermitian);
+
+    // Symmetric and hermitian matrices satisfy op(A) = A or op(A) = conj(A)
+    bool conj_all = (type == rocsparse_matrix_type_symmetric
+                     && trans == rocsparse_operation_conjugate_transpose)
+                    || (herm && trans == rocsparse_operation_transpose);
+
+    // Scale y with beta
+    rocsparse_int ysize = ((general && trans != rocsparse_operation_none) ? nb : mb) * bsr_dim;
+
+    for(rocsparse_int i = 0; i < ysize; ++i)
+    {
+        y[i] = (beta != static_cast<T>(0)) ? beta * y[i] : static_cast<T>(0);
+    }
+
+    for(rocsparse_int row = 0; row < mb; ++row)
+    {
+        for(rocsparse_int j = bsr_row_ptr[row] - base; j < bsr_row_ptr[row + 1] - base; ++j)
+        {
+            rocsparse_int col = bsr_col_ind[j] - base;
+
+            // Skip blocks outside of the stored triangle
+            if(!general
+               && ((fill_mode == rocsparse_fill_mode_lower && col > row)
+                   || (fill_mode == rocsparse_fill_mode_upper && col < row)))
+            {
+                continue;
+            }
+
+            for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+            {
+                for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
+                {
+                    T val = (dir == rocsparse_direction_row)
+                                ? bsr_val[bsr_dim * bsr_dim * j + bsr_dim * bi + bj]
+                                : bsr_val[bsr_dim * bsr_dim * j + bsr_dim * bj + bi];
+
+                    rocsparse_int r = bsr_dim * row + bi;
+                    rocsparse_int c = bsr_dim * col + bj;
+
+                    if(general)
+                    {
+                        if(trans == rocsparse_operation_none)
+                        {
+                            y[r] += alpha * val * x[c];
+                        }
+                        else
+                        {
+                            T v = (trans == rocsparse_operation_conjugate_transpose)
+                                      ? rocsparse_conj(val)
+                                      : val;
+
+                            y[c] += alpha * v * x[r];
+                        }
+
+                        continue;
+                    }
+
+                    // Stored entry
+                    y[r] += alpha * (conj_all ? rocsparse_conj(val) : val) * x[c];
+
+                    // Mirrored entry of off-diagonal blocks
+                    if(col != row)
+                    {
+                        T v = (conj_all != herm) ? rocsparse_conj(val) : val;
+
+                        y[c] += alpha * v * x[r];
+                    }
+                }
+            }
+        }
+    }
+}
+
 template <typename T>
 static inline void host_bsr_lsolve(rocsparse_direction               dir,
                                    rocsparse_int                     mb,
@@ -702,12 +794,12 @@ inline void host_coomv(rocsparse_int        M,
     }
 }
 
-template <typename T>
-inline void host_csrmv(rocsparse_int        M,
-                       rocsparse_int        nnz,
+template <typename T, typename I, typename J>
+inline void host_csrmv(J                    M,
+                       I                    nnz,
                        T                    alpha,
-                       const rocsparse_int* csr_row_ptr,
-                       const rocsparse_int* csr_col_ind,
+                       const I*             csr_row_ptr,
+                       const J*             csr_col_ind,
                        const T*             csr_val,
                        const T*             x,
                        T                    beta,
@@ -725,7 +817,7 @@ inline void host_csrmv(rocsparse_int        M,
         hipGetDeviceProperties(&prop, dev);
 
         rocsparse_int WF_SIZE;
-        rocsparse_int nnz_per_row = nnz / M;
+        I             nnz_per_row = nnz / M;
 
         if(prop.warpSize == 32)
         {
@@ -763,14 +855,14 @@ inline void host_csrmv(rocsparse_int        M,
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-        for(rocsparse_int i = 0; i < M; ++i)
+        for(J i = 0; i < M; ++i)
         {
-            rocsparse_int row_begin = csr_row_ptr[i] - base;
-            rocsparse_int row_end   = csr_row_ptr[i + 1] - base;
+            I row_begin = csr_row_ptr[i] - base;
+            I row_end   = csr_row_ptr[i + 1] - base;
 
             std::vector<T> sum(WF_SIZE, static_cast<T>(0));
 
-            for(rocsparse_int j = row_begin; j < row_end; j += WF_SIZE)
+            for(I j = row_begin; j < row_end; j += WF_SIZE)
             {
                 for(rocsparse_int k = 0; k < WF_SIZE; ++k)
                 {
@@ -805,15 +897,15 @@ inline void host_csrmv(rocsparse_int        M,
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-        for(rocsparse_int i = 0; i < M; ++i)
+        for(J i = 0; i < M; ++i)
         {
             T sum = static_cast<T>(0);
             T err = static_cast<T>(0);
 
-            rocsparse_int row_begin = csr_row_ptr[i] - base;
-            rocsparse_int row_end   = csr_row_ptr[i + 1] - base;
+            I row_begin = csr_row_ptr[i] - base;
+            I row_end   = csr_row_ptr[i + 1] - base;
 
-            for(rocsparse_int j = row_begin; j < row_end; ++j)
+            for(I j = row_begin; j < row_end; ++j)
             {
                 T old  = sum;
                 T prod = alpha * csr_val[j] * x[csr_col_ind[j] - base];
@@ -835,17 +927,109 @@ inline void host_csrmv(rocsparse_int        M,
 }
 
 template <typename T>
-static inline void host_csr_lsolve(rocsparse_int                     M,
-                                   T                                 alpha,
-                                   const std::vector<rocsparse_int>& csr_row_ptr,
-                                   const std::vector<rocsparse_int>& csr_col_ind,
-                                   const std::vector<T>&             csr_val,
-                                   const std::vector<T>&             x,
-                                   std::vector<T>&                   y,
-                                   rocsparse_diag_type               diag_type,
-                                   rocsparse_index_base              base,
-                                   rocsparse_int*                    struct_pivot,
-                                   rocsparse_int*                    numeric_pivot)
+inline void host_csrmv_strided_batched(rocsparse_int        M,
+                                       rocsparse_int        nnz,
+                                       T                    alpha,
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       const T*             csr_val,
+                                       rocsparse_int        stride_val,
+                                       const T*             x,
+                                       rocsparse_int        stride_x,
+                                       T                    beta,
+                                       T*                   y,
+                                       rocsparse_int        stride_y,
+                                       rocsparse_int        batch_count,
+                                       rocsparse_index_base base)
+{
+    // Get device properties
+    int             dev;
+    hipDeviceProp_t prop;
+
+    hipGetDevice(&dev);
+    hipGetDeviceProperties(&prop, dev);
+
+    rocsparse_int WF_SIZE;
+    rocsparse_int nnz_per_row = (M > 0) ? nnz / M : 0;
+
+    if(nnz_per_row < 4)
+        WF_SIZE = 2;
+    else if(nnz_per_row < 8)
+        WF_SIZE = 4;
+    else if(nnz_per_row < 16)
+        WF_SIZE = 8;
+    else if(nnz_per_row < 32)
+        WF_SIZE = 16;
+    else if(nnz_per_row < 64)
+        WF_SIZE = 32;
+    else
+        WF_SIZE = 64;
+
+    WF_SIZE = std::min(WF_SIZE, prop.warpSize);
+
+    // Matrices of the batch are independent and processed in parallel
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+    for(rocsparse_int b = 0; b < batch_count; ++b)
+    {
+        const T* val_b = csr_val + static_cast<size_t>(stride_val) * b;
+        const T* x_b   = x + static_cast<size_t>(stride_x) * b;
+        T*       y_b   = y + static_cast<size_t>(stride_y) * b;
+
+        std::vector<T> sum(WF_SIZE);
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            rocsparse_int row_begin = csr_row_ptr[i] - base;
+            rocsparse_int row_end   = csr_row_ptr[i + 1] - base;
+
+            sum.assign(WF_SIZE, static_cast<T>(0));
+
+            for(rocsparse_int j = row_begin; j < row_end; j += WF_SIZE)
+            {
+                for(rocsparse_int k = 0; k < WF_SIZE; ++k)
+                {
+                    if(j + k < row_end)
+                    {
+                        sum[k] = std::fma(
+                            alpha * val_b[j + k], x_b[csr_col_ind[j + k] - base], sum[k]);
+                    }
+                }
+            }
+
+            for(rocsparse_int j = 1; j < WF_SIZE; j <<= 1)
+            {
+                for(rocsparse_int k = 0; k < WF_SIZE - j; ++k)
+                {
+                    sum[k] += sum[k + j];
+                }
+            }
+
+            if(beta == static_cast<T>(0))
+            {
+                y_b[i] = sum[0];
+            }
+            else
+            {
+                y_b[i] = std::fma(beta, y_b[i], sum[0]);
+            }
+        }
+    }
+}
+
+template <typename T, typename I, typename J>
+static inline void host_csr_lsolve(J                     M,
+                                   T                     alpha,
+                                   const std::vector<I>& csr_row_ptr,
+                                   const std::vector<J>& csr_col_ind,
+                                   const std::vector<T>& csr_val,
+                                   const std::vector<T>& x,
+                                   std::vector<T>&       y,
+                                   rocsparse_diag_type   diag_type,
+                                   rocsparse_index_base  base,
+                                   rocsparse_int*        struct_pivot,
+                                   rocsparse_int*        numeric_pivot)
 {
     // Get device properties
     int             dev;
@@ -857,22 +1041,22 @@ static inline void host_csr_lsolve(rocsparse_int                     M,
     std::vector<T> temp(prop.warpSize);
 
     // Process lower triangular part
-    for(rocsparse_int row = 0; row < M; ++row)
+    for(J row = 0; row < M; ++row)
     {
         temp.assign(prop.warpSize, static_cast<T>(0));
         temp[0] = alpha * x[row];
 
-        rocsparse_int diag      = -1;
-        rocsparse_int row_begin = csr_row_ptr[row] - base;
-        rocsparse_int row_end   = csr_row_ptr[row + 1] - base;
+        I diag      = -1;
+        I row_begin = csr_row_ptr[row] - base;
+        I row_end   = csr_row_ptr[row + 1] - base;
 
         T diag_val = static_cast<T>(0);
 
-        for(rocsparse_int l = row_begin; l < row_end; l += prop.warpSize)
+        for(I l = row_begin; l < row_end; l += prop.warpSize)
         {
             for(unsigned int k = 0; k < prop.warpSize; ++k)
             {
-                rocsparse_int j = l + k;
+                I j = l + k;
 
                 // Do not run out of bounds
                 if(j >= row_end)
@@ -880,8 +1064,8 @@ static inline void host_csr_lsolve(rocsparse_int                     M,
                     break;
                 }
 
-                rocsparse_int local_col = csr_col_ind[j] - base;
-                T             local_val = csr_val[j];
+                J local_col = csr_col_ind[j] - base;
+                T local_val = csr_val[j];
 
                 if(local_val == static_cast<T>(0) && local_col == row
                    && diag_type == rocsparse_diag_type_non_unit)
@@ -941,18 +1125,18 @@ static inline void host_csr_lsolve(rocsparse_int                     M,
     }
 }
 
-template <typename T>
-static inline void host_csr_usolve(rocsparse_int                     M,
-                                   T                                 alpha,
-                                   const std::vector<rocsparse_int>& csr_row_ptr,
-                                   const std::vector<rocsparse_int>& csr_col_ind,
-                                   const std::vector<T>&             csr_val,
-                                   const std::vector<T>&             x,
-                                   std::vector<T>&                   y,
-                                   rocsparse_diag_type               diag_type,
-                                   rocsparse_index_base              base,
-                                   rocsparse_int*                    struct_pivot,
-                                   rocsparse_int*                    numeric_pivot)
+template <typename T, typename I, typename J>
+static inline void host_csr_usolve(J                     M,
+                                   T                     alpha,
+                                   const std::vector<I>& csr_row_ptr,
+                                   const std::vector<J>& csr_col_ind,
+                                   const std::vector<T>& csr_val,
+                                   const std::vector<T>& x,
+                                   std::vector<T>&       y,
+                                   rocsparse_diag_type   diag_type,
+                                   rocsparse_index_base  base,
+                                   rocsparse_int*        struct_pivot,
+                                   rocsparse_int*        numeric_pivot)
 {
     // Get device properties
     int             dev;
@@ -964,22 +1148,22 @@ static inline void host_csr_usolve(rocsparse_int                     M,
     std::vector<T> temp(prop.warpSize);
 
     // Process upper triangular part
-    for(rocsparse_int row = M - 1; row >= 0; --row)
+    for(J row = M - 1; row >= 0; --row)
     {
         temp.assign(prop.warpSize, static_cast<T>(0));
         temp[0] = alpha * x[row];
 
-        rocsparse_int diag      = -1;
-        rocsparse_int row_begin = csr_row_ptr[row] - base;
-        rocsparse_int row_end   = csr_row_ptr[row + 1] - base;
+        I diag      = -1;
+        I row_begin = csr_row_ptr[row] - base;
+        I row_end   = csr_row_ptr[row + 1] - base;
 
         T diag_val = static_cast<T>(0);
 
-        for(rocsparse_int l = row_end - 1; l >= row_begin; l -= prop.warpSize)
+        for(I l = row_end - 1; l >= row_begin; l -= prop.warpSize)
         {
             for(unsigned int k = 0; k < prop.warpSize; ++k)
             {
-                rocsparse_int j = l - k;
+                I j = l - k;
 
                 // Do not run out of bounds
                 if(j < row_begin)
@@ -987,8 +1171,8 @@ static inline void host_csr_usolve(rocsparse_int                     M,
                     break;
                 }
 
-                rocsparse_int local_col = csr_col_ind[j] - base;
-                T             local_val = csr_val[j];
+                J local_col = csr_col_ind[j] - base;
+                T local_val = csr_val[j];
 
                 // Ignore all entries that are below the diagonal
                 if(local_col < row)
@@ -1044,21 +1228,21 @@ static inline void host_csr_usolve(rocsparse_int                     M,
     }
 }
 
-template <typename T>
-inline void host_csrsv(rocsparse_operation               trans,
-                       rocsparse_int                     M,
-                       rocsparse_int                     nnz,
-                       T                                 alpha,
-                       const std::vector<rocsparse_int>& csr_row_ptr,
-                       const std::vector<rocsparse_int>& csr_col_ind,
-                       const std::vector<T>&             csr_val,
-                       const std::vector<T>&             x,
-                       std::vector<T>&                   y,
-                       rocsparse_diag_type               diag_type,
-                       rocsparse_fill_mode               fill_mode,
-                       rocsparse_index_base              base,
-                       rocsparse_int*                    struct_pivot,
-                       rocsparse_int*                    numeric_pivot)
+template <typename T, typename I, typename J>
+inline void host_csrsv(rocsparse_operation   trans,
+                       J                     M,
+                       I                     nnz,
+                       T                     alpha,
+                       const std::vector<I>& csr_row_ptr,
+                       const std::vector<J>& csr_col_ind,
+                       const std::vector<T>& csr_val,
+                       const std::vector<T>& x,
+                       std::vector<T>&       y,
+                       rocsparse_diag_type   diag_type,
+                       rocsparse_fill_mode   fill_mode,
+                       rocsparse_index_base  base,
+                       rocsparse_int*        struct_pivot,
+                       rocsparse_int*        numeric_pivot)
 {
     // Initialize pivot
     *struct_pivot  = M + 1;
@@ -1098,9 +1282,9 @@ inline void host_csrsv(rocsparse_operation               trans,
     else if(trans == rocsparse_operation_transpose)
     {
         // Transpose matrix
-        std::vector<rocsparse_int> csrt_row_ptr(M + 1);
-        std::vector<rocsparse_int> csrt_col_ind(nnz);
-        std::vector<T>             csrt_val(nnz);
+        std::vector<I> csrt_row_ptr(M + 1);
+        std::vector<J> csrt_col_ind(nnz);
+        std::vector<T> csrt_val(nnz);
 
         host_csr_to_csc(M,
                         M,
@@ -1150,6 +1334,110 @@ inline void host_csrsv(rocsparse_operation               trans,
     *numeric_pivot = (*numeric_pivot == M + 1) ? -1 : *numeric_pivot;
 }
 
+// Mixed precision triangular solve, the values of the sparse matrix are stored in the
+// precision of U and promoted to the precision of T
+template <typename T, typename U>
+inline void host_csrsv_mixed(rocsparse_operation               trans,
+                             rocsparse_int                     M,
+                             rocsparse_int                     nnz,
+                             T                                 alpha,
+                             const std::vector<rocsparse_int>& csr_row_ptr,
+                             const std::vector<rocsparse_int>& csr_col_ind,
+                             const std::vector<U>&             csr_val,
+                             const std::vector<T>&             x,
+                             std::vector<T>&                   y,
+                             rocsparse_diag_type               diag_type,
+                             rocsparse_fill_mode               fill_mode,
+                             rocsparse_index_base              base,
+                             rocsparse_int*                    struct_pivot,
+                             rocsparse_int*                    numeric_pivot)
+{
+    std::vector<T> val(nnz);
+
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        val[i] = rocsparse_convert<T>(csr_val[i]);
+    }
+
+    host_csrsv(trans,
+               M,
+               nnz,
+               alpha,
+               csr_row_ptr,
+               csr_col_ind,
+               val,
+               x,
+               y,
+               diag_type,
+               fill_mode,
+               base,
+               struct_pivot,
+               numeric_pivot);
+}
+
+template <typename T>
+inline void host_csrsv_strided_batched(rocsparse_int                     M,
+                                       rocsparse_int                     nnz,
+                                       T                                 alpha,
+                                       const std::vector<rocsparse_int>& csr_row_ptr,
+                                       const std::vector<rocsparse_int>& csr_col_ind,
+                                       const std::vector<T>&             csr_val,
+                                       rocsparse_int                     stride_val,
+                                       const std::vector<T>&             x,
+                                       rocsparse_int                     stride_x,
+                                       std::vector<T>&                   y,
+                                       rocsparse_int                     stride_y,
+                                       rocsparse_int                     batch_count,
+                                       rocsparse_diag_type               diag_type,
+                                       rocsparse_fill_mode               fill_mode,
+                                       rocsparse_index_base              base,
+                                       rocsparse_int*                    struct_pivot,
+                                       rocsparse_int*                    numeric_pivot)
+{
+    // Initialize pivot
+    *struct_pivot  = -1;
+    *numeric_pivot = -1;
+
+    for(rocsparse_int b = 0; b < batch_count; ++b)
+    {
+        std::vector<T> val(csr_val.begin() + (size_t)b * stride_val,
+                           csr_val.begin() + (size_t)b * stride_val + nnz);
+        std::vector<T> xb(x.begin() + (size_t)b * stride_x, x.begin() + (size_t)b * stride_x + M);
+        std::vector<T> yb(M);
+
+        rocsparse_int batch_struct_pivot;
+        rocsparse_int batch_numeric_pivot;
+
+        host_csrsv(rocsparse_operation_none,
+                   M,
+                   nnz,
+                   alpha,
+                   csr_row_ptr,
+                   csr_col_ind,
+                   val,
+                   xb,
+                   yb,
+                   diag_type,
+                   fill_mode,
+                   base,
+                   &batch_struct_pivot,
+                   &batch_numeric_pivot);
+
+        std::copy(yb.begin(), yb.end(), y.begin() + (size_t)b * stride_y);
+
+        // The structural pivot is shared by the batch, the numerical pivot is the
+        // first one over all matrices
+        *struct_pivot = batch_struct_pivot;
+
+        if(batch_numeric_pivot != -1)
+        {
+            *numeric_pivot = (*numeric_pivot == -1)
+                                 ? batch_numeric_pivot
+                                 : std::min(*numeric_pivot, batch_numeric_pivot);
+        }
+    }
+}
+
 template <typename T>
 inline void host_ellmv(rocsparse_int        M,
                        rocsparse_int        N,
@@ -1195,6 +1483,72 @@ inline void host_ellmv(rocsparse_int        M,
     }
 }
 
+template <typename T>
+inline void host_diamv(rocsparse_int        M,
+                       rocsparse_int        N,
+                       T                    alpha,
+                       const rocsparse_int* dia_offset,
+                       const T*             dia_val,
+                       rocsparse_int        dia_num_diag,
+                       const T*             x,
+                       T                    beta,
+                       T*                   y)
+{
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        T sum = static_cast<T>(0);
+        for(rocsparse_int d = 0; d < dia_num_diag; ++d)
+        {
+            rocsparse_int col = i + dia_offset[d];
+
+            if(col >= 0 && col < N)
+            {
+                sum = std::fma(dia_val[d * M + i], x[col], sum);
+            }
+        }
+
+        if(beta != static_cast<T>(0))
+        {
+            y[i] = std::fma(beta, y[i], alpha * sum);
+        }
+        else
+        {
+            y[i] = alpha * sum;
+        }
+    }
+}
+
+// Reductions x^H * y and y^H * y of the fused SpMV routines
+template <typename T>
+inline void host_spmv_dot(rocsparse_int M, const T* x, const T* y, T* dot_xy, T* dot_yy)
+{
+    T xy = static_cast<T>(0);
+    T yy = static_cast<T>(0);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        if(dot_xy != nullptr)
+        {
+            xy = std::fma(rocsparse_conj(x[i]), y[i], xy);
+        }
+
+        yy = std::fma(rocsparse_conj(y[i]), y[i], yy);
+    }
+
+    if(dot_xy != nullptr)
+    {
+        *dot_xy = xy;
+    }
+
+    if(dot_yy != nullptr)
+    {
+        *dot_yy = yy;
+    }
+}
+
 template <typename T>
 inline void host_hybmv(rocsparse_int        M,
                        rocsparse_int        N,
@@ -1228,83 +1582,255 @@ inline void host_hybmv(rocsparse_int        M,
     }
 }
 
-/*
- * ===========================================================================
- *    level 3 SPARSE
- * ===========================================================================
- */
 template <typename T>
-inline void host_bsrmm(rocsparse_int                     Mb,
-                       rocsparse_int                     N,
-                       rocsparse_int                     Kb,
-                       rocsparse_int                     block_dim,
-                       rocsparse_direction               dir,
-                       rocsparse_operation               transA,
-                       rocsparse_operation               transB,
-                       T                                 alpha,
-                       const std::vector<rocsparse_int>& bsr_row_ptr_A,
-                       const std::vector<rocsparse_int>& bsr_col_ind_A,
-                       const std::vector<T>&             bsr_val_A,
-                       const std::vector<T>&             B,
-                       rocsparse_int                     ldb,
-                       T                                 beta,
-                       std::vector<T>&                   C,
-                       rocsparse_int                     ldc,
-                       rocsparse_index_base              base)
+inline void host_vbrmv(rocsparse_direction  dir,
+                       rocsparse_int        mb,
+                       T                    alpha,
+                       const rocsparse_int* vbr_val_ptr,
+                       const rocsparse_int* vbr_row_ptr,
+                       const rocsparse_int* vbr_col_ind,
+                       const rocsparse_int* vbr_row_ptn,
+                       const rocsparse_int* vbr_col_ptn,
+                       const T*             vbr_val,
+                       const T*             x,
+                       T                    beta,
+                       T*                   y,
+                       rocsparse_index_base base)
 {
-    if(transA != rocsparse_operation_none)
-    {
-        return;
-    }
-
-    if(transB != rocsparse_operation_none && transB != rocsparse_operation_transpose)
-    {
-        return;
-    }
-
-    rocsparse_int M = Mb * block_dim;
-    rocsparse_int K = Kb * block_dim;
-
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-    for(rocsparse_int i = 0; i < M; i++)
+    for(rocsparse_int i = 0; i < mb; ++i)
     {
-        rocsparse_int local_row = i % block_dim;
-
-        rocsparse_int row_begin = bsr_row_ptr_A[i / block_dim] - base;
-        rocsparse_int row_end   = bsr_row_ptr_A[i / block_dim + 1] - base;
+        rocsparse_int row_offset = vbr_row_ptn[i] - base;
+        rocsparse_int row_height = vbr_row_ptn[i + 1] - base - row_offset;
 
-        for(rocsparse_int j = 0; j < N; j++)
+        for(rocsparse_int r = 0; r < row_height; ++r)
         {
-            rocsparse_int idx_C = i + j * ldc;
-
             T sum = static_cast<T>(0);
 
-            for(rocsparse_int s = row_begin; s < row_end; s++)
+            for(rocsparse_int k = vbr_row_ptr[i] - base; k < vbr_row_ptr[i + 1] - base; ++k)
             {
-                for(rocsparse_int t = 0; t < block_dim; t++)
+                rocsparse_int col        = vbr_col_ind[k] - base;
+                rocsparse_int col_offset = vbr_col_ptn[col] - base;
+                rocsparse_int col_width  = vbr_col_ptn[col + 1] - base - col_offset;
+
+                const T* block = vbr_val + vbr_val_ptr[k] - base;
+
+                for(rocsparse_int c = 0; c < col_width; ++c)
                 {
-                    rocsparse_int idx_A
-                        = (dir == rocsparse_direction_row)
-                              ? block_dim * block_dim * s + block_dim * local_row + t
-                              : block_dim * block_dim * s + block_dim * t + local_row;
-                    rocsparse_int idx_B
-                        = (transB == rocsparse_operation_none)
-                              ? j * ldb + block_dim * (bsr_col_ind_A[s] - base) + t
-                              : (block_dim * (bsr_col_ind_A[s] - base) + t) * ldb + j;
+                    T val = (dir == rocsparse_direction_row) ? block[col_width * r + c]
+                                                             : block[row_height * c + r];
 
-                    sum = std::fma(bsr_val_A[idx_A], B[idx_B], sum);
+                    sum = std::fma(val, x[col_offset + c], sum);
                 }
             }
 
-            if(beta == static_cast<T>(0))
+            rocsparse_int row = row_offset + r;
+
+            if(beta != static_cast<T>(0))
+            {
+                y[row] = std::fma(beta, y[row], alpha * sum);
+            }
+            else
+            {
+                y[row] = alpha * sum;
+            }
+        }
+    }
+}
+
+template <typename T>
+inline void host_csrdcmv(rocsparse_int        M,
+                         T                    alpha,
+                         const rocsparse_int* csr_row_ptr,
+                         rocsparse_int        delta_bits,
+                         const rocsparse_int* csrdc_col_base,
+                         const uint8_t*       csrdc_delta,
+                         const rocsparse_int* csrdc_exc_ptr,
+                         const rocsparse_int* csrdc_exc_col,
+                         const T*             csr_val,
+                         const T*             x,
+                         T                    beta,
+                         T*                   y,
+                         rocsparse_index_base base)
+{
+    rocsparse_int bytes  = delta_bits / 8;
+    rocsparse_int escape = (1 << delta_bits) - 1;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int col = csrdc_col_base[i] - base;
+        rocsparse_int exc = csrdc_exc_ptr[i] - base;
+
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            // Deltas are stored in little endian byte order
+            rocsparse_int delta = 0;
+
+            for(rocsparse_int b = 0; b < bytes; ++b)
+            {
+                delta |= csrdc_delta[bytes * j + b] << (8 * b);
+            }
+
+            if(delta == escape)
             {
-                C[idx_C] = alpha * sum;
+                col = csrdc_exc_col[exc++] - base;
             }
             else
             {
-                C[idx_C] = std::fma(beta, C[idx_C], alpha * sum);
+                col += delta;
+            }
+
+            sum = std::fma(csr_val[j], x[col], sum);
+        }
+
+        if(beta != static_cast<T>(0))
+        {
+            y[i] = std::fma(beta, y[i], alpha * sum);
+        }
+        else
+        {
+            y[i] = alpha * sum;
+        }
+    }
+}
+
+/*
+ * ===========================================================================
+ *    level 3 SPARSE
+ * ===========================================================================
+ */
+template <typename T>
+inline void host_bsrmm(rocsparse_int                     Mb,
+                       rocsparse_int                     N,
+                       rocsparse_int                     Kb,
+                       rocsparse_int                     block_dim,
+                       rocsparse_direction               dir,
+                       rocsparse_operation               transA,
+                       rocsparse_operation               transB,
+                       rocsparse_order                   orderB,
+                       rocsparse_order                   orderC,
+                       T                                 alpha,
+                       const std::vector<rocsparse_int>& bsr_row_ptr_A,
+                       const std::vector<rocsparse_int>& bsr_col_ind_A,
+                       const std::vector<T>&             bsr_val_A,
+                       const std::vector<T>&             B,
+                       rocsparse_int                     ldb,
+                       T                                 beta,
+                       std::vector<T>&                   C,
+                       rocsparse_int                     ldc,
+                       rocsparse_index_base              base)
+{
+    if(transB != rocsparse_operation_none && transB != rocsparse_operation_transpose)
+    {
+        return;
+    }
+
+    rocsparse_int M = Mb * block_dim;
+    rocsparse_int K = Kb * block_dim;
+
+    // Row and column increments of op(B) and C
+    bool row_major_B = ((transB == rocsparse_operation_none) == (orderB == rocsparse_order_row));
+
+    rocsparse_int inc_row_B = row_major_B ? ldb : 1;
+    rocsparse_int inc_col_B = row_major_B ? 1 : ldb;
+    rocsparse_int inc_row_C = (orderC == rocsparse_order_row) ? ldc : 1;
+    rocsparse_int inc_col_C = (orderC == rocsparse_order_row) ? 1 : ldc;
+
+    if(transA == rocsparse_operation_none)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(rocsparse_int i = 0; i < M; i++)
+        {
+            rocsparse_int local_row = i % block_dim;
+
+            rocsparse_int row_begin = bsr_row_ptr_A[i / block_dim] - base;
+            rocsparse_int row_end   = bsr_row_ptr_A[i / block_dim + 1] - base;
+
+            for(rocsparse_int j = 0; j < N; j++)
+            {
+                rocsparse_int idx_C = i * inc_row_C + j * inc_col_C;
+
+                T sum = static_cast<T>(0);
+
+                for(rocsparse_int s = row_begin; s < row_end; s++)
+                {
+                    for(rocsparse_int t = 0; t < block_dim; t++)
+                    {
+                        rocsparse_int idx_A
+                            = (dir == rocsparse_direction_row)
+                                  ? block_dim * block_dim * s + block_dim * local_row + t
+                                  : block_dim * block_dim * s + block_dim * t + local_row;
+                        rocsparse_int idx_B
+                            = (block_dim * (bsr_col_ind_A[s] - base) + t) * inc_row_B
+                              + j * inc_col_B;
+
+                        sum = std::fma(bsr_val_A[idx_A], B[idx_B], sum);
+                    }
+                }
+
+                if(beta == static_cast<T>(0))
+                {
+                    C[idx_C] = alpha * sum;
+                }
+                else
+                {
+                    C[idx_C] = std::fma(beta, C[idx_C], alpha * sum);
+                }
+            }
+        }
+    }
+    else
+    {
+        // Columns of C are independent of each other
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+        for(rocsparse_int j = 0; j < N; j++)
+        {
+            for(rocsparse_int i = 0; i < K; i++)
+            {
+                rocsparse_int idx_C = i * inc_row_C + j * inc_col_C;
+
+                C[idx_C] = (beta == static_cast<T>(0)) ? static_cast<T>(0) : beta * C[idx_C];
+            }
+
+            for(rocsparse_int i = 0; i < M; i++)
+            {
+                rocsparse_int local_row = i % block_dim;
+
+                rocsparse_int row_begin = bsr_row_ptr_A[i / block_dim] - base;
+                rocsparse_int row_end   = bsr_row_ptr_A[i / block_dim + 1] - base;
+
+                T val_B = alpha * B[i * inc_row_B + j * inc_col_B];
+
+                for(rocsparse_int s = row_begin; s < row_end; s++)
+                {
+                    for(rocsparse_int t = 0; t < block_dim; t++)
+                    {
+                        rocsparse_int idx_A
+                            = (dir == rocsparse_direction_row)
+                                  ? block_dim * block_dim * s + block_dim * local_row + t
+                                  : block_dim * block_dim * s + block_dim * t + local_row;
+                        rocsparse_int idx_C
+                            = (block_dim * (bsr_col_ind_A[s] - base) + t) * inc_row_C
+                              + j * inc_col_C;
+
+                        T val_A = (transA == rocsparse_operation_conjugate_transpose)
+                                      ? rocsparse_conj(bsr_val_A[idx_A])
+                                      : bsr_val_A[idx_A];
+
+                        C[idx_C] = std::fma(val_A, val_B, C[idx_C]);
+                    }
+                }
             }
         }
     }
@@ -1313,7 +1839,11 @@ inline void host_bsrmm(rocsparse_int                     Mb,
 template <typename T>
 inline void host_csrmm(rocsparse_int                     M,
                        rocsparse_int                     N,
+                       rocsparse_int                     K,
+                       rocsparse_operation               transA,
                        rocsparse_operation               transB,
+                       rocsparse_order                   orderB,
+                       rocsparse_order                   orderC,
                        T                                 alpha,
                        const std::vector<rocsparse_int>& csr_row_ptr_A,
                        const std::vector<rocsparse_int>& csr_col_ind_A,
@@ -1325,35 +1855,79 @@ inline void host_csrmm(rocsparse_int                     M,
                        rocsparse_int                     ldc,
                        rocsparse_index_base              base)
 {
+    // Row and column increments of op(B) and C
+    bool row_major_B = ((transB == rocsparse_operation_none) == (orderB == rocsparse_order_row));
+
+    rocsparse_int inc_row_B = row_major_B ? ldb : 1;
+    rocsparse_int inc_col_B = row_major_B ? 1 : ldb;
+    rocsparse_int inc_row_C = (orderC == rocsparse_order_row) ? ldc : 1;
+    rocsparse_int inc_col_C = (orderC == rocsparse_order_row) ? 1 : ldc;
+
+    if(transA == rocsparse_operation_none)
+    {
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-    for(rocsparse_int i = 0; i < M; ++i)
-    {
-        for(rocsparse_int j = 0; j < N; ++j)
+        for(rocsparse_int i = 0; i < M; ++i)
         {
-            rocsparse_int row_begin = csr_row_ptr_A[i] - base;
-            rocsparse_int row_end   = csr_row_ptr_A[i + 1] - base;
-            rocsparse_int idx_C     = i + j * ldc;
+            for(rocsparse_int j = 0; j < N; ++j)
+            {
+                rocsparse_int row_begin = csr_row_ptr_A[i] - base;
+                rocsparse_int row_end   = csr_row_ptr_A[i + 1] - base;
+                rocsparse_int idx_C     = i * inc_row_C + j * inc_col_C;
 
-            T sum = static_cast<T>(0);
+                T sum = static_cast<T>(0);
 
-            for(rocsparse_int k = row_begin; k < row_end; ++k)
-            {
-                rocsparse_int idx_B = (transB == rocsparse_operation_none)
-                                          ? (csr_col_ind_A[k] - base + j * ldb)
-                                          : (j + (csr_col_ind_A[k] - base) * ldb);
+                for(rocsparse_int k = row_begin; k < row_end; ++k)
+                {
+                    rocsparse_int idx_B = (csr_col_ind_A[k] - base) * inc_row_B + j * inc_col_B;
 
-                sum = std::fma(csr_val_A[k], B[idx_B], sum);
-            }
+                    sum = std::fma(csr_val_A[k], B[idx_B], sum);
+                }
 
-            if(beta == static_cast<T>(0))
+                if(beta == static_cast<T>(0))
+                {
+                    C[idx_C] = alpha * sum;
+                }
+                else
+                {
+                    C[idx_C] = std::fma(beta, C[idx_C], alpha * sum);
+                }
+            }
+        }
+    }
+    else
+    {
+        // Columns of C are independent of each other
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+        for(rocsparse_int j = 0; j < N; ++j)
+        {
+            for(rocsparse_int i = 0; i < K; ++i)
             {
-                C[idx_C] = alpha * sum;
+                rocsparse_int idx_C = i * inc_row_C + j * inc_col_C;
+
+                C[idx_C] = (beta == static_cast<T>(0)) ? static_cast<T>(0) : beta * C[idx_C];
             }
-            else
+
+            for(rocsparse_int i = 0; i < M; ++i)
             {
-                C[idx_C] = std::fma(beta, C[idx_C], alpha * sum);
+                rocsparse_int row_begin = csr_row_ptr_A[i] - base;
+                rocsparse_int row_end   = csr_row_ptr_A[i + 1] - base;
+
+                T val_B = alpha * B[i * inc_row_B + j * inc_col_B];
+
+                for(rocsparse_int k = row_begin; k < row_end; ++k)
+                {
+                    T val_A = (transA == rocsparse_operation_conjugate_transpose)
+                                  ? rocsparse_conj(csr_val_A[k])
+                                  : csr_val_A[k];
+
+                    rocsparse_int idx_C = (csr_col_ind_A[k] - base) * inc_row_C + j * inc_col_C;
+
+                    C[idx_C] = std::fma(val_A, val_B, C[idx_C]);
+                }
             }
         }
     }
@@ -1653,47 +2227,319 @@ inline void host_csrsm(rocsparse_int                     M,
     *numeric_pivot = (*numeric_pivot == M + 1) ? -1 : *numeric_pivot;
 }
 
+// Mixed precision triangular solve with multiple right-hand sides, the values of the
+// sparse matrix are stored in the precision of U and promoted to the precision of T
+template <typename T, typename U>
+inline void host_csrsm_mixed(rocsparse_int                     M,
+                             rocsparse_int                     nrhs,
+                             rocsparse_int                     nnz,
+                             rocsparse_operation               transA,
+                             rocsparse_operation               transB,
+                             T                                 alpha,
+                             const std::vector<rocsparse_int>& csr_row_ptr,
+                             const std::vector<rocsparse_int>& csr_col_ind,
+                             const std::vector<U>&             csr_val,
+                             std::vector<T>&                   B,
+                             rocsparse_int                     ldb,
+                             rocsparse_diag_type               diag_type,
+                             rocsparse_fill_mode               fill_mode,
+                             rocsparse_index_base              base,
+                             rocsparse_int*                    struct_pivot,
+                             rocsparse_int*                    numeric_pivot)
+{
+    std::vector<T> val(nnz);
+
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        val[i] = rocsparse_convert<T>(csr_val[i]);
+    }
+
+    host_csrsm(M,
+               nrhs,
+               nnz,
+               transA,
+               transB,
+               alpha,
+               csr_row_ptr,
+               csr_col_ind,
+               val,
+               B,
+               ldb,
+               diag_type,
+               fill_mode,
+               base,
+               struct_pivot,
+               numeric_pivot);
+}
+
 template <typename T>
-inline void host_gemmi(rocsparse_int        M,
-                       rocsparse_int        N,
-                       rocsparse_operation  transA,
-                       rocsparse_operation  transB,
-                       T                    alpha,
-                       const T*             A,
-                       rocsparse_int        lda,
-                       const rocsparse_int* csr_row_ptr,
-                       const rocsparse_int* csr_col_ind,
-                       const T*             csr_val,
-                       T                    beta,
-                       T*                   C,
-                       rocsparse_int        ldc,
-                       rocsparse_index_base base)
+inline void host_bsrsm(rocsparse_int                     mb,
+                       rocsparse_int                     nrhs,
+                       rocsparse_int                     nnzb,
+                       rocsparse_direction               dir,
+                       rocsparse_operation               transA,
+                       rocsparse_operation               transB,
+                       T                                 alpha,
+                       const std::vector<rocsparse_int>& bsr_row_ptr,
+                       const std::vector<rocsparse_int>& bsr_col_ind,
+                       const std::vector<T>&             bsr_val,
+                       rocsparse_int                     bsr_dim,
+                       std::vector<T>&                   B,
+                       rocsparse_int                     ldb,
+                       rocsparse_diag_type               diag_type,
+                       rocsparse_fill_mode               fill_mode,
+                       rocsparse_index_base              base,
+                       rocsparse_int*                    struct_pivot,
+                       rocsparse_int*                    numeric_pivot)
 {
-    if(transB == rocsparse_operation_transpose)
+    rocsparse_int M = mb * bsr_dim;
+
+    // Initialize pivot
+    *struct_pivot  = mb + 1;
+    *numeric_pivot = mb + 1;
+
+    // Transpose matrix, if required
+    std::vector<rocsparse_int> bsrt_row_ptr;
+    std::vector<rocsparse_int> bsrt_col_ind;
+    std::vector<T>             bsrt_val;
+
+    if(transA == rocsparse_operation_transpose)
     {
-        for(rocsparse_int i = 0; i < M; ++i)
-        {
-            for(rocsparse_int j = 0; j < N; ++j)
-            {
-                T sum = static_cast<T>(0);
+        host_bsr_to_bsc(mb,
+                        mb,
+                        nnzb,
+                        bsr_dim,
+                        bsr_row_ptr,
+                        bsr_col_ind,
+                        bsr_val,
+                        bsrt_col_ind,
+                        bsrt_row_ptr,
+                        bsrt_val,
+                        base,
+                        base);
+    }
 
-                rocsparse_int row_begin = csr_row_ptr[j] - base;
-                rocsparse_int row_end   = csr_row_ptr[j + 1] - base;
+    const std::vector<rocsparse_int>& ptr
+        = (transA == rocsparse_operation_transpose) ? bsrt_row_ptr : bsr_row_ptr;
+    const std::vector<rocsparse_int>& ind
+        = (transA == rocsparse_operation_transpose) ? bsrt_col_ind : bsr_col_ind;
+    const std::vector<T>& val = (transA == rocsparse_operation_transpose) ? bsrt_val : bsr_val;
 
-                for(rocsparse_int k = row_begin; k < row_end; ++k)
-                {
-                    rocsparse_int col_B = csr_col_ind[k] - base;
-                    T             val_B = csr_val[k];
-                    T             val_A = A[col_B * lda + i];
+    // Solve with lower triangular part of op(A)
+    bool lower = (fill_mode == rocsparse_fill_mode_lower) == (transA == rocsparse_operation_none);
 
-                    sum = std::fma(val_A, val_B, sum);
-                }
+    // Solve each right-hand side independently
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<T> x(M);
+        std::vector<T> y(M);
 
-                C[j * ldc + i] = std::fma(beta, C[j * ldc + i], alpha * sum);
+        rocsparse_int local_struct_pivot  = mb + 1;
+        rocsparse_int local_numeric_pivot = mb + 1;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+        for(rocsparse_int i = 0; i < nrhs; ++i)
+        {
+            // Gather i-th column of op(B)
+            for(rocsparse_int j = 0; j < M; ++j)
+            {
+                x[j] = (transB == rocsparse_operation_none) ? B[i * ldb + j] : B[j * ldb + i];
             }
-        }
-    }
-}
+
+            if(lower)
+            {
+                host_bsr_lsolve(dir,
+                                mb,
+                                alpha,
+                                ptr,
+                                ind,
+                                val,
+                                bsr_dim,
+                                x,
+                                y,
+                                diag_type,
+                                base,
+                                &local_struct_pivot,
+                                &local_numeric_pivot);
+            }
+            else
+            {
+                host_bsr_usolve(dir,
+                                mb,
+                                alpha,
+                                ptr,
+                                ind,
+                                val,
+                                bsr_dim,
+                                x,
+                                y,
+                                diag_type,
+                                base,
+                                &local_struct_pivot,
+                                &local_numeric_pivot);
+            }
+
+            // Scatter solution into i-th column of op(X)
+            for(rocsparse_int j = 0; j < M; ++j)
+            {
+                if(transB == rocsparse_operation_none)
+                {
+                    B[i * ldb + j] = y[j];
+                }
+                else
+                {
+                    B[j * ldb + i] = y[j];
+                }
+            }
+        }
+
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+            *struct_pivot  = std::min(*struct_pivot, local_struct_pivot);
+            *numeric_pivot = std::min(*numeric_pivot, local_numeric_pivot);
+        }
+    }
+
+    *numeric_pivot = std::min(*numeric_pivot, *struct_pivot);
+
+    *struct_pivot  = (*struct_pivot == mb + 1) ? -1 : *struct_pivot;
+    *numeric_pivot = (*numeric_pivot == mb + 1) ? -1 : *numeric_pivot;
+}
+
+template <typename T>
+inline void host_gemmi(rocsparse_int        M,
+                       rocsparse_int        N,
+                       rocsparse_operation  transA,
+                       rocsparse_operation  transB,
+                       T                    alpha,
+                       const T*             A,
+                       rocsparse_int        lda,
+                       const rocsparse_int* csr_row_ptr,
+                       const rocsparse_int* csr_col_ind,
+                       const T*             csr_val,
+                       T                    beta,
+                       T*                   C,
+                       rocsparse_int        ldc,
+                       rocsparse_index_base base)
+{
+    if(transB == rocsparse_operation_transpose)
+    {
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            for(rocsparse_int j = 0; j < N; ++j)
+            {
+                T sum = static_cast<T>(0);
+
+                rocsparse_int row_begin = csr_row_ptr[j] - base;
+                rocsparse_int row_end   = csr_row_ptr[j + 1] - base;
+
+                for(rocsparse_int k = row_begin; k < row_end; ++k)
+                {
+                    rocsparse_int col_B = csr_col_ind[k] - base;
+                    T             val_B = csr_val[k];
+                    T             val_A = A[col_B * lda + i];
+
+                    sum = std::fma(val_A, val_B, sum);
+                }
+
+                C[j * ldc + i] = std::fma(beta, C[j * ldc + i], alpha * sum);
+            }
+        }
+    }
+}
+
+// Entry (i, j) of the product of the dense matrices A (M x K) and B (K x N)
+template <typename T>
+inline T host_sddmm_dot(rocsparse_int   i,
+                        rocsparse_int   j,
+                        rocsparse_int   K,
+                        rocsparse_order orderA,
+                        rocsparse_order orderB,
+                        const T*        A,
+                        rocsparse_int   lda,
+                        const T*        B,
+                        rocsparse_int   ldb)
+{
+    T sum = static_cast<T>(0);
+
+    for(rocsparse_int p = 0; p < K; ++p)
+    {
+        T val_A = (orderA == rocsparse_order_row) ? A[(size_t)i * lda + p]
+                                                  : A[(size_t)p * lda + i];
+        T val_B = (orderB == rocsparse_order_row) ? B[(size_t)p * ldb + j]
+                                                  : B[(size_t)j * ldb + p];
+
+        sum = std::fma(val_A, val_B, sum);
+    }
+
+    return sum;
+}
+
+template <typename T>
+inline void host_csrsddmm(rocsparse_int        M,
+                          rocsparse_int        K,
+                          rocsparse_order      orderA,
+                          rocsparse_order      orderB,
+                          T                    alpha,
+                          const T*             A,
+                          rocsparse_int        lda,
+                          const T*             B,
+                          rocsparse_int        ldb,
+                          T                    beta,
+                          const rocsparse_int* csr_row_ptr,
+                          const rocsparse_int* csr_col_ind,
+                          T*                   csr_val,
+                          rocsparse_index_base base)
+{
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            T sum = host_sddmm_dot(i, csr_col_ind[j] - base, K, orderA, orderB, A, lda, B, ldb);
+
+            csr_val[j] = (beta == static_cast<T>(0)) ? alpha * sum
+                                                     : std::fma(beta, csr_val[j], alpha * sum);
+        }
+    }
+}
+
+template <typename T>
+inline void host_coosddmm(rocsparse_int        nnz,
+                          rocsparse_int        K,
+                          rocsparse_order      orderA,
+                          rocsparse_order      orderB,
+                          T                    alpha,
+                          const T*             A,
+                          rocsparse_int        lda,
+                          const T*             B,
+                          rocsparse_int        ldb,
+                          T                    beta,
+                          const rocsparse_int* coo_row_ind,
+                          const rocsparse_int* coo_col_ind,
+                          T*                   coo_val,
+                          rocsparse_index_base base)
+{
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int j = 0; j < nnz; ++j)
+    {
+        T sum = host_sddmm_dot(
+            coo_row_ind[j] - base, coo_col_ind[j] - base, K, orderA, orderB, A, lda, B, ldb);
+
+        coo_val[j] = (beta == static_cast<T>(0)) ? alpha * sum
+                                                 : std::fma(beta, coo_val[j], alpha * sum);
+    }
+}
 
 /*
  * ===========================================================================
@@ -1909,71 +2755,71 @@ inline void host_csrgeam(rocsparse_int                     M,
     }
 }
 
-template <typename T>
-inline void host_csrgemm_nnz(rocsparse_int                     M,
-                             rocsparse_int                     N,
-                             rocsparse_int                     K,
-                             const T*                          alpha,
-                             const std::vector<rocsparse_int>& csr_row_ptr_A,
-                             const std::vector<rocsparse_int>& csr_col_ind_A,
-                             const std::vector<rocsparse_int>& csr_row_ptr_B,
-                             const std::vector<rocsparse_int>& csr_col_ind_B,
-                             const T*                          beta,
-                             const std::vector<rocsparse_int>& csr_row_ptr_D,
-                             const std::vector<rocsparse_int>& csr_col_ind_D,
-                             std::vector<rocsparse_int>&       csr_row_ptr_C,
-                             rocsparse_int*                    nnz_C,
-                             rocsparse_index_base              base_A,
-                             rocsparse_index_base              base_B,
-                             rocsparse_index_base              base_C,
-                             rocsparse_index_base              base_D)
+template <typename T, typename I, typename J>
+inline void host_csrgemm_nnz(J                     M,
+                             J                     N,
+                             J                     K,
+                             const T*              alpha,
+                             const std::vector<I>& csr_row_ptr_A,
+                             const std::vector<J>& csr_col_ind_A,
+                             const std::vector<I>& csr_row_ptr_B,
+                             const std::vector<J>& csr_col_ind_B,
+                             const T*              beta,
+                             const std::vector<I>& csr_row_ptr_D,
+                             const std::vector<J>& csr_col_ind_D,
+                             std::vector<I>&       csr_row_ptr_C,
+                             I*                    nnz_C,
+                             rocsparse_index_base  base_A,
+                             rocsparse_index_base  base_B,
+                             rocsparse_index_base  base_C,
+                             rocsparse_index_base  base_D)
 {
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
     {
-        std::vector<rocsparse_int> nnz(N, -1);
+        std::vector<J> nnz(N, -1);
 
 #ifdef _OPENMP
-        rocsparse_int nthreads = omp_get_num_threads();
-        rocsparse_int tid      = omp_get_thread_num();
+        J nthreads = omp_get_num_threads();
+        J tid      = omp_get_thread_num();
 #else
-        rocsparse_int nthreads = 1;
-        rocsparse_int tid      = 0;
+        J nthreads = 1;
+        J tid      = 0;
 #endif
 
-        rocsparse_int rows_per_thread = (M + nthreads - 1) / nthreads;
-        rocsparse_int chunk_begin     = rows_per_thread * tid;
-        rocsparse_int chunk_end       = std::min(chunk_begin + rows_per_thread, M);
+        J rows_per_thread = (M + nthreads - 1) / nthreads;
+        J chunk_begin     = rows_per_thread * tid;
+        J chunk_end       = std::min(chunk_begin + rows_per_thread, M);
 
         // Index base
         csr_row_ptr_C[0] = base_C;
 
         // Loop over rows of A
-        for(rocsparse_int i = chunk_begin; i < chunk_end; ++i)
+        for(J i = chunk_begin; i < chunk_end; ++i)
         {
             // Initialize csr row pointer with previous row offset
             csr_row_ptr_C[i + 1] = 0;
 
             if(alpha)
             {
-                rocsparse_int row_begin_A = csr_row_ptr_A[i] - base_A;
-                rocsparse_int row_end_A   = csr_row_ptr_A[i + 1] - base_A;
+                I row_begin_A = csr_row_ptr_A[i] - base_A;
+                I row_end_A   = csr_row_ptr_A[i + 1] - base_A;
 
                 // Loop over columns of A
-                for(rocsparse_int j = row_begin_A; j < row_end_A; ++j)
+                for(I j = row_begin_A; j < row_end_A; ++j)
                 {
                     // Current column of A
-                    rocsparse_int col_A = csr_col_ind_A[j] - base_A;
+                    J col_A = csr_col_ind_A[j] - base_A;
 
-                    rocsparse_int row_begin_B = csr_row_ptr_B[col_A] - base_B;
-                    rocsparse_int row_end_B   = csr_row_ptr_B[col_A + 1] - base_B;
+                    I row_begin_B = csr_row_ptr_B[col_A] - base_B;
+                    I row_end_B   = csr_row_ptr_B[col_A + 1] - base_B;
 
                     // Loop over columns of B in row col_A
-                    for(rocsparse_int k = row_begin_B; k < row_end_B; ++k)
+                    for(I k = row_begin_B; k < row_end_B; ++k)
                     {
                         // Current column of B
-                        rocsparse_int col_B = csr_col_ind_B[k] - base_B;
+                        J col_B = csr_col_ind_B[k] - base_B;
 
                         // Check if a new nnz is generated
                         if(nnz[col_B] != i)
@@ -1988,13 +2834,13 @@ inline void host_csrgemm_nnz(rocsparse_int                     M,
             // Add nnz of D if beta != 0
             if(beta)
             {
-                rocsparse_int row_begin_D = csr_row_ptr_D[i] - base_D;
-                rocsparse_int row_end_D   = csr_row_ptr_D[i + 1] - base_D;
+                I row_begin_D = csr_row_ptr_D[i] - base_D;
+                I row_end_D   = csr_row_ptr_D[i + 1] - base_D;
 
                 // Loop over columns of D
-                for(rocsparse_int j = row_begin_D; j < row_end_D; ++j)
+                for(I j = row_begin_D; j < row_end_D; ++j)
                 {
-                    rocsparse_int col_D = csr_col_ind_D[j] - base_D;
+                    J col_D = csr_col_ind_D[j] - base_D;
 
                     // Check if a new nnz is generated
                     if(nnz[col_D] != i)
@@ -2008,7 +2854,7 @@ inline void host_csrgemm_nnz(rocsparse_int                     M,
     }
 
     // Scan to obtain row offsets
-    for(rocsparse_int i = 0; i < M; ++i)
+    for(J i = 0; i < M; ++i)
     {
         csr_row_ptr_C[i + 1] += csr_row_ptr_C[i];
     }
@@ -2016,74 +2862,74 @@ inline void host_csrgemm_nnz(rocsparse_int                     M,
     *nnz_C = csr_row_ptr_C[M] - base_C;
 }
 
-template <typename T>
-inline void host_csrgemm(rocsparse_int                     M,
-                         rocsparse_int                     N,
-                         rocsparse_int                     L,
-                         const T*                          alpha,
-                         const std::vector<rocsparse_int>& csr_row_ptr_A,
-                         const std::vector<rocsparse_int>& csr_col_ind_A,
-                         const std::vector<T>&             csr_val_A,
-                         const std::vector<rocsparse_int>& csr_row_ptr_B,
-                         const std::vector<rocsparse_int>& csr_col_ind_B,
-                         const std::vector<T>&             csr_val_B,
-                         const T*                          beta,
-                         const std::vector<rocsparse_int>& csr_row_ptr_D,
-                         const std::vector<rocsparse_int>& csr_col_ind_D,
-                         const std::vector<T>&             csr_val_D,
-                         const std::vector<rocsparse_int>& csr_row_ptr_C,
-                         std::vector<rocsparse_int>&       csr_col_ind_C,
-                         std::vector<T>&                   csr_val_C,
-                         rocsparse_index_base              base_A,
-                         rocsparse_index_base              base_B,
-                         rocsparse_index_base              base_C,
-                         rocsparse_index_base              base_D)
+template <typename T, typename I, typename J>
+inline void host_csrgemm(J                     M,
+                         J                     N,
+                         J                     L,
+                         const T*              alpha,
+                         const std::vector<I>& csr_row_ptr_A,
+                         const std::vector<J>& csr_col_ind_A,
+                         const std::vector<T>& csr_val_A,
+                         const std::vector<I>& csr_row_ptr_B,
+                         const std::vector<J>& csr_col_ind_B,
+                         const std::vector<T>& csr_val_B,
+                         const T*              beta,
+                         const std::vector<I>& csr_row_ptr_D,
+                         const std::vector<J>& csr_col_ind_D,
+                         const std::vector<T>& csr_val_D,
+                         const std::vector<I>& csr_row_ptr_C,
+                         std::vector<J>&       csr_col_ind_C,
+                         std::vector<T>&       csr_val_C,
+                         rocsparse_index_base  base_A,
+                         rocsparse_index_base  base_B,
+                         rocsparse_index_base  base_C,
+                         rocsparse_index_base  base_D)
 {
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
     {
-        std::vector<rocsparse_int> nnz(N, -1);
+        std::vector<I> nnz(N, -1);
 
 #ifdef _OPENMP
-        rocsparse_int nthreads = omp_get_num_threads();
-        rocsparse_int tid      = omp_get_thread_num();
+        J nthreads = omp_get_num_threads();
+        J tid      = omp_get_thread_num();
 #else
-        rocsparse_int nthreads = 1;
-        rocsparse_int tid      = 0;
+        J nthreads = 1;
+        J tid      = 0;
 #endif
 
-        rocsparse_int rows_per_thread = (M + nthreads - 1) / nthreads;
-        rocsparse_int chunk_begin     = rows_per_thread * tid;
-        rocsparse_int chunk_end       = std::min(chunk_begin + rows_per_thread, M);
+        J rows_per_thread = (M + nthreads - 1) / nthreads;
+        J chunk_begin     = rows_per_thread * tid;
+        J chunk_end       = std::min(chunk_begin + rows_per_thread, M);
 
         // Loop over rows of A
-        for(rocsparse_int i = chunk_begin; i < chunk_end; ++i)
+        for(J i = chunk_begin; i < chunk_end; ++i)
         {
-            rocsparse_int row_begin_C = csr_row_ptr_C[i] - base_C;
-            rocsparse_int row_end_C   = row_begin_C;
+            I row_begin_C = csr_row_ptr_C[i] - base_C;
+            I row_end_C   = row_begin_C;
 
             if(alpha)
             {
-                rocsparse_int row_begin_A = csr_row_ptr_A[i] - base_A;
-                rocsparse_int row_end_A   = csr_row_ptr_A[i + 1] - base_A;
+                I row_begin_A = csr_row_ptr_A[i] - base_A;
+                I row_end_A   = csr_row_ptr_A[i + 1] - base_A;
 
                 // Loop over columns of A
-                for(rocsparse_int j = row_begin_A; j < row_end_A; ++j)
+                for(I j = row_begin_A; j < row_end_A; ++j)
                 {
                     // Current column of A
-                    rocsparse_int col_A = csr_col_ind_A[j] - base_A;
+                    J col_A = csr_col_ind_A[j] - base_A;
                     // Current value of A
                     T val_A = *alpha * csr_val_A[j];
 
-                    rocsparse_int row_begin_B = csr_row_ptr_B[col_A] - base_B;
-                    rocsparse_int row_end_B   = csr_row_ptr_B[col_A + 1] - base_B;
+                    I row_begin_B = csr_row_ptr_B[col_A] - base_B;
+                    I row_end_B   = csr_row_ptr_B[col_A + 1] - base_B;
 
                     // Loop over columns of B in row col_A
-                    for(rocsparse_int k = row_begin_B; k < row_end_B; ++k)
+                    for(I k = row_begin_B; k < row_end_B; ++k)
                     {
                         // Current column of B
-                        rocsparse_int col_B = csr_col_ind_B[k] - base_B;
+                        J col_B = csr_col_ind_B[k] - base_B;
                         // Current value of B
                         T val_B = csr_val_B[k];
 
@@ -2106,14 +2952,14 @@ inline void host_csrgemm(rocsparse_int                     M,
             // Add nnz of D if beta != 0
             if(beta)
             {
-                rocsparse_int row_begin_D = csr_row_ptr_D[i] - base_D;
-                rocsparse_int row_end_D   = csr_row_ptr_D[i + 1] - base_D;
+                I row_begin_D = csr_row_ptr_D[i] - base_D;
+                I row_end_D   = csr_row_ptr_D[i + 1] - base_D;
 
                 // Loop over columns of D
-                for(rocsparse_int j = row_begin_D; j < row_end_D; ++j)
+                for(I j = row_begin_D; j < row_end_D; ++j)
                 {
                     // Current column of D
-                    rocsparse_int col_D = csr_col_ind_D[j] - base_D;
+                    J col_D = csr_col_ind_D[j] - base_D;
                     // Current value of D
                     T val_D = *beta * csr_val_D[j];
 
@@ -2135,10 +2981,10 @@ inline void host_csrgemm(rocsparse_int                     M,
         }
     }
 
-    rocsparse_int nnz = csr_row_ptr_C[M] - base_C;
+    I nnz = csr_row_ptr_C[M] - base_C;
 
-    std::vector<rocsparse_int> col(nnz);
-    std::vector<T>             val(nnz);
+    std::vector<J> col(nnz);
+    std::vector<T> val(nnz);
 
     col = csr_col_ind_C;
     val = csr_val_C;
@@ -2146,26 +2992,26 @@ inline void host_csrgemm(rocsparse_int                     M,
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-    for(rocsparse_int i = 0; i < M; ++i)
+    for(J i = 0; i < M; ++i)
     {
-        rocsparse_int row_begin = csr_row_ptr_C[i] - base_C;
-        rocsparse_int row_end   = csr_row_ptr_C[i + 1] - base_C;
-        rocsparse_int row_nnz   = row_end - row_begin;
+        I row_begin = csr_row_ptr_C[i] - base_C;
+        I row_end   = csr_row_ptr_C[i + 1] - base_C;
+        I row_nnz   = row_end - row_begin;
 
-        std::vector<rocsparse_int> perm(row_nnz);
-        for(rocsparse_int j = 0; j < row_nnz; ++j)
+        std::vector<I> perm(row_nnz);
+        for(I j = 0; j < row_nnz; ++j)
         {
             perm[j] = j;
         }
 
-        rocsparse_int* col_entry = &col[row_begin];
-        T*             val_entry = &val[row_begin];
+        J* col_entry = &col[row_begin];
+        T* val_entry = &val[row_begin];
 
-        std::sort(perm.begin(), perm.end(), [&](const rocsparse_int& a, const rocsparse_int& b) {
+        std::sort(perm.begin(), perm.end(), [&](const I& a, const I& b) {
             return col_entry[a] <= col_entry[b];
         });
 
-        for(rocsparse_int j = 0; j < row_nnz; ++j)
+        for(I j = 0; j < row_nnz; ++j)
         {
             csr_col_ind_C[row_begin + j] = col_entry[perm[j]];
             csr_val_C[row_begin + j]     = val_entry[perm[j]];
@@ -2173,6 +3019,427 @@ inline void host_csrgemm(rocsparse_int                     M,
     }
 }
 
+// Build op(A) explicitly in CSR format, where op(A) is a M x N matrix and A is stored
+// as N x M matrix if op(A) is transposed.
+template <typename T, typename I, typename J>
+inline void host_csr_op(rocsparse_operation   trans,
+                        J                     M,
+                        J                     N,
+                        I                     nnz,
+                        const std::vector<I>& csr_row_ptr,
+                        const std::vector<J>& csr_col_ind,
+                        const std::vector<T>& csr_val,
+                        std::vector<I>&       op_row_ptr,
+                        std::vector<J>&       op_col_ind,
+                        std::vector<T>&       op_val,
+                        rocsparse_index_base  base)
+{
+    if(trans == rocsparse_operation_none)
+    {
+        op_row_ptr = csr_row_ptr;
+        op_col_ind = csr_col_ind;
+        op_val     = csr_val;
+
+        return;
+    }
+
+    // Columns of A are the rows of op(A)
+    host_csr_to_csc(N,
+                    M,
+                    nnz,
+                    csr_row_ptr,
+                    csr_col_ind,
+                    csr_val,
+                    op_col_ind,
+                    op_row_ptr,
+                    op_val,
+                    rocsparse_action_numeric,
+                    base);
+
+    if(trans == rocsparse_operation_conjugate_transpose)
+    {
+        for(I i = 0; i < nnz; ++i)
+        {
+            op_val[i] = rocsparse_conj(op_val[i]);
+        }
+    }
+}
+
+template <typename T, typename I, typename J>
+inline void host_csrgemm_nnz(rocsparse_operation   trans_A,
+                             rocsparse_operation   trans_B,
+                             J                     M,
+                             J                     N,
+                             J                     K,
+                             const T*              alpha,
+                             const std::vector<I>& csr_row_ptr_A,
+                             const std::vector<J>& csr_col_ind_A,
+                             const std::vector<I>& csr_row_ptr_B,
+                             const std::vector<J>& csr_col_ind_B,
+                             const T*              beta,
+                             const std::vector<I>& csr_row_ptr_D,
+                             const std::vector<J>& csr_col_ind_D,
+                             std::vector<I>&       csr_row_ptr_C,
+                             I*                    nnz_C,
+                             rocsparse_index_base  base_A,
+                             rocsparse_index_base  base_B,
+                             rocsparse_index_base  base_C,
+                             rocsparse_index_base  base_D)
+{
+    // Structure of op(A) and op(B)
+    std::vector<I> op_row_ptr_A;
+    std::vector<J> op_col_ind_A;
+    std::vector<T> op_val_A;
+    std::vector<I> op_row_ptr_B;
+    std::vector<J> op_col_ind_B;
+    std::vector<T> op_val_B;
+
+    if(alpha != nullptr)
+    {
+        I nnz_A = csr_col_ind_A.size();
+        I nnz_B = csr_col_ind_B.size();
+
+        host_csr_op(trans_A,
+                    M,
+                    K,
+                    nnz_A,
+                    csr_row_ptr_A,
+                    csr_col_ind_A,
+                    std::vector<T>(nnz_A),
+                    op_row_ptr_A,
+                    op_col_ind_A,
+                    op_val_A,
+                    base_A);
+        host_csr_op(trans_B,
+                    K,
+                    N,
+                    nnz_B,
+                    csr_row_ptr_B,
+                    csr_col_ind_B,
+                    std::vector<T>(nnz_B),
+                    op_row_ptr_B,
+                    op_col_ind_B,
+                    op_val_B,
+                    base_B);
+    }
+
+    host_csrgemm_nnz(M,
+                     N,
+                     K,
+                     alpha,
+                     op_row_ptr_A,
+                     op_col_ind_A,
+                     op_row_ptr_B,
+                     op_col_ind_B,
+                     beta,
+                     csr_row_ptr_D,
+                     csr_col_ind_D,
+                     csr_row_ptr_C,
+                     nnz_C,
+                     base_A,
+                     base_B,
+                     base_C,
+                     base_D);
+}
+
+template <typename T, typename I, typename J>
+inline void host_csrgemm(rocsparse_operation   trans_A,
+                         rocsparse_operation   trans_B,
+                         J                     M,
+                         J                     N,
+                         J                     K,
+                         const T*              alpha,
+                         const std::vector<I>& csr_row_ptr_A,
+                         const std::vector<J>& csr_col_ind_A,
+                         const std::vector<T>& csr_val_A,
+                         const std::vector<I>& csr_row_ptr_B,
+                         const std::vector<J>& csr_col_ind_B,
+                         const std::vector<T>& csr_val_B,
+                         const T*              beta,
+                         const std::vector<I>& csr_row_ptr_D,
+                         const std::vector<J>& csr_col_ind_D,
+                         const std::vector<T>& csr_val_D,
+                         const std::vector<I>& csr_row_ptr_C,
+                         std::vector<J>&       csr_col_ind_C,
+                         std::vector<T>&       csr_val_C,
+                         rocsparse_index_base  base_A,
+                         rocsparse_index_base  base_B,
+                         rocsparse_index_base  base_C,
+                         rocsparse_index_base  base_D)
+{
+    // op(A) and op(B)
+    std::vector<I> op_row_ptr_A;
+    std::vector<J> op_col_ind_A;
+    std::vector<T> op_val_A;
+    std::vector<I> op_row_ptr_B;
+    std::vector<J> op_col_ind_B;
+    std::vector<T> op_val_B;
+
+    if(alpha != nullptr)
+    {
+        host_csr_op(trans_A,
+                    M,
+                    K,
+                    static_cast<I>(csr_col_ind_A.size()),
+                    csr_row_ptr_A,
+                    csr_col_ind_A,
+                    csr_val_A,
+                    op_row_ptr_A,
+                    op_col_ind_A,
+                    op_val_A,
+                    base_A);
+        host_csr_op(trans_B,
+                    K,
+                    N,
+                    static_cast<I>(csr_col_ind_B.size()),
+                    csr_row_ptr_B,
+                    csr_col_ind_B,
+                    csr_val_B,
+                    op_row_ptr_B,
+                    op_col_ind_B,
+                    op_val_B,
+                    base_B);
+    }
+
+    host_csrgemm(M,
+                 N,
+                 K,
+                 alpha,
+                 op_row_ptr_A,
+                 op_col_ind_A,
+                 op_val_A,
+                 op_row_ptr_B,
+                 op_col_ind_B,
+                 op_val_B,
+                 beta,
+                 csr_row_ptr_D,
+                 csr_col_ind_D,
+                 csr_val_D,
+                 csr_row_ptr_C,
+                 csr_col_ind_C,
+                 csr_val_C,
+                 base_A,
+                 base_B,
+                 base_C,
+                 base_D);
+}
+
+template <typename T>
+inline void host_csrrap_nnz(rocsparse_operation               trans_R,
+                            rocsparse_int                     M,
+                            rocsparse_int                     N,
+                            rocsparse_int                     K,
+                            rocsparse_int                     nnz_R,
+                            const std::vector<rocsparse_int>& csr_row_ptr_R,
+                            const std::vector<rocsparse_int>& csr_col_ind_R,
+                            const std::vector<rocsparse_int>& csr_row_ptr_A,
+                            const std::vector<rocsparse_int>& csr_col_ind_A,
+                            const std::vector<rocsparse_int>& csr_row_ptr_P,
+                            const std::vector<rocsparse_int>& csr_col_ind_P,
+                            std::vector<rocsparse_int>&       csr_row_ptr_C,
+                            rocsparse_int*                    nnz_C,
+                            rocsparse_index_base              base_R,
+                            rocsparse_index_base              base_A,
+                            rocsparse_index_base              base_P,
+                            rocsparse_index_base              base_C)
+{
+    // Structure of op(R)
+    std::vector<rocsparse_int> op_row_ptr_R;
+    std::vector<rocsparse_int> op_col_ind_R;
+    std::vector<T>             op_val_R;
+
+    host_csr_op(trans_R,
+                M,
+                N,
+                nnz_R,
+                csr_row_ptr_R,
+                csr_col_ind_R,
+                std::vector<T>(nnz_R),
+                op_row_ptr_R,
+                op_col_ind_R,
+                op_val_R,
+                base_R);
+
+    // Structure of A * P
+    T                          one = static_cast<T>(1);
+    std::vector<rocsparse_int> csr_row_ptr_AP(N + 1);
+    rocsparse_int              nnz_AP;
+
+    host_csrgemm_nnz(N,
+                     K,
+                     N,
+                     &one,
+                     csr_row_ptr_A,
+                     csr_col_ind_A,
+                     csr_row_ptr_P,
+                     csr_col_ind_P,
+                     (const T*)nullptr,
+                     csr_row_ptr_A,
+                     csr_col_ind_A,
+                     csr_row_ptr_AP,
+                     &nnz_AP,
+                     base_A,
+                     base_P,
+                     rocsparse_index_base_zero,
+                     base_A);
+
+    std::vector<rocsparse_int> csr_col_ind_AP(nnz_AP);
+    std::vector<T>             csr_val_AP(nnz_AP);
+
+    host_csrgemm(N,
+                 K,
+                 N,
+                 &one,
+                 csr_row_ptr_A,
+                 csr_col_ind_A,
+                 std::vector<T>(csr_col_ind_A.size()),
+                 csr_row_ptr_P,
+                 csr_col_ind_P,
+                 std::vector<T>(csr_col_ind_P.size()),
+                 (const T*)nullptr,
+                 csr_row_ptr_A,
+                 csr_col_ind_A,
+                 std::vector<T>(),
+                 csr_row_ptr_AP,
+                 csr_col_ind_AP,
+                 csr_val_AP,
+                 base_A,
+                 base_P,
+                 rocsparse_index_base_zero,
+                 base_A);
+
+    // Structure of op(R) * (A * P)
+    host_csrgemm_nnz(M,
+                     K,
+                     N,
+                     &one,
+                     op_row_ptr_R,
+                     op_col_ind_R,
+                     csr_row_ptr_AP,
+                     csr_col_ind_AP,
+                     (const T*)nullptr,
+                     op_row_ptr_R,
+                     op_col_ind_R,
+                     csr_row_ptr_C,
+                     nnz_C,
+                     base_R,
+                     rocsparse_index_base_zero,
+                     base_C,
+                     base_R);
+}
+
+template <typename T>
+inline void host_csrrap(rocsparse_operation               trans_R,
+                        rocsparse_int                     M,
+                        rocsparse_int                     N,
+                        rocsparse_int                     K,
+                        rocsparse_int                     nnz_R,
+                        const std::vector<rocsparse_int>& csr_row_ptr_R,
+                        const std::vector<rocsparse_int>& csr_col_ind_R,
+                        const std::vector<T>&             csr_val_R,
+                        const std::vector<rocsparse_int>& csr_row_ptr_A,
+                        const std::vector<rocsparse_int>& csr_col_ind_A,
+                        const std::vector<T>&             csr_val_A,
+                        const std::vector<rocsparse_int>& csr_row_ptr_P,
+                        const std::vector<rocsparse_int>& csr_col_ind_P,
+                        const std::vector<T>&             csr_val_P,
+                        const std::vector<rocsparse_int>& csr_row_ptr_C,
+                        std::vector<rocsparse_int>&       csr_col_ind_C,
+                        std::vector<T>&                   csr_val_C,
+                        rocsparse_index_base              base_R,
+                        rocsparse_index_base              base_A,
+                        rocsparse_index_base              base_P,
+                        rocsparse_index_base              base_C)
+{
+    // op(R)
+    std::vector<rocsparse_int> op_row_ptr_R;
+    std::vector<rocsparse_int> op_col_ind_R;
+    std::vector<T>             op_val_R;
+
+    host_csr_op(trans_R,
+                M,
+                N,
+                nnz_R,
+                csr_row_ptr_R,
+                csr_col_ind_R,
+                csr_val_R,
+                op_row_ptr_R,
+                op_col_ind_R,
+                op_val_R,
+                base_R);
+
+    // A * P
+    T                          one = static_cast<T>(1);
+    std::vector<rocsparse_int> csr_row_ptr_AP(N + 1);
+    rocsparse_int              nnz_AP;
+
+    host_csrgemm_nnz(N,
+                     K,
+                     N,
+                     &one,
+                     csr_row_ptr_A,
+                     csr_col_ind_A,
+                     csr_row_ptr_P,
+                     csr_col_ind_P,
+                     (const T*)nullptr,
+                     csr_row_ptr_A,
+                     csr_col_ind_A,
+                     csr_row_ptr_AP,
+                     &nnz_AP,
+                     base_A,
+                     base_P,
+                     rocsparse_index_base_zero,
+                     base_A);
+
+    std::vector<rocsparse_int> csr_col_ind_AP(nnz_AP);
+    std::vector<T>             csr_val_AP(nnz_AP);
+
+    host_csrgemm(N,
+                 K,
+                 N,
+                 &one,
+                 csr_row_ptr_A,
+                 csr_col_ind_A,
+                 csr_val_A,
+                 csr_row_ptr_P,
+                 csr_col_ind_P,
+                 csr_val_P,
+                 (const T*)nullptr,
+                 csr_row_ptr_A,
+                 csr_col_ind_A,
+                 csr_val_A,
+                 csr_row_ptr_AP,
+                 csr_col_ind_AP,
+                 csr_val_AP,
+                 base_A,
+                 base_P,
+                 rocsparse_index_base_zero,
+                 base_A);
+
+    // op(R) * (A * P)
+    host_csrgemm(M,
+                 K,
+                 N,
+                 &one,
+                 op_row_ptr_R,
+                 op_col_ind_R,
+                 op_val_R,
+                 csr_row_ptr_AP,
+                 csr_col_ind_AP,
+                 csr_val_AP,
+                 (const T*)nullptr,
+                 op_row_ptr_R,
+                 op_col_ind_R,
+                 op_val_R,
+                 csr_row_ptr_C,
+                 csr_col_ind_C,
+                 csr_val_C,
+                 base_R,
+                 rocsparse_index_base_zero,
+                 base_C,
+                 base_R);
+}
+
 /*
  * ===========================================================================
  *    precond SPARSE
@@ -2414,63 +3681,247 @@ inline void host_bsric0(rocsparse_direction               direction,
 }
 
 template <typename T>
-inline void host_csric0(rocsparse_int                     M,
-                        const std::vector<rocsparse_int>& csr_row_ptr,
-                        const std::vector<rocsparse_int>& csr_col_ind,
-                        std::vector<T>&                   csr_val,
-                        rocsparse_index_base              base,
-                        rocsparse_int*                    struct_pivot,
-                        rocsparse_int*                    numeric_pivot)
+inline void host_bsrilu0(rocsparse_direction               direction,
+                         rocsparse_int                     Mb,
+                         rocsparse_int                     block_dim,
+                         const std::vector<rocsparse_int>& bsr_row_ptr,
+                         const std::vector<rocsparse_int>& bsr_col_ind,
+                         std::vector<T>&                   bsr_val,
+                         rocsparse_index_base              base,
+                         rocsparse_int*                    struct_pivot,
+                         rocsparse_int*                    numeric_pivot)
 {
     // Initialize pivot
     *struct_pivot  = -1;
     *numeric_pivot = -1;
 
-    // pointer of upper part of each row
-    std::vector<rocsparse_int> diag_offset(M);
-    std::vector<rocsparse_int> nnz_entries(M, 0);
-
-    // ai = 0 to N loop over all rows
-    for(rocsparse_int ai = 0; ai < M; ++ai)
+    if(bsr_col_ind.size() == 0 && bsr_val.size() == 0)
     {
-        // ai-th row entries
-        rocsparse_int row_begin = csr_row_ptr[ai] - base;
-        rocsparse_int row_end   = csr_row_ptr[ai + 1] - base;
-        rocsparse_int j;
+        return;
+    }
 
-        // nnz position of ai-th row in val array
-        for(j = row_begin; j < row_end; ++j)
-        {
-            nnz_entries[csr_col_ind[j] - base] = j;
-        }
+    // Position of entry (row, col) of a block
+    auto index = [&](rocsparse_int block, rocsparse_int row, rocsparse_int col) {
+        return (direction == rocsparse_direction_row)
+                   ? block_dim * block_dim * block + block_dim * row + col
+                   : block_dim * block_dim * block + block_dim * col + row;
+    };
 
-        T sum = static_cast<T>(0);
+    // Diagonal block of each block row
+    std::vector<rocsparse_int> diag_block_offset(Mb, -1);
 
-        bool has_diag = false;
+    // Block position of each block column in the current block row
+    std::vector<rocsparse_int> nnz_entries(Mb, -1);
 
-        // loop over ai-th row nnz entries
-        for(j = row_begin; j < row_end; ++j)
-        {
-            rocsparse_int col_j = csr_col_ind[j] - base;
-            T             val_j = csr_val[j];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int i = 0; i < Mb; ++i)
+    {
+        rocsparse_int row_begin = bsr_row_ptr[i] - base;
+        rocsparse_int row_end   = bsr_row_ptr[i + 1] - base;
 
-            // Mark diagonal and skip row
-            if(col_j == ai)
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            if(bsr_col_ind[j] - base == i)
             {
-                has_diag = true;
+                diag_block_offset[i] = j;
                 break;
             }
+        }
+    }
 
-            // Skip upper triangular
-            if(col_j > ai)
+    // Loop over all block rows
+    for(rocsparse_int i = 0; i < Mb; ++i)
+    {
+        rocsparse_int row_begin = bsr_row_ptr[i] - base;
+        rocsparse_int row_end   = bsr_row_ptr[i + 1] - base;
+        rocsparse_int row_diag  = diag_block_offset[i];
+
+        if(row_diag == -1)
+        {
+            // Structural missing block diagonal
+            if(*struct_pivot == -1)
             {
-                break;
+                *struct_pivot = i + base;
             }
 
-            rocsparse_int row_begin_j = csr_row_ptr[col_j] - base;
-            rocsparse_int row_diag_j  = diag_offset[col_j];
+            continue;
+        }
 
-            T local_sum = static_cast<T>(0);
+        // Block positions of i-th block row
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            nnz_entries[bsr_col_ind[j] - base] = j;
+        }
+
+        // Process each row of the block row
+        for(rocsparse_int r = 0; r < block_dim; ++r)
+        {
+            // Loop over the lower blocks
+            for(rocsparse_int j = row_begin; j < row_diag; ++j)
+            {
+                rocsparse_int block_col = bsr_col_ind[j] - base;
+                rocsparse_int diag_j    = diag_block_offset[block_col];
+
+                if(diag_j == -1)
+                {
+                    break;
+                }
+
+                // Multiplication factors of block j
+                for(rocsparse_int k = 0; k < block_dim; ++k)
+                {
+                    T diag_val = bsr_val[index(diag_j, k, k)];
+
+                    if(diag_val == static_cast<T>(0))
+                    {
+                        // Numerical zero diagonal
+                        *numeric_pivot = (*numeric_pivot == -1)
+                                             ? block_col + base
+                                             : std::min(*numeric_pivot, block_col + base);
+
+                        diag_val = static_cast<T>(1);
+                    }
+
+                    T val = bsr_val[index(j, r, k)] / diag_val;
+
+                    for(rocsparse_int t = k + 1; t < block_dim; ++t)
+                    {
+                        bsr_val[index(j, r, t)]
+                            = std::fma(-val, bsr_val[index(diag_j, k, t)], bsr_val[index(j, r, t)]);
+                    }
+
+                    bsr_val[index(j, r, k)] = val;
+                }
+
+                // Linear combination with the upper blocks of block row 'block_col'
+                for(rocsparse_int p = diag_j + 1; p < bsr_row_ptr[block_col + 1] - base; ++p)
+                {
+                    rocsparse_int m = nnz_entries[bsr_col_ind[p] - base];
+
+                    if(m == -1)
+                    {
+                        continue;
+                    }
+
+                    for(rocsparse_int k = 0; k < block_dim; ++k)
+                    {
+                        T val = bsr_val[index(j, r, k)];
+
+                        for(rocsparse_int t = 0; t < block_dim; ++t)
+                        {
+                            bsr_val[index(m, r, t)]
+                                = std::fma(-val, bsr_val[index(p, k, t)], bsr_val[index(m, r, t)]);
+                        }
+                    }
+                }
+            }
+
+            // Dense LU factorization of the diagonal block, rows above r are final
+            for(rocsparse_int q = 0; q < r; ++q)
+            {
+                T diag_val = bsr_val[index(row_diag, q, q)];
+
+                if(diag_val == static_cast<T>(0))
+                {
+                    diag_val = static_cast<T>(1);
+                }
+
+                T val = bsr_val[index(row_diag, r, q)] / diag_val;
+
+                for(rocsparse_int t = q + 1; t < block_dim; ++t)
+                {
+                    bsr_val[index(row_diag, r, t)] = std::fma(
+                        -val, bsr_val[index(row_diag, q, t)], bsr_val[index(row_diag, r, t)]);
+                }
+
+                for(rocsparse_int p = row_diag + 1; p < row_end; ++p)
+                {
+                    for(rocsparse_int t = 0; t < block_dim; ++t)
+                    {
+                        bsr_val[index(p, r, t)]
+                            = std::fma(-val, bsr_val[index(p, q, t)], bsr_val[index(p, r, t)]);
+                    }
+                }
+
+                bsr_val[index(row_diag, r, q)] = val;
+            }
+
+            if(bsr_val[index(row_diag, r, r)] == static_cast<T>(0))
+            {
+                // Numerical zero diagonal
+                *numeric_pivot
+                    = (*numeric_pivot == -1) ? i + base : std::min(*numeric_pivot, i + base);
+            }
+        }
+
+        // Clear block positions
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            nnz_entries[bsr_col_ind[j] - base] = -1;
+        }
+    }
+}
+
+template <typename T>
+inline void host_csric0(rocsparse_int                     M,
+                        const std::vector<rocsparse_int>& csr_row_ptr,
+                        const std::vector<rocsparse_int>& csr_col_ind,
+                        std::vector<T>&                   csr_val,
+                        rocsparse_index_base              base,
+                        rocsparse_int*                    struct_pivot,
+                        rocsparse_int*                    numeric_pivot)
+{
+    // Initialize pivot
+    *struct_pivot  = -1;
+    *numeric_pivot = -1;
+
+    // pointer of upper part of each row
+    std::vector<rocsparse_int> diag_offset(M);
+    std::vector<rocsparse_int> nnz_entries(M, 0);
+
+    // ai = 0 to N loop over all rows
+    for(rocsparse_int ai = 0; ai < M; ++ai)
+    {
+        // ai-th row entries
+        rocsparse_int row_begin = csr_row_ptr[ai] - base;
+        rocsparse_int row_end   = csr_row_ptr[ai + 1] - base;
+        rocsparse_int j;
+
+        // nnz position of ai-th row in val array
+        for(j = row_begin; j < row_end; ++j)
+        {
+            nnz_entries[csr_col_ind[j] - base] = j;
+        }
+
+        T sum = static_cast<T>(0);
+
+        bool has_diag = false;
+
+        // loop over ai-th row nnz entries
+        for(j = row_begin; j < row_end; ++j)
+        {
+            rocsparse_int col_j = csr_col_ind[j] - base;
+            T             val_j = csr_val[j];
+
+            // Mark diagonal and skip row
+            if(col_j == ai)
+            {
+                has_diag = true;
+                break;
+            }
+
+            // Skip upper triangular
+            if(col_j > ai)
+            {
+                break;
+            }
+
+            rocsparse_int row_begin_j = csr_row_ptr[col_j] - base;
+            rocsparse_int row_diag_j  = diag_offset[col_j];
+
+            T local_sum = static_cast<T>(0);
             T inv_diag  = csr_val[row_diag_j];
 
             // Check for numeric zero
@@ -2525,6 +3976,30 @@ inline void host_csric0(rocsparse_int                     M,
     }
 }
 
+// Mixed precision incomplete Cholesky factorization, the matrix is rounded to the
+// precision of U and factorized in the precision of U
+template <typename T, typename U>
+inline void host_csric0_mixed(rocsparse_int                     M,
+                              const std::vector<rocsparse_int>& csr_row_ptr,
+                              const std::vector<rocsparse_int>& csr_col_ind,
+                              const std::vector<T>&             csr_val,
+                              std::vector<U>&                   ic_val,
+                              rocsparse_index_base              base,
+                              rocsparse_int*                    struct_pivot,
+                              rocsparse_int*                    numeric_pivot)
+{
+    rocsparse_int nnz = csr_row_ptr[M] - base;
+
+    ic_val.resize(nnz);
+
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        ic_val[i] = rocsparse_convert<U>(csr_val[i]);
+    }
+
+    host_csric0(M, csr_row_ptr, csr_col_ind, ic_val, base, struct_pivot, numeric_pivot);
+}
+
 template <typename T>
 inline void host_csrilu0(rocsparse_int                     M,
                          const std::vector<rocsparse_int>& csr_row_ptr,
@@ -2621,6 +4096,73 @@ inline void host_csrilu0(rocsparse_int                     M,
     }
 }
 
+// Mixed precision incomplete LU factorization, the matrix is rounded to the precision
+// of U and factorized in the precision of U
+template <typename T, typename U>
+inline void host_csrilu0_mixed(rocsparse_int                     M,
+                               const std::vector<rocsparse_int>& csr_row_ptr,
+                               const std::vector<rocsparse_int>& csr_col_ind,
+                               const std::vector<T>&             csr_val,
+                               std::vector<U>&                   ilu_val,
+                               rocsparse_index_base              base,
+                               rocsparse_int*                    struct_pivot,
+                               rocsparse_int*                    numeric_pivot)
+{
+    rocsparse_int nnz = csr_row_ptr[M] - base;
+
+    ilu_val.resize(nnz);
+
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        ilu_val[i] = rocsparse_convert<U>(csr_val[i]);
+    }
+
+    host_csrilu0(M, csr_row_ptr, csr_col_ind, ilu_val, base, struct_pivot, numeric_pivot);
+}
+
+template <typename T>
+inline void host_csrilu0_strided_batched(rocsparse_int                     M,
+                                         const std::vector<rocsparse_int>& csr_row_ptr,
+                                         const std::vector<rocsparse_int>& csr_col_ind,
+                                         std::vector<T>&                   csr_val,
+                                         rocsparse_int                     stride_val,
+                                         rocsparse_int                     batch_count,
+                                         rocsparse_index_base              base,
+                                         rocsparse_int*                    struct_pivot,
+                                         rocsparse_int*                    numeric_pivot)
+{
+    rocsparse_int nnz = csr_row_ptr[M] - base;
+
+    // Initialize pivot
+    *struct_pivot  = -1;
+    *numeric_pivot = -1;
+
+    for(rocsparse_int b = 0; b < batch_count; ++b)
+    {
+        std::vector<T> val(csr_val.begin() + (size_t)b * stride_val,
+                           csr_val.begin() + (size_t)b * stride_val + nnz);
+
+        rocsparse_int batch_struct_pivot;
+        rocsparse_int batch_numeric_pivot;
+
+        host_csrilu0(
+            M, csr_row_ptr, csr_col_ind, val, base, &batch_struct_pivot, &batch_numeric_pivot);
+
+        std::copy(val.begin(), val.end(), csr_val.begin() + (size_t)b * stride_val);
+
+        // The structural pivot is shared by the batch, the numerical pivot is the
+        // first one over all matrices
+        *struct_pivot = batch_struct_pivot;
+
+        if(batch_numeric_pivot != -1)
+        {
+            *numeric_pivot = (*numeric_pivot == -1)
+                                 ? batch_numeric_pivot
+                                 : std::min(*numeric_pivot, batch_numeric_pivot);
+        }
+    }
+}
+
 /*
  * ===========================================================================
  *    conversion SPARSE
@@ -2765,170 +4307,780 @@ rocsparse_status host_csx2dense(rocsparse_int        m,
 
     case rocsparse_direction_row:
     {
-        static constexpr T s_zero = {};
-        for(rocsparse_int row = 0; row < m; ++row)
+        static constexpr T s_zero = {};
+        for(rocsparse_int row = 0; row < m; ++row)
+        {
+            for(rocsparse_int col = 0; col < n; ++col)
+            {
+                A[col * ld + row] = s_zero;
+            }
+
+            const rocsparse_int bound = csx_row_col_ptr[row + 1] - base;
+            for(rocsparse_int at = csx_row_col_ptr[row] - base; at < bound; ++at)
+            {
+                A[(csx_col_row_ind[at] - base) * ld + row] = csx_val[at];
+            }
+        }
+        return rocsparse_status_success;
+    }
+    }
+
+    return rocsparse_status_invalid_value;
+}
+
+template <typename I, typename J>
+inline void host_csr_to_coo(J                     M,
+                            I                     nnz,
+                            const std::vector<I>& csr_row_ptr,
+                            std::vector<J>&       coo_row_ind,
+                            rocsparse_index_base  base)
+{
+    // Resize coo_row_ind
+    coo_row_ind.resize(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J i = 0; i < M; ++i)
+    {
+        I row_begin = csr_row_ptr[i] - base;
+        I row_end   = csr_row_ptr[i + 1] - base;
+
+        for(I j = row_begin; j < row_end; ++j)
+        {
+            coo_row_ind[j] = i + base;
+        }
+    }
+}
+
+template <typename T, typename I, typename J>
+inline void host_csr_to_csc(J                     M,
+                            J                     N,
+                            I                     nnz,
+                            const std::vector<I>& csr_row_ptr,
+                            const std::vector<J>& csr_col_ind,
+                            const std::vector<T>& csr_val,
+                            std::vector<J>&       csc_row_ind,
+                            std::vector<I>&       csc_col_ptr,
+                            std::vector<T>&       csc_val,
+                            rocsparse_action      action,
+                            rocsparse_index_base  base)
+{
+    csc_row_ind.resize(nnz);
+    csc_col_ptr.resize(N + 1, 0);
+    csc_val.resize(nnz);
+
+    // Determine nnz per column
+    for(I i = 0; i < nnz; ++i)
+    {
+        ++csc_col_ptr[csr_col_ind[i] + 1 - base];
+    }
+
+    // Scan
+    for(J i = 0; i < N; ++i)
+    {
+        csc_col_ptr[i + 1] += csc_col_ptr[i];
+    }
+
+    // Fill row indices and values
+    for(J i = 0; i < M; ++i)
+    {
+        I row_begin = csr_row_ptr[i] - base;
+        I row_end   = csr_row_ptr[i + 1] - base;
+
+        for(I j = row_begin; j < row_end; ++j)
+        {
+            J col = csr_col_ind[j] - base;
+            I idx = csc_col_ptr[col];
+
+            csc_row_ind[idx] = i + base;
+            csc_val[idx]     = csr_val[j];
+
+            ++csc_col_ptr[col];
+        }
+    }
+
+    // Shift column pointer array
+    for(J i = N; i > 0; --i)
+    {
+        csc_col_ptr[i] = csc_col_ptr[i - 1] + base;
+    }
+
+    csc_col_ptr[0] = base;
+}
+
+template <typename T>
+inline void host_bsr_to_bsc(rocsparse_int                     mb,
+                            rocsparse_int                     nb,
+                            rocsparse_int                     nnzb,
+                            rocsparse_int                     bsr_dim,
+                            const std::vector<rocsparse_int>& bsr_row_ptr,
+                            const std::vector<rocsparse_int>& bsr_col_ind,
+                            const std::vector<T>&             bsr_val,
+                            std::vector<rocsparse_int>&       bsc_row_ind,
+                            std::vector<rocsparse_int>&       bsc_col_ptr,
+                            std::vector<T>&                   bsc_val,
+                            rocsparse_index_base              bsr_base,
+                            rocsparse_index_base              bsc_base)
+{
+    bsc_row_ind.resize(nnzb);
+    bsc_col_ptr.resize(nb + 1, 0);
+    bsc_val.resize(nnzb * bsr_dim * bsr_dim);
+
+    // Determine nnz per column
+    for(rocsparse_int i = 0; i < nnzb; ++i)
+    {
+        ++bsc_col_ptr[bsr_col_ind[i] + 1 - bsr_base];
+    }
+
+    // Scan
+    for(rocsparse_int i = 0; i < nb; ++i)
+    {
+        bsc_col_ptr[i + 1] += bsc_col_ptr[i];
+    }
+
+    // Fill row indices and values
+    for(rocsparse_int i = 0; i < mb; ++i)
+    {
+        rocsparse_int row_begin = bsr_row_ptr[i] - bsr_base;
+        rocsparse_int row_end   = bsr_row_ptr[i + 1] - bsr_base;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            rocsparse_int col = bsr_col_ind[j] - bsr_base;
+            rocsparse_int idx = bsc_col_ptr[col];
+
+            bsc_row_ind[idx] = i + bsc_base;
+
+            for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+            {
+                for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
+                {
+                    bsc_val[bsr_dim * bsr_dim * idx + bi + bj * bsr_dim]
+                        = bsr_val[bsr_dim * bsr_dim * j + bi * bsr_dim + bj];
+                }
+            }
+
+            ++bsc_col_ptr[col];
+        }
+    }
+
+    // Shift column pointer array
+    for(rocsparse_int i = nb; i > 0; --i)
+    {
+        bsc_col_ptr[i] = bsc_col_ptr[i - 1] + bsc_base;
+    }
+
+    bsc_col_ptr[0] = bsc_base;
+}
+
+template <typename T>
+inline void host_csr_to_bsr_block_dim_analysis(rocsparse_int                     M,
+                                               rocsparse_int                     N,
+                                               const std::vector<rocsparse_int>& csr_row_ptr,
+                                               const std::vector<rocsparse_int>& csr_col_ind,
+                                               const std::vector<rocsparse_int>& block_dims,
+                                               rocsparse_int                     sample_size,
+                                               std::vector<rocsparse_int>&       bsr_nnzb,
+                                               std::vector<float>&               fill_ratio,
+                                               std::vector<float>&               bsrmv_cost,
+                                               rocsparse_index_base              base)
+{
+    rocsparse_int num_block_dims = block_dims.size();
+
+    bsr_nnzb.resize(num_block_dims);
+    fill_ratio.resize(num_block_dims);
+    bsrmv_cost.resize(2 * num_block_dims);
+
+    // Wavefront size of the device
+    int             dev;
+    hipDeviceProp_t prop;
+
+    hipGetDevice(&dev);
+    hipGetDeviceProperties(&prop, dev);
+
+    rocsparse_int wfsize = prop.warpSize;
+    rocsparse_int nnz    = (M > 0) ? csr_row_ptr[M] - csr_row_ptr[0] : 0;
+
+    for(rocsparse_int i = 0; i < num_block_dims; ++i)
+    {
+        rocsparse_int bsr_dim = block_dims[i];
+
+        if(M == 0 || N == 0)
+        {
+            bsr_nnzb[i]           = 0;
+            fill_ratio[i]         = 1.0f;
+            bsrmv_cost[2 * i]     = 1.0f;
+            bsrmv_cost[2 * i + 1] = 1.0f;
+
+            continue;
+        }
+
+        rocsparse_int mb      = (M + bsr_dim - 1) / bsr_dim;
+        rocsparse_int nb      = (N + bsr_dim - 1) / bsr_dim;
+        rocsparse_int samples = (sample_size == 0) ? mb : std::min(sample_size, mb);
+
+        // Count non-zero blocks and entries of the sampled block rows
+        rocsparse_int sample_nnzb = 0;
+        rocsparse_int sample_nnz  = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel reduction(+ : sample_nnzb, sample_nnz)
+#endif
+        {
+            std::vector<bool> block_col(nb, false);
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif
+            for(rocsparse_int s = 0; s < samples; ++s)
+            {
+                rocsparse_int block_row = static_cast<int64_t>(s) * mb / samples;
+                rocsparse_int row_begin = block_row * bsr_dim;
+                rocsparse_int row_end   = std::min(M, row_begin + bsr_dim);
+
+                rocsparse_int begin = csr_row_ptr[row_begin] - base;
+                rocsparse_int end   = csr_row_ptr[row_end] - base;
+
+                sample_nnz += end - begin;
+
+                for(rocsparse_int j = begin; j < end; ++j)
+                {
+                    rocsparse_int col = (csr_col_ind[j] - base) / bsr_dim;
+
+                    if(!block_col[col])
+                    {
+                        block_col[col] = true;
+                        ++sample_nnzb;
+                    }
+                }
+
+                for(rocsparse_int j = begin; j < end; ++j)
+                {
+                    block_col[(csr_col_ind[j] - base) / bsr_dim] = false;
+                }
+            }
+        }
+
+        // Extrapolate the number of blocks from the entries covered by the samples
+        rocsparse_int nnzb = sample_nnzb;
+
+        if(sample_nnz > 0 && sample_nnz < nnz)
+        {
+            double scale = static_cast<double>(nnz) / sample_nnz;
+
+            nnzb = static_cast<rocsparse_int>(
+                std::min(std::round(sample_nnzb * scale), static_cast<double>(mb) * nb));
+            nnzb = std::min(nnzb, nnz);
+        }
+
+        bsr_nnzb[i]   = nnzb;
+        fill_ratio[i] = (nnz > 0) ? static_cast<float>(static_cast<double>(nnzb) * bsr_dim
+                                                       * bsr_dim / nnz)
+                                  : 1.0f;
+
+        for(rocsparse_int dir = 0; dir < 2; ++dir)
+        {
+            if(bsr_dim == 1 || nnz == 0)
+            {
+                bsrmv_cost[2 * i + dir] = 1.0f;
+
+                continue;
+            }
+
+            // Fraction of active lanes of the bsrmv kernel
+            rocsparse_int blocks_per_row = std::max(nnzb / mb, 1);
+            double        util;
+
+            if(bsr_dim <= 4)
+            {
+                rocsparse_int wf = (blocks_per_row < 8)    ? 4
+                                   : (blocks_per_row < 16) ? 8
+                                   : (blocks_per_row < 32) ? 16
+                                   : (blocks_per_row < 64) ? 32
+                                                           : 64;
+
+                wf   = std::min(wf, wfsize);
+                util = static_cast<double>(std::min(blocks_per_row, wf)) / wf;
+            }
+            else if(bsr_dim <= 32)
+            {
+                rocsparse_int blocks = (bsr_dim <= 8) ? 2 : 1;
+
+                util = static_cast<double>(std::min(blocks_per_row, blocks)) / blocks;
+            }
+            else
+            {
+                rocsparse_int nwf = 256 / wfsize;
+                rocsparse_int rows;
+                rocsparse_int cols;
+
+                if(dir == rocsparse_direction_row)
+                {
+                    rows = nwf * (((bsr_dim - 1) / nwf + 1 <= 4) ? 4 : 8);
+                    cols = wfsize;
+                }
+                else
+                {
+                    rocsparse_int tile = (bsr_dim - 1) / wfsize + 1;
+
+                    rows = wfsize * ((tile <= 1) ? 1 : ((tile <= 2) ? 2 : 4));
+                    cols = nwf;
+                }
+
+                util = static_cast<double>(bsr_dim) / (((bsr_dim - 1) / rows + 1) * rows)
+                       * bsr_dim / (((bsr_dim - 1) / cols + 1) * cols);
+            }
+
+            // Memory traffic of bsrmv relative to csrmv
+            double csr_bytes
+                = (M + 1.0 + nnz) * sizeof(rocsparse_int) + (M + N + nnz) * sizeof(T);
+            double bsr_bytes = (mb + 1.0 + nnzb) * sizeof(rocsparse_int)
+                               + ((mb + nb) * static_cast<double>(bsr_dim)
+                                  + static_cast<double>(nnzb) * bsr_dim * bsr_dim)
+                                     * sizeof(T);
+
+            bsrmv_cost[2 * i + dir] = static_cast<float>(bsr_bytes / util / csr_bytes);
+        }
+    }
+}
+
+template <typename T>
+inline void host_csr_to_hyb_ell_width(rocsparse_int                     M,
+                                      rocsparse_int                     nnz,
+                                      const std::vector<rocsparse_int>& csr_row_ptr,
+                                      rocsparse_int&                    ell_width,
+                                      rocsparse_int&                    coo_nnz,
+                                      std::vector<rocsparse_int>&       row_nnz_hist)
+{
+    ell_width = 0;
+    coo_nnz   = 0;
+
+    // Histogram of non-zero entries per row, longer rows share the last bin
+    rocsparse_int max_width = (M > 0 && nnz > 0) ? 2 * (nnz - 1) / M + 1 : 0;
+
+    row_nnz_hist.assign(max_width + 1, 0);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        ++row_nnz_hist[std::min(csr_row_ptr[i + 1] - csr_row_ptr[i], max_width)];
+    }
+
+    if(M == 0 || nnz == 0)
+    {
+        return;
+    }
+
+    // Memory traffic of ELL part including padding and COO part
+    auto bytes = [M](rocsparse_int width, rocsparse_int coo) {
+        double b = static_cast<double>(M) * width * (sizeof(rocsparse_int) + sizeof(T));
+
+        if(coo > 0)
+        {
+            b += coo * (2.0 * sizeof(rocsparse_int) + sizeof(T)) + 2.0 * M * sizeof(T);
+        }
+
+        return b;
+    };
+
+    rocsparse_int width_limit = std::min(max_width, std::numeric_limits<rocsparse_int>::max() / M);
+
+    // Start with a pure COO partition and widen the ELL part step by step
+    rocsparse_int rows = 0;
+    rocsparse_int coo  = nnz;
+    double        best = bytes(0, coo);
+
+    coo_nnz = coo;
+
+    for(rocsparse_int w = 0; w < width_limit; ++w)
+    {
+        rows += row_nnz_hist[w];
+        coo -= M - rows;
+
+        double b = bytes(w + 1, coo);
+
+        if(b < best)
+        {
+            best      = b;
+            ell_width = w + 1;
+            coo_nnz   = coo;
+        }
+    }
+}
+
+template <typename T>
+inline void host_csrmv_format_analysis(rocsparse_operation               trans,
+                                       rocsparse_int                     M,
+                                       rocsparse_int                     N,
+                                       const std::vector<rocsparse_int>& csr_row_ptr,
+                                       const std::vector<rocsparse_int>& csr_col_ind,
+                                       std::vector<float>&               predicted_cost,
+                                       rocsparse_spmv_format&            format,
+                                       rocsparse_int&                    bsr_dim,
+                                       rocsparse_index_base              base)
+{
+    static constexpr float inf = std::numeric_limits<float>::infinity();
+
+    predicted_cost.assign(rocsparse_spmv_format_bsr + 1, 1.0f);
+
+    format  = rocsparse_spmv_format_csr;
+    bsr_dim = 0;
+
+    rocsparse_int nnz = (M > 0) ? csr_row_ptr[M] - csr_row_ptr[0] : 0;
+
+    // Empty matrices are computed by csrmv
+    if(M == 0 || N == 0 || nnz == 0)
+    {
+        return;
+    }
+
+    predicted_cost[rocsparse_spmv_format_ell] = inf;
+    predicted_cost[rocsparse_spmv_format_hyb] = inf;
+    predicted_cost[rocsparse_spmv_format_bsr] = inf;
+
+    // Transposed matrices are computed by csrmv
+    if(trans != rocsparse_operation_none)
+    {
+        return;
+    }
+
+    double csr_bytes = (M + 1.0 + nnz) * sizeof(rocsparse_int) + (M + N + nnz) * sizeof(T);
+
+    // ELL width
+    rocsparse_int ell_width = 0;
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        ell_width = std::max(ell_width, csr_row_ptr[i + 1] - csr_row_ptr[i]);
+    }
+
+    // ELL width and COO entries of the HYB format with auto partition
+    rocsparse_int              hyb_width;
+    rocsparse_int              coo_nnz;
+    std::vector<rocsparse_int> row_nnz_hist;
+
+    host_csr_to_hyb_ell_width<T>(M, nnz, csr_row_ptr, hyb_width, coo_nnz, row_nnz_hist);
+
+    if(static_cast<int64_t>(M) * ell_width <= std::numeric_limits<rocsparse_int>::max())
+    {
+        double ell_bytes = static_cast<double>(M) * ell_width * (sizeof(rocsparse_int) + sizeof(T))
+                           + (M + static_cast<double>(N)) * sizeof(T);
+
+        predicted_cost[rocsparse_spmv_format_ell] = static_cast<float>(ell_bytes / csr_bytes);
+    }
+
+    // The auto partition limits the HYB width to addressable ELL parts
+    double hyb_bytes = static_cast<double>(M) * hyb_width * (sizeof(rocsparse_int) + sizeof(T));
+
+    if(coo_nnz > 0)
+    {
+        hyb_bytes += coo_nnz * (2.0 * sizeof(rocsparse_int) + sizeof(T)) + 2.0 * M * sizeof(T);
+    }
+
+    hyb_bytes += (M + static_cast<double>(N)) * sizeof(T);
+
+    predicted_cost[rocsparse_spmv_format_hyb] = static_cast<float>(hyb_bytes / csr_bytes);
+
+    // Block dimensions that divide both matrix dimensions
+    std::vector<rocsparse_int> block_dims;
+
+    for(rocsparse_int dim : {2, 3, 4, 8, 16})
+    {
+        if(M % dim == 0 && N % dim == 0)
+        {
+            block_dims.push_back(dim);
+        }
+    }
+
+    if(!block_dims.empty())
+    {
+        std::vector<rocsparse_int> bsr_nnzb;
+        std::vector<float>         fill_ratio;
+        std::vector<float>         bsrmv_cost;
+
+        host_csr_to_bsr_block_dim_analysis<T>(
+            M, N, csr_row_ptr, csr_col_ind, block_dims, 0, bsr_nnzb, fill_ratio, bsrmv_cost, base);
+
+        for(size_t i = 0; i < block_dims.size(); ++i)
         {
-            for(rocsparse_int col = 0; col < n; ++col)
+            if(static_cast<int64_t>(bsr_nnzb[i]) * block_dims[i] * block_dims[i]
+               > std::numeric_limits<rocsparse_int>::max())
             {
-                A[col * ld + row] = s_zero;
+                continue;
             }
 
-            const rocsparse_int bound = csx_row_col_ptr[row + 1] - base;
-            for(rocsparse_int at = csx_row_col_ptr[row] - base; at < bound; ++at)
+            for(rocsparse_int dir = 0; dir < 2; ++dir)
             {
-                A[(csx_col_row_ind[at] - base) * ld + row] = csx_val[at];
+                if(bsrmv_cost[2 * i + dir] < predicted_cost[rocsparse_spmv_format_bsr])
+                {
+                    predicted_cost[rocsparse_spmv_format_bsr] = bsrmv_cost[2 * i + dir];
+
+                    bsr_dim = block_dims[i];
+                }
             }
         }
-        return rocsparse_status_success;
-    }
     }
 
-    return rocsparse_status_invalid_value;
+    // Storage format with the lowest predicted cost
+    for(int f = 0; f <= rocsparse_spmv_format_bsr; ++f)
+    {
+        if(predicted_cost[f] < predicted_cost[format])
+        {
+            format = static_cast<rocsparse_spmv_format>(f);
+        }
+    }
 }
 
-inline void host_csr_to_coo(rocsparse_int                     M,
-                            rocsparse_int                     nnz,
-                            const std::vector<rocsparse_int>& csr_row_ptr,
-                            std::vector<rocsparse_int>&       coo_row_ind,
-                            rocsparse_index_base              base)
+inline void host_csr_to_vbr_partition(rocsparse_int                     M,
+                                      rocsparse_int                     N,
+                                      const std::vector<rocsparse_int>& csr_row_ptr,
+                                      const std::vector<rocsparse_int>& csr_col_ind,
+                                      rocsparse_int&                    mb,
+                                      rocsparse_int&                    nb,
+                                      std::vector<rocsparse_int>&       vbr_row_ptn,
+                                      std::vector<rocsparse_int>&       vbr_col_ptn,
+                                      rocsparse_index_base              csr_base,
+                                      rocsparse_index_base              vbr_base)
 {
-    // Resize coo_row_ind
-    coo_row_ind.resize(nnz);
+    // Maximum number of rows of a detected block row
+    static constexpr rocsparse_int max_block_rows = 64;
+
+    // Merge consecutive rows with identical sparsity pattern
+    vbr_row_ptn.clear();
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(dynamic, 1024)
-#endif
     for(rocsparse_int i = 0; i < M; ++i)
     {
-        rocsparse_int row_begin = csr_row_ptr[i] - base;
-        rocsparse_int row_end   = csr_row_ptr[i + 1] - base;
+        bool start = (i % max_block_rows == 0);
 
-        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        if(!start)
         {
-            coo_row_ind[j] = i + base;
+            start = !std::equal(csr_col_ind.begin() + csr_row_ptr[i - 1] - csr_base,
+                                csr_col_ind.begin() + csr_row_ptr[i] - csr_base,
+                                csr_col_ind.begin() + csr_row_ptr[i] - csr_base,
+                                csr_col_ind.begin() + csr_row_ptr[i + 1] - csr_base);
+        }
+
+        if(start)
+        {
+            vbr_row_ptn.push_back(i + vbr_base);
         }
     }
-}
 
-template <typename T>
-inline void host_csr_to_csc(rocsparse_int                     M,
-                            rocsparse_int                     N,
-                            rocsparse_int                     nnz,
-                            const std::vector<rocsparse_int>& csr_row_ptr,
-                            const std::vector<rocsparse_int>& csr_col_ind,
-                            const std::vector<T>&             csr_val,
-                            std::vector<rocsparse_int>&       csc_row_ind,
-                            std::vector<rocsparse_int>&       csc_col_ptr,
-                            std::vector<T>&                   csc_val,
-                            rocsparse_action                  action,
-                            rocsparse_index_base              base)
-{
-    csc_row_ind.resize(nnz);
-    csc_col_ptr.resize(N + 1, 0);
-    csc_val.resize(nnz);
+    mb = vbr_row_ptn.size();
+    vbr_row_ptn.push_back(M + vbr_base);
 
-    // Determine nnz per column
-    for(rocsparse_int i = 0; i < nnz; ++i)
-    {
-        ++csc_col_ptr[csr_col_ind[i] + 1 - base];
-    }
+    // Split columns, wherever a row contains exactly one of two consecutive columns
+    std::vector<bool> col_start(N, false);
 
-    // Scan
-    for(rocsparse_int i = 0; i < N; ++i)
+    if(N > 0)
     {
-        csc_col_ptr[i + 1] += csc_col_ptr[i];
+        col_start[0] = true;
     }
 
-    // Fill row indices and values
     for(rocsparse_int i = 0; i < M; ++i)
     {
-        rocsparse_int row_begin = csr_row_ptr[i] - base;
-        rocsparse_int row_end   = csr_row_ptr[i + 1] - base;
-
-        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        for(rocsparse_int j = csr_row_ptr[i] - csr_base; j < csr_row_ptr[i + 1] - csr_base; ++j)
         {
-            rocsparse_int col = csr_col_ind[j] - base;
-            rocsparse_int idx = csc_col_ptr[col];
+            rocsparse_int col = csr_col_ind[j] - csr_base;
 
-            csc_row_ind[idx] = i + base;
-            csc_val[idx]     = csr_val[j];
+            if(j == csr_row_ptr[i] - csr_base || csr_col_ind[j - 1] - csr_base != col - 1)
+            {
+                col_start[col] = true;
+            }
 
-            ++csc_col_ptr[col];
+            if(col + 1 < N
+               && (j == csr_row_ptr[i + 1] - csr_base - 1
+                   || csr_col_ind[j + 1] - csr_base != col + 1))
+            {
+                col_start[col + 1] = true;
+            }
         }
     }
 
-    // Shift column pointer array
-    for(rocsparse_int i = N; i > 0; --i)
+    vbr_col_ptn.clear();
+
+    for(rocsparse_int i = 0; i < N; ++i)
     {
-        csc_col_ptr[i] = csc_col_ptr[i - 1] + base;
+        if(col_start[i])
+        {
+            vbr_col_ptn.push_back(i + vbr_base);
+        }
     }
 
-    csc_col_ptr[0] = base;
+    nb = vbr_col_ptn.size();
+    vbr_col_ptn.push_back(N + vbr_base);
 }
 
 template <typename T>
-inline void host_bsr_to_bsc(rocsparse_int                     mb,
+inline void host_csr_to_vbr(rocsparse_direction               dir,
+                            rocsparse_int                     M,
+                            rocsparse_int                     N,
+                            const std::vector<rocsparse_int>& csr_row_ptr,
+                            const std::vector<rocsparse_int>& csr_col_ind,
+                            const std::vector<T>&             csr_val,
+                            rocsparse_int                     mb,
                             rocsparse_int                     nb,
-                            rocsparse_int                     nnzb,
-                            rocsparse_int                     bsr_dim,
-                            const std::vector<rocsparse_int>& bsr_row_ptr,
-                            const std::vector<rocsparse_int>& bsr_col_ind,
-                            const std::vector<T>&             bsr_val,
-                            std::vector<rocsparse_int>&       bsc_row_ind,
-                            std::vector<rocsparse_int>&       bsc_col_ptr,
-                            std::vector<T>&                   bsc_val,
-                            rocsparse_index_base              bsr_base,
-                            rocsparse_index_base              bsc_base)
+                            const std::vector<rocsparse_int>& vbr_row_ptn,
+                            const std::vector<rocsparse_int>& vbr_col_ptn,
+                            std::vector<rocsparse_int>&       vbr_row_ptr,
+                            std::vector<rocsparse_int>&       vbr_col_ind,
+                            std::vector<rocsparse_int>&       vbr_val_ptr,
+                            std::vector<T>&                   vbr_val,
+                            rocsparse_index_base              csr_base,
+                            rocsparse_index_base              vbr_base)
 {
-    bsc_row_ind.resize(nnzb);
-    bsc_col_ptr.resize(nb + 1, 0);
-    bsc_val.resize(nnzb * bsr_dim * bsr_dim);
+    // Block column of each column
+    std::vector<rocsparse_int> col_map(N);
 
-    // Determine nnz per column
-    for(rocsparse_int i = 0; i < nnzb; ++i)
+    for(rocsparse_int j = 0; j < nb; ++j)
     {
-        ++bsc_col_ptr[bsr_col_ind[i] + 1 - bsr_base];
+        for(rocsparse_int c = vbr_col_ptn[j] - vbr_base; c < vbr_col_ptn[j + 1] - vbr_base; ++c)
+        {
+            col_map[c] = j;
+        }
     }
 
-    // Scan
-    for(rocsparse_int i = 0; i < nb; ++i)
-    {
-        bsc_col_ptr[i + 1] += bsc_col_ptr[i];
-    }
+    vbr_row_ptr.resize(mb + 1);
+    vbr_col_ind.clear();
+    vbr_val_ptr.assign(1, vbr_base);
+
+    vbr_row_ptr[0] = vbr_base;
+
+    // Non-zero blocks of each block row, in ascending order
+    std::vector<rocsparse_int> block_pos(nb, -1);
 
-    // Fill row indices and values
     for(rocsparse_int i = 0; i < mb; ++i)
     {
-        rocsparse_int row_begin = bsr_row_ptr[i] - bsr_base;
-        rocsparse_int row_end   = bsr_row_ptr[i + 1] - bsr_base;
+        rocsparse_int row_begin  = vbr_row_ptn[i] - vbr_base;
+        rocsparse_int row_end    = vbr_row_ptn[i + 1] - vbr_base;
+        rocsparse_int row_height = row_end - row_begin;
 
-        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        std::vector<rocsparse_int> block_cols;
+
+        for(rocsparse_int r = row_begin; r < row_end; ++r)
         {
-            rocsparse_int col = bsr_col_ind[j] - bsr_base;
-            rocsparse_int idx = bsc_col_ptr[col];
+            for(rocsparse_int j = csr_row_ptr[r] - csr_base; j < csr_row_ptr[r + 1] - csr_base; ++j)
+            {
+                block_cols.push_back(col_map[csr_col_ind[j] - csr_base]);
+            }
+        }
 
-            bsc_row_ind[idx] = i + bsc_base;
+        std::sort(block_cols.begin(), block_cols.end());
+        block_cols.erase(std::unique(block_cols.begin(), block_cols.end()), block_cols.end());
 
-            for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+        for(rocsparse_int block_col : block_cols)
+        {
+            rocsparse_int col_width = vbr_col_ptn[block_col + 1] - vbr_col_ptn[block_col];
+
+            block_pos[block_col] = vbr_col_ind.size();
+
+            vbr_col_ind.push_back(block_col + vbr_base);
+            vbr_val_ptr.push_back(vbr_val_ptr.back() + row_height * col_width);
+        }
+
+        vbr_row_ptr[i + 1] = vbr_col_ind.size() + vbr_base;
+
+        // Scatter the entries into the dense blocks
+        vbr_val.resize(vbr_val_ptr.back() - vbr_base, static_cast<T>(0));
+
+        for(rocsparse_int r = row_begin; r < row_end; ++r)
+        {
+            for(rocsparse_int j = csr_row_ptr[r] - csr_base; j < csr_row_ptr[r + 1] - csr_base; ++j)
             {
-                for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
+                rocsparse_int col        = csr_col_ind[j] - csr_base;
+                rocsparse_int block_col  = col_map[col];
+                rocsparse_int col_offset = vbr_col_ptn[block_col] - vbr_base;
+                rocsparse_int col_width  = vbr_col_ptn[block_col + 1] - vbr_base - col_offset;
+
+                rocsparse_int idx = vbr_val_ptr[block_pos[block_col]] - vbr_base;
+
+                if(dir == rocsparse_direction_row)
                 {
-                    bsc_val[bsr_dim * bsr_dim * idx + bi + bj * bsr_dim]
-                        = bsr_val[bsr_dim * bsr_dim * j + bi * bsr_dim + bj];
+                    idx += col_width * (r - row_begin) + col - col_offset;
+                }
+                else
+                {
+                    idx += row_height * (col - col_offset) + r - row_begin;
                 }
-            }
 
-            ++bsc_col_ptr[col];
+                vbr_val[idx] = csr_val[j];
+            }
         }
     }
+}
 
-    // Shift column pointer array
-    for(rocsparse_int i = nb; i > 0; --i)
+// Size of the CSRDC column index data relative to the CSR column indices, see
+// rocsparse_csr2csrdc_nnz()
+inline float host_csrdc_compression_ratio(rocsparse_int M,
+                                          rocsparse_int nnz,
+                                          rocsparse_int nnz_exc,
+                                          rocsparse_int delta_bits)
+{
+    if(nnz == 0)
     {
-        bsc_col_ptr[i] = bsc_col_ptr[i - 1] + bsc_base;
+        return 0.0f;
     }
 
-    bsc_col_ptr[0] = bsc_base;
+    float csr_bytes   = static_cast<float>(sizeof(rocsparse_int)) * nnz;
+    float csrdc_bytes = static_cast<float>(sizeof(rocsparse_int)) * (2 * M + 1 + nnz_exc)
+                        + static_cast<float>(delta_bits / 8) * nnz;
+
+    return csr_bytes / csrdc_bytes;
+}
+
+// Convert the column indices of a CSR matrix into delta compressed column indices. The
+// deltas are stored as delta_bits / 8 bytes per entry, in little endian byte order.
+// Returns the compression ratio.
+inline float host_csr_to_csrdc(rocsparse_int                     M,
+                               rocsparse_int                     delta_bits,
+                               const std::vector<rocsparse_int>& csr_row_ptr,
+                               const std::vector<rocsparse_int>& csr_col_ind,
+                               std::vector<rocsparse_int>&       csrdc_col_base,
+                               std::vector<uint8_t>&             csrdc_delta,
+                               std::vector<rocsparse_int>&       csrdc_exc_ptr,
+                               std::vector<rocsparse_int>&       csrdc_exc_col,
+                               rocsparse_index_base              base)
+{
+    rocsparse_int nnz    = csr_row_ptr[M] - csr_row_ptr[0];
+    rocsparse_int bytes  = delta_bits / 8;
+    rocsparse_int escape = (1 << delta_bits) - 1;
+
+    csrdc_col_base.resize(M);
+    csrdc_delta.assign(bytes * nnz, 0);
+    csrdc_exc_ptr.resize(M + 1);
+    csrdc_exc_col.clear();
+
+    csrdc_exc_ptr[0] = base;
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row_begin = csr_row_ptr[i] - base;
+        rocsparse_int row_end   = csr_row_ptr[i + 1] - base;
+
+        // Empty rows get column base zero
+        csrdc_col_base[i] = (row_begin < row_end) ? csr_col_ind[row_begin] : base;
+
+        for(rocsparse_int j = row_begin + 1; j < row_end; ++j)
+        {
+            rocsparse_int gap   = csr_col_ind[j] - csr_col_ind[j - 1];
+            rocsparse_int delta = gap;
+
+            if(gap < 0 || gap >= escape)
+            {
+                delta = escape;
+                csrdc_exc_col.push_back(csr_col_ind[j]);
+            }
+
+            for(rocsparse_int b = 0; b < bytes; ++b)
+            {
+                csrdc_delta[bytes * j + b] = (delta >> (8 * b)) & 0xff;
+            }
+        }
+
+        csrdc_exc_ptr[i + 1] = csrdc_exc_col.size() + base;
+    }
+
+    return host_csrdc_compression_ratio(M, nnz, csrdc_exc_col.size(), delta_bits);
 }
 
 template <typename T>
@@ -2992,6 +5144,70 @@ inline void host_csr_to_ell(rocsparse_int                     M,
     }
 }
 
+// Fraction of the M x dia_num_diag DIA entries that are occupied by non-zero entries,
+// see rocsparse_csr2dia_ndiag()
+inline float host_dia_fill(rocsparse_int M, rocsparse_int nnz, rocsparse_int dia_num_diag)
+{
+    if(M == 0 || dia_num_diag == 0)
+    {
+        return 0.0f;
+    }
+
+    return static_cast<float>(nnz) / (static_cast<float>(M) * dia_num_diag);
+}
+
+// Convert a CSR matrix into DIA format. Returns the diagonal fill.
+template <typename T>
+inline float host_csr_to_dia(rocsparse_int                     M,
+                             rocsparse_int                     N,
+                             const std::vector<rocsparse_int>& csr_row_ptr,
+                             const std::vector<rocsparse_int>& csr_col_ind,
+                             const std::vector<T>&             csr_val,
+                             std::vector<rocsparse_int>&       dia_offset,
+                             std::vector<T>&                   dia_val,
+                             rocsparse_int&                    dia_num_diag,
+                             rocsparse_index_base              base)
+{
+    // Diagonal with offset k is stored at position k + M - 1
+    std::vector<rocsparse_int> diag_pos(M + N - 1, 0);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            diag_pos[csr_col_ind[j] - base - i + M - 1] = 1;
+        }
+    }
+
+    // Determine the occupied diagonals and their position in the DIA structure
+    dia_num_diag = 0;
+    dia_offset.clear();
+
+    for(rocsparse_int k = 0; k < M + N - 1; ++k)
+    {
+        if(diag_pos[k] != 0)
+        {
+            dia_offset.push_back(k - M + 1);
+            diag_pos[k] = dia_num_diag++;
+        }
+    }
+
+    dia_val.assign(static_cast<size_t>(M) * dia_num_diag, static_cast<T>(0));
+
+    // Fill DIA matrix with data
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            rocsparse_int d = diag_pos[csr_col_ind[j] - base - i + M - 1];
+
+            dia_val[d * M + i] = csr_val[j];
+        }
+    }
+
+    return host_dia_fill(M, csr_row_ptr[M] - csr_row_ptr[0], dia_num_diag);
+}
+
 template <typename T>
 inline void host_csr_to_hyb(rocsparse_int                     M,
                             rocsparse_int                     nnz,
@@ -3016,7 +5232,14 @@ inline void host_csr_to_hyb(rocsparse_int                     M,
     if(part == rocsparse_hyb_partition_auto || part == rocsparse_hyb_partition_user)
     {
         // Determine ELL width
-        ell_width = (part == rocsparse_hyb_partition_auto) ? (nnz - 1) / M + 1 : ell_width;
+        if(part == rocsparse_hyb_partition_auto)
+        {
+            rocsparse_int              auto_coo_nnz;
+            std::vector<rocsparse_int> row_nnz_hist;
+
+            host_csr_to_hyb_ell_width<T>(
+                M, nnz, csr_row_ptr, ell_width, auto_coo_nnz, row_nnz_hist);
+        }
 
         // Determine COO nnz
         for(rocsparse_int i = 0; i < M; ++i)
@@ -3179,22 +5402,23 @@ inline void host_csr_to_csr_compress(rocsparse_int                     M,
     }
 }
 
-inline void host_coo_to_csr(rocsparse_int                     M,
-                            rocsparse_int                     nnz,
-                            const std::vector<rocsparse_int>& coo_row_ind,
-                            std::vector<rocsparse_int>&       csr_row_ptr,
-                            rocsparse_index_base              base)
+template <typename I, typename J>
+inline void host_coo_to_csr(J                     M,
+                            I                     nnz,
+                            const std::vector<J>& coo_row_ind,
+                            std::vector<I>&       csr_row_ptr,
+                            rocsparse_index_base  base)
 {
     // Resize and initialize csr_row_ptr with zeros
     csr_row_ptr.resize(M + 1, 0);
 
-    for(rocsparse_int i = 0; i < nnz; ++i)
+    for(I i = 0; i < nnz; ++i)
     {
         ++csr_row_ptr[coo_row_ind[i] + 1 - base];
     }
 
     csr_row_ptr[0] = base;
-    for(rocsparse_int i = 0; i < M; ++i)
+    for(J i = 0; i < M; ++i)
     {
         csr_row_ptr[i + 1] += csr_row_ptr[i];
     }
@@ -3272,6 +5496,67 @@ inline void host_ell_to_csr(rocsparse_int                     M,
     }
 }
 
+template <typename T>
+inline void host_dia_to_csr(rocsparse_int                     M,
+                            rocsparse_int                     N,
+                            rocsparse_int                     dia_num_diag,
+                            const std::vector<rocsparse_int>& dia_offset,
+                            const std::vector<T>&             dia_val,
+                            std::vector<rocsparse_int>&       csr_row_ptr,
+                            std::vector<rocsparse_int>&       csr_col_ind,
+                            std::vector<T>&                   csr_val,
+                            rocsparse_int&                    csr_nnz,
+                            rocsparse_index_base              csr_base)
+{
+    csr_row_ptr.resize(M + 1, 0);
+
+    // Every diagonal entry within the matrix is a CSR entry
+    csr_nnz = csr_base;
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        csr_row_ptr[i] = csr_nnz;
+
+        for(rocsparse_int d = 0; d < dia_num_diag; ++d)
+        {
+            rocsparse_int col = i + dia_offset[d];
+
+            if(col >= 0 && col < N)
+            {
+                ++csr_nnz;
+            }
+        }
+    }
+
+    csr_row_ptr[M] = csr_nnz;
+    csr_nnz -= csr_base;
+
+    // Allocate memory for columns and values
+    csr_col_ind.resize(csr_nnz);
+    csr_val.resize(csr_nnz);
+
+    // Fill CSR structure
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int csr_idx = csr_row_ptr[i] - csr_base;
+
+        for(rocsparse_int d = 0; d < dia_num_diag; ++d)
+        {
+            rocsparse_int col = i + dia_offset[d];
+
+            if(col >= 0 && col < N)
+            {
+                csr_col_ind[csr_idx] = col + csr_base;
+                csr_val[csr_idx]     = dia_val[d * M + i];
+
+                ++csr_idx;
+            }
+        }
+    }
+}
+
 template <typename T>
 inline void host_coosort_by_column(rocsparse_int               M,
                                    rocsparse_int               nnz,
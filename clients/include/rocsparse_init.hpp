@@ -33,6 +33,7 @@
 #include <cstdio>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <rocsparse.h>
 #include <vector>
 
@@ -46,10 +47,19 @@ template <typename T>
 inline void rocsparse_init(
     std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
+    uint64_t key = rocsparse_rng_key();
+
+    // Each entry draws from its own stream, indexed by its logical position
+#ifdef _OPENMP
+#pragma omp parallel for collapse(2)
+#endif
     for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
-        for(size_t i = 0; i < M; ++i)
-            for(size_t j = 0; j < N; ++j)
-                A[i + j * lda + i_batch * stride] = random_generator<T>();
+        for(size_t j = 0; j < N; ++j)
+            for(size_t i = 0; i < M; ++i)
+            {
+                rocsparse_philox4x32 rng(key, (i_batch * N + j) * M + i);
+                A[i + j * lda + i_batch * stride] = random_generator<T>(rng);
+            }
 }
 
 // Initializes sparse index vector with nnz entries ranging from start to end
@@ -84,11 +94,18 @@ template <typename T>
 inline void rocsparse_init_alternating_sign(
     std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
 {
+    uint64_t key = rocsparse_rng_key();
+
+#ifdef _OPENMP
+#pragma omp parallel for collapse(2)
+#endif
     for(size_t i_batch = 0; i_batch < batch_count; i_batch++)
-        for(size_t i = 0; i < M; ++i)
-            for(size_t j = 0; j < N; ++j)
+        for(size_t j = 0; j < N; ++j)
+            for(size_t i = 0; i < M; ++i)
             {
-                auto value                        = random_generator<T>();
+                rocsparse_philox4x32 rng(key, (i_batch * N + j) * M + i);
+
+                auto value                        = random_generator<T>(rng);
                 A[i + j * lda + i_batch * stride] = (i ^ j) & 1 ? value : -value;
             }
 }
@@ -114,7 +131,12 @@ inline void rocsparse_init_nan(
 }
 
 /* ==================================================================================== */
-/*! \brief  Generate a random sparse matrix in COO format */
+/*! \brief  Generate a random sparse matrix in COO format
+ *
+ *  Row lengths, column indices and values are sampled from counter-based streams,
+ *  keyed by entry or row index. Each row is generated independently, such that the
+ *  resulting matrix does not depend on the number of threads.
+ */
 template <typename T>
 inline void rocsparse_init_coo_matrix(std::vector<rocsparse_int>& row_ind,
                                       std::vector<rocsparse_int>& col_ind,
@@ -139,6 +161,13 @@ inline void rocsparse_init_coo_matrix(std::vector<rocsparse_int>& row_ind,
         full_rank = false;
     }
 
+    // If nnz > M * N, matrix cannot be generated
+    if(nnz > M * N)
+    {
+        std::cerr << "ERROR: nnz > M * N, cannot generate matrix" << std::endl;
+        nnz = M * N;
+    }
+
     if(row_ind.size() != nnz)
     {
         row_ind.resize(nnz);
@@ -152,108 +181,169 @@ inline void rocsparse_init_coo_matrix(std::vector<rocsparse_int>& row_ind,
         val.resize(nnz);
     }
 
-    // Add diagonal entry, if full rank is flagged
-    size_t i = 0;
+    if(nnz == 0)
+    {
+        return;
+    }
+
+    // Independent keys for row, column and value sampling
+    uint64_t key_row = rocsparse_rng_key();
+    uint64_t key_col = rocsparse_rng_key();
+    uint64_t key_val = rocsparse_rng_key();
+
+    // Row lengths, diagonal entry first, if full rank is flagged
+    std::vector<size_t> row_ptr(M + 1, 0);
 
     if(full_rank)
     {
-        for(; i < M; ++i)
+        for(size_t i = 0; i < M; ++i)
         {
-            row_ind[i] = i;
+            row_ptr[i + 1] = 1;
         }
     }
 
-    // Uniform distributed row indices
-    for(; i < nnz; ++i)
+    // Uniform distributed row indices, counted into a histogram
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(size_t i = (full_rank ? M : 0); i < nnz; ++i)
     {
-        row_ind[i] = random_generator<rocsparse_int>(0, M - 1);
-    }
+        rocsparse_philox4x32 rng(key_row, i);
 
-    // Sort row indices
-    std::sort(row_ind.begin(), row_ind.end());
+        size_t row = rng.uniform_int(0, M - 1);
 
-    // Sample column indices
-    std::vector<bool> check(nnz, false);
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+        ++row_ptr[row + 1];
+    }
 
-    i = 0;
-    while(i < nnz)
+    // Rows cannot hold more than N entries, move the surplus to the next rows
+    size_t surplus = 0;
+    for(size_t pass = 0; pass < 2; ++pass)
     {
-        size_t begin = i;
-        while(row_ind[i] == row_ind[begin])
+        for(size_t i = 0; i < M; ++i)
         {
-            ++i;
-            if(i >= nnz)
+            size_t& n = row_ptr[i + 1];
+
+            if(n > N)
+            {
+                surplus += n - N;
+                n = N;
+            }
+            else if(surplus > 0)
             {
-                break;
+                size_t move = std::min(surplus, N - n);
+
+                n += move;
+                surplus -= move;
             }
         }
+    }
 
-        // Sample i disjunct column indices
-        size_t idx = begin;
+    // Prefix sum to obtain row offsets
+    for(size_t i = 0; i < M; ++i)
+    {
+        row_ptr[i + 1] += row_ptr[i];
+    }
 
-        if(full_rank)
-        {
-            check[row_ind[idx]] = true;
-            col_ind[idx++]      = row_ind[begin];
-        }
+    // Sample column indices row by row
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        // Disjunct check array, local to each thread
+        std::vector<bool> check(N, false);
 
-        while(idx < i)
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif
+        for(size_t row = 0; row < M; ++row)
         {
-            // Normal distribution around the diagonal
-            rocsparse_int rng = (i - begin) * random_generator_normal<double>();
+            size_t begin = row_ptr[row];
+            size_t end   = row_ptr[row + 1];
+            size_t idx   = begin;
 
-            if(M <= N)
+            rocsparse_philox4x32 rng(key_col, row);
+
+            for(size_t j = begin; j < end; ++j)
             {
-                rng += row_ind[begin];
+                row_ind[j] = row + base;
             }
 
-            // Repeat if running out of bounds
-            if(rng < 0 || rng > N - 1)
+            if(full_rank)
             {
-                continue;
+                check[row]     = true;
+                col_ind[idx++] = row;
             }
 
-            // Check for disjunct column index in current row
-            if(!check[rng])
+            // Bound the number of rejections, afterwards resolve collisions by probing
+            size_t max_trials = 32 * (end - begin) + 64;
+            size_t trials     = 0;
+
+            while(idx < end)
             {
-                check[rng]     = true;
-                col_ind[idx++] = rng;
+                int64_t col;
+
+                if(trials++ < max_trials)
+                {
+                    // Normal distribution around the diagonal
+                    col = static_cast<int64_t>((end - begin) * rng.normal());
+
+                    if(M <= N)
+                    {
+                        col += row;
+                    }
+
+                    // Repeat if running out of bounds
+                    if(col < 0 || col > static_cast<int64_t>(N) - 1)
+                    {
+                        continue;
+                    }
+                }
+                else
+                {
+                    col = rng.uniform_int(0, N - 1);
+
+                    while(check[col])
+                    {
+                        col = (col + 1 == static_cast<int64_t>(N)) ? 0 : col + 1;
+                    }
+                }
+
+                // Check for disjunct column index in current row
+                if(!check[col])
+                {
+                    check[col]     = true;
+                    col_ind[idx++] = col;
+                }
             }
-        }
 
-        // Reset disjunct check array
-        for(size_t j = begin; j < i; ++j)
-        {
-            check[col_ind[j]] = false;
-        }
+            // Reset disjunct check array
+            for(size_t j = begin; j < end; ++j)
+            {
+                check[col_ind[j]] = false;
+            }
 
-        // Partially sort column indices
-        std::sort(&col_ind[begin], &col_ind[i]);
-    }
+            // Sort column indices and correct index base
+            std::sort(col_ind.begin() + begin, col_ind.begin() + end);
 
-    // Correct index base accordingly
-    if(base == rocsparse_index_base_one)
-    {
-        for(rocsparse_int i = 0; i < nnz; ++i)
-        {
-            ++row_ind[i];
-            ++col_ind[i];
+            for(size_t j = begin; j < end; ++j)
+            {
+                col_ind[j] += base;
+            }
         }
     }
 
-    // Sample random off-diagonal values
-    for(rocsparse_int i = 0; i < nnz; ++i)
+    // Sample random values
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(size_t i = 0; i < nnz; ++i)
     {
-        if(row_ind[i] == col_ind[i])
-        {
-            // Sample diagonal values
-            val[i] = random_generator<T>();
-        }
-        else
-        {
-            // Samples off-diagonal values
-            val[i] = random_generator<T>();
-        }
+        rocsparse_philox4x32 rng(key_val, i);
+
+        val[i] = random_generator<T>(rng);
     }
 }
 
@@ -279,16 +369,34 @@ inline void rocsparse_init_csr_laplace2d(std::vector<rocsparse_int>& row_ptr,
     M = dim_x * dim_y;
     N = dim_x * dim_y;
 
-    // Approximate 9pt stencil
-    rocsparse_int nnz_mat = 9 * M;
-
     row_ptr.resize(M + 1);
-    col_ind.resize(nnz_mat);
-    val.resize(nnz_mat);
-
-    nnz        = base;
     row_ptr[0] = base;
 
+    // Count entries per row, such that all rows can be filled independently
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int iy = 0; iy < dim_y; ++iy)
+    {
+        for(rocsparse_int ix = 0; ix < dim_x; ++ix)
+        {
+            rocsparse_int ny = 1 + (iy > 0) + (iy < dim_y - 1);
+            rocsparse_int nx = 1 + (ix > 0) + (ix < dim_x - 1);
+
+            row_ptr[iy * dim_x + ix + 1] = ny * nx;
+        }
+    }
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        row_ptr[i + 1] += row_ptr[i];
+    }
+
+    nnz = row_ptr[M] - base;
+
+    col_ind.resize(nnz);
+    val.resize(nnz);
+
     // Fill local arrays
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
@@ -298,6 +406,7 @@ inline void rocsparse_init_csr_laplace2d(std::vector<rocsparse_int>& row_ptr,
         for(rocsparse_int ix = 0; ix < dim_x; ++ix)
         {
             rocsparse_int row = iy * dim_x + ix;
+            rocsparse_int idx = row_ptr[row] - base;
 
             for(int sy = -1; sy <= 1; ++sy)
             {
@@ -309,21 +418,16 @@ inline void rocsparse_init_csr_laplace2d(std::vector<rocsparse_int>& row_ptr,
                         {
                             rocsparse_int col = row + sy * dim_x + sx;
 
-                            col_ind[nnz - base] = col + base;
-                            val[nnz - base]     = (col == row) ? 8.0 : -1.0;
+                            col_ind[idx] = col + base;
+                            val[idx]     = (col == row) ? 8.0 : -1.0;
 
-                            ++nnz;
+                            ++idx;
                         }
                     }
                 }
             }
-
-            row_ptr[row + 1] = nnz;
         }
     }
-
-    // Adjust nnz by index base
-    nnz -= base;
 }
 
 /* ==================================================================================== */
@@ -371,16 +475,38 @@ inline void rocsparse_init_csr_laplace3d(std::vector<rocsparse_int>& row_ptr,
     M = dim_x * dim_y * dim_z;
     N = dim_x * dim_y * dim_z;
 
-    // Approximate 27pt stencil
-    rocsparse_int nnz_mat = 27 * M;
-
     row_ptr.resize(M + 1);
-    col_ind.resize(nnz_mat);
-    val.resize(nnz_mat);
-
-    nnz        = base;
     row_ptr[0] = base;
 
+    // Count entries per row, such that all rows can be filled independently
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int iz = 0; iz < dim_z; ++iz)
+    {
+        for(rocsparse_int iy = 0; iy < dim_y; ++iy)
+        {
+            for(rocsparse_int ix = 0; ix < dim_x; ++ix)
+            {
+                rocsparse_int nz = 1 + (iz > 0) + (iz < dim_z - 1);
+                rocsparse_int ny = 1 + (iy > 0) + (iy < dim_y - 1);
+                rocsparse_int nx = 1 + (ix > 0) + (ix < dim_x - 1);
+
+                row_ptr[iz * dim_x * dim_y + iy * dim_x + ix + 1] = nz * ny * nx;
+            }
+        }
+    }
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        row_ptr[i + 1] += row_ptr[i];
+    }
+
+    nnz = row_ptr[M] - base;
+
+    col_ind.resize(nnz);
+    val.resize(nnz);
+
     // Fill local arrays
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
@@ -392,6 +518,7 @@ inline void rocsparse_init_csr_laplace3d(std::vector<rocsparse_int>& row_ptr,
             for(rocsparse_int ix = 0; ix < dim_x; ++ix)
             {
                 rocsparse_int row = iz * dim_x * dim_y + iy * dim_x + ix;
+                rocsparse_int idx = row_ptr[row] - base;
 
                 for(int sz = -1; sz <= 1; ++sz)
                 {
@@ -408,24 +535,19 @@ inline void rocsparse_init_csr_laplace3d(std::vector<rocsparse_int>& row_ptr,
                                         rocsparse_int col
                                             = row + sz * dim_x * dim_y + sy * dim_x + sx;
 
-                                        col_ind[nnz - base] = col + base;
-                                        val[nnz - base]     = (col == row) ? 26.0 : -1.0;
+                                        col_ind[idx] = col + base;
+                                        val[idx]     = (col == row) ? 26.0 : -1.0;
 
-                                        ++nnz;
+                                        ++idx;
                                     }
                                 }
                             }
                         }
                     }
                 }
-
-                row_ptr[row + 1] = nnz;
             }
         }
     }
-
-    // Adjust nnz by index base
-    nnz -= base;
 }
 
 /* ==================================================================================== */
@@ -451,6 +573,584 @@ inline void rocsparse_init_coo_laplace3d(std::vector<rocsparse_int>& row_ind,
     host_csr_to_coo(M, nnz, row_ptr, row_ind, base);
 }
 
+/* ==================================================================================== */
+/*! \brief  Generate a R-MAT (Kronecker) power-law matrix in CSR format
+ *
+ *  Each of the M * edge_factor edges is sampled by recursive quadrant selection with
+ *  probabilities (0.57, 0.19, 0.19, 0.05). Vertex labels are scrambled by a bijection,
+ *  such that high degree rows are spread over the matrix. Duplicate edges are merged
+ *  and the diagonal is always present.
+ */
+template <typename T>
+inline void rocsparse_init_csr_rmat(std::vector<rocsparse_int>& row_ptr,
+                                    std::vector<rocsparse_int>& col_ind,
+                                    std::vector<T>&             val,
+                                    rocsparse_int               M,
+                                    rocsparse_int               N,
+                                    rocsparse_int               edge_factor,
+                                    rocsparse_int&              nnz,
+                                    rocsparse_index_base        base)
+{
+    row_ptr.assign(M + 1, base);
+    nnz = 0;
+
+    // Do nothing
+    if(M == 0 || N == 0)
+    {
+        col_ind.clear();
+        val.clear();
+        return;
+    }
+
+    // Default edge factor
+    if(edge_factor <= 0)
+    {
+        edge_factor = 16;
+    }
+
+    uint64_t key_edge = rocsparse_rng_key();
+    uint64_t key_perm = rocsparse_rng_key();
+    uint64_t key_val  = rocsparse_rng_key();
+
+    // Number of bits of row and column indices
+    int scale_m = 0;
+    int scale_n = 0;
+
+    while((int64_t(1) << scale_m) < M)
+    {
+        ++scale_m;
+    }
+
+    while((int64_t(1) << scale_n) < N)
+    {
+        ++scale_n;
+    }
+
+    int scale = std::max(scale_m, scale_n);
+
+    // Bijection on [0, bound), using cycle walking on [0, 2^bits)
+    auto scramble = [&](uint64_t x, int bits, uint64_t bound) {
+        uint64_t mask  = (uint64_t(1) << bits) - 1;
+        int      shift = bits / 2 + 1;
+
+        do
+        {
+            x = (x * 0x9E3779B97F4A7C15ull + key_perm) & mask;
+            x ^= x >> shift;
+            x = (x * 0xBF58476D1CE4E5B9ull + (key_perm >> 32)) & mask;
+        } while(x >= bound);
+
+        return x;
+    };
+
+    size_t num_edges = static_cast<size_t>(M) * edge_factor;
+    size_t min_mn    = std::min(M, N);
+
+    std::vector<rocsparse_int> edge_row(num_edges);
+    std::vector<rocsparse_int> edge_col(num_edges);
+    std::vector<size_t>        ptr(M + 1, 0);
+
+    // Sample edges
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(size_t e = 0; e < num_edges; ++e)
+    {
+        rocsparse_philox4x32 rng(key_edge, e);
+
+        uint64_t row;
+        uint64_t col;
+
+        do
+        {
+            row = 0;
+            col = 0;
+
+            for(int l = 0; l < scale; ++l)
+            {
+                // Rectangular matrices, the shorter dimension splits on the last levels only
+                bool split_row = l >= scale - scale_m;
+                bool split_col = l >= scale - scale_n;
+
+                double u = rng.uniform_real();
+
+                if(split_row && split_col)
+                {
+                    row = (row << 1) | (u >= 0.76);
+                    col = (col << 1) | ((u >= 0.57 && u < 0.76) || u >= 0.95);
+                }
+                else if(split_row)
+                {
+                    row = (row << 1) | (u >= 0.76);
+                }
+                else
+                {
+                    col = (col << 1) | (u >= 0.76);
+                }
+            }
+        } while(row >= static_cast<uint64_t>(M) || col >= static_cast<uint64_t>(N));
+
+        edge_row[e] = scramble(row, scale_m, M);
+        edge_col[e] = scramble(col, scale_n, N);
+
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+        ++ptr[edge_row[e] + 1];
+    }
+
+    // Reserve space for the diagonal entry
+    for(size_t i = 0; i < min_mn; ++i)
+    {
+        ++ptr[i + 1];
+    }
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        ptr[i + 1] += ptr[i];
+    }
+
+    // Scatter edges into rows, diagonal entry first
+    std::vector<rocsparse_int> tmp(ptr[M]);
+    std::vector<size_t>        fill(ptr.begin(), ptr.end() - 1);
+
+    for(size_t i = 0; i < min_mn; ++i)
+    {
+        tmp[fill[i]++] = i;
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(size_t e = 0; e < num_edges; ++e)
+    {
+        size_t pos;
+
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+        pos = fill[edge_row[e]]++;
+
+        tmp[pos] = edge_col[e];
+    }
+
+    // Sort and merge duplicates, the result does not depend on the scatter order
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        auto begin = tmp.begin() + ptr[i];
+        auto end   = tmp.begin() + ptr[i + 1];
+
+        std::sort(begin, end);
+        row_ptr[i + 1] = std::unique(begin, end) - begin;
+    }
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        row_ptr[i + 1] += row_ptr[i];
+    }
+
+    nnz = row_ptr[M] - base;
+
+    col_ind.resize(nnz);
+    val.resize(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_philox4x32 rng(key_val, i);
+
+        size_t src = ptr[i];
+
+        for(rocsparse_int j = row_ptr[i] - base; j < row_ptr[i + 1] - base; ++j)
+        {
+            col_ind[j] = tmp[src++] + base;
+            val[j]     = random_generator<T>(rng);
+        }
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a banded matrix with variable bandwidth in CSR format
+ *
+ *  Lower and upper bandwidth of each row are sampled uniformly in [0, max_bandwidth].
+ */
+template <typename T>
+inline void rocsparse_init_csr_banded(std::vector<rocsparse_int>& row_ptr,
+                                      std::vector<rocsparse_int>& col_ind,
+                                      std::vector<T>&             val,
+                                      rocsparse_int               M,
+                                      rocsparse_int               N,
+                                      rocsparse_int               max_bandwidth,
+                                      rocsparse_int&              nnz,
+                                      rocsparse_index_base        base)
+{
+    row_ptr.assign(M + 1, base);
+    nnz = 0;
+
+    // Do nothing
+    if(M == 0 || N == 0)
+    {
+        col_ind.clear();
+        val.clear();
+        return;
+    }
+
+    // Default bandwidth
+    if(max_bandwidth <= 0)
+    {
+        max_bandwidth = 16;
+    }
+
+    uint64_t key_band = rocsparse_rng_key();
+    uint64_t key_val  = rocsparse_rng_key();
+
+    // Column range [first, last] of a row
+    auto band = [&](rocsparse_int row, int64_t& first, int64_t& last) {
+        rocsparse_philox4x32 rng(key_band, row);
+
+        first = std::max<int64_t>(row - rng.uniform_int(0, max_bandwidth), 0);
+        last  = std::min<int64_t>(row + rng.uniform_int(0, max_bandwidth), N - 1);
+    };
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        int64_t first, last;
+        band(i, first, last);
+
+        row_ptr[i + 1] = std::max<int64_t>(last - first + 1, 0);
+    }
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        row_ptr[i + 1] += row_ptr[i];
+    }
+
+    nnz = row_ptr[M] - base;
+
+    col_ind.resize(nnz);
+    val.resize(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_philox4x32 rng(key_val, i);
+
+        int64_t first, last;
+        band(i, first, last);
+
+        rocsparse_int idx = row_ptr[i] - base;
+
+        for(int64_t j = first; j <= last; ++j)
+        {
+            col_ind[idx] = j + base;
+            val[idx]     = random_generator<T>(rng);
+
+            ++idx;
+        }
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a block-structured matrix with dense sub-blocks in CSR format
+ *
+ *  Each block row holds between 1 and max_blocks dense block_dim x block_dim blocks,
+ *  including the diagonal block, with block columns normally distributed around the
+ *  diagonal.
+ */
+template <typename T>
+inline void rocsparse_init_csr_block(std::vector<rocsparse_int>& row_ptr,
+                                     std::vector<rocsparse_int>& col_ind,
+                                     std::vector<T>&             val,
+                                     rocsparse_int               M,
+                                     rocsparse_int               N,
+                                     rocsparse_int               block_dim,
+                                     rocsparse_int               max_blocks,
+                                     rocsparse_int&              nnz,
+                                     rocsparse_index_base        base)
+{
+    row_ptr.assign(M + 1, base);
+    nnz = 0;
+
+    // Do nothing
+    if(M == 0 || N == 0)
+    {
+        col_ind.clear();
+        val.clear();
+        return;
+    }
+
+    // Default block structure
+    if(block_dim <= 0)
+    {
+        block_dim = 4;
+    }
+
+    if(max_blocks <= 0)
+    {
+        max_blocks = 4;
+    }
+
+    rocsparse_int mb = (M - 1) / block_dim + 1;
+    rocsparse_int nb = (N - 1) / block_dim + 1;
+
+    uint64_t key_block = rocsparse_rng_key();
+    uint64_t key_val   = rocsparse_rng_key();
+
+    // Sorted block columns of a block row
+    auto sample = [&](rocsparse_int brow, std::vector<rocsparse_int>& bcol) {
+        rocsparse_philox4x32 rng(key_block, brow);
+
+        rocsparse_int nblocks = rng.uniform_int(1, std::min(max_blocks, nb));
+        int64_t       diag    = static_cast<int64_t>(brow) * nb / mb;
+
+        bcol.clear();
+        bcol.push_back(diag);
+
+        size_t max_trials = 32 * nblocks + 64;
+        size_t trials     = 0;
+
+        while(static_cast<rocsparse_int>(bcol.size()) < nblocks)
+        {
+            int64_t col;
+
+            if(trials++ < max_trials)
+            {
+                col = diag + static_cast<int64_t>(nblocks * rng.normal());
+
+                if(col < 0 || col > nb - 1)
+                {
+                    continue;
+                }
+            }
+            else
+            {
+                col = rng.uniform_int(0, nb - 1);
+            }
+
+            if(std::find(bcol.begin(), bcol.end(), col) == bcol.end())
+            {
+                bcol.push_back(col);
+            }
+        }
+
+        std::sort(bcol.begin(), bcol.end());
+    };
+
+    // Width of a block column, the last one may be partial
+    auto width = [&](rocsparse_int bcol) { return std::min(block_dim, N - bcol * block_dim); };
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<rocsparse_int> bcol;
+
+#ifdef _OPENMP
+#pragma omp for
+#endif
+        for(rocsparse_int i = 0; i < mb; ++i)
+        {
+            sample(i, bcol);
+
+            rocsparse_int row_nnz = 0;
+            for(auto c : bcol)
+            {
+                row_nnz += width(c);
+            }
+
+            for(rocsparse_int r = i * block_dim; r < std::min(M, (i + 1) * block_dim); ++r)
+            {
+                row_ptr[r + 1] = row_nnz;
+            }
+        }
+    }
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        row_ptr[i + 1] += row_ptr[i];
+    }
+
+    nnz = row_ptr[M] - base;
+
+    col_ind.resize(nnz);
+    val.resize(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<rocsparse_int> bcol;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+        for(rocsparse_int i = 0; i < mb; ++i)
+        {
+            sample(i, bcol);
+
+            for(rocsparse_int r = i * block_dim; r < std::min(M, (i + 1) * block_dim); ++r)
+            {
+                rocsparse_philox4x32 rng(key_val, r);
+
+                rocsparse_int idx = row_ptr[r] - base;
+
+                for(auto c : bcol)
+                {
+                    for(rocsparse_int j = 0; j < width(c); ++j)
+                    {
+                        col_ind[idx] = c * block_dim + j + base;
+                        val[idx]     = random_generator<T>(rng);
+
+                        ++idx;
+                    }
+                }
+            }
+        }
+    }
+}
+
+/* ==================================================================================== */
+/*! \brief  Generate a 3D unstructured tetrahedral mesh like stencil in CSR format
+ *
+ *  The nodes of a dim_x x dim_y x dim_z grid are connected by the edges of a
+ *  tetrahedral decomposition of each grid cell. The decomposition is chosen randomly
+ *  per cell, resulting in an irregular pattern with up to 27 entries per row. The
+ *  matrix is symmetric and diagonally dominant, similar to a P1 FEM stiffness matrix.
+ */
+template <typename T>
+inline void rocsparse_init_csr_fem3d(std::vector<rocsparse_int>& row_ptr,
+                                     std::vector<rocsparse_int>& col_ind,
+                                     std::vector<T>&             val,
+                                     rocsparse_int               dim_x,
+                                     rocsparse_int               dim_y,
+                                     rocsparse_int               dim_z,
+                                     rocsparse_int&              M,
+                                     rocsparse_int&              N,
+                                     rocsparse_int&              nnz,
+                                     rocsparse_index_base        base)
+{
+    // Do nothing
+    if(dim_x == 0 || dim_y == 0 || dim_z == 0)
+    {
+        return;
+    }
+
+    M = dim_x * dim_y * dim_z;
+    N = dim_x * dim_y * dim_z;
+
+    uint64_t key_cell = rocsparse_rng_key();
+
+    // Each cell is split into 6 tetrahedra around one of its 4 main diagonals,
+    // (corner p, corner 7 - p). Corners are encoded as bits (x, y, z).
+    auto diagonal = [&](rocsparse_int cx, rocsparse_int cy, rocsparse_int cz) {
+        rocsparse_philox4x32 rng(key_cell, (int64_t(cz) * dim_y + cy) * dim_x + cx);
+        return static_cast<int>(rng.uniform_int(0, 3));
+    };
+
+    // Corners u and v share an edge of the decomposition
+    auto connected = [](int u, int v, int p) {
+        int d = __builtin_popcount(u ^ v);
+        return d == 1 || (d == 2 && (u == p || v == p || u == 7 - p || v == 7 - p))
+               || (d == 3 && (u == p || v == p));
+    };
+
+    // Collect the sorted neighbours of a node, including itself
+    auto neighbours = [&](rocsparse_int ix, rocsparse_int iy, rocsparse_int iz, int64_t* nb) {
+        int n = 0;
+
+        // Adjacent cells, with local corner (a, b, c) of the node
+        for(int c = 0; c < 2; ++c)
+        {
+            for(int b = 0; b < 2; ++b)
+            {
+                for(int a = 0; a < 2; ++a)
+                {
+                    rocsparse_int cx = ix - a;
+                    rocsparse_int cy = iy - b;
+                    rocsparse_int cz = iz - c;
+
+                    if(cx < 0 || cy < 0 || cz < 0 || cx > dim_x - 2 || cy > dim_y - 2
+                       || cz > dim_z - 2)
+                    {
+                        continue;
+                    }
+
+                    int p = diagonal(cx, cy, cz);
+                    int u = a | (b << 1) | (c << 2);
+
+                    for(int v = 0; v < 8; ++v)
+                    {
+                        if(connected(u, v, p))
+                        {
+                            nb[n++] = (int64_t(cz + (v >> 2)) * dim_y + cy + ((v >> 1) & 1))
+                                          * dim_x
+                                      + cx + (v & 1);
+                        }
+                    }
+                }
+            }
+        }
+
+        // Add the node itself, required for meshes with single cell layers
+        nb[n++] = (int64_t(iz) * dim_y + iy) * dim_x + ix;
+
+        std::sort(nb, nb + n);
+        return static_cast<int>(std::unique(nb, nb + n) - nb);
+    };
+
+    row_ptr.resize(M + 1);
+    row_ptr[0] = base;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int row = 0; row < M; ++row)
+    {
+        int64_t nb[64];
+
+        row_ptr[row + 1]
+            = neighbours(row % dim_x, (row / dim_x) % dim_y, row / (dim_x * dim_y), nb);
+    }
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        row_ptr[i + 1] += row_ptr[i];
+    }
+
+    nnz = row_ptr[M] - base;
+
+    col_ind.resize(nnz);
+    val.resize(nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int row = 0; row < M; ++row)
+    {
+        int64_t nb[64];
+
+        int n = neighbours(row % dim_x, (row / dim_x) % dim_y, row / (dim_x * dim_y), nb);
+
+        rocsparse_int idx = row_ptr[row] - base;
+
+        for(int j = 0; j < n; ++j)
+        {
+            col_ind[idx + j] = nb[j] + base;
+            val[idx + j]     = (nb[j] == row) ? 26.0 : -1.0;
+        }
+    }
+}
+
 /* ============================================================================================ */
 /*! \brief  Read matrix from mtx file in COO format */
 static inline void
@@ -1048,6 +1748,24 @@ inline void rocsparse_init_csr_matrix(std::vector<rocsparse_int>& csr_row_ptr,
         rocsparse_init_csr_laplace3d(
             csr_row_ptr, csr_col_ind, csr_val, dim_x, dim_y, dim_z, M, N, nnz, base);
     }
+    else if(matrix == rocsparse_matrix_rmat)
+    {
+        rocsparse_init_csr_rmat(csr_row_ptr, csr_col_ind, csr_val, M, N, dim_x, nnz, base);
+    }
+    else if(matrix == rocsparse_matrix_banded)
+    {
+        rocsparse_init_csr_banded(csr_row_ptr, csr_col_ind, csr_val, M, N, dim_x, nnz, base);
+    }
+    else if(matrix == rocsparse_matrix_block)
+    {
+        rocsparse_init_csr_block(
+            csr_row_ptr, csr_col_ind, csr_val, M, N, dim_x, dim_y, nnz, base);
+    }
+    else if(matrix == rocsparse_matrix_fem_3d)
+    {
+        rocsparse_init_csr_fem3d(
+            csr_row_ptr, csr_col_ind, csr_val, dim_x, dim_y, dim_z, M, N, nnz, base);
+    }
     else if(matrix == rocsparse_matrix_file_rocalution)
     {
         rocsparse_init_csr_rocalution(
@@ -1059,6 +1777,96 @@ inline void rocsparse_init_csr_matrix(std::vector<rocsparse_int>& csr_row_ptr,
     }
 }
 
+/* ==================================================================================== */
+/*! \brief  Generate a smoothed aggregation prolongation P = (I - w D^-1 A) P0 in CSR
+ *  format, where P0 aggregates 2 x 2 x 2 neighbouring points of the dim_x x dim_y x
+ *  dim_z grid of the N x N matrix A. Dimensions of size 1 are not coarsened. */
+template <typename T>
+inline void rocsparse_init_csr_prolongation(const std::vector<rocsparse_int>& csr_row_ptr_A,
+                                            const std::vector<rocsparse_int>& csr_col_ind_A,
+                                            const std::vector<T>&             csr_val_A,
+                                            rocsparse_int                     N,
+                                            rocsparse_int                     dim_x,
+                                            rocsparse_int                     dim_y,
+                                            rocsparse_int                     dim_z,
+                                            std::vector<rocsparse_int>&       csr_row_ptr_P,
+                                            std::vector<rocsparse_int>&       csr_col_ind_P,
+                                            std::vector<T>&                   csr_val_P,
+                                            rocsparse_int&                    K,
+                                            rocsparse_int&                    nnz_P,
+                                            rocsparse_index_base              base_A,
+                                            rocsparse_index_base              base_P)
+{
+    // Coarse grid dimensions
+    rocsparse_int cdim_x = (dim_x + 1) / 2;
+    rocsparse_int cdim_y = (dim_y + 1) / 2;
+    rocsparse_int cdim_z = (dim_z + 1) / 2;
+
+    K = cdim_x * cdim_y * cdim_z;
+
+    // Aggregate of each fine grid point
+    std::vector<rocsparse_int> agg(N);
+
+    for(rocsparse_int i = 0; i < N; ++i)
+    {
+        rocsparse_int ix = i % dim_x;
+        rocsparse_int iy = (i / dim_x) % dim_y;
+        rocsparse_int iz = i / (dim_x * dim_y);
+
+        agg[i] = ix / 2 + cdim_x * (iy / 2 + cdim_y * (iz / 2));
+    }
+
+    // Jacobi smoothing weight
+    T omega = static_cast<T>(2.0 / 3.0);
+
+    csr_row_ptr_P.resize(N + 1);
+    csr_col_ind_P.clear();
+    csr_val_P.clear();
+
+    csr_row_ptr_P[0] = base_P;
+
+    for(rocsparse_int i = 0; i < N; ++i)
+    {
+        rocsparse_int row_begin = csr_row_ptr_A[i] - base_A;
+        rocsparse_int row_end   = csr_row_ptr_A[i + 1] - base_A;
+
+        // Diagonal entry of A
+        T diag = static_cast<T>(0);
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            if(csr_col_ind_A[j] - base_A == i)
+            {
+                diag += csr_val_A[j];
+            }
+        }
+
+        // Row i of P, ordered by aggregate
+        std::map<rocsparse_int, T> row;
+
+        row[agg[i]] = static_cast<T>(1);
+
+        if(diag != static_cast<T>(0))
+        {
+            for(rocsparse_int j = row_begin; j < row_end; ++j)
+            {
+                rocsparse_int col = csr_col_ind_A[j] - base_A;
+
+                row[agg[col]] -= omega / diag * csr_val_A[j];
+            }
+        }
+
+        for(const auto& entry : row)
+        {
+            csr_col_ind_P.push_back(entry.first + base_P);
+            csr_val_P.push_back(entry.second);
+        }
+
+        csr_row_ptr_P[i + 1] = csr_col_ind_P.size() + base_P;
+    }
+
+    nnz_P = csr_row_ptr_P[N] - base_P;
+}
+
 /* ==================================================================================== */
 /*! \brief  Initialize a sparse matrix in COO format */
 template <typename T>
@@ -1093,6 +1901,31 @@ inline void rocsparse_init_coo_matrix(std::vector<rocsparse_int>& coo_row_ind,
         rocsparse_init_coo_laplace3d(
             coo_row_ind, coo_col_ind, coo_val, dim_x, dim_y, dim_z, M, N, nnz, base);
     }
+    else if(matrix == rocsparse_matrix_rmat || matrix == rocsparse_matrix_banded
+            || matrix == rocsparse_matrix_block || matrix == rocsparse_matrix_fem_3d)
+    {
+        std::vector<rocsparse_int> coo_row_ptr;
+
+        // Sample CSR matrix
+        rocsparse_init_csr_matrix(coo_row_ptr,
+                                  coo_col_ind,
+                                  coo_val,
+                                  M,
+                                  N,
+                                  K,
+                                  dim_x,
+                                  dim_y,
+                                  dim_z,
+                                  nnz,
+                                  base,
+                                  matrix,
+                                  filename,
+                                  toint,
+                                  full_rank);
+
+        // Convert to COO
+        host_csr_to_coo(M, nnz, coo_row_ptr, coo_row_ind, base);
+    }
     else if(matrix == rocsparse_matrix_file_rocalution)
     {
         rocsparse_init_coo_rocalution(
@@ -26,6 +26,8 @@
 #define ROCSPARSE_MATH_HPP
 
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <rocsparse.h>
 
 /* =================================================================================== */
@@ -88,5 +90,145 @@ inline rocsparse_double_complex rocsparse_conj(rocsparse_double_complex arg)
     return std::conj(arg);
 }
 
+/* =================================================================================== */
+/*! \brief  converts into the precision of T, e.g. for mixed precision references */
+template <typename T, typename U>
+inline T rocsparse_convert(U arg)
+{
+    return static_cast<T>(arg);
+}
+
+template <>
+inline rocsparse_float_complex rocsparse_convert(rocsparse_double_complex arg)
+{
+    return rocsparse_float_complex(static_cast<float>(std::real(arg)),
+                                   static_cast<float>(std::imag(arg)));
+}
+
+template <>
+inline rocsparse_double_complex rocsparse_convert(rocsparse_float_complex arg)
+{
+    return rocsparse_double_complex(std::real(arg), std::imag(arg));
+}
+
+// Single to half precision, rounding to nearest even
+template <>
+inline rocsparse_half rocsparse_convert(float arg)
+{
+    uint32_t x;
+    std::memcpy(&x, &arg, sizeof(float));
+
+    uint32_t sign = (x >> 16) & 0x8000;
+    int32_t  exp  = static_cast<int32_t>((x >> 23) & 0xff) - 127 + 15;
+    uint32_t mant = x & 0x7fffff;
+
+    rocsparse_half h;
+
+    // Inf and NaN
+    if(((x >> 23) & 0xff) == 0xff)
+    {
+        h.data = static_cast<uint16_t>(sign | 0x7c00 | (mant ? 0x200 : 0));
+        return h;
+    }
+
+    // Overflow
+    if(exp >= 31)
+    {
+        h.data = static_cast<uint16_t>(sign | 0x7c00);
+        return h;
+    }
+
+    // Subnormal or zero
+    if(exp <= 0)
+    {
+        if(exp < -10)
+        {
+            h.data = static_cast<uint16_t>(sign);
+            return h;
+        }
+
+        mant |= 0x800000;
+
+        uint32_t shift = 14 - exp;
+        uint32_t hm    = mant >> shift;
+        uint32_t rem   = mant & ((1u << shift) - 1);
+        uint32_t mid   = 1u << (shift - 1);
+
+        if(rem > mid || (rem == mid && (hm & 1)))
+        {
+            ++hm;
+        }
+
+        h.data = static_cast<uint16_t>(sign | hm);
+        return h;
+    }
+
+    // Normal, a carry of the rounding propagates into the exponent
+    uint32_t hm  = mant >> 13;
+    uint32_t rem = mant & 0x1fff;
+    uint32_t r   = sign | (static_cast<uint32_t>(exp) << 10) | hm;
+
+    if(rem > 0x1000 || (rem == 0x1000 && (hm & 1)))
+    {
+        ++r;
+    }
+
+    h.data = static_cast<uint16_t>(r);
+    return h;
+}
+
+template <>
+inline float rocsparse_convert(rocsparse_half arg)
+{
+    uint32_t sign = static_cast<uint32_t>(arg.data & 0x8000) << 16;
+    uint32_t exp  = (arg.data >> 10) & 0x1f;
+    uint32_t mant = arg.data & 0x3ff;
+
+    // Subnormal or zero
+    if(exp == 0)
+    {
+        float val = std::ldexp(static_cast<float>(mant), -24);
+        return sign ? -val : val;
+    }
+
+    uint32_t x = (exp == 31) ? (sign | 0x7f800000 | (mant << 13))
+                             : (sign | ((exp - 15 + 127) << 23) | (mant << 13));
+
+    float val;
+    std::memcpy(&val, &x, sizeof(float));
+    return val;
+}
+
+// Single precision to bfloat16, rounding to nearest even
+template <>
+inline rocsparse_bfloat16 rocsparse_convert(float arg)
+{
+    uint32_t x;
+    std::memcpy(&x, &arg, sizeof(float));
+
+    rocsparse_bfloat16 h;
+
+    if(std::isnan(arg))
+    {
+        h.data = static_cast<uint16_t>((x >> 16) | 0x40);
+        return h;
+    }
+
+    x += 0x7fff + ((x >> 16) & 1);
+
+    h.data = static_cast<uint16_t>(x >> 16);
+    return h;
+}
+
+template <>
+inline float rocsparse_convert(rocsparse_bfloat16 arg)
+{
+    uint32_t x = static_cast<uint32_t>(arg.data) << 16;
+
+    float val;
+    std::memcpy(&val, &x, sizeof(float));
+    return val;
+}
+
 
 #endif // ROCSPARSE_MATH_HPP
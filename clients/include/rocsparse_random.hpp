@@ -27,6 +27,8 @@
 
 #include "rocsparse_math.hpp"
 
+#include <cmath>
+#include <cstdint>
 #include <random>
 #include <rocsparse.h>
 #include <type_traits>
@@ -84,6 +86,18 @@ public:
         return random_nan_data<float, uint32_t, 23, 8>();
     }
 
+    // Random NaN half
+    explicit operator rocsparse_half()
+    {
+        return random_nan_data<rocsparse_half, uint16_t, 10, 5>();
+    }
+
+    // Random NaN bfloat16
+    explicit operator rocsparse_bfloat16()
+    {
+        return random_nan_data<rocsparse_bfloat16, uint16_t, 7, 8>();
+    }
+
     explicit operator rocsparse_float_complex()
     {
         return {float(*this), float(*this)};
@@ -124,4 +138,162 @@ inline T random_generator_normal()
     return std::normal_distribution<T>(0.0, 1.0)(rocsparse_rng);
 }
 
+/* ==================================================================================== */
+/*! \brief  Counter-based random number generator (Philox4x32-10)
+ *
+ *  The output is a pure function of (key, stream, position), such that independent
+ *  streams (e.g. one per matrix row or vector entry) can be generated in any order
+ *  and by any number of threads, while producing bitwise identical results.
+ */
+class rocsparse_philox4x32
+{
+    uint32_t key[2];
+    uint32_t ctr[4];
+    uint32_t out[4];
+    int      pos;
+
+    static inline void mulhilo(uint32_t a, uint32_t b, uint32_t& hi, uint32_t& lo)
+    {
+        uint64_t p = static_cast<uint64_t>(a) * b;
+
+        hi = static_cast<uint32_t>(p >> 32);
+        lo = static_cast<uint32_t>(p);
+    }
+
+    void generate()
+    {
+        uint32_t c[4] = {ctr[0], ctr[1], ctr[2], ctr[3]};
+        uint32_t k[2] = {key[0], key[1]};
+
+        for(int r = 0; r < 10; ++r)
+        {
+            uint32_t hi0, lo0, hi1, lo1;
+
+            mulhilo(0xD2511F53u, c[0], hi0, lo0);
+            mulhilo(0xCD9E8D57u, c[2], hi1, lo1);
+
+            c[0] = hi1 ^ c[1] ^ k[0];
+            c[1] = lo1;
+            c[2] = hi0 ^ c[3] ^ k[1];
+            c[3] = lo0;
+
+            k[0] += 0x9E3779B9u;
+            k[1] += 0xBB67AE85u;
+        }
+
+        out[0] = c[0];
+        out[1] = c[1];
+        out[2] = c[2];
+        out[3] = c[3];
+
+        // Advance block counter within the stream
+        if(++ctr[0] == 0)
+        {
+            ++ctr[1];
+        }
+
+        pos = 0;
+    }
+
+public:
+    using result_type = uint32_t;
+
+    rocsparse_philox4x32(uint64_t seed, uint64_t stream)
+        : key{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)}
+        , ctr{0, 0, static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)}
+        , pos(4)
+    {
+    }
+
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    static constexpr result_type max()
+    {
+        return 0xFFFFFFFFu;
+    }
+
+    result_type operator()()
+    {
+        if(pos == 4)
+        {
+            generate();
+        }
+
+        return out[pos++];
+    }
+
+    // Uniform integer in [a, b]
+    int64_t uniform_int(int64_t a, int64_t b)
+    {
+        uint64_t range = static_cast<uint64_t>(b - a) + 1;
+
+        if(range > 0xFFFFFFFFull)
+        {
+            uint64_t x = (static_cast<uint64_t>((*this)()) << 32) | (*this)();
+            return a + static_cast<int64_t>(x % range);
+        }
+
+        return a + static_cast<int64_t>((static_cast<uint64_t>((*this)()) * range) >> 32);
+    }
+
+    // Uniform double in [0, 1)
+    double uniform_real()
+    {
+        uint64_t x = (static_cast<uint64_t>((*this)()) << 32) | (*this)();
+        return (x >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    // Standard normal distribution (Box-Muller)
+    double normal()
+    {
+        double u1 = 1.0 - uniform_real();
+        double u2 = uniform_real();
+
+        return std::sqrt(-2.0 * std::log(u1)) * std::cos(6.283185307179586 * u2);
+    }
+};
+
+/*! \brief  Draw a fresh key for the counter-based generator from the global generator.
+ *
+ *  This keeps rocsparse_seedrand() effective: after reseeding, each subsequent
+ *  initialization obtains the same key and thus generates the same data.
+ */
+inline uint64_t rocsparse_rng_key()
+{
+    uint64_t hi = rocsparse_rng();
+    uint64_t lo = rocsparse_rng();
+
+    return (hi << 32) | lo;
+}
+
+/*! \brief  generate a random number in range [a,b] from a counter-based stream */
+template <typename T>
+inline T random_generator(rocsparse_philox4x32& rng, int a = 1, int b = 10)
+{
+    return static_cast<T>(rng.uniform_int(a, b));
+}
+
+template <>
+inline rocsparse_float_complex
+    random_generator<rocsparse_float_complex>(rocsparse_philox4x32& rng, int a, int b)
+{
+    float re = random_generator<float>(rng, a, b);
+    float im = random_generator<float>(rng, a, b);
+
+    return rocsparse_float_complex(re, im);
+}
+
+template <>
+inline rocsparse_double_complex
+    random_generator<rocsparse_double_complex>(rocsparse_philox4x32& rng, int a, int b)
+{
+    double re = random_generator<double>(rng, a, b);
+    double im = random_generator<double>(rng, a, b);
+
+    return rocsparse_double_complex(re, im);
+}
+
 #endif // ROCSPARSE_RANDOM_HPP
@@ -54,6 +54,9 @@ void testing_bsrmm_bad_arg(const Arguments& arg)
     // Create matrix descriptor
     rocsparse_local_mat_descr descr;
 
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
     // Allocate memory on device
     device_vector<rocsparse_int> dbsr_row_ptr(safe_size);
     device_vector<rocsparse_int> dbsr_col_ind(safe_size);
@@ -360,29 +363,8 @@ void testing_bsrmm_bad_arg(const Arguments& arg)
     // Test not implemented
     EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm<T>(handle,
                                                rocsparse_direction_row,
-                                               rocsparse_operation_transpose,
                                                rocsparse_operation_none,
-                                               safe_size,
-                                               safe_size,
-                                               safe_size,
-                                               safe_size,
-                                               &h_alpha,
-                                               descr,
-                                               dbsr_val,
-                                               dbsr_row_ptr,
-                                               dbsr_col_ind,
-                                               safe_size,
-                                               dB,
-                                               safe_size,
-                                               &h_beta,
-                                               dC,
-                                               safe_size),
-                            rocsparse_status_not_implemented);
-
-    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm<T>(handle,
-                                               rocsparse_direction_row,
                                                rocsparse_operation_conjugate_transpose,
-                                               rocsparse_operation_none,
                                                safe_size,
                                                safe_size,
                                                safe_size,
@@ -400,26 +382,352 @@ void testing_bsrmm_bad_arg(const Arguments& arg)
                                                safe_size),
                             rocsparse_status_not_implemented);
 
-    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm<T>(handle,
-                                               rocsparse_direction_row,
-                                               rocsparse_operation_none,
-                                               rocsparse_operation_conjugate_transpose,
-                                               safe_size,
-                                               safe_size,
-                                               safe_size,
-                                               safe_size,
-                                               &h_alpha,
-                                               descr,
-                                               dbsr_val,
-                                               dbsr_row_ptr,
-                                               dbsr_col_ind,
-                                               safe_size,
-                                               dB,
-                                               safe_size,
-                                               &h_beta,
-                                               dC,
-                                               safe_size),
+    // Test rocsparse_bsrmm_ex_analysis()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex_analysis<T>(nullptr,
+                                                           rocsparse_direction_row,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dbsr_val,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           safe_size,
+                                                           info),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex_analysis<T>(handle,
+                                                           rocsparse_direction_row,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           safe_size,
+                                                           nullptr,
+                                                           dbsr_val,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           safe_size,
+                                                           info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex_analysis<T>(handle,
+                                                           rocsparse_direction_row,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           nullptr,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           safe_size,
+                                                           info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex_analysis<T>(handle,
+                                                           rocsparse_direction_row,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dbsr_val,
+                                                           nullptr,
+                                                           dbsr_col_ind,
+                                                           safe_size,
+                                                           info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex_analysis<T>(handle,
+                                                           rocsparse_direction_row,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dbsr_val,
+                                                           dbsr_row_ptr,
+                                                           nullptr,
+                                                           safe_size,
+                                                           info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex_analysis<T>(handle,
+                                                           rocsparse_direction_row,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dbsr_val,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           safe_size,
+                                                           nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex_analysis<T>(handle,
+                                                           rocsparse_direction_row,
+                                                           rocsparse_operation_transpose,
+                                                           -1,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dbsr_val,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           safe_size,
+                                                           info),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex_analysis<T>(handle,
+                                                           rocsparse_direction_row,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           -1,
+                                                           safe_size,
+                                                           descr,
+                                                           dbsr_val,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           safe_size,
+                                                           info),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex_analysis<T>(handle,
+                                                           rocsparse_direction_row,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           -1,
+                                                           descr,
+                                                           dbsr_val,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           safe_size,
+                                                           info),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex_analysis<T>(handle,
+                                                           rocsparse_direction_row,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dbsr_val,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           0,
+                                                           info),
+                            rocsparse_status_invalid_size);
+
+    // Test rocsparse_bsrmm_ex()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex<T>(nullptr,
+                                                  rocsparse_direction_row,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_order_column,
+                                                  rocsparse_order_column,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dbsr_val,
+                                                  dbsr_row_ptr,
+                                                  dbsr_col_ind,
+                                                  safe_size,
+                                                  info,
+                                                  dB,
+                                                  safe_size * safe_size,
+                                                  &h_beta,
+                                                  dC,
+                                                  safe_size * safe_size),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex<T>(handle,
+                                                  rocsparse_direction_row,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_none,
+                                                  (rocsparse_order)2,
+                                                  rocsparse_order_column,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dbsr_val,
+                                                  dbsr_row_ptr,
+                                                  dbsr_col_ind,
+                                                  safe_size,
+                                                  info,
+                                                  dB,
+                                                  safe_size * safe_size,
+                                                  &h_beta,
+                                                  dC,
+                                                  safe_size * safe_size),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex<T>(handle,
+                                                  rocsparse_direction_row,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_order_column,
+                                                  (rocsparse_order)2,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dbsr_val,
+                                                  dbsr_row_ptr,
+                                                  dbsr_col_ind,
+                                                  safe_size,
+                                                  info,
+                                                  dB,
+                                                  safe_size * safe_size,
+                                                  &h_beta,
+                                                  dC,
+                                                  safe_size * safe_size),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex<T>(handle,
+                                                  rocsparse_direction_row,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_order_column,
+                                                  rocsparse_order_column,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dbsr_val,
+                                                  dbsr_row_ptr,
+                                                  dbsr_col_ind,
+                                                  safe_size,
+                                                  info,
+                                                  dB,
+                                                  safe_size * safe_size - 1,
+                                                  &h_beta,
+                                                  dC,
+                                                  safe_size * safe_size),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex<T>(handle,
+                                                  rocsparse_direction_row,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_order_row,
+                                                  rocsparse_order_column,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dbsr_val,
+                                                  dbsr_row_ptr,
+                                                  dbsr_col_ind,
+                                                  safe_size,
+                                                  info,
+                                                  dB,
+                                                  safe_size - 1,
+                                                  &h_beta,
+                                                  dC,
+                                                  safe_size * safe_size),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex<T>(handle,
+                                                  rocsparse_direction_row,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_order_column,
+                                                  rocsparse_order_column,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dbsr_val,
+                                                  dbsr_row_ptr,
+                                                  dbsr_col_ind,
+                                                  safe_size,
+                                                  info,
+                                                  dB,
+                                                  safe_size * safe_size,
+                                                  &h_beta,
+                                                  dC,
+                                                  safe_size * safe_size - 1),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex<T>(handle,
+                                                  rocsparse_direction_row,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_order_column,
+                                                  rocsparse_order_row,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dbsr_val,
+                                                  dbsr_row_ptr,
+                                                  dbsr_col_ind,
+                                                  safe_size,
+                                                  info,
+                                                  dB,
+                                                  safe_size * safe_size,
+                                                  &h_beta,
+                                                  dC,
+                                                  safe_size - 1),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex<T>(handle,
+                                                  rocsparse_direction_row,
+                                                  rocsparse_operation_transpose,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_order_column,
+                                                  rocsparse_order_column,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dbsr_val,
+                                                  dbsr_row_ptr,
+                                                  dbsr_col_ind,
+                                                  safe_size,
+                                                  nullptr,
+                                                  dB,
+                                                  safe_size * safe_size,
+                                                  &h_beta,
+                                                  dC,
+                                                  safe_size * safe_size),
                             rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex<T>(handle,
+                                                  rocsparse_direction_row,
+                                                  rocsparse_operation_transpose,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_order_column,
+                                                  rocsparse_order_column,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dbsr_val,
+                                                  dbsr_row_ptr,
+                                                  dbsr_col_ind,
+                                                  safe_size,
+                                                  info,
+                                                  dB,
+                                                  safe_size * safe_size,
+                                                  &h_beta,
+                                                  dC,
+                                                  safe_size * safe_size),
+                            rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_bsrmm_ex_clear()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex_clear(nullptr, info),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex_clear(handle, nullptr),
+                            rocsparse_status_invalid_pointer);
 }
 
 template <typename T>
@@ -434,6 +742,8 @@ void testing_bsrmm(const Arguments& arg)
     rocsparse_int         dim_z     = arg.dimz;
     rocsparse_operation   transA    = arg.transA;
     rocsparse_operation   transB    = arg.transB;
+    rocsparse_order       orderB    = arg.orderB;
+    rocsparse_order       orderC    = arg.orderC;
     rocsparse_direction   direction = arg.direction;
     rocsparse_index_base  base      = arg.baseA;
     rocsparse_matrix_init mat       = arg.matrix;
@@ -458,6 +768,9 @@ void testing_bsrmm(const Arguments& arg)
     // Create matrix descriptor
     rocsparse_local_mat_descr descr;
 
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
     // Set matrix index base
     CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
 
@@ -481,25 +794,28 @@ void testing_bsrmm(const Arguments& arg)
             return;
         }
 
-        EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm<T>(handle,
-                                                   direction,
-                                                   transA,
-                                                   transB,
-                                                   Mb,
-                                                   N,
-                                                   Kb,
-                                                   safe_size,
-                                                   &h_alpha,
-                                                   descr,
-                                                   dbsr_val,
-                                                   dbsr_row_ptr,
-                                                   dbsr_col_ind,
-                                                   block_dim,
-                                                   dB,
-                                                   safe_size,
-                                                   &h_beta,
-                                                   dC,
-                                                   safe_size),
+        EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmm_ex<T>(handle,
+                                                      direction,
+                                                      transA,
+                                                      transB,
+                                                      orderB,
+                                                      orderC,
+                                                      Mb,
+                                                      N,
+                                                      Kb,
+                                                      safe_size,
+                                                      &h_alpha,
+                                                      descr,
+                                                      dbsr_val,
+                                                      dbsr_row_ptr,
+                                                      dbsr_col_ind,
+                                                      block_dim,
+                                                      info,
+                                                      dB,
+                                                      safe_size,
+                                                      &h_beta,
+                                                      dC,
+                                                      safe_size),
                                 (Mb < 0 || N < 0 || Kb < 0 || block_dim <= 0)
                                     ? rocsparse_status_invalid_size
                                     : rocsparse_status_success);
@@ -551,12 +867,19 @@ void testing_bsrmm(const Arguments& arg)
     K = Kb * block_dim;
 
     // Some matrix properties
-    rocsparse_int ldb = (transB == rocsparse_operation_none) ? K : N;
-    rocsparse_int ldc = M;
+    rocsparse_int nrow_B = (transA == rocsparse_operation_none) ? K : M;
+    rocsparse_int nrow_C = (transA == rocsparse_operation_none) ? M : K;
+
+    // Dimensions of B as it is stored
+    rocsparse_int m_B = (transB == rocsparse_operation_none) ? nrow_B : N;
+    rocsparse_int n_B = (transB == rocsparse_operation_none) ? N : nrow_B;
 
-    rocsparse_int ncol_B = (transB == rocsparse_operation_none ? N : K);
+    rocsparse_int ldb    = (orderB == rocsparse_order_column) ? m_B : n_B;
+    rocsparse_int ldc    = (orderC == rocsparse_order_column) ? nrow_C : N;
+    rocsparse_int ncol_B = (orderB == rocsparse_order_column) ? n_B : m_B;
+    rocsparse_int ncol_C = (orderC == rocsparse_order_column) ? N : nrow_C;
     rocsparse_int nnz_B  = ldb * ncol_B;
-    rocsparse_int nnz_C  = ldc * N;
+    rocsparse_int nnz_C  = ldc * ncol_C;
 
     // Allocate host memory for dense matrices
     host_vector<T> hB(nnz_B);
@@ -566,7 +889,7 @@ void testing_bsrmm(const Arguments& arg)
 
     // Initialize data on CPU
     rocsparse_init<T>(hB, ldb, ncol_B, ldb);
-    rocsparse_init<T>(hC_1, ldc, N, ldc);
+    rocsparse_init<T>(hC_1, ldc, ncol_C, ldc);
     hC_2    = hC_1;
     hC_gold = hC_1;
 
@@ -596,6 +919,20 @@ void testing_bsrmm(const Arguments& arg)
     CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * nnz_B, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dC_1, hC_1, sizeof(T) * nnz_C, hipMemcpyHostToDevice));
 
+    // Analysis, computes the block transpose of A for transposed A
+    CHECK_ROCSPARSE_ERROR(rocsparse_bsrmm_ex_analysis<T>(handle,
+                                                         direction,
+                                                         transA,
+                                                         Mb,
+                                                         Kb,
+                                                         nnzb,
+                                                         descr,
+                                                         dbsr_val,
+                                                         dbsr_row_ptr,
+                                                         dbsr_col_ind,
+                                                         block_dim,
+                                                         info));
+
     if(arg.unit_check)
     {
         // Copy data from CPU to device
@@ -605,47 +942,53 @@ void testing_bsrmm(const Arguments& arg)
 
         // Pointer mode host
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
-        CHECK_ROCSPARSE_ERROR(rocsparse_bsrmm<T>(handle,
-                                                 direction,
-                                                 transA,
-                                                 transB,
-                                                 Mb,
-                                                 N,
-                                                 Kb,
-                                                 nnzb,
-                                                 &h_alpha,
-                                                 descr,
-                                                 dbsr_val,
-                                                 dbsr_row_ptr,
-                                                 dbsr_col_ind,
-                                                 block_dim,
-                                                 dB,
-                                                 ldb,
-                                                 &h_beta,
-                                                 dC_1,
-                                                 ldc));
+        CHECK_ROCSPARSE_ERROR(rocsparse_bsrmm_ex<T>(handle,
+                                                    direction,
+                                                    transA,
+                                                    transB,
+                                                    orderB,
+                                                    orderC,
+                                                    Mb,
+                                                    N,
+                                                    Kb,
+                                                    nnzb,
+                                                    &h_alpha,
+                                                    descr,
+                                                    dbsr_val,
+                                                    dbsr_row_ptr,
+                                                    dbsr_col_ind,
+                                                    block_dim,
+                                                    info,
+                                                    dB,
+                                                    ldb,
+                                                    &h_beta,
+                                                    dC_1,
+                                                    ldc));
 
         // Pointer mode device
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
-        CHECK_ROCSPARSE_ERROR(rocsparse_bsrmm<T>(handle,
-                                                 direction,
-                                                 transA,
-                                                 transB,
-                                                 Mb,
-                                                 N,
-                                                 Kb,
-                                                 nnzb,
-                                                 d_alpha,
-                                                 descr,
-                                                 dbsr_val,
-                                                 dbsr_row_ptr,
-                                                 dbsr_col_ind,
-                                                 block_dim,
-                                                 dB,
-                                                 ldb,
-                                                 d_beta,
-                                                 dC_2,
-                                                 ldc));
+        CHECK_ROCSPARSE_ERROR(rocsparse_bsrmm_ex<T>(handle,
+                                                    direction,
+                                                    transA,
+                                                    transB,
+                                                    orderB,
+                                                    orderC,
+                                                    Mb,
+                                                    N,
+                                                    Kb,
+                                                    nnzb,
+                                                    d_alpha,
+                                                    descr,
+                                                    dbsr_val,
+                                                    dbsr_row_ptr,
+                                                    dbsr_col_ind,
+                                                    block_dim,
+                                                    info,
+                                                    dB,
+                                                    ldb,
+                                                    d_beta,
+                                                    dC_2,
+                                                    ldc));
 
         // Copy output to host
         CHECK_HIP_ERROR(hipMemcpy(hC_1, dC_1, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
@@ -659,6 +1002,8 @@ void testing_bsrmm(const Arguments& arg)
                       direction,
                       transA,
                       transB,
+                      orderB,
+                      orderC,
                       h_alpha,
                       hbsr_row_ptr,
                       hbsr_col_ind,
@@ -670,8 +1015,8 @@ void testing_bsrmm(const Arguments& arg)
                       ldc,
                       base);
 
-        near_check_general<T>(ldc, N, ldc, hC_gold, hC_1);
-        near_check_general<T>(ldc, N, ldc, hC_gold, hC_2);
+        near_check_general<T>(ldc, ncol_C, ldc, hC_gold, hC_1);
+        near_check_general<T>(ldc, ncol_C, ldc, hC_gold, hC_2);
     }
 
     if(arg.timing)
@@ -684,25 +1029,28 @@ void testing_bsrmm(const Arguments& arg)
         // Warm up
         for(int iter = 0; iter < number_cold_calls; ++iter)
         {
-            CHECK_ROCSPARSE_ERROR(rocsparse_bsrmm<T>(handle,
-                                                     direction,
-                                                     transA,
-                                                     transB,
-                                                     Mb,
-                                                     N,
-                                                     Kb,
-                                                     nnzb,
-                                                     &h_alpha,
-                                                     descr,
-                                                     dbsr_val,
-                                                     dbsr_row_ptr,
-                                                     dbsr_col_ind,
-                                                     block_dim,
-                                                     dB,
-                                                     ldb,
-                                                     &h_beta,
-                                                     dC_1,
-                                                     ldc));
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsrmm_ex<T>(handle,
+                                                        direction,
+                                                        transA,
+                                                        transB,
+                                                        orderB,
+                                                        orderC,
+                                                        Mb,
+                                                        N,
+                                                        Kb,
+                                                        nnzb,
+                                                        &h_alpha,
+                                                        descr,
+                                                        dbsr_val,
+                                                        dbsr_row_ptr,
+                                                        dbsr_col_ind,
+                                                        block_dim,
+                                                        info,
+                                                        dB,
+                                                        ldb,
+                                                        &h_beta,
+                                                        dC_1,
+                                                        ldc));
         }
 
         double gpu_time_used = get_time_us();
@@ -710,25 +1058,28 @@ void testing_bsrmm(const Arguments& arg)
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
-            CHECK_ROCSPARSE_ERROR(rocsparse_bsrmm<T>(handle,
-                                                     direction,
-                                                     transA,
-                                                     transB,
-                                                     Mb,
-                                                     N,
-                                                     Kb,
-                                                     nnzb,
-                                                     &h_alpha,
-                                                     descr,
-                                                     dbsr_val,
-                                                     dbsr_row_ptr,
-                                                     dbsr_col_ind,
-                                                     block_dim,
-                                                     dB,
-                                                     ldb,
-                                                     &h_beta,
-                                                     dC_1,
-                                                     ldc));
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsrmm_ex<T>(handle,
+                                                        direction,
+                                                        transA,
+                                                        transB,
+                                                        orderB,
+                                                        orderC,
+                                                        Mb,
+                                                        N,
+                                                        Kb,
+                                                        nnzb,
+                                                        &h_alpha,
+                                                        descr,
+                                                        dbsr_val,
+                                                        dbsr_row_ptr,
+                                                        dbsr_col_ind,
+                                                        block_dim,
+                                                        info,
+                                                        dB,
+                                                        ldb,
+                                                        &h_beta,
+                                                        dC_1,
+                                                        ldc));
         }
 
         gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
@@ -53,6 +53,9 @@ void testing_bsrmv_bad_arg(const Arguments& arg)
     // Create matrix descriptor
     rocsparse_local_mat_descr descr;
 
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
     // Allocate memory on device
     device_vector<rocsparse_int> dbsr_row_ptr(safe_size);
     device_vector<rocsparse_int> dbsr_col_ind(safe_size);
@@ -245,6 +248,299 @@ void testing_bsrmv_bad_arg(const Arguments& arg)
                                                &h_beta,
                                                dy),
                             rocsparse_status_success);
+
+    // Test rocsparse_bsrmv_ex_analysis()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmv_ex_analysis<T>(nullptr,
+                                                           rocsparse_direction_column,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dbsr_val,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           safe_dim,
+                                                           info),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmv_ex_analysis<T>(handle,
+                                                           rocsparse_direction_column,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           safe_size,
+                                                           nullptr,
+                                                           dbsr_val,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           safe_dim,
+                                                           info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmv_ex_analysis<T>(handle,
+                                                           rocsparse_direction_column,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           nullptr,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           safe_dim,
+                                                           info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmv_ex_analysis<T>(handle,
+                                                           rocsparse_direction_column,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dbsr_val,
+                                                           nullptr,
+                                                           dbsr_col_ind,
+                                                           safe_dim,
+                                                           info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmv_ex_analysis<T>(handle,
+                                                           rocsparse_direction_column,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dbsr_val,
+                                                           dbsr_row_ptr,
+                                                           nullptr,
+                                                           safe_dim,
+                                                           info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmv_ex_analysis<T>(handle,
+                                                           rocsparse_direction_column,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dbsr_val,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           safe_dim,
+                                                           nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmv_ex_analysis<T>(handle,
+                                                           rocsparse_direction_column,
+                                                           rocsparse_operation_transpose,
+                                                           -1,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dbsr_val,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           safe_dim,
+                                                           info),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmv_ex_analysis<T>(handle,
+                                                           rocsparse_direction_column,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           -1,
+                                                           safe_size,
+                                                           descr,
+                                                           dbsr_val,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           safe_dim,
+                                                           info),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmv_ex_analysis<T>(handle,
+                                                           rocsparse_direction_column,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           -1,
+                                                           descr,
+                                                           dbsr_val,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           safe_dim,
+                                                           info),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmv_ex_analysis<T>(handle,
+                                                           rocsparse_direction_column,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dbsr_val,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           -1,
+                                                           info),
+                            rocsparse_status_invalid_size);
+
+    // Test rocsparse_bsrmv_ex()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmv_ex<T>(nullptr,
+                                                  rocsparse_direction_column,
+                                                  rocsparse_operation_transpose,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dbsr_val,
+                                                  dbsr_row_ptr,
+                                                  dbsr_col_ind,
+                                                  safe_dim,
+                                                  info,
+                                                  dx,
+                                                  &h_beta,
+                                                  dy),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmv_ex<T>(handle,
+                                                  rocsparse_direction_column,
+                                                  rocsparse_operation_transpose,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  nullptr,
+                                                  descr,
+                                                  dbsr_val,
+                                                  dbsr_row_ptr,
+                                                  dbsr_col_ind,
+                                                  safe_dim,
+                                                  info,
+                                                  dx,
+                                                  &h_beta,
+                                                  dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmv_ex<T>(handle,
+                                                  rocsparse_direction_column,
+                                                  rocsparse_operation_transpose,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  nullptr,
+                                                  dbsr_val,
+                                                  dbsr_row_ptr,
+                                                  dbsr_col_ind,
+                                                  safe_dim,
+                                                  info,
+                                                  dx,
+                                                  &h_beta,
+                                                  dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmv_ex<T>(handle,
+                                                  rocsparse_direction_column,
+                                                  rocsparse_operation_transpose,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  nullptr,
+                                                  dbsr_row_ptr,
+                                                  dbsr_col_ind,
+                                                  safe_dim,
+                                                  info,
+                                                  dx,
+                                                  &h_beta,
+                                                  dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmv_ex<T>(handle,
+                                                  rocsparse_direction_column,
+                                                  rocsparse_operation_transpose,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dbsr_val,
+                                                  nullptr,
+                                                  dbsr_col_ind,
+                                                  safe_dim,
+                                                  info,
+                                                  dx,
+                                                  &h_beta,
+                                                  dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmv_ex<T>(handle,
+                                                  rocsparse_direction_column,
+                                                  rocsparse_operation_transpose,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dbsr_val,
+                                                  dbsr_row_ptr,
+                                                  nullptr,
+                                                  safe_dim,
+                                                  info,
+                                                  dx,
+                                                  &h_beta,
+                                                  dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmv_ex<T>(handle,
+                                                  rocsparse_direction_column,
+                                                  rocsparse_operation_transpose,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dbsr_val,
+                                                  dbsr_row_ptr,
+                                                  dbsr_col_ind,
+                                                  safe_dim,
+                                                  info,
+                                                  nullptr,
+                                                  &h_beta,
+                                                  dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmv_ex<T>(handle,
+                                                  rocsparse_direction_column,
+                                                  rocsparse_operation_transpose,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dbsr_val,
+                                                  dbsr_row_ptr,
+                                                  dbsr_col_ind,
+                                                  safe_dim,
+                                                  info,
+                                                  dx,
+                                                  nullptr,
+                                                  dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmv_ex<T>(handle,
+                                                  rocsparse_direction_column,
+                                                  rocsparse_operation_transpose,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dbsr_val,
+                                                  dbsr_row_ptr,
+                                                  dbsr_col_ind,
+                                                  safe_dim,
+                                                  info,
+                                                  dx,
+                                                  &h_beta,
+                                                  nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_bsrmv_ex_clear()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmv_ex_clear(nullptr, info),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrmv_ex_clear(handle, nullptr),
+                            rocsparse_status_invalid_pointer);
 }
 
 template <typename T>
@@ -259,6 +555,8 @@ void testing_bsrmv(const Arguments& arg)
     rocsparse_direction   dir       = arg.direction;
     rocsparse_operation   trans     = arg.transA;
     rocsparse_index_base  base      = arg.baseA;
+    rocsparse_matrix_type type      = arg.matrix_type;
+    rocsparse_fill_mode   uplo      = arg.uplo;
     rocsparse_int         bsr_dim   = arg.block_dim;
     rocsparse_matrix_init mat       = arg.matrix;
     bool                  full_rank = false;
@@ -274,8 +572,13 @@ void testing_bsrmv(const Arguments& arg)
     // Create matrix descriptor
     rocsparse_local_mat_descr descr;
 
-    // Set matrix index base
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base, type and fill mode
     CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, type));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, uplo));
 
     // BSR dimensions
     rocsparse_int mb = (M + bsr_dim - 1) / bsr_dim;
@@ -315,8 +618,10 @@ void testing_bsrmv(const Arguments& arg)
                                                    dx,
                                                    &h_beta,
                                                    dy),
-                                (mb < 0 || nb < 0 || bsr_dim < 0) ? rocsparse_status_invalid_size
-                                                                  : rocsparse_status_success);
+                                (mb < 0 || nb < 0 || bsr_dim < 0
+                                 || (type != rocsparse_matrix_type_general && mb != nb))
+                                    ? rocsparse_status_invalid_size
+                                    : rocsparse_status_success);
 
         return;
     }
@@ -350,26 +655,33 @@ void testing_bsrmv(const Arguments& arg)
     mb = (M + bsr_dim - 1) / bsr_dim;
     nb = (N + bsr_dim - 1) / bsr_dim;
 
+    // Sizes of x and y, and the number of non-padded entries of y
+    rocsparse_int xsize = ((trans == rocsparse_operation_none) ? nb : mb) * bsr_dim;
+    rocsparse_int ysize = ((trans == rocsparse_operation_none) ? mb : nb) * bsr_dim;
+    rocsparse_int ylen  = (trans == rocsparse_operation_none) ? M : N;
+
     // Allocate host memory for vectors
-    host_vector<T> hx(nb * bsr_dim);
-    host_vector<T> hy_gold(mb * bsr_dim);
+    host_vector<T> hx(xsize);
+    host_vector<T> hy_gold(ysize);
 
     // Initialize data on CPU
     // We need to initialize the padded entries (if any) with zero
-    rocsparse_init<T>(hx, 1, nb * bsr_dim, 1);
-    rocsparse_init<T>(hy_gold, 1, mb * bsr_dim, 1);
+    rocsparse_init<T>(hx, 1, xsize, 1);
+    rocsparse_init<T>(hy_gold, 1, ysize, 1);
 
     // Allocate device memory
     device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
     device_vector<rocsparse_int> dcsr_col_ind(nnz);
     device_vector<T>             dcsr_val(nnz);
-    device_vector<T>             dx(nb * bsr_dim);
-    device_vector<T>             dy_1(mb * bsr_dim);
-    device_vector<T>             dy_2(mb * bsr_dim);
+    device_vector<T>             dx(xsize);
+    device_vector<T>             dy_1(ysize);
+    device_vector<T>             dy_2(ysize);
+    device_vector<T>             dy_3(ysize);
     device_vector<T>             d_alpha(1);
     device_vector<T>             d_beta(1);
 
-    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dx || !dy_1 || !dy_2 || !d_alpha || !d_beta)
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dx || !dy_1 || !dy_2 || !dy_3 || !d_alpha
+       || !d_beta)
     {
         CHECK_HIP_ERROR(hipErrorOutOfMemory);
         return;
@@ -382,8 +694,8 @@ void testing_bsrmv(const Arguments& arg)
     CHECK_HIP_ERROR(
         hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * nb * bsr_dim, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_gold, sizeof(T) * mb * bsr_dim, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * xsize, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_gold, sizeof(T) * ysize, hipMemcpyHostToDevice));
 
     // Convert CSR to BSR
     rocsparse_int                nnzb;
@@ -409,10 +721,25 @@ void testing_bsrmv(const Arguments& arg)
                                                dbsr_row_ptr,
                                                dbsr_col_ind));
 
+    // Block transpose analysis
+    CHECK_ROCSPARSE_ERROR(rocsparse_bsrmv_ex_analysis<T>(handle,
+                                                         dir,
+                                                         trans,
+                                                         mb,
+                                                         nb,
+                                                         nnzb,
+                                                         descr,
+                                                         dbsr_val,
+                                                         dbsr_row_ptr,
+                                                         dbsr_col_ind,
+                                                         bsr_dim,
+                                                         info));
+
     if(arg.unit_check)
     {
         // Copy data from CPU to device
-        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_gold, sizeof(T) * mb * bsr_dim, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_gold, sizeof(T) * ysize, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_3, hy_gold, sizeof(T) * ysize, hipMemcpyHostToDevice));
         CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
         CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
 
@@ -452,12 +779,32 @@ void testing_bsrmv(const Arguments& arg)
                                                  d_beta,
                                                  dy_2));
 
+        // Block transpose, pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_bsrmv_ex<T>(handle,
+                                                    dir,
+                                                    trans,
+                                                    mb,
+                                                    nb,
+                                                    nnzb,
+                                                    d_alpha,
+                                                    descr,
+                                                    dbsr_val,
+                                                    dbsr_row_ptr,
+                                                    dbsr_col_ind,
+                                                    bsr_dim,
+                                                    info,
+                                                    dx,
+                                                    d_beta,
+                                                    dy_3));
+
         // Copy output to host
-        host_vector<T> hy_1(M);
-        host_vector<T> hy_2(M);
+        host_vector<T> hy_1(ylen);
+        host_vector<T> hy_2(ylen);
+        host_vector<T> hy_3(ylen);
 
-        CHECK_HIP_ERROR(hipMemcpy(hy_1, dy_1, sizeof(T) * M, hipMemcpyDeviceToHost));
-        CHECK_HIP_ERROR(hipMemcpy(hy_2, dy_2, sizeof(T) * M, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_1, dy_1, sizeof(T) * ylen, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2, dy_2, sizeof(T) * ylen, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_3, dy_3, sizeof(T) * ylen, hipMemcpyDeviceToHost));
 
         // Make BSR matrix available on host
         host_vector<rocsparse_int> hbsr_row_ptr(mb + 1);
@@ -472,23 +819,45 @@ void testing_bsrmv(const Arguments& arg)
             hbsr_val, dbsr_val, sizeof(T) * nnzb * bsr_dim * bsr_dim, hipMemcpyDeviceToHost));
 
         // CPU bsrmv
-        host_bsrmv<T>(dir,
-                      trans,
-                      mb,
-                      nb,
-                      nnzb,
-                      h_alpha,
-                      hbsr_row_ptr,
-                      hbsr_col_ind,
-                      hbsr_val,
-                      bsr_dim,
-                      hx,
-                      h_beta,
-                      hy_gold,
-                      base);
-
-        near_check_general<T>(1, M, 1, hy_gold, hy_1);
-        near_check_general<T>(1, M, 1, hy_gold, hy_2);
+        if(trans == rocsparse_operation_none && type == rocsparse_matrix_type_general)
+        {
+            host_bsrmv<T>(dir,
+                          trans,
+                          mb,
+                          nb,
+                          nnzb,
+                          h_alpha,
+                          hbsr_row_ptr,
+                          hbsr_col_ind,
+                          hbsr_val,
+                          bsr_dim,
+                          hx,
+                          h_beta,
+                          hy_gold,
+                          base);
+        }
+        else
+        {
+            host_bsrmv_atomic<T>(dir,
+                                 trans,
+                                 type,
+                                 uplo,
+                                 mb,
+                                 nb,
+                                 h_alpha,
+                                 hbsr_row_ptr,
+                                 hbsr_col_ind,
+                                 hbsr_val,
+                                 bsr_dim,
+                                 hx,
+                                 h_beta,
+                                 hy_gold,
+                                 base);
+        }
+
+        near_check_general<T>(1, ylen, 1, hy_gold, hy_1);
+        near_check_general<T>(1, ylen, 1, hy_gold, hy_2);
+        near_check_general<T>(1, ylen, 1, hy_gold, hy_3);
     }
 
     if(arg.timing)
@@ -501,21 +870,22 @@ void testing_bsrmv(const Arguments& arg)
         // Warm up
         for(int iter = 0; iter < number_cold_calls; ++iter)
         {
-            CHECK_ROCSPARSE_ERROR(rocsparse_bsrmv<T>(handle,
-                                                     dir,
-                                                     trans,
-                                                     mb,
-                                                     nb,
-                                                     nnzb,
-                                                     &h_alpha,
-                                                     descr,
-                                                     dbsr_val,
-                                                     dbsr_row_ptr,
-                                                     dbsr_col_ind,
-                                                     bsr_dim,
-                                                     dx,
-                                                     &h_beta,
-                                                     dy_1));
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsrmv_ex<T>(handle,
+                                                        dir,
+                                                        trans,
+                                                        mb,
+                                                        nb,
+                                                        nnzb,
+                                                        &h_alpha,
+                                                        descr,
+                                                        dbsr_val,
+                                                        dbsr_row_ptr,
+                                                        dbsr_col_ind,
+                                                        bsr_dim,
+                                                        info,
+                                                        dx,
+                                                        &h_beta,
+                                                        dy_1));
         }
 
         double gpu_time_used = get_time_us();
@@ -523,21 +893,22 @@ void testing_bsrmv(const Arguments& arg)
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
-            CHECK_ROCSPARSE_ERROR(rocsparse_bsrmv<T>(handle,
-                                                     dir,
-                                                     trans,
-                                                     mb,
-                                                     nb,
-                                                     nnzb,
-                                                     &h_alpha,
-                                                     descr,
-                                                     dbsr_val,
-                                                     dbsr_row_ptr,
-                                                     dbsr_col_ind,
-                                                     bsr_dim,
-                                                     dx,
-                                                     &h_beta,
-                                                     dy_1));
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsrmv_ex<T>(handle,
+                                                        dir,
+                                                        trans,
+                                                        mb,
+                                                        nb,
+                                                        nnzb,
+                                                        &h_alpha,
+                                                        descr,
+                                                        dbsr_val,
+                                                        dbsr_row_ptr,
+                                                        dbsr_col_ind,
+                                                        bsr_dim,
+                                                        info,
+                                                        dx,
+                                                        &h_beta,
+                                                        dy_1));
         }
 
         gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
@@ -553,13 +924,16 @@ void testing_bsrmv(const Arguments& arg)
 
         std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "BSR nnz"
                   << std::setw(12) << "BSR dim" << std::setw(12) << "dir" << std::setw(12)
-                  << "alpha" << std::setw(12) << "beta" << std::setw(12) << "GFlop/s"
-                  << std::setw(12) << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter"
+                  << "trans" << std::setw(12) << "type" << std::setw(12) << "alpha"
+                  << std::setw(12) << "beta" << std::setw(12) << "GFlop/s" << std::setw(12)
+                  << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter"
                   << std::setw(12) << "verified" << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnzb
                   << std::setw(12) << bsr_dim << std::setw(12)
-                  << (dir == rocsparse_direction_row ? "row" : "col") << std::setw(12) << h_alpha
+                  << (dir == rocsparse_direction_row ? "row" : "col") << std::setw(12)
+                  << rocsparse_operation2string(trans) << std::setw(12)
+                  << rocsparse_matrixtype2string(type) << std::setw(12) << h_alpha
                   << std::setw(12) << h_beta << std::setw(12) << gpu_gflops << std::setw(12)
                   << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3 << std::setw(12)
                   << number_hot_calls << std::setw(12) << (arg.unit_check ? "yes" : "no")
@@ -976,6 +976,13 @@ void testing_bsrsv(const Arguments& arg)
                   << gpu_gbyte << std::setw(16) << gpu_analysis_time_used / 1e3 << std::setw(16)
                   << gpu_solve_time_used / 1e3 << std::setw(12) << number_hot_calls << std::setw(12)
                   << (arg.unit_check ? "yes" : "no") << std::endl;
+
+        if(arg.memstat)
+        {
+            print_mat_info_size(info,
+                                sizeof(rocsparse_int) * (mb + 1 + nnzb)
+                                    + sizeof(T) * nnzb * bsr_dim * bsr_dim);
+        }
     }
 
     // Clear bsrsv meta data
@@ -0,0 +1,215 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_COO2CSR_I64_HPP
+#define TESTING_COO2CSR_I64_HPP
+
+#include <rocsparse.hpp>
+
+#include "gbyte.hpp"
+#include "rocsparse_check.hpp"
+#include "rocsparse_host.hpp"
+#include "rocsparse_init.hpp"
+#include "rocsparse_math.hpp"
+#include "rocsparse_random.hpp"
+#include "rocsparse_test.hpp"
+#include "rocsparse_vector.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_coo2csr_i64_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Allocate memory on device
+    device_vector<int64_t> dcsr_row_ptr(safe_size);
+    device_vector<int32_t> dcoo_row_ind(safe_size);
+
+    if(!dcsr_row_ptr || !dcoo_row_ind)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_coo2csr_i64()
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_coo2csr_i64(
+            nullptr, dcoo_row_ind, safe_size, safe_size, dcsr_row_ptr, rocsparse_index_base_zero),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_coo2csr_i64(
+            handle, nullptr, safe_size, safe_size, dcsr_row_ptr, rocsparse_index_base_zero),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_coo2csr_i64(
+            handle, dcoo_row_ind, safe_size, safe_size, nullptr, rocsparse_index_base_zero),
+        rocsparse_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_coo2csr_i64(const Arguments& arg)
+{
+    rocsparse_int         M         = arg.M;
+    rocsparse_int         N         = arg.N;
+    rocsparse_int         K         = arg.K;
+    rocsparse_int         dim_x     = arg.dimx;
+    rocsparse_int         dim_y     = arg.dimy;
+    rocsparse_int         dim_z     = arg.dimz;
+    rocsparse_index_base  base      = arg.baseA;
+    rocsparse_matrix_init mat       = arg.matrix;
+    bool                  full_rank = false;
+    std::string           filename
+        = arg.timing ? arg.filename : rocsparse_exepath() + "../matrices/" + arg.filename + ".csr";
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<int64_t> dcsr_row_ptr(safe_size);
+        device_vector<int32_t> dcoo_row_ind(safe_size);
+
+        if(!dcsr_row_ptr || !dcoo_row_ind)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_coo2csr_i64(handle, dcoo_row_ind, 0, M, dcsr_row_ptr, base),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for COO matrix
+    host_vector<rocsparse_int> hcoo_row_ind_32;
+    host_vector<rocsparse_int> hcoo_col_ind;
+    host_vector<T>             hcoo_val;
+
+    rocsparse_seedrand();
+
+    // Sample matrix
+    rocsparse_int nnz_32;
+    rocsparse_init_coo_matrix(hcoo_row_ind_32,
+                              hcoo_col_ind,
+                              hcoo_val,
+                              M,
+                              N,
+                              K,
+                              dim_x,
+                              dim_y,
+                              dim_z,
+                              nnz_32,
+                              base,
+                              mat,
+                              filename.c_str(),
+                              false,
+                              full_rank);
+
+    // Row indices are kept at 32 bit
+    int64_t              nnz = nnz_32;
+    host_vector<int32_t> hcoo_row_ind(hcoo_row_ind_32.begin(), hcoo_row_ind_32.end());
+
+    // Allocate host memory for CSR matrix
+    host_vector<int64_t> hcsr_row_ptr(M + 1);
+    host_vector<int64_t> hcsr_row_ptr_gold(M + 1);
+
+    // Allocate device memory
+    device_vector<int32_t> dcoo_row_ind(nnz);
+    device_vector<int64_t> dcsr_row_ptr(M + 1);
+
+    if(!dcsr_row_ptr || !dcoo_row_ind)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcoo_row_ind, hcoo_row_ind, sizeof(int32_t) * nnz, hipMemcpyHostToDevice));
+
+    if(arg.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_coo2csr_i64(handle, dcoo_row_ind, nnz, M, dcsr_row_ptr, base));
+
+        // Copy output to host
+        CHECK_HIP_ERROR(hipMemcpy(
+            hcsr_row_ptr, dcsr_row_ptr, sizeof(int64_t) * (M + 1), hipMemcpyDeviceToHost));
+
+        // CPU coo2csr
+        host_coo_to_csr(M, nnz, hcoo_row_ind, hcsr_row_ptr_gold, base);
+
+        unit_check_general<int64_t>(1, M + 1, 1, hcsr_row_ptr_gold, hcsr_row_ptr);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_coo2csr_i64(handle, dcoo_row_ind, nnz, M, dcsr_row_ptr, base));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_coo2csr_i64(handle, dcoo_row_ind, nnz, M, dcsr_row_ptr, base));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gbyte = coo2csr_i64_gbyte_count<T>(M, nnz) / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
+                  << std::setw(12) << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter"
+                  << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
+                  << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+}
+
+#endif // TESTING_COO2CSR_I64_HPP
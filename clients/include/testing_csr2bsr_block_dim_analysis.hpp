@@ -0,0 +1,487 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_CSR2BSR_BLOCK_DIM_ANALYSIS_HPP
+#define TESTING_CSR2BSR_BLOCK_DIM_ANALYSIS_HPP
+
+#include <rocsparse.hpp>
+
+#include "rocsparse_check.hpp"
+#include "rocsparse_host.hpp"
+#include "rocsparse_init.hpp"
+#include "rocsparse_math.hpp"
+#include "rocsparse_random.hpp"
+#include "rocsparse_test.hpp"
+#include "rocsparse_vector.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_csr2bsr_block_dim_analysis_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr csr_descr;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Host arrays
+    rocsparse_int num_block_dims         = 2;
+    rocsparse_int sample_size            = 0;
+    rocsparse_int hblock_dims[2]         = {2, 4};
+    rocsparse_int hinvalid_block_dims[2] = {2, 0};
+    rocsparse_int hbsr_nnzb[2];
+    float         hfill_ratio[2];
+    float         hbsrmv_cost[4];
+
+    // Test rocsparse_csr2bsr_block_dim_analysis()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2bsr_block_dim_analysis<T>(nullptr,
+                                                                    safe_size,
+                                                                    safe_size,
+                                                                    csr_descr,
+                                                                    dcsr_row_ptr,
+                                                                    dcsr_col_ind,
+                                                                    num_block_dims,
+                                                                    hblock_dims,
+                                                                    sample_size,
+                                                                    hbsr_nnzb,
+                                                                    hfill_ratio,
+                                                                    hbsrmv_cost),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2bsr_block_dim_analysis<T>(handle,
+                                                                    safe_size,
+                                                                    safe_size,
+                                                                    nullptr,
+                                                                    dcsr_row_ptr,
+                                                                    dcsr_col_ind,
+                                                                    num_block_dims,
+                                                                    hblock_dims,
+                                                                    sample_size,
+                                                                    hbsr_nnzb,
+                                                                    hfill_ratio,
+                                                                    hbsrmv_cost),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2bsr_block_dim_analysis<T>(handle,
+                                                                    safe_size,
+                                                                    safe_size,
+                                                                    csr_descr,
+                                                                    nullptr,
+                                                                    dcsr_col_ind,
+                                                                    num_block_dims,
+                                                                    hblock_dims,
+                                                                    sample_size,
+                                                                    hbsr_nnzb,
+                                                                    hfill_ratio,
+                                                                    hbsrmv_cost),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2bsr_block_dim_analysis<T>(handle,
+                                                                    safe_size,
+                                                                    safe_size,
+                                                                    csr_descr,
+                                                                    dcsr_row_ptr,
+                                                                    nullptr,
+                                                                    num_block_dims,
+                                                                    hblock_dims,
+                                                                    sample_size,
+                                                                    hbsr_nnzb,
+                                                                    hfill_ratio,
+                                                                    hbsrmv_cost),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2bsr_block_dim_analysis<T>(handle,
+                                                                    safe_size,
+                                                                    safe_size,
+                                                                    csr_descr,
+                                                                    dcsr_row_ptr,
+                                                                    dcsr_col_ind,
+                                                                    num_block_dims,
+                                                                    nullptr,
+                                                                    sample_size,
+                                                                    hbsr_nnzb,
+                                                                    hfill_ratio,
+                                                                    hbsrmv_cost),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2bsr_block_dim_analysis<T>(handle,
+                                                                    safe_size,
+                                                                    safe_size,
+                                                                    csr_descr,
+                                                                    dcsr_row_ptr,
+                                                                    dcsr_col_ind,
+                                                                    num_block_dims,
+                                                                    hblock_dims,
+                                                                    sample_size,
+                                                                    nullptr,
+                                                                    hfill_ratio,
+                                                                    hbsrmv_cost),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2bsr_block_dim_analysis<T>(handle,
+                                                                    safe_size,
+                                                                    safe_size,
+                                                                    csr_descr,
+                                                                    dcsr_row_ptr,
+                                                                    dcsr_col_ind,
+                                                                    num_block_dims,
+                                                                    hblock_dims,
+                                                                    sample_size,
+                                                                    hbsr_nnzb,
+                                                                    nullptr,
+                                                                    hbsrmv_cost),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2bsr_block_dim_analysis<T>(handle,
+                                                                    safe_size,
+                                                                    safe_size,
+                                                                    csr_descr,
+                                                                    dcsr_row_ptr,
+                                                                    dcsr_col_ind,
+                                                                    num_block_dims,
+                                                                    hblock_dims,
+                                                                    sample_size,
+                                                                    hbsr_nnzb,
+                                                                    hfill_ratio,
+                                                                    nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2bsr_block_dim_analysis<T>(handle,
+                                                                    -1,
+                                                                    safe_size,
+                                                                    csr_descr,
+                                                                    dcsr_row_ptr,
+                                                                    dcsr_col_ind,
+                                                                    num_block_dims,
+                                                                    hblock_dims,
+                                                                    sample_size,
+                                                                    hbsr_nnzb,
+                                                                    hfill_ratio,
+                                                                    hbsrmv_cost),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2bsr_block_dim_analysis<T>(handle,
+                                                                    safe_size,
+                                                                    -1,
+                                                                    csr_descr,
+                                                                    dcsr_row_ptr,
+                                                                    dcsr_col_ind,
+                                                                    num_block_dims,
+                                                                    hblock_dims,
+                                                                    sample_size,
+                                                                    hbsr_nnzb,
+                                                                    hfill_ratio,
+                                                                    hbsrmv_cost),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2bsr_block_dim_analysis<T>(handle,
+                                                                    safe_size,
+                                                                    safe_size,
+                                                                    csr_descr,
+                                                                    dcsr_row_ptr,
+                                                                    dcsr_col_ind,
+                                                                    -1,
+                                                                    hblock_dims,
+                                                                    sample_size,
+                                                                    hbsr_nnzb,
+                                                                    hfill_ratio,
+                                                                    hbsrmv_cost),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2bsr_block_dim_analysis<T>(handle,
+                                                                    safe_size,
+                                                                    safe_size,
+                                                                    csr_descr,
+                                                                    dcsr_row_ptr,
+                                                                    dcsr_col_ind,
+                                                                    num_block_dims,
+                                                                    hblock_dims,
+                                                                    -1,
+                                                                    hbsr_nnzb,
+                                                                    hfill_ratio,
+                                                                    hbsrmv_cost),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2bsr_block_dim_analysis<T>(handle,
+                                                                    safe_size,
+                                                                    safe_size,
+                                                                    csr_descr,
+                                                                    dcsr_row_ptr,
+                                                                    dcsr_col_ind,
+                                                                    num_block_dims,
+                                                                    hinvalid_block_dims,
+                                                                    sample_size,
+                                                                    hbsr_nnzb,
+                                                                    hfill_ratio,
+                                                                    hbsrmv_cost),
+                            rocsparse_status_invalid_size);
+}
+
+template <typename T>
+void testing_csr2bsr_block_dim_analysis(const Arguments& arg)
+{
+    rocsparse_int         M           = arg.M;
+    rocsparse_int         N           = arg.N;
+    rocsparse_int         K           = arg.K;
+    rocsparse_int         dim_x       = arg.dimx;
+    rocsparse_int         dim_y       = arg.dimy;
+    rocsparse_int         dim_z       = arg.dimz;
+    rocsparse_index_base  base        = arg.baseA;
+    rocsparse_matrix_init mat         = arg.matrix;
+    rocsparse_int         sample_size = arg.nnz;
+    bool                  full_rank   = false;
+    std::string           filename
+        = arg.timing ? arg.filename : rocsparse_exepath() + "../matrices/" + arg.filename + ".csr";
+
+    // Candidate block dimensions, covering all bsrmv kernels
+    host_vector<rocsparse_int> hblock_dims
+        = arg.timing ? host_vector<rocsparse_int>{1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 24, 32, 64}
+                     : host_vector<rocsparse_int>{1, 2, 3, 4, 5, 6, 7, 8, 16, 37, 64};
+
+    rocsparse_int num_block_dims = hblock_dims.size();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    rocsparse_local_mat_descr csr_descr;
+
+    rocsparse_set_mat_index_base(csr_descr, base);
+
+    host_vector<rocsparse_int> hbsr_nnzb(num_block_dims);
+    host_vector<float>         hfill_ratio(num_block_dims);
+    host_vector<float>         hbsrmv_cost(2 * num_block_dims);
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csr2bsr_block_dim_analysis<T>(handle,
+                                                                        M,
+                                                                        N,
+                                                                        csr_descr,
+                                                                        dcsr_row_ptr,
+                                                                        dcsr_col_ind,
+                                                                        num_block_dims,
+                                                                        hblock_dims,
+                                                                        sample_size,
+                                                                        hbsr_nnzb,
+                                                                        hfill_ratio,
+                                                                        hbsrmv_cost),
+                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for CSR matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    rocsparse_seedrand();
+
+    // Generate (or load from file) CSR matrix
+    rocsparse_int nnz;
+    rocsparse_init_csr_matrix(hcsr_row_ptr,
+                              hcsr_col_ind,
+                              hcsr_val,
+                              M,
+                              N,
+                              K,
+                              dim_x,
+                              dim_y,
+                              dim_z,
+                              nnz,
+                              base,
+                              mat,
+                              filename.c_str(),
+                              false,
+                              full_rank);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+
+    if(arg.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2bsr_block_dim_analysis<T>(handle,
+                                                                      M,
+                                                                      N,
+                                                                      csr_descr,
+                                                                      dcsr_row_ptr,
+                                                                      dcsr_col_ind,
+                                                                      num_block_dims,
+                                                                      hblock_dims,
+                                                                      sample_size,
+                                                                      hbsr_nnzb,
+                                                                      hfill_ratio,
+                                                                      hbsrmv_cost));
+
+        // Host analysis
+        host_vector<rocsparse_int> hbsr_nnzb_gold;
+        host_vector<float>         hfill_ratio_gold;
+        host_vector<float>         hbsrmv_cost_gold;
+
+        host_csr_to_bsr_block_dim_analysis<T>(M,
+                                              N,
+                                              hcsr_row_ptr,
+                                              hcsr_col_ind,
+                                              hblock_dims,
+                                              sample_size,
+                                              hbsr_nnzb_gold,
+                                              hfill_ratio_gold,
+                                              hbsrmv_cost_gold,
+                                              base);
+
+        unit_check_general<rocsparse_int>(1, num_block_dims, 1, hbsr_nnzb_gold, hbsr_nnzb);
+        near_check_general<float>(1, num_block_dims, 1, hfill_ratio_gold, hfill_ratio);
+        near_check_general<float>(1, 2 * num_block_dims, 1, hbsrmv_cost_gold, hbsrmv_cost);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Exact analysis
+        host_vector<rocsparse_int> hbsr_nnzb_exact(num_block_dims);
+        host_vector<float>         hfill_ratio_exact(num_block_dims);
+        host_vector<float>         hbsrmv_cost_exact(2 * num_block_dims);
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2bsr_block_dim_analysis<T>(handle,
+                                                                          M,
+                                                                          N,
+                                                                          csr_descr,
+                                                                          dcsr_row_ptr,
+                                                                          dcsr_col_ind,
+                                                                          num_block_dims,
+                                                                          hblock_dims,
+                                                                          sample_size,
+                                                                          hbsr_nnzb,
+                                                                          hfill_ratio,
+                                                                          hbsrmv_cost));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run, sampled analysis
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2bsr_block_dim_analysis<T>(handle,
+                                                                          M,
+                                                                          N,
+                                                                          csr_descr,
+                                                                          dcsr_row_ptr,
+                                                                          dcsr_col_ind,
+                                                                          num_block_dims,
+                                                                          hblock_dims,
+                                                                          sample_size,
+                                                                          hbsr_nnzb,
+                                                                          hfill_ratio,
+                                                                          hbsrmv_cost));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_exact_time_used = get_time_us();
+
+        // Performance run, exact analysis
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2bsr_block_dim_analysis<T>(handle,
+                                                                          M,
+                                                                          N,
+                                                                          csr_descr,
+                                                                          dcsr_row_ptr,
+                                                                          dcsr_col_ind,
+                                                                          num_block_dims,
+                                                                          hblock_dims,
+                                                                          0,
+                                                                          hbsr_nnzb_exact,
+                                                                          hfill_ratio_exact,
+                                                                          hbsrmv_cost_exact));
+        }
+
+        gpu_exact_time_used = (get_time_us() - gpu_exact_time_used) / number_hot_calls;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
+                  << std::setw(12) << "samples" << std::setw(12) << "msec" << std::setw(12)
+                  << "msec exact" << std::setw(12) << "iter" << std::setw(12) << "verified"
+                  << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
+                  << std::setw(12) << sample_size << std::setw(12) << gpu_time_used / 1e3
+                  << std::setw(12) << gpu_exact_time_used / 1e3 << std::setw(12)
+                  << number_hot_calls << std::setw(12) << (arg.unit_check ? "yes" : "no")
+                  << std::endl;
+
+        // Estimates against exact values for each candidate block dimension
+        std::cout << std::endl;
+        std::cout << std::setw(12) << "block_dim" << std::setw(12) << "nnzb" << std::setw(12)
+                  << "fill" << std::setw(12) << "est nnzb" << std::setw(12) << "est fill"
+                  << std::setw(12) << "cost row" << std::setw(12) << "cost col" << std::endl;
+
+        for(rocsparse_int i = 0; i < num_block_dims; ++i)
+        {
+            std::cout << std::setw(12) << hblock_dims[i] << std::setw(12) << hbsr_nnzb_exact[i]
+                      << std::setw(12) << hfill_ratio_exact[i] << std::setw(12) << hbsr_nnzb[i]
+                      << std::setw(12) << hfill_ratio[i] << std::setw(12)
+                      << hbsrmv_cost_exact[2 * i + rocsparse_direction_row] << std::setw(12)
+                      << hbsrmv_cost_exact[2 * i + rocsparse_direction_column] << std::endl;
+        }
+    }
+}
+
+#endif // TESTING_CSR2BSR_BLOCK_DIM_ANALYSIS_HPP
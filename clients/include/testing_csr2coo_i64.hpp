@@ -0,0 +1,215 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSR2COO_I64_HPP
+#define TESTING_CSR2COO_I64_HPP
+
+#include <rocsparse.hpp>
+
+#include "gbyte.hpp"
+#include "rocsparse_check.hpp"
+#include "rocsparse_host.hpp"
+#include "rocsparse_init.hpp"
+#include "rocsparse_math.hpp"
+#include "rocsparse_random.hpp"
+#include "rocsparse_test.hpp"
+#include "rocsparse_vector.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_csr2coo_i64_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Allocate memory on device
+    device_vector<int64_t> dcsr_row_ptr(safe_size);
+    device_vector<int32_t> dcoo_row_ind(safe_size);
+
+    if(!dcsr_row_ptr || !dcoo_row_ind)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_csr2coo_i64()
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2coo_i64(
+            nullptr, dcsr_row_ptr, safe_size, safe_size, dcoo_row_ind, rocsparse_index_base_zero),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2coo_i64(
+            handle, nullptr, safe_size, safe_size, dcoo_row_ind, rocsparse_index_base_zero),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2coo_i64(
+            handle, dcsr_row_ptr, safe_size, safe_size, nullptr, rocsparse_index_base_zero),
+        rocsparse_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_csr2coo_i64(const Arguments& arg)
+{
+    rocsparse_int         M         = arg.M;
+    rocsparse_int         N         = arg.N;
+    rocsparse_int         K         = arg.K;
+    rocsparse_int         dim_x     = arg.dimx;
+    rocsparse_int         dim_y     = arg.dimy;
+    rocsparse_int         dim_z     = arg.dimz;
+    rocsparse_index_base  base      = arg.baseA;
+    rocsparse_matrix_init mat       = arg.matrix;
+    bool                  full_rank = false;
+    std::string           filename
+        = arg.timing ? arg.filename : rocsparse_exepath() + "../matrices/" + arg.filename + ".csr";
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<int64_t> dcsr_row_ptr(safe_size);
+        device_vector<int32_t> dcoo_row_ind(safe_size);
+
+        if(!dcsr_row_ptr || !dcoo_row_ind)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csr2coo_i64(handle, dcsr_row_ptr, 0, M, dcoo_row_ind, base),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for CSR matrix
+    host_vector<rocsparse_int> hcsr_row_ptr_32;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    rocsparse_seedrand();
+
+    // Sample matrix
+    rocsparse_int nnz_32;
+    rocsparse_init_csr_matrix(hcsr_row_ptr_32,
+                              hcsr_col_ind,
+                              hcsr_val,
+                              M,
+                              N,
+                              K,
+                              dim_x,
+                              dim_y,
+                              dim_z,
+                              nnz_32,
+                              base,
+                              mat,
+                              filename.c_str(),
+                              false,
+                              full_rank);
+
+    // Widen the row offsets to 64 bit
+    int64_t              nnz = nnz_32;
+    host_vector<int64_t> hcsr_row_ptr(hcsr_row_ptr_32.begin(), hcsr_row_ptr_32.end());
+
+    // Allocate host memory for COO matrix
+    host_vector<int32_t> hcoo_row_ind(nnz);
+    host_vector<int32_t> hcoo_row_ind_gold(nnz);
+
+    // Allocate device memory
+    device_vector<int64_t> dcsr_row_ptr(M + 1);
+    device_vector<int32_t> dcoo_row_ind(nnz);
+
+    if(!dcsr_row_ptr || !dcoo_row_ind)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_row_ptr, hcsr_row_ptr, sizeof(int64_t) * (M + 1), hipMemcpyHostToDevice));
+
+    if(arg.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csr2coo_i64(handle, dcsr_row_ptr, nnz, M, dcoo_row_ind, base));
+
+        // Copy output to host
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcoo_row_ind, dcoo_row_ind, sizeof(int32_t) * nnz, hipMemcpyDeviceToHost));
+
+        // CPU csr2coo
+        host_csr_to_coo(M, nnz, hcsr_row_ptr, hcoo_row_ind_gold, base);
+
+        unit_check_general<int32_t>(1, nnz, 1, hcoo_row_ind_gold, hcoo_row_ind);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_csr2coo_i64(handle, dcsr_row_ptr, nnz, M, dcoo_row_ind, base));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_csr2coo_i64(handle, dcsr_row_ptr, nnz, M, dcoo_row_ind, base));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gbyte = csr2coo_i64_gbyte_count<T>(M, nnz) / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
+                  << std::setw(12) << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter"
+                  << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
+                  << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+}
+
+#endif // TESTING_CSR2COO_I64_HPP
@@ -0,0 +1,645 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_CSR2CSRDC_HPP
+#define TESTING_CSR2CSRDC_HPP
+
+#include <rocsparse.hpp>
+
+#include "gbyte.hpp"
+#include "rocsparse_check.hpp"
+#include "rocsparse_host.hpp"
+#include "rocsparse_init.hpp"
+#include "rocsparse_math.hpp"
+#include "rocsparse_random.hpp"
+#include "rocsparse_test.hpp"
+#include "rocsparse_vector.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_csr2csrdc_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<rocsparse_int> dcsrdc_col_base(safe_size);
+    device_vector<uint8_t>       dcsrdc_delta(safe_size);
+    device_vector<rocsparse_int> dcsrdc_exc_ptr(safe_size);
+    device_vector<rocsparse_int> dcsrdc_exc_col(safe_size);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsrdc_col_base || !dcsrdc_delta || !dcsrdc_exc_ptr
+       || !dcsrdc_exc_col)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    rocsparse_int nnz_exc;
+    float         ratio;
+
+    // Test rocsparse_csr2csrdc_nnz()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc_nnz(nullptr,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    8,
+                                                    dcsrdc_exc_ptr,
+                                                    &nnz_exc,
+                                                    &ratio),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    nullptr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    8,
+                                                    dcsrdc_exc_ptr,
+                                                    &nnz_exc,
+                                                    &ratio),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descr,
+                                                    nullptr,
+                                                    dcsr_col_ind,
+                                                    8,
+                                                    dcsrdc_exc_ptr,
+                                                    &nnz_exc,
+                                                    &ratio),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    nullptr,
+                                                    8,
+                                                    dcsrdc_exc_ptr,
+                                                    &nnz_exc,
+                                                    &ratio),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    8,
+                                                    nullptr,
+                                                    &nnz_exc,
+                                                    &ratio),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    8,
+                                                    dcsrdc_exc_ptr,
+                                                    nullptr,
+                                                    &ratio),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    8,
+                                                    dcsrdc_exc_ptr,
+                                                    &nnz_exc,
+                                                    nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc_nnz(handle,
+                                                    -1,
+                                                    safe_size,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    8,
+                                                    dcsrdc_exc_ptr,
+                                                    &nnz_exc,
+                                                    &ratio),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc_nnz(handle,
+                                                    safe_size,
+                                                    -1,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    8,
+                                                    dcsrdc_exc_ptr,
+                                                    &nnz_exc,
+                                                    &ratio),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc_nnz(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    12,
+                                                    dcsrdc_exc_ptr,
+                                                    &nnz_exc,
+                                                    &ratio),
+                            rocsparse_status_invalid_value);
+
+    // Test rocsparse_csr2csrdc()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc(nullptr,
+                                                safe_size,
+                                                safe_size,
+                                                descr,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                8,
+                                                dcsrdc_col_base,
+                                                dcsrdc_delta,
+                                                dcsrdc_exc_ptr,
+                                                dcsrdc_exc_col),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc(handle,
+                                                safe_size,
+                                                safe_size,
+                                                nullptr,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                8,
+                                                dcsrdc_col_base,
+                                                dcsrdc_delta,
+                                                dcsrdc_exc_ptr,
+                                                dcsrdc_exc_col),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc(handle,
+                                                safe_size,
+                                                safe_size,
+                                                descr,
+                                                nullptr,
+                                                dcsr_col_ind,
+                                                8,
+                                                dcsrdc_col_base,
+                                                dcsrdc_delta,
+                                                dcsrdc_exc_ptr,
+                                                dcsrdc_exc_col),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc(handle,
+                                                safe_size,
+                                                safe_size,
+                                                descr,
+                                                dcsr_row_ptr,
+                                                nullptr,
+                                                8,
+                                                dcsrdc_col_base,
+                                                dcsrdc_delta,
+                                                dcsrdc_exc_ptr,
+                                                dcsrdc_exc_col),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc(handle,
+                                                safe_size,
+                                                safe_size,
+                                                descr,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                8,
+                                                nullptr,
+                                                dcsrdc_delta,
+                                                dcsrdc_exc_ptr,
+                                                dcsrdc_exc_col),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc(handle,
+                                                safe_size,
+                                                safe_size,
+                                                descr,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                8,
+                                                dcsrdc_col_base,
+                                                nullptr,
+                                                dcsrdc_exc_ptr,
+                                                dcsrdc_exc_col),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc(handle,
+                                                safe_size,
+                                                safe_size,
+                                                descr,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                8,
+                                                dcsrdc_col_base,
+                                                dcsrdc_delta,
+                                                nullptr,
+                                                dcsrdc_exc_col),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc(handle,
+                                                safe_size,
+                                                safe_size,
+                                                descr,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                8,
+                                                dcsrdc_col_base,
+                                                dcsrdc_delta,
+                                                dcsrdc_exc_ptr,
+                                                nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc(handle,
+                                                -1,
+                                                safe_size,
+                                                descr,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                8,
+                                                dcsrdc_col_base,
+                                                dcsrdc_delta,
+                                                dcsrdc_exc_ptr,
+                                                dcsrdc_exc_col),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc(handle,
+                                                safe_size,
+                                                -1,
+                                                descr,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                8,
+                                                dcsrdc_col_base,
+                                                dcsrdc_delta,
+                                                dcsrdc_exc_ptr,
+                                                dcsrdc_exc_col),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc(handle,
+                                                safe_size,
+                                                safe_size,
+                                                descr,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                12,
+                                                dcsrdc_col_base,
+                                                dcsrdc_delta,
+                                                dcsrdc_exc_ptr,
+                                                dcsrdc_exc_col),
+                            rocsparse_status_invalid_value);
+}
+
+template <typename T>
+void testing_csr2csrdc(const Arguments& arg)
+{
+    rocsparse_int         M          = arg.M;
+    rocsparse_int         N          = arg.N;
+    rocsparse_int         K          = arg.K;
+    rocsparse_int         dim_x      = arg.dimx;
+    rocsparse_int         dim_y      = arg.dimy;
+    rocsparse_int         dim_z      = arg.dimz;
+    rocsparse_int         delta_bits = arg.delta_bits;
+    rocsparse_index_base  base       = arg.baseA;
+    rocsparse_matrix_init mat        = arg.matrix;
+    bool                  full_rank  = false;
+    std::string           filename
+        = arg.timing ? arg.filename : rocsparse_exepath() + "../matrices/" + arg.filename + ".csr";
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        static const size_t safe_size = 100;
+        size_t              ptr_size  = std::max(safe_size, static_cast<size_t>(M + 1));
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(ptr_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<rocsparse_int> dcsrdc_col_base(safe_size);
+        device_vector<uint8_t>       dcsrdc_delta(safe_size);
+        device_vector<rocsparse_int> dcsrdc_exc_ptr(ptr_size);
+        device_vector<rocsparse_int> dcsrdc_exc_col(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsrdc_col_base || !dcsrdc_delta
+           || !dcsrdc_exc_ptr || !dcsrdc_exc_col)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        // Need to initialize csr_row_ptr with 0
+        CHECK_HIP_ERROR(hipMemset(dcsr_row_ptr, 0, sizeof(rocsparse_int) * ptr_size));
+
+        rocsparse_int nnz_exc;
+        float         ratio;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc_nnz(handle,
+                                                        M,
+                                                        N,
+                                                        descr,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        delta_bits,
+                                                        dcsrdc_exc_ptr,
+                                                        &nnz_exc,
+                                                        &ratio),
+                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csr2csrdc(handle,
+                                                    M,
+                                                    N,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    delta_bits,
+                                                    dcsrdc_col_base,
+                                                    dcsrdc_delta,
+                                                    dcsrdc_exc_ptr,
+                                                    dcsrdc_exc_col),
+                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    rocsparse_seedrand();
+
+    // Sample matrix
+    rocsparse_int nnz;
+    rocsparse_init_csr_matrix(hcsr_row_ptr,
+                              hcsr_col_ind,
+                              hcsr_val,
+                              M,
+                              N,
+                              K,
+                              dim_x,
+                              dim_y,
+                              dim_z,
+                              nnz,
+                              base,
+                              mat,
+                              filename.c_str(),
+                              false,
+                              full_rank);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<rocsparse_int> dcsrdc_col_base(M);
+    device_vector<uint8_t>       dcsrdc_delta(nnz * (delta_bits / 8));
+    device_vector<rocsparse_int> dcsrdc_exc_ptr(M + 1);
+    device_vector<rocsparse_int> dnnz_exc(1);
+    device_vector<float>         dratio(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsrdc_col_base || !dcsrdc_delta || !dcsrdc_exc_ptr
+       || !dnnz_exc || !dratio)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+
+    if(arg.unit_check)
+    {
+        rocsparse_int nnz_exc;
+        float         ratio;
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2csrdc_nnz(handle,
+                                                      M,
+                                                      N,
+                                                      descr,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      delta_bits,
+                                                      dcsrdc_exc_ptr,
+                                                      &nnz_exc,
+                                                      &ratio));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2csrdc_nnz(handle,
+                                                      M,
+                                                      N,
+                                                      descr,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      delta_bits,
+                                                      dcsrdc_exc_ptr,
+                                                      dnnz_exc,
+                                                      dratio));
+
+        // Allocate device memory for the exceptions
+        device_vector<rocsparse_int> dcsrdc_exc_col(nnz_exc);
+
+        if(!dcsrdc_exc_col)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        // Perform CSRDC conversion
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2csrdc(handle,
+                                                  M,
+                                                  N,
+                                                  descr,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  delta_bits,
+                                                  dcsrdc_col_base,
+                                                  dcsrdc_delta,
+                                                  dcsrdc_exc_ptr,
+                                                  dcsrdc_exc_col));
+
+        // Copy output to host
+        rocsparse_int bytes = nnz * (delta_bits / 8);
+
+        rocsparse_int              hnnz_exc;
+        float                      hratio;
+        host_vector<rocsparse_int> hcsrdc_col_base(M);
+        host_vector<uint8_t>       hcsrdc_delta(bytes);
+        host_vector<rocsparse_int> hcsrdc_exc_ptr(M + 1);
+        host_vector<rocsparse_int> hcsrdc_exc_col(nnz_exc);
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hnnz_exc, dnnz_exc, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(&hratio, dratio, sizeof(float), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hcsrdc_col_base, dcsrdc_col_base, sizeof(rocsparse_int) * M, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsrdc_delta, dcsrdc_delta, sizeof(uint8_t) * bytes, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsrdc_exc_ptr,
+                                  dcsrdc_exc_ptr,
+                                  sizeof(rocsparse_int) * (M + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsrdc_exc_col,
+                                  dcsrdc_exc_col,
+                                  sizeof(rocsparse_int) * nnz_exc,
+                                  hipMemcpyDeviceToHost));
+
+        // CPU csr2csrdc
+        host_vector<rocsparse_int> hcsrdc_col_base_gold;
+        host_vector<uint8_t>       hcsrdc_delta_gold;
+        host_vector<rocsparse_int> hcsrdc_exc_ptr_gold;
+        host_vector<rocsparse_int> hcsrdc_exc_col_gold;
+
+        float ratio_gold = host_csr_to_csrdc(M,
+                                             delta_bits,
+                                             hcsr_row_ptr,
+                                             hcsr_col_ind,
+                                             hcsrdc_col_base_gold,
+                                             hcsrdc_delta_gold,
+                                             hcsrdc_exc_ptr_gold,
+                                             hcsrdc_exc_col_gold,
+                                             base);
+
+        rocsparse_int nnz_exc_gold = hcsrdc_exc_col_gold.size();
+
+        unit_check_general<rocsparse_int>(1, 1, 1, &nnz_exc_gold, &nnz_exc);
+        unit_check_general<rocsparse_int>(1, 1, 1, &nnz_exc_gold, &hnnz_exc);
+        near_check_general<float>(1, 1, 1, &ratio_gold, &ratio);
+        near_check_general<float>(1, 1, 1, &ratio_gold, &hratio);
+        unit_check_general<rocsparse_int>(1, M + 1, 1, hcsrdc_exc_ptr_gold, hcsrdc_exc_ptr);
+        unit_check_general<rocsparse_int>(1, M, 1, hcsrdc_col_base_gold, hcsrdc_col_base);
+        unit_check_general<uint8_t>(1, bytes, 1, hcsrdc_delta_gold, hcsrdc_delta);
+        unit_check_general<rocsparse_int>(1, nnz_exc, 1, hcsrdc_exc_col_gold, hcsrdc_exc_col);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        rocsparse_int nnz_exc;
+        float         ratio;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2csrdc_nnz(handle,
+                                                          M,
+                                                          N,
+                                                          descr,
+                                                          dcsr_row_ptr,
+                                                          dcsr_col_ind,
+                                                          delta_bits,
+                                                          dcsrdc_exc_ptr,
+                                                          &nnz_exc,
+                                                          &ratio));
+
+            device_vector<rocsparse_int> dcsrdc_exc_col(nnz_exc);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2csrdc(handle,
+                                                      M,
+                                                      N,
+                                                      descr,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      delta_bits,
+                                                      dcsrdc_col_base,
+                                                      dcsrdc_delta,
+                                                      dcsrdc_exc_ptr,
+                                                      dcsrdc_exc_col));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2csrdc_nnz(handle,
+                                                          M,
+                                                          N,
+                                                          descr,
+                                                          dcsr_row_ptr,
+                                                          dcsr_col_ind,
+                                                          delta_bits,
+                                                          dcsrdc_exc_ptr,
+                                                          &nnz_exc,
+                                                          &ratio));
+
+            device_vector<rocsparse_int> dcsrdc_exc_col(nnz_exc);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2csrdc(handle,
+                                                      M,
+                                                      N,
+                                                      descr,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      delta_bits,
+                                                      dcsrdc_col_base,
+                                                      dcsrdc_delta,
+                                                      dcsrdc_exc_ptr,
+                                                      dcsrdc_exc_col));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gbyte
+            = csr2csrdc_gbyte_count<T>(M, nnz, nnz_exc, delta_bits) / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
+                  << std::setw(12) << "delta bits" << std::setw(12) << "exceptions"
+                  << std::setw(12) << "ratio" << std::setw(12) << "GB/s" << std::setw(12)
+                  << "msec" << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
+                  << std::setw(12) << delta_bits << std::setw(12) << nnz_exc << std::setw(12)
+                  << ratio << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+}
+
+#endif // TESTING_CSR2CSRDC_HPP
@@ -0,0 +1,553 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_CSR2DIA_HPP
+#define TESTING_CSR2DIA_HPP
+
+#include <rocsparse.hpp>
+
+#include "gbyte.hpp"
+#include "rocsparse_check.hpp"
+#include "rocsparse_host.hpp"
+#include "rocsparse_init.hpp"
+#include "rocsparse_math.hpp"
+#include "rocsparse_random.hpp"
+#include "rocsparse_test.hpp"
+#include "rocsparse_vector.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_csr2dia_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<T>             dcsr_val(safe_size);
+    device_vector<rocsparse_int> ddia_offset(safe_size);
+    device_vector<T>             ddia_val(safe_size);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !ddia_offset || !ddia_val)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_csr2dia_ndiag()
+    rocsparse_int dia_num_diag;
+    float         dia_fill;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2dia_ndiag(nullptr,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    &dia_num_diag,
+                                                    &dia_fill),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2dia_ndiag(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    nullptr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    &dia_num_diag,
+                                                    &dia_fill),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2dia_ndiag(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descr,
+                                                    nullptr,
+                                                    dcsr_col_ind,
+                                                    &dia_num_diag,
+                                                    &dia_fill),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2dia_ndiag(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    nullptr,
+                                                    &dia_num_diag,
+                                                    &dia_fill),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2dia_ndiag(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    nullptr,
+                                                    &dia_fill),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2dia_ndiag(handle,
+                                                    safe_size,
+                                                    safe_size,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    &dia_num_diag,
+                                                    nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2dia_ndiag(handle,
+                                                    -1,
+                                                    safe_size,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    &dia_num_diag,
+                                                    &dia_fill),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2dia_ndiag(handle,
+                                                    safe_size,
+                                                    -1,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    &dia_num_diag,
+                                                    &dia_fill),
+                            rocsparse_status_invalid_size);
+
+    // Test rocsparse_csr2dia()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2dia<T>(nullptr,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 ddia_val,
+                                                 ddia_offset),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2dia<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 nullptr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 ddia_val,
+                                                 ddia_offset),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2dia<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 nullptr,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 ddia_val,
+                                                 ddia_offset),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2dia<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 nullptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 ddia_val,
+                                                 ddia_offset),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2dia<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 nullptr,
+                                                 safe_size,
+                                                 ddia_val,
+                                                 ddia_offset),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2dia<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 nullptr,
+                                                 ddia_offset),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2dia<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 ddia_val,
+                                                 nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2dia<T>(handle,
+                                                 -1,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 ddia_val,
+                                                 ddia_offset),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2dia<T>(handle,
+                                                 safe_size,
+                                                 -1,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 ddia_val,
+                                                 ddia_offset),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2dia<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 -1,
+                                                 ddia_val,
+                                                 ddia_offset),
+                            rocsparse_status_invalid_size);
+}
+
+template <typename T>
+void testing_csr2dia(const Arguments& arg)
+{
+    rocsparse_int         M         = arg.M;
+    rocsparse_int         N         = arg.N;
+    rocsparse_int         K         = arg.K;
+    rocsparse_int         dim_x     = arg.dimx;
+    rocsparse_int         dim_y     = arg.dimy;
+    rocsparse_int         dim_z     = arg.dimz;
+    rocsparse_index_base  base      = arg.baseA;
+    rocsparse_matrix_init mat       = arg.matrix;
+    bool                  full_rank = false;
+    std::string           filename
+        = arg.timing ? arg.filename : rocsparse_exepath() + "../matrices/" + arg.filename + ".csr";
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        static const size_t safe_size = 100;
+        size_t              ptr_size  = std::max(safe_size, static_cast<size_t>(M + 1));
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(ptr_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<rocsparse_int> ddia_offset(safe_size);
+        device_vector<T>             ddia_val(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !ddia_offset || !ddia_val)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        // Need to initialize csr_row_ptr with 0
+        CHECK_HIP_ERROR(hipMemset(dcsr_row_ptr, 0, sizeof(rocsparse_int) * ptr_size));
+
+        rocsparse_int dia_num_diag;
+        float         dia_fill;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csr2dia_ndiag(handle,
+                                                        M,
+                                                        N,
+                                                        descr,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        &dia_num_diag,
+                                                        &dia_fill),
+                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csr2dia<T>(handle,
+                                                     M,
+                                                     N,
+                                                     descr,
+                                                     dcsr_val,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     0,
+                                                     ddia_val,
+                                                     ddia_offset),
+                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+    host_vector<rocsparse_int> hdia_offset;
+    host_vector<T>             hdia_val;
+    host_vector<rocsparse_int> hdia_offset_gold;
+    host_vector<T>             hdia_val_gold;
+
+    rocsparse_seedrand();
+
+    // Sample matrix
+    rocsparse_int nnz;
+    rocsparse_init_csr_matrix(hcsr_row_ptr,
+                              hcsr_col_ind,
+                              hcsr_val,
+                              M,
+                              N,
+                              K,
+                              dim_x,
+                              dim_y,
+                              dim_z,
+                              nnz,
+                              base,
+                              mat,
+                              filename.c_str(),
+                              false,
+                              full_rank);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<rocsparse_int> ddia_num_diag(1);
+    device_vector<float>         ddia_fill(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !ddia_num_diag || !ddia_fill)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    if(arg.unit_check)
+    {
+        // Obtain number of diagonals and fill, pointer mode host
+        rocsparse_int dia_num_diag;
+        float         dia_fill;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2dia_ndiag(handle,
+                                                      M,
+                                                      N,
+                                                      descr,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      &dia_num_diag,
+                                                      &dia_fill));
+
+        // Pointer mode device
+        rocsparse_int dia_num_diag_2;
+        float         dia_fill_2;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2dia_ndiag(handle,
+                                                      M,
+                                                      N,
+                                                      descr,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      ddia_num_diag,
+                                                      ddia_fill));
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            &dia_num_diag_2, ddia_num_diag, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(&dia_fill_2, ddia_fill, sizeof(float), hipMemcpyDeviceToHost));
+
+        // Allocate device memory
+        rocsparse_int dia_nnz = dia_num_diag * M;
+
+        device_vector<rocsparse_int> ddia_offset(dia_num_diag);
+        device_vector<T>             ddia_val(dia_nnz);
+
+        // Perform DIA conversion
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2dia<T>(handle,
+                                                   M,
+                                                   N,
+                                                   descr,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   dia_num_diag,
+                                                   ddia_val,
+                                                   ddia_offset));
+
+        // Copy output to host
+        hdia_offset.resize(dia_num_diag);
+        hdia_val.resize(dia_nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            hdia_offset, ddia_offset, sizeof(rocsparse_int) * dia_num_diag, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hdia_val, ddia_val, sizeof(T) * dia_nnz, hipMemcpyDeviceToHost));
+
+        // CPU csr2dia
+        rocsparse_int dia_num_diag_gold;
+
+        float dia_fill_gold = host_csr_to_dia<T>(M,
+                                                 N,
+                                                 hcsr_row_ptr,
+                                                 hcsr_col_ind,
+                                                 hcsr_val,
+                                                 hdia_offset_gold,
+                                                 hdia_val_gold,
+                                                 dia_num_diag_gold,
+                                                 base);
+
+        unit_check_general<rocsparse_int>(1, 1, 1, &dia_num_diag_gold, &dia_num_diag);
+        unit_check_general<rocsparse_int>(1, 1, 1, &dia_num_diag_gold, &dia_num_diag_2);
+        near_check_general<float>(1, 1, 1, &dia_fill_gold, &dia_fill);
+        near_check_general<float>(1, 1, 1, &dia_fill_gold, &dia_fill_2);
+        unit_check_general<rocsparse_int>(1, dia_num_diag, 1, hdia_offset_gold, hdia_offset);
+        unit_check_general<T>(1, dia_nnz, 1, hdia_val_gold, hdia_val);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        rocsparse_int dia_num_diag;
+        float         dia_fill;
+        rocsparse_int dia_nnz;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2dia_ndiag(handle,
+                                                          M,
+                                                          N,
+                                                          descr,
+                                                          dcsr_row_ptr,
+                                                          dcsr_col_ind,
+                                                          &dia_num_diag,
+                                                          &dia_fill));
+
+            dia_nnz = dia_num_diag * M;
+
+            device_vector<rocsparse_int> ddia_offset(dia_num_diag);
+            device_vector<T>             ddia_val(dia_nnz);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2dia<T>(handle,
+                                                       M,
+                                                       N,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       dia_num_diag,
+                                                       ddia_val,
+                                                       ddia_offset));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2dia_ndiag(handle,
+                                                          M,
+                                                          N,
+                                                          descr,
+                                                          dcsr_row_ptr,
+                                                          dcsr_col_ind,
+                                                          &dia_num_diag,
+                                                          &dia_fill));
+
+            dia_nnz = dia_num_diag * M;
+
+            device_vector<rocsparse_int> ddia_offset(dia_num_diag);
+            device_vector<T>             ddia_val(dia_nnz);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2dia<T>(handle,
+                                                       M,
+                                                       N,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       dia_num_diag,
+                                                       ddia_val,
+                                                       ddia_offset));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gbyte
+            = csr2dia_gbyte_count<T>(M, nnz, dia_nnz, dia_num_diag) / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
+                  << std::setw(12) << "diagonals" << std::setw(12) << "fill" << std::setw(12)
+                  << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter"
+                  << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
+                  << std::setw(12) << dia_num_diag << std::setw(12) << dia_fill << std::setw(12)
+                  << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3 << std::setw(12)
+                  << number_hot_calls << std::setw(12) << (arg.unit_check ? "yes" : "no")
+                  << std::endl;
+    }
+}
+
+#endif // TESTING_CSR2DIA_HPP
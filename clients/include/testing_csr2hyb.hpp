@@ -129,6 +129,45 @@ void testing_csr2hyb_bad_arg(const Arguments& arg)
                                                  0,
                                                  rocsparse_hyb_partition_auto),
                             rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csr2hyb_ell_width_analysis()
+    rocsparse_int ell_width;
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2hyb_ell_width_analysis<T>(nullptr,
+                                                                    safe_size,
+                                                                    descr,
+                                                                    dcsr_row_ptr,
+                                                                    &ell_width,
+                                                                    nullptr),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2hyb_ell_width_analysis<T>(handle,
+                                                                    safe_size,
+                                                                    nullptr,
+                                                                    dcsr_row_ptr,
+                                                                    &ell_width,
+                                                                    nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2hyb_ell_width_analysis<T>(handle,
+                                                                    -1,
+                                                                    descr,
+                                                                    dcsr_row_ptr,
+                                                                    &ell_width,
+                                                                    nullptr),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2hyb_ell_width_analysis<T>(handle,
+                                                                    safe_size,
+                                                                    descr,
+                                                                    nullptr,
+                                                                    &ell_width,
+                                                                    nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2hyb_ell_width_analysis<T>(handle,
+                                                                    safe_size,
+                                                                    descr,
+                                                                    dcsr_row_ptr,
+                                                                    nullptr,
+                                                                    nullptr),
+                            rocsparse_status_invalid_pointer);
 }
 
 template <typename T>
@@ -364,6 +403,43 @@ void testing_csr2hyb(const Arguments& arg)
         unit_check_general<rocsparse_int>(1, coo_nnz, 1, hhyb_coo_row_ind_gold, hhyb_coo_row_ind);
         unit_check_general<rocsparse_int>(1, coo_nnz, 1, hhyb_coo_col_ind_gold, hhyb_coo_col_ind);
         unit_check_general<T>(1, coo_nnz, 1, hhyb_coo_val_gold, hhyb_coo_val);
+
+        // Check device memory held by the HYB structure
+        size_t ell_size;
+        size_t coo_size;
+        size_t hyb_size;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_get_hyb_mat_size(hyb, &ell_size, &coo_size, &hyb_size));
+
+        size_t ell_size_gold = (sizeof(rocsparse_int) + sizeof(T)) * ell_nnz_gold;
+        size_t coo_size_gold = (2 * sizeof(rocsparse_int) + sizeof(T)) * coo_nnz_gold;
+        size_t hyb_size_gold = ell_size_gold + coo_size_gold;
+
+        unit_check_general<size_t>(1, 1, 1, &ell_size_gold, &ell_size);
+        unit_check_general<size_t>(1, 1, 1, &coo_size_gold, &coo_size);
+        unit_check_general<size_t>(1, 1, 1, &hyb_size_gold, &hyb_size);
+
+        // CPU ELL width analysis of the auto partition
+        rocsparse_int              hyb_width_gold;
+        rocsparse_int              hyb_coo_nnz_gold;
+        host_vector<rocsparse_int> hrow_nnz_hist_gold;
+
+        host_csr_to_hyb_ell_width<T>(
+            M, nnz, hcsr_row_ptr, hyb_width_gold, hyb_coo_nnz_gold, hrow_nnz_hist_gold);
+
+        rocsparse_int              hist_size = hrow_nnz_hist_gold.size();
+        rocsparse_int              hyb_width;
+        host_vector<rocsparse_int> hrow_nnz_hist(hist_size);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb_ell_width_analysis<T>(handle,
+                                                                      M,
+                                                                      descr,
+                                                                      dcsr_row_ptr,
+                                                                      &hyb_width,
+                                                                      hrow_nnz_hist));
+
+        unit_check_general<rocsparse_int>(1, 1, 1, &hyb_width_gold, &hyb_width);
+        unit_check_general<rocsparse_int>(1, hist_size, 1, hrow_nnz_hist_gold, hrow_nnz_hist);
     }
 
     if(arg.timing)
@@ -417,14 +493,16 @@ void testing_csr2hyb(const Arguments& arg)
         std::cout.setf(std::ios::fixed);
         std::cout.setf(std::ios::left);
 
-        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "ELL nnz"
-                  << std::setw(12) << "COO nnz" << std::setw(12) << "GB/s" << std::setw(12)
-                  << "msec" << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "ELL width"
+                  << std::setw(12) << "ELL nnz" << std::setw(12) << "COO nnz" << std::setw(12)
+                  << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter" << std::setw(12)
+                  << "verified" << std::endl;
 
-        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << ell_nnz
-                  << std::setw(12) << coo_nnz << std::setw(12) << gpu_gbyte << std::setw(12)
-                  << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << dhyb->ell_width
+                  << std::setw(12) << ell_nnz << std::setw(12) << coo_nnz << std::setw(12)
+                  << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3 << std::setw(12)
+                  << number_hot_calls << std::setw(12) << (arg.unit_check ? "yes" : "no")
+                  << std::endl;
     }
 }
 
@@ -0,0 +1,1111 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_CSR2VBR_HPP
+#define TESTING_CSR2VBR_HPP
+
+#include <rocsparse.hpp>
+
+#include "gbyte.hpp"
+#include "rocsparse_check.hpp"
+#include "rocsparse_host.hpp"
+#include "rocsparse_init.hpp"
+#include "rocsparse_math.hpp"
+#include "rocsparse_random.hpp"
+#include "rocsparse_test.hpp"
+#include "rocsparse_vector.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_csr2vbr_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr csr_descr;
+    rocsparse_local_mat_descr vbr_descr;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<T>             dcsr_val(safe_size);
+    device_vector<rocsparse_int> dvbr_row_ptn(safe_size);
+    device_vector<rocsparse_int> dvbr_col_ptn(safe_size);
+    device_vector<rocsparse_int> dvbr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dvbr_col_ind(safe_size);
+    device_vector<rocsparse_int> dvbr_val_ptr(safe_size);
+    device_vector<T>             dvbr_val(safe_size);
+
+    rocsparse_int hmb;
+    rocsparse_int hnb;
+    rocsparse_int hnnzb;
+    rocsparse_int hnnz;
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dvbr_row_ptn || !dvbr_col_ptn
+       || !dvbr_row_ptr || !dvbr_col_ind || !dvbr_val_ptr || !dvbr_val)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_csr2vbr_partition()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_partition(nullptr,
+                                                        safe_size,
+                                                        safe_size,
+                                                        csr_descr,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        vbr_descr,
+                                                        &hmb,
+                                                        &hnb,
+                                                        dvbr_row_ptn,
+                                                        dvbr_col_ptn),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_partition(handle,
+                                                        safe_size,
+                                                        safe_size,
+                                                        nullptr,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        vbr_descr,
+                                                        &hmb,
+                                                        &hnb,
+                                                        dvbr_row_ptn,
+                                                        dvbr_col_ptn),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_partition(handle,
+                                                        safe_size,
+                                                        safe_size,
+                                                        csr_descr,
+                                                        nullptr,
+                                                        dcsr_col_ind,
+                                                        vbr_descr,
+                                                        &hmb,
+                                                        &hnb,
+                                                        dvbr_row_ptn,
+                                                        dvbr_col_ptn),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_partition(handle,
+                                                        safe_size,
+                                                        safe_size,
+                                                        csr_descr,
+                                                        dcsr_row_ptr,
+                                                        nullptr,
+                                                        vbr_descr,
+                                                        &hmb,
+                                                        &hnb,
+                                                        dvbr_row_ptn,
+                                                        dvbr_col_ptn),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_partition(handle,
+                                                        safe_size,
+                                                        safe_size,
+                                                        csr_descr,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        nullptr,
+                                                        &hmb,
+                                                        &hnb,
+                                                        dvbr_row_ptn,
+                                                        dvbr_col_ptn),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_partition(handle,
+                                                        safe_size,
+                                                        safe_size,
+                                                        csr_descr,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        vbr_descr,
+                                                        nullptr,
+                                                        &hnb,
+                                                        dvbr_row_ptn,
+                                                        dvbr_col_ptn),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_partition(handle,
+                                                        safe_size,
+                                                        safe_size,
+                                                        csr_descr,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        vbr_descr,
+                                                        &hmb,
+                                                        nullptr,
+                                                        dvbr_row_ptn,
+                                                        dvbr_col_ptn),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_partition(handle,
+                                                        safe_size,
+                                                        safe_size,
+                                                        csr_descr,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        vbr_descr,
+                                                        &hmb,
+                                                        &hnb,
+                                                        nullptr,
+                                                        dvbr_col_ptn),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_partition(handle,
+                                                        safe_size,
+                                                        safe_size,
+                                                        csr_descr,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        vbr_descr,
+                                                        &hmb,
+                                                        &hnb,
+                                                        dvbr_row_ptn,
+                                                        nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_partition(handle,
+                                                        -1,
+                                                        safe_size,
+                                                        csr_descr,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        vbr_descr,
+                                                        &hmb,
+                                                        &hnb,
+                                                        dvbr_row_ptn,
+                                                        dvbr_col_ptn),
+                            rocsparse_status_invalid_size);
+
+    // Test rocsparse_csr2vbr_nnz()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_nnz(nullptr,
+                                                  safe_size,
+                                                  safe_size,
+                                                  csr_descr,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  safe_size,
+                                                  safe_size,
+                                                  vbr_descr,
+                                                  dvbr_row_ptr,
+                                                  dvbr_row_ptn,
+                                                  dvbr_col_ptn,
+                                                  &hnnzb,
+                                                  &hnnz),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  nullptr,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  safe_size,
+                                                  safe_size,
+                                                  vbr_descr,
+                                                  dvbr_row_ptr,
+                                                  dvbr_row_ptn,
+                                                  dvbr_col_ptn,
+                                                  &hnnzb,
+                                                  &hnnz),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  csr_descr,
+                                                  nullptr,
+                                                  dcsr_col_ind,
+                                                  safe_size,
+                                                  safe_size,
+                                                  vbr_descr,
+                                                  dvbr_row_ptr,
+                                                  dvbr_row_ptn,
+                                                  dvbr_col_ptn,
+                                                  &hnnzb,
+                                                  &hnnz),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  csr_descr,
+                                                  dcsr_row_ptr,
+                                                  nullptr,
+                                                  safe_size,
+                                                  safe_size,
+                                                  vbr_descr,
+                                                  dvbr_row_ptr,
+                                                  dvbr_row_ptn,
+                                                  dvbr_col_ptn,
+                                                  &hnnzb,
+                                                  &hnnz),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  csr_descr,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  safe_size,
+                                                  safe_size,
+                                                  nullptr,
+                                                  dvbr_row_ptr,
+                                                  dvbr_row_ptn,
+                                                  dvbr_col_ptn,
+                                                  &hnnzb,
+                                                  &hnnz),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  csr_descr,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  safe_size,
+                                                  safe_size,
+                                                  vbr_descr,
+                                                  nullptr,
+                                                  dvbr_row_ptn,
+                                                  dvbr_col_ptn,
+                                                  &hnnzb,
+                                                  &hnnz),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  csr_descr,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  safe_size,
+                                                  safe_size,
+                                                  vbr_descr,
+                                                  dvbr_row_ptr,
+                                                  nullptr,
+                                                  dvbr_col_ptn,
+                                                  &hnnzb,
+                                                  &hnnz),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  csr_descr,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  safe_size,
+                                                  safe_size,
+                                                  vbr_descr,
+                                                  dvbr_row_ptr,
+                                                  dvbr_row_ptn,
+                                                  nullptr,
+                                                  &hnnzb,
+                                                  &hnnz),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  csr_descr,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  safe_size,
+                                                  safe_size,
+                                                  vbr_descr,
+                                                  dvbr_row_ptr,
+                                                  dvbr_row_ptn,
+                                                  dvbr_col_ptn,
+                                                  nullptr,
+                                                  &hnnz),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  csr_descr,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  safe_size,
+                                                  safe_size,
+                                                  vbr_descr,
+                                                  dvbr_row_ptr,
+                                                  dvbr_row_ptn,
+                                                  dvbr_col_ptn,
+                                                  &hnnzb,
+                                                  nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  csr_descr,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  -1,
+                                                  safe_size,
+                                                  vbr_descr,
+                                                  dvbr_row_ptr,
+                                                  dvbr_row_ptn,
+                                                  dvbr_col_ptn,
+                                                  &hnnzb,
+                                                  &hnnz),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_nnz(handle,
+                                                  1,
+                                                  safe_size,
+                                                  csr_descr,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  safe_size,
+                                                  safe_size,
+                                                  vbr_descr,
+                                                  dvbr_row_ptr,
+                                                  dvbr_row_ptn,
+                                                  dvbr_col_ptn,
+                                                  &hnnzb,
+                                                  &hnnz),
+                            rocsparse_status_invalid_size);
+
+    // Test rocsparse_csr2vbr()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr<T>(nullptr,
+                                                 rocsparse_direction_row,
+                                                 safe_size,
+                                                 safe_size,
+                                                 csr_descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 safe_size,
+                                                 vbr_descr,
+                                                 dvbr_val,
+                                                 dvbr_val_ptr,
+                                                 dvbr_row_ptr,
+                                                 dvbr_col_ind,
+                                                 dvbr_row_ptn,
+                                                 dvbr_col_ptn),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr<T>(handle,
+                                                 rocsparse_direction_row,
+                                                 safe_size,
+                                                 safe_size,
+                                                 nullptr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 safe_size,
+                                                 vbr_descr,
+                                                 dvbr_val,
+                                                 dvbr_val_ptr,
+                                                 dvbr_row_ptr,
+                                                 dvbr_col_ind,
+                                                 dvbr_row_ptn,
+                                                 dvbr_col_ptn),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr<T>(handle,
+                                                 rocsparse_direction_row,
+                                                 safe_size,
+                                                 safe_size,
+                                                 csr_descr,
+                                                 nullptr,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 safe_size,
+                                                 vbr_descr,
+                                                 dvbr_val,
+                                                 dvbr_val_ptr,
+                                                 dvbr_row_ptr,
+                                                 dvbr_col_ind,
+                                                 dvbr_row_ptn,
+                                                 dvbr_col_ptn),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr<T>(handle,
+                                                 rocsparse_direction_row,
+                                                 safe_size,
+                                                 safe_size,
+                                                 csr_descr,
+                                                 dcsr_val,
+                                                 nullptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 safe_size,
+                                                 vbr_descr,
+                                                 dvbr_val,
+                                                 dvbr_val_ptr,
+                                                 dvbr_row_ptr,
+                                                 dvbr_col_ind,
+                                                 dvbr_row_ptn,
+                                                 dvbr_col_ptn),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr<T>(handle,
+                                                 rocsparse_direction_row,
+                                                 safe_size,
+                                                 safe_size,
+                                                 csr_descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 nullptr,
+                                                 safe_size,
+                                                 safe_size,
+                                                 vbr_descr,
+                                                 dvbr_val,
+                                                 dvbr_val_ptr,
+                                                 dvbr_row_ptr,
+                                                 dvbr_col_ind,
+                                                 dvbr_row_ptn,
+                                                 dvbr_col_ptn),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr<T>(handle,
+                                                 rocsparse_direction_row,
+                                                 safe_size,
+                                                 safe_size,
+                                                 csr_descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 safe_size,
+                                                 nullptr,
+                                                 dvbr_val,
+                                                 dvbr_val_ptr,
+                                                 dvbr_row_ptr,
+                                                 dvbr_col_ind,
+                                                 dvbr_row_ptn,
+                                                 dvbr_col_ptn),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr<T>(handle,
+                                                 rocsparse_direction_row,
+                                                 safe_size,
+                                                 safe_size,
+                                                 csr_descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 safe_size,
+                                                 vbr_descr,
+                                                 nullptr,
+                                                 dvbr_val_ptr,
+                                                 dvbr_row_ptr,
+                                                 dvbr_col_ind,
+                                                 dvbr_row_ptn,
+                                                 dvbr_col_ptn),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr<T>(handle,
+                                                 rocsparse_direction_row,
+                                                 safe_size,
+                                                 safe_size,
+                                                 csr_descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 safe_size,
+                                                 vbr_descr,
+                                                 dvbr_val,
+                                                 nullptr,
+                                                 dvbr_row_ptr,
+                                                 dvbr_col_ind,
+                                                 dvbr_row_ptn,
+                                                 dvbr_col_ptn),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr<T>(handle,
+                                                 rocsparse_direction_row,
+                                                 safe_size,
+                                                 safe_size,
+                                                 csr_descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 safe_size,
+                                                 vbr_descr,
+                                                 dvbr_val,
+                                                 dvbr_val_ptr,
+                                                 nullptr,
+                                                 dvbr_col_ind,
+                                                 dvbr_row_ptn,
+                                                 dvbr_col_ptn),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr<T>(handle,
+                                                 rocsparse_direction_row,
+                                                 safe_size,
+                                                 safe_size,
+                                                 csr_descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 safe_size,
+                                                 vbr_descr,
+                                                 dvbr_val,
+                                                 dvbr_val_ptr,
+                                                 dvbr_row_ptr,
+                                                 nullptr,
+                                                 dvbr_row_ptn,
+                                                 dvbr_col_ptn),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr<T>(handle,
+                                                 rocsparse_direction_row,
+                                                 safe_size,
+                                                 safe_size,
+                                                 csr_descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 safe_size,
+                                                 vbr_descr,
+                                                 dvbr_val,
+                                                 dvbr_val_ptr,
+                                                 dvbr_row_ptr,
+                                                 dvbr_col_ind,
+                                                 nullptr,
+                                                 dvbr_col_ptn),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr<T>(handle,
+                                                 rocsparse_direction_row,
+                                                 safe_size,
+                                                 safe_size,
+                                                 csr_descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 safe_size,
+                                                 vbr_descr,
+                                                 dvbr_val,
+                                                 dvbr_val_ptr,
+                                                 dvbr_row_ptr,
+                                                 dvbr_col_ind,
+                                                 dvbr_row_ptn,
+                                                 nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr<T>(handle,
+                                                 rocsparse_direction_row,
+                                                 safe_size,
+                                                 safe_size,
+                                                 csr_descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 -1,
+                                                 safe_size,
+                                                 vbr_descr,
+                                                 dvbr_val,
+                                                 dvbr_val_ptr,
+                                                 dvbr_row_ptr,
+                                                 dvbr_col_ind,
+                                                 dvbr_row_ptn,
+                                                 dvbr_col_ptn),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr<T>(handle,
+                                                 (rocsparse_direction)2,
+                                                 safe_size,
+                                                 safe_size,
+                                                 csr_descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 safe_size,
+                                                 vbr_descr,
+                                                 dvbr_val,
+                                                 dvbr_val_ptr,
+                                                 dvbr_row_ptr,
+                                                 dvbr_col_ind,
+                                                 dvbr_row_ptn,
+                                                 dvbr_col_ptn),
+                            rocsparse_status_invalid_value);
+}
+
+template <typename T>
+void testing_csr2vbr(const Arguments& arg)
+{
+    rocsparse_int         M         = arg.M;
+    rocsparse_int         N         = arg.N;
+    rocsparse_int         K         = arg.K;
+    rocsparse_int         dim_x     = arg.dimx;
+    rocsparse_int         dim_y     = arg.dimy;
+    rocsparse_int         dim_z     = arg.dimz;
+    rocsparse_index_base  csr_base  = arg.baseA;
+    rocsparse_index_base  vbr_base  = arg.baseB;
+    rocsparse_matrix_init mat       = arg.matrix;
+    rocsparse_direction   dir       = arg.direction;
+    rocsparse_int         block_dim = arg.block_dim;
+    bool                  full_rank = false;
+    std::string           filename
+        = arg.timing ? arg.filename : rocsparse_exepath() + "../matrices/" + arg.filename + ".csr";
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    rocsparse_local_mat_descr csr_descr;
+    rocsparse_local_mat_descr vbr_descr;
+
+    rocsparse_set_mat_index_base(csr_descr, csr_base);
+    rocsparse_set_mat_index_base(vbr_descr, vbr_base);
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        static const size_t safe_size = 100;
+        rocsparse_int       hmb;
+        rocsparse_int       hnb;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<rocsparse_int> dvbr_row_ptn(safe_size);
+        device_vector<rocsparse_int> dvbr_col_ptn(safe_size);
+        device_vector<rocsparse_int> dvbr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dvbr_col_ind(safe_size);
+        device_vector<rocsparse_int> dvbr_val_ptr(safe_size);
+        device_vector<T>             dvbr_val(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dvbr_row_ptn || !dvbr_col_ptn
+           || !dvbr_row_ptr || !dvbr_col_ind || !dvbr_val_ptr || !dvbr_val)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr_partition(handle,
+                                                            M,
+                                                            N,
+                                                            csr_descr,
+                                                            dcsr_row_ptr,
+                                                            dcsr_col_ind,
+                                                            vbr_descr,
+                                                            &hmb,
+                                                            &hnb,
+                                                            dvbr_row_ptn,
+                                                            dvbr_col_ptn),
+                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csr2vbr<T>(handle,
+                                                     dir,
+                                                     M,
+                                                     N,
+                                                     csr_descr,
+                                                     dcsr_val,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     0,
+                                                     0,
+                                                     vbr_descr,
+                                                     dvbr_val,
+                                                     dvbr_val_ptr,
+                                                     dvbr_row_ptr,
+                                                     dvbr_col_ind,
+                                                     dvbr_row_ptn,
+                                                     dvbr_col_ptn),
+                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for CSR matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    rocsparse_seedrand();
+
+    // Generate (or load from file) CSR matrix
+    rocsparse_int nnz;
+    rocsparse_init_csr_matrix(hcsr_row_ptr,
+                              hcsr_col_ind,
+                              hcsr_val,
+                              M,
+                              N,
+                              K,
+                              dim_x,
+                              dim_y,
+                              dim_z,
+                              nnz,
+                              csr_base,
+                              mat,
+                              filename.c_str(),
+                              false,
+                              full_rank);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<rocsparse_int> dvbr_row_ptn(M + 1);
+    device_vector<rocsparse_int> dvbr_col_ptn(N + 1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dvbr_row_ptn || !dvbr_col_ptn)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Host VBR partitions
+    rocsparse_int              mb;
+    rocsparse_int              nb;
+    host_vector<rocsparse_int> hvbr_row_ptn_gold;
+    host_vector<rocsparse_int> hvbr_col_ptn_gold;
+
+    if(block_dim > 0)
+    {
+        // User supplied partitions, uniform blocks of dimension block_dim
+        mb = (M + block_dim - 1) / block_dim;
+        nb = (N + block_dim - 1) / block_dim;
+
+        hvbr_row_ptn_gold.resize(mb + 1);
+        hvbr_col_ptn_gold.resize(nb + 1);
+
+        for(rocsparse_int i = 0; i <= mb; ++i)
+        {
+            hvbr_row_ptn_gold[i] = std::min(i * block_dim, M) + vbr_base;
+        }
+
+        for(rocsparse_int j = 0; j <= nb; ++j)
+        {
+            hvbr_col_ptn_gold[j] = std::min(j * block_dim, N) + vbr_base;
+        }
+
+        CHECK_HIP_ERROR(hipMemcpy(dvbr_row_ptn,
+                                  hvbr_row_ptn_gold,
+                                  sizeof(rocsparse_int) * (mb + 1),
+                                  hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dvbr_col_ptn,
+                                  hvbr_col_ptn_gold,
+                                  sizeof(rocsparse_int) * (nb + 1),
+                                  hipMemcpyHostToDevice));
+    }
+    else
+    {
+        // Detected partitions
+        host_csr_to_vbr_partition(M,
+                                  N,
+                                  hcsr_row_ptr,
+                                  hcsr_col_ind,
+                                  mb,
+                                  nb,
+                                  hvbr_row_ptn_gold,
+                                  hvbr_col_ptn_gold,
+                                  csr_base,
+                                  vbr_base);
+
+        if(arg.unit_check)
+        {
+            // Obtain the partitions twice, using host and device pointers for mb and nb
+            rocsparse_int hmb;
+            rocsparse_int hnb;
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2vbr_partition(handle,
+                                                              M,
+                                                              N,
+                                                              csr_descr,
+                                                              dcsr_row_ptr,
+                                                              dcsr_col_ind,
+                                                              vbr_descr,
+                                                              &hmb,
+                                                              &hnb,
+                                                              dvbr_row_ptn,
+                                                              dvbr_col_ptn));
+
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+
+            device_vector<rocsparse_int> dmb(1);
+            device_vector<rocsparse_int> dnb(1);
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2vbr_partition(handle,
+                                                              M,
+                                                              N,
+                                                              csr_descr,
+                                                              dcsr_row_ptr,
+                                                              dcsr_col_ind,
+                                                              vbr_descr,
+                                                              dmb,
+                                                              dnb,
+                                                              dvbr_row_ptn,
+                                                              dvbr_col_ptn));
+
+            rocsparse_int hmb_copied_from_device;
+            rocsparse_int hnb_copied_from_device;
+
+            CHECK_HIP_ERROR(hipMemcpy(
+                &hmb_copied_from_device, dmb, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(
+                &hnb_copied_from_device, dnb, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+            host_vector<rocsparse_int> hvbr_row_ptn(mb + 1);
+            host_vector<rocsparse_int> hvbr_col_ptn(nb + 1);
+
+            CHECK_HIP_ERROR(hipMemcpy(hvbr_row_ptn,
+                                      dvbr_row_ptn,
+                                      sizeof(rocsparse_int) * (mb + 1),
+                                      hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hvbr_col_ptn,
+                                      dvbr_col_ptn,
+                                      sizeof(rocsparse_int) * (nb + 1),
+                                      hipMemcpyDeviceToHost));
+
+            unit_check_general<rocsparse_int>(1, 1, 1, &mb, &hmb);
+            unit_check_general<rocsparse_int>(1, 1, 1, &nb, &hnb);
+            unit_check_general<rocsparse_int>(1, 1, 1, &mb, &hmb_copied_from_device);
+            unit_check_general<rocsparse_int>(1, 1, 1, &nb, &hnb_copied_from_device);
+            unit_check_general<rocsparse_int>(1, mb + 1, 1, hvbr_row_ptn_gold, hvbr_row_ptn);
+            unit_check_general<rocsparse_int>(1, nb + 1, 1, hvbr_col_ptn_gold, hvbr_col_ptn);
+        }
+        else
+        {
+            CHECK_HIP_ERROR(hipMemcpy(dvbr_row_ptn,
+                                      hvbr_row_ptn_gold,
+                                      sizeof(rocsparse_int) * (mb + 1),
+                                      hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(dvbr_col_ptn,
+                                      hvbr_col_ptn_gold,
+                                      sizeof(rocsparse_int) * (nb + 1),
+                                      hipMemcpyHostToDevice));
+        }
+    }
+
+    // Host VBR matrix
+    host_vector<rocsparse_int> hvbr_row_ptr_gold;
+    host_vector<rocsparse_int> hvbr_col_ind_gold;
+    host_vector<rocsparse_int> hvbr_val_ptr_gold;
+    host_vector<T>             hvbr_val_gold;
+
+    host_csr_to_vbr(dir,
+                    M,
+                    N,
+                    hcsr_row_ptr,
+                    hcsr_col_ind,
+                    hcsr_val,
+                    mb,
+                    nb,
+                    hvbr_row_ptn_gold,
+                    hvbr_col_ptn_gold,
+                    hvbr_row_ptr_gold,
+                    hvbr_col_ind_gold,
+                    hvbr_val_ptr_gold,
+                    hvbr_val_gold,
+                    csr_base,
+                    vbr_base);
+
+    // Allocate device memory for VBR row pointer array
+    device_vector<rocsparse_int> dvbr_row_ptr(mb + 1);
+
+    if(!dvbr_row_ptr)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Obtain number of blocks and values
+    rocsparse_int nnzb;
+    rocsparse_int vbr_nnz;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csr2vbr_nnz(handle,
+                                                M,
+                                                N,
+                                                csr_descr,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                mb,
+                                                nb,
+                                                vbr_descr,
+                                                dvbr_row_ptr,
+                                                dvbr_row_ptn,
+                                                dvbr_col_ptn,
+                                                &nnzb,
+                                                &vbr_nnz));
+
+    device_vector<rocsparse_int> dvbr_col_ind(nnzb);
+    device_vector<rocsparse_int> dvbr_val_ptr(nnzb + 1);
+    device_vector<T>             dvbr_val(vbr_nnz);
+
+    if(!dvbr_col_ind || !dvbr_val_ptr || !dvbr_val)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    if(arg.unit_check)
+    {
+        // Obtain nnzb and vbr_nnz using device pointers
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+
+        device_vector<rocsparse_int> dnnzb(1);
+        device_vector<rocsparse_int> dvbr_nnz(1);
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2vbr_nnz(handle,
+                                                    M,
+                                                    N,
+                                                    csr_descr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    mb,
+                                                    nb,
+                                                    vbr_descr,
+                                                    dvbr_row_ptr,
+                                                    dvbr_row_ptn,
+                                                    dvbr_col_ptn,
+                                                    dnnzb,
+                                                    dvbr_nnz));
+
+        rocsparse_int hnnzb_copied_from_device;
+        rocsparse_int hvbr_nnz_copied_from_device;
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            &hnnzb_copied_from_device, dnnzb, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            &hvbr_nnz_copied_from_device, dvbr_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        rocsparse_int nnzb_gold    = hvbr_col_ind_gold.size();
+        rocsparse_int vbr_nnz_gold = hvbr_val_gold.size();
+
+        unit_check_general<rocsparse_int>(1, 1, 1, &nnzb_gold, &nnzb);
+        unit_check_general<rocsparse_int>(1, 1, 1, &vbr_nnz_gold, &vbr_nnz);
+        unit_check_general<rocsparse_int>(1, 1, 1, &nnzb_gold, &hnnzb_copied_from_device);
+        unit_check_general<rocsparse_int>(1, 1, 1, &vbr_nnz_gold, &hvbr_nnz_copied_from_device);
+
+        // Finish conversion
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2vbr<T>(handle,
+                                                   dir,
+                                                   M,
+                                                   N,
+                                                   csr_descr,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   mb,
+                                                   nb,
+                                                   vbr_descr,
+                                                   dvbr_val,
+                                                   dvbr_val_ptr,
+                                                   dvbr_row_ptr,
+                                                   dvbr_col_ind,
+                                                   dvbr_row_ptn,
+                                                   dvbr_col_ptn));
+
+        // Copy VBR matrix to host
+        host_vector<rocsparse_int> hvbr_row_ptr(mb + 1);
+        host_vector<rocsparse_int> hvbr_col_ind(nnzb);
+        host_vector<rocsparse_int> hvbr_val_ptr(nnzb + 1);
+        host_vector<T>             hvbr_val(vbr_nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            hvbr_row_ptr, dvbr_row_ptr, sizeof(rocsparse_int) * (mb + 1), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hvbr_col_ind, dvbr_col_ind, sizeof(rocsparse_int) * nnzb, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hvbr_val_ptr, dvbr_val_ptr, sizeof(rocsparse_int) * (nnzb + 1), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hvbr_val, dvbr_val, sizeof(T) * vbr_nnz, hipMemcpyDeviceToHost));
+
+        // Compare with host conversion
+        unit_check_general<rocsparse_int>(1, mb + 1, 1, hvbr_row_ptr_gold, hvbr_row_ptr);
+        unit_check_general<rocsparse_int>(1, nnzb, 1, hvbr_col_ind_gold, hvbr_col_ind);
+        unit_check_general<rocsparse_int>(1, nnzb + 1, 1, hvbr_val_ptr_gold, hvbr_val_ptr);
+        unit_check_general<T>(1, vbr_nnz, 1, hvbr_val_gold, hvbr_val);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2vbr<T>(handle,
+                                                       dir,
+                                                       M,
+                                                       N,
+                                                       csr_descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       mb,
+                                                       nb,
+                                                       vbr_descr,
+                                                       dvbr_val,
+                                                       dvbr_val_ptr,
+                                                       dvbr_row_ptr,
+                                                       dvbr_col_ind,
+                                                       dvbr_row_ptn,
+                                                       dvbr_col_ptn));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2vbr<T>(handle,
+                                                       dir,
+                                                       M,
+                                                       N,
+                                                       csr_descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       mb,
+                                                       nb,
+                                                       vbr_descr,
+                                                       dvbr_val,
+                                                       dvbr_val_ptr,
+                                                       dvbr_row_ptr,
+                                                       dvbr_col_ind,
+                                                       dvbr_row_ptn,
+                                                       dvbr_col_ptn));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gbyte
+            = csr2vbr_gbyte_count<T>(M, mb, nb, nnz, nnzb, vbr_nnz) / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "mb"
+                  << std::setw(12) << "nb" << std::setw(12) << "nnzb" << std::setw(12) << "fill"
+                  << std::setw(12) << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter"
+                  << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << mb
+                  << std::setw(12) << nb << std::setw(12) << nnzb << std::setw(12)
+                  << static_cast<double>(vbr_nnz) / nnz << std::setw(12) << gpu_gbyte
+                  << std::setw(12) << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls
+                  << std::setw(12) << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+}
+
+#endif // TESTING_CSR2VBR_HPP
@@ -2473,11 +2473,17 @@ void testing_csrgemm(const Arguments& arg)
     if(scenario == 2)
     {
         // alpha != nullptr && beta == nullptr
+        // A is stored as K x M and B as N x K matrix, if the operand is transposed
+        rocsparse_int& A_m = (transA == rocsparse_operation_none) ? M : K;
+        rocsparse_int& A_n = (transA == rocsparse_operation_none) ? K : M;
+        rocsparse_int& B_m = (transB == rocsparse_operation_none) ? K : N;
+        rocsparse_int& B_n = (transB == rocsparse_operation_none) ? N : K;
+
         rocsparse_init_csr_matrix(hcsr_row_ptr_A,
                                   hcsr_col_ind_A,
                                   hcsr_val_A,
-                                  M,
-                                  K,
+                                  A_m,
+                                  A_n,
                                   N,
                                   dim_x,
                                   dim_y,
@@ -2491,8 +2497,8 @@ void testing_csrgemm(const Arguments& arg)
         rocsparse_init_csr_matrix(hcsr_row_ptr_B,
                                   hcsr_col_ind_B,
                                   hcsr_val_B,
-                                  K,
-                                  N,
+                                  B_m,
+                                  B_n,
                                   M,
                                   dim_x,
                                   dim_y,
@@ -2524,11 +2530,15 @@ void testing_csrgemm(const Arguments& arg)
                                   full_rank);
     }
 
+    // Number of stored rows of A and B
+    rocsparse_int mA = (transA == rocsparse_operation_none) ? M : K;
+    rocsparse_int mB = (transB == rocsparse_operation_none) ? K : N;
+
     // Allocate device memory
-    device_vector<rocsparse_int> dcsr_row_ptr_A(M + 1);
+    device_vector<rocsparse_int> dcsr_row_ptr_A(mA + 1);
     device_vector<rocsparse_int> dcsr_col_ind_A(nnz_A);
     device_vector<T>             dcsr_val_A(nnz_A);
-    device_vector<rocsparse_int> dcsr_row_ptr_B(K + 1);
+    device_vector<rocsparse_int> dcsr_row_ptr_B(mB + 1);
     device_vector<rocsparse_int> dcsr_col_ind_B(nnz_B);
     device_vector<T>             dcsr_val_B(nnz_B);
     device_vector<rocsparse_int> dcsr_row_ptr_D(M + 1);
@@ -2552,7 +2562,7 @@ void testing_csrgemm(const Arguments& arg)
     {
         CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr_A,
                                   hcsr_row_ptr_A,
-                                  sizeof(rocsparse_int) * (M + 1),
+                                  sizeof(rocsparse_int) * (mA + 1),
                                   hipMemcpyHostToDevice));
         CHECK_HIP_ERROR(hipMemcpy(
             dcsr_col_ind_A, hcsr_col_ind_A, sizeof(rocsparse_int) * nnz_A, hipMemcpyHostToDevice));
@@ -2560,7 +2570,7 @@ void testing_csrgemm(const Arguments& arg)
             hipMemcpy(dcsr_val_A, hcsr_val_A, sizeof(T) * nnz_A, hipMemcpyHostToDevice));
         CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr_B,
                                   hcsr_row_ptr_B,
-                                  sizeof(rocsparse_int) * (K + 1),
+                                  sizeof(rocsparse_int) * (mB + 1),
                                   hipMemcpyHostToDevice));
         CHECK_HIP_ERROR(hipMemcpy(
             dcsr_col_ind_B, hcsr_col_ind_B, sizeof(rocsparse_int) * nnz_B, hipMemcpyHostToDevice));
@@ -2684,7 +2694,9 @@ void testing_csrgemm(const Arguments& arg)
 
         // CPU csrgemm_nnz
         host_vector<rocsparse_int> hcsr_row_ptr_C_gold(M + 1);
-        host_csrgemm_nnz<T>(M,
+        host_csrgemm_nnz<T>(transA,
+                            transB,
+                            M,
                             N,
                             K,
                             halpha_ptr,
@@ -2804,7 +2816,9 @@ void testing_csrgemm(const Arguments& arg)
         // CPU csrgemm
         host_vector<rocsparse_int> hcsr_col_ind_C_gold(hnnz_C_gold);
         host_vector<T>             hcsr_val_C_gold(hnnz_C_gold);
-        host_csrgemm<T>(M,
+        host_csrgemm<T>(transA,
+                        transB,
+                        M,
                         N,
                         K,
                         halpha_ptr,
@@ -2970,11 +2984,45 @@ void testing_csrgemm(const Arguments& arg)
 
         gpu_solve_time_used = (get_time_us() - gpu_solve_time_used) / number_hot_calls;
 
+        // Flops are counted on op(A) and op(B)
+        host_vector<rocsparse_int> hop_row_ptr_A;
+        host_vector<rocsparse_int> hop_col_ind_A;
+        host_vector<T>             hop_val_A;
+        host_vector<rocsparse_int> hop_row_ptr_B;
+        host_vector<rocsparse_int> hop_col_ind_B;
+        host_vector<T>             hop_val_B;
+
+        if(halpha_ptr != nullptr)
+        {
+            host_csr_op(transA,
+                        M,
+                        K,
+                        nnz_A,
+                        hcsr_row_ptr_A,
+                        hcsr_col_ind_A,
+                        hcsr_val_A,
+                        hop_row_ptr_A,
+                        hop_col_ind_A,
+                        hop_val_A,
+                        baseA);
+            host_csr_op(transB,
+                        K,
+                        N,
+                        nnz_B,
+                        hcsr_row_ptr_B,
+                        hcsr_col_ind_B,
+                        hcsr_val_B,
+                        hop_row_ptr_B,
+                        hop_col_ind_B,
+                        hop_val_B,
+                        baseB);
+        }
+
         double gpu_gflops = csrgemm_gflop_count<T>(M,
                                                    halpha_ptr,
-                                                   hcsr_row_ptr_A,
-                                                   hcsr_col_ind_A,
-                                                   hcsr_row_ptr_B,
+                                                   hop_row_ptr_A,
+                                                   hop_col_ind_A,
+                                                   hop_row_ptr_B,
                                                    hbeta_ptr,
                                                    hcsr_row_ptr_D,
                                                    baseA)
@@ -667,6 +667,11 @@ void testing_csrilu0(const Arguments& arg)
                   << gpu_analysis_time_used / 1e3 << std::setw(16) << gpu_solve_time_used / 1e3
                   << std::setw(12) << number_hot_calls << std::setw(12)
                   << (arg.unit_check ? "yes" : "no") << std::endl;
+
+        if(arg.memstat)
+        {
+            print_mat_info_size(info, sizeof(rocsparse_int) * (M + 1 + nnz) + sizeof(T) * nnz);
+        }
     }
 
     // Clear csrilu0 meta data
@@ -0,0 +1,706 @@
+/* ************************************************************************
+ * Copyright (c) 2019 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRILU0_MIXED_HPP
+#define TESTING_CSRILU0_MIXED_HPP
+
+#include <rocsparse.hpp>
+
+#include "flops.hpp"
+#include "gbyte.hpp"
+#include "rocsparse_check.hpp"
+#include "rocsparse_host.hpp"
+#include "rocsparse_init.hpp"
+#include "rocsparse_math.hpp"
+#include "rocsparse_random.hpp"
+#include "rocsparse_test.hpp"
+#include "rocsparse_vector.hpp"
+#include "utility.hpp"
+
+// Preconditioned Richardson iteration x_{k+1} = x_k + M^{-1} (b - A x_k), starting from
+// x_0 = 0. Returns the number of iterations that are required to reduce the residual
+// by tol, or max_iter if the iteration did not converge.
+template <typename T, typename PRECOND>
+rocsparse_int testing_csrilu0_mixed_richardson(rocsparse_int                     M,
+                                               rocsparse_int                     nnz,
+                                               const host_vector<rocsparse_int>& csr_row_ptr,
+                                               const host_vector<rocsparse_int>& csr_col_ind,
+                                               const host_vector<T>&             csr_val,
+                                               const host_vector<T>&             b,
+                                               rocsparse_index_base              base,
+                                               PRECOND                           precond)
+{
+    static const rocsparse_int max_iter = 1000;
+    static const double        tol      = 1e-10;
+
+    host_vector<T> x(M, static_cast<T>(0));
+    host_vector<T> r(M);
+    host_vector<T> z(M);
+
+    double nrm_b = 0.0;
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        nrm_b = std::max(nrm_b, static_cast<double>(std::abs(b[i])));
+    }
+
+    for(rocsparse_int iter = 0; iter < max_iter; ++iter)
+    {
+        // r = b - A * x
+        r = b;
+        host_csrmv(M,
+                   nnz,
+                   static_cast<T>(-1),
+                   csr_row_ptr.data(),
+                   csr_col_ind.data(),
+                   csr_val.data(),
+                   x.data(),
+                   static_cast<T>(1),
+                   r.data(),
+                   base,
+                   1);
+
+        double nrm_r = 0.0;
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            nrm_r = std::max(nrm_r, static_cast<double>(std::abs(r[i])));
+        }
+
+        if(nrm_r <= tol * nrm_b)
+        {
+            return iter;
+        }
+
+        // x = x + M^{-1} * r
+        precond(r, z);
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            x[i] = x[i] + z[i];
+        }
+    }
+
+    return max_iter;
+}
+
+template <typename T, typename U>
+void testing_csrilu0_mixed_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<T>             dcsr_val(safe_size);
+    device_vector<U>             dilu_val(safe_size);
+    device_vector<T>             dbuffer(safe_size);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dilu_val || !dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_csrilu0_mixed()
+    EXPECT_ROCSPARSE_STATUS((rocsparse_csrilu0_mixed<T, U>(nullptr,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dcsr_val,
+                                                           dilu_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           info,
+                                                           rocsparse_solve_policy_auto,
+                                                           dbuffer)),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS((rocsparse_csrilu0_mixed<T, U>(handle,
+                                                           safe_size,
+                                                           safe_size,
+                                                           nullptr,
+                                                           dcsr_val,
+                                                           dilu_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           info,
+                                                           rocsparse_solve_policy_auto,
+                                                           dbuffer)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS((rocsparse_csrilu0_mixed<T, U>(handle,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           nullptr,
+                                                           dilu_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           info,
+                                                           rocsparse_solve_policy_auto,
+                                                           dbuffer)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS((rocsparse_csrilu0_mixed<T, U>(handle,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dcsr_val,
+                                                           nullptr,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           info,
+                                                           rocsparse_solve_policy_auto,
+                                                           dbuffer)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS((rocsparse_csrilu0_mixed<T, U>(handle,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dcsr_val,
+                                                           dilu_val,
+                                                           nullptr,
+                                                           dcsr_col_ind,
+                                                           info,
+                                                           rocsparse_solve_policy_auto,
+                                                           dbuffer)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS((rocsparse_csrilu0_mixed<T, U>(handle,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dcsr_val,
+                                                           dilu_val,
+                                                           dcsr_row_ptr,
+                                                           nullptr,
+                                                           info,
+                                                           rocsparse_solve_policy_auto,
+                                                           dbuffer)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS((rocsparse_csrilu0_mixed<T, U>(handle,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dcsr_val,
+                                                           dilu_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           nullptr,
+                                                           rocsparse_solve_policy_auto,
+                                                           dbuffer)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS((rocsparse_csrilu0_mixed<T, U>(handle,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dcsr_val,
+                                                           dilu_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           info,
+                                                           rocsparse_solve_policy_auto,
+                                                           nullptr)),
+                            rocsparse_status_invalid_pointer);
+
+    // Negative size
+    EXPECT_ROCSPARSE_STATUS((rocsparse_csrilu0_mixed<T, U>(handle,
+                                                           -1,
+                                                           safe_size,
+                                                           descr,
+                                                           dcsr_val,
+                                                           dilu_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           info,
+                                                           rocsparse_solve_policy_auto,
+                                                           dbuffer)),
+                            rocsparse_status_invalid_size);
+}
+
+template <typename T, typename U>
+void testing_csrilu0_mixed(const Arguments& arg)
+{
+    rocsparse_int             M         = arg.M;
+    rocsparse_int             N         = arg.N;
+    rocsparse_int             K         = arg.K;
+    rocsparse_int             dim_x     = arg.dimx;
+    rocsparse_int             dim_y     = arg.dimy;
+    rocsparse_int             dim_z     = arg.dimz;
+    rocsparse_analysis_policy apol      = arg.apol;
+    rocsparse_solve_policy    spol      = arg.spol;
+    rocsparse_index_base      base      = arg.baseA;
+    rocsparse_matrix_init     mat       = arg.matrix;
+    bool                      full_rank = true;
+    std::string               filename
+        = arg.timing ? arg.filename : rocsparse_exepath() + "../matrices/" + arg.filename + ".csr";
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr descr;
+    rocsparse_local_mat_descr descr_L;
+    rocsparse_local_mat_descr descr_U;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_L, base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_U, base));
+
+    // L has unit diagonal, U is upper triangular
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<U>             dilu_val(safe_size);
+        device_vector<T>             dbuffer(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dilu_val || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCSPARSE_STATUS((rocsparse_csrilu0_mixed<T, U>(handle,
+                                                               M,
+                                                               safe_size,
+                                                               descr,
+                                                               dcsr_val,
+                                                               dilu_val,
+                                                               dcsr_row_ptr,
+                                                               dcsr_col_ind,
+                                                               info,
+                                                               spol,
+                                                               dbuffer)),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    rocsparse_seedrand();
+
+    // Sample matrix
+    rocsparse_int nnz;
+    rocsparse_init_csr_matrix(hcsr_row_ptr,
+                              hcsr_col_ind,
+                              hcsr_val,
+                              M,
+                              N,
+                              K,
+                              dim_x,
+                              dim_y,
+                              dim_z,
+                              nnz,
+                              base,
+                              mat,
+                              filename.c_str(),
+                              arg.timing ? false : true,
+                              full_rank);
+
+    // Allocate host memory for factors
+    host_vector<U>             hilu_val_1(nnz);
+    host_vector<U>             hilu_val_2(nnz);
+    host_vector<U>             hilu_val_mixed_gold;
+    host_vector<rocsparse_int> h_analysis_pivot_1(1);
+    host_vector<rocsparse_int> h_analysis_pivot_gold(1);
+    host_vector<rocsparse_int> h_solve_pivot_1(1);
+    host_vector<rocsparse_int> h_solve_pivot_2(1);
+    host_vector<rocsparse_int> h_solve_pivot_gold(1);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<U>             dilu_val_1(nnz);
+    device_vector<U>             dilu_val_2(nnz);
+    device_vector<rocsparse_int> d_solve_pivot_2(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dilu_val_1 || !dilu_val_2
+       || !d_solve_pivot_2)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Buffer size and analysis only depend on the sparsity pattern and are
+    // obtained in the low precision. The buffer is shared with the triangular
+    // solves of the Richardson iteration.
+    size_t buffer_size_M;
+    size_t buffer_size_L;
+    size_t buffer_size_U;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_buffer_size<U>(
+        handle, M, nnz, descr, dilu_val_1, dcsr_row_ptr, dcsr_col_ind, info, &buffer_size_M));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size<U>(handle,
+                                                         rocsparse_operation_none,
+                                                         M,
+                                                         nnz,
+                                                         descr_L,
+                                                         dilu_val_1,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         info,
+                                                         &buffer_size_L));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size<U>(handle,
+                                                         rocsparse_operation_none,
+                                                         M,
+                                                         nnz,
+                                                         descr_U,
+                                                         dilu_val_1,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         info,
+                                                         &buffer_size_U));
+
+    size_t buffer_size = std::max(buffer_size_M, std::max(buffer_size_L, buffer_size_U));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis<U>(handle,
+                                                        M,
+                                                        nnz,
+                                                        descr,
+                                                        dilu_val_1,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        info,
+                                                        apol,
+                                                        spol,
+                                                        dbuffer));
+
+    if(arg.unit_check)
+    {
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrilu0_zero_pivot(handle, info, h_analysis_pivot_1),
+                                (h_analysis_pivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                              : rocsparse_status_success);
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR((rocsparse_csrilu0_mixed<T, U>(handle,
+                                                             M,
+                                                             nnz,
+                                                             descr,
+                                                             dcsr_val,
+                                                             dilu_val_1,
+                                                             dcsr_row_ptr,
+                                                             dcsr_col_ind,
+                                                             info,
+                                                             spol,
+                                                             dbuffer)));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrilu0_zero_pivot(handle, info, h_solve_pivot_1),
+                                (h_solve_pivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                           : rocsparse_status_success);
+
+        // Sync to force updated pivots
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR((rocsparse_csrilu0_mixed<T, U>(handle,
+                                                             M,
+                                                             nnz,
+                                                             descr,
+                                                             dcsr_val,
+                                                             dilu_val_2,
+                                                             dcsr_row_ptr,
+                                                             dcsr_col_ind,
+                                                             info,
+                                                             spol,
+                                                             dbuffer)));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrilu0_zero_pivot(handle, info, d_solve_pivot_2),
+                                (h_solve_pivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                           : rocsparse_status_success);
+
+        // Sync to force updated pivots
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        // Copy output to host
+        CHECK_HIP_ERROR(hipMemcpy(hilu_val_1, dilu_val_1, sizeof(U) * nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hilu_val_2, dilu_val_2, sizeof(U) * nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            h_solve_pivot_2, d_solve_pivot_2, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // CPU csrilu0, the matrix is rounded to the low precision first
+        host_csrilu0_mixed<T, U>(M,
+                                 hcsr_row_ptr,
+                                 hcsr_col_ind,
+                                 hcsr_val,
+                                 hilu_val_mixed_gold,
+                                 base,
+                                 h_analysis_pivot_gold,
+                                 h_solve_pivot_gold);
+
+        // Check pivots
+        unit_check_general<rocsparse_int>(1, 1, 1, h_analysis_pivot_gold, h_analysis_pivot_1);
+        unit_check_general<rocsparse_int>(1, 1, 1, h_solve_pivot_gold, h_solve_pivot_1);
+        unit_check_general<rocsparse_int>(1, 1, 1, h_solve_pivot_gold, h_solve_pivot_2);
+
+        // Check factors and convergence if no pivot has been found
+        if(h_analysis_pivot_gold[0] == -1 && h_solve_pivot_gold[0] == -1)
+        {
+            near_check_general<U>(1, nnz, 1, hilu_val_mixed_gold, hilu_val_1);
+            near_check_general<U>(1, nnz, 1, hilu_val_mixed_gold, hilu_val_2);
+
+            // Convergence of ILU0 preconditioned Richardson iteration, where the factors
+            // are stored in low precision, compared to full precision factors. Residual
+            // and update are computed in high precision, such that the low precision
+            // factors only slow down convergence slightly, if at all.
+            T             one = static_cast<T>(1);
+            rocsparse_int struct_pivot;
+            rocsparse_int numeric_pivot;
+
+            host_vector<T> hb(M);
+            host_vector<T> hilu_val_gold = hcsr_val;
+
+            rocsparse_init<T>(hb, 1, M, 1);
+
+            host_csrilu0<T>(
+                M, hcsr_row_ptr, hcsr_col_ind, hilu_val_gold, base, &struct_pivot, &numeric_pivot);
+
+            device_vector<T> dr(M);
+            device_vector<T> dt(M);
+            device_vector<T> dz(M);
+
+            if(!dr || !dt || !dz)
+            {
+                CHECK_HIP_ERROR(hipErrorOutOfMemory);
+                return;
+            }
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<U>(handle,
+                                                              rocsparse_operation_none,
+                                                              M,
+                                                              nnz,
+                                                              descr_L,
+                                                              dilu_val_1,
+                                                              dcsr_row_ptr,
+                                                              dcsr_col_ind,
+                                                              info,
+                                                              apol,
+                                                              spol,
+                                                              dbuffer));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<U>(handle,
+                                                              rocsparse_operation_none,
+                                                              M,
+                                                              nnz,
+                                                              descr_U,
+                                                              dilu_val_1,
+                                                              dcsr_row_ptr,
+                                                              dcsr_col_ind,
+                                                              info,
+                                                              apol,
+                                                              spol,
+                                                              dbuffer));
+
+            // Full precision factors, applied on the host
+            auto precond_gold = [&](const host_vector<T>& r, host_vector<T>& z) {
+                host_vector<T> t(M);
+
+                host_csrsv<T>(rocsparse_operation_none,
+                              M,
+                              nnz,
+                              one,
+                              hcsr_row_ptr,
+                              hcsr_col_ind,
+                              hilu_val_gold,
+                              r,
+                              t,
+                              rocsparse_diag_type_unit,
+                              rocsparse_fill_mode_lower,
+                              base,
+                              &struct_pivot,
+                              &numeric_pivot);
+                host_csrsv<T>(rocsparse_operation_none,
+                              M,
+                              nnz,
+                              one,
+                              hcsr_row_ptr,
+                              hcsr_col_ind,
+                              hilu_val_gold,
+                              t,
+                              z,
+                              rocsparse_diag_type_non_unit,
+                              rocsparse_fill_mode_upper,
+                              base,
+                              &struct_pivot,
+                              &numeric_pivot);
+            };
+
+            // Low precision factors, applied by the mixed precision solves
+            auto precond_mixed = [&](const host_vector<T>& r, host_vector<T>& z) {
+                CHECK_HIP_ERROR(hipMemcpy(dr, r, sizeof(T) * M, hipMemcpyHostToDevice));
+                CHECK_ROCSPARSE_ERROR((rocsparse_csrsv_solve_mixed<T, U>(handle,
+                                                                         rocsparse_operation_none,
+                                                                         M,
+                                                                         nnz,
+                                                                         &one,
+                                                                         descr_L,
+                                                                         dilu_val_1,
+                                                                         dcsr_row_ptr,
+                                                                         dcsr_col_ind,
+                                                                         info,
+                                                                         dr,
+                                                                         dt,
+                                                                         spol,
+                                                                         dbuffer)));
+                CHECK_ROCSPARSE_ERROR((rocsparse_csrsv_solve_mixed<T, U>(handle,
+                                                                         rocsparse_operation_none,
+                                                                         M,
+                                                                         nnz,
+                                                                         &one,
+                                                                         descr_U,
+                                                                         dilu_val_1,
+                                                                         dcsr_row_ptr,
+                                                                         dcsr_col_ind,
+                                                                         info,
+                                                                         dt,
+                                                                         dz,
+                                                                         spol,
+                                                                         dbuffer)));
+                CHECK_HIP_ERROR(hipMemcpy(z, dz, sizeof(T) * M, hipMemcpyDeviceToHost));
+            };
+
+            rocsparse_int iter_gold = testing_csrilu0_mixed_richardson(
+                M, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, hb, base, precond_gold);
+            rocsparse_int iter_mixed = testing_csrilu0_mixed_richardson(
+                M, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, hb, base, precond_mixed);
+
+            // Low precision factors may cost a few additional iterations
+#ifdef GOOGLE_TEST
+            EXPECT_LT(iter_gold, 1000);
+            EXPECT_LE(iter_mixed, iter_gold + iter_gold / 10 + 2);
+#else
+            if(iter_gold >= 1000 || iter_mixed > iter_gold + iter_gold / 10 + 2)
+            {
+                std::cerr << "csrilu0_mixed preconditioner failed: " << iter_mixed
+                          << " iterations, expected at most " << iter_gold + iter_gold / 10 + 2
+                          << std::endl;
+                exit(EXIT_FAILURE);
+            }
+#endif
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr_L, info));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr_U, info));
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR((rocsparse_csrilu0_mixed<T, U>(handle,
+                                                                 M,
+                                                                 nnz,
+                                                                 descr,
+                                                                 dcsr_val,
+                                                                 dilu_val_1,
+                                                                 dcsr_row_ptr,
+                                                                 dcsr_col_ind,
+                                                                 info,
+                                                                 spol,
+                                                                 dbuffer)));
+        }
+
+        double gpu_solve_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR((rocsparse_csrilu0_mixed<T, U>(handle,
+                                                                 M,
+                                                                 nnz,
+                                                                 descr,
+                                                                 dcsr_val,
+                                                                 dilu_val_1,
+                                                                 dcsr_row_ptr,
+                                                                 dcsr_col_ind,
+                                                                 info,
+                                                                 spol,
+                                                                 dbuffer)));
+        }
+
+        gpu_solve_time_used = (get_time_us() - gpu_solve_time_used) / number_hot_calls;
+
+        double gpu_gbyte = csrilu0_mixed_gbyte_count<T, U>(M, nnz) / gpu_solve_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "nnz" << std::setw(16)
+                  << "solve policy" << std::setw(12) << "GB/s" << std::setw(16) << "solve msec"
+                  << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(16)
+                  << rocsparse_solve2string(spol) << std::setw(12) << gpu_gbyte << std::setw(16)
+                  << gpu_solve_time_used / 1e3 << std::setw(12) << number_hot_calls
+                  << std::setw(12) << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+
+    // Clear csrilu0 meta data
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_clear(handle, info));
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#endif // TESTING_CSRILU0_MIXED_HPP
@@ -52,6 +52,9 @@ void testing_csrmm_bad_arg(const Arguments& arg)
     // Create matrix descriptor
     rocsparse_local_mat_descr descr;
 
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
     // Allocate memory on device
     device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
     device_vector<rocsparse_int> dcsr_col_ind(safe_size);
@@ -228,6 +231,283 @@ void testing_csrmm_bad_arg(const Arguments& arg)
                                                nullptr,
                                                safe_size),
                             rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csrmm_ex_analysis()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm_ex_analysis<T>(nullptr,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           info),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm_ex_analysis<T>(handle,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           safe_size,
+                                                           nullptr,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm_ex_analysis<T>(handle,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           nullptr,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm_ex_analysis<T>(handle,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dcsr_val,
+                                                           nullptr,
+                                                           dcsr_col_ind,
+                                                           info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm_ex_analysis<T>(handle,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           nullptr,
+                                                           info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm_ex_analysis<T>(handle,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm_ex_analysis<T>(handle,
+                                                           rocsparse_operation_transpose,
+                                                           -1,
+                                                           safe_size,
+                                                           safe_size,
+                                                           descr,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           info),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm_ex_analysis<T>(handle,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           -1,
+                                                           safe_size,
+                                                           descr,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           info),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm_ex_analysis<T>(handle,
+                                                           rocsparse_operation_transpose,
+                                                           safe_size,
+                                                           safe_size,
+                                                           -1,
+                                                           descr,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           info),
+                            rocsparse_status_invalid_size);
+
+    // Test rocsparse_csrmm_ex()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm_ex<T>(nullptr,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_order_column,
+                                                  rocsparse_order_column,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  info,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  dC,
+                                                  safe_size),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm_ex<T>(handle,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_none,
+                                                  (rocsparse_order)2,
+                                                  rocsparse_order_column,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  info,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  dC,
+                                                  safe_size),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm_ex<T>(handle,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_order_column,
+                                                  (rocsparse_order)2,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  info,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  dC,
+                                                  safe_size),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm_ex<T>(handle,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_conjugate_transpose,
+                                                  rocsparse_order_column,
+                                                  rocsparse_order_column,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  info,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  dC,
+                                                  safe_size),
+                            rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm_ex<T>(handle,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_order_column,
+                                                  rocsparse_order_column,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  info,
+                                                  dB,
+                                                  safe_size - 1,
+                                                  &h_beta,
+                                                  dC,
+                                                  safe_size),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm_ex<T>(handle,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_order_column,
+                                                  rocsparse_order_column,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  info,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  dC,
+                                                  safe_size - 1),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm_ex<T>(handle,
+                                                  rocsparse_operation_transpose,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_order_column,
+                                                  rocsparse_order_column,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  nullptr,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  dC,
+                                                  safe_size),
+                            rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm_ex<T>(handle,
+                                                  rocsparse_operation_transpose,
+                                                  rocsparse_operation_none,
+                                                  rocsparse_order_column,
+                                                  rocsparse_order_column,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  info,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  dC,
+                                                  safe_size),
+                            rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csrmm_ex_clear()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm_ex_clear(nullptr, info),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm_ex_clear(handle, nullptr),
+                            rocsparse_status_invalid_pointer);
 }
 
 template <typename T>
@@ -241,6 +521,8 @@ void testing_csrmm(const Arguments& arg)
     rocsparse_int         dim_z     = arg.dimz;
     rocsparse_operation   transA    = arg.transA;
     rocsparse_operation   transB    = arg.transB;
+    rocsparse_order       orderB    = arg.orderB;
+    rocsparse_order       orderC    = arg.orderC;
     rocsparse_index_base  base      = arg.baseA;
     rocsparse_matrix_init mat       = arg.matrix;
     bool                  full_rank = false;
@@ -256,6 +538,9 @@ void testing_csrmm(const Arguments& arg)
     // Create matrix descriptor
     rocsparse_local_mat_descr descr;
 
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
     // Set matrix index base
     CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
 
@@ -278,23 +563,26 @@ void testing_csrmm(const Arguments& arg)
         }
 
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
-        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm<T>(handle,
-                                                   transA,
-                                                   transB,
-                                                   M,
-                                                   N,
-                                                   K,
-                                                   safe_size,
-                                                   &h_alpha,
-                                                   descr,
-                                                   dcsr_val,
-                                                   dcsr_row_ptr,
-                                                   dcsr_col_ind,
-                                                   dB,
-                                                   safe_size,
-                                                   &h_beta,
-                                                   dC,
-                                                   safe_size),
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm_ex<T>(handle,
+                                                      transA,
+                                                      transB,
+                                                      orderB,
+                                                      orderC,
+                                                      M,
+                                                      N,
+                                                      K,
+                                                      safe_size,
+                                                      &h_alpha,
+                                                      descr,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      info,
+                                                      dB,
+                                                      safe_size,
+                                                      &h_beta,
+                                                      dC,
+                                                      safe_size),
                                 (M < 0 || N < 0 || K < 0) ? rocsparse_status_invalid_size
                                                           : rocsparse_status_success);
 
@@ -327,13 +615,19 @@ void testing_csrmm(const Arguments& arg)
                               full_rank);
 
     // Some matrix properties
-    rocsparse_int ldb
-        = (transB == rocsparse_operation_none) ? (transA == rocsparse_operation_none ? K : M) : N;
-    rocsparse_int ldc = (transA == rocsparse_operation_none) ? M : K;
+    rocsparse_int nrow_B = (transA == rocsparse_operation_none) ? K : M;
+    rocsparse_int nrow_C = (transA == rocsparse_operation_none) ? M : K;
 
-    rocsparse_int ncol_B = (transB == rocsparse_operation_none ? N : K);
+    // Dimensions of B as it is stored
+    rocsparse_int m_B = (transB == rocsparse_operation_none) ? nrow_B : N;
+    rocsparse_int n_B = (transB == rocsparse_operation_none) ? N : nrow_B;
+
+    rocsparse_int ldb    = (orderB == rocsparse_order_column) ? m_B : n_B;
+    rocsparse_int ldc    = (orderC == rocsparse_order_column) ? nrow_C : N;
+    rocsparse_int ncol_B = (orderB == rocsparse_order_column) ? n_B : m_B;
+    rocsparse_int ncol_C = (orderC == rocsparse_order_column) ? N : nrow_C;
     rocsparse_int nnz_B  = ldb * ncol_B;
-    rocsparse_int nnz_C  = ldc * N;
+    rocsparse_int nnz_C  = ldc * ncol_C;
 
     // Allocate host memory for dense matrices
     host_vector<T> hB(nnz_B);
@@ -343,7 +637,7 @@ void testing_csrmm(const Arguments& arg)
 
     // Initialize data on CPU
     rocsparse_init<T>(hB, ldb, ncol_B, ldb);
-    rocsparse_init<T>(hC_1, ldc, N, ldc);
+    rocsparse_init<T>(hC_1, ldc, ncol_C, ldc);
     hC_2    = hC_1;
     hC_gold = hC_1;
 
@@ -372,6 +666,10 @@ void testing_csrmm(const Arguments& arg)
     CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * nnz_B, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dC_1, hC_1, sizeof(T) * nnz_C, hipMemcpyHostToDevice));
 
+    // Analysis, computes the transpose of A for transposed A
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmm_ex_analysis<T>(
+        handle, transA, M, K, nnz_A, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, info));
+
     if(arg.unit_check)
     {
         // Copy data from CPU to device
@@ -381,52 +679,62 @@ void testing_csrmm(const Arguments& arg)
 
         // Pointer mode host
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
-        CHECK_ROCSPARSE_ERROR(rocsparse_csrmm<T>(handle,
-                                                 transA,
-                                                 transB,
-                                                 M,
-                                                 N,
-                                                 K,
-                                                 nnz_A,
-                                                 &h_alpha,
-                                                 descr,
-                                                 dcsr_val,
-                                                 dcsr_row_ptr,
-                                                 dcsr_col_ind,
-                                                 dB,
-                                                 ldb,
-                                                 &h_beta,
-                                                 dC_1,
-                                                 ldc));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmm_ex<T>(handle,
+                                                    transA,
+                                                    transB,
+                                                    orderB,
+                                                    orderC,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    nnz_A,
+                                                    &h_alpha,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    info,
+                                                    dB,
+                                                    ldb,
+                                                    &h_beta,
+                                                    dC_1,
+                                                    ldc));
 
         // Pointer mode device
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
-        CHECK_ROCSPARSE_ERROR(rocsparse_csrmm<T>(handle,
-                                                 transA,
-                                                 transB,
-                                                 M,
-                                                 N,
-                                                 K,
-                                                 nnz_A,
-                                                 d_alpha,
-                                                 descr,
-                                                 dcsr_val,
-                                                 dcsr_row_ptr,
-                                                 dcsr_col_ind,
-                                                 dB,
-                                                 ldb,
-                                                 d_beta,
-                                                 dC_2,
-                                                 ldc));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmm_ex<T>(handle,
+                                                    transA,
+                                                    transB,
+                                                    orderB,
+                                                    orderC,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    nnz_A,
+                                                    d_alpha,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    info,
+                                                    dB,
+                                                    ldb,
+                                                    d_beta,
+                                                    dC_2,
+                                                    ldc));
 
         // Copy output to host
         CHECK_HIP_ERROR(hipMemcpy(hC_1, dC_1, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(hC_2, dC_2, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
 
         // CPU csrmm
-        host_csrmm<T>(ldc,
+        host_csrmm<T>(M,
                       N,
+                      K,
+                      transA,
                       transB,
+                      orderB,
+                      orderC,
                       h_alpha,
                       hcsr_row_ptr,
                       hcsr_col_ind,
@@ -438,8 +746,8 @@ void testing_csrmm(const Arguments& arg)
                       ldc,
                       base);
 
-        near_check_general<T>(ldc, N, ldc, hC_gold, hC_1);
-        near_check_general<T>(ldc, N, ldc, hC_gold, hC_2);
+        near_check_general<T>(ldc, ncol_C, ldc, hC_gold, hC_1);
+        near_check_general<T>(ldc, ncol_C, ldc, hC_gold, hC_2);
     }
 
     if(arg.timing)
@@ -452,23 +760,26 @@ void testing_csrmm(const Arguments& arg)
         // Warm up
         for(int iter = 0; iter < number_cold_calls; ++iter)
         {
-            CHECK_ROCSPARSE_ERROR(rocsparse_csrmm<T>(handle,
-                                                     transA,
-                                                     transB,
-                                                     M,
-                                                     N,
-                                                     K,
-                                                     nnz_A,
-                                                     &h_alpha,
-                                                     descr,
-                                                     dcsr_val,
-                                                     dcsr_row_ptr,
-                                                     dcsr_col_ind,
-                                                     dB,
-                                                     ldb,
-                                                     &h_beta,
-                                                     dC_1,
-                                                     ldc));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmm_ex<T>(handle,
+                                                        transA,
+                                                        transB,
+                                                        orderB,
+                                                        orderC,
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        nnz_A,
+                                                        &h_alpha,
+                                                        descr,
+                                                        dcsr_val,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        info,
+                                                        dB,
+                                                        ldb,
+                                                        &h_beta,
+                                                        dC_1,
+                                                        ldc));
         }
 
         double gpu_time_used = get_time_us();
@@ -476,23 +787,26 @@ void testing_csrmm(const Arguments& arg)
         // Performance run
         for(int iter = 0; iter < number_hot_calls; ++iter)
         {
-            CHECK_ROCSPARSE_ERROR(rocsparse_csrmm<T>(handle,
-                                                     transA,
-                                                     transB,
-                                                     M,
-                                                     N,
-                                                     K,
-                                                     nnz_A,
-                                                     &h_alpha,
-                                                     descr,
-                                                     dcsr_val,
-                                                     dcsr_row_ptr,
-                                                     dcsr_col_ind,
-                                                     dB,
-                                                     ldb,
-                                                     &h_beta,
-                                                     dC_1,
-                                                     ldc));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmm_ex<T>(handle,
+                                                        transA,
+                                                        transB,
+                                                        orderB,
+                                                        orderC,
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        nnz_A,
+                                                        &h_alpha,
+                                                        descr,
+                                                        dcsr_val,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        info,
+                                                        dB,
+                                                        ldb,
+                                                        &h_beta,
+                                                        dC_1,
+                                                        ldc));
         }
 
         gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
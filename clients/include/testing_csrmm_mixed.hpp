@@ -0,0 +1,548 @@
+/* ************************************************************************
+ * Copyright (c) 2019 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRMM_MIXED_HPP
+#define TESTING_CSRMM_MIXED_HPP
+
+#include <rocsparse.hpp>
+
+#include "flops.hpp"
+#include "gbyte.hpp"
+#include "rocsparse_check.hpp"
+#include "rocsparse_host.hpp"
+#include "rocsparse_init.hpp"
+#include "rocsparse_math.hpp"
+#include "rocsparse_random.hpp"
+#include "rocsparse_test.hpp"
+#include "rocsparse_vector.hpp"
+#include "utility.hpp"
+
+template <typename T, typename U>
+void testing_csrmm_mixed_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    T h_alpha = 0.6;
+    T h_beta  = 0.1;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<U>             dcsr_val(safe_size);
+    device_vector<T>             dB(safe_size);
+    device_vector<T>             dC(safe_size);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dB || !dC)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_csrmm_mixed()
+    EXPECT_ROCSPARSE_STATUS((rocsparse_csrmm_mixed<T, U>(nullptr,
+                                                         rocsparse_operation_none,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         &h_alpha,
+                                                         descr,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         dB,
+                                                         safe_size,
+                                                         &h_beta,
+                                                         dC,
+                                                         safe_size)),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS((rocsparse_csrmm_mixed<T, U>(handle,
+                                                         rocsparse_operation_none,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         nullptr,
+                                                         descr,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         dB,
+                                                         safe_size,
+                                                         &h_beta,
+                                                         dC,
+                                                         safe_size)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS((rocsparse_csrmm_mixed<T, U>(handle,
+                                                         rocsparse_operation_none,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         &h_alpha,
+                                                         nullptr,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         dB,
+                                                         safe_size,
+                                                         &h_beta,
+                                                         dC,
+                                                         safe_size)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS((rocsparse_csrmm_mixed<T, U>(handle,
+                                                         rocsparse_operation_none,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         &h_alpha,
+                                                         descr,
+                                                         nullptr,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         dB,
+                                                         safe_size,
+                                                         &h_beta,
+                                                         dC,
+                                                         safe_size)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS((rocsparse_csrmm_mixed<T, U>(handle,
+                                                         rocsparse_operation_none,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         &h_alpha,
+                                                         descr,
+                                                         dcsr_val,
+                                                         nullptr,
+                                                         dcsr_col_ind,
+                                                         dB,
+                                                         safe_size,
+                                                         &h_beta,
+                                                         dC,
+                                                         safe_size)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS((rocsparse_csrmm_mixed<T, U>(handle,
+                                                         rocsparse_operation_none,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         &h_alpha,
+                                                         descr,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         nullptr,
+                                                         dB,
+                                                         safe_size,
+                                                         &h_beta,
+                                                         dC,
+                                                         safe_size)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS((rocsparse_csrmm_mixed<T, U>(handle,
+                                                         rocsparse_operation_none,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         &h_alpha,
+                                                         descr,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         nullptr,
+                                                         safe_size,
+                                                         &h_beta,
+                                                         dC,
+                                                         safe_size)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS((rocsparse_csrmm_mixed<T, U>(handle,
+                                                         rocsparse_operation_none,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         &h_alpha,
+                                                         descr,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         dB,
+                                                         safe_size,
+                                                         nullptr,
+                                                         dC,
+                                                         safe_size)),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS((rocsparse_csrmm_mixed<T, U>(handle,
+                                                         rocsparse_operation_none,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         &h_alpha,
+                                                         descr,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         dB,
+                                                         safe_size,
+                                                         &h_beta,
+                                                         nullptr,
+                                                         safe_size)),
+                            rocsparse_status_invalid_pointer);
+}
+
+template <typename T, typename U>
+void testing_csrmm_mixed(const Arguments& arg)
+{
+    rocsparse_int         M         = arg.M;
+    rocsparse_int         N         = arg.N;
+    rocsparse_int         K         = arg.K;
+    rocsparse_int         dim_x     = arg.dimx;
+    rocsparse_int         dim_y     = arg.dimy;
+    rocsparse_int         dim_z     = arg.dimz;
+    rocsparse_operation   transA    = arg.transA;
+    rocsparse_operation   transB    = arg.transB;
+    rocsparse_order       orderB    = rocsparse_order_column;
+    rocsparse_order       orderC    = rocsparse_order_column;
+    rocsparse_index_base  base      = arg.baseA;
+    rocsparse_matrix_init mat       = arg.matrix;
+    bool                  full_rank = false;
+    std::string           filename
+        = arg.timing ? arg.filename : rocsparse_exepath() + "../matrices/" + arg.filename + ".csr";
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0 || K <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<U>             dcsr_val(safe_size);
+        device_vector<T>             dB(safe_size);
+        device_vector<T>             dC(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dB || !dC)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        EXPECT_ROCSPARSE_STATUS((rocsparse_csrmm_mixed<T, U>(handle,
+                                                             transA,
+                                                             transB,
+                                                             M,
+                                                             N,
+                                                             K,
+                                                             safe_size,
+                                                             &h_alpha,
+                                                             descr,
+                                                             dcsr_val,
+                                                             dcsr_row_ptr,
+                                                             dcsr_col_ind,
+                                                             dB,
+                                                             safe_size,
+                                                             &h_beta,
+                                                             dC,
+                                                             safe_size)),
+                                (M < 0 || N < 0 || K < 0) ? rocsparse_status_invalid_size
+                                                          : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    rocsparse_seedrand();
+
+    // Sample matrix
+    rocsparse_int nnz_A;
+    rocsparse_init_csr_matrix(hcsr_row_ptr,
+                              hcsr_col_ind,
+                              hcsr_val,
+                              M,
+                              K,
+                              N,
+                              dim_x,
+                              dim_y,
+                              dim_z,
+                              nnz_A,
+                              base,
+                              mat,
+                              filename.c_str(),
+                              false,
+                              full_rank);
+
+    // Round the matrix values to the storage precision, the reference is computed
+    // using the rounded values
+    host_vector<U> hcsr_val_U(nnz_A);
+    for(rocsparse_int i = 0; i < nnz_A; ++i)
+    {
+        hcsr_val_U[i] = rocsparse_convert<U>(hcsr_val[i]);
+        hcsr_val[i]   = rocsparse_convert<T>(hcsr_val_U[i]);
+    }
+
+    // Some matrix properties
+    rocsparse_int nrow_B = (transA == rocsparse_operation_none) ? K : M;
+    rocsparse_int nrow_C = (transA == rocsparse_operation_none) ? M : K;
+
+    // Dimensions of B as it is stored
+    rocsparse_int m_B = (transB == rocsparse_operation_none) ? nrow_B : N;
+    rocsparse_int n_B = (transB == rocsparse_operation_none) ? N : nrow_B;
+
+    rocsparse_int ldb    = (orderB == rocsparse_order_column) ? m_B : n_B;
+    rocsparse_int ldc    = (orderC == rocsparse_order_column) ? nrow_C : N;
+    rocsparse_int ncol_B = (orderB == rocsparse_order_column) ? n_B : m_B;
+    rocsparse_int ncol_C = (orderC == rocsparse_order_column) ? N : nrow_C;
+    rocsparse_int nnz_B  = ldb * ncol_B;
+    rocsparse_int nnz_C  = ldc * ncol_C;
+
+    // Allocate host memory for dense matrices
+    host_vector<T> hB(nnz_B);
+    host_vector<T> hC_1(nnz_C);
+    host_vector<T> hC_2(nnz_C);
+    host_vector<T> hC_gold(nnz_C);
+
+    // Initialize data on CPU
+    rocsparse_init<T>(hB, ldb, ncol_B, ldb);
+    rocsparse_init<T>(hC_1, ldc, ncol_C, ldc);
+    hC_2    = hC_1;
+    hC_gold = hC_1;
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz_A);
+    device_vector<U>             dcsr_val(nnz_A);
+    device_vector<T>             dB(nnz_B);
+    device_vector<T>             dC_1(nnz_C);
+    device_vector<T>             dC_2(nnz_C);
+    device_vector<T>             d_alpha(1);
+    device_vector<T>             d_beta(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dB || !dC_1 || !dC_2 || !d_alpha || !d_beta)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val_U, sizeof(U) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_1, hC_1, sizeof(T) * nnz_C, hipMemcpyHostToDevice));
+
+    if(arg.unit_check)
+    {
+        // Copy data from CPU to device
+        CHECK_HIP_ERROR(hipMemcpy(dC_2, hC_2, sizeof(T) * nnz_C, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR((rocsparse_csrmm_mixed<T, U>(handle,
+                                                           transA,
+                                                           transB,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           nnz_A,
+                                                           &h_alpha,
+                                                           descr,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           dB,
+                                                           ldb,
+                                                           &h_beta,
+                                                           dC_1,
+                                                           ldc)));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR((rocsparse_csrmm_mixed<T, U>(handle,
+                                                           transA,
+                                                           transB,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           nnz_A,
+                                                           d_alpha,
+                                                           descr,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           dB,
+                                                           ldb,
+                                                           d_beta,
+                                                           dC_2,
+                                                           ldc)));
+
+        // Copy output to host
+        CHECK_HIP_ERROR(hipMemcpy(hC_1, dC_1, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hC_2, dC_2, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+
+        // CPU csrmm
+        host_csrmm<T>(M,
+                      N,
+                      K,
+                      transA,
+                      transB,
+                      orderB,
+                      orderC,
+                      h_alpha,
+                      hcsr_row_ptr,
+                      hcsr_col_ind,
+                      hcsr_val,
+                      hB,
+                      ldb,
+                      h_beta,
+                      hC_gold,
+                      ldc,
+                      base);
+
+        near_check_general<T>(ldc, ncol_C, ldc, hC_gold, hC_1);
+        near_check_general<T>(ldc, ncol_C, ldc, hC_gold, hC_2);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR((rocsparse_csrmm_mixed<T, U>(handle,
+                                                               transA,
+                                                               transB,
+                                                               M,
+                                                               N,
+                                                               K,
+                                                               nnz_A,
+                                                               &h_alpha,
+                                                               descr,
+                                                               dcsr_val,
+                                                               dcsr_row_ptr,
+                                                               dcsr_col_ind,
+                                                               dB,
+                                                               ldb,
+                                                               &h_beta,
+                                                               dC_1,
+                                                               ldc)));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR((rocsparse_csrmm_mixed<T, U>(handle,
+                                                               transA,
+                                                               transB,
+                                                               M,
+                                                               N,
+                                                               K,
+                                                               nnz_A,
+                                                               &h_alpha,
+                                                               descr,
+                                                               dcsr_val,
+                                                               dcsr_row_ptr,
+                                                               dcsr_col_ind,
+                                                               dB,
+                                                               ldb,
+                                                               &h_beta,
+                                                               dC_1,
+                                                               ldc)));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gflops = csrmm_gflop_count<T>(N, nnz_A, nnz_C, h_beta != static_cast<T>(0))
+                            / gpu_time_used * 1e6;
+        double gpu_gbyte
+            = csrmm_mixed_gbyte_count<T, U>(M, nnz_A, nnz_B, nnz_C, h_beta != static_cast<T>(0))
+              / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "K"
+                  << std::setw(12) << "transA" << std::setw(12) << "transB" << std::setw(12)
+                  << "nnz_A" << std::setw(12) << "nnz_B" << std::setw(12) << "nnz_C"
+                  << std::setw(12) << "alpha" << std::setw(12) << "beta" << std::setw(12)
+                  << "GFlop/s" << std::setw(12) << "GB/s" << std::setw(12) << "msec"
+                  << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << K << std::setw(12)
+                  << rocsparse_operation2string(transA) << std::setw(12)
+                  << rocsparse_operation2string(transB) << std::setw(12) << nnz_A << std::setw(12)
+                  << nnz_B << std::setw(12) << nnz_C << std::setw(12) << h_alpha << std::setw(12)
+                  << h_beta << std::setw(12) << gpu_gflops << std::setw(12) << gpu_gbyte
+                  << std::setw(12) << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls
+                  << std::setw(12) << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+}
+
+#endif // TESTING_CSRMM_MIXED_HPP
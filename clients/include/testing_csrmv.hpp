@@ -496,8 +496,8 @@ void testing_csrmv(const Arguments& arg)
         host_csrmv<T>(M,
                       nnz,
                       h_alpha,
-                      hcsr_row_ptr,
-                      hcsr_col_ind,
+                      hcsr_row_ptr.data(),
+                      hcsr_col_ind.data(),
                       hcsr_val,
                       hx,
                       h_beta,
@@ -579,6 +579,11 @@ void testing_csrmv(const Arguments& arg)
                   << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
                   << std::setw(12) << number_hot_calls << std::setw(12)
                   << (arg.unit_check ? "yes" : "no") << std::endl;
+
+        if(arg.memstat && adaptive)
+        {
+            print_mat_info_size(info, sizeof(rocsparse_int) * (M + 1 + nnz) + sizeof(T) * nnz);
+        }
     }
 
     // If adaptive, clear analysis data
@@ -0,0 +1,720 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRMV_FORMAT_HPP
+#define TESTING_CSRMV_FORMAT_HPP
+
+#include <rocsparse.hpp>
+
+#include "flops.hpp"
+#include "gbyte.hpp"
+#include "rocsparse_check.hpp"
+#include "rocsparse_host.hpp"
+#include "rocsparse_init.hpp"
+#include "rocsparse_math.hpp"
+#include "rocsparse_random.hpp"
+#include "rocsparse_test.hpp"
+#include "rocsparse_vector.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_csrmv_format_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    T h_alpha = 0.6;
+    T h_beta  = 0.1;
+
+    rocsparse_spmv_format format;
+    rocsparse_int         bsr_dim;
+    float                 predicted_cost[rocsparse_spmv_format_bsr + 1];
+    float                 measured_cost[rocsparse_spmv_format_bsr + 1];
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<T>             dcsr_val(safe_size);
+    device_vector<T>             dx(safe_size);
+    device_vector<T>             dy(safe_size);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dx || !dy)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_csrmv_format_analysis()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format_analysis<T>(nullptr,
+                                                               rocsparse_operation_none,
+                                                               safe_size,
+                                                               safe_size,
+                                                               safe_size,
+                                                               descr,
+                                                               dcsr_val,
+                                                               dcsr_row_ptr,
+                                                               dcsr_col_ind,
+                                                               0,
+                                                               info),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format_analysis<T>(handle,
+                                                               rocsparse_operation_none,
+                                                               safe_size,
+                                                               safe_size,
+                                                               safe_size,
+                                                               nullptr,
+                                                               dcsr_val,
+                                                               dcsr_row_ptr,
+                                                               dcsr_col_ind,
+                                                               0,
+                                                               info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format_analysis<T>(handle,
+                                                               rocsparse_operation_none,
+                                                               safe_size,
+                                                               safe_size,
+                                                               safe_size,
+                                                               descr,
+                                                               nullptr,
+                                                               dcsr_row_ptr,
+                                                               dcsr_col_ind,
+                                                               0,
+                                                               info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format_analysis<T>(handle,
+                                                               rocsparse_operation_none,
+                                                               safe_size,
+                                                               safe_size,
+                                                               safe_size,
+                                                               descr,
+                                                               dcsr_val,
+                                                               nullptr,
+                                                               dcsr_col_ind,
+                                                               0,
+                                                               info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format_analysis<T>(handle,
+                                                               rocsparse_operation_none,
+                                                               safe_size,
+                                                               safe_size,
+                                                               safe_size,
+                                                               descr,
+                                                               dcsr_val,
+                                                               dcsr_row_ptr,
+                                                               nullptr,
+                                                               0,
+                                                               info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format_analysis<T>(handle,
+                                                               rocsparse_operation_none,
+                                                               safe_size,
+                                                               safe_size,
+                                                               safe_size,
+                                                               descr,
+                                                               dcsr_val,
+                                                               dcsr_row_ptr,
+                                                               dcsr_col_ind,
+                                                               0,
+                                                               nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format_analysis<T>(handle,
+                                                               rocsparse_operation_none,
+                                                               safe_size,
+                                                               safe_size,
+                                                               safe_size,
+                                                               descr,
+                                                               dcsr_val,
+                                                               dcsr_row_ptr,
+                                                               dcsr_col_ind,
+                                                               -1,
+                                                               info),
+                            rocsparse_status_invalid_size);
+
+    // Test rocsparse_csrmv_format_get_info()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format_get_info(nullptr,
+                                                            info,
+                                                            &format,
+                                                            &bsr_dim,
+                                                            predicted_cost,
+                                                            measured_cost),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format_get_info(handle,
+                                                            nullptr,
+                                                            &format,
+                                                            &bsr_dim,
+                                                            predicted_cost,
+                                                            measured_cost),
+                            rocsparse_status_invalid_pointer);
+
+    // Info without analysis data
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format_get_info(handle,
+                                                            info,
+                                                            &format,
+                                                            &bsr_dim,
+                                                            predicted_cost,
+                                                            measured_cost),
+                            rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csrmv_format()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format<T>(nullptr,
+                                                      rocsparse_operation_none,
+                                                      safe_size,
+                                                      safe_size,
+                                                      safe_size,
+                                                      &h_alpha,
+                                                      descr,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      info,
+                                                      dx,
+                                                      &h_beta,
+                                                      dy),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format<T>(handle,
+                                                      rocsparse_operation_none,
+                                                      safe_size,
+                                                      safe_size,
+                                                      safe_size,
+                                                      nullptr,
+                                                      descr,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      info,
+                                                      dx,
+                                                      &h_beta,
+                                                      dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format<T>(handle,
+                                                      rocsparse_operation_none,
+                                                      safe_size,
+                                                      safe_size,
+                                                      safe_size,
+                                                      &h_alpha,
+                                                      nullptr,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      info,
+                                                      dx,
+                                                      &h_beta,
+                                                      dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format<T>(handle,
+                                                      rocsparse_operation_none,
+                                                      safe_size,
+                                                      safe_size,
+                                                      safe_size,
+                                                      &h_alpha,
+                                                      descr,
+                                                      nullptr,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      info,
+                                                      dx,
+                                                      &h_beta,
+                                                      dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format<T>(handle,
+                                                      rocsparse_operation_none,
+                                                      safe_size,
+                                                      safe_size,
+                                                      safe_size,
+                                                      &h_alpha,
+                                                      descr,
+                                                      dcsr_val,
+                                                      nullptr,
+                                                      dcsr_col_ind,
+                                                      info,
+                                                      dx,
+                                                      &h_beta,
+                                                      dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format<T>(handle,
+                                                      rocsparse_operation_none,
+                                                      safe_size,
+                                                      safe_size,
+                                                      safe_size,
+                                                      &h_alpha,
+                                                      descr,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      nullptr,
+                                                      info,
+                                                      dx,
+                                                      &h_beta,
+                                                      dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format<T>(handle,
+                                                      rocsparse_operation_none,
+                                                      safe_size,
+                                                      safe_size,
+                                                      safe_size,
+                                                      &h_alpha,
+                                                      descr,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      info,
+                                                      nullptr,
+                                                      &h_beta,
+                                                      dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format<T>(handle,
+                                                      rocsparse_operation_none,
+                                                      safe_size,
+                                                      safe_size,
+                                                      safe_size,
+                                                      &h_alpha,
+                                                      descr,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      info,
+                                                      dx,
+                                                      nullptr,
+                                                      dy),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format<T>(handle,
+                                                      rocsparse_operation_none,
+                                                      safe_size,
+                                                      safe_size,
+                                                      safe_size,
+                                                      &h_alpha,
+                                                      descr,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      info,
+                                                      dx,
+                                                      &h_beta,
+                                                      nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csrmv_format_clear()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format_clear(nullptr, info),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format_clear(handle, nullptr),
+                            rocsparse_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_csrmv_format(const Arguments& arg)
+{
+    rocsparse_int         M              = arg.M;
+    rocsparse_int         N              = arg.N;
+    rocsparse_int         K              = arg.K;
+    rocsparse_int         dim_x          = arg.dimx;
+    rocsparse_int         dim_y          = arg.dimy;
+    rocsparse_int         dim_z          = arg.dimz;
+    rocsparse_operation   trans          = arg.transA;
+    rocsparse_index_base  base           = arg.baseA;
+    rocsparse_matrix_init mat            = arg.matrix;
+    rocsparse_int         benchmark_iter = arg.algo;
+    bool                  full_rank      = false;
+    std::string           filename
+        = arg.timing ? arg.filename : rocsparse_exepath() + "../matrices/" + arg.filename + ".csr";
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<T>             dx(safe_size);
+        device_vector<T>             dy(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dx || !dy)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format_analysis<T>(handle,
+                                                                   trans,
+                                                                   M,
+                                                                   N,
+                                                                   safe_size,
+                                                                   descr,
+                                                                   dcsr_val,
+                                                                   dcsr_row_ptr,
+                                                                   dcsr_col_ind,
+                                                                   benchmark_iter,
+                                                                   info),
+                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format<T>(handle,
+                                                          trans,
+                                                          M,
+                                                          N,
+                                                          safe_size,
+                                                          &h_alpha,
+                                                          descr,
+                                                          dcsr_val,
+                                                          dcsr_row_ptr,
+                                                          dcsr_col_ind,
+                                                          info,
+                                                          dx,
+                                                          &h_beta,
+                                                          dy),
+                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_format_clear(handle, info),
+                                rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    rocsparse_seedrand();
+
+    // Sample matrix
+    rocsparse_int nnz;
+    rocsparse_init_csr_matrix(hcsr_row_ptr,
+                              hcsr_col_ind,
+                              hcsr_val,
+                              M,
+                              N,
+                              K,
+                              dim_x,
+                              dim_y,
+                              dim_z,
+                              nnz,
+                              base,
+                              mat,
+                              filename.c_str(),
+                              false,
+                              full_rank);
+
+    // Allocate host memory for vectors
+    host_vector<T> hx(N);
+    host_vector<T> hy_1(M);
+    host_vector<T> hy_2(M);
+    host_vector<T> hy_gold(M);
+
+    // Initialize data on CPU
+    rocsparse_init<T>(hx, 1, N, 1);
+    rocsparse_init<T>(hy_1, 1, M, 1);
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<T>             dx(N);
+    device_vector<T>             dy_1(M);
+    device_vector<T>             dy_2(M);
+    device_vector<T>             d_alpha(1);
+    device_vector<T>             d_beta(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dx || !dy_1 || !dy_2 || !d_alpha || !d_beta)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * N, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1, sizeof(T) * M, hipMemcpyHostToDevice));
+
+    // Storage format selection
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_format_analysis<T>(handle,
+                                                             trans,
+                                                             M,
+                                                             N,
+                                                             nnz,
+                                                             descr,
+                                                             dcsr_val,
+                                                             dcsr_row_ptr,
+                                                             dcsr_col_ind,
+                                                             benchmark_iter,
+                                                             info));
+
+    rocsparse_spmv_format format;
+    rocsparse_int         bsr_dim;
+    host_vector<float>    hpredicted_cost(rocsparse_spmv_format_bsr + 1);
+    host_vector<float>    hmeasured_cost(rocsparse_spmv_format_bsr + 1);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_format_get_info(
+        handle, info, &format, &bsr_dim, hpredicted_cost, hmeasured_cost));
+
+    if(arg.unit_check)
+    {
+        // CPU cost model
+        rocsparse_spmv_format format_gold;
+        rocsparse_int         bsr_dim_gold;
+        host_vector<float>    hpredicted_cost_gold;
+
+        host_csrmv_format_analysis<T>(trans,
+                                      M,
+                                      N,
+                                      hcsr_row_ptr,
+                                      hcsr_col_ind,
+                                      hpredicted_cost_gold,
+                                      format_gold,
+                                      bsr_dim_gold,
+                                      base);
+
+        near_check_general<float>(
+            1, rocsparse_spmv_format_bsr + 1, 1, hpredicted_cost_gold, hpredicted_cost);
+        unit_check_general<rocsparse_int>(1, 1, 1, &bsr_dim_gold, &bsr_dim);
+
+        if(benchmark_iter == 0)
+        {
+            // Format with the lowest predicted cost
+            rocsparse_int hformat      = format;
+            rocsparse_int hformat_gold = format_gold;
+
+            unit_check_general<rocsparse_int>(1, 1, 1, &hformat_gold, &hformat);
+        }
+        else
+        {
+            // Format with the lowest measured cost, relative to csrmv
+            float hcsr_cost = 1.0f;
+            float hmin_cost = *std::min_element(hmeasured_cost.begin(), hmeasured_cost.end());
+
+            unit_check_general<float>(
+                1, 1, 1, &hcsr_cost, &hmeasured_cost[rocsparse_spmv_format_csr]);
+            unit_check_general<float>(1, 1, 1, &hmin_cost, &hmeasured_cost[format]);
+        }
+
+        // Copy data from CPU to device
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2, sizeof(T) * M, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_format<T>(handle,
+                                                        trans,
+                                                        M,
+                                                        N,
+                                                        nnz,
+                                                        &h_alpha,
+                                                        descr,
+                                                        dcsr_val,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        info,
+                                                        dx,
+                                                        &h_beta,
+                                                        dy_1));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_format<T>(handle,
+                                                        trans,
+                                                        M,
+                                                        N,
+                                                        nnz,
+                                                        d_alpha,
+                                                        descr,
+                                                        dcsr_val,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        info,
+                                                        dx,
+                                                        d_beta,
+                                                        dy_2));
+
+        // Copy output to host
+        CHECK_HIP_ERROR(hipMemcpy(hy_1, dy_1, sizeof(T) * M, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2, dy_2, sizeof(T) * M, hipMemcpyDeviceToHost));
+
+        // CPU csrmv
+        host_csrmv<T>(M,
+                      nnz,
+                      h_alpha,
+                      hcsr_row_ptr.data(),
+                      hcsr_col_ind.data(),
+                      hcsr_val,
+                      hx,
+                      h_beta,
+                      hy_gold,
+                      base,
+                      1);
+
+        near_check_general<T>(1, M, 1, hy_gold, hy_1);
+        near_check_general<T>(1, M, 1, hy_gold, hy_2);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        double gpu_analysis_time_used = get_time_us();
+
+        // Analysis run
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_format_analysis<T>(handle,
+                                                                 trans,
+                                                                 M,
+                                                                 N,
+                                                                 nnz,
+                                                                 descr,
+                                                                 dcsr_val,
+                                                                 dcsr_row_ptr,
+                                                                 dcsr_col_ind,
+                                                                 benchmark_iter,
+                                                                 info));
+
+        gpu_analysis_time_used = get_time_us() - gpu_analysis_time_used;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_format_get_info(
+            handle, info, &format, &bsr_dim, hpredicted_cost, hmeasured_cost));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_format<T>(handle,
+                                                            trans,
+                                                            M,
+                                                            N,
+                                                            nnz,
+                                                            &h_alpha,
+                                                            descr,
+                                                            dcsr_val,
+                                                            dcsr_row_ptr,
+                                                            dcsr_col_ind,
+                                                            info,
+                                                            dx,
+                                                            &h_beta,
+                                                            dy_1));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_format<T>(handle,
+                                                            trans,
+                                                            M,
+                                                            N,
+                                                            nnz,
+                                                            &h_alpha,
+                                                            descr,
+                                                            dcsr_val,
+                                                            dcsr_row_ptr,
+                                                            dcsr_col_ind,
+                                                            info,
+                                                            dx,
+                                                            &h_beta,
+                                                            dy_1));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gflops
+            = spmv_gflop_count<T>(M, nnz, h_beta != static_cast<T>(0)) / gpu_time_used * 1e6;
+        double gpu_gbyte
+            = csrmv_gbyte_count<T>(M, N, nnz, h_beta != static_cast<T>(0)) / gpu_time_used * 1e6;
+
+        static const char* format_name[] = {"csr", "ell", "hyb", "bsr"};
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
+                  << std::setw(12) << "alpha" << std::setw(12) << "beta" << std::setw(12)
+                  << "format" << std::setw(12) << "bsr_dim" << std::setw(12) << "GFlop/s"
+                  << std::setw(12) << "GB/s" << std::setw(12) << "msec" << std::setw(12)
+                  << "analysis" << std::setw(12) << "iter" << std::setw(12) << "verified"
+                  << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
+                  << std::setw(12) << h_alpha << std::setw(12) << h_beta << std::setw(12)
+                  << format_name[format] << std::setw(12) << bsr_dim << std::setw(12)
+                  << gpu_gflops << std::setw(12) << gpu_gbyte << std::setw(12)
+                  << gpu_time_used / 1e3 << std::setw(12) << gpu_analysis_time_used / 1e3
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+
+        // Predicted and measured cost of each storage format, relative to csrmv
+        std::cout << std::endl;
+        std::cout << std::setw(12) << "format" << std::setw(12) << "predicted" << std::setw(12)
+                  << "measured" << std::endl;
+
+        for(int f = 0; f <= rocsparse_spmv_format_bsr; ++f)
+        {
+            std::cout << std::setw(12) << format_name[f] << std::setw(12) << hpredicted_cost[f]
+                      << std::setw(12) << hmeasured_cost[f] << std::endl;
+        }
+
+        if(arg.memstat)
+        {
+            print_mat_info_size(info, sizeof(rocsparse_int) * (M + 1 + nnz) + sizeof(T) * nnz);
+        }
+    }
+
+    // Clear analysis data
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_format_clear(handle, info));
+}
+
+#endif // TESTING_CSRMV_FORMAT_HPP
@@ -0,0 +1,599 @@
+/* ************************************************************************
+ * Copyright (c) 2019 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRMV_STRIDED_BATCHED_HPP
+#define TESTING_CSRMV_STRIDED_BATCHED_HPP
+
+#include <rocsparse.hpp>
+
+#include "flops.hpp"
+#include "gbyte.hpp"
+#include "rocsparse_check.hpp"
+#include "rocsparse_host.hpp"
+#include "rocsparse_init.hpp"
+#include "rocsparse_math.hpp"
+#include "rocsparse_random.hpp"
+#include "rocsparse_test.hpp"
+#include "rocsparse_vector.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_csrmv_strided_batched_bad_arg(const Arguments& arg)
+{
+    static const size_t        safe_size  = 100;
+    static const rocsparse_int safe_batch = 2;
+
+    T h_alpha = 0.6;
+    T h_beta  = 0.1;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<T>             dcsr_val(safe_size * safe_batch);
+    device_vector<T>             dx(safe_size * safe_batch);
+    device_vector<T>             dy(safe_size * safe_batch);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dx || !dy)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_csrmv_strided_batched()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_strided_batched<T>(nullptr,
+                                                               rocsparse_operation_none,
+                                                               safe_size,
+                                                               safe_size,
+                                                               safe_size,
+                                                               &h_alpha,
+                                                               descr,
+                                                               dcsr_val,
+                                                               safe_size,
+                                                               dcsr_row_ptr,
+                                                               dcsr_col_ind,
+                                                               dx,
+                                                               safe_size,
+                                                               &h_beta,
+                                                               dy,
+                                                               safe_size,
+                                                               safe_batch),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_strided_batched<T>(handle,
+                                                               rocsparse_operation_none,
+                                                               safe_size,
+                                                               safe_size,
+                                                               safe_size,
+                                                               nullptr,
+                                                               descr,
+                                                               dcsr_val,
+                                                               safe_size,
+                                                               dcsr_row_ptr,
+                                                               dcsr_col_ind,
+                                                               dx,
+                                                               safe_size,
+                                                               &h_beta,
+                                                               dy,
+                                                               safe_size,
+                                                               safe_batch),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_strided_batched<T>(handle,
+                                                               rocsparse_operation_none,
+                                                               safe_size,
+                                                               safe_size,
+                                                               safe_size,
+                                                               &h_alpha,
+                                                               nullptr,
+                                                               dcsr_val,
+                                                               safe_size,
+                                                               dcsr_row_ptr,
+                                                               dcsr_col_ind,
+                                                               dx,
+                                                               safe_size,
+                                                               &h_beta,
+                                                               dy,
+                                                               safe_size,
+                                                               safe_batch),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_strided_batched<T>(handle,
+                                                               rocsparse_operation_none,
+                                                               safe_size,
+                                                               safe_size,
+                                                               safe_size,
+                                                               &h_alpha,
+                                                               descr,
+                                                               nullptr,
+                                                               safe_size,
+                                                               dcsr_row_ptr,
+                                                               dcsr_col_ind,
+                                                               dx,
+                                                               safe_size,
+                                                               &h_beta,
+                                                               dy,
+                                                               safe_size,
+                                                               safe_batch),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_strided_batched<T>(handle,
+                                                               rocsparse_operation_none,
+                                                               safe_size,
+                                                               safe_size,
+                                                               safe_size,
+                                                               &h_alpha,
+                                                               descr,
+                                                               dcsr_val,
+                                                               safe_size,
+                                                               nullptr,
+                                                               dcsr_col_ind,
+                                                               dx,
+                                                               safe_size,
+                                                               &h_beta,
+                                                               dy,
+                                                               safe_size,
+                                                               safe_batch),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_strided_batched<T>(handle,
+                                                               rocsparse_operation_none,
+                                                               safe_size,
+                                                               safe_size,
+                                                               safe_size,
+                                                               &h_alpha,
+                                                               descr,
+                                                               dcsr_val,
+                                                               safe_size,
+                                                               dcsr_row_ptr,
+                                                               nullptr,
+                                                               dx,
+                                                               safe_size,
+                                                               &h_beta,
+                                                               dy,
+                                                               safe_size,
+                                                               safe_batch),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_strided_batched<T>(handle,
+                                                               rocsparse_operation_none,
+                                                               safe_size,
+                                                               safe_size,
+                                                               safe_size,
+                                                               &h_alpha,
+                                                               descr,
+                                                               dcsr_val,
+                                                               safe_size,
+                                                               dcsr_row_ptr,
+                                                               dcsr_col_ind,
+                                                               nullptr,
+                                                               safe_size,
+                                                               &h_beta,
+                                                               dy,
+                                                               safe_size,
+                                                               safe_batch),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_strided_batched<T>(handle,
+                                                               rocsparse_operation_none,
+                                                               safe_size,
+                                                               safe_size,
+                                                               safe_size,
+                                                               &h_alpha,
+                                                               descr,
+                                                               dcsr_val,
+                                                               safe_size,
+                                                               dcsr_row_ptr,
+                                                               dcsr_col_ind,
+                                                               dx,
+                                                               safe_size,
+                                                               nullptr,
+                                                               dy,
+                                                               safe_size,
+                                                               safe_batch),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_strided_batched<T>(handle,
+                                                               rocsparse_operation_none,
+                                                               safe_size,
+                                                               safe_size,
+                                                               safe_size,
+                                                               &h_alpha,
+                                                               descr,
+                                                               dcsr_val,
+                                                               safe_size,
+                                                               dcsr_row_ptr,
+                                                               dcsr_col_ind,
+                                                               dx,
+                                                               safe_size,
+                                                               &h_beta,
+                                                               nullptr,
+                                                               safe_size,
+                                                               safe_batch),
+                            rocsparse_status_invalid_pointer);
+
+    // Negative batch count
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_strided_batched<T>(handle,
+                                                               rocsparse_operation_none,
+                                                               safe_size,
+                                                               safe_size,
+                                                               safe_size,
+                                                               &h_alpha,
+                                                               descr,
+                                                               dcsr_val,
+                                                               safe_size,
+                                                               dcsr_row_ptr,
+                                                               dcsr_col_ind,
+                                                               dx,
+                                                               safe_size,
+                                                               &h_beta,
+                                                               dy,
+                                                               safe_size,
+                                                               -1),
+                            rocsparse_status_invalid_size);
+
+    // Overlapping output vectors
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_strided_batched<T>(handle,
+                                                               rocsparse_operation_none,
+                                                               safe_size,
+                                                               safe_size,
+                                                               safe_size,
+                                                               &h_alpha,
+                                                               descr,
+                                                               dcsr_val,
+                                                               safe_size,
+                                                               dcsr_row_ptr,
+                                                               dcsr_col_ind,
+                                                               dx,
+                                                               safe_size,
+                                                               &h_beta,
+                                                               dy,
+                                                               safe_size - 1,
+                                                               safe_batch),
+                            rocsparse_status_invalid_size);
+}
+
+template <typename T>
+void testing_csrmv_strided_batched(const Arguments& arg)
+{
+    rocsparse_int         M           = arg.M;
+    rocsparse_int         N           = arg.N;
+    rocsparse_int         K           = arg.K;
+    rocsparse_int         dim_x       = arg.dimx;
+    rocsparse_int         dim_y       = arg.dimy;
+    rocsparse_int         dim_z       = arg.dimz;
+    rocsparse_int         batch_count = arg.batch_count;
+    rocsparse_operation   trans       = arg.transA;
+    rocsparse_index_base  base        = arg.baseA;
+    rocsparse_matrix_init mat         = arg.matrix;
+    bool                  full_rank   = false;
+    std::string           filename
+        = arg.timing ? arg.filename : rocsparse_exepath() + "../matrices/" + arg.filename + ".csr";
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0 || batch_count <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Empty matrices still scale y by beta
+        size_t ysize = static_cast<size_t>(std::max(M, 0)) * std::max(batch_count, 0);
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<T>             dx(safe_size);
+        device_vector<T>             dy(std::max(safe_size, ysize));
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dx || !dy)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_strided_batched<T>(handle,
+                                                                   trans,
+                                                                   M,
+                                                                   N,
+                                                                   0,
+                                                                   &h_alpha,
+                                                                   descr,
+                                                                   dcsr_val,
+                                                                   0,
+                                                                   dcsr_row_ptr,
+                                                                   dcsr_col_ind,
+                                                                   dx,
+                                                                   0,
+                                                                   &h_beta,
+                                                                   dy,
+                                                                   std::max(M, 0),
+                                                                   batch_count),
+                                (M < 0 || N < 0 || batch_count < 0)
+                                    ? rocsparse_status_invalid_size
+                                    : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    rocsparse_seedrand();
+
+    // Sample matrix
+    rocsparse_int nnz;
+    rocsparse_init_csr_matrix(hcsr_row_ptr,
+                              hcsr_col_ind,
+                              hcsr_val,
+                              M,
+                              N,
+                              K,
+                              dim_x,
+                              dim_y,
+                              dim_z,
+                              nnz,
+                              base,
+                              mat,
+                              filename.c_str(),
+                              false,
+                              full_rank);
+
+    // All matrices of the batch share the sparsity pattern, the values of the first
+    // matrix are the sampled ones
+    host_vector<T> hcsr_val_batch(static_cast<size_t>(nnz) * batch_count);
+
+    rocsparse_init<T>(hcsr_val_batch, 1, nnz, 1, nnz, batch_count);
+    std::copy(hcsr_val.begin(), hcsr_val.end(), hcsr_val_batch.begin());
+
+    // Allocate host memory for vectors
+    host_vector<T> hx(static_cast<size_t>(N) * batch_count);
+    host_vector<T> hy_1(static_cast<size_t>(M) * batch_count);
+    host_vector<T> hy_2(static_cast<size_t>(M) * batch_count);
+    host_vector<T> hy_gold(static_cast<size_t>(M) * batch_count);
+
+    // Initialize data on CPU
+    rocsparse_init<T>(hx, 1, N, 1, N, batch_count);
+    rocsparse_init<T>(hy_1, 1, M, 1, M, batch_count);
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(hcsr_val_batch.size());
+    device_vector<T>             dx(hx.size());
+    device_vector<T>             dy_1(hy_1.size());
+    device_vector<T>             dy_2(hy_2.size());
+    device_vector<T>             d_alpha(1);
+    device_vector<T>             d_beta(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dx || !dy_1 || !dy_2 || !d_alpha
+       || !d_beta)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_val, hcsr_val_batch, sizeof(T) * hcsr_val_batch.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * hx.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1, sizeof(T) * hy_1.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check)
+    {
+        // Copy data from CPU to device
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2, sizeof(T) * hy_2.size(), hipMemcpyHostToDevice));
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_strided_batched<T>(handle,
+                                                                 trans,
+                                                                 M,
+                                                                 N,
+                                                                 nnz,
+                                                                 &h_alpha,
+                                                                 descr,
+                                                                 dcsr_val,
+                                                                 nnz,
+                                                                 dcsr_row_ptr,
+                                                                 dcsr_col_ind,
+                                                                 dx,
+                                                                 N,
+                                                                 &h_beta,
+                                                                 dy_1,
+                                                                 M,
+                                                                 batch_count));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_strided_batched<T>(handle,
+                                                                 trans,
+                                                                 M,
+                                                                 N,
+                                                                 nnz,
+                                                                 d_alpha,
+                                                                 descr,
+                                                                 dcsr_val,
+                                                                 nnz,
+                                                                 dcsr_row_ptr,
+                                                                 dcsr_col_ind,
+                                                                 dx,
+                                                                 N,
+                                                                 d_beta,
+                                                                 dy_2,
+                                                                 M,
+                                                                 batch_count));
+
+        // Copy output to host
+        CHECK_HIP_ERROR(hipMemcpy(hy_1, dy_1, sizeof(T) * hy_1.size(), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2, dy_2, sizeof(T) * hy_2.size(), hipMemcpyDeviceToHost));
+
+        // CPU batched csrmv
+        host_csrmv_strided_batched<T>(M,
+                                      nnz,
+                                      h_alpha,
+                                      hcsr_row_ptr,
+                                      hcsr_col_ind,
+                                      hcsr_val_batch,
+                                      nnz,
+                                      hx,
+                                      N,
+                                      h_beta,
+                                      hy_gold,
+                                      M,
+                                      batch_count,
+                                      base);
+
+        near_check_general<T>(M, batch_count, M, hy_gold, hy_1);
+        near_check_general<T>(M, batch_count, M, hy_gold, hy_2);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_strided_batched<T>(handle,
+                                                                     trans,
+                                                                     M,
+                                                                     N,
+                                                                     nnz,
+                                                                     d_alpha,
+                                                                     descr,
+                                                                     dcsr_val,
+                                                                     nnz,
+                                                                     dcsr_row_ptr,
+                                                                     dcsr_col_ind,
+                                                                     dx,
+                                                                     N,
+                                                                     d_beta,
+                                                                     dy_1,
+                                                                     M,
+                                                                     batch_count));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_strided_batched<T>(handle,
+                                                                     trans,
+                                                                     M,
+                                                                     N,
+                                                                     nnz,
+                                                                     d_alpha,
+                                                                     descr,
+                                                                     dcsr_val,
+                                                                     nnz,
+                                                                     dcsr_row_ptr,
+                                                                     dcsr_col_ind,
+                                                                     dx,
+                                                                     N,
+                                                                     d_beta,
+                                                                     dy_1,
+                                                                     M,
+                                                                     batch_count));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        // One csrmv call per matrix of the batch, as reference for the batched routine
+        double loop_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            for(rocsparse_int b = 0; b < batch_count; ++b)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(handle,
+                                                         trans,
+                                                         M,
+                                                         N,
+                                                         nnz,
+                                                         d_alpha,
+                                                         descr,
+                                                         dcsr_val + nnz * b,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         nullptr,
+                                                         dx + N * b,
+                                                         d_beta,
+                                                         dy_1 + M * b));
+            }
+        }
+
+        loop_time_used = (get_time_us() - loop_time_used) / number_hot_calls;
+
+        double gflop_count
+            = batch_count * spmv_gflop_count<T>(M, nnz, h_beta != static_cast<T>(0));
+        double gbyte_count = csrmv_strided_batched_gbyte_count<T>(
+            M, N, nnz, batch_count, h_beta != static_cast<T>(0));
+
+        double gpu_gflops = gflop_count / gpu_time_used * 1e6;
+        double gpu_gbyte  = gbyte_count / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
+                  << std::setw(12) << "batch" << std::setw(12) << "alpha" << std::setw(12)
+                  << "beta" << std::setw(12) << "GFlop/s" << std::setw(12) << "GB/s"
+                  << std::setw(12) << "msec" << std::setw(12) << "loop msec" << std::setw(12)
+                  << "iter" << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
+                  << std::setw(12) << batch_count << std::setw(12) << h_alpha << std::setw(12)
+                  << h_beta << std::setw(12) << gpu_gflops << std::setw(12) << gpu_gbyte
+                  << std::setw(12) << gpu_time_used / 1e3 << std::setw(12)
+                  << loop_time_used / 1e3 << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+}
+
+#endif // TESTING_CSRMV_STRIDED_BATCHED_HPP
@@ -0,0 +1,1905 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRRAP_HPP
+#define TESTING_CSRRAP_HPP
+
+#include <rocsparse.hpp>
+
+#include "flops.hpp"
+#include "gbyte.hpp"
+#include "rocsparse_check.hpp"
+#include "rocsparse_host.hpp"
+#include "rocsparse_init.hpp"
+#include "rocsparse_math.hpp"
+#include "rocsparse_random.hpp"
+#include "rocsparse_test.hpp"
+#include "rocsparse_vector.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_csrrap_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr descrR;
+    rocsparse_local_mat_descr descrA;
+    rocsparse_local_mat_descr descrP;
+    rocsparse_local_mat_descr descrC;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr_R(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind_R(safe_size);
+    device_vector<T>             dcsr_val_R(safe_size);
+    device_vector<rocsparse_int> dcsr_row_ptr_A(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind_A(safe_size);
+    device_vector<T>             dcsr_val_A(safe_size);
+    device_vector<rocsparse_int> dcsr_row_ptr_P(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind_P(safe_size);
+    device_vector<T>             dcsr_val_P(safe_size);
+    device_vector<rocsparse_int> dcsr_row_ptr_C(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind_C(safe_size);
+    device_vector<T>             dcsr_val_C(safe_size);
+    device_vector<T>             dbuffer(safe_size);
+
+    if(!dcsr_row_ptr_R || !dcsr_col_ind_R || !dcsr_val_R || !dcsr_row_ptr_A || !dcsr_col_ind_A
+       || !dcsr_val_A || !dcsr_row_ptr_P || !dcsr_col_ind_P || !dcsr_val_P || !dcsr_row_ptr_C
+       || !dcsr_col_ind_C || !dcsr_val_C || !dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    size_t        buffer_size;
+    rocsparse_int nnz_C;
+
+    // Test rocsparse_csrrap_buffer_size()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size(nullptr,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         descrR,
+                                                         safe_size,
+                                                         dcsr_row_ptr_R,
+                                                         dcsr_col_ind_R,
+                                                         descrA,
+                                                         safe_size,
+                                                         dcsr_row_ptr_A,
+                                                         dcsr_col_ind_A,
+                                                         descrP,
+                                                         safe_size,
+                                                         dcsr_row_ptr_P,
+                                                         dcsr_col_ind_P,
+                                                         info,
+                                                         &buffer_size),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size(handle,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         nullptr,
+                                                         safe_size,
+                                                         dcsr_row_ptr_R,
+                                                         dcsr_col_ind_R,
+                                                         descrA,
+                                                         safe_size,
+                                                         dcsr_row_ptr_A,
+                                                         dcsr_col_ind_A,
+                                                         descrP,
+                                                         safe_size,
+                                                         dcsr_row_ptr_P,
+                                                         dcsr_col_ind_P,
+                                                         info,
+                                                         &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size(handle,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         descrR,
+                                                         safe_size,
+                                                         nullptr,
+                                                         dcsr_col_ind_R,
+                                                         descrA,
+                                                         safe_size,
+                                                         dcsr_row_ptr_A,
+                                                         dcsr_col_ind_A,
+                                                         descrP,
+                                                         safe_size,
+                                                         dcsr_row_ptr_P,
+                                                         dcsr_col_ind_P,
+                                                         info,
+                                                         &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size(handle,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         descrR,
+                                                         safe_size,
+                                                         dcsr_row_ptr_R,
+                                                         nullptr,
+                                                         descrA,
+                                                         safe_size,
+                                                         dcsr_row_ptr_A,
+                                                         dcsr_col_ind_A,
+                                                         descrP,
+                                                         safe_size,
+                                                         dcsr_row_ptr_P,
+                                                         dcsr_col_ind_P,
+                                                         info,
+                                                         &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size(handle,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         descrR,
+                                                         safe_size,
+                                                         dcsr_row_ptr_R,
+                                                         dcsr_col_ind_R,
+                                                         nullptr,
+                                                         safe_size,
+                                                         dcsr_row_ptr_A,
+                                                         dcsr_col_ind_A,
+                                                         descrP,
+                                                         safe_size,
+                                                         dcsr_row_ptr_P,
+                                                         dcsr_col_ind_P,
+                                                         info,
+                                                         &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size(handle,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         descrR,
+                                                         safe_size,
+                                                         dcsr_row_ptr_R,
+                                                         dcsr_col_ind_R,
+                                                         descrA,
+                                                         safe_size,
+                                                         nullptr,
+                                                         dcsr_col_ind_A,
+                                                         descrP,
+                                                         safe_size,
+                                                         dcsr_row_ptr_P,
+                                                         dcsr_col_ind_P,
+                                                         info,
+                                                         &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size(handle,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         descrR,
+                                                         safe_size,
+                                                         dcsr_row_ptr_R,
+                                                         dcsr_col_ind_R,
+                                                         descrA,
+                                                         safe_size,
+                                                         dcsr_row_ptr_A,
+                                                         nullptr,
+                                                         descrP,
+                                                         safe_size,
+                                                         dcsr_row_ptr_P,
+                                                         dcsr_col_ind_P,
+                                                         info,
+                                                         &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size(handle,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         descrR,
+                                                         safe_size,
+                                                         dcsr_row_ptr_R,
+                                                         dcsr_col_ind_R,
+                                                         descrA,
+                                                         safe_size,
+                                                         dcsr_row_ptr_A,
+                                                         dcsr_col_ind_A,
+                                                         nullptr,
+                                                         safe_size,
+                                                         dcsr_row_ptr_P,
+                                                         dcsr_col_ind_P,
+                                                         info,
+                                                         &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size(handle,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         descrR,
+                                                         safe_size,
+                                                         dcsr_row_ptr_R,
+                                                         dcsr_col_ind_R,
+                                                         descrA,
+                                                         safe_size,
+                                                         dcsr_row_ptr_A,
+                                                         dcsr_col_ind_A,
+                                                         descrP,
+                                                         safe_size,
+                                                         nullptr,
+                                                         dcsr_col_ind_P,
+                                                         info,
+                                                         &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size(handle,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         descrR,
+                                                         safe_size,
+                                                         dcsr_row_ptr_R,
+                                                         dcsr_col_ind_R,
+                                                         descrA,
+                                                         safe_size,
+                                                         dcsr_row_ptr_A,
+                                                         dcsr_col_ind_A,
+                                                         descrP,
+                                                         safe_size,
+                                                         dcsr_row_ptr_P,
+                                                         nullptr,
+                                                         info,
+                                                         &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size(handle,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         descrR,
+                                                         safe_size,
+                                                         dcsr_row_ptr_R,
+                                                         dcsr_col_ind_R,
+                                                         descrA,
+                                                         safe_size,
+                                                         dcsr_row_ptr_A,
+                                                         dcsr_col_ind_A,
+                                                         descrP,
+                                                         safe_size,
+                                                         dcsr_row_ptr_P,
+                                                         dcsr_col_ind_P,
+                                                         nullptr,
+                                                         &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size(handle,
+                                                         rocsparse_operation_none,
+                                                         safe_size,
+                                                         safe_size,
+                                                         safe_size,
+                                                         descrR,
+                                                         safe_size,
+                                                         dcsr_row_ptr_R,
+                                                         dcsr_col_ind_R,
+                                                         descrA,
+                                                         safe_size,
+                                                         dcsr_row_ptr_A,
+                                                         dcsr_col_ind_A,
+                                                         descrP,
+                                                         safe_size,
+                                                         dcsr_row_ptr_P,
+                                                         dcsr_col_ind_P,
+                                                         info,
+                                                         nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csrrap_nnz()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(nullptr,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 nullptr,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 nullptr,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 nullptr,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 nullptr,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 nullptr,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 nullptr,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 nullptr,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 nullptr,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 nullptr,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 nullptr,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 nullptr,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 nullptr,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 nullptr,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 rocsparse_operation_none,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csrrap()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(nullptr,
+                                                rocsparse_operation_none,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                rocsparse_operation_none,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                nullptr,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                rocsparse_operation_none,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descrR,
+                                                safe_size,
+                                                nullptr,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                rocsparse_operation_none,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                nullptr,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                rocsparse_operation_none,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                nullptr,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                rocsparse_operation_none,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                nullptr,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                rocsparse_operation_none,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                nullptr,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                rocsparse_operation_none,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                nullptr,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                rocsparse_operation_none,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                nullptr,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                rocsparse_operation_none,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                nullptr,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                rocsparse_operation_none,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                nullptr,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                rocsparse_operation_none,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                nullptr,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                rocsparse_operation_none,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                nullptr,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                rocsparse_operation_none,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                nullptr,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                rocsparse_operation_none,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                nullptr,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                rocsparse_operation_none,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                nullptr,
+                                                dcsr_col_ind_C,
+                                                info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                rocsparse_operation_none,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                nullptr,
+                                                info),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                rocsparse_operation_none,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                nullptr),
+                            rocsparse_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_csrrap(const Arguments& arg)
+{
+    rocsparse_int         M       = arg.M;
+    rocsparse_int         dim_x   = arg.dimx;
+    rocsparse_int         dim_y   = arg.dimy;
+    rocsparse_int         dim_z   = arg.dimz;
+    rocsparse_operation   trans_R = arg.transA;
+    rocsparse_index_base  baseA   = arg.baseA;
+    rocsparse_index_base  baseP   = arg.baseB;
+    rocsparse_index_base  baseC   = arg.baseC;
+    rocsparse_matrix_init mat     = arg.matrix;
+    bool                  full_rank = false;
+    std::string           filename
+        = arg.timing ? arg.filename : rocsparse_exepath() + "../matrices/" + arg.filename + ".csr";
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr descrR;
+    rocsparse_local_mat_descr descrA;
+    rocsparse_local_mat_descr descrP;
+    rocsparse_local_mat_descr descrC;
+
+    // Create matrix info for C
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base, R and P share the same index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrR, baseP));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrA, baseA));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrP, baseP));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrC, baseC));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr_R(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind_R(safe_size);
+        device_vector<T>             dcsr_val_R(safe_size);
+        device_vector<rocsparse_int> dcsr_row_ptr_A(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind_A(safe_size);
+        device_vector<T>             dcsr_val_A(safe_size);
+        device_vector<rocsparse_int> dcsr_row_ptr_P(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind_P(safe_size);
+        device_vector<T>             dcsr_val_P(safe_size);
+        device_vector<rocsparse_int> dcsr_row_ptr_C(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind_C(safe_size);
+        device_vector<T>             dcsr_val_C(safe_size);
+        device_vector<T>             dbuffer(safe_size);
+
+        if(!dcsr_row_ptr_R || !dcsr_col_ind_R || !dcsr_val_R || !dcsr_row_ptr_A
+           || !dcsr_col_ind_A || !dcsr_val_A || !dcsr_row_ptr_P || !dcsr_col_ind_P
+           || !dcsr_val_P || !dcsr_row_ptr_C || !dcsr_col_ind_C || !dcsr_val_C || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        size_t        buffer_size;
+        rocsparse_int nnz_C;
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size(handle,
+                                                             trans_R,
+                                                             M,
+                                                             M,
+                                                             M,
+                                                             descrR,
+                                                             safe_size,
+                                                             dcsr_row_ptr_R,
+                                                             dcsr_col_ind_R,
+                                                             descrA,
+                                                             safe_size,
+                                                             dcsr_row_ptr_A,
+                                                             dcsr_col_ind_A,
+                                                             descrP,
+                                                             safe_size,
+                                                             dcsr_row_ptr_P,
+                                                             dcsr_col_ind_P,
+                                                             info,
+                                                             &buffer_size),
+                                (M < 0) ? rocsparse_status_invalid_size
+                                        : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                     trans_R,
+                                                     M,
+                                                     M,
+                                                     M,
+                                                     descrR,
+                                                     safe_size,
+                                                     dcsr_row_ptr_R,
+                                                     dcsr_col_ind_R,
+                                                     descrA,
+                                                     safe_size,
+                                                     dcsr_row_ptr_A,
+                                                     dcsr_col_ind_A,
+                                                     descrP,
+                                                     safe_size,
+                                                     dcsr_row_ptr_P,
+                                                     dcsr_col_ind_P,
+                                                     descrC,
+                                                     dcsr_row_ptr_C,
+                                                     &nnz_C,
+                                                     info,
+                                                     dbuffer),
+                                (M < 0) ? rocsparse_status_invalid_size
+                                        : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                    trans_R,
+                                                    M,
+                                                    M,
+                                                    M,
+                                                    descrR,
+                                                    safe_size,
+                                                    dcsr_val_R,
+                                                    dcsr_row_ptr_R,
+                                                    dcsr_col_ind_R,
+                                                    descrA,
+                                                    safe_size,
+                                                    dcsr_val_A,
+                                                    dcsr_row_ptr_A,
+                                                    dcsr_col_ind_A,
+                                                    descrP,
+                                                    safe_size,
+                                                    dcsr_val_P,
+                                                    dcsr_row_ptr_P,
+                                                    dcsr_col_ind_P,
+                                                    descrC,
+                                                    dcsr_val_C,
+                                                    dcsr_row_ptr_C,
+                                                    dcsr_col_ind_C,
+                                                    info),
+                                (M < 0) ? rocsparse_status_invalid_size
+                                        : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrices
+    host_vector<rocsparse_int> hcsr_row_ptr_A;
+    host_vector<rocsparse_int> hcsr_col_ind_A;
+    host_vector<T>             hcsr_val_A;
+    host_vector<rocsparse_int> hcsr_row_ptr_P;
+    host_vector<rocsparse_int> hcsr_col_ind_P;
+    host_vector<T>             hcsr_val_P;
+    host_vector<rocsparse_int> hcsr_row_ptr_R;
+    host_vector<rocsparse_int> hcsr_col_ind_R;
+    host_vector<T>             hcsr_val_R;
+
+    rocsparse_seedrand();
+
+    // Sample fine grid operator A
+    rocsparse_int N     = M;
+    rocsparse_int nnz_A = 4;
+
+    rocsparse_init_csr_matrix(hcsr_row_ptr_A,
+                              hcsr_col_ind_A,
+                              hcsr_val_A,
+                              M,
+                              N,
+                              N,
+                              dim_x,
+                              dim_y,
+                              dim_z,
+                              nnz_A,
+                              baseA,
+                              mat,
+                              filename.c_str(),
+                              arg.timing ? false : true,
+                              full_rank);
+
+    // Geometry of the fine grid, non Laplacian matrices are coarsened as 1D problem
+    rocsparse_int grid_x = M;
+    rocsparse_int grid_y = 1;
+    rocsparse_int grid_z = 1;
+
+    if(mat == rocsparse_matrix_laplace_2d)
+    {
+        grid_x = dim_x;
+        grid_y = dim_y;
+    }
+    else if(mat == rocsparse_matrix_laplace_3d)
+    {
+        grid_x = dim_x;
+        grid_y = dim_y;
+        grid_z = dim_z;
+    }
+
+    // Smoothed aggregation prolongation P
+    rocsparse_int K;
+    rocsparse_int nnz_P;
+
+    rocsparse_init_csr_prolongation(hcsr_row_ptr_A,
+                                    hcsr_col_ind_A,
+                                    hcsr_val_A,
+                                    M,
+                                    grid_x,
+                                    grid_y,
+                                    grid_z,
+                                    hcsr_row_ptr_P,
+                                    hcsr_col_ind_P,
+                                    hcsr_val_P,
+                                    K,
+                                    nnz_P,
+                                    baseA,
+                                    baseP);
+
+    // Restriction R, either stored explicitly as P^T or implicitly as op(P)
+    rocsparse_int nnz_R = nnz_P;
+    rocsparse_int M_R;
+
+    if(trans_R == rocsparse_operation_none)
+    {
+        M_R = K;
+
+        host_csr_to_csc(M,
+                        K,
+                        nnz_P,
+                        hcsr_row_ptr_P,
+                        hcsr_col_ind_P,
+                        hcsr_val_P,
+                        hcsr_col_ind_R,
+                        hcsr_row_ptr_R,
+                        hcsr_val_R,
+                        rocsparse_action_numeric,
+                        baseP);
+    }
+    else
+    {
+        M_R = M;
+
+        hcsr_row_ptr_R = hcsr_row_ptr_P;
+        hcsr_col_ind_R = hcsr_col_ind_P;
+        hcsr_val_R     = hcsr_val_P;
+    }
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr_R(M_R + 1);
+    device_vector<rocsparse_int> dcsr_col_ind_R(nnz_R);
+    device_vector<T>             dcsr_val_R(nnz_R);
+    device_vector<rocsparse_int> dcsr_row_ptr_A(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind_A(nnz_A);
+    device_vector<T>             dcsr_val_A(nnz_A);
+    device_vector<rocsparse_int> dcsr_row_ptr_P(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind_P(nnz_P);
+    device_vector<T>             dcsr_val_P(nnz_P);
+    device_vector<rocsparse_int> dcsr_row_ptr_C_1(K + 1);
+    device_vector<rocsparse_int> dcsr_row_ptr_C_2(K + 1);
+    device_vector<rocsparse_int> dnnz_C_2(1);
+
+    if(!dcsr_row_ptr_R || !dcsr_col_ind_R || !dcsr_val_R || !dcsr_row_ptr_A || !dcsr_col_ind_A
+       || !dcsr_val_A || !dcsr_row_ptr_P || !dcsr_col_ind_P || !dcsr_val_P || !dcsr_row_ptr_C_1
+       || !dcsr_row_ptr_C_2 || !dnnz_C_2)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr_R,
+                              hcsr_row_ptr_R,
+                              sizeof(rocsparse_int) * (M_R + 1),
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_R, hcsr_col_ind_R, sizeof(rocsparse_int) * nnz_R, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_R, hcsr_val_R, sizeof(T) * nnz_R, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_A, hcsr_row_ptr_A, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_A, hcsr_col_ind_A, sizeof(rocsparse_int) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_A, hcsr_val_A, sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_P, hcsr_row_ptr_P, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_P, hcsr_col_ind_P, sizeof(rocsparse_int) * nnz_P, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_P, hcsr_val_P, sizeof(T) * nnz_P, hipMemcpyHostToDevice));
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrrap_buffer_size(handle,
+                                                       trans_R,
+                                                       K,
+                                                       M,
+                                                       K,
+                                                       descrR,
+                                                       nnz_R,
+                                                       dcsr_row_ptr_R,
+                                                       dcsr_col_ind_R,
+                                                       descrA,
+                                                       nnz_A,
+                                                       dcsr_row_ptr_A,
+                                                       dcsr_col_ind_A,
+                                                       descrP,
+                                                       nnz_P,
+                                                       dcsr_row_ptr_P,
+                                                       dcsr_col_ind_P,
+                                                       info,
+                                                       &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    rocsparse_int hnnz_C_gold;
+    rocsparse_int hnnz_C_1;
+    rocsparse_int hnnz_C_2;
+
+    if(arg.unit_check)
+    {
+        // Obtain nnz of C
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrrap_nnz(handle,
+                                                   trans_R,
+                                                   K,
+                                                   M,
+                                                   K,
+                                                   descrR,
+                                                   nnz_R,
+                                                   dcsr_row_ptr_R,
+                                                   dcsr_col_ind_R,
+                                                   descrA,
+                                                   nnz_A,
+                                                   dcsr_row_ptr_A,
+                                                   dcsr_col_ind_A,
+                                                   descrP,
+                                                   nnz_P,
+                                                   dcsr_row_ptr_P,
+                                                   dcsr_col_ind_P,
+                                                   descrC,
+                                                   dcsr_row_ptr_C_1,
+                                                   &hnnz_C_1,
+                                                   info,
+                                                   dbuffer));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrrap_nnz(handle,
+                                                   trans_R,
+                                                   K,
+                                                   M,
+                                                   K,
+                                                   descrR,
+                                                   nnz_R,
+                                                   dcsr_row_ptr_R,
+                                                   dcsr_col_ind_R,
+                                                   descrA,
+                                                   nnz_A,
+                                                   dcsr_row_ptr_A,
+                                                   dcsr_col_ind_A,
+                                                   descrP,
+                                                   nnz_P,
+                                                   dcsr_row_ptr_P,
+                                                   dcsr_col_ind_P,
+                                                   descrC,
+                                                   dcsr_row_ptr_C_2,
+                                                   dnnz_C_2,
+                                                   info,
+                                                   dbuffer));
+
+        // Copy output to host
+        host_vector<rocsparse_int> hcsr_row_ptr_C_1(K + 1);
+        host_vector<rocsparse_int> hcsr_row_ptr_C_2(K + 1);
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hnnz_C_2, dnnz_C_2, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_C_1,
+                                  dcsr_row_ptr_C_1,
+                                  sizeof(rocsparse_int) * (K + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_C_2,
+                                  dcsr_row_ptr_C_2,
+                                  sizeof(rocsparse_int) * (K + 1),
+                                  hipMemcpyDeviceToHost));
+
+        // CPU csrrap_nnz
+        host_vector<rocsparse_int> hcsr_row_ptr_C_gold(K + 1);
+        host_csrrap_nnz<T>(trans_R,
+                           K,
+                           M,
+                           K,
+                           nnz_R,
+                           hcsr_row_ptr_R,
+                           hcsr_col_ind_R,
+                           hcsr_row_ptr_A,
+                           hcsr_col_ind_A,
+                           hcsr_row_ptr_P,
+                           hcsr_col_ind_P,
+                           hcsr_row_ptr_C_gold,
+                           &hnnz_C_gold,
+                           baseP,
+                           baseA,
+                           baseP,
+                           baseC);
+
+        // Check nnz of C
+        unit_check_general(1, 1, 1, &hnnz_C_gold, &hnnz_C_1);
+        unit_check_general(1, 1, 1, &hnnz_C_gold, &hnnz_C_2);
+
+        // Check row pointers of C
+        unit_check_general<rocsparse_int>(1, K + 1, 1, hcsr_row_ptr_C_gold, hcsr_row_ptr_C_1);
+        unit_check_general<rocsparse_int>(1, K + 1, 1, hcsr_row_ptr_C_gold, hcsr_row_ptr_C_2);
+
+        // Allocate device memory for C
+        device_vector<rocsparse_int> dcsr_col_ind_C(hnnz_C_1);
+        device_vector<T>             dcsr_val_C(hnnz_C_1);
+
+        // Compute the Galerkin product
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrrap<T>(handle,
+                                                  trans_R,
+                                                  K,
+                                                  M,
+                                                  K,
+                                                  descrR,
+                                                  nnz_R,
+                                                  dcsr_val_R,
+                                                  dcsr_row_ptr_R,
+                                                  dcsr_col_ind_R,
+                                                  descrA,
+                                                  nnz_A,
+                                                  dcsr_val_A,
+                                                  dcsr_row_ptr_A,
+                                                  dcsr_col_ind_A,
+                                                  descrP,
+                                                  nnz_P,
+                                                  dcsr_val_P,
+                                                  dcsr_row_ptr_P,
+                                                  dcsr_col_ind_P,
+                                                  descrC,
+                                                  dcsr_val_C,
+                                                  dcsr_row_ptr_C_1,
+                                                  dcsr_col_ind_C,
+                                                  info));
+
+        // Copy output to host
+        host_vector<rocsparse_int> hcsr_col_ind_C(hnnz_C_1);
+        host_vector<T>             hcsr_val_C(hnnz_C_1);
+
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_C,
+                                  dcsr_col_ind_C,
+                                  sizeof(rocsparse_int) * hnnz_C_1,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_C, dcsr_val_C, sizeof(T) * hnnz_C_1, hipMemcpyDeviceToHost));
+
+        // CPU csrrap
+        host_vector<rocsparse_int> hcsr_col_ind_C_gold(hnnz_C_gold);
+        host_vector<T>             hcsr_val_C_gold(hnnz_C_gold);
+        host_csrrap<T>(trans_R,
+                       K,
+                       M,
+                       K,
+                       nnz_R,
+                       hcsr_row_ptr_R,
+                       hcsr_col_ind_R,
+                       hcsr_val_R,
+                       hcsr_row_ptr_A,
+                       hcsr_col_ind_A,
+                       hcsr_val_A,
+                       hcsr_row_ptr_P,
+                       hcsr_col_ind_P,
+                       hcsr_val_P,
+                       hcsr_row_ptr_C_gold,
+                       hcsr_col_ind_C_gold,
+                       hcsr_val_C_gold,
+                       baseP,
+                       baseA,
+                       baseP,
+                       baseC);
+
+        // Check C
+        unit_check_general<rocsparse_int>(1, hnnz_C_gold, 1, hcsr_col_ind_C_gold, hcsr_col_ind_C);
+        near_check_general<T>(1, hnnz_C_gold, 1, hcsr_val_C_gold, hcsr_val_C);
+
+        // Update the values of A and P while keeping their sparsity patterns, the
+        // structure of C computed by rocsparse_csrrap_nnz() remains valid
+        for(rocsparse_int i = 0; i < nnz_A; ++i)
+        {
+            hcsr_val_A[i] = random_generator<T>();
+        }
+
+        for(rocsparse_int i = 0; i < nnz_P; ++i)
+        {
+            hcsr_val_P[i] = random_generator<T>();
+        }
+
+        if(trans_R == rocsparse_operation_none)
+        {
+            host_csr_to_csc(M,
+                            K,
+                            nnz_P,
+                            hcsr_row_ptr_P,
+                            hcsr_col_ind_P,
+                            hcsr_val_P,
+                            hcsr_col_ind_R,
+                            hcsr_row_ptr_R,
+                            hcsr_val_R,
+                            rocsparse_action_numeric,
+                            baseP);
+        }
+        else
+        {
+            hcsr_val_R = hcsr_val_P;
+        }
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(dcsr_val_R, hcsr_val_R, sizeof(T) * nnz_R, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dcsr_val_A, hcsr_val_A, sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dcsr_val_P, hcsr_val_P, sizeof(T) * nnz_P, hipMemcpyHostToDevice));
+
+        // Recompute the Galerkin product without symbolic phase
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrrap<T>(handle,
+                                                  trans_R,
+                                                  K,
+                                                  M,
+                                                  K,
+                                                  descrR,
+                                                  nnz_R,
+                                                  dcsr_val_R,
+                                                  dcsr_row_ptr_R,
+                                                  dcsr_col_ind_R,
+                                                  descrA,
+                                                  nnz_A,
+                                                  dcsr_val_A,
+                                                  dcsr_row_ptr_A,
+                                                  dcsr_col_ind_A,
+                                                  descrP,
+                                                  nnz_P,
+                                                  dcsr_val_P,
+                                                  dcsr_row_ptr_P,
+                                                  dcsr_col_ind_P,
+                                                  descrC,
+                                                  dcsr_val_C,
+                                                  dcsr_row_ptr_C_1,
+                                                  dcsr_col_ind_C,
+                                                  info));
+
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_C,
+                                  dcsr_col_ind_C,
+                                  sizeof(rocsparse_int) * hnnz_C_1,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_C, dcsr_val_C, sizeof(T) * hnnz_C_1, hipMemcpyDeviceToHost));
+
+        host_csrrap<T>(trans_R,
+                       K,
+                       M,
+                       K,
+                       nnz_R,
+                       hcsr_row_ptr_R,
+                       hcsr_col_ind_R,
+                       hcsr_val_R,
+                       hcsr_row_ptr_A,
+                       hcsr_col_ind_A,
+                       hcsr_val_A,
+                       hcsr_row_ptr_P,
+                       hcsr_col_ind_P,
+                       hcsr_val_P,
+                       hcsr_row_ptr_C_gold,
+                       hcsr_col_ind_C_gold,
+                       hcsr_val_C_gold,
+                       baseP,
+                       baseA,
+                       baseP,
+                       baseC);
+
+        unit_check_general<rocsparse_int>(1, hnnz_C_gold, 1, hcsr_col_ind_C_gold, hcsr_col_ind_C);
+        near_check_general<T>(1, hnnz_C_gold, 1, hcsr_val_C_gold, hcsr_val_C);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrrap_nnz(handle,
+                                                       trans_R,
+                                                       K,
+                                                       M,
+                                                       K,
+                                                       descrR,
+                                                       nnz_R,
+                                                       dcsr_row_ptr_R,
+                                                       dcsr_col_ind_R,
+                                                       descrA,
+                                                       nnz_A,
+                                                       dcsr_row_ptr_A,
+                                                       dcsr_col_ind_A,
+                                                       descrP,
+                                                       nnz_P,
+                                                       dcsr_row_ptr_P,
+                                                       dcsr_col_ind_P,
+                                                       descrC,
+                                                       dcsr_row_ptr_C_1,
+                                                       &hnnz_C_1,
+                                                       info,
+                                                       dbuffer));
+        }
+
+        // Performance run of the symbolic phase
+        double gpu_analysis_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrrap_nnz(handle,
+                                                       trans_R,
+                                                       K,
+                                                       M,
+                                                       K,
+                                                       descrR,
+                                                       nnz_R,
+                                                       dcsr_row_ptr_R,
+                                                       dcsr_col_ind_R,
+                                                       descrA,
+                                                       nnz_A,
+                                                       dcsr_row_ptr_A,
+                                                       dcsr_col_ind_A,
+                                                       descrP,
+                                                       nnz_P,
+                                                       dcsr_row_ptr_P,
+                                                       dcsr_col_ind_P,
+                                                       descrC,
+                                                       dcsr_row_ptr_C_1,
+                                                       &hnnz_C_1,
+                                                       info,
+                                                       dbuffer));
+        }
+
+        gpu_analysis_time_used = (get_time_us() - gpu_analysis_time_used) / number_hot_calls;
+
+        device_vector<rocsparse_int> dcsr_col_ind_C(hnnz_C_1);
+        device_vector<T>             dcsr_val_C(hnnz_C_1);
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrrap<T>(handle,
+                                                      trans_R,
+                                                      K,
+                                                      M,
+                                                      K,
+                                                      descrR,
+                                                      nnz_R,
+                                                      dcsr_val_R,
+                                                      dcsr_row_ptr_R,
+                                                      dcsr_col_ind_R,
+                                                      descrA,
+                                                      nnz_A,
+                                                      dcsr_val_A,
+                                                      dcsr_row_ptr_A,
+                                                      dcsr_col_ind_A,
+                                                      descrP,
+                                                      nnz_P,
+                                                      dcsr_val_P,
+                                                      dcsr_row_ptr_P,
+                                                      dcsr_col_ind_P,
+                                                      descrC,
+                                                      dcsr_val_C,
+                                                      dcsr_row_ptr_C_1,
+                                                      dcsr_col_ind_C,
+                                                      info));
+        }
+
+        // Performance run of the numeric phase, as it is done for value-only updates
+        double gpu_solve_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrrap<T>(handle,
+                                                      trans_R,
+                                                      K,
+                                                      M,
+                                                      K,
+                                                      descrR,
+                                                      nnz_R,
+                                                      dcsr_val_R,
+                                                      dcsr_row_ptr_R,
+                                                      dcsr_col_ind_R,
+                                                      descrA,
+                                                      nnz_A,
+                                                      dcsr_val_A,
+                                                      dcsr_row_ptr_A,
+                                                      dcsr_col_ind_A,
+                                                      descrP,
+                                                      nnz_P,
+                                                      dcsr_val_P,
+                                                      dcsr_row_ptr_P,
+                                                      dcsr_col_ind_P,
+                                                      descrC,
+                                                      dcsr_val_C,
+                                                      dcsr_row_ptr_C_1,
+                                                      dcsr_col_ind_C,
+                                                      info));
+        }
+
+        gpu_solve_time_used = (get_time_us() - gpu_solve_time_used) / number_hot_calls;
+
+        // Flops are counted on op(R)
+        host_vector<rocsparse_int> hop_row_ptr_R;
+        host_vector<rocsparse_int> hop_col_ind_R;
+        host_vector<T>             hop_val_R;
+
+        host_csr_op(trans_R,
+                    K,
+                    M,
+                    nnz_R,
+                    hcsr_row_ptr_R,
+                    hcsr_col_ind_R,
+                    hcsr_val_R,
+                    hop_row_ptr_R,
+                    hop_col_ind_R,
+                    hop_val_R,
+                    baseP);
+
+        double gpu_gflops = csrrap_gflop_count<T>(K,
+                                                  hop_row_ptr_R,
+                                                  hop_col_ind_R,
+                                                  hcsr_row_ptr_A,
+                                                  hcsr_col_ind_A,
+                                                  hcsr_row_ptr_P,
+                                                  baseP,
+                                                  baseA)
+                            / gpu_solve_time_used * 1e6;
+        double gpu_gbyte = csrrap_gbyte_count<T>(K, M, K, nnz_R, nnz_A, nnz_P, hnnz_C_1)
+                           / gpu_solve_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "opR" << std::setw(12) << "M" << std::setw(12) << "K"
+                  << std::setw(12) << "nnz_R" << std::setw(12) << "nnz_A" << std::setw(12)
+                  << "nnz_P" << std::setw(12) << "nnz_C" << std::setw(12) << "GFlop/s"
+                  << std::setw(12) << "GB/s" << std::setw(16) << "nnz msec" << std::setw(16)
+                  << "rap msec" << std::setw(12) << "iter" << std::setw(12) << "verified"
+                  << std::endl;
+
+        std::cout << std::setw(12) << rocsparse_operation2string(trans_R) << std::setw(12) << M
+                  << std::setw(12) << K << std::setw(12) << nnz_R << std::setw(12) << nnz_A
+                  << std::setw(12) << nnz_P << std::setw(12) << hnnz_C_1 << std::setw(12)
+                  << gpu_gflops << std::setw(12) << gpu_gbyte << std::setw(16)
+                  << gpu_analysis_time_used / 1e3 << std::setw(16) << gpu_solve_time_used / 1e3
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#endif // TESTING_CSRRAP_HPP
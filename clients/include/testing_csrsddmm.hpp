@@ -0,0 +1,703 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_CSRSDDMM_HPP
+#define TESTING_CSRSDDMM_HPP
+
+#include <rocsparse.hpp>
+
+#include "flops.hpp"
+#include "gbyte.hpp"
+#include "rocsparse_check.hpp"
+#include "rocsparse_host.hpp"
+#include "rocsparse_init.hpp"
+#include "rocsparse_math.hpp"
+#include "rocsparse_random.hpp"
+#include "rocsparse_test.hpp"
+#include "rocsparse_vector.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_csrsddmm_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    T h_alpha = 0.6;
+    T h_beta  = 0.1;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create rocsparse mat descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Storage order of the dense matrices
+    rocsparse_order order = rocsparse_order_column;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<T>             dcsr_val(safe_size);
+    device_vector<T>             dA(safe_size);
+    device_vector<T>             dB(safe_size);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dA || !dB)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_csrsddmm()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(nullptr,
+                                                  order,
+                                                  order,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  descr,
+                                                  safe_size,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  order,
+                                                  order,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  nullptr,
+                                                  dA,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  descr,
+                                                  safe_size,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  order,
+                                                  order,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  nullptr,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  descr,
+                                                  safe_size,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  order,
+                                                  order,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size,
+                                                  nullptr,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  descr,
+                                                  safe_size,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  order,
+                                                  order,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  nullptr,
+                                                  descr,
+                                                  safe_size,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  order,
+                                                  order,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  nullptr,
+                                                  safe_size,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  order,
+                                                  order,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  descr,
+                                                  safe_size,
+                                                  nullptr,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  order,
+                                                  order,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  descr,
+                                                  safe_size,
+                                                  dcsr_val,
+                                                  nullptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  order,
+                                                  order,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  descr,
+                                                  safe_size,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Test invalid sizes
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  order,
+                                                  order,
+                                                  -1,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  descr,
+                                                  safe_size,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  order,
+                                                  order,
+                                                  safe_size,
+                                                  -1,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  descr,
+                                                  safe_size,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  order,
+                                                  order,
+                                                  safe_size,
+                                                  safe_size,
+                                                  -1,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  descr,
+                                                  safe_size,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  order,
+                                                  order,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  descr,
+                                                  -1,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_size);
+
+    // Test invalid leading dimensions
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  order,
+                                                  order,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size - 1,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  descr,
+                                                  safe_size,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  order,
+                                                  order,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size - 1,
+                                                  &h_beta,
+                                                  descr,
+                                                  safe_size,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_size);
+
+    // Test invalid storage order
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  (rocsparse_order)2,
+                                                  order,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  descr,
+                                                  safe_size,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                  order,
+                                                  (rocsparse_order)2,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  &h_alpha,
+                                                  dA,
+                                                  safe_size,
+                                                  dB,
+                                                  safe_size,
+                                                  &h_beta,
+                                                  descr,
+                                                  safe_size,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind),
+                            rocsparse_status_invalid_value);
+}
+
+template <typename T>
+void testing_csrsddmm(const Arguments& arg)
+{
+    rocsparse_int         M         = arg.M;
+    rocsparse_int         N         = arg.N;
+    rocsparse_int         K         = arg.K;
+    rocsparse_int         dim_x     = arg.dimx;
+    rocsparse_int         dim_y     = arg.dimy;
+    rocsparse_int         dim_z     = arg.dimz;
+    rocsparse_order       orderA    = arg.orderA;
+    rocsparse_order       orderB    = arg.orderB;
+    rocsparse_index_base  base      = arg.baseA;
+    rocsparse_matrix_init mat       = arg.matrix;
+    bool                  full_rank = false;
+    std::string           filename
+        = arg.timing ? arg.filename : rocsparse_exepath() + "../matrices/" + arg.filename + ".csr";
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create rocsparse mat descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0 || K < 0)
+    {
+        static const size_t safe_size = 100;
+
+        rocsparse_int lda = std::max(1, (orderA == rocsparse_order_row) ? K : M);
+        rocsparse_int ldb = std::max(1, (orderB == rocsparse_order_row) ? N : K);
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrsddmm<T>(handle,
+                                                      orderA,
+                                                      orderB,
+                                                      M,
+                                                      N,
+                                                      K,
+                                                      nullptr,
+                                                      nullptr,
+                                                      lda,
+                                                      nullptr,
+                                                      ldb,
+                                                      nullptr,
+                                                      descr,
+                                                      safe_size,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr),
+                                (M < 0 || N < 0 || K < 0) ? rocsparse_status_invalid_size
+                                                          : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for the sampling pattern C
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    rocsparse_seedrand();
+
+    // Sample the sparsity pattern of C
+    rocsparse_int nnz;
+
+    if(mat == rocsparse_matrix_random && arg.nnz > 0)
+    {
+        // Random pattern with a given number of entries per row, e.g. to control the
+        // density in the benchmarks
+        nnz = M * std::min(arg.nnz, N);
+
+        host_vector<rocsparse_int> hcoo_row_ind;
+        rocsparse_init_coo_matrix(hcoo_row_ind, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+        host_coo_to_csr(M, nnz, hcoo_row_ind, hcsr_row_ptr, base);
+    }
+    else
+    {
+        rocsparse_init_csr_matrix(hcsr_row_ptr,
+                                  hcsr_col_ind,
+                                  hcsr_val,
+                                  M,
+                                  N,
+                                  K,
+                                  dim_x,
+                                  dim_y,
+                                  dim_z,
+                                  nnz,
+                                  base,
+                                  mat,
+                                  filename.c_str(),
+                                  false,
+                                  full_rank);
+    }
+
+    // Leading dimensions of A (M x K) and B (K x N)
+    rocsparse_int lda = std::max(1, (orderA == rocsparse_order_row) ? K : M);
+    rocsparse_int ldb = std::max(1, (orderB == rocsparse_order_row) ? N : K);
+
+    size_t size_A = (size_t)lda * ((orderA == rocsparse_order_row) ? M : K);
+    size_t size_B = (size_t)ldb * ((orderB == rocsparse_order_row) ? K : N);
+
+    // Allocate host memory for the dense matrices
+    host_vector<T> hA(size_A);
+    host_vector<T> hB(size_B);
+
+    // Sample the dense matrices
+    if(orderA == rocsparse_order_row)
+    {
+        rocsparse_init<T>(hA, K, M, lda);
+    }
+    else
+    {
+        rocsparse_init<T>(hA, M, K, lda);
+    }
+
+    if(orderB == rocsparse_order_row)
+    {
+        rocsparse_init<T>(hB, N, K, ldb);
+    }
+    else
+    {
+        rocsparse_init<T>(hB, K, N, ldb);
+    }
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val_1(nnz);
+    device_vector<T>             dcsr_val_2(nnz);
+    device_vector<T>             dA(size_A);
+    device_vector<T>             dB(size_B);
+    device_vector<T>             d_alpha(1);
+    device_vector<T>             d_beta(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val_1 || !dcsr_val_2 || !dA || !dB || !d_alpha
+       || !d_beta)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_1, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * size_B, hipMemcpyHostToDevice));
+
+    if(arg.unit_check)
+    {
+        // Copy data from CPU to device
+        CHECK_HIP_ERROR(
+            hipMemcpy(dcsr_val_2, dcsr_val_1, sizeof(T) * nnz, hipMemcpyDeviceToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsddmm<T>(handle,
+                                                    orderA,
+                                                    orderB,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    &h_alpha,
+                                                    dA,
+                                                    lda,
+                                                    dB,
+                                                    ldb,
+                                                    &h_beta,
+                                                    descr,
+                                                    nnz,
+                                                    dcsr_val_1,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsddmm<T>(handle,
+                                                    orderA,
+                                                    orderB,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    d_alpha,
+                                                    dA,
+                                                    lda,
+                                                    dB,
+                                                    ldb,
+                                                    d_beta,
+                                                    descr,
+                                                    nnz,
+                                                    dcsr_val_2,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind));
+
+        // Copy output to host
+        host_vector<T> hcsr_val_1(nnz);
+        host_vector<T> hcsr_val_2(nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_val_1, dcsr_val_1, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_val_2, dcsr_val_2, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+        // CPU csrsddmm
+        host_csrsddmm<T>(M,
+                         K,
+                         orderA,
+                         orderB,
+                         h_alpha,
+                         hA,
+                         lda,
+                         hB,
+                         ldb,
+                         h_beta,
+                         hcsr_row_ptr,
+                         hcsr_col_ind,
+                         hcsr_val,
+                         base);
+
+        near_check_general<T>(1, nnz, 1, hcsr_val, hcsr_val_1);
+        near_check_general<T>(1, nnz, 1, hcsr_val, hcsr_val_2);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsddmm<T>(handle,
+                                                        orderA,
+                                                        orderB,
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        &h_alpha,
+                                                        dA,
+                                                        lda,
+                                                        dB,
+                                                        ldb,
+                                                        &h_beta,
+                                                        descr,
+                                                        nnz,
+                                                        dcsr_val_1,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsddmm<T>(handle,
+                                                        orderA,
+                                                        orderB,
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        &h_alpha,
+                                                        dA,
+                                                        lda,
+                                                        dB,
+                                                        ldb,
+                                                        &h_beta,
+                                                        descr,
+                                                        nnz,
+                                                        dcsr_val_1,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gflops
+            = sddmm_gflop_count<T>(K, nnz, h_beta != static_cast<T>(0)) / gpu_time_used * 1e6;
+        double gpu_gbyte
+            = csrsddmm_gbyte_count<T>(M, N, K, nnz, h_beta != static_cast<T>(0))
+              / gpu_time_used * 1e6;
+
+        // Density of the sampling pattern
+        double density = (double)nnz / ((double)M * N);
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "K"
+                  << std::setw(12) << "orderA" << std::setw(12) << "orderB" << std::setw(12)
+                  << "nnz" << std::setw(12) << "density" << std::setw(12) << "alpha"
+                  << std::setw(12) << "beta" << std::setw(12) << "GFlop/s" << std::setw(12)
+                  << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter"
+                  << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << K
+                  << std::setw(12) << rocsparse_order2string(orderA) << std::setw(12)
+                  << rocsparse_order2string(orderB) << std::setw(12) << nnz << std::setw(12)
+                  << std::scientific << density << std::fixed << std::setw(12) << h_alpha
+                  << std::setw(12) << h_beta << std::setw(12) << gpu_gflops << std::setw(12)
+                  << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3 << std::setw(12)
+                  << number_hot_calls << std::setw(12) << (arg.unit_check ? "yes" : "no")
+                  << std::endl;
+    }
+}
+
+#endif // TESTING_CSRSDDMM_HPP
@@ -0,0 +1,561 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_DIA2CSR_HPP
+#define TESTING_DIA2CSR_HPP
+
+#include <rocsparse.hpp>
+
+#include "gbyte.hpp"
+#include "rocsparse_check.hpp"
+#include "rocsparse_host.hpp"
+#include "rocsparse_init.hpp"
+#include "rocsparse_math.hpp"
+#include "rocsparse_random.hpp"
+#include "rocsparse_test.hpp"
+#include "rocsparse_vector.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_dia2csr_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> ddia_offset(safe_size);
+    device_vector<T>             ddia_val(safe_size);
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<T>             dcsr_val(safe_size);
+
+    if(!ddia_offset || !ddia_val || !dcsr_row_ptr || !dcsr_col_ind || !dcsr_val)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_dia2csr_nnz()
+    rocsparse_int csr_nnz;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dia2csr_nnz(nullptr,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  ddia_offset,
+                                                  descr,
+                                                  dcsr_row_ptr,
+                                                  &csr_nnz),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dia2csr_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  nullptr,
+                                                  descr,
+                                                  dcsr_row_ptr,
+                                                  &csr_nnz),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dia2csr_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  ddia_offset,
+                                                  nullptr,
+                                                  dcsr_row_ptr,
+                                                  &csr_nnz),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dia2csr_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  ddia_offset,
+                                                  descr,
+                                                  nullptr,
+                                                  &csr_nnz),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dia2csr_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  safe_size,
+                                                  ddia_offset,
+                                                  descr,
+                                                  dcsr_row_ptr,
+                                                  nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dia2csr_nnz(handle,
+                                                  -1,
+                                                  safe_size,
+                                                  safe_size,
+                                                  ddia_offset,
+                                                  descr,
+                                                  dcsr_row_ptr,
+                                                  &csr_nnz),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dia2csr_nnz(handle,
+                                                  safe_size,
+                                                  -1,
+                                                  safe_size,
+                                                  ddia_offset,
+                                                  descr,
+                                                  dcsr_row_ptr,
+                                                  &csr_nnz),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dia2csr_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  -1,
+                                                  ddia_offset,
+                                                  descr,
+                                                  dcsr_row_ptr,
+                                                  &csr_nnz),
+                            rocsparse_status_invalid_size);
+
+    // Test rocsparse_dia2csr()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dia2csr<T>(nullptr,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 ddia_val,
+                                                 ddia_offset,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dia2csr<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 nullptr,
+                                                 ddia_offset,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dia2csr<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 ddia_val,
+                                                 nullptr,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dia2csr<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 ddia_val,
+                                                 ddia_offset,
+                                                 nullptr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dia2csr<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 ddia_val,
+                                                 ddia_offset,
+                                                 descr,
+                                                 nullptr,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dia2csr<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 ddia_val,
+                                                 ddia_offset,
+                                                 descr,
+                                                 dcsr_val,
+                                                 nullptr,
+                                                 dcsr_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dia2csr<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 ddia_val,
+                                                 ddia_offset,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dia2csr<T>(handle,
+                                                 -1,
+                                                 safe_size,
+                                                 safe_size,
+                                                 ddia_val,
+                                                 ddia_offset,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dia2csr<T>(handle,
+                                                 safe_size,
+                                                 -1,
+                                                 safe_size,
+                                                 ddia_val,
+                                                 ddia_offset,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_dia2csr<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 -1,
+                                                 ddia_val,
+                                                 ddia_offset,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind),
+                            rocsparse_status_invalid_size);
+}
+
+template <typename T>
+void testing_dia2csr(const Arguments& arg)
+{
+    rocsparse_int         M         = arg.M;
+    rocsparse_int         N         = arg.N;
+    rocsparse_int         K         = arg.K;
+    rocsparse_int         dim_x     = arg.dimx;
+    rocsparse_int         dim_y     = arg.dimy;
+    rocsparse_int         dim_z     = arg.dimz;
+    rocsparse_index_base  base      = arg.baseA;
+    rocsparse_matrix_init mat       = arg.matrix;
+    bool                  full_rank = false;
+    std::string           filename
+        = arg.timing ? arg.filename : rocsparse_exepath() + "../matrices/" + arg.filename + ".csr";
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor for CSR matrix
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> ddia_offset(safe_size);
+        device_vector<T>             ddia_val(safe_size);
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+
+        if(!ddia_offset || !ddia_val || !dcsr_row_ptr || !dcsr_col_ind || !dcsr_val)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        rocsparse_int csr_nnz;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_dia2csr_nnz(handle,
+                                                      M,
+                                                      N,
+                                                      0,
+                                                      ddia_offset,
+                                                      descr,
+                                                      dcsr_row_ptr,
+                                                      &csr_nnz),
+                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_dia2csr<T>(handle,
+                                                     M,
+                                                     N,
+                                                     0,
+                                                     ddia_val,
+                                                     ddia_offset,
+                                                     descr,
+                                                     dcsr_val,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind),
+                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+    host_vector<rocsparse_int> hcsr_row_ptr_gold;
+    host_vector<rocsparse_int> hcsr_col_ind_gold;
+    host_vector<T>             hcsr_val_gold;
+
+    rocsparse_seedrand();
+
+    // Sample matrix
+    rocsparse_int nnz;
+    rocsparse_init_csr_matrix(hcsr_row_ptr_gold,
+                              hcsr_col_ind_gold,
+                              hcsr_val_gold,
+                              M,
+                              N,
+                              K,
+                              dim_x,
+                              dim_y,
+                              dim_z,
+                              nnz,
+                              base,
+                              mat,
+                              filename.c_str(),
+                              false,
+                              full_rank);
+
+    // Convert to DIA
+    host_vector<rocsparse_int> hdia_offset;
+    host_vector<T>             hdia_val;
+    rocsparse_int              dia_num_diag;
+
+    host_csr_to_dia(M,
+                    N,
+                    hcsr_row_ptr_gold,
+                    hcsr_col_ind_gold,
+                    hcsr_val_gold,
+                    hdia_offset,
+                    hdia_val,
+                    dia_num_diag,
+                    base);
+
+    rocsparse_int dia_nnz = dia_num_diag * M;
+
+    hcsr_row_ptr_gold.clear();
+    hcsr_col_ind_gold.clear();
+    hcsr_val_gold.clear();
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> ddia_offset(dia_num_diag);
+    device_vector<T>             ddia_val(dia_nnz);
+
+    if(!dcsr_row_ptr || !ddia_offset || !ddia_val)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        ddia_offset, hdia_offset, sizeof(rocsparse_int) * dia_num_diag, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(ddia_val, hdia_val, sizeof(T) * dia_nnz, hipMemcpyHostToDevice));
+
+    if(arg.unit_check)
+    {
+        // Obtain CSR nnz, pointer mode host
+        rocsparse_int csr_nnz;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_dia2csr_nnz(handle,
+                                                    M,
+                                                    N,
+                                                    dia_num_diag,
+                                                    ddia_offset,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    &csr_nnz));
+
+        // Pointer mode device
+        device_vector<rocsparse_int> dcsr_row_ptr_2(M + 1);
+        device_vector<rocsparse_int> dcsr_nnz(1);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_dia2csr_nnz(handle,
+                                                    M,
+                                                    N,
+                                                    dia_num_diag,
+                                                    ddia_offset,
+                                                    descr,
+                                                    dcsr_row_ptr_2,
+                                                    dcsr_nnz));
+
+        rocsparse_int              csr_nnz_2;
+        host_vector<rocsparse_int> hcsr_row_ptr_2(M + 1);
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(&csr_nnz_2, dcsr_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_2,
+                                  dcsr_row_ptr_2,
+                                  sizeof(rocsparse_int) * (M + 1),
+                                  hipMemcpyDeviceToHost));
+
+        // Allocate device memory
+        device_vector<rocsparse_int> dcsr_col_ind(csr_nnz);
+        device_vector<T>             dcsr_val(csr_nnz);
+
+        // Perform CSR conversion
+        CHECK_ROCSPARSE_ERROR(rocsparse_dia2csr<T>(handle,
+                                                   M,
+                                                   N,
+                                                   dia_num_diag,
+                                                   ddia_val,
+                                                   ddia_offset,
+                                                   descr,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind));
+
+        // Copy output to host
+        hcsr_row_ptr.resize(M + 1);
+        hcsr_col_ind.resize(csr_nnz);
+        hcsr_val.resize(csr_nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            hcsr_row_ptr, dcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hcsr_col_ind, dcsr_col_ind, sizeof(rocsparse_int) * csr_nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_val, dcsr_val, sizeof(T) * csr_nnz, hipMemcpyDeviceToHost));
+
+        // CPU dia2csr
+        rocsparse_int csr_nnz_gold;
+        host_dia_to_csr<T>(M,
+                           N,
+                           dia_num_diag,
+                           hdia_offset,
+                           hdia_val,
+                           hcsr_row_ptr_gold,
+                           hcsr_col_ind_gold,
+                           hcsr_val_gold,
+                           csr_nnz_gold,
+                           base);
+
+        unit_check_general<rocsparse_int>(1, 1, 1, &csr_nnz_gold, &csr_nnz);
+        unit_check_general<rocsparse_int>(1, 1, 1, &csr_nnz_gold, &csr_nnz_2);
+        unit_check_general<rocsparse_int>(1, M + 1, 1, hcsr_row_ptr_gold, hcsr_row_ptr);
+        unit_check_general<rocsparse_int>(1, M + 1, 1, hcsr_row_ptr_gold, hcsr_row_ptr_2);
+        unit_check_general<rocsparse_int>(1, csr_nnz, 1, hcsr_col_ind_gold, hcsr_col_ind);
+        unit_check_general<T>(1, csr_nnz, 1, hcsr_val_gold, hcsr_val);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        rocsparse_int csr_nnz;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_dia2csr_nnz(handle,
+                                                        M,
+                                                        N,
+                                                        dia_num_diag,
+                                                        ddia_offset,
+                                                        descr,
+                                                        dcsr_row_ptr,
+                                                        &csr_nnz));
+
+            device_vector<rocsparse_int> dcsr_col_ind(csr_nnz);
+            device_vector<T>             dcsr_val(csr_nnz);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_dia2csr<T>(handle,
+                                                       M,
+                                                       N,
+                                                       dia_num_diag,
+                                                       ddia_val,
+                                                       ddia_offset,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_dia2csr_nnz(handle,
+                                                        M,
+                                                        N,
+                                                        dia_num_diag,
+                                                        ddia_offset,
+                                                        descr,
+                                                        dcsr_row_ptr,
+                                                        &csr_nnz));
+
+            device_vector<rocsparse_int> dcsr_col_ind(csr_nnz);
+            device_vector<T>             dcsr_val(csr_nnz);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_dia2csr<T>(handle,
+                                                       M,
+                                                       N,
+                                                       dia_num_diag,
+                                                       ddia_val,
+                                                       ddia_offset,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gbyte
+            = dia2csr_gbyte_count<T>(M, csr_nnz, dia_nnz, dia_num_diag) / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "diagonals"
+                  << std::setw(12) << "CSR nnz" << std::setw(12) << "GB/s" << std::setw(12)
+                  << "msec" << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << dia_num_diag
+                  << std::setw(12) << csr_nnz << std::setw(12) << gpu_gbyte << std::setw(12)
+                  << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+}
+
+#endif // TESTING_DIA2CSR_HPP
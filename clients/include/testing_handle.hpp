@@ -0,0 +1,90 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_HANDLE_HPP
+#define TESTING_HANDLE_HPP
+
+#include <rocsparse.hpp>
+
+#include "rocsparse_check.hpp"
+#include "rocsparse_test.hpp"
+#include "utility.hpp"
+
+template <typename T>
+void testing_create_handle(const Arguments& arg)
+{
+    // Keep one handle alive, such that the shared device state is not
+    // created and destroyed in every iteration
+    rocsparse_local_handle handle;
+
+    if(arg.unit_check)
+    {
+        rocsparse_handle local_handle;
+        hipStream_t      stream;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_create_handle(&local_handle));
+        CHECK_ROCSPARSE_ERROR(rocsparse_get_stream(local_handle, &stream));
+        CHECK_ROCSPARSE_ERROR(rocsparse_destroy_handle(local_handle));
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        rocsparse_handle local_handle;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_create_handle(&local_handle));
+            CHECK_ROCSPARSE_ERROR(rocsparse_destroy_handle(local_handle));
+        }
+
+        double cpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_create_handle(&local_handle));
+            CHECK_ROCSPARSE_ERROR(rocsparse_destroy_handle(local_handle));
+        }
+
+        cpu_time_used = (get_time_us() - cpu_time_used) / number_hot_calls;
+
+        double handles_per_sec = 1e6 / cpu_time_used;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "handles/s" << std::setw(12) << "usec" << std::setw(12)
+                  << "iter" << std::setw(12) << "verified" << std::endl;
+        std::cout << std::setw(12) << handles_per_sec << std::setw(12) << cpu_time_used
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+}
+
+#endif // TESTING_HANDLE_HPP
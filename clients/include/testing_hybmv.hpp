@@ -348,6 +348,51 @@ void testing_hybmv(const Arguments& arg)
         double gpu_gflops
             = spmv_gflop_count<T>(M, nnz, h_beta != static_cast<T>(0)) / gpu_time_used * 1e6;
 
+        rocsparse_hyb_mat ptr  = hyb;
+        test_hyb*         dhyb = reinterpret_cast<test_hyb*>(ptr);
+
+        // For the auto partition, compare against the ELL width of the average non-zero
+        // entries per row, which the auto partition used before the row length histogram
+        rocsparse_int avg_ell_width  = (nnz - 1) / M + 1;
+        double        avg_gpu_gflops = 0.0;
+
+        if(part == rocsparse_hyb_partition_auto)
+        {
+            rocsparse_local_hyb_mat hyb_avg;
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb<T>(handle,
+                                                       M,
+                                                       N,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       hyb_avg,
+                                                       avg_ell_width,
+                                                       rocsparse_hyb_partition_user));
+
+            // Warm up
+            for(int iter = 0; iter < number_cold_calls; ++iter)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_hybmv<T>(
+                    handle, trans, &h_alpha, descr, hyb_avg, dx, &h_beta, dy_1));
+            }
+
+            double avg_gpu_time_used = get_time_us();
+
+            // Performance run
+            for(int iter = 0; iter < number_hot_calls; ++iter)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_hybmv<T>(
+                    handle, trans, &h_alpha, descr, hyb_avg, dx, &h_beta, dy_1));
+            }
+
+            avg_gpu_time_used = (get_time_us() - avg_gpu_time_used) / number_hot_calls;
+
+            avg_gpu_gflops = spmv_gflop_count<T>(M, nnz, h_beta != static_cast<T>(0))
+                             / avg_gpu_time_used * 1e6;
+        }
+
         std::cout.precision(2);
         std::cout.setf(std::ios::fixed);
         std::cout.setf(std::ios::left);
@@ -355,23 +400,37 @@ void testing_hybmv(const Arguments& arg)
         std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "nnz"
                   << std::setw(12) << "alpha" << std::setw(12) << "beta" << std::setw(12)
                   << "partition";
-        if(part == rocsparse_hyb_partition_user)
+        if(part != rocsparse_hyb_partition_max)
         {
             std::cout << std::setw(12) << "width";
         }
-        std::cout << std::setw(12) << "GFlop/s" << std::setw(12) << "msec" << std::setw(12)
-                  << "iter" << std::setw(12) << "verified" << std::endl;
+        std::cout << std::setw(12) << "GFlop/s";
+        if(part == rocsparse_hyb_partition_auto)
+        {
+            std::cout << std::setw(12) << "avg width" << std::setw(12) << "avg GFlop/s";
+        }
+        std::cout << std::setw(12) << "msec" << std::setw(12) << "iter" << std::setw(12)
+                  << "verified" << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << nnz
                   << std::setw(12) << h_alpha << std::setw(12) << h_beta << std::setw(12)
                   << rocsparse_partition2string(part);
-        if(part == rocsparse_hyb_partition_user)
+        if(part != rocsparse_hyb_partition_max)
+        {
+            std::cout << std::setw(12) << dhyb->ell_width;
+        }
+        std::cout << std::setw(12) << gpu_gflops;
+        if(part == rocsparse_hyb_partition_auto)
+        {
+            std::cout << std::setw(12) << avg_ell_width << std::setw(12) << avg_gpu_gflops;
+        }
+        std::cout << std::setw(12) << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls
+                  << std::setw(12) << (arg.unit_check ? "yes" : "no") << std::endl;
+
+        if(arg.memstat)
         {
-            std::cout << std::setw(12) << user_ell_width;
+            print_hyb_mat_size(hyb, sizeof(rocsparse_int) * (M + 1 + nnz) + sizeof(T) * nnz);
         }
-        std::cout << std::setw(12) << gpu_gflops << std::setw(12) << gpu_time_used / 1e3
-                  << std::setw(12) << number_hot_calls << std::setw(12)
-                  << (arg.unit_check ? "yes" : "no") << std::endl;
     }
 }
 
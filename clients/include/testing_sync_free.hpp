@@ -0,0 +1,420 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_SYNC_FREE_HPP
+#define TESTING_SYNC_FREE_HPP
+
+#include <rocsparse.hpp>
+
+#include "rocsparse_check.hpp"
+#include "rocsparse_host.hpp"
+#include "rocsparse_init.hpp"
+#include "rocsparse_test.hpp"
+#include "rocsparse_vector.hpp"
+#include "utility.hpp"
+
+// Checks that analysis and solve phases of csrmv, csrsv, csrilu0 and csric0 do
+// not synchronize the host with the device. All routines are queued behind a
+// long running workload on a dedicated stream. If any of the routines
+// synchronized, the workload would have finished by the time they return.
+template <typename T>
+void testing_sync_free(const Arguments& arg)
+{
+    rocsparse_int         M         = arg.M;
+    rocsparse_int         N         = arg.N;
+    rocsparse_int         K         = arg.K;
+    rocsparse_int         dim_x     = arg.dimx;
+    rocsparse_int         dim_y     = arg.dimy;
+    rocsparse_int         dim_z     = arg.dimz;
+    rocsparse_index_base  base      = arg.baseA;
+    rocsparse_matrix_init mat       = arg.matrix;
+    bool                  full_rank = true;
+    std::string filename = rocsparse_exepath() + "../matrices/" + arg.filename + ".csr";
+
+    rocsparse_analysis_policy apol = rocsparse_analysis_policy_force;
+    rocsparse_solve_policy    spol = rocsparse_solve_policy_auto;
+
+    T h_alpha = static_cast<T>(1);
+    T h_beta  = static_cast<T>(0);
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr descr;
+    rocsparse_local_mat_descr descrL;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrL, base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descrL, rocsparse_fill_mode_lower));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_diag_type(descrL, rocsparse_diag_type_unit));
+
+    // Create matrix info for each routine, such that no meta data is shared
+    rocsparse_local_mat_info info_mv;
+    rocsparse_local_mat_info info_sv;
+    rocsparse_local_mat_info info_ilu0;
+    rocsparse_local_mat_info info_ic0;
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    rocsparse_seedrand();
+
+    // Sample matrix
+    rocsparse_int nnz;
+    rocsparse_init_csr_matrix(hcsr_row_ptr,
+                              hcsr_col_ind,
+                              hcsr_val,
+                              M,
+                              N,
+                              K,
+                              dim_x,
+                              dim_y,
+                              dim_z,
+                              nnz,
+                              base,
+                              mat,
+                              filename.c_str(),
+                              false,
+                              full_rank);
+
+    // Initialize data on CPU
+    host_vector<T> hx(N);
+    rocsparse_init<T>(hx, 1, N, 1);
+
+    host_vector<T> hy_1(M);
+    host_vector<T> hy_2(M);
+    host_vector<T> hy_gold(M);
+    host_vector<T> hz(M);
+    host_vector<T> hz_gold(M);
+    host_vector<T> hcsr_val_ilu0(nnz);
+    host_vector<T> hcsr_val_ilu0_gold = hcsr_val;
+    host_vector<T> hcsr_val_ic0(nnz);
+    host_vector<T> hcsr_val_ic0_gold = hcsr_val;
+
+    // Compute reference results on host, before any device work is queued
+    host_csrmv<T>(M,
+                  nnz,
+                  h_alpha,
+                  hcsr_row_ptr.data(),
+                  hcsr_col_ind.data(),
+                  hcsr_val,
+                  hx,
+                  h_beta,
+                  hy_gold,
+                  base,
+                  1);
+
+    rocsparse_int h_sv_struct_pivot;
+    rocsparse_int h_sv_numeric_pivot;
+    host_csrsv<T>(rocsparse_operation_none,
+                  M,
+                  nnz,
+                  h_alpha,
+                  hcsr_row_ptr,
+                  hcsr_col_ind,
+                  hcsr_val,
+                  hx,
+                  hz_gold,
+                  rocsparse_diag_type_unit,
+                  rocsparse_fill_mode_lower,
+                  base,
+                  &h_sv_struct_pivot,
+                  &h_sv_numeric_pivot);
+
+    rocsparse_int h_ilu0_struct_pivot;
+    rocsparse_int h_ilu0_numeric_pivot;
+    host_csrilu0<T>(M,
+                    hcsr_row_ptr,
+                    hcsr_col_ind,
+                    hcsr_val_ilu0_gold,
+                    base,
+                    &h_ilu0_struct_pivot,
+                    &h_ilu0_numeric_pivot);
+
+    rocsparse_int h_ic0_struct_pivot;
+    rocsparse_int h_ic0_numeric_pivot;
+    host_csric0<T>(M,
+                   hcsr_row_ptr,
+                   hcsr_col_ind,
+                   hcsr_val_ic0_gold,
+                   base,
+                   &h_ic0_struct_pivot,
+                   &h_ic0_numeric_pivot);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<T>             dcsr_val_ilu0(nnz);
+    device_vector<T>             dcsr_val_ic0(nnz);
+    device_vector<T>             dx(N);
+    device_vector<T>             dy_1(M);
+    device_vector<T>             dy_2(M);
+    device_vector<T>             dz(M);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dcsr_val_ilu0 || !dcsr_val_ic0 || !dx
+       || !dy_1 || !dy_2 || !dz)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_ilu0, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_ic0, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * N, hipMemcpyHostToDevice));
+
+    // Obtain buffer sizes
+    size_t buffer_size_sv;
+    size_t buffer_size_ilu0;
+    size_t buffer_size_ic0;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size<T>(handle,
+                                                         rocsparse_operation_none,
+                                                         M,
+                                                         nnz,
+                                                         descrL,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         info_sv,
+                                                         &buffer_size_sv));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_buffer_size<T>(handle,
+                                                           M,
+                                                           nnz,
+                                                           descr,
+                                                           dcsr_val_ilu0,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           info_ilu0,
+                                                           &buffer_size_ilu0));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csric0_buffer_size<T>(handle,
+                                                          M,
+                                                          nnz,
+                                                          descr,
+                                                          dcsr_val_ic0,
+                                                          dcsr_row_ptr,
+                                                          dcsr_col_ind,
+                                                          info_ic0,
+                                                          &buffer_size_ic0));
+
+    // Allocate buffers
+    device_vector<char> dbuffer_sv(buffer_size_sv);
+    device_vector<char> dbuffer_ilu0(buffer_size_ilu0);
+    device_vector<char> dbuffer_ic0(buffer_size_ic0);
+
+    // Workload to keep the stream busy
+    size_t              gate_size  = 256 << 20;
+    int                 gate_iters = 500;
+    device_vector<char> dgate(gate_size);
+
+    if(!dbuffer_sv || !dbuffer_ilu0 || !dbuffer_ic0 || !dgate)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Dedicated stream
+    hipStream_t stream;
+    hipEvent_t  gate;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIP_ERROR(hipEventCreateWithFlags(&gate, hipEventDisableTiming));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_stream(handle, stream));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    // Make sure all transfers have finished before the workload is queued
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    for(int i = 0; i < gate_iters; ++i)
+    {
+        CHECK_HIP_ERROR(hipMemsetAsync(dgate, i & 0xff, gate_size, stream));
+    }
+
+    CHECK_HIP_ERROR(hipEventRecord(gate, stream));
+
+    // csrmv, uses the adaptive kernel although the analysis has not yet finished
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(handle,
+                                                      rocsparse_operation_none,
+                                                      M,
+                                                      N,
+                                                      nnz,
+                                                      descr,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      info_mv));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(handle,
+                                             rocsparse_operation_none,
+                                             M,
+                                             N,
+                                             nnz,
+                                             &h_alpha,
+                                             descr,
+                                             dcsr_val,
+                                             dcsr_row_ptr,
+                                             dcsr_col_ind,
+                                             info_mv,
+                                             dx,
+                                             &h_beta,
+                                             dy_1));
+
+    // csrsv with unit diagonal, which re-initializes the zero pivot
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(handle,
+                                                      rocsparse_operation_none,
+                                                      M,
+                                                      nnz,
+                                                      descrL,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      info_sv,
+                                                      apol,
+                                                      spol,
+                                                      dbuffer_sv));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(handle,
+                                                   rocsparse_operation_none,
+                                                   M,
+                                                   nnz,
+                                                   &h_alpha,
+                                                   descrL,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   info_sv,
+                                                   dx,
+                                                   dz,
+                                                   spol,
+                                                   dbuffer_sv));
+
+    // csrilu0
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis<T>(handle,
+                                                        M,
+                                                        nnz,
+                                                        descr,
+                                                        dcsr_val_ilu0,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        info_ilu0,
+                                                        apol,
+                                                        spol,
+                                                        dbuffer_ilu0));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0<T>(handle,
+                                               M,
+                                               nnz,
+                                               descr,
+                                               dcsr_val_ilu0,
+                                               dcsr_row_ptr,
+                                               dcsr_col_ind,
+                                               info_ilu0,
+                                               spol,
+                                               dbuffer_ilu0));
+
+    // csric0
+    CHECK_ROCSPARSE_ERROR(rocsparse_csric0_analysis<T>(handle,
+                                                       M,
+                                                       nnz,
+                                                       descr,
+                                                       dcsr_val_ic0,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       info_ic0,
+                                                       apol,
+                                                       spol,
+                                                       dbuffer_ic0));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csric0<T>(handle,
+                                              M,
+                                              nnz,
+                                              descr,
+                                              dcsr_val_ic0,
+                                              dcsr_row_ptr,
+                                              dcsr_col_ind,
+                                              info_ic0,
+                                              spol,
+                                              dbuffer_ic0));
+
+    // None of the routines above must have waited for the workload
+    EXPECT_EQ(hipEventQuery(gate), hipErrorNotReady);
+
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // csrmv after the analysis has finished, using the same row blocks
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(handle,
+                                             rocsparse_operation_none,
+                                             M,
+                                             N,
+                                             nnz,
+                                             &h_alpha,
+                                             descr,
+                                             dcsr_val,
+                                             dcsr_row_ptr,
+                                             dcsr_col_ind,
+                                             info_mv,
+                                             dx,
+                                             &h_beta,
+                                             dy_2));
+
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Restore default stream before the stream is destroyed
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_stream(handle, 0));
+    CHECK_HIP_ERROR(hipEventDestroy(gate));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    // Copy output to host
+    CHECK_HIP_ERROR(hipMemcpy(hy_1, dy_1, sizeof(T) * M, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hy_2, dy_2, sizeof(T) * M, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hz, dz, sizeof(T) * M, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_val_ilu0, dcsr_val_ilu0, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hcsr_val_ic0, dcsr_val_ic0, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+    // Check results
+    near_check_general<T>(1, M, 1, hy_gold, hy_1);
+    near_check_general<T>(1, M, 1, hy_gold, hy_2);
+
+    if(h_sv_numeric_pivot == -1)
+    {
+        near_check_general<T>(1, M, 1, hz_gold, hz);
+    }
+
+    if(h_ilu0_struct_pivot == -1 && h_ilu0_numeric_pivot == -1)
+    {
+        near_check_general<T>(1, nnz, 1, hcsr_val_ilu0_gold, hcsr_val_ilu0);
+    }
+
+    if(h_ic0_struct_pivot == -1 && h_ic0_numeric_pivot == -1)
+    {
+        near_check_general<T>(1, nnz, 1, hcsr_val_ic0_gold, hcsr_val_ic0);
+    }
+}
+
+#endif // TESTING_SYNC_FREE_HPP
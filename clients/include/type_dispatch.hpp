@@ -59,4 +59,28 @@ auto rocsparse_simple_dispatch(const Arguments& arg)
     }
 }
 
+// Mixed precision functions, where the sparse matrix is stored in a lower precision
+//
+// compute_type is the precision of the dense vectors, which is passed as first template
+// type argument to TEST. The second one is the corresponding single precision type.
+// For the 16 bit types, compute_type is the precision of the sparse matrix, while the
+// dense vectors are stored in single precision.
+template <template <typename...> class TEST>
+auto rocsparse_mixed_dispatch(const Arguments& arg)
+{
+    switch(arg.compute_type)
+    {
+    case rocsparse_datatype_f64_r:
+        return TEST<double, float>{}(arg);
+    case rocsparse_datatype_f64_c:
+        return TEST<rocsparse_double_complex, rocsparse_float_complex>{}(arg);
+    case rocsparse_datatype_f16_r:
+        return TEST<float, rocsparse_half>{}(arg);
+    case rocsparse_datatype_bf16_r:
+        return TEST<float, rocsparse_bfloat16>{}(arg);
+    default:
+        return TEST<void, void>{}(arg);
+    }
+}
+
 #endif // TYPE_DISPATCH_HPP
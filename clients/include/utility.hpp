@@ -132,6 +132,7 @@ struct test_hyb
     rocsparse_int*          coo_row_ind;
     rocsparse_int*          coo_col_ind;
     void*                   coo_val;
+    size_t                  val_size;
 };
 
 /* ==================================================================================== */
@@ -175,6 +176,17 @@ double get_time_us(void);
  */
 double get_time_us_sync(hipStream_t stream);
 
+/* ==================================================================================== */
+/*! \brief  Print the device memory held by the meta data of each analysis stored in a
+ *  matrix info structure, relative to the device memory held by the matrix itself
+ */
+void print_mat_info_size(rocsparse_mat_info info, size_t matrix_size);
+
+/*! \brief  Print the device memory held by a HYB matrix, relative to the device memory
+ *  held by the CSR matrix it has been converted from
+ */
+void print_hyb_mat_size(rocsparse_hyb_mat hyb, size_t matrix_size);
+
 /* ==================================================================================== */
 // Return path of this executable
 std::string rocsparse_exepath();
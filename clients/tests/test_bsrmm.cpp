@@ -102,6 +102,8 @@ namespace
                        << arg.alphai << '_' << arg.beta << '_' << arg.betai << '_'
                        << rocsparse_operation2string(arg.transA) << '_'
                        << rocsparse_operation2string(arg.transB) << '_'
+                       << rocsparse_order2string(arg.orderB) << '_'
+                       << rocsparse_order2string(arg.orderC) << '_'
                        << rocsparse_indexbase2string(arg.baseA) << '_'
                        << rocsparse_matrix2string(arg.matrix);
             }
@@ -45,6 +45,12 @@ extern "C" {
  *  all subsequent library function calls. The handle should be destroyed at the end
  *  using rocsparse_destroy_handle().
  *
+ *  \note
+ *  Device properties and device constants are shared by all handles on the same
+ *  device. They are initialized when the first handle on a device is created and
+ *  released when the last handle on that device is destroyed. Further handles are
+ *  cheap to create, device memory of a handle is allocated on first use.
+ *
  *  @param[out]
  *  handle  the pointer to the handle to the rocSPARSE library context.
  *
@@ -433,6 +439,34 @@ rocsparse_status rocsparse_create_hyb_mat(rocsparse_hyb_mat* hyb);
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_destroy_hyb_mat(rocsparse_hyb_mat hyb);
 
+/*! \ingroup aux_module
+ *  \brief Get the device memory held by a \p HYB matrix structure
+ *
+ *  \details
+ *  \p rocsparse_get_hyb_mat_size returns the number of bytes of device memory that
+ *  are held by the \p ELL and \p COO part of a \p HYB matrix structure, as well as
+ *  their sum. If the \p HYB matrix has not been filled by rocsparse_csr2hyb() yet,
+ *  all sizes are zero.
+ *
+ *  @param[in]
+ *  hyb         the hybrid matrix structure.
+ *  @param[out]
+ *  ell_size    number of bytes held by the \p ELL part.
+ *  @param[out]
+ *  coo_size    number of bytes held by the \p COO part.
+ *  @param[out]
+ *  size        total number of bytes held by the \p HYB matrix structure.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p hyb, \p ell_size, \p coo_size or
+ *          \p size pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_hyb_mat_size(const rocsparse_hyb_mat hyb,
+                                            size_t*                 ell_size,
+                                            size_t*                 coo_size,
+                                            size_t*                 size);
+
 /*! \ingroup aux_module
  *  \brief Create a matrix info structure
  *
@@ -466,6 +500,42 @@ rocsparse_status rocsparse_create_mat_info(rocsparse_mat_info* info);
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info);
 
+/*! \ingroup aux_module
+ *  \brief Get the device memory held by a matrix info structure
+ *
+ *  \details
+ *  \p rocsparse_get_mat_info_size returns the number of bytes of device memory that
+ *  are held by the meta data of a matrix info structure. The meta data of a single
+ *  analysis, e.g. csrsv (lower, upper and transposed), can be queried as well as the
+ *  total amount of device memory held by the matrix info structure.
+ *
+ *  \note
+ *  Meta data can be shared between several analysis routines (see
+ *  \ref rocsparse_analysis_policy). Shared meta data is accounted for in each
+ *  component that references it. \ref rocsparse_info_component_total counts each
+ *  allocation exactly once, and \ref rocsparse_info_component_shared returns the number
+ *  of bytes that are referenced by more than one component.
+ *
+ *  \note
+ *  Temporary storage buffers, that have been passed by the user to the analysis
+ *  routines, are not included.
+ *
+ *  @param[in]
+ *  info        the info structure.
+ *  @param[in]
+ *  component   the meta data component to be queried.
+ *  @param[out]
+ *  size        number of bytes held by the requested component.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p info or \p size pointer is invalid.
+ *  \retval rocsparse_status_invalid_value \p component is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_mat_info_size(const rocsparse_mat_info info,
+                                             rocsparse_info_component component,
+                                             size_t*                  size);
+
 #ifdef __cplusplus
 }
 #endif
@@ -43,6 +43,32 @@ typedef int64_t rocsparse_int;
 typedef int32_t rocsparse_int;
 #endif
 
+/*! \ingroup types_module
+ *  \brief Half precision floating point type.
+ *
+ *  \details
+ *  \ref rocsparse_half holds the bit pattern of an IEEE 754 binary16 number. It is
+ *  used as storage type of sparse matrix values only, all arithmetic is performed in
+ *  single precision.
+ */
+typedef struct
+{
+    uint16_t data;
+} rocsparse_half;
+
+/*! \ingroup types_module
+ *  \brief Brain floating point type.
+ *
+ *  \details
+ *  \ref rocsparse_bfloat16 holds the upper 16 bits of an IEEE 754 binary32 number. It
+ *  is used as storage type of sparse matrix values only, all arithmetic is performed
+ *  in single precision.
+ */
+typedef struct
+{
+    uint16_t data;
+} rocsparse_bfloat16;
+
 /* Forward declaration of hipStream_t */
 typedef struct ihipStream_t* hipStream_t;
 
@@ -199,6 +225,20 @@ typedef enum rocsparse_direction_
     rocsparse_direction_column = 1 /**< Parse the matrix by columns. */
 } rocsparse_direction;
 
+/*! \ingroup types_module
+ *  \brief Specify the memory layout of a dense matrix.
+ *
+ *  \details
+ *  The \ref rocsparse_order indicates whether a dense matrix is stored in row-major or
+ *  in column-major order. The leading dimension is the distance between two consecutive
+ *  rows and columns, respectively.
+ */
+typedef enum rocsparse_order_
+{
+    rocsparse_order_row    = 0, /**< Row-major storage. */
+    rocsparse_order_column = 1 /**< Column-major storage. */
+} rocsparse_order;
+
 /*! \ingroup types_module
  *  \brief HYB matrix partitioning type.
  *
@@ -208,11 +248,59 @@ typedef enum rocsparse_direction_
  */
 typedef enum rocsparse_hyb_partition_
 {
-    rocsparse_hyb_partition_auto = 0, /**< automatically decide on ELL nnz per row. */
+    rocsparse_hyb_partition_auto = 0, /**< decide on ELL nnz per row by a cost model. */
     rocsparse_hyb_partition_user = 1, /**< user given ELL nnz per row. */
     rocsparse_hyb_partition_max  = 2 /**< max ELL nnz per row, no COO part. */
 } rocsparse_hyb_partition;
 
+/*! \ingroup types_module
+ *  \brief Sparse matrix vector multiplication storage format.
+ *
+ *  \details
+ *  The \ref rocsparse_spmv_format indicates the storage format that is used by
+ *  rocsparse_csrmv_format() to compute the sparse matrix vector multiplication, as
+ *  selected by rocsparse_csrmv_format_analysis().
+ */
+typedef enum rocsparse_spmv_format_
+{
+    rocsparse_spmv_format_csr = 0, /**< CSR storage format, computed by csrmv. */
+    rocsparse_spmv_format_ell = 1, /**< ELL storage format, computed by ellmv. */
+    rocsparse_spmv_format_hyb = 2, /**< HYB storage format, computed by hybmv. */
+    rocsparse_spmv_format_bsr = 3 /**< BSR storage format, computed by bsrmv. */
+} rocsparse_spmv_format;
+
+/*! \ingroup types_module
+ *  \brief Matrix info meta data component.
+ *
+ *  \details
+ *  The \ref rocsparse_info_component indicates which part of the meta data held by a
+ *  \ref rocsparse_mat_info structure is queried by rocsparse_get_mat_info_size().
+ *  Meta data that is shared between several components, e.g. when
+ *  rocsparse_csrsv_analysis() re-uses the meta data gathered by
+ *  rocsparse_csrilu0_analysis(), is accounted for in each component that references
+ *  it, but only once in \ref rocsparse_info_component_total.
+ */
+typedef enum rocsparse_info_component_
+{
+    rocsparse_info_component_total        = 0, /**< all meta data, shared data counted once. */
+    rocsparse_info_component_csrmv        = 1, /**< csrmv meta data. */
+    rocsparse_info_component_csrsv        = 2, /**< csrsv meta data. */
+    rocsparse_info_component_csrsm        = 3, /**< csrsm meta data. */
+    rocsparse_info_component_csrilu0      = 4, /**< csrilu0 meta data. */
+    rocsparse_info_component_csric0       = 5, /**< csric0 meta data. */
+    rocsparse_info_component_bsrsv        = 6, /**< bsrsv meta data. */
+    rocsparse_info_component_bsric0       = 7, /**< bsric0 meta data. */
+    rocsparse_info_component_bsrilu0      = 8, /**< bsrilu0 meta data. */
+    rocsparse_info_component_shared       = 9, /**< meta data shared by several components. */
+    rocsparse_info_component_bsrsm        = 10, /**< bsrsm meta data. */
+    rocsparse_info_component_bsrmv        = 11, /**< bsrmv meta data. */
+    rocsparse_info_component_csrrap       = 12, /**< csrrap meta data. */
+    rocsparse_info_component_csrgemm      = 13, /**< csrgemm meta data. */
+    rocsparse_info_component_csrmv_format = 14, /**< csrmv_format meta data. */
+    rocsparse_info_component_csrmm        = 15, /**< csrmm meta data. */
+    rocsparse_info_component_bsrmm        = 16 /**< bsrmm meta data. */
+} rocsparse_info_component;
+
 /*! \ingroup types_module
  *  \brief Specify policy in analysis functions.
  *
@@ -563,4 +563,81 @@ __launch_bounds__(BLOCK_SIZE) __global__
     }
 }
 
+// Each segment of WF_SEGMENT_SIZE threads counts the non-zero blocks of a sampled block
+// row, where the sampled block rows are evenly spread over the matrix. The segment lanes
+// loop over the rows of the block row and non-zero block columns are visited in ascending
+// order by searching the first column of each row, that is not part of a previous block.
+template <unsigned int BLOCKSIZE, unsigned int WF_SEGMENT_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2bsr_nnz_sample_kernel(rocsparse_int        m,
+                                   rocsparse_int        mb,
+                                   rocsparse_int        nb,
+                                   rocsparse_int        block_dim,
+                                   rocsparse_int        samples,
+                                   rocsparse_index_base csr_base,
+                                   const rocsparse_int* __restrict__ csr_row_ptr,
+                                   const rocsparse_int* __restrict__ csr_col_ind,
+                                   rocsparse_int* __restrict__ sample_nnzb,
+                                   rocsparse_int* __restrict__ sample_nnz)
+{
+    rocsparse_int lid = hipThreadIdx_x & (WF_SEGMENT_SIZE - 1);
+    rocsparse_int sid = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / WF_SEGMENT_SIZE;
+
+    // Rows of the sampled block row, segments without a sample stay idle
+    rocsparse_int row_begin = 0;
+    rocsparse_int row_end   = 0;
+
+    if(sid < samples)
+    {
+        rocsparse_int block_row = static_cast<int64_t>(sid) * mb / samples;
+
+        row_begin = block_row * block_dim;
+        row_end   = min(m, row_begin + block_dim);
+    }
+
+    rocsparse_int nnzb = 0;
+    rocsparse_int col  = 0;
+
+    while(true)
+    {
+        // Find the minimum block column, starting at column col
+        rocsparse_int min_block_col = nb;
+
+        for(rocsparse_int i = row_begin + lid; i < row_end; i += WF_SEGMENT_SIZE)
+        {
+            rocsparse_int begin = csr_row_ptr[i] - csr_base;
+            rocsparse_int end   = csr_row_ptr[i + 1] - csr_base;
+
+            // First entry of the row at or beyond the current column
+            rocsparse_int j = rocsparse_lower_bound(csr_col_ind, begin, end, col, csr_base);
+
+            if(j < end)
+            {
+                min_block_col = min(min_block_col, (csr_col_ind[j] - csr_base) / block_dim);
+            }
+        }
+
+        // Last lane of the segment contains the minimum after this call
+        rocsparse_wfreduce_min<WF_SEGMENT_SIZE>(&min_block_col);
+
+        // Broadcast the minimum to all lanes of the segment
+        min_block_col = __shfl(min_block_col, WF_SEGMENT_SIZE - 1, WF_SEGMENT_SIZE);
+
+        if(min_block_col == nb)
+        {
+            break;
+        }
+
+        ++nnzb;
+        col = (min_block_col + 1) * block_dim;
+    }
+
+    // Accumulate the blocks and the entries of the sampled block row
+    if(row_begin < row_end && lid == WF_SEGMENT_SIZE - 1)
+    {
+        atomicAdd(sample_nnzb, nnzb);
+        atomicAdd(sample_nnz, csr_row_ptr[row_end] - csr_row_ptr[row_begin]);
+    }
+}
+
 #endif // CSR2BSR_DEVICE_H
@@ -27,22 +27,18 @@
 
 #include <hip/hip_runtime.h>
 
-template <typename T, unsigned int BLOCKSIZE>
-__launch_bounds__(BLOCKSIZE) __global__ void csr2csc_permute_kernel(rocsparse_int        nnz,
-                                                                    const rocsparse_int* in1,
-                                                                    const T*             in2,
-                                                                    const rocsparse_int* map,
-                                                                    rocsparse_int*       out1,
-                                                                    T*                   out2)
+template <typename I, typename J, typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void csr2csc_permute_kernel(
+    I nnz, const J* in1, const T* in2, const I* map, J* out1, T* out2)
 {
-    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    I gid = static_cast<I>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
 
     if(gid >= nnz)
     {
         return;
     }
 
-    rocsparse_int idx = map[gid];
+    I idx = map[gid];
 
     out1[gid] = in1[idx];
     out2[gid] = in2[idx];
@@ -0,0 +1,177 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef CSR2CSRDC_DEVICE_H
+#define CSR2CSRDC_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Size in bytes of the column index data of a CSRDC matrix with m rows, nnz non-zero
+// entries and nnz_exc exceptions, relative to the size of the CSR column indices. The
+// column bases and exception offsets are included.
+__host__ __device__ __forceinline__ float csr2csrdc_compression_ratio(rocsparse_int m,
+                                                                      rocsparse_int nnz,
+                                                                      rocsparse_int nnz_exc,
+                                                                      rocsparse_int delta_bits)
+{
+    if(nnz == 0)
+    {
+        return 0.0f;
+    }
+
+    float csr_bytes   = static_cast<float>(sizeof(rocsparse_int)) * nnz;
+    float csrdc_bytes = static_cast<float>(sizeof(rocsparse_int)) * (2 * m + 1 + nnz_exc)
+                        + static_cast<float>(delta_bits / 8) * nnz;
+
+    return csr_bytes / csrdc_bytes;
+}
+
+// Returns true if the gap to the previous column of the row cannot be stored as delta
+template <typename U>
+__device__ __forceinline__ bool csr2csrdc_escape(rocsparse_int gap)
+{
+    return gap < 0 || gap >= static_cast<rocsparse_int>(static_cast<U>(-1));
+}
+
+// Each thread counts the exceptions of a CSR row
+template <typename U, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2csrdc_nnz_kernel(rocsparse_int m,
+                              const rocsparse_int* __restrict__ csr_row_ptr,
+                              const rocsparse_int* __restrict__ csr_col_ind,
+                              rocsparse_index_base idx_base,
+                              rocsparse_int* __restrict__ csrdc_exc_ptr)
+{
+    rocsparse_int row = hipThreadIdx_x + hipBlockDim_x * hipBlockIdx_x;
+
+    if(row == 0)
+    {
+        csrdc_exc_ptr[0] = idx_base;
+    }
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    rocsparse_int nnz_exc = 0;
+
+    for(rocsparse_int j = row_begin + 1; j < row_end; ++j)
+    {
+        if(csr2csrdc_escape<U>(csr_col_ind[j] - csr_col_ind[j - 1]))
+        {
+            ++nnz_exc;
+        }
+    }
+
+    csrdc_exc_ptr[row + 1] = nnz_exc;
+}
+
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2csrdc_nnz_total_kernel(rocsparse_int m,
+                                    rocsparse_int delta_bits,
+                                    const rocsparse_int* __restrict__ csr_row_ptr,
+                                    const rocsparse_int* __restrict__ csrdc_exc_ptr,
+                                    rocsparse_int* __restrict__ csrdc_nnz_exc,
+                                    float* __restrict__ compression_ratio)
+{
+    rocsparse_int thread_id = hipThreadIdx_x + hipBlockDim_x * hipBlockIdx_x;
+
+    if(thread_id == 0)
+    {
+        rocsparse_int nnz     = csr_row_ptr[m] - csr_row_ptr[0];
+        rocsparse_int nnz_exc = csrdc_exc_ptr[m] - csrdc_exc_ptr[0];
+
+        *csrdc_nnz_exc     = nnz_exc;
+        *compression_ratio = csr2csrdc_compression_ratio(m, nnz, nnz_exc, delta_bits);
+    }
+}
+
+// Each thread encodes the column indices of a CSR row. The first column of the row is
+// stored as column base and gets a zero delta. Gaps that do not fit the delta type,
+// including negative gaps of unsorted rows, are escaped and the column is appended to
+// the exceptions of the row.
+template <typename U, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2csrdc_kernel(rocsparse_int m,
+                          const rocsparse_int* __restrict__ csr_row_ptr,
+                          const rocsparse_int* __restrict__ csr_col_ind,
+                          rocsparse_index_base idx_base,
+                          rocsparse_int* __restrict__ csrdc_col_base,
+                          U* __restrict__ csrdc_delta,
+                          const rocsparse_int* __restrict__ csrdc_exc_ptr,
+                          rocsparse_int* __restrict__ csrdc_exc_col)
+{
+    rocsparse_int row = hipThreadIdx_x + hipBlockDim_x * hipBlockIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Empty rows get column base zero
+    if(row_begin == row_end)
+    {
+        csrdc_col_base[row] = idx_base;
+        return;
+    }
+
+    static constexpr U escape = static_cast<U>(-1);
+
+    rocsparse_int exc = csrdc_exc_ptr[row] - idx_base;
+    rocsparse_int col = csr_col_ind[row_begin];
+
+    csrdc_col_base[row]    = col;
+    csrdc_delta[row_begin] = 0;
+
+    for(rocsparse_int j = row_begin + 1; j < row_end; ++j)
+    {
+        rocsparse_int next = csr_col_ind[j];
+        rocsparse_int gap  = next - col;
+
+        if(csr2csrdc_escape<U>(gap))
+        {
+            csrdc_delta[j]       = escape;
+            csrdc_exc_col[exc++] = next;
+        }
+        else
+        {
+            csrdc_delta[j] = static_cast<U>(gap);
+        }
+
+        col = next;
+    }
+}
+
+#endif // CSR2CSRDC_DEVICE_H
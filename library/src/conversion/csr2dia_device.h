@@ -0,0 +1,185 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSR2DIA_DEVICE_H
+#define CSR2DIA_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Fraction of the m x ndiag DIA entries that are occupied by non-zero entries of
+// the CSR matrix
+__host__ __device__ __forceinline__ float csr2dia_fill(rocsparse_int m,
+                                                       rocsparse_int nnz,
+                                                       rocsparse_int ndiag)
+{
+    if(m == 0 || ndiag == 0)
+    {
+        return 0.0f;
+    }
+
+    return static_cast<float>(nnz) / (static_cast<float>(m) * ndiag);
+}
+
+// Each thread marks the diagonals that are occupied by the entries of a CSR row.
+// Diagonal with offset k is stored at position k + m - 1.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2dia_flag_kernel(rocsparse_int m,
+                             const rocsparse_int* __restrict__ csr_row_ptr,
+                             const rocsparse_int* __restrict__ csr_col_ind,
+                             rocsparse_index_base idx_base,
+                             rocsparse_int* __restrict__ diag_flag)
+{
+    rocsparse_int row = hipThreadIdx_x + hipBlockDim_x * hipBlockIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        diag_flag[csr_col_ind[j] - idx_base - row + m - 1] = 1;
+    }
+}
+
+// Count the occupied diagonals and do a block reduction over the sum
+// Store result in a workspace for final reduction on part2
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2dia_ndiag_kernel_part1(rocsparse_int size,
+                                    const rocsparse_int* __restrict__ diag_flag,
+                                    rocsparse_int* __restrict__ workspace)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    __shared__ rocsparse_int sdata[BLOCKSIZE];
+    sdata[tid] = 0;
+
+    for(rocsparse_int idx = gid; idx < size; idx += hipGridDim_x * BLOCKSIZE)
+    {
+        sdata[tid] += diag_flag[idx];
+    }
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<rocsparse_int, BLOCKSIZE>(tid, sdata);
+
+    if(tid == 0)
+    {
+        workspace[hipBlockIdx_x] = sdata[0];
+    }
+}
+
+// Part2 kernel for final reduction over the occupied diagonals, also computes the fill
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2dia_ndiag_kernel_part2(rocsparse_int m,
+                                    rocsparse_int nblocks,
+                                    const rocsparse_int* __restrict__ csr_row_ptr,
+                                    const rocsparse_int* __restrict__ workspace,
+                                    rocsparse_int* __restrict__ dia_num_diag,
+                                    float* __restrict__ dia_fill)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+
+    __shared__ rocsparse_int sdata[BLOCKSIZE];
+    sdata[tid] = 0;
+
+    for(rocsparse_int i = tid; i < nblocks; i += BLOCKSIZE)
+    {
+        sdata[tid] += workspace[i];
+    }
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<rocsparse_int, BLOCKSIZE>(tid, sdata);
+
+    if(tid == 0)
+    {
+        *dia_num_diag = sdata[0];
+        *dia_fill     = csr2dia_fill(m, csr_row_ptr[m] - csr_row_ptr[0], sdata[0]);
+    }
+}
+
+// Each thread writes the offset of an occupied diagonal, using the inclusive scan
+// over the diagonal flags
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2dia_offset_kernel(rocsparse_int m,
+                               rocsparse_int n,
+                               const rocsparse_int* __restrict__ diag_pos,
+                               rocsparse_int* __restrict__ dia_offset)
+{
+    rocsparse_int idx = hipThreadIdx_x + hipBlockDim_x * hipBlockIdx_x;
+
+    if(idx >= m + n - 1)
+    {
+        return;
+    }
+
+    rocsparse_int prev = (idx > 0) ? diag_pos[idx - 1] : 0;
+
+    if(diag_pos[idx] != prev)
+    {
+        dia_offset[prev] = idx - m + 1;
+    }
+}
+
+// CSR to DIA format conversion kernel
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2dia_kernel(rocsparse_int m,
+                        const T* __restrict__ csr_val,
+                        const rocsparse_int* __restrict__ csr_row_ptr,
+                        const rocsparse_int* __restrict__ csr_col_ind,
+                        rocsparse_index_base idx_base,
+                        const rocsparse_int* __restrict__ diag_pos,
+                        T* __restrict__ dia_val)
+{
+    rocsparse_int row = hipThreadIdx_x + hipBlockDim_x * hipBlockIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int d = diag_pos[csr_col_ind[j] - idx_base - row + m - 1] - 1;
+
+        dia_val[m * d + row] = csr_val[j];
+    }
+}
+
+#endif // CSR2DIA_DEVICE_H
@@ -60,6 +60,53 @@ __launch_bounds__(BLOCKSIZE) __global__ void hyb_coo_nnz(rocsparse_int        m,
     }
 }
 
+// Histogram of the non-zero entries per CSR row. Rows with at least max_width
+// entries are accumulated in the last bin. The first HISTSIZE bins are gathered
+// in shared memory, to avoid contention on the bins of the common row lengths.
+template <unsigned int BLOCKSIZE, unsigned int HISTSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void hyb_row_nnz_histogram(rocsparse_int m,
+                               rocsparse_int max_width,
+                               const rocsparse_int* __restrict__ csr_row_ptr,
+                               rocsparse_int* __restrict__ row_nnz_hist)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+
+    __shared__ rocsparse_int shist[HISTSIZE];
+
+    for(rocsparse_int i = tid; i < HISTSIZE; i += BLOCKSIZE)
+    {
+        shist[i] = 0;
+    }
+
+    __syncthreads();
+
+    if(gid < m)
+    {
+        rocsparse_int bin = min(csr_row_ptr[gid + 1] - csr_row_ptr[gid], max_width);
+
+        if(bin < HISTSIZE)
+        {
+            atomicAdd(&shist[bin], 1);
+        }
+        else
+        {
+            atomicAdd(&row_nnz_hist[bin], 1);
+        }
+    }
+
+    __syncthreads();
+
+    for(rocsparse_int i = tid; i < HISTSIZE && i <= max_width; i += BLOCKSIZE)
+    {
+        if(shist[i] > 0)
+        {
+            atomicAdd(&row_nnz_hist[i], shist[i]);
+        }
+    }
+}
+
 // CSR to HYB format conversion kernel
 template <typename T, unsigned int BLOCKSIZE>
 __launch_bounds__(BLOCKSIZE) __global__ void csr2hyb_kernel(rocsparse_int        m,
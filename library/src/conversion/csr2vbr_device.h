@@ -0,0 +1,368 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef CSR2VBR_DEVICE_H
+#define CSR2VBR_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Maximum number of rows of a detected block row
+#define CSR2VBR_MAX_BLOCK_ROWS 64
+
+// Flag the first row of each block row. Consecutive rows are merged into the same
+// block row, if their sparsity patterns are identical.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2vbr_row_partition_kernel(rocsparse_int m,
+                                      const rocsparse_int* __restrict__ csr_row_ptr,
+                                      const rocsparse_int* __restrict__ csr_col_ind,
+                                      rocsparse_int* __restrict__ row_start)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Bound the height of a block row
+    if(row % CSR2VBR_MAX_BLOCK_ROWS == 0)
+    {
+        row_start[row] = 1;
+        return;
+    }
+
+    rocsparse_int prev_begin = csr_row_ptr[row - 1];
+    rocsparse_int row_begin  = csr_row_ptr[row];
+    rocsparse_int row_end    = csr_row_ptr[row + 1];
+
+    // Rows of different length cannot share the pattern
+    if(row_end - row_begin != row_begin - prev_begin)
+    {
+        row_start[row] = 1;
+        return;
+    }
+
+    rocsparse_int start = 0;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        if(csr_col_ind[j] != csr_col_ind[j - row_begin + prev_begin])
+        {
+            start = 1;
+            break;
+        }
+    }
+
+    row_start[row] = start;
+}
+
+// Flag the first column of each block column. Consecutive columns are merged into
+// the same block column, unless a row contains exactly one of them. Thus, every
+// non-zero block of the resulting partition is dense.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2vbr_col_partition_kernel(rocsparse_int m,
+                                      rocsparse_int n,
+                                      const rocsparse_int* __restrict__ csr_row_ptr,
+                                      const rocsparse_int* __restrict__ csr_col_ind,
+                                      rocsparse_index_base csr_base,
+                                      rocsparse_int* __restrict__ col_start)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row == 0)
+    {
+        col_start[0] = 1;
+    }
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - csr_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - csr_base;
+
+    // Each contiguous run of columns starts and ends a block column
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col = csr_col_ind[j] - csr_base;
+
+        if(j == row_begin || csr_col_ind[j - 1] - csr_base != col - 1)
+        {
+            col_start[col] = 1;
+        }
+
+        if(col + 1 < n && (j == row_end - 1 || csr_col_ind[j + 1] - csr_base != col + 1))
+        {
+            col_start[col + 1] = 1;
+        }
+    }
+}
+
+// Compact the scanned start flags into the partition array
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2vbr_partition_compact_kernel(rocsparse_int size,
+                                          const rocsparse_int* __restrict__ start_scan,
+                                          rocsparse_index_base vbr_base,
+                                          rocsparse_int* __restrict__ vbr_ptn)
+{
+    rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(idx >= size)
+    {
+        return;
+    }
+
+    rocsparse_int block = start_scan[idx];
+
+    if(idx == 0 || block != start_scan[idx - 1])
+    {
+        vbr_ptn[block - 1] = idx + vbr_base;
+    }
+
+    if(idx == size - 1)
+    {
+        vbr_ptn[block] = size + vbr_base;
+    }
+}
+
+// Map each row (or column) to its block row (or block column)
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2vbr_partition_map_kernel(rocsparse_int nblocks,
+                                      const rocsparse_int* __restrict__ vbr_ptn,
+                                      rocsparse_index_base vbr_base,
+                                      rocsparse_int* __restrict__ map)
+{
+    rocsparse_int block = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(block >= nblocks)
+    {
+        return;
+    }
+
+    rocsparse_int begin = vbr_ptn[block] - vbr_base;
+    rocsparse_int end   = vbr_ptn[block + 1] - vbr_base;
+
+    for(rocsparse_int i = begin; i < end; ++i)
+    {
+        map[i] = block;
+    }
+}
+
+// Each segment of WF_SEGMENT_SIZE threads processes a block row, where the segment
+// lanes loop over the rows of the block row. Non-zero block columns are visited in
+// ascending order by searching the first column of each row, that is not part of the
+// current block column. If FILL is false, the number of non-zero blocks and the number
+// of stored values of each block row are computed. Otherwise, the block column indices
+// and the size of each block are written.
+template <unsigned int BLOCKSIZE, unsigned int WF_SEGMENT_SIZE, bool FILL>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2vbr_block_row_kernel(rocsparse_int mb,
+                                  rocsparse_int nb,
+                                  const rocsparse_int* __restrict__ csr_row_ptr,
+                                  const rocsparse_int* __restrict__ csr_col_ind,
+                                  rocsparse_index_base csr_base,
+                                  const rocsparse_int* __restrict__ vbr_row_ptn,
+                                  const rocsparse_int* __restrict__ vbr_col_ptn,
+                                  const rocsparse_int* __restrict__ col_map,
+                                  rocsparse_index_base vbr_base,
+                                  rocsparse_int* __restrict__ vbr_row_ptr,
+                                  rocsparse_int* __restrict__ vbr_col_ind,
+                                  rocsparse_int* __restrict__ vbr_row_nnz,
+                                  rocsparse_int* __restrict__ vbr_val_ptr)
+{
+    rocsparse_int lid = hipThreadIdx_x & (WF_SEGMENT_SIZE - 1);
+    rocsparse_int row = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / WF_SEGMENT_SIZE;
+
+    if(row >= mb)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin  = vbr_row_ptn[row] - vbr_base;
+    rocsparse_int row_end    = vbr_row_ptn[row + 1] - vbr_base;
+    rocsparse_int row_height = row_end - row_begin;
+
+    rocsparse_int offset = FILL ? vbr_row_ptr[row] - vbr_base : 0;
+    rocsparse_int nnzb   = 0;
+    rocsparse_int width  = 0;
+
+    // First column of the current block column
+    rocsparse_int col_begin = 0;
+
+    while(true)
+    {
+        // Find the minimum non-zero block column, starting at col_begin
+        rocsparse_int min_block_col = nb;
+
+        for(rocsparse_int i = row_begin + lid; i < row_end; i += WF_SEGMENT_SIZE)
+        {
+            rocsparse_int begin = csr_row_ptr[i] - csr_base;
+            rocsparse_int end   = csr_row_ptr[i + 1] - csr_base;
+
+            // First entry of the row at or beyond the current block column
+            rocsparse_int j = rocsparse_lower_bound(csr_col_ind, begin, end, col_begin, csr_base);
+
+            if(j < end)
+            {
+                min_block_col = min(min_block_col, col_map[csr_col_ind[j] - csr_base]);
+            }
+        }
+
+        // Last lane of the segment contains the minimum after this call
+        rocsparse_wfreduce_min<WF_SEGMENT_SIZE>(&min_block_col);
+
+        // Broadcast the minimum to all lanes of the segment
+        min_block_col = __shfl(min_block_col, WF_SEGMENT_SIZE - 1, WF_SEGMENT_SIZE);
+
+        if(min_block_col == nb)
+        {
+            break;
+        }
+
+        rocsparse_int block_begin = vbr_col_ptn[min_block_col] - vbr_base;
+        rocsparse_int block_end   = vbr_col_ptn[min_block_col + 1] - vbr_base;
+
+        if(FILL && lid == WF_SEGMENT_SIZE - 1)
+        {
+            vbr_col_ind[offset + nnzb]     = min_block_col + vbr_base;
+            vbr_val_ptr[offset + nnzb + 1] = row_height * (block_end - block_begin);
+        }
+
+        ++nnzb;
+        width += block_end - block_begin;
+
+        col_begin = block_end;
+    }
+
+    if(!FILL && lid == WF_SEGMENT_SIZE - 1)
+    {
+        if(row == 0)
+        {
+            vbr_row_ptr[0] = vbr_base;
+            vbr_row_nnz[0] = 0;
+        }
+
+        vbr_row_ptr[row + 1] = nnzb;
+        vbr_row_nnz[row + 1] = row_height * width;
+    }
+
+    if(FILL && row == 0 && lid == 0)
+    {
+        vbr_val_ptr[0] = vbr_base;
+    }
+}
+
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2vbr_nnz_total_kernel(rocsparse_int mb,
+                                  const rocsparse_int* __restrict__ vbr_row_ptr,
+                                  const rocsparse_int* __restrict__ vbr_row_nnz,
+                                  rocsparse_int* __restrict__ vbr_nnzb,
+                                  rocsparse_int* __restrict__ vbr_nnz)
+{
+    rocsparse_int thread_id = hipThreadIdx_x + hipBlockDim_x * hipBlockIdx_x;
+
+    if(thread_id == 0)
+    {
+        *vbr_nnzb = vbr_row_ptr[mb] - vbr_row_ptr[0];
+        *vbr_nnz  = vbr_row_nnz[mb];
+    }
+}
+
+// Each thread scatters the entries of a CSR row into the dense blocks of its block row
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2vbr_fill_kernel(rocsparse_direction dir,
+                             rocsparse_int       m,
+                             const T* __restrict__ csr_val,
+                             const rocsparse_int* __restrict__ csr_row_ptr,
+                             const rocsparse_int* __restrict__ csr_col_ind,
+                             rocsparse_index_base csr_base,
+                             const rocsparse_int* __restrict__ vbr_row_ptn,
+                             const rocsparse_int* __restrict__ vbr_col_ptn,
+                             const rocsparse_int* __restrict__ row_map,
+                             const rocsparse_int* __restrict__ col_map,
+                             rocsparse_index_base vbr_base,
+                             T* __restrict__ vbr_val,
+                             const rocsparse_int* __restrict__ vbr_val_ptr,
+                             const rocsparse_int* __restrict__ vbr_row_ptr,
+                             const rocsparse_int* __restrict__ vbr_col_ind)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int block_row  = row_map[row];
+    rocsparse_int row_offset = vbr_row_ptn[block_row] - vbr_base;
+    rocsparse_int row_height = vbr_row_ptn[block_row + 1] - vbr_base - row_offset;
+    rocsparse_int local_row  = row - row_offset;
+
+    // Block columns and CSR columns are both sorted, such that the block position
+    // only moves forward
+    rocsparse_int k = vbr_row_ptr[block_row] - vbr_base;
+
+    rocsparse_int row_begin = csr_row_ptr[row] - csr_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - csr_base;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col       = csr_col_ind[j] - csr_base;
+        rocsparse_int block_col = col_map[col];
+
+        while(vbr_col_ind[k] - vbr_base < block_col)
+        {
+            ++k;
+        }
+
+        rocsparse_int col_offset = vbr_col_ptn[block_col] - vbr_base;
+        rocsparse_int col_width  = vbr_col_ptn[block_col + 1] - vbr_base - col_offset;
+        rocsparse_int local_col  = col - col_offset;
+
+        rocsparse_int idx = vbr_val_ptr[k] - vbr_base;
+
+        if(dir == rocsparse_direction_row)
+        {
+            idx += col_width * local_row + local_col;
+        }
+        else
+        {
+            idx += row_height * local_col + local_row;
+        }
+
+        vbr_val[idx] = csr_val[j];
+    }
+}
+
+#endif // CSR2VBR_DEVICE_H
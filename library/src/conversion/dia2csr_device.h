@@ -0,0 +1,114 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef DIA2CSR_DEVICE_H
+#define DIA2CSR_DEVICE_H
+
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+// Each thread counts the diagonals that intersect a row of the matrix
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void dia2csr_nnz_per_row(rocsparse_int m,
+                             rocsparse_int n,
+                             rocsparse_int dia_num_diag,
+                             const rocsparse_int* __restrict__ dia_offset,
+                             rocsparse_int* __restrict__ csr_row_ptr,
+                             rocsparse_index_base csr_base)
+{
+    rocsparse_int ai = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    if(ai == 0)
+    {
+        csr_row_ptr[0] = csr_base;
+    }
+
+    rocsparse_int nnz = 0;
+
+    for(rocsparse_int d = 0; d < dia_num_diag; ++d)
+    {
+        rocsparse_int col = ai + dia_offset[d];
+
+        if(col >= 0 && col < n)
+        {
+            ++nnz;
+        }
+    }
+
+    csr_row_ptr[ai + 1] = nnz;
+}
+
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void dia2csr_nnz_total(rocsparse_int m,
+                           const rocsparse_int* __restrict__ csr_row_ptr,
+                           rocsparse_int* __restrict__ csr_nnz)
+{
+    *csr_nnz = csr_row_ptr[m] - csr_row_ptr[0];
+}
+
+// Each thread gathers the entries of a row from the diagonals. Diagonal offsets are
+// sorted, thus columns are written in increasing order.
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void dia2csr_fill(rocsparse_int m,
+                      rocsparse_int n,
+                      rocsparse_int dia_num_diag,
+                      const T* __restrict__ dia_val,
+                      const rocsparse_int* __restrict__ dia_offset,
+                      const rocsparse_int* __restrict__ csr_row_ptr,
+                      rocsparse_int* __restrict__ csr_col_ind,
+                      T* __restrict__ csr_val,
+                      rocsparse_index_base csr_base)
+{
+    rocsparse_int ai = BLOCKSIZE * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    rocsparse_int csr_idx = csr_row_ptr[ai] - csr_base;
+
+    for(rocsparse_int d = 0; d < dia_num_diag; ++d)
+    {
+        rocsparse_int col = ai + dia_offset[d];
+
+        if(col >= 0 && col < n)
+        {
+            csr_col_ind[csr_idx] = col + csr_base;
+            csr_val[csr_idx]     = dia_val[m * d + ai];
+            ++csr_idx;
+        }
+    }
+}
+
+#endif // DIA2CSR_DEVICE_H
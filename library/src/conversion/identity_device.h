@@ -28,10 +28,10 @@
 #include <hip/hip_runtime.h>
 
 // Create identity permutation
-template <unsigned int BLOCKSIZE>
-__launch_bounds__(BLOCKSIZE) __global__ void identity_kernel(rocsparse_int n, rocsparse_int* p)
+template <typename I, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void identity_kernel(I n, I* p)
 {
-    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    I gid = static_cast<I>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
 
     if(gid >= n)
     {
@@ -22,11 +22,13 @@
  * ************************************************************************ */
 #include "rocsparse.h"
 
-#include "coo2csr_device.h"
-#include "handle.h"
-#include "utility.h"
+#include "rocsparse_coo2csr.hpp"
 
-#include <hip/hip_runtime.h>
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
 
 extern "C" rocsparse_status rocsparse_coo2csr(rocsparse_handle     handle,
                                               const rocsparse_int* coo_row_ind,
@@ -35,66 +37,15 @@ extern "C" rocsparse_status rocsparse_coo2csr(rocsparse_handle     handle,
                                               rocsparse_int*       csr_row_ptr,
                                               rocsparse_index_base idx_base)
 {
-    // Check for valid handle
-    if(handle == nullptr)
-    {
-        return rocsparse_status_invalid_handle;
-    }
-
-    // Logging
-    log_trace(handle,
-              "rocsparse_coo2csr",
-              (const void*&)coo_row_ind,
-              nnz,
-              m,
-              (const void*&)csr_row_ptr,
-              idx_base);
-
-    log_bench(handle, "./rocsparse-bench -f coo2csr", "--mtx <matrix.mtx>");
-
-    // Check sizes
-    if(nnz < 0)
-    {
-        return rocsparse_status_invalid_size;
-    }
-    else if(m < 0)
-    {
-        return rocsparse_status_invalid_size;
-    }
-
-    // Quick return if possible
-    if(nnz == 0 || m == 0)
-    {
-        return rocsparse_status_success;
-    }
-
-    // Check pointer arguments
-    if(coo_row_ind == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(csr_row_ptr == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-
-    // Stream
-    hipStream_t stream = handle->stream;
-
-#define COO2CSR_DIM 512
-    dim3 coo2csr_blocks((m - 1) / COO2CSR_DIM + 1);
-    dim3 coo2csr_threads(COO2CSR_DIM);
+    return rocsparse_coo2csr_template(handle, coo_row_ind, nnz, m, csr_row_ptr, idx_base);
+}
 
-    hipLaunchKernelGGL((coo2csr_kernel<COO2CSR_DIM>),
-                       coo2csr_blocks,
-                       coo2csr_threads,
-                       0,
-                       stream,
-                       m,
-                       nnz,
-                       coo_row_ind,
-                       csr_row_ptr,
-                       idx_base);
-#undef COO2CSR_DIM
-    return rocsparse_status_success;
+extern "C" rocsparse_status rocsparse_coo2csr_i64(rocsparse_handle     handle,
+                                                  const int32_t*       coo_row_ind,
+                                                  int64_t              nnz,
+                                                  int32_t              m,
+                                                  int64_t*             csr_row_ptr,
+                                                  rocsparse_index_base idx_base)
+{
+    return rocsparse_coo2csr_template(handle, coo_row_ind, nnz, m, csr_row_ptr, idx_base);
 }
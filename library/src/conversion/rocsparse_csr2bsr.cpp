@@ -304,6 +304,7 @@ extern "C" rocsparse_status rocsparse_csr2bsr_nnz(rocsparse_handle          hand
         void* temp_storage_ptr = nullptr;
         if(handle->buffer_size >= buffer_size)
         {
+            RETURN_IF_ROCSPARSE_ERROR(handle->alloc_buffer());
             temp_storage_ptr = handle->buffer;
             temp_alloc       = false;
         }
@@ -349,6 +350,7 @@ extern "C" rocsparse_status rocsparse_csr2bsr_nnz(rocsparse_handle          hand
     void* temp_storage_ptr = nullptr;
     if(handle->buffer_size >= temp_storage_size_bytes)
     {
+        RETURN_IF_ROCSPARSE_ERROR(handle->alloc_buffer());
         temp_storage_ptr = handle->buffer;
         temp_alloc       = false;
     }
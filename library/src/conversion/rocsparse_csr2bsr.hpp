@@ -364,6 +364,7 @@ rocsparse_status rocsparse_csr2bsr_template(rocsparse_handle          handle,
         void* temp_storage_ptr = nullptr;
         if(handle->buffer_size >= buffer_size)
         {
+            RETURN_IF_ROCSPARSE_ERROR(handle->alloc_buffer());
             temp_storage_ptr = handle->buffer;
             temp_alloc       = false;
         }
@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse.h"
+
+#include "rocsparse_csr2bsr_block_dim_analysis.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status
+    rocsparse_scsr2bsr_block_dim_analysis(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          const rocsparse_mat_descr csr_descr,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          rocsparse_int             num_block_dims,
+                                          const rocsparse_int*      block_dims,
+                                          rocsparse_int             sample_size,
+                                          rocsparse_int*            bsr_nnzb,
+                                          float*                    fill_ratio,
+                                          float*                    bsrmv_cost)
+{
+    return rocsparse_csr2bsr_block_dim_analysis_template<float>(handle,
+                                                                m,
+                                                                n,
+                                                                csr_descr,
+                                                                csr_row_ptr,
+                                                                csr_col_ind,
+                                                                num_block_dims,
+                                                                block_dims,
+                                                                sample_size,
+                                                                bsr_nnzb,
+                                                                fill_ratio,
+                                                                bsrmv_cost);
+}
+
+extern "C" rocsparse_status
+    rocsparse_dcsr2bsr_block_dim_analysis(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          const rocsparse_mat_descr csr_descr,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          rocsparse_int             num_block_dims,
+                                          const rocsparse_int*      block_dims,
+                                          rocsparse_int             sample_size,
+                                          rocsparse_int*            bsr_nnzb,
+                                          float*                    fill_ratio,
+                                          float*                    bsrmv_cost)
+{
+    return rocsparse_csr2bsr_block_dim_analysis_template<double>(handle,
+                                                                 m,
+                                                                 n,
+                                                                 csr_descr,
+                                                                 csr_row_ptr,
+                                                                 csr_col_ind,
+                                                                 num_block_dims,
+                                                                 block_dims,
+                                                                 sample_size,
+                                                                 bsr_nnzb,
+                                                                 fill_ratio,
+                                                                 bsrmv_cost);
+}
+
+extern "C" rocsparse_status
+    rocsparse_ccsr2bsr_block_dim_analysis(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          const rocsparse_mat_descr csr_descr,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          rocsparse_int             num_block_dims,
+                                          const rocsparse_int*      block_dims,
+                                          rocsparse_int             sample_size,
+                                          rocsparse_int*            bsr_nnzb,
+                                          float*                    fill_ratio,
+                                          float*                    bsrmv_cost)
+{
+    return rocsparse_csr2bsr_block_dim_analysis_template<rocsparse_float_complex>(handle,
+                                                                                  m,
+                                                                                  n,
+                                                                                  csr_descr,
+                                                                                  csr_row_ptr,
+                                                                                  csr_col_ind,
+                                                                                  num_block_dims,
+                                                                                  block_dims,
+                                                                                  sample_size,
+                                                                                  bsr_nnzb,
+                                                                                  fill_ratio,
+                                                                                  bsrmv_cost);
+}
+
+extern "C" rocsparse_status
+    rocsparse_zcsr2bsr_block_dim_analysis(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          const rocsparse_mat_descr csr_descr,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          rocsparse_int             num_block_dims,
+                                          const rocsparse_int*      block_dims,
+                                          rocsparse_int             sample_size,
+                                          rocsparse_int*            bsr_nnzb,
+                                          float*                    fill_ratio,
+                                          float*                    bsrmv_cost)
+{
+    return rocsparse_csr2bsr_block_dim_analysis_template<rocsparse_double_complex>(handle,
+                                                                                   m,
+                                                                                   n,
+                                                                                   csr_descr,
+                                                                                   csr_row_ptr,
+                                                                                   csr_col_ind,
+                                                                                   num_block_dims,
+                                                                                   block_dims,
+                                                                                   sample_size,
+                                                                                   bsr_nnzb,
+                                                                                   fill_ratio,
+                                                                                   bsrmv_cost);
+}
@@ -0,0 +1,383 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROCSPARSE_CSR2BSR_BLOCK_DIM_ANALYSIS_HPP
+#define ROCSPARSE_CSR2BSR_BLOCK_DIM_ANALYSIS_HPP
+
+#include "../level2/rocsparse_bsrmv.hpp"
+#include "csr2bsr_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <cmath>
+#include <hip/hip_runtime.h>
+#include <vector>
+
+// Segment sizes of the sampling kernel
+using csr2bsr_sample_segment_sizes = rocsparse_value_list<4, 8, 16, 32, 64>;
+
+// Segment size of the sampling kernel, such that a segment covers the rows of a block row
+static inline rocsparse_int csr2bsr_sample_segment_size(rocsparse_int block_dim,
+                                                        rocsparse_int wavefront_size)
+{
+    rocsparse_int segment_size = 4;
+
+    while(segment_size < block_dim && segment_size < wavefront_size)
+    {
+        segment_size <<= 1;
+    }
+
+    return segment_size;
+}
+
+// Fraction of active lanes of the bsrmv kernel that the block dimension dispatches to
+static inline double csr2bsr_bsrmv_utilization(rocsparse_direction dir,
+                                               rocsparse_int       mb,
+                                               rocsparse_int       nnzb,
+                                               rocsparse_int       block_dim,
+                                               rocsparse_int       wavefront_size)
+{
+    rocsparse_int blocks_per_row = nnzb / mb;
+
+    if(block_dim <= 4)
+    {
+        // A sub-wavefront processes a block row, with a lane per block
+        rocsparse_int wfsize = bsrmvn_small_wfsize(blocks_per_row, wavefront_size);
+
+        return static_cast<double>(std::min(std::max(blocks_per_row, 1), wfsize)) / wfsize;
+    }
+    else if(block_dim <= 32)
+    {
+        // A thread block processes a block row, with a lane per block entry
+        rocsparse_int nblocks = bsrmvn_NxN_blocks(block_dim);
+
+        return static_cast<double>(std::min(std::max(blocks_per_row, 1), nblocks)) / nblocks;
+    }
+
+    // Tiled kernel, where each pass of the thread block covers rows x cols entries
+    rocsparse_int nwf = 256 / wavefront_size;
+    rocsparse_int rows;
+    rocsparse_int cols;
+
+    if(dir == rocsparse_direction_row)
+    {
+        rows = nwf * bsrmvn_tiled_row_tile(block_dim, nwf);
+        cols = wavefront_size;
+    }
+    else
+    {
+        rows = wavefront_size * bsrmvn_tiled_column_tile(block_dim, wavefront_size);
+        cols = nwf;
+    }
+
+    return static_cast<double>(block_dim) / (((block_dim - 1) / rows + 1) * rows)
+           * block_dim / (((block_dim - 1) / cols + 1) * cols);
+}
+
+// Predicted bsrmv cost relative to csrmv. The memory traffic of bsrmv, including the
+// zero fill of the blocks, is scaled by the fraction of idle lanes of the bsrmv kernel
+// and divided by the memory traffic of csrmv.
+template <typename T>
+static inline double csr2bsr_bsrmv_cost(rocsparse_direction dir,
+                                        rocsparse_int       m,
+                                        rocsparse_int       n,
+                                        rocsparse_int       nnz,
+                                        rocsparse_int       mb,
+                                        rocsparse_int       nb,
+                                        rocsparse_int       nnzb,
+                                        rocsparse_int       block_dim,
+                                        rocsparse_int       wavefront_size)
+{
+    // bsrmv falls back to csrmv
+    if(block_dim == 1 || nnz == 0)
+    {
+        return 1.0;
+    }
+
+    double csr_bytes = (m + 1.0 + nnz) * sizeof(rocsparse_int) + (m + n + nnz) * sizeof(T);
+    double bsr_bytes = (mb + 1.0 + nnzb) * sizeof(rocsparse_int)
+                       + ((mb + nb) * static_cast<double>(block_dim)
+                          + static_cast<double>(nnzb) * block_dim * block_dim)
+                             * sizeof(T);
+
+    return bsr_bytes / csr2bsr_bsrmv_utilization(dir, mb, nnzb, block_dim, wavefront_size)
+           / csr_bytes;
+}
+
+template <typename T>
+rocsparse_status
+    rocsparse_csr2bsr_block_dim_analysis_template(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             n,
+                                                  const rocsparse_mat_descr csr_descr,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_int             num_block_dims,
+                                                  const rocsparse_int*      block_dims,
+                                                  rocsparse_int             sample_size,
+                                                  rocsparse_int*            bsr_nnzb,
+                                                  float*                    fill_ratio,
+                                                  float*                    bsrmv_cost)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2bsr_block_dim_analysis"),
+              m,
+              n,
+              csr_descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              num_block_dims,
+              (const void*&)block_dims,
+              sample_size,
+              (const void*&)bsr_nnzb,
+              (const void*&)fill_ratio,
+              (const void*&)bsrmv_cost);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csr2bsr_block_dim_analysis -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> --sizennz",
+              sample_size);
+
+    // Check index base
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || num_block_dims < 0 || sample_size < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(num_block_dims == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check host arrays, they are required even if the matrix is empty
+    if(block_dims == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_nnzb == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(fill_ratio == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsrmv_cost == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    for(rocsparse_int i = 0; i < num_block_dims; ++i)
+    {
+        if(block_dims[i] <= 0)
+        {
+            return rocsparse_status_invalid_size;
+        }
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        for(rocsparse_int i = 0; i < num_block_dims; ++i)
+        {
+            bsr_nnzb[i]           = 0;
+            fill_ratio[i]         = 1.0f;
+            bsrmv_cost[2 * i]     = 1.0f;
+            bsrmv_cost[2 * i + 1] = 1.0f;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    static constexpr unsigned int CSR2BSR_DIM = 256;
+
+    // Temporary storage for the block and entry counts of the samples of each block dimension
+    size_t buffer_size = sizeof(rocsparse_int) * 2 * num_block_dims;
+
+    bool  temp_alloc       = false;
+    void* temp_storage_ptr = nullptr;
+    if(handle->buffer_size >= buffer_size)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->alloc_buffer());
+        temp_storage_ptr = handle->buffer;
+        temp_alloc       = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, buffer_size));
+        temp_alloc = true;
+    }
+
+    rocsparse_int* sample_counts = reinterpret_cast<rocsparse_int*>(temp_storage_ptr);
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(sample_counts, 0, buffer_size, stream));
+
+    for(rocsparse_int i = 0; i < num_block_dims; ++i)
+    {
+        rocsparse_int block_dim = block_dims[i];
+        rocsparse_int mb        = (m + block_dim - 1) / block_dim;
+        rocsparse_int nb        = (n + block_dim - 1) / block_dim;
+
+        // Block rows to sample, all block rows if sample size is zero
+        rocsparse_int samples = (sample_size == 0) ? mb : std::min(sample_size, mb);
+
+        rocsparse_int segment_size
+            = csr2bsr_sample_segment_size(block_dim, handle->wavefront_size);
+
+        bool launched = rocsparse_dispatch_value(
+            segment_size, csr2bsr_sample_segment_sizes{}, [&](auto s) {
+                constexpr unsigned int SEGMENT = decltype(s)::value;
+
+                hipLaunchKernelGGL((csr2bsr_nnz_sample_kernel<CSR2BSR_DIM, SEGMENT>),
+                                   dim3((samples - 1) / (CSR2BSR_DIM / SEGMENT) + 1),
+                                   dim3(CSR2BSR_DIM),
+                                   0,
+                                   stream,
+                                   m,
+                                   mb,
+                                   nb,
+                                   block_dim,
+                                   samples,
+                                   csr_descr->base,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   sample_counts + 2 * i,
+                                   sample_counts + 2 * i + 1);
+            });
+
+        if(!launched)
+        {
+            if(temp_alloc)
+            {
+                RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+            }
+
+            return rocsparse_status_arch_mismatch;
+        }
+    }
+
+    // Copy the sample counts and the total number of entries to the host
+    std::vector<rocsparse_int> hsample_counts(2 * num_block_dims);
+    rocsparse_int              csr_row_ptr_bounds[2];
+
+    RETURN_IF_HIP_ERROR(hipMemcpy(
+        hsample_counts.data(), sample_counts, buffer_size, hipMemcpyDeviceToHost));
+    RETURN_IF_HIP_ERROR(hipMemcpy(
+        &csr_row_ptr_bounds[0], csr_row_ptr, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+    RETURN_IF_HIP_ERROR(hipMemcpy(
+        &csr_row_ptr_bounds[1], csr_row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+    rocsparse_int nnz = csr_row_ptr_bounds[1] - csr_row_ptr_bounds[0];
+
+    for(rocsparse_int i = 0; i < num_block_dims; ++i)
+    {
+        rocsparse_int block_dim   = block_dims[i];
+        rocsparse_int mb          = (m + block_dim - 1) / block_dim;
+        rocsparse_int nb          = (n + block_dim - 1) / block_dim;
+        rocsparse_int sample_nnzb = hsample_counts[2 * i];
+        rocsparse_int sample_nnz  = hsample_counts[2 * i + 1];
+
+        // Extrapolate the number of blocks from the entries covered by the samples
+        rocsparse_int nnzb = sample_nnzb;
+
+        if(sample_nnz > 0 && sample_nnz < nnz)
+        {
+            double scale = static_cast<double>(nnz) / sample_nnz;
+
+            nnzb = static_cast<rocsparse_int>(std::min(
+                std::round(sample_nnzb * scale), static_cast<double>(mb) * nb));
+            nnzb = std::min(nnzb, nnz);
+        }
+
+        bsr_nnzb[i]   = nnzb;
+        fill_ratio[i] = (nnz > 0)
+                            ? static_cast<float>(static_cast<double>(nnzb) * block_dim
+                                                 * block_dim / nnz)
+                            : 1.0f;
+
+        bsrmv_cost[2 * i + rocsparse_direction_row] = csr2bsr_bsrmv_cost<T>(
+            rocsparse_direction_row, m, n, nnz, mb, nb, nnzb, block_dim, handle->wavefront_size);
+        bsrmv_cost[2 * i + rocsparse_direction_column]
+            = csr2bsr_bsrmv_cost<T>(rocsparse_direction_column,
+                                    m,
+                                    n,
+                                    nnz,
+                                    mb,
+                                    nb,
+                                    nnzb,
+                                    block_dim,
+                                    handle->wavefront_size);
+    }
+
+    if(temp_alloc)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSR2BSR_BLOCK_DIM_ANALYSIS_HPP
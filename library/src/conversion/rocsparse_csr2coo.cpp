@@ -22,11 +22,13 @@
  * ************************************************************************ */
 #include "rocsparse.h"
 
-#include "csr2coo_device.h"
-#include "handle.h"
-#include "utility.h"
+#include "rocsparse_csr2coo.hpp"
 
-#include <hip/hip_runtime.h>
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
 
 extern "C" rocsparse_status rocsparse_csr2coo(rocsparse_handle     handle,
                                               const rocsparse_int* csr_row_ptr,
@@ -35,200 +37,15 @@ extern "C" rocsparse_status rocsparse_csr2coo(rocsparse_handle     handle,
                                               rocsparse_int*       coo_row_ind,
                                               rocsparse_index_base idx_base)
 {
-    // Check for valid handle
-    if(handle == nullptr)
-    {
-        return rocsparse_status_invalid_handle;
-    }
-
-    // Logging TODO bench logging
-    log_trace(handle,
-              "rocsparse_csr2coo",
-              (const void*&)csr_row_ptr,
-              nnz,
-              m,
-              (const void*&)coo_row_ind,
-              idx_base);
-
-    log_bench(handle, "./rocsparse-bench -f csr2coo ", "--mtx <matrix.mtx>");
-
-    // Check sizes
-    if(nnz < 0)
-    {
-        return rocsparse_status_invalid_size;
-    }
-    else if(m < 0)
-    {
-        return rocsparse_status_invalid_size;
-    }
-
-    // Check pointer arguments
-    if(csr_row_ptr == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(coo_row_ind == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-
-    // Quick return if possible
-    if(nnz == 0 || m == 0)
-    {
-        return rocsparse_status_success;
-    }
-
-    // Stream
-    hipStream_t stream = handle->stream;
-
-#define CSR2COO_DIM 512
-    rocsparse_int nnz_per_row = nnz / m;
-
-    dim3 csr2coo_blocks((m - 1) / CSR2COO_DIM + 1);
-    dim3 csr2coo_threads(CSR2COO_DIM);
+    return rocsparse_csr2coo_template(handle, csr_row_ptr, nnz, m, coo_row_ind, idx_base);
+}
 
-    if(handle->wavefront_size == 32)
-    {
-        if(nnz_per_row < 4)
-        {
-            hipLaunchKernelGGL((csr2coo_kernel<CSR2COO_DIM, 2>),
-                               csr2coo_blocks,
-                               csr2coo_threads,
-                               0,
-                               stream,
-                               m,
-                               csr_row_ptr,
-                               coo_row_ind,
-                               idx_base);
-        }
-        else if(nnz_per_row < 8)
-        {
-            hipLaunchKernelGGL((csr2coo_kernel<CSR2COO_DIM, 4>),
-                               csr2coo_blocks,
-                               csr2coo_threads,
-                               0,
-                               stream,
-                               m,
-                               csr_row_ptr,
-                               coo_row_ind,
-                               idx_base);
-        }
-        else if(nnz_per_row < 16)
-        {
-            hipLaunchKernelGGL((csr2coo_kernel<CSR2COO_DIM, 8>),
-                               csr2coo_blocks,
-                               csr2coo_threads,
-                               0,
-                               stream,
-                               m,
-                               csr_row_ptr,
-                               coo_row_ind,
-                               idx_base);
-        }
-        else if(nnz_per_row < 32)
-        {
-            hipLaunchKernelGGL((csr2coo_kernel<CSR2COO_DIM, 16>),
-                               csr2coo_blocks,
-                               csr2coo_threads,
-                               0,
-                               stream,
-                               m,
-                               csr_row_ptr,
-                               coo_row_ind,
-                               idx_base);
-        }
-        else
-        {
-            hipLaunchKernelGGL((csr2coo_kernel<CSR2COO_DIM, 32>),
-                               csr2coo_blocks,
-                               csr2coo_threads,
-                               0,
-                               stream,
-                               m,
-                               csr_row_ptr,
-                               coo_row_ind,
-                               idx_base);
-        }
-    }
-    else if(handle->wavefront_size == 64)
-    {
-        if(nnz_per_row < 4)
-        {
-            hipLaunchKernelGGL((csr2coo_kernel<CSR2COO_DIM, 2>),
-                               csr2coo_blocks,
-                               csr2coo_threads,
-                               0,
-                               stream,
-                               m,
-                               csr_row_ptr,
-                               coo_row_ind,
-                               idx_base);
-        }
-        else if(nnz_per_row < 8)
-        {
-            hipLaunchKernelGGL((csr2coo_kernel<CSR2COO_DIM, 4>),
-                               csr2coo_blocks,
-                               csr2coo_threads,
-                               0,
-                               stream,
-                               m,
-                               csr_row_ptr,
-                               coo_row_ind,
-                               idx_base);
-        }
-        else if(nnz_per_row < 16)
-        {
-            hipLaunchKernelGGL((csr2coo_kernel<CSR2COO_DIM, 8>),
-                               csr2coo_blocks,
-                               csr2coo_threads,
-                               0,
-                               stream,
-                               m,
-                               csr_row_ptr,
-                               coo_row_ind,
-                               idx_base);
-        }
-        else if(nnz_per_row < 32)
-        {
-            hipLaunchKernelGGL((csr2coo_kernel<CSR2COO_DIM, 16>),
-                               csr2coo_blocks,
-                               csr2coo_threads,
-                               0,
-                               stream,
-                               m,
-                               csr_row_ptr,
-                               coo_row_ind,
-                               idx_base);
-        }
-        else if(nnz_per_row < 64)
-        {
-            hipLaunchKernelGGL((csr2coo_kernel<CSR2COO_DIM, 32>),
-                               csr2coo_blocks,
-                               csr2coo_threads,
-                               0,
-                               stream,
-                               m,
-                               csr_row_ptr,
-                               coo_row_ind,
-                               idx_base);
-        }
-        else
-        {
-            hipLaunchKernelGGL((csr2coo_kernel<CSR2COO_DIM, 64>),
-                               csr2coo_blocks,
-                               csr2coo_threads,
-                               0,
-                               stream,
-                               m,
-                               csr_row_ptr,
-                               coo_row_ind,
-                               idx_base);
-        }
-    }
-    else
-    {
-        return rocsparse_status_arch_mismatch;
-    }
-#undef CSR2COO_DIM
-    return rocsparse_status_success;
+extern "C" rocsparse_status rocsparse_csr2coo_i64(rocsparse_handle     handle,
+                                                  const int64_t*       csr_row_ptr,
+                                                  int64_t              nnz,
+                                                  int32_t              m,
+                                                  int32_t*             coo_row_ind,
+                                                  rocsparse_index_base idx_base)
+{
+    return rocsparse_csr2coo_template(handle, csr_row_ptr, nnz, m, coo_row_ind, idx_base);
 }
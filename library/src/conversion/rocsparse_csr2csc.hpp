@@ -29,22 +29,129 @@
 #include "definitions.h"
 #include "handle.h"
 #include "rocsparse.h"
+#include "rocsparse_coo2csr.hpp"
+#include "rocsparse_csr2coo.hpp"
+#include "rocsparse_identity.hpp"
 #include "utility.h"
 
 #include <hip/hip_runtime.h>
 #include <rocprim/rocprim.hpp>
 
-template <typename T>
+template <typename I, typename J>
+rocsparse_status rocsparse_csr2csc_buffer_size_template(rocsparse_handle handle,
+                                                        J                m,
+                                                        J                n,
+                                                        I                nnz,
+                                                        const I*         csr_row_ptr,
+                                                        const J*         csr_col_ind,
+                                                        rocsparse_action copy_values,
+                                                        size_t*          buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              appendIJ<I, J>("rocsparse_csr2csc_buffer_size"),
+              m,
+              n,
+              nnz,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              copy_values,
+              (const void*&)buffer_size);
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check buffer size argument
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    hipStream_t stream = handle->stream;
+
+    // Determine rocprim buffer size, column indices are sorted as keys of type J,
+    // the permutation (numeric) or the row indices (symbolic) are carried along
+    J* keys = reinterpret_cast<J*>(buffer_size);
+    I* perm = reinterpret_cast<I*>(buffer_size);
+
+    rocprim::double_buffer<J> dummy_keys(keys, keys);
+
+    if(copy_values == rocsparse_action_numeric)
+    {
+        rocprim::double_buffer<I> dummy_vals(perm, perm);
+
+        RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+            nullptr, *buffer_size, dummy_keys, dummy_vals, nnz, 0, 32, stream));
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+            nullptr, *buffer_size, dummy_keys, dummy_keys, nnz, 0, 32, stream));
+    }
+
+    *buffer_size = ((*buffer_size - 1) / 256 + 1) * 256;
+
+    // rocPRIM does not support in-place sorting, so we need additional buffer
+    // for all temporary arrays
+    *buffer_size += sizeof(J) * ((nnz - 1) / 256 + 1) * 256;
+    *buffer_size += sizeof(I) * ((nnz - 1) / 256 + 1) * 256;
+    *buffer_size += sizeof(I) * ((nnz - 1) / 256 + 1) * 256;
+
+    // Do not return 0 as size
+    if(*buffer_size == 0)
+    {
+        *buffer_size = 4;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csr2csc_template(rocsparse_handle     handle,
-                                            rocsparse_int        m,
-                                            rocsparse_int        n,
-                                            rocsparse_int        nnz,
+                                            J                    m,
+                                            J                    n,
+                                            I                    nnz,
                                             const T*             csr_val,
-                                            const rocsparse_int* csr_row_ptr,
-                                            const rocsparse_int* csr_col_ind,
+                                            const I*             csr_row_ptr,
+                                            const J*             csr_col_ind,
                                             T*                   csc_val,
-                                            rocsparse_int*       csc_row_ind,
-                                            rocsparse_int*       csc_col_ptr,
+                                            J*                   csc_row_ind,
+                                            I*                   csc_col_ptr,
                                             rocsparse_action     copy_values,
                                             rocsparse_index_base idx_base,
                                             void*                temp_buffer)
@@ -57,7 +164,7 @@ rocsparse_status rocsparse_csr2csc_template(rocsparse_handle     handle,
 
     // Logging
     log_trace(handle,
-              replaceX<T>("rocsparse_Xcsr2csc"),
+              appendIJ<I, J>(replaceX<T>("rocsparse_Xcsr2csc")),
               m,
               n,
               nnz,
@@ -71,7 +178,10 @@ rocsparse_status rocsparse_csr2csc_template(rocsparse_handle     handle,
               idx_base,
               (const void*&)temp_buffer);
 
-    log_bench(handle, "./rocsparse-bench -f csr2csc -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+    log_bench(handle,
+              appendIJ<I, J>("./rocsparse-bench -f csr2csc") + " -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx>");
 
     // Check index base
     if(idx_base != rocsparse_index_base_zero && idx_base != rocsparse_index_base_one)
@@ -131,23 +241,23 @@ rocsparse_status rocsparse_csr2csc_template(rocsparse_handle     handle,
     char* ptr = reinterpret_cast<char*>(temp_buffer);
 
     // work1 buffer
-    rocsparse_int* tmp_work1 = reinterpret_cast<rocsparse_int*>(ptr);
-    ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+    J* tmp_work1 = reinterpret_cast<J*>(ptr);
+    ptr += sizeof(J) * ((nnz - 1) / 256 + 1) * 256;
 
     // work2 buffer
-    rocsparse_int* tmp_work2 = reinterpret_cast<rocsparse_int*>(ptr);
-    ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+    I* tmp_work2 = reinterpret_cast<I*>(ptr);
+    ptr += sizeof(I) * ((nnz - 1) / 256 + 1) * 256;
 
     // perm buffer
-    rocsparse_int* tmp_perm = reinterpret_cast<rocsparse_int*>(ptr);
-    ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+    I* tmp_perm = reinterpret_cast<I*>(ptr);
+    ptr += sizeof(I) * ((nnz - 1) / 256 + 1) * 256;
 
     // rocprim buffer
     void* tmp_rocprim = reinterpret_cast<void*>(ptr);
 
     // Load CSR column indices into work1 buffer
     RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        tmp_work1, csr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToDevice, stream));
+        tmp_work1, csr_col_ind, sizeof(J) * nnz, hipMemcpyDeviceToDevice, stream));
 
     if(copy_values == rocsparse_action_symbolic)
     {
@@ -155,10 +265,11 @@ rocsparse_status rocsparse_csr2csc_template(rocsparse_handle     handle,
 
         // Create row indices
         RETURN_IF_ROCSPARSE_ERROR(
-            rocsparse_csr2coo(handle, csr_row_ptr, nnz, m, csc_row_ind, idx_base));
-        // Stable sort COO by columns
-        rocprim::double_buffer<rocsparse_int> keys(tmp_work1, tmp_perm);
-        rocprim::double_buffer<rocsparse_int> vals(csc_row_ind, tmp_work2);
+            rocsparse_csr2coo_template(handle, csr_row_ptr, nnz, m, csc_row_ind, idx_base));
+        // Stable sort COO by columns, the second halves of the key and value double
+        // buffers re-use the perm and work2 buffers, which are at least of size J
+        rocprim::double_buffer<J> keys(tmp_work1, reinterpret_cast<J*>(tmp_perm));
+        rocprim::double_buffer<J> vals(csc_row_ind, reinterpret_cast<J*>(tmp_work2));
 
         size_t size = 0;
 
@@ -169,14 +280,14 @@ rocsparse_status rocsparse_csr2csc_template(rocsparse_handle     handle,
 
         // Create column pointers
         RETURN_IF_ROCSPARSE_ERROR(
-            rocsparse_coo2csr(handle, keys.current(), nnz, n, csc_col_ptr, idx_base));
+            rocsparse_coo2csr_template(handle, keys.current(), nnz, n, csc_col_ptr, idx_base));
 
         // Copy csc_row_ind if not current
         if(vals.current() != csc_row_ind)
         {
             RETURN_IF_HIP_ERROR(hipMemcpyAsync(csc_row_ind,
                                                vals.current(),
-                                               sizeof(rocsparse_int) * nnz,
+                                               sizeof(J) * nnz,
                                                hipMemcpyDeviceToDevice,
                                                stream));
         }
@@ -186,11 +297,12 @@ rocsparse_status rocsparse_csr2csc_template(rocsparse_handle     handle,
         // action numeric
 
         // Create identitiy permutation
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, nnz, tmp_perm));
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_create_identity_permutation_template(handle, nnz, tmp_perm));
 
         // Stable sort COO by columns
-        rocprim::double_buffer<rocsparse_int> keys(tmp_work1, csc_row_ind);
-        rocprim::double_buffer<rocsparse_int> vals(tmp_perm, tmp_work2);
+        rocprim::double_buffer<J> keys(tmp_work1, csc_row_ind);
+        rocprim::double_buffer<I> vals(tmp_perm, tmp_work2);
 
         size_t size = 0;
 
@@ -201,18 +313,18 @@ rocsparse_status rocsparse_csr2csc_template(rocsparse_handle     handle,
 
         // Create column pointers
         RETURN_IF_ROCSPARSE_ERROR(
-            rocsparse_coo2csr(handle, keys.current(), nnz, n, csc_col_ptr, idx_base));
+            rocsparse_coo2csr_template(handle, keys.current(), nnz, n, csc_col_ptr, idx_base));
 
         // Create row indices
         RETURN_IF_ROCSPARSE_ERROR(
-            rocsparse_csr2coo(handle, csr_row_ptr, nnz, m, tmp_work1, idx_base));
+            rocsparse_csr2coo_template(handle, csr_row_ptr, nnz, m, tmp_work1, idx_base));
 
 // Permute row indices and values
 #define CSR2CSC_DIM 512
         dim3 csr2csc_blocks((nnz - 1) / CSR2CSC_DIM + 1);
         dim3 csr2csc_threads(CSR2CSC_DIM);
 
-        hipLaunchKernelGGL((csr2csc_permute_kernel<T, CSR2CSC_DIM>),
+        hipLaunchKernelGGL((csr2csc_permute_kernel<I, J, T, CSR2CSC_DIM>),
                            csr2csc_blocks,
                            csr2csc_threads,
                            0,
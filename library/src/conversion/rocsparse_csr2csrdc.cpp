@@ -0,0 +1,351 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse.h"
+
+#include "csr2csrdc_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+
+#include <hip/hip_runtime_api.h>
+#include <rocprim/rocprim.hpp>
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csr2csrdc_nnz(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    const rocsparse_mat_descr csr_descr,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_int             delta_bits,
+                                                    rocsparse_int*            csrdc_exc_ptr,
+                                                    rocsparse_int*            csrdc_nnz_exc,
+                                                    float*                    compression_ratio)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2csrdc_nnz",
+              m,
+              n,
+              (const void*&)csr_descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              delta_bits,
+              (const void*&)csrdc_exc_ptr,
+              (const void*&)csrdc_nnz_exc,
+              (const void*&)compression_ratio);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csr2csrdc",
+              "--mtx <matrix.mtx>",
+              "--deltabits",
+              delta_bits);
+
+    // Check index base
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check delta width
+    if(delta_bits != 8 && delta_bits != 16)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check output pointers
+    if(csrdc_nnz_exc == nullptr || compression_ratio == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(csrdc_nnz_exc, 0, sizeof(rocsparse_int), stream));
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(compression_ratio, 0, sizeof(float), stream));
+        }
+        else
+        {
+            *csrdc_nnz_exc     = 0;
+            *compression_ratio = 0.0f;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrdc_exc_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    static constexpr unsigned int CSR2CSRDC_DIM = 256;
+
+    // Number of exceptions per row
+    rocsparse_dispatch_value(delta_bits, rocsparse_csrdc_delta_bits{}, [&](auto bits) {
+        using U = typename rocsparse_csrdc_delta<decltype(bits)::value>::type;
+
+        hipLaunchKernelGGL((csr2csrdc_nnz_kernel<U, CSR2CSRDC_DIM>),
+                           dim3((m - 1) / CSR2CSRDC_DIM + 1),
+                           dim3(CSR2CSRDC_DIM),
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_descr->base,
+                           csrdc_exc_ptr);
+    });
+
+    // Exclusive scan to obtain the exception offsets
+    auto   op = rocprim::plus<rocsparse_int>();
+    size_t temp_storage_size_bytes;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, temp_storage_size_bytes, csrdc_exc_ptr, csrdc_exc_ptr, m + 1, op, stream));
+
+    bool  temp_alloc       = false;
+    void* temp_storage_ptr = nullptr;
+    if(handle->buffer_size >= temp_storage_size_bytes)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->alloc_buffer());
+        temp_storage_ptr = handle->buffer;
+        temp_alloc       = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, temp_storage_size_bytes));
+        temp_alloc = true;
+    }
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(temp_storage_ptr,
+                                                temp_storage_size_bytes,
+                                                csrdc_exc_ptr,
+                                                csrdc_exc_ptr,
+                                                m + 1,
+                                                op,
+                                                stream));
+
+    if(temp_alloc)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+    }
+
+    // Compute totals
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csr2csrdc_nnz_total_kernel<1>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           m,
+                           delta_bits,
+                           csr_row_ptr,
+                           csrdc_exc_ptr,
+                           csrdc_nnz_exc,
+                           compression_ratio);
+    }
+    else
+    {
+        rocsparse_int hstart;
+        rocsparse_int hend;
+        rocsparse_int hexc;
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(&hstart, &csr_row_ptr[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(&hend, &csr_row_ptr[m], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(&hexc, &csrdc_exc_ptr[m], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        rocsparse_int nnz     = hend - hstart;
+        rocsparse_int nnz_exc = hexc - csr_descr->base;
+
+        *csrdc_nnz_exc     = nnz_exc;
+        *compression_ratio = csr2csrdc_compression_ratio(m, nnz, nnz_exc, delta_bits);
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csr2csrdc(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                const rocsparse_mat_descr csr_descr,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_int             delta_bits,
+                                                rocsparse_int*            csrdc_col_base,
+                                                void*                     csrdc_delta,
+                                                const rocsparse_int*      csrdc_exc_ptr,
+                                                rocsparse_int*            csrdc_exc_col)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2csrdc",
+              m,
+              n,
+              (const void*&)csr_descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              delta_bits,
+              (const void*&)csrdc_col_base,
+              (const void*&)csrdc_delta,
+              (const void*&)csrdc_exc_ptr,
+              (const void*&)csrdc_exc_col);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csr2csrdc",
+              "--mtx <matrix.mtx>",
+              "--deltabits",
+              delta_bits);
+
+    // Check index base
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check delta width
+    if(delta_bits != 8 && delta_bits != 16)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrdc_col_base == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrdc_delta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrdc_exc_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // csrdc_exc_col is only accessed if there are exceptions and may be null otherwise
+
+    static constexpr unsigned int CSR2CSRDC_DIM = 256;
+
+    rocsparse_dispatch_value(delta_bits, rocsparse_csrdc_delta_bits{}, [&](auto bits) {
+        using U = typename rocsparse_csrdc_delta<decltype(bits)::value>::type;
+
+        hipLaunchKernelGGL((csr2csrdc_kernel<U, CSR2CSRDC_DIM>),
+                           dim3((m - 1) / CSR2CSRDC_DIM + 1),
+                           dim3(CSR2CSRDC_DIM),
+                           0,
+                           handle->stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_descr->base,
+                           csrdc_col_base,
+                           reinterpret_cast<U*>(csrdc_delta),
+                           csrdc_exc_ptr,
+                           csrdc_exc_col);
+    });
+
+    return rocsparse_status_success;
+}
@@ -0,0 +1,304 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_csr2dia.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csr2dia_ndiag(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    const rocsparse_mat_descr csr_descr,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_int*            dia_num_diag,
+                                                    float*                    dia_fill)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2dia_ndiag",
+              m,
+              n,
+              (const void*&)csr_descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)dia_num_diag,
+              (const void*&)dia_fill);
+
+    // Check index base
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check output pointers
+    if(dia_num_diag == nullptr || dia_fill == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(dia_num_diag, 0, sizeof(rocsparse_int), stream));
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(dia_fill, 0, sizeof(float), stream));
+        }
+        else
+        {
+            *dia_num_diag = 0;
+            *dia_fill     = 0.0f;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+#define CSR2DIA_DIM 256
+    // Number of possible diagonals
+    rocsparse_int size = m + n - 1;
+
+    // Workspace size
+    rocsparse_int nblocks = CSR2DIA_DIM;
+
+    // Temporary storage for the diagonal flags, the partial sums and the results
+    size_t flag_size   = sizeof(rocsparse_int) * ((size - 1) / 256 + 1) * 256;
+    size_t buffer_size = flag_size + sizeof(rocsparse_int) * (nblocks + 2);
+
+    bool  temp_alloc = false;
+    char* ptr        = nullptr;
+    if(handle->buffer_size >= buffer_size)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->alloc_buffer());
+        ptr        = reinterpret_cast<char*>(handle->buffer);
+        temp_alloc = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&ptr, buffer_size));
+        temp_alloc = true;
+    }
+
+    rocsparse_int* diag_flag = reinterpret_cast<rocsparse_int*>(ptr);
+    rocsparse_int* workspace = reinterpret_cast<rocsparse_int*>(ptr + flag_size);
+
+    // Mark occupied diagonals
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(diag_flag, 0, sizeof(rocsparse_int) * size, stream));
+
+    hipLaunchKernelGGL((csr2dia_flag_kernel<CSR2DIA_DIM>),
+                       dim3((m - 1) / CSR2DIA_DIM + 1),
+                       dim3(CSR2DIA_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_descr->base,
+                       diag_flag);
+
+    // Count occupied diagonals
+    hipLaunchKernelGGL((csr2dia_ndiag_kernel_part1<CSR2DIA_DIM>),
+                       dim3(nblocks),
+                       dim3(CSR2DIA_DIM),
+                       0,
+                       stream,
+                       size,
+                       diag_flag,
+                       workspace);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csr2dia_ndiag_kernel_part2<CSR2DIA_DIM>),
+                           dim3(1),
+                           dim3(CSR2DIA_DIM),
+                           0,
+                           stream,
+                           m,
+                           nblocks,
+                           csr_row_ptr,
+                           workspace,
+                           dia_num_diag,
+                           dia_fill);
+    }
+    else
+    {
+        rocsparse_int* dnum_diag = workspace + nblocks;
+        float*         dfill     = reinterpret_cast<float*>(workspace + nblocks + 1);
+
+        hipLaunchKernelGGL((csr2dia_ndiag_kernel_part2<CSR2DIA_DIM>),
+                           dim3(1),
+                           dim3(CSR2DIA_DIM),
+                           0,
+                           stream,
+                           m,
+                           nblocks,
+                           csr_row_ptr,
+                           workspace,
+                           dnum_diag,
+                           dfill);
+
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(dia_num_diag, dnum_diag, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(hipMemcpy(dia_fill, dfill, sizeof(float), hipMemcpyDeviceToHost));
+    }
+#undef CSR2DIA_DIM
+
+    if(temp_alloc)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(ptr));
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsr2dia(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               const rocsparse_mat_descr csr_descr,
+                                               const float*              csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_int             dia_num_diag,
+                                               float*                    dia_val,
+                                               rocsparse_int*            dia_offset)
+{
+    return rocsparse_csr2dia_template(handle,
+                                      m,
+                                      n,
+                                      csr_descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      dia_num_diag,
+                                      dia_val,
+                                      dia_offset);
+}
+
+extern "C" rocsparse_status rocsparse_dcsr2dia(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               const rocsparse_mat_descr csr_descr,
+                                               const double*             csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_int             dia_num_diag,
+                                               double*                   dia_val,
+                                               rocsparse_int*            dia_offset)
+{
+    return rocsparse_csr2dia_template(handle,
+                                      m,
+                                      n,
+                                      csr_descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      dia_num_diag,
+                                      dia_val,
+                                      dia_offset);
+}
+
+extern "C" rocsparse_status rocsparse_ccsr2dia(rocsparse_handle               handle,
+                                               rocsparse_int                  m,
+                                               rocsparse_int                  n,
+                                               const rocsparse_mat_descr      csr_descr,
+                                               const rocsparse_float_complex* csr_val,
+                                               const rocsparse_int*           csr_row_ptr,
+                                               const rocsparse_int*           csr_col_ind,
+                                               rocsparse_int                  dia_num_diag,
+                                               rocsparse_float_complex*       dia_val,
+                                               rocsparse_int*                 dia_offset)
+{
+    return rocsparse_csr2dia_template(handle,
+                                      m,
+                                      n,
+                                      csr_descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      dia_num_diag,
+                                      dia_val,
+                                      dia_offset);
+}
+
+extern "C" rocsparse_status rocsparse_zcsr2dia(rocsparse_handle                handle,
+                                               rocsparse_int                   m,
+                                               rocsparse_int                   n,
+                                               const rocsparse_mat_descr       csr_descr,
+                                               const rocsparse_double_complex* csr_val,
+                                               const rocsparse_int*            csr_row_ptr,
+                                               const rocsparse_int*            csr_col_ind,
+                                               rocsparse_int                   dia_num_diag,
+                                               rocsparse_double_complex*       dia_val,
+                                               rocsparse_int*                  dia_offset)
+{
+    return rocsparse_csr2dia_template(handle,
+                                      m,
+                                      n,
+                                      csr_descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      dia_num_diag,
+                                      dia_val,
+                                      dia_offset);
+}
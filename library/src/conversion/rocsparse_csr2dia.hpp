@@ -0,0 +1,213 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSR2DIA_HPP
+#define ROCSPARSE_CSR2DIA_HPP
+
+#include "csr2dia_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+#include <rocprim/rocprim.hpp>
+
+template <typename T>
+rocsparse_status rocsparse_csr2dia_template(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            const rocsparse_mat_descr csr_descr,
+                                            const T*                  csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_int             dia_num_diag,
+                                            T*                        dia_val,
+                                            rocsparse_int*            dia_offset)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2dia"),
+              m,
+              n,
+              (const void*&)csr_descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              dia_num_diag,
+              (const void*&)dia_val,
+              (const void*&)dia_offset);
+
+    log_bench(handle, "./rocsparse-bench -f csr2dia -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || dia_num_diag < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || dia_num_diag == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(dia_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(dia_offset == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Number of possible diagonals
+    rocsparse_int size = m + n - 1;
+
+    // Inclusive scan over the diagonal flags yields the position of each diagonal
+    auto   op = rocprim::plus<rocsparse_int>();
+    size_t temp_storage_size_bytes;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                temp_storage_size_bytes,
+                                                (rocsparse_int*)nullptr,
+                                                (rocsparse_int*)nullptr,
+                                                size,
+                                                op,
+                                                stream));
+
+    // Temporary storage for the diagonal flags and rocprim
+    size_t flag_size   = sizeof(rocsparse_int) * ((size - 1) / 256 + 1) * 256;
+    size_t buffer_size = flag_size + temp_storage_size_bytes;
+
+    bool  temp_alloc = false;
+    char* ptr        = nullptr;
+    if(handle->buffer_size >= buffer_size)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->alloc_buffer());
+        ptr        = reinterpret_cast<char*>(handle->buffer);
+        temp_alloc = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&ptr, buffer_size));
+        temp_alloc = true;
+    }
+
+    rocsparse_int* diag_pos         = reinterpret_cast<rocsparse_int*>(ptr);
+    void*          temp_storage_ptr = ptr + flag_size;
+
+#define CSR2DIA_DIM 256
+    // Mark occupied diagonals
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(diag_pos, 0, sizeof(rocsparse_int) * size, stream));
+
+    hipLaunchKernelGGL((csr2dia_flag_kernel<CSR2DIA_DIM>),
+                       dim3((m - 1) / CSR2DIA_DIM + 1),
+                       dim3(CSR2DIA_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_descr->base,
+                       diag_pos);
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        temp_storage_ptr, temp_storage_size_bytes, diag_pos, diag_pos, size, op, stream));
+
+    // Diagonal offsets
+    hipLaunchKernelGGL((csr2dia_offset_kernel<CSR2DIA_DIM>),
+                       dim3((size - 1) / CSR2DIA_DIM + 1),
+                       dim3(CSR2DIA_DIM),
+                       0,
+                       stream,
+                       m,
+                       n,
+                       diag_pos,
+                       dia_offset);
+
+    // Entries that are not covered by the CSR matrix are padded with zeros
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(dia_val, 0, sizeof(T) * m * dia_num_diag, stream));
+
+    hipLaunchKernelGGL((csr2dia_kernel<T, CSR2DIA_DIM>),
+                       dim3((m - 1) / CSR2DIA_DIM + 1),
+                       dim3(CSR2DIA_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_val,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_descr->base,
+                       diag_pos,
+                       dia_val);
+#undef CSR2DIA_DIM
+
+    if(temp_alloc)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(ptr));
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSR2DIA_HPP
@@ -123,6 +123,7 @@ extern "C" rocsparse_status rocsparse_csr2ell_width(rocsparse_handle          ha
     rocsparse_int nblocks = CSR2ELL_DIM;
 
     // Get workspace from handle device buffer
+    RETURN_IF_ROCSPARSE_ERROR(handle->alloc_buffer());
     rocsparse_int* workspace = reinterpret_cast<rocsparse_int*>(handle->buffer);
 
     dim3 csr2ell_blocks(nblocks);
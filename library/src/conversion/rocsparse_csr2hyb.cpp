@@ -121,3 +121,51 @@ extern "C" rocsparse_status rocsparse_zcsr2hyb(rocsparse_handle                h
                                       user_ell_width,
                                       partition_type);
 }
+
+extern "C" rocsparse_status
+    rocsparse_scsr2hyb_ell_width_analysis(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          const rocsparse_mat_descr descr,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          rocsparse_int*            ell_width,
+                                          rocsparse_int*            row_nnz_hist)
+{
+    return rocsparse_csr2hyb_ell_width_analysis_template<float>(
+        handle, m, descr, csr_row_ptr, ell_width, row_nnz_hist);
+}
+
+extern "C" rocsparse_status
+    rocsparse_dcsr2hyb_ell_width_analysis(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          const rocsparse_mat_descr descr,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          rocsparse_int*            ell_width,
+                                          rocsparse_int*            row_nnz_hist)
+{
+    return rocsparse_csr2hyb_ell_width_analysis_template<double>(
+        handle, m, descr, csr_row_ptr, ell_width, row_nnz_hist);
+}
+
+extern "C" rocsparse_status
+    rocsparse_ccsr2hyb_ell_width_analysis(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          const rocsparse_mat_descr descr,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          rocsparse_int*            ell_width,
+                                          rocsparse_int*            row_nnz_hist)
+{
+    return rocsparse_csr2hyb_ell_width_analysis_template<rocsparse_float_complex>(
+        handle, m, descr, csr_row_ptr, ell_width, row_nnz_hist);
+}
+
+extern "C" rocsparse_status
+    rocsparse_zcsr2hyb_ell_width_analysis(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          const rocsparse_mat_descr descr,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          rocsparse_int*            ell_width,
+                                          rocsparse_int*            row_nnz_hist)
+{
+    return rocsparse_csr2hyb_ell_width_analysis_template<rocsparse_double_complex>(
+        handle, m, descr, csr_row_ptr, ell_width, row_nnz_hist);
+}
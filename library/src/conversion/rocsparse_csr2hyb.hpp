@@ -33,7 +33,123 @@
 #include "utility.h"
 
 #include <hip/hip_runtime.h>
+#include <limits>
 #include <rocprim/rocprim.hpp>
+#include <vector>
+
+// Estimated memory traffic of the HYB matrix in hybmv in bytes. Padded ELL entries are
+// loaded as well and the COO part updates y in a second pass.
+template <typename T>
+static inline double
+    csr2hyb_partition_bytes(rocsparse_int m, rocsparse_int ell_width, rocsparse_int coo_nnz)
+{
+    double bytes = static_cast<double>(m) * ell_width * (sizeof(rocsparse_int) + sizeof(T));
+
+    if(coo_nnz > 0)
+    {
+        bytes += coo_nnz * (2.0 * sizeof(rocsparse_int) + sizeof(T)) + 2.0 * m * sizeof(T);
+    }
+
+    return bytes;
+}
+
+// Determines the ELL width of the auto partition from the histogram of non-zero entries
+// per row, such that the estimated traffic of ELL padding and COO part is minimal. The
+// histogram holds 2 * (csr_nnz - 1) / m + 2 bins and is optionally copied to host memory.
+template <typename T>
+rocsparse_status rocsparse_csr2hyb_auto_width(rocsparse_handle     handle,
+                                              rocsparse_int        m,
+                                              rocsparse_int        csr_nnz,
+                                              const rocsparse_int* csr_row_ptr,
+                                              rocsparse_int*       ell_width,
+                                              rocsparse_int*       coo_nnz,
+                                              rocsparse_int*       row_nnz_hist)
+{
+    *ell_width = 0;
+    *coo_nnz   = 0;
+
+    // Quick return if possible
+    if(m == 0 || csr_nnz == 0)
+    {
+        if(row_nnz_hist != nullptr && m > 0)
+        {
+            row_nnz_hist[0] = m;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Maximum ELL width allowed by csr2hyb, longer rows share the last bin
+    rocsparse_int max_width = 2 * (csr_nnz - 1) / m + 1;
+
+    std::vector<rocsparse_int> hist(max_width + 1);
+
+    rocsparse_int* dhist = nullptr;
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&dhist, sizeof(rocsparse_int) * (max_width + 1)));
+    RETURN_IF_HIP_ERROR(
+        hipMemsetAsync(dhist, 0, sizeof(rocsparse_int) * (max_width + 1), stream));
+
+#define CSR2HYB_HIST_DIM 512
+    hipLaunchKernelGGL((hyb_row_nnz_histogram<CSR2HYB_HIST_DIM, CSR2HYB_HIST_DIM>),
+                       dim3((m - 1) / CSR2HYB_HIST_DIM + 1),
+                       dim3(CSR2HYB_HIST_DIM),
+                       0,
+                       stream,
+                       m,
+                       max_width,
+                       csr_row_ptr,
+                       dhist);
+#undef CSR2HYB_HIST_DIM
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(hist.data(),
+                                       dhist,
+                                       sizeof(rocsparse_int) * (max_width + 1),
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipFree(dhist));
+
+    // The ELL part must be addressable by rocsparse_int
+    rocsparse_int width_limit = std::min(max_width, std::numeric_limits<rocsparse_int>::max() / m);
+
+    // Start with a pure COO partition
+    rocsparse_int rows = 0;
+    rocsparse_int coo  = csr_nnz;
+    double        best = csr2hyb_partition_bytes<T>(m, 0, coo);
+
+    *coo_nnz = coo;
+
+    for(rocsparse_int w = 0; w < width_limit; ++w)
+    {
+        // Widening the ELL part moves one entry of each row longer than w out of COO
+        rows += hist[w];
+        coo -= m - rows;
+
+        double bytes = csr2hyb_partition_bytes<T>(m, w + 1, coo);
+
+        if(bytes < best)
+        {
+            best       = bytes;
+            *ell_width = w + 1;
+            *coo_nnz   = coo;
+        }
+    }
+
+    if(row_nnz_hist != nullptr)
+    {
+        for(rocsparse_int i = 0; i <= max_width; ++i)
+        {
+            row_nnz_hist[i] = hist[i];
+        }
+    }
+
+    return rocsparse_status_success;
+}
 
 template <typename T>
 rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
@@ -164,6 +280,7 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
     hyb->ell_nnz   = 0;
     hyb->ell_width = 0;
     hyb->coo_nnz   = 0;
+    hyb->val_size  = sizeof(T);
 
     if(hyb->ell_col_ind)
     {
@@ -199,8 +316,10 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
     }
     else if(partition_type == rocsparse_hyb_partition_auto)
     {
-        // ELL width determined by average nnz per row
-        hyb->ell_width = (csr_nnz - 1) / m + 1;
+        // ELL width determined by the histogram of nnz per row
+        rocsparse_int coo_nnz;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2hyb_auto_width<T>(
+            handle, m, csr_nnz, csr_row_ptr, &hyb->ell_width, &coo_nnz, nullptr));
     }
     else
     {
@@ -361,4 +480,93 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
     return rocsparse_status_success;
 }
 
+template <typename T>
+rocsparse_status
+    rocsparse_csr2hyb_ell_width_analysis_template(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  const rocsparse_mat_descr descr,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  rocsparse_int*            ell_width,
+                                                  rocsparse_int*            row_nnz_hist)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2hyb_ell_width_analysis"),
+              m,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)ell_width,
+              (const void*&)row_nnz_hist);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csr2hyb -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> --hybpart 0");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(ell_width == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        *ell_width = 0;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Get number of CSR non-zeros
+    rocsparse_int csr_nnz;
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &csr_nnz, csr_row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Correct by index base
+    csr_nnz -= descr->base;
+
+    rocsparse_int coo_nnz;
+    return rocsparse_csr2hyb_auto_width<T>(
+        handle, m, csr_nnz, csr_row_ptr, ell_width, &coo_nnz, row_nnz_hist);
+}
+
 #endif // ROCSPARSE_CSR2HYB_HPP
@@ -0,0 +1,587 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse.h"
+
+#include "rocsparse_csr2vbr.hpp"
+
+#include <hip/hip_runtime_api.h>
+#include <rocprim/rocprim.hpp>
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csr2vbr_partition(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             n,
+                                                        const rocsparse_mat_descr csr_descr,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        const rocsparse_mat_descr vbr_descr,
+                                                        rocsparse_int*            mb,
+                                                        rocsparse_int*            nb,
+                                                        rocsparse_int*            vbr_row_ptn,
+                                                        rocsparse_int*            vbr_col_ptn)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Check matrix descriptors
+    if(csr_descr == nullptr || vbr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2vbr_partition",
+              m,
+              n,
+              csr_descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              vbr_descr,
+              (const void*&)mb,
+              (const void*&)nb,
+              (const void*&)vbr_row_ptn,
+              (const void*&)vbr_col_ptn);
+
+    log_bench(handle, "./rocsparse-bench -f csr2vbr", "--mtx <matrix.mtx>");
+
+    // Check sizes
+    if(m < 0 || n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check block count pointers
+    if(mb == nullptr || nb == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(mb, 0, sizeof(rocsparse_int), handle->stream));
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nb, 0, sizeof(rocsparse_int), handle->stream));
+        }
+        else
+        {
+            *mb = 0;
+            *nb = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(vbr_row_ptn == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(vbr_col_ptn == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    static constexpr unsigned int CSR2VBR_DIM = 256;
+
+    // Temporary storage for the start flags of rows and columns and their scan
+    rocsparse_int size = std::max(m, n);
+
+    auto   op = rocprim::plus<rocsparse_int>();
+    size_t scan_size;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, scan_size, vbr_row_ptn, vbr_row_ptn, size, op, stream));
+
+    size_t flag_size   = ((sizeof(rocsparse_int) * size - 1) / 256 + 1) * 256;
+    size_t buffer_size = flag_size + scan_size;
+
+    bool  temp_alloc       = false;
+    void* temp_storage_ptr = nullptr;
+    if(handle->buffer_size >= buffer_size)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->alloc_buffer());
+        temp_storage_ptr = handle->buffer;
+        temp_alloc       = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, buffer_size));
+        temp_alloc = true;
+    }
+
+    rocsparse_int* start = reinterpret_cast<rocsparse_int*>(temp_storage_ptr);
+    void*          scan_buffer
+        = reinterpret_cast<void*>(reinterpret_cast<char*>(temp_storage_ptr) + flag_size);
+
+    // Row partition, merging rows of identical sparsity pattern
+    hipLaunchKernelGGL((csr2vbr_row_partition_kernel<CSR2VBR_DIM>),
+                       dim3((m - 1) / CSR2VBR_DIM + 1),
+                       dim3(CSR2VBR_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       start);
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(scan_buffer, scan_size, start, start, m, op, stream));
+
+    hipLaunchKernelGGL((csr2vbr_partition_compact_kernel<CSR2VBR_DIM>),
+                       dim3((m - 1) / CSR2VBR_DIM + 1),
+                       dim3(CSR2VBR_DIM),
+                       0,
+                       stream,
+                       m,
+                       start,
+                       vbr_descr->base,
+                       vbr_row_ptn);
+
+    // Number of block rows is the last entry of the scan
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            mb, start + m - 1, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(mb, start + m - 1, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+    }
+
+    // Column partition, such that all non-zero blocks are dense
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(start, 0, sizeof(rocsparse_int) * n, stream));
+
+    hipLaunchKernelGGL((csr2vbr_col_partition_kernel<CSR2VBR_DIM>),
+                       dim3((m - 1) / CSR2VBR_DIM + 1),
+                       dim3(CSR2VBR_DIM),
+                       0,
+                       stream,
+                       m,
+                       n,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_descr->base,
+                       start);
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(scan_buffer, scan_size, start, start, n, op, stream));
+
+    hipLaunchKernelGGL((csr2vbr_partition_compact_kernel<CSR2VBR_DIM>),
+                       dim3((n - 1) / CSR2VBR_DIM + 1),
+                       dim3(CSR2VBR_DIM),
+                       0,
+                       stream,
+                       n,
+                       start,
+                       vbr_descr->base,
+                       vbr_col_ptn);
+
+    // Number of block columns
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            nb, start + n - 1, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(nb, start + n - 1, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+    }
+
+    if(temp_alloc)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csr2vbr_nnz(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             n,
+                                                  const rocsparse_mat_descr csr_descr,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_int             mb,
+                                                  rocsparse_int             nb,
+                                                  const rocsparse_mat_descr vbr_descr,
+                                                  rocsparse_int*            vbr_row_ptr,
+                                                  const rocsparse_int*      vbr_row_ptn,
+                                                  const rocsparse_int*      vbr_col_ptn,
+                                                  rocsparse_int*            vbr_nnzb,
+                                                  rocsparse_int*            vbr_nnz)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Check matrix descriptors
+    if(csr_descr == nullptr || vbr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2vbr_nnz",
+              m,
+              n,
+              csr_descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              mb,
+              nb,
+              vbr_descr,
+              (const void*&)vbr_row_ptr,
+              (const void*&)vbr_row_ptn,
+              (const void*&)vbr_col_ptn,
+              (const void*&)vbr_nnzb,
+              (const void*&)vbr_nnz);
+
+    log_bench(handle, "./rocsparse-bench -f csr2vbr", "--mtx <matrix.mtx>");
+
+    // Check sizes
+    if(m < 0 || n < 0 || mb < 0 || nb < 0 || mb > m || nb > n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check non-zero count pointers
+    if(vbr_nnzb == nullptr || vbr_nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || mb == 0 || nb == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(
+                hipMemsetAsync(vbr_nnzb, 0, sizeof(rocsparse_int), handle->stream));
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(vbr_nnz, 0, sizeof(rocsparse_int), handle->stream));
+        }
+        else
+        {
+            *vbr_nnzb = 0;
+            *vbr_nnz  = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(vbr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(vbr_row_ptn == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(vbr_col_ptn == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    static constexpr unsigned int CSR2VBR_DIM = 256;
+
+    // Temporary storage for the column map, the number of values per block row and
+    // the scan
+    auto   op = rocprim::plus<rocsparse_int>();
+    size_t scan_size;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, scan_size, vbr_row_ptr, vbr_row_ptr, mb + 1, op, stream));
+
+    size_t map_size    = ((sizeof(rocsparse_int) * (n + mb + 1) - 1) / 256 + 1) * 256;
+    size_t buffer_size = map_size + scan_size;
+
+    bool  temp_alloc       = false;
+    void* temp_storage_ptr = nullptr;
+    if(handle->buffer_size >= buffer_size)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->alloc_buffer());
+        temp_storage_ptr = handle->buffer;
+        temp_alloc       = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, buffer_size));
+        temp_alloc = true;
+    }
+
+    rocsparse_int* col_map     = reinterpret_cast<rocsparse_int*>(temp_storage_ptr);
+    rocsparse_int* vbr_row_nnz = col_map + n;
+    void*          scan_buffer
+        = reinterpret_cast<void*>(reinterpret_cast<char*>(temp_storage_ptr) + map_size);
+
+    // Map columns to their block columns
+    hipLaunchKernelGGL((csr2vbr_partition_map_kernel<CSR2VBR_DIM>),
+                       dim3((nb - 1) / CSR2VBR_DIM + 1),
+                       dim3(CSR2VBR_DIM),
+                       0,
+                       stream,
+                       nb,
+                       vbr_col_ptn,
+                       vbr_descr->base,
+                       col_map);
+
+    // Number of non-zero blocks and values per block row
+    RETURN_IF_ROCSPARSE_ERROR(csr2vbr_block_row<false>(handle,
+                                                       m,
+                                                       mb,
+                                                       nb,
+                                                       csr_row_ptr,
+                                                       csr_col_ind,
+                                                       csr_descr->base,
+                                                       vbr_row_ptn,
+                                                       vbr_col_ptn,
+                                                       col_map,
+                                                       vbr_descr->base,
+                                                       vbr_row_ptr,
+                                                       nullptr,
+                                                       vbr_row_nnz,
+                                                       nullptr));
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        scan_buffer, scan_size, vbr_row_ptr, vbr_row_ptr, mb + 1, op, stream));
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        scan_buffer, scan_size, vbr_row_nnz, vbr_row_nnz, mb + 1, op, stream));
+
+    // Compute totals
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csr2vbr_nnz_total_kernel<1>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           mb,
+                           vbr_row_ptr,
+                           vbr_row_nnz,
+                           vbr_nnzb,
+                           vbr_nnz);
+    }
+    else
+    {
+        rocsparse_int hstart = 0;
+        rocsparse_int hend   = 0;
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(&hend, &vbr_row_ptr[mb], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(&hstart, &vbr_row_ptr[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(vbr_nnz, &vbr_row_nnz[mb], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        *vbr_nnzb = hend - hstart;
+    }
+
+    if(temp_alloc)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsr2vbr(rocsparse_handle          handle,
+                                               rocsparse_direction       dir,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               const rocsparse_mat_descr csr_descr,
+                                               const float*              csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_int             mb,
+                                               rocsparse_int             nb,
+                                               const rocsparse_mat_descr vbr_descr,
+                                               float*                    vbr_val,
+                                               rocsparse_int*            vbr_val_ptr,
+                                               rocsparse_int*            vbr_row_ptr,
+                                               rocsparse_int*            vbr_col_ind,
+                                               const rocsparse_int*      vbr_row_ptn,
+                                               const rocsparse_int*      vbr_col_ptn)
+{
+    return rocsparse_csr2vbr_template(handle,
+                                      dir,
+                                      m,
+                                      n,
+                                      csr_descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      mb,
+                                      nb,
+                                      vbr_descr,
+                                      vbr_val,
+                                      vbr_val_ptr,
+                                      vbr_row_ptr,
+                                      vbr_col_ind,
+                                      vbr_row_ptn,
+                                      vbr_col_ptn);
+}
+
+extern "C" rocsparse_status rocsparse_dcsr2vbr(rocsparse_handle          handle,
+                                               rocsparse_direction       dir,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               const rocsparse_mat_descr csr_descr,
+                                               const double*             csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_int             mb,
+                                               rocsparse_int             nb,
+                                               const rocsparse_mat_descr vbr_descr,
+                                               double*                   vbr_val,
+                                               rocsparse_int*            vbr_val_ptr,
+                                               rocsparse_int*            vbr_row_ptr,
+                                               rocsparse_int*            vbr_col_ind,
+                                               const rocsparse_int*      vbr_row_ptn,
+                                               const rocsparse_int*      vbr_col_ptn)
+{
+    return rocsparse_csr2vbr_template(handle,
+                                      dir,
+                                      m,
+                                      n,
+                                      csr_descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      mb,
+                                      nb,
+                                      vbr_descr,
+                                      vbr_val,
+                                      vbr_val_ptr,
+                                      vbr_row_ptr,
+                                      vbr_col_ind,
+                                      vbr_row_ptn,
+                                      vbr_col_ptn);
+}
+
+extern "C" rocsparse_status rocsparse_ccsr2vbr(rocsparse_handle               handle,
+                                               rocsparse_direction            dir,
+                                               rocsparse_int                  m,
+                                               rocsparse_int                  n,
+                                               const rocsparse_mat_descr      csr_descr,
+                                               const rocsparse_float_complex* csr_val,
+                                               const rocsparse_int*           csr_row_ptr,
+                                               const rocsparse_int*           csr_col_ind,
+                                               rocsparse_int                  mb,
+                                               rocsparse_int                  nb,
+                                               const rocsparse_mat_descr      vbr_descr,
+                                               rocsparse_float_complex*       vbr_val,
+                                               rocsparse_int*                 vbr_val_ptr,
+                                               rocsparse_int*                 vbr_row_ptr,
+                                               rocsparse_int*                 vbr_col_ind,
+                                               const rocsparse_int*           vbr_row_ptn,
+                                               const rocsparse_int*           vbr_col_ptn)
+{
+    return rocsparse_csr2vbr_template(handle,
+                                      dir,
+                                      m,
+                                      n,
+                                      csr_descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      mb,
+                                      nb,
+                                      vbr_descr,
+                                      vbr_val,
+                                      vbr_val_ptr,
+                                      vbr_row_ptr,
+                                      vbr_col_ind,
+                                      vbr_row_ptn,
+                                      vbr_col_ptn);
+}
+
+extern "C" rocsparse_status rocsparse_zcsr2vbr(rocsparse_handle                handle,
+                                               rocsparse_direction             dir,
+                                               rocsparse_int                   m,
+                                               rocsparse_int                   n,
+                                               const rocsparse_mat_descr       csr_descr,
+                                               const rocsparse_double_complex* csr_val,
+                                               const rocsparse_int*            csr_row_ptr,
+                                               const rocsparse_int*            csr_col_ind,
+                                               rocsparse_int                   mb,
+                                               rocsparse_int                   nb,
+                                               const rocsparse_mat_descr       vbr_descr,
+                                               rocsparse_double_complex*       vbr_val,
+                                               rocsparse_int*                  vbr_val_ptr,
+                                               rocsparse_int*                  vbr_row_ptr,
+                                               rocsparse_int*                  vbr_col_ind,
+                                               const rocsparse_int*            vbr_row_ptn,
+                                               const rocsparse_int*            vbr_col_ptn)
+{
+    return rocsparse_csr2vbr_template(handle,
+                                      dir,
+                                      m,
+                                      n,
+                                      csr_descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      mb,
+                                      nb,
+                                      vbr_descr,
+                                      vbr_val,
+                                      vbr_val_ptr,
+                                      vbr_row_ptr,
+                                      vbr_col_ind,
+                                      vbr_row_ptn,
+                                      vbr_col_ptn);
+}
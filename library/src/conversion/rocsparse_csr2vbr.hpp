@@ -0,0 +1,337 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROCSPARSE_CSR2VBR_HPP
+#define ROCSPARSE_CSR2VBR_HPP
+
+#include "csr2vbr_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+#include <rocprim/rocprim.hpp>
+
+// Segment sizes of the block row kernel
+using csr2vbr_segment_sizes = rocsparse_value_list<4, 8, 16, 32, 64>;
+
+// Segment size of the block row kernel, depending on the average height of a block row
+static inline rocsparse_int
+    csr2vbr_segment_size(rocsparse_int m, rocsparse_int mb, rocsparse_int wavefront_size)
+{
+    rocsparse_int height       = (m - 1) / mb + 1;
+    rocsparse_int segment_size = 4;
+
+    while(segment_size < height && segment_size < wavefront_size)
+    {
+        segment_size <<= 1;
+    }
+
+    return segment_size;
+}
+
+// Launch the block row kernel with a segment per block row
+template <bool FILL>
+static rocsparse_status csr2vbr_block_row(rocsparse_handle     handle,
+                                          rocsparse_int        m,
+                                          rocsparse_int        mb,
+                                          rocsparse_int        nb,
+                                          const rocsparse_int* csr_row_ptr,
+                                          const rocsparse_int* csr_col_ind,
+                                          rocsparse_index_base csr_base,
+                                          const rocsparse_int* vbr_row_ptn,
+                                          const rocsparse_int* vbr_col_ptn,
+                                          const rocsparse_int* col_map,
+                                          rocsparse_index_base vbr_base,
+                                          rocsparse_int*       vbr_row_ptr,
+                                          rocsparse_int*       vbr_col_ind,
+                                          rocsparse_int*       vbr_row_nnz,
+                                          rocsparse_int*       vbr_val_ptr)
+{
+    static constexpr unsigned int CSR2VBR_DIM = 256;
+
+    rocsparse_int segment_size = csr2vbr_segment_size(m, mb, handle->wavefront_size);
+
+    bool launched = rocsparse_dispatch_value(segment_size, csr2vbr_segment_sizes{}, [&](auto s) {
+        constexpr unsigned int SEGMENT = decltype(s)::value;
+
+        hipLaunchKernelGGL((csr2vbr_block_row_kernel<CSR2VBR_DIM, SEGMENT, FILL>),
+                           dim3((mb - 1) / (CSR2VBR_DIM / SEGMENT) + 1),
+                           dim3(CSR2VBR_DIM),
+                           0,
+                           handle->stream,
+                           mb,
+                           nb,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_base,
+                           vbr_row_ptn,
+                           vbr_col_ptn,
+                           col_map,
+                           vbr_base,
+                           vbr_row_ptr,
+                           vbr_col_ind,
+                           vbr_row_nnz,
+                           vbr_val_ptr);
+    });
+
+    return launched ? rocsparse_status_success : rocsparse_status_arch_mismatch;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csr2vbr_template(rocsparse_handle          handle,
+                                            rocsparse_direction       dir,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            const rocsparse_mat_descr csr_descr,
+                                            const T*                  csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_int             mb,
+                                            rocsparse_int             nb,
+                                            const rocsparse_mat_descr vbr_descr,
+                                            T*                        vbr_val,
+                                            rocsparse_int*            vbr_val_ptr,
+                                            rocsparse_int*            vbr_row_ptr,
+                                            rocsparse_int*            vbr_col_ind,
+                                            const rocsparse_int*      vbr_row_ptn,
+                                            const rocsparse_int*      vbr_col_ptn)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Check matrix descriptors
+    if(csr_descr == nullptr || vbr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2vbr"),
+              dir,
+              m,
+              n,
+              csr_descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              mb,
+              nb,
+              vbr_descr,
+              (const void*&)vbr_val,
+              (const void*&)vbr_val_ptr,
+              (const void*&)vbr_row_ptr,
+              (const void*&)vbr_col_ind,
+              (const void*&)vbr_row_ptn,
+              (const void*&)vbr_col_ptn);
+
+    log_bench(handle, "./rocsparse-bench -f csr2vbr -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check direction
+    if(dir != rocsparse_direction_row && dir != rocsparse_direction_column)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || mb < 0 || nb < 0 || mb > m || nb > n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || mb == 0 || nb == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(vbr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(vbr_val_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(vbr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(vbr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(vbr_row_ptn == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(vbr_col_ptn == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    static constexpr unsigned int CSR2VBR_DIM = 256;
+
+    // Number of non-zero blocks
+    rocsparse_int hstart = 0;
+    rocsparse_int hend   = 0;
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(&hend, &vbr_row_ptr[mb], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(&hstart, &vbr_row_ptr[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+    rocsparse_int nnzb = hend - hstart;
+
+    // Temporary storage for the row and column maps and the value offset scan
+    auto   op = rocprim::plus<rocsparse_int>();
+    size_t scan_size;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, scan_size, vbr_val_ptr, vbr_val_ptr, nnzb + 1, op, stream));
+
+    size_t map_size    = ((sizeof(rocsparse_int) * (m + n) - 1) / 256 + 1) * 256;
+    size_t buffer_size = map_size + scan_size;
+
+    bool  temp_alloc       = false;
+    void* temp_storage_ptr = nullptr;
+    if(handle->buffer_size >= buffer_size)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->alloc_buffer());
+        temp_storage_ptr = handle->buffer;
+        temp_alloc       = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, buffer_size));
+        temp_alloc = true;
+    }
+
+    rocsparse_int* row_map = reinterpret_cast<rocsparse_int*>(temp_storage_ptr);
+    rocsparse_int* col_map = row_map + m;
+    void*          scan_buffer
+        = reinterpret_cast<void*>(reinterpret_cast<char*>(temp_storage_ptr) + map_size);
+
+    // Map rows and columns to their block rows and block columns
+    hipLaunchKernelGGL((csr2vbr_partition_map_kernel<CSR2VBR_DIM>),
+                       dim3((mb - 1) / CSR2VBR_DIM + 1),
+                       dim3(CSR2VBR_DIM),
+                       0,
+                       stream,
+                       mb,
+                       vbr_row_ptn,
+                       vbr_descr->base,
+                       row_map);
+
+    hipLaunchKernelGGL((csr2vbr_partition_map_kernel<CSR2VBR_DIM>),
+                       dim3((nb - 1) / CSR2VBR_DIM + 1),
+                       dim3(CSR2VBR_DIM),
+                       0,
+                       stream,
+                       nb,
+                       vbr_col_ptn,
+                       vbr_descr->base,
+                       col_map);
+
+    // Block column indices and block sizes
+    RETURN_IF_ROCSPARSE_ERROR(csr2vbr_block_row<true>(handle,
+                                                      m,
+                                                      mb,
+                                                      nb,
+                                                      csr_row_ptr,
+                                                      csr_col_ind,
+                                                      csr_descr->base,
+                                                      vbr_row_ptn,
+                                                      vbr_col_ptn,
+                                                      col_map,
+                                                      vbr_descr->base,
+                                                      vbr_row_ptr,
+                                                      vbr_col_ind,
+                                                      nullptr,
+                                                      vbr_val_ptr));
+
+    // Value offsets of each block
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        scan_buffer, scan_size, vbr_val_ptr, vbr_val_ptr, nnzb + 1, op, stream));
+
+    // Blocks of a user defined partition may contain explicit zeros
+    rocsparse_int vbr_nnz = 0;
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(&vbr_nnz, &vbr_val_ptr[nnzb], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+    vbr_nnz -= vbr_descr->base;
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(vbr_val, 0, sizeof(T) * vbr_nnz, stream));
+
+    // Scatter CSR entries into the blocks
+    hipLaunchKernelGGL((csr2vbr_fill_kernel<T, CSR2VBR_DIM>),
+                       dim3((m - 1) / CSR2VBR_DIM + 1),
+                       dim3(CSR2VBR_DIM),
+                       0,
+                       stream,
+                       dir,
+                       m,
+                       csr_val,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_descr->base,
+                       vbr_row_ptn,
+                       vbr_col_ptn,
+                       row_map,
+                       col_map,
+                       vbr_descr->base,
+                       vbr_val,
+                       vbr_val_ptr,
+                       vbr_row_ptr,
+                       vbr_col_ind);
+
+    if(temp_alloc)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSR2VBR_HPP
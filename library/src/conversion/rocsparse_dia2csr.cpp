@@ -0,0 +1,286 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_dia2csr.hpp"
+
+#include <rocprim/rocprim.hpp>
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_dia2csr_nnz(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             n,
+                                                  rocsparse_int             dia_num_diag,
+                                                  const rocsparse_int*      dia_offset,
+                                                  const rocsparse_mat_descr csr_descr,
+                                                  rocsparse_int*            csr_row_ptr,
+                                                  rocsparse_int*            csr_nnz)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_dia2csr_nnz",
+              m,
+              n,
+              dia_num_diag,
+              (const void*&)dia_offset,
+              (const void*&)csr_descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_nnz);
+
+    // Check index base
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || dia_num_diag < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check csr_nnz pointer argument before setting
+    if(csr_nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || dia_num_diag == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(csr_nnz, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *csr_nnz = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(dia_offset == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+// Count nnz per row
+#define DIA2CSR_DIM 256
+    dim3 dia2csr_blocks((m - 1) / DIA2CSR_DIM + 1);
+    dim3 dia2csr_threads(DIA2CSR_DIM);
+
+    hipLaunchKernelGGL((dia2csr_nnz_per_row<DIA2CSR_DIM>),
+                       dia2csr_blocks,
+                       dia2csr_threads,
+                       0,
+                       stream,
+                       m,
+                       n,
+                       dia_num_diag,
+                       dia_offset,
+                       csr_row_ptr,
+                       csr_descr->base);
+#undef DIA2CSR_DIM
+
+    // Inclusive sum to obtain csr_row_ptr array and number of non-zero elements
+    size_t temp_storage_bytes = 0;
+
+    // Obtain rocprim buffer size
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                temp_storage_bytes,
+                                                csr_row_ptr,
+                                                csr_row_ptr,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Get rocprim buffer
+    bool  d_temp_alloc;
+    void* d_temp_storage;
+
+    // Device buffer should be sufficient for rocprim in most cases
+    if(handle->buffer_size >= temp_storage_bytes)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(handle->alloc_buffer());
+        d_temp_storage = handle->buffer;
+        d_temp_alloc   = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&d_temp_storage, temp_storage_bytes));
+        d_temp_alloc = true;
+    }
+
+    // Perform actual inclusive sum
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(d_temp_storage,
+                                                temp_storage_bytes,
+                                                csr_row_ptr,
+                                                csr_row_ptr,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Extract nnz
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL(
+            (dia2csr_nnz_total<1>), dim3(1), dim3(1), 0, stream, m, csr_row_ptr, csr_nnz);
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(csr_nnz, csr_row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Adjust nnz according to index base
+        *csr_nnz -= csr_descr->base;
+    }
+
+    // Free rocprim buffer, if allocated
+    if(d_temp_alloc == true)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(d_temp_storage));
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_sdia2csr(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               rocsparse_int             dia_num_diag,
+                                               const float*              dia_val,
+                                               const rocsparse_int*      dia_offset,
+                                               const rocsparse_mat_descr csr_descr,
+                                               float*                    csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               rocsparse_int*            csr_col_ind)
+{
+    return rocsparse_dia2csr_template(handle,
+                                      m,
+                                      n,
+                                      dia_num_diag,
+                                      dia_val,
+                                      dia_offset,
+                                      csr_descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind);
+}
+
+extern "C" rocsparse_status rocsparse_ddia2csr(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               rocsparse_int             dia_num_diag,
+                                               const double*             dia_val,
+                                               const rocsparse_int*      dia_offset,
+                                               const rocsparse_mat_descr csr_descr,
+                                               double*                   csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               rocsparse_int*            csr_col_ind)
+{
+    return rocsparse_dia2csr_template(handle,
+                                      m,
+                                      n,
+                                      dia_num_diag,
+                                      dia_val,
+                                      dia_offset,
+                                      csr_descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind);
+}
+
+extern "C" rocsparse_status rocsparse_cdia2csr(rocsparse_handle               handle,
+                                               rocsparse_int                  m,
+                                               rocsparse_int                  n,
+                                               rocsparse_int                  dia_num_diag,
+                                               const rocsparse_float_complex* dia_val,
+                                               const rocsparse_int*           dia_offset,
+                                               const rocsparse_mat_descr      csr_descr,
+                                               rocsparse_float_complex*       csr_val,
+                                               const rocsparse_int*           csr_row_ptr,
+                                               rocsparse_int*                 csr_col_ind)
+{
+    return rocsparse_dia2csr_template(handle,
+                                      m,
+                                      n,
+                                      dia_num_diag,
+                                      dia_val,
+                                      dia_offset,
+                                      csr_descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind);
+}
+
+extern "C" rocsparse_status rocsparse_zdia2csr(rocsparse_handle                handle,
+                                               rocsparse_int                   m,
+                                               rocsparse_int                   n,
+                                               rocsparse_int                   dia_num_diag,
+                                               const rocsparse_double_complex* dia_val,
+                                               const rocsparse_int*            dia_offset,
+                                               const rocsparse_mat_descr       csr_descr,
+                                               rocsparse_double_complex*       csr_val,
+                                               const rocsparse_int*            csr_row_ptr,
+                                               rocsparse_int*                  csr_col_ind)
+{
+    return rocsparse_dia2csr_template(handle,
+                                      m,
+                                      n,
+                                      dia_num_diag,
+                                      dia_val,
+                                      dia_offset,
+                                      csr_descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind);
+}
@@ -172,6 +172,7 @@ extern "C" rocsparse_status rocsparse_ell2csr_nnz(rocsparse_handle          hand
     // Device buffer should be sufficient for rocprim in most cases
     if(handle->buffer_size >= temp_storage_bytes)
     {
+        RETURN_IF_ROCSPARSE_ERROR(handle->alloc_buffer());
         d_temp_storage = handle->buffer;
         d_temp_alloc   = false;
     }
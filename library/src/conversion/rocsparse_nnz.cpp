@@ -165,6 +165,7 @@ rocsparse_status rocsparse_nnz_impl(rocsparse_handle          handle,
         rocsparse_int* d_nnz;
         if(handle->buffer_size >= temp_storage_size_bytes)
         {
+            RETURN_IF_ROCSPARSE_ERROR(handle->alloc_buffer());
             d_nnz            = (rocsparse_int*)handle->buffer;
             temp_storage_ptr = d_nnz + 1;
             temp_alloc       = false;
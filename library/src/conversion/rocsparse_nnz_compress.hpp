@@ -352,6 +352,7 @@ rocsparse_status rocsparse_nnz_compress_template(rocsparse_handle          handl
     void* temp_storage_ptr = nullptr;
     if(handle->buffer_size >= temp_storage_size_bytes)
     {
+        RETURN_IF_ROCSPARSE_ERROR(handle->alloc_buffer());
         temp_storage_ptr = handle->buffer;
         temp_alloc       = false;
     }
@@ -0,0 +1,745 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRRAP_DEVICE_H
+#define CSRRAP_DEVICE_H
+
+#include "common.h"
+#include "csrgemm_device.h"
+#include "rocsparse.h"
+
+#include <hip/hip_runtime.h>
+
+// Compute the number of non-zero entries of each row of C = op(R) * A * P, where each
+// row is processed by a single block. The intermediate product A * P is never stored,
+// instead each wavefront walks through the rows of A that are referenced by an entry of
+// the current row of op(R), and each lane walks through the rows of P that are referenced
+// by an entry of A. The column indices of the row of C are inserted into a hash table in
+// shared memory. Once the row holds LIMIT or more entries, where LIMIT leaves room for
+// all in-flight insertions, the row is flagged with -1 and processed by the multipass
+// kernel instead.
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int HASHSIZE,
+          unsigned int HASHVAL,
+          unsigned int LIMIT>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrap_nnz_block_per_row(const rocsparse_int* __restrict__ csr_row_ptr_R,
+                                  const rocsparse_int* __restrict__ csr_col_ind_R,
+                                  const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                  const rocsparse_int* __restrict__ csr_col_ind_A,
+                                  const rocsparse_int* __restrict__ csr_row_ptr_P,
+                                  const rocsparse_int* __restrict__ csr_col_ind_P,
+                                  rocsparse_int* __restrict__ row_nnz,
+                                  rocsparse_index_base idx_base_R,
+                                  rocsparse_index_base idx_base_A,
+                                  rocsparse_index_base idx_base_P)
+{
+    // Lane id
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each block processes a row
+    rocsparse_int row = hipBlockIdx_x;
+
+    // Hash table in shared memory
+    __shared__ rocsparse_int table[HASHSIZE];
+
+    // Number of entries that have been inserted into the hash table
+    __shared__ rocsparse_int nnz;
+
+    // Initialize hash table
+    for(unsigned int i = hipThreadIdx_x; i < HASHSIZE; i += BLOCKSIZE)
+    {
+        table[i] = -1;
+    }
+
+    if(hipThreadIdx_x == 0)
+    {
+        nnz = 0;
+    }
+
+    // Wait for all threads to finish initialization
+    __syncthreads();
+
+    // Insertion counter, that is visible to all threads of the block
+    volatile rocsparse_int* count = &nnz;
+
+    // Get row boundaries of the current row in op(R)
+    rocsparse_int row_begin_R = csr_row_ptr_R[row] - idx_base_R;
+    rocsparse_int row_end_R   = csr_row_ptr_R[row + 1] - idx_base_R;
+
+    // Loop over columns of op(R) in current row
+    for(rocsparse_int j = row_begin_R + wid; j < row_end_R && *count < LIMIT;
+        j += BLOCKSIZE / WFSIZE)
+    {
+        // Column of op(R) in current row
+        rocsparse_int col_R = csr_col_ind_R[j] - idx_base_R;
+
+        // Get row boundaries of row col_R in A
+        rocsparse_int row_begin_A = csr_row_ptr_A[col_R] - idx_base_A;
+        rocsparse_int row_end_A   = csr_row_ptr_A[col_R + 1] - idx_base_A;
+
+        // Loop over columns of A in row col_R
+        for(rocsparse_int l = row_begin_A + lid; l < row_end_A && *count < LIMIT; l += WFSIZE)
+        {
+            // Column of A in row col_R
+            rocsparse_int col_A = csr_col_ind_A[l] - idx_base_A;
+
+            // Get row boundaries of row col_A in P
+            rocsparse_int row_begin_P = csr_row_ptr_P[col_A] - idx_base_P;
+            rocsparse_int row_end_P   = csr_row_ptr_P[col_A + 1] - idx_base_P;
+
+            // Insert all columns of P into hash table, while there is room left
+            for(rocsparse_int p = row_begin_P; p < row_end_P && *count < LIMIT; ++p)
+            {
+                if(insert_key<HASHVAL, HASHSIZE>(csr_col_ind_P[p] - idx_base_P, table))
+                {
+                    atomicAdd(&nnz, 1);
+                }
+            }
+        }
+    }
+
+    // Wait for all threads to finish hash operation
+    __syncthreads();
+
+    // Write result to global memory, rows that exceed the hash table are flagged
+    if(hipThreadIdx_x == 0)
+    {
+        row_nnz[row] = (nnz < LIMIT) ? nnz : -1;
+    }
+}
+
+// Compute the number of non-zero entries of each row that has been flagged by
+// csrrap_nnz_block_per_row. The row of C is split into chunks of CHUNKSIZE columns, such
+// that shared memory can be used to mark populated column indices. Chunks without any
+// entry are skipped.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, unsigned int CHUNKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrap_nnz_block_per_row_multipass(rocsparse_int k,
+                                            const rocsparse_int* __restrict__ csr_row_ptr_R,
+                                            const rocsparse_int* __restrict__ csr_col_ind_R,
+                                            const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                            const rocsparse_int* __restrict__ csr_col_ind_A,
+                                            const rocsparse_int* __restrict__ csr_row_ptr_P,
+                                            const rocsparse_int* __restrict__ csr_col_ind_P,
+                                            rocsparse_int* __restrict__ row_nnz,
+                                            rocsparse_index_base idx_base_R,
+                                            rocsparse_index_base idx_base_A,
+                                            rocsparse_index_base idx_base_P)
+{
+    // Lane id
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each block processes a row
+    rocsparse_int row = hipBlockIdx_x;
+
+    // Skip rows that have been processed by the hash table kernel
+    if(row_nnz[row] >= 0)
+    {
+        return;
+    }
+
+    // Row entry marker
+    __shared__ bool table[CHUNKSIZE];
+
+    // Shared memory to determine the minimum of all column indices of P that exceed the
+    // current chunk
+    __shared__ rocsparse_int next_chunk;
+
+    // Shared memory to accumulate the row nnz
+    __shared__ rocsparse_int nnz;
+
+    if(hipThreadIdx_x == 0)
+    {
+        nnz = 0;
+    }
+
+    // Begin of the current row chunk (this is the column index of the current row)
+    rocsparse_int chunk_begin = 0;
+    rocsparse_int chunk_end   = CHUNKSIZE;
+
+    // Get row boundaries of the current row in op(R)
+    rocsparse_int row_begin_R = csr_row_ptr_R[row] - idx_base_R;
+    rocsparse_int row_end_R   = csr_row_ptr_R[row + 1] - idx_base_R;
+
+    // Loop over the row chunks until the end of the row has been reached (which is
+    // the number of total columns)
+    while(chunk_begin < k)
+    {
+        // Initialize row nnz table
+        for(int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+        {
+            table[i] = false;
+        }
+
+        // Initialize next chunk column index
+        if(hipThreadIdx_x == 0)
+        {
+            next_chunk = k;
+        }
+
+        // Wait for all threads to finish initialization
+        __syncthreads();
+
+        // Initialize the beginning of the next chunk
+        rocsparse_int min_col = k;
+
+        // Loop over columns of op(R) in current row
+        for(rocsparse_int j = row_begin_R + wid; j < row_end_R; j += BLOCKSIZE / WFSIZE)
+        {
+            // Column of op(R) in current row
+            rocsparse_int col_R = csr_col_ind_R[j] - idx_base_R;
+
+            // Get row boundaries of row col_R in A
+            rocsparse_int row_begin_A = csr_row_ptr_A[col_R] - idx_base_A;
+            rocsparse_int row_end_A   = csr_row_ptr_A[col_R + 1] - idx_base_A;
+
+            // Loop over columns of A in row col_R
+            for(rocsparse_int l = row_begin_A + lid; l < row_end_A; l += WFSIZE)
+            {
+                // Column of A in row col_R
+                rocsparse_int col_A = csr_col_ind_A[l] - idx_base_A;
+
+                // Get row boundaries of row col_A in P
+                rocsparse_int row_begin_P = csr_row_ptr_P[col_A] - idx_base_P;
+                rocsparse_int row_end_P   = csr_row_ptr_P[col_A + 1] - idx_base_P;
+
+                // Loop over columns of P in row col_A
+                for(rocsparse_int p = row_begin_P; p < row_end_P; ++p)
+                {
+                    // Column of P in row col_A
+                    rocsparse_int col_P = csr_col_ind_P[p] - idx_base_P;
+
+                    if(col_P >= chunk_begin && col_P < chunk_end)
+                    {
+                        // Mark nnz table if entry at col_P
+                        table[col_P - chunk_begin] = true;
+                    }
+                    else if(col_P >= chunk_end)
+                    {
+                        // Store the first column index of P that exceeds the current chunk
+                        min_col = min(min_col, col_P);
+                        break;
+                    }
+                }
+            }
+        }
+
+        // Gather wavefront-wide minimum for the next chunks starting column index
+        rocsparse_wfreduce_min<WFSIZE>(&min_col);
+
+        // Last thread in each wavefront finds block-wide minimum atomically
+        if(lid == WFSIZE - 1)
+        {
+            // Atomically determine the new chunks beginning (minimum column index of P
+            // that is larger than the current chunks end point)
+            atomicMin(&next_chunk, min_col);
+        }
+
+        // Wait for all threads to finish row nnz operation
+        __syncthreads();
+
+        // Each thread loads its entry for the current chunk
+        rocsparse_int chunk_nnz = 0;
+        for(int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+        {
+            chunk_nnz += (table[i] == true) ? 1 : 0;
+        }
+
+        // Gather wavefront-wide nnz for the current chunk
+        rocsparse_wfreduce_sum<WFSIZE>(&chunk_nnz);
+
+        // Last thread in each wavefront accumulates block-wide nnz atomically
+        if(lid == WFSIZE - 1)
+        {
+            // Atomically add this chunks nnz to the total row nnz
+            atomicAdd(&nnz, chunk_nnz);
+        }
+
+        // Wait for atomics to be processed
+        __syncthreads();
+
+        // Each thread loads the new chunk beginning and end point
+        chunk_begin = next_chunk;
+        chunk_end   = chunk_begin + CHUNKSIZE;
+
+        // Wait for all threads to finish load from shared memory
+        __syncthreads();
+    }
+
+    // Write accumulated total row nnz to global memory
+    if(hipThreadIdx_x == 0)
+    {
+        row_nnz[row] = nnz;
+    }
+}
+
+// Compute column entries and accumulate values of C = op(R) * A * P, where each row is
+// processed by a single block, following csrrap_nnz_block_per_row. Rows with LIMIT or
+// more entries are skipped and processed by the multipass kernel instead. If perm_R is
+// not a null pointer, the values of op(R) are gathered from csr_val_R through perm_R,
+// which is the case if op(R) is the transpose of the given matrix R.
+template <typename T,
+          unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int HASHSIZE,
+          unsigned int HASHVAL,
+          unsigned int LIMIT,
+          bool         CONJ>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrap_fill_block_per_row(const rocsparse_int* __restrict__ csr_row_ptr_R,
+                                   const rocsparse_int* __restrict__ csr_col_ind_R,
+                                   const T* __restrict__ csr_val_R,
+                                   const rocsparse_int* __restrict__ perm_R,
+                                   const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                   const rocsparse_int* __restrict__ csr_col_ind_A,
+                                   const T* __restrict__ csr_val_A,
+                                   const rocsparse_int* __restrict__ csr_row_ptr_P,
+                                   const rocsparse_int* __restrict__ csr_col_ind_P,
+                                   const T* __restrict__ csr_val_P,
+                                   const rocsparse_int* __restrict__ csr_row_ptr_C,
+                                   rocsparse_int* __restrict__ csr_col_ind_C,
+                                   T* __restrict__ csr_val_C,
+                                   rocsparse_index_base idx_base_R,
+                                   rocsparse_index_base idx_base_A,
+                                   rocsparse_index_base idx_base_P,
+                                   rocsparse_index_base idx_base_C)
+{
+    // Lane id
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each block processes a row
+    rocsparse_int row = hipBlockIdx_x;
+
+    // Row boundaries of the current row in C
+    rocsparse_int row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+    rocsparse_int row_end_C   = csr_row_ptr_C[row + 1] - idx_base_C;
+
+    // Skip rows that exceed the hash table
+    if(row_end_C - row_begin_C >= LIMIT)
+    {
+        return;
+    }
+
+    // Hash table in shared memory
+    __shared__ rocsparse_int table[HASHSIZE];
+    __shared__ T             data[HASHSIZE];
+
+    // Initialize hash table
+    for(unsigned int i = hipThreadIdx_x; i < HASHSIZE; i += BLOCKSIZE)
+    {
+        table[i] = -1;
+        data[i]  = static_cast<T>(0);
+    }
+
+    // Wait for all threads to finish initialization
+    __syncthreads();
+
+    // Get row boundaries of the current row in op(R)
+    rocsparse_int row_begin_R = csr_row_ptr_R[row] - idx_base_R;
+    rocsparse_int row_end_R   = csr_row_ptr_R[row + 1] - idx_base_R;
+
+    // Loop over columns of op(R) in current row
+    for(rocsparse_int j = row_begin_R + wid; j < row_end_R; j += BLOCKSIZE / WFSIZE)
+    {
+        // Column of op(R) in current row
+        rocsparse_int col_R = csr_col_ind_R[j] - idx_base_R;
+
+        // Value of op(R) in current row
+        T val_R = csr_val_R[(perm_R == nullptr) ? j : perm_R[j]];
+
+        if(CONJ)
+        {
+            val_R = rocsparse_conj(val_R);
+        }
+
+        // Get row boundaries of row col_R in A
+        rocsparse_int row_begin_A = csr_row_ptr_A[col_R] - idx_base_A;
+        rocsparse_int row_end_A   = csr_row_ptr_A[col_R + 1] - idx_base_A;
+
+        // Loop over columns of A in row col_R
+        for(rocsparse_int l = row_begin_A + lid; l < row_end_A; l += WFSIZE)
+        {
+            // Column of A in row col_R
+            rocsparse_int col_A = csr_col_ind_A[l] - idx_base_A;
+
+            // Intermediate product of op(R) and A
+            T val_RA = val_R * csr_val_A[l];
+
+            // Get row boundaries of row col_A in P
+            rocsparse_int row_begin_P = csr_row_ptr_P[col_A] - idx_base_P;
+            rocsparse_int row_end_P   = csr_row_ptr_P[col_A + 1] - idx_base_P;
+
+            // Insert all columns of P together with the intermediate products into hash
+            // table
+            for(rocsparse_int p = row_begin_P; p < row_end_P; ++p)
+            {
+                insert_pair<T, HASHVAL, HASHSIZE>(csr_col_ind_P[p] - idx_base_P,
+                                                   val_RA * csr_val_P[p],
+                                                   table,
+                                                   data,
+                                                   -1);
+            }
+        }
+    }
+
+    // Wait for hash operation to finish
+    __syncthreads();
+
+    // Compress hash table, such that valid entries come first
+    __shared__ rocsparse_int scan_offsets[BLOCKSIZE / warpSize + 1];
+
+    // Offset into hash table
+    rocsparse_int hash_offset = 0;
+
+    // Loop over the hash table and do the compression
+    for(unsigned int i = hipThreadIdx_x; i < HASHSIZE; i += BLOCKSIZE)
+    {
+        // Get column and value from hash table
+        rocsparse_int col_C = table[i];
+        T             val_C = data[i];
+
+        // Boolean to store if thread holds a valid entry
+        bool has_nnz = col_C > -1;
+
+        // Each thread obtains a bit mask of all wavefront-wide non-zero entries
+        // to compute its wavefront-wide non-zero offset
+        unsigned long long mask = __ballot(has_nnz);
+
+        // The number of bits set to 1 is the amount of wavefront-wide non-zeros
+        int nnz = __popcll(mask);
+
+        // Obtain the lane mask, where all bits lesser equal the lane id are set to 1
+        unsigned long long lanemask_le
+            = UINT64_MAX >> (sizeof(unsigned long long) * CHAR_BIT - (__lane_id() + 1));
+
+        // Compute the intra wavefront offset of the lane id by bitwise AND with the lane mask
+        int offset = __popcll(lanemask_le & mask);
+
+        // Each wavefront writes its nnz into shared memory so we can compute the
+        // scan offset
+        scan_offsets[hipThreadIdx_x / warpSize] = nnz;
+
+        // Wait for all wavefronts to finish writing
+        __syncthreads();
+
+        // Each thread accumulates the offset of all previous wavefronts to obtain its
+        // offset
+        for(unsigned int w = 1; w < BLOCKSIZE / warpSize; ++w)
+        {
+            if(hipThreadIdx_x >= w * warpSize)
+            {
+                offset += scan_offsets[w - 1];
+            }
+        }
+
+        // Last thread in block writes the block-wide nnz
+        if(hipThreadIdx_x == BLOCKSIZE - 1)
+        {
+            scan_offsets[BLOCKSIZE / warpSize] = offset;
+        }
+
+        // Wait for all threads to finish reading the scan offsets
+        __syncthreads();
+
+        // Only threads with a non-zero value write their entry into the compressed
+        // table, which is always located in front of the current position
+        if(has_nnz)
+        {
+            rocsparse_int idx = hash_offset + offset - 1;
+
+            table[idx] = col_C;
+            data[idx]  = val_C;
+        }
+
+        // Each thread adds the block-wide nnz to its offset
+        hash_offset += scan_offsets[BLOCKSIZE / warpSize];
+
+        // Wait for all threads to finish the current iteration
+        __syncthreads();
+    }
+
+    // Number of entries in the current row of C
+    rocsparse_int row_nnz = row_end_C - row_begin_C;
+
+    // Sort the compressed entries by counting the number of smaller column indices, which
+    // is the position of the entry in the row of C
+    for(rocsparse_int i = hipThreadIdx_x; i < row_nnz; i += BLOCKSIZE)
+    {
+        rocsparse_int col_C = table[i];
+        rocsparse_int idx   = 0;
+
+        for(rocsparse_int j = 0; j < row_nnz; ++j)
+        {
+            idx += (table[j] < col_C);
+        }
+
+        csr_col_ind_C[row_begin_C + idx] = col_C + idx_base_C;
+        csr_val_C[row_begin_C + idx]     = data[i];
+    }
+}
+
+// Compute column entries and accumulate values of C = op(R) * A * P for all rows with
+// LIMIT or more entries, following csrrap_nnz_block_per_row_multipass.
+template <typename T,
+          unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int CHUNKSIZE,
+          unsigned int LIMIT,
+          bool         CONJ>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrap_fill_block_per_row_multipass(rocsparse_int k,
+                                             const rocsparse_int* __restrict__ csr_row_ptr_R,
+                                             const rocsparse_int* __restrict__ csr_col_ind_R,
+                                             const T* __restrict__ csr_val_R,
+                                             const rocsparse_int* __restrict__ perm_R,
+                                             const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                             const rocsparse_int* __restrict__ csr_col_ind_A,
+                                             const T* __restrict__ csr_val_A,
+                                             const rocsparse_int* __restrict__ csr_row_ptr_P,
+                                             const rocsparse_int* __restrict__ csr_col_ind_P,
+                                             const T* __restrict__ csr_val_P,
+                                             const rocsparse_int* __restrict__ csr_row_ptr_C,
+                                             rocsparse_int* __restrict__ csr_col_ind_C,
+                                             T* __restrict__ csr_val_C,
+                                             rocsparse_index_base idx_base_R,
+                                             rocsparse_index_base idx_base_A,
+                                             rocsparse_index_base idx_base_P,
+                                             rocsparse_index_base idx_base_C)
+{
+    // Lane id
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each block processes a row
+    rocsparse_int row = hipBlockIdx_x;
+
+    // Skip rows that have been processed by the hash table kernel
+    if(csr_row_ptr_C[row + 1] - csr_row_ptr_C[row] < LIMIT)
+    {
+        return;
+    }
+
+    // Row entry marker and value accumulator
+    __shared__ bool table[CHUNKSIZE];
+    __shared__ T    data[CHUNKSIZE];
+
+    // Shared memory to determine the minimum of all column indices of P that exceed the
+    // current chunk
+    __shared__ rocsparse_int next_chunk;
+
+    // Begin of the current row chunk (this is the column index of the current row)
+    rocsparse_int chunk_begin = 0;
+    rocsparse_int chunk_end   = CHUNKSIZE;
+
+    // Get row boundaries of the current row in op(R)
+    rocsparse_int row_begin_R = csr_row_ptr_R[row] - idx_base_R;
+    rocsparse_int row_end_R   = csr_row_ptr_R[row + 1] - idx_base_R;
+
+    // Entry point into columns of C
+    rocsparse_int row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+
+    // Loop over the row chunks until the end of the row has been reached (which is
+    // the number of total columns)
+    while(chunk_begin < k)
+    {
+        // Initialize row nnz table and accumulator
+        for(int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+        {
+            table[i] = false;
+            data[i]  = static_cast<T>(0);
+        }
+
+        // Initialize next chunk column index
+        if(hipThreadIdx_x == 0)
+        {
+            next_chunk = k;
+        }
+
+        // Wait for all threads to finish initialization
+        __syncthreads();
+
+        // Initialize the beginning of the next chunk
+        rocsparse_int min_col = k;
+
+        // Loop over columns of op(R) in current row
+        for(rocsparse_int j = row_begin_R + wid; j < row_end_R; j += BLOCKSIZE / WFSIZE)
+        {
+            // Column of op(R) in current row
+            rocsparse_int col_R = csr_col_ind_R[j] - idx_base_R;
+
+            // Value of op(R) in current row
+            T val_R = csr_val_R[(perm_R == nullptr) ? j : perm_R[j]];
+
+            if(CONJ)
+            {
+                val_R = rocsparse_conj(val_R);
+            }
+
+            // Get row boundaries of row col_R in A
+            rocsparse_int row_begin_A = csr_row_ptr_A[col_R] - idx_base_A;
+            rocsparse_int row_end_A   = csr_row_ptr_A[col_R + 1] - idx_base_A;
+
+            // Loop over columns of A in row col_R
+            for(rocsparse_int l = row_begin_A + lid; l < row_end_A; l += WFSIZE)
+            {
+                // Column of A in row col_R
+                rocsparse_int col_A = csr_col_ind_A[l] - idx_base_A;
+
+                // Intermediate product of op(R) and A
+                T val_RA = val_R * csr_val_A[l];
+
+                // Get row boundaries of row col_A in P
+                rocsparse_int row_begin_P = csr_row_ptr_P[col_A] - idx_base_P;
+                rocsparse_int row_end_P   = csr_row_ptr_P[col_A + 1] - idx_base_P;
+
+                // Loop over columns of P in row col_A
+                for(rocsparse_int p = row_begin_P; p < row_end_P; ++p)
+                {
+                    // Column of P in row col_A
+                    rocsparse_int col_P = csr_col_ind_P[p] - idx_base_P;
+
+                    if(col_P >= chunk_begin && col_P < chunk_end)
+                    {
+                        // Mark nnz table if entry at col_P
+                        table[col_P - chunk_begin] = true;
+
+                        // Atomically accumulate the intermediate products
+                        atomicAdd(&data[col_P - chunk_begin], val_RA * csr_val_P[p]);
+                    }
+                    else if(col_P >= chunk_end)
+                    {
+                        // Store the first column index of P that exceeds the current chunk
+                        min_col = min(min_col, col_P);
+                        break;
+                    }
+                }
+            }
+        }
+
+        // Gather wavefront-wide minimum for the next chunks starting column index
+        rocsparse_wfreduce_min<WFSIZE>(&min_col);
+
+        // Last thread in each wavefront finds block-wide minimum atomically
+        if(lid == WFSIZE - 1)
+        {
+            // Atomically determine the new chunks beginning (minimum column index of P
+            // that is larger than the current chunks end point)
+            atomicMin(&next_chunk, min_col);
+        }
+
+        // Wait for all threads to finish
+        __syncthreads();
+
+        // We can re-use the shared memory to communicate the scan offsets of each
+        // wavefront
+        int* scan_offsets = reinterpret_cast<int*>(data);
+
+        // "Pseudo compress" the table array such that we can copy the values over into C
+        // In fact, we do an exclusive scan to obtain the index where each non-zero has
+        // to be copied to
+        for(int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+        {
+            // Each thread loads its marker and value to know whether it has to process a
+            // non-zero entry or not
+            bool has_nnz = table[i];
+            T    value   = data[i];
+
+            // Each thread obtains a bit mask of all wavefront-wide non-zero entries
+            // to compute its wavefront-wide non-zero offset in C
+            unsigned long long mask = __ballot(has_nnz == true);
+
+            // The number of bits set to 1 is the amount of wavefront-wide non-zeros
+            int nnz = __popcll(mask);
+
+            // Obtain the lane mask, where all bits lesser equal the lane id are set to 1
+            unsigned long long lanemask_le
+                = UINT64_MAX >> (sizeof(unsigned long long) * CHAR_BIT - (__lane_id() + 1));
+
+            // Compute the intra wavefront offset of the lane id by bitwise AND with the lane mask
+            int offset = __popcll(lanemask_le & mask);
+
+            // Need to sync here to make sure reading from data array has finished
+            __syncthreads();
+
+            // Each wavefront writes its nnz into shared memory so we can compute the
+            // scan offset
+            scan_offsets[hipThreadIdx_x / warpSize] = nnz;
+
+            // Wait for all wavefronts to finish writing
+            __syncthreads();
+
+            // Each thread accumulates the offset of all previous wavefronts to obtain its
+            // offset into C
+            for(unsigned int w = 1; w < BLOCKSIZE / warpSize; ++w)
+            {
+                if(hipThreadIdx_x >= w * warpSize)
+                {
+                    offset += scan_offsets[w - 1];
+                }
+            }
+
+            // Offset into C depends on all previously added non-zeros and need to be shifted by
+            // 1 (zero-based indexing)
+            rocsparse_int idx = row_begin_C + offset - 1;
+
+            // Only threads with a non-zero value write to C
+            if(has_nnz)
+            {
+                csr_col_ind_C[idx] = i + chunk_begin + idx_base_C;
+                csr_val_C[idx]     = value;
+            }
+
+            // Last thread in block writes the block-wide offset into C such that all subsequent
+            // entries are shifted by this offset
+            if(hipThreadIdx_x == BLOCKSIZE - 1)
+            {
+                scan_offsets[BLOCKSIZE / warpSize - 1] = offset;
+            }
+
+            // Wait for last thread in block to finish writing
+            __syncthreads();
+
+            // Each thread reads the block-wide offset and adds it to its local offset into C
+            row_begin_C += scan_offsets[BLOCKSIZE / warpSize - 1];
+        }
+
+        // Each thread loads the new chunk beginning and end point
+        chunk_begin = next_chunk;
+        chunk_end   = chunk_begin + CHUNKSIZE;
+
+        // Wait for all threads to finish load from shared memory
+        __syncthreads();
+    }
+}
+
+#endif // CSRRAP_DEVICE_H
@@ -198,6 +198,7 @@ extern "C" rocsparse_status rocsparse_csrgeam_nnz(rocsparse_handle          hand
 
     if(handle->buffer_size >= rocprim_size)
     {
+        RETURN_IF_ROCSPARSE_ERROR(handle->alloc_buffer());
         rocprim_buffer = handle->buffer;
         rocprim_alloc  = false;
     }
@@ -30,33 +30,83 @@
 #include <hip/hip_runtime.h>
 #include <rocprim/rocprim.hpp>
 
-template <unsigned int BLOCKSIZE>
-__launch_bounds__(BLOCKSIZE) __global__ void csrgemm_index_base(rocsparse_int* nnz)
+template <typename I, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void csrgemm_index_base(I* nnz)
 {
     --(*nnz);
 }
 
+// Build the structure of the transpose of the m x n operand and store it in the csrgemm
+// info, such that it can be re-used by the computation
+template <typename I, typename J>
+static rocsparse_status rocsparse_csrgemm_transpose_operand(rocsparse_handle     handle,
+                                                            J                    m,
+                                                            J                    n,
+                                                            I                    nnz,
+                                                            const I*             csr_row_ptr,
+                                                            const J*             csr_col_ind,
+                                                            rocsparse_index_base base,
+                                                            void**               trans_row_ptr,
+                                                            void**               trans_col_ind,
+                                                            void**               trans_perm,
+                                                            void*                temp_buffer)
+{
+    // Release the structure of a previous call
+    if(*trans_row_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(*trans_row_ptr));
+        *trans_row_ptr = nullptr;
+    }
+    if(*trans_col_ind != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(*trans_col_ind));
+        *trans_col_ind = nullptr;
+    }
+    if(*trans_perm != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(*trans_perm));
+        *trans_perm = nullptr;
+    }
+
+    RETURN_IF_HIP_ERROR(hipMalloc(trans_row_ptr, sizeof(I) * (n + 1)));
+    RETURN_IF_HIP_ERROR(hipMalloc(trans_col_ind, sizeof(J) * nnz));
+    RETURN_IF_HIP_ERROR(hipMalloc(trans_perm, sizeof(I) * nnz));
+
+    return rocsparse_csrgemm_transpose(handle,
+                                       m,
+                                       n,
+                                       nnz,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       base,
+                                       reinterpret_cast<I*>(*trans_row_ptr),
+                                       reinterpret_cast<J*>(*trans_col_ind),
+                                       reinterpret_cast<I*>(*trans_perm),
+                                       temp_buffer);
+}
+
+template <typename I, typename J>
 static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          handle,
                                                    rocsparse_operation       trans_A,
                                                    rocsparse_operation       trans_B,
-                                                   rocsparse_int             m,
-                                                   rocsparse_int             n,
-                                                   rocsparse_int             k,
+                                                   J                         m,
+                                                   J                         n,
+                                                   J                         k,
                                                    const rocsparse_mat_descr descr_A,
-                                                   rocsparse_int             nnz_A,
-                                                   const rocsparse_int*      csr_row_ptr_A,
-                                                   const rocsparse_int*      csr_col_ind_A,
+                                                   I                         nnz_A,
+                                                   const I*                  csr_row_ptr_A,
+                                                   const J*                  csr_col_ind_A,
                                                    const rocsparse_mat_descr descr_B,
-                                                   rocsparse_int             nnz_B,
-                                                   const rocsparse_int*      csr_row_ptr_B,
-                                                   const rocsparse_int*      csr_col_ind_B,
+                                                   I                         nnz_B,
+                                                   const I*                  csr_row_ptr_B,
+                                                   const J*                  csr_col_ind_B,
                                                    const rocsparse_mat_descr descr_D,
-                                                   rocsparse_int             nnz_D,
-                                                   const rocsparse_int*      csr_row_ptr_D,
-                                                   const rocsparse_int*      csr_col_ind_D,
+                                                   I                         nnz_D,
+                                                   const I*                  csr_row_ptr_D,
+                                                   const J*                  csr_col_ind_D,
                                                    const rocsparse_mat_descr descr_C,
-                                                   rocsparse_int*            csr_row_ptr_C,
-                                                   rocsparse_int*            nnz_C,
+                                                   I*                        csr_row_ptr_C,
+                                                   I*                        nnz_C,
                                                    const rocsparse_mat_info  info_C,
                                                    void*                     temp_buffer)
 {
@@ -81,7 +131,7 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
     // Compute number of intermediate products for each row
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 8
-    hipLaunchKernelGGL((csrgemm_intermediate_products<CSRGEMM_DIM, CSRGEMM_SUB>),
+    hipLaunchKernelGGL((csrgemm_intermediate_products<I, J, CSRGEMM_DIM, CSRGEMM_SUB>),
                        dim3((m - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
                        dim3(CSRGEMM_DIM),
                        0,
@@ -105,7 +155,7 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
                                         csr_row_ptr_C + m,
                                         0,
                                         m,
-                                        rocprim::maximum<rocsparse_int>(),
+                                        rocprim::maximum<I>(),
                                         stream));
     rocprim_buffer = reinterpret_cast<void*>(buffer);
     RETURN_IF_HIP_ERROR(rocprim::reduce(rocprim_buffer,
@@ -114,40 +164,40 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
                                         csr_row_ptr_C + m,
                                         0,
                                         m,
-                                        rocprim::maximum<rocsparse_int>(),
+                                        rocprim::maximum<I>(),
                                         stream));
 
-    rocsparse_int int_max;
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        &int_max, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+    I int_max;
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(&int_max, csr_row_ptr_C + m, sizeof(I), hipMemcpyDeviceToHost, stream));
 
     // Wait for host transfer to finish
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     // Group offset buffer
-    rocsparse_int* d_group_offset = reinterpret_cast<rocsparse_int*>(buffer);
-    buffer += sizeof(rocsparse_int) * 256;
+    J* d_group_offset = reinterpret_cast<J*>(buffer);
+    buffer += sizeof(J) * 256;
 
     // Group size buffer
-    rocsparse_int h_group_size[CSRGEMM_MAXGROUPS];
+    J h_group_size[CSRGEMM_MAXGROUPS];
 
     // Initialize group sizes with zero
-    memset(&h_group_size[0], 0, sizeof(rocsparse_int) * CSRGEMM_MAXGROUPS);
+    memset(&h_group_size[0], 0, sizeof(J) * CSRGEMM_MAXGROUPS);
 
     // Permutation array
-    rocsparse_int* d_perm = nullptr;
+    J* d_perm = nullptr;
 
     // If maximum of intermediate products exceeds 32, we process the rows in groups of
     // similar sized intermediate products
     if(int_max > 32)
     {
         // Group size buffer
-        rocsparse_int* d_group_size = reinterpret_cast<rocsparse_int*>(buffer);
-        buffer += sizeof(rocsparse_int) * 256 * CSRGEMM_MAXGROUPS;
+        J* d_group_size = reinterpret_cast<J*>(buffer);
+        buffer += sizeof(J) * 256 * CSRGEMM_MAXGROUPS;
 
         // Determine number of rows per group
 #define CSRGEMM_DIM 256
-        hipLaunchKernelGGL((csrgemm_group_reduce_part1<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
+        hipLaunchKernelGGL((csrgemm_group_reduce_part1<I, J, CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
                            dim3(CSRGEMM_DIM),
                            dim3(CSRGEMM_DIM),
                            0,
@@ -156,7 +206,7 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
                            csr_row_ptr_C,
                            d_group_size);
 
-        hipLaunchKernelGGL((csrgemm_group_reduce_part3<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
+        hipLaunchKernelGGL((csrgemm_group_reduce_part3<J, CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
                            dim3(1),
                            dim3(CSRGEMM_DIM),
                            0,
@@ -171,7 +221,7 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
                                                     d_group_offset,
                                                     0,
                                                     CSRGEMM_MAXGROUPS,
-                                                    rocprim::plus<rocsparse_int>(),
+                                                    rocprim::plus<J>(),
                                                     stream));
         rocprim_buffer = reinterpret_cast<void*>(buffer);
         RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
@@ -180,13 +230,13 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
                                                     d_group_offset,
                                                     0,
                                                     CSRGEMM_MAXGROUPS,
-                                                    rocprim::plus<rocsparse_int>(),
+                                                    rocprim::plus<J>(),
                                                     stream));
 
         // Copy group sizes to host
         RETURN_IF_HIP_ERROR(hipMemcpyAsync(&h_group_size,
                                            d_group_size,
-                                           sizeof(rocsparse_int) * CSRGEMM_MAXGROUPS,
+                                           sizeof(J) * CSRGEMM_MAXGROUPS,
                                            hipMemcpyDeviceToHost,
                                            stream));
 
@@ -194,20 +244,21 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
         RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
         // Permutation temporary arrays
-        rocsparse_int* tmp_vals = reinterpret_cast<rocsparse_int*>(buffer);
-        buffer += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+        J* tmp_vals = reinterpret_cast<J*>(buffer);
+        buffer += ((sizeof(J) * m - 1) / 256 + 1) * 256;
 
-        rocsparse_int* tmp_perm = reinterpret_cast<rocsparse_int*>(buffer);
-        buffer += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+        J* tmp_perm = reinterpret_cast<J*>(buffer);
+        buffer += ((sizeof(J) * m - 1) / 256 + 1) * 256;
 
-        rocsparse_int* tmp_keys = reinterpret_cast<rocsparse_int*>(buffer);
-        buffer += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+        I* tmp_keys = reinterpret_cast<I*>(buffer);
+        buffer += ((sizeof(I) * m - 1) / 256 + 1) * 256;
 
         // Create identity permutation for group access
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, m, tmp_perm));
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_create_identity_permutation_template(handle, m, tmp_perm));
 
-        rocprim::double_buffer<rocsparse_int> d_keys(csr_row_ptr_C, tmp_keys);
-        rocprim::double_buffer<rocsparse_int> d_vals(tmp_perm, tmp_vals);
+        rocprim::double_buffer<I> d_keys(csr_row_ptr_C, tmp_keys);
+        rocprim::double_buffer<J> d_vals(tmp_perm, tmp_vals);
 
         // Sort pairs (by groups)
         RETURN_IF_HIP_ERROR(
@@ -219,13 +270,13 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
         d_perm = d_vals.current();
 
         // Release tmp_keys buffer
-        buffer -= ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+        buffer -= ((sizeof(I) * m - 1) / 256 + 1) * 256;
     }
     else
     {
         // First group processes all rows
         h_group_size[0] = m;
-        RETURN_IF_HIP_ERROR(hipMemsetAsync(d_group_offset, 0, sizeof(rocsparse_int), stream));
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(d_group_offset, 0, sizeof(J), stream));
     }
 
     // Compute non-zero entries per row for each group
@@ -236,27 +287,31 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
 #define CSRGEMM_DIM 128
 #define CSRGEMM_SUB 4
 #define CSRGEMM_HASHSIZE 32
-        hipLaunchKernelGGL(
-            (csrgemm_nnz_wf_per_row<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_HASHSIZE, CSRGEMM_NNZ_HASH>),
-            dim3((h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
-            dim3(CSRGEMM_DIM),
-            0,
-            stream,
-            h_group_size[0],
-            &d_group_offset[0],
-            d_perm,
-            csr_row_ptr_A,
-            csr_col_ind_A,
-            csr_row_ptr_B,
-            csr_col_ind_B,
-            csr_row_ptr_D,
-            csr_col_ind_D,
-            csr_row_ptr_C,
-            base_A,
-            base_B,
-            base_D,
-            info_C->csrgemm_info->mul,
-            info_C->csrgemm_info->add);
+        hipLaunchKernelGGL((csrgemm_nnz_wf_per_row<I,
+                                                   J,
+                                                   CSRGEMM_DIM,
+                                                   CSRGEMM_SUB,
+                                                   CSRGEMM_HASHSIZE,
+                                                   CSRGEMM_NNZ_HASH>),
+                           dim3((h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           h_group_size[0],
+                           &d_group_offset[0],
+                           d_perm,
+                           csr_row_ptr_A,
+                           csr_col_ind_A,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           csr_row_ptr_D,
+                           csr_col_ind_D,
+                           csr_row_ptr_C,
+                           base_A,
+                           base_B,
+                           base_D,
+                           info_C->csrgemm_info->mul,
+                           info_C->csrgemm_info->add);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -268,27 +323,31 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 8
 #define CSRGEMM_HASHSIZE 64
-        hipLaunchKernelGGL(
-            (csrgemm_nnz_wf_per_row<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_HASHSIZE, CSRGEMM_NNZ_HASH>),
-            dim3((h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
-            dim3(CSRGEMM_DIM),
-            0,
-            stream,
-            h_group_size[1],
-            &d_group_offset[1],
-            d_perm,
-            csr_row_ptr_A,
-            csr_col_ind_A,
-            csr_row_ptr_B,
-            csr_col_ind_B,
-            csr_row_ptr_D,
-            csr_col_ind_D,
-            csr_row_ptr_C,
-            base_A,
-            base_B,
-            base_D,
-            info_C->csrgemm_info->mul,
-            info_C->csrgemm_info->add);
+        hipLaunchKernelGGL((csrgemm_nnz_wf_per_row<I,
+                                                   J,
+                                                   CSRGEMM_DIM,
+                                                   CSRGEMM_SUB,
+                                                   CSRGEMM_HASHSIZE,
+                                                   CSRGEMM_NNZ_HASH>),
+                           dim3((h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           h_group_size[1],
+                           &d_group_offset[1],
+                           d_perm,
+                           csr_row_ptr_A,
+                           csr_col_ind_A,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           csr_row_ptr_D,
+                           csr_col_ind_D,
+                           csr_row_ptr_C,
+                           base_A,
+                           base_B,
+                           base_D,
+                           info_C->csrgemm_info->mul,
+                           info_C->csrgemm_info->add);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -300,7 +359,9 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
 #define CSRGEMM_DIM 128
 #define CSRGEMM_SUB 8
 #define CSRGEMM_HASHSIZE 512
-        hipLaunchKernelGGL((csrgemm_nnz_block_per_row<CSRGEMM_DIM,
+        hipLaunchKernelGGL((csrgemm_nnz_block_per_row<I,
+                                                      J,
+                                                      CSRGEMM_DIM,
                                                       CSRGEMM_SUB,
                                                       CSRGEMM_HASHSIZE,
                                                       CSRGEMM_NNZ_HASH>),
@@ -333,7 +394,9 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
 #define CSRGEMM_DIM 128
 #define CSRGEMM_SUB 8
 #define CSRGEMM_HASHSIZE 1024
-        hipLaunchKernelGGL((csrgemm_nnz_block_per_row<CSRGEMM_DIM,
+        hipLaunchKernelGGL((csrgemm_nnz_block_per_row<I,
+                                                      J,
+                                                      CSRGEMM_DIM,
                                                       CSRGEMM_SUB,
                                                       CSRGEMM_HASHSIZE,
                                                       CSRGEMM_NNZ_HASH>),
@@ -366,7 +429,9 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 16
 #define CSRGEMM_HASHSIZE 2048
-        hipLaunchKernelGGL((csrgemm_nnz_block_per_row<CSRGEMM_DIM,
+        hipLaunchKernelGGL((csrgemm_nnz_block_per_row<I,
+                                                      J,
+                                                      CSRGEMM_DIM,
                                                       CSRGEMM_SUB,
                                                       CSRGEMM_HASHSIZE,
                                                       CSRGEMM_NNZ_HASH>),
@@ -399,7 +464,9 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
 #define CSRGEMM_DIM 512
 #define CSRGEMM_SUB 16
 #define CSRGEMM_HASHSIZE 4096
-        hipLaunchKernelGGL((csrgemm_nnz_block_per_row<CSRGEMM_DIM,
+        hipLaunchKernelGGL((csrgemm_nnz_block_per_row<I,
+                                                      J,
+                                                      CSRGEMM_DIM,
                                                       CSRGEMM_SUB,
                                                       CSRGEMM_HASHSIZE,
                                                       CSRGEMM_NNZ_HASH>),
@@ -432,7 +499,9 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
 #define CSRGEMM_DIM 1024
 #define CSRGEMM_SUB 32
 #define CSRGEMM_HASHSIZE 8192
-        hipLaunchKernelGGL((csrgemm_nnz_block_per_row<CSRGEMM_DIM,
+        hipLaunchKernelGGL((csrgemm_nnz_block_per_row<I,
+                                                      J,
+                                                      CSRGEMM_DIM,
                                                       CSRGEMM_SUB,
                                                       CSRGEMM_HASHSIZE,
                                                       CSRGEMM_NNZ_HASH>),
@@ -465,36 +534,39 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
 #define CSRGEMM_DIM 512
 #define CSRGEMM_SUB 16
 #define CSRGEMM_CHUNKSIZE 2048
-        rocsparse_int* workspace_B = nullptr;
+        I* workspace_B = nullptr;
 
         if(info_C->csrgemm_info->mul == true)
         {
             // Allocate additional buffer for C = alpha * A * B
-            RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace_B, sizeof(rocsparse_int) * nnz_A));
+            RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace_B, sizeof(I) * nnz_A));
         }
 
-        hipLaunchKernelGGL(
-            (csrgemm_nnz_block_per_row_multipass<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_CHUNKSIZE>),
-            dim3(h_group_size[7]),
-            dim3(CSRGEMM_DIM),
-            0,
-            stream,
-            n,
-            &d_group_offset[7],
-            d_perm,
-            csr_row_ptr_A,
-            csr_col_ind_A,
-            csr_row_ptr_B,
-            csr_col_ind_B,
-            csr_row_ptr_D,
-            csr_col_ind_D,
-            csr_row_ptr_C,
-            workspace_B,
-            base_A,
-            base_B,
-            base_D,
-            info_C->csrgemm_info->mul,
-            info_C->csrgemm_info->add);
+        hipLaunchKernelGGL((csrgemm_nnz_block_per_row_multipass<I,
+                                                                J,
+                                                                CSRGEMM_DIM,
+                                                                CSRGEMM_SUB,
+                                                                CSRGEMM_CHUNKSIZE>),
+                           dim3(h_group_size[7]),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           n,
+                           &d_group_offset[7],
+                           d_perm,
+                           csr_row_ptr_A,
+                           csr_col_ind_A,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           csr_row_ptr_D,
+                           csr_col_ind_D,
+                           csr_row_ptr_C,
+                           workspace_B,
+                           base_A,
+                           base_B,
+                           base_D,
+                           info_C->csrgemm_info->mul,
+                           info_C->csrgemm_info->add);
 
         if(info_C->csrgemm_info->mul == true)
         {
@@ -512,7 +584,7 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
                                                 csr_row_ptr_C,
                                                 descr_C->base,
                                                 m + 1,
-                                                rocprim::plus<rocsparse_int>(),
+                                                rocprim::plus<I>(),
                                                 stream));
     rocprim_buffer = reinterpret_cast<void*>(buffer);
     RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
@@ -521,25 +593,24 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
                                                 csr_row_ptr_C,
                                                 descr_C->base,
                                                 m + 1,
-                                                rocprim::plus<rocsparse_int>(),
+                                                rocprim::plus<I>(),
                                                 stream));
 
     // Store nnz of C
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-            nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(nnz_C, csr_row_ptr_C + m, sizeof(I), hipMemcpyDeviceToDevice, stream));
 
         // Adjust nnz by index base
         if(descr_C->base == rocsparse_index_base_one)
         {
-            hipLaunchKernelGGL((csrgemm_index_base<1>), dim3(1), dim3(1), 0, stream, nnz_C);
+            hipLaunchKernelGGL((csrgemm_index_base<I, 1>), dim3(1), dim3(1), 0, stream, nnz_C);
         }
     }
     else
     {
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(hipMemcpy(nnz_C, csr_row_ptr_C + m, sizeof(I), hipMemcpyDeviceToHost));
 
         // Adjust nnz by index base
         *nnz_C -= descr_C->base;
@@ -548,23 +619,24 @@ static rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle          han
     return rocsparse_status_success;
 }
 
+template <typename I, typename J>
 static rocsparse_status rocsparse_csrgemm_nnz_mult(rocsparse_handle          handle,
                                                    rocsparse_operation       trans_A,
                                                    rocsparse_operation       trans_B,
-                                                   rocsparse_int             m,
-                                                   rocsparse_int             n,
-                                                   rocsparse_int             k,
+                                                   J                         m,
+                                                   J                         n,
+                                                   J                         k,
                                                    const rocsparse_mat_descr descr_A,
-                                                   rocsparse_int             nnz_A,
-                                                   const rocsparse_int*      csr_row_ptr_A,
-                                                   const rocsparse_int*      csr_col_ind_A,
+                                                   I                         nnz_A,
+                                                   const I*                  csr_row_ptr_A,
+                                                   const J*                  csr_col_ind_A,
                                                    const rocsparse_mat_descr descr_B,
-                                                   rocsparse_int             nnz_B,
-                                                   const rocsparse_int*      csr_row_ptr_B,
-                                                   const rocsparse_int*      csr_col_ind_B,
+                                                   I                         nnz_B,
+                                                   const I*                  csr_row_ptr_B,
+                                                   const J*                  csr_col_ind_B,
                                                    const rocsparse_mat_descr descr_C,
-                                                   rocsparse_int*            csr_row_ptr_C,
-                                                   rocsparse_int*            nnz_C,
+                                                   I*                        csr_row_ptr_C,
+                                                   I*                        nnz_C,
                                                    const rocsparse_mat_info  info_C,
                                                    void*                     temp_buffer)
 {
@@ -617,6 +689,15 @@ static rocsparse_status rocsparse_csrgemm_nnz_mult(rocsparse_handle          han
         return rocsparse_status_not_implemented;
     }
 
+    // Check that the operations match the ones that have been used in
+    // csrgemm_buffer_size
+    rocsparse_csrgemm_info info = info_C->csrgemm_info;
+
+    if(info->trans_A != trans_A || info->trans_B != trans_B)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
     // Stream
     hipStream_t stream = handle->stream;
 
@@ -625,7 +706,7 @@ static rocsparse_status rocsparse_csrgemm_nnz_mult(rocsparse_handle          han
     {
         if(handle->pointer_mode == rocsparse_pointer_mode_device)
         {
-            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(rocsparse_int), stream));
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(I), stream));
         }
         else
         {
@@ -635,42 +716,93 @@ static rocsparse_status rocsparse_csrgemm_nnz_mult(rocsparse_handle          han
         return rocsparse_status_success;
     }
 
+    // Structure of op(A) and op(B), A is a k x m matrix and B is a n x k matrix for
+    // transposed operands
+    const I* row_ptr_A = csr_row_ptr_A;
+    const J* col_ind_A = csr_col_ind_A;
+    const I* row_ptr_B = csr_row_ptr_B;
+    const J* col_ind_B = csr_col_ind_B;
+
+    info->m           = m;
+    info->k           = k;
+    info->nnz_A       = nnz_A;
+    info->nnz_B       = nnz_B;
+    info->offset_size = sizeof(I);
+    info->index_size  = sizeof(J);
+
+    if(trans_A != rocsparse_operation_none)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_transpose_operand(handle,
+                                                                      k,
+                                                                      m,
+                                                                      nnz_A,
+                                                                      csr_row_ptr_A,
+                                                                      csr_col_ind_A,
+                                                                      descr_A->base,
+                                                                      &info->trans_row_ptr_A,
+                                                                      &info->trans_col_ind_A,
+                                                                      &info->trans_perm_A,
+                                                                      temp_buffer));
+
+        row_ptr_A = reinterpret_cast<const I*>(info->trans_row_ptr_A);
+        col_ind_A = reinterpret_cast<const J*>(info->trans_col_ind_A);
+    }
+
+    if(trans_B != rocsparse_operation_none)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_transpose_operand(handle,
+                                                                      n,
+                                                                      k,
+                                                                      nnz_B,
+                                                                      csr_row_ptr_B,
+                                                                      csr_col_ind_B,
+                                                                      descr_B->base,
+                                                                      &info->trans_row_ptr_B,
+                                                                      &info->trans_col_ind_B,
+                                                                      &info->trans_perm_B,
+                                                                      temp_buffer));
+
+        row_ptr_B = reinterpret_cast<const I*>(info->trans_row_ptr_B);
+        col_ind_B = reinterpret_cast<const J*>(info->trans_col_ind_B);
+    }
+
     // Perform nnz calculation
-    return rocsparse_csrgemm_nnz_calc(handle,
-                                      trans_A,
-                                      trans_B,
-                                      m,
-                                      n,
-                                      k,
-                                      descr_A,
-                                      nnz_A,
-                                      csr_row_ptr_A,
-                                      csr_col_ind_A,
-                                      descr_B,
-                                      nnz_B,
-                                      csr_row_ptr_B,
-                                      csr_col_ind_B,
-                                      nullptr,
-                                      0,
-                                      nullptr,
-                                      nullptr,
-                                      descr_C,
-                                      csr_row_ptr_C,
-                                      nnz_C,
-                                      info_C,
-                                      temp_buffer);
+    return rocsparse_csrgemm_nnz_calc<I, J>(handle,
+                                            trans_A,
+                                            trans_B,
+                                            m,
+                                            n,
+                                            k,
+                                            descr_A,
+                                            nnz_A,
+                                            row_ptr_A,
+                                            col_ind_A,
+                                            descr_B,
+                                            nnz_B,
+                                            row_ptr_B,
+                                            col_ind_B,
+                                            nullptr,
+                                            0,
+                                            nullptr,
+                                            nullptr,
+                                            descr_C,
+                                            csr_row_ptr_C,
+                                            nnz_C,
+                                            info_C,
+                                            temp_buffer);
 }
 
+template <typename I, typename J>
 static rocsparse_status rocsparse_csrgemm_nnz_scal(rocsparse_handle          handle,
-                                                   rocsparse_int             m,
-                                                   rocsparse_int             n,
+                                                   J                         m,
+                                                   J                         n,
                                                    const rocsparse_mat_descr descr_D,
-                                                   rocsparse_int             nnz_D,
-                                                   const rocsparse_int*      csr_row_ptr_D,
-                                                   const rocsparse_int*      csr_col_ind_D,
+                                                   I                         nnz_D,
+                                                   const I*                  csr_row_ptr_D,
+                                                   const J*                  csr_col_ind_D,
                                                    const rocsparse_mat_descr descr_C,
-                                                   rocsparse_int*            csr_row_ptr_C,
-                                                   rocsparse_int*            nnz_C,
+                                                   I*                        csr_row_ptr_C,
+                                                   I*                        nnz_C,
                                                    const rocsparse_mat_info  info_C,
                                                    void*                     temp_buffer)
 {
@@ -722,7 +854,7 @@ static rocsparse_status rocsparse_csrgemm_nnz_scal(rocsparse_handle          han
     {
         if(handle->pointer_mode == rocsparse_pointer_mode_device)
         {
-            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(rocsparse_int), stream));
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(I), stream));
         }
         else
         {
@@ -736,7 +868,7 @@ static rocsparse_status rocsparse_csrgemm_nnz_scal(rocsparse_handle          han
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
         RETURN_IF_HIP_ERROR(
-            hipMemcpyAsync(nnz_C, &nnz_D, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+            hipMemcpyAsync(nnz_C, &nnz_D, sizeof(I), hipMemcpyHostToDevice, stream));
     }
     else
     {
@@ -745,7 +877,7 @@ static rocsparse_status rocsparse_csrgemm_nnz_scal(rocsparse_handle          han
 
     // Copy row pointers
 #define CSRGEMM_DIM 1024
-    hipLaunchKernelGGL((csrgemm_copy<CSRGEMM_DIM>),
+    hipLaunchKernelGGL((csrgemm_copy<I, I, CSRGEMM_DIM>),
                        dim3(m / CSRGEMM_DIM + 1),
                        dim3(CSRGEMM_DIM),
                        0,
@@ -760,29 +892,30 @@ static rocsparse_status rocsparse_csrgemm_nnz_scal(rocsparse_handle          han
     return rocsparse_status_success;
 }
 
-extern "C" rocsparse_status rocsparse_csrgemm_nnz(rocsparse_handle          handle,
-                                                  rocsparse_operation       trans_A,
-                                                  rocsparse_operation       trans_B,
-                                                  rocsparse_int             m,
-                                                  rocsparse_int             n,
-                                                  rocsparse_int             k,
-                                                  const rocsparse_mat_descr descr_A,
-                                                  rocsparse_int             nnz_A,
-                                                  const rocsparse_int*      csr_row_ptr_A,
-                                                  const rocsparse_int*      csr_col_ind_A,
-                                                  const rocsparse_mat_descr descr_B,
-                                                  rocsparse_int             nnz_B,
-                                                  const rocsparse_int*      csr_row_ptr_B,
-                                                  const rocsparse_int*      csr_col_ind_B,
-                                                  const rocsparse_mat_descr descr_D,
-                                                  rocsparse_int             nnz_D,
-                                                  const rocsparse_int*      csr_row_ptr_D,
-                                                  const rocsparse_int*      csr_col_ind_D,
-                                                  const rocsparse_mat_descr descr_C,
-                                                  rocsparse_int*            csr_row_ptr_C,
-                                                  rocsparse_int*            nnz_C,
-                                                  const rocsparse_mat_info  info_C,
-                                                  void*                     temp_buffer)
+template <typename I, typename J>
+static rocsparse_status rocsparse_csrgemm_nnz_template(rocsparse_handle          handle,
+                                                       rocsparse_operation       trans_A,
+                                                       rocsparse_operation       trans_B,
+                                                       J                         m,
+                                                       J                         n,
+                                                       J                         k,
+                                                       const rocsparse_mat_descr descr_A,
+                                                       I                         nnz_A,
+                                                       const I*                  csr_row_ptr_A,
+                                                       const J*                  csr_col_ind_A,
+                                                       const rocsparse_mat_descr descr_B,
+                                                       I                         nnz_B,
+                                                       const I*                  csr_row_ptr_B,
+                                                       const J*                  csr_col_ind_B,
+                                                       const rocsparse_mat_descr descr_D,
+                                                       I                         nnz_D,
+                                                       const I*                  csr_row_ptr_D,
+                                                       const J*                  csr_col_ind_D,
+                                                       const rocsparse_mat_descr descr_C,
+                                                       I*                        csr_row_ptr_C,
+                                                       I*                        nnz_C,
+                                                       const rocsparse_mat_info  info_C,
+                                                       void*                     temp_buffer)
 {
     // Check for valid handle and info structure
     if(handle == nullptr)
@@ -792,7 +925,7 @@ extern "C" rocsparse_status rocsparse_csrgemm_nnz(rocsparse_handle          hand
 
     // Logging
     log_trace(handle,
-              "rocsparse_csrgemm_nnz",
+              appendIJ<I, J>("rocsparse_csrgemm_nnz"),
               trans_A,
               trans_B,
               m,
@@ -1077,6 +1210,293 @@ extern "C" rocsparse_status rocsparse_zcsrgemm_buffer_size(rocsparse_handle
                                                   buffer_size);
 }
 
+extern "C" rocsparse_status rocsparse_scsrgemm_buffer_size_i64(rocsparse_handle          handle,
+                                                               rocsparse_operation       trans_A,
+                                                               rocsparse_operation       trans_B,
+                                                               int32_t                   m,
+                                                               int32_t                   n,
+                                                               int32_t                   k,
+                                                               const float*              alpha,
+                                                               const rocsparse_mat_descr descr_A,
+                                                               int64_t                   nnz_A,
+                                                               const int64_t* csr_row_ptr_A,
+                                                               const int32_t* csr_col_ind_A,
+                                                               const rocsparse_mat_descr descr_B,
+                                                               int64_t                   nnz_B,
+                                                               const int64_t* csr_row_ptr_B,
+                                                               const int32_t* csr_col_ind_B,
+                                                               const float*   beta,
+                                                               const rocsparse_mat_descr descr_D,
+                                                               int64_t                   nnz_D,
+                                                               const int64_t*     csr_row_ptr_D,
+                                                               const int32_t*     csr_col_ind_D,
+                                                               rocsparse_mat_info info_C,
+                                                               size_t*            buffer_size)
+{
+    return rocsparse_csrgemm_buffer_size_template(handle,
+                                                  trans_A,
+                                                  trans_B,
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  descr_A,
+                                                  nnz_A,
+                                                  csr_row_ptr_A,
+                                                  csr_col_ind_A,
+                                                  descr_B,
+                                                  nnz_B,
+                                                  csr_row_ptr_B,
+                                                  csr_col_ind_B,
+                                                  beta,
+                                                  descr_D,
+                                                  nnz_D,
+                                                  csr_row_ptr_D,
+                                                  csr_col_ind_D,
+                                                  info_C,
+                                                  buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrgemm_buffer_size_i64(rocsparse_handle          handle,
+                                                               rocsparse_operation       trans_A,
+                                                               rocsparse_operation       trans_B,
+                                                               int32_t                   m,
+                                                               int32_t                   n,
+                                                               int32_t                   k,
+                                                               const double*             alpha,
+                                                               const rocsparse_mat_descr descr_A,
+                                                               int64_t                   nnz_A,
+                                                               const int64_t* csr_row_ptr_A,
+                                                               const int32_t* csr_col_ind_A,
+                                                               const rocsparse_mat_descr descr_B,
+                                                               int64_t                   nnz_B,
+                                                               const int64_t* csr_row_ptr_B,
+                                                               const int32_t* csr_col_ind_B,
+                                                               const double*  beta,
+                                                               const rocsparse_mat_descr descr_D,
+                                                               int64_t                   nnz_D,
+                                                               const int64_t*     csr_row_ptr_D,
+                                                               const int32_t*     csr_col_ind_D,
+                                                               rocsparse_mat_info info_C,
+                                                               size_t*            buffer_size)
+{
+    return rocsparse_csrgemm_buffer_size_template(handle,
+                                                  trans_A,
+                                                  trans_B,
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  descr_A,
+                                                  nnz_A,
+                                                  csr_row_ptr_A,
+                                                  csr_col_ind_A,
+                                                  descr_B,
+                                                  nnz_B,
+                                                  csr_row_ptr_B,
+                                                  csr_col_ind_B,
+                                                  beta,
+                                                  descr_D,
+                                                  nnz_D,
+                                                  csr_row_ptr_D,
+                                                  csr_col_ind_D,
+                                                  info_C,
+                                                  buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_ccsrgemm_buffer_size_i64(rocsparse_handle    handle,
+                                                               rocsparse_operation trans_A,
+                                                               rocsparse_operation trans_B,
+                                                               int32_t             m,
+                                                               int32_t             n,
+                                                               int32_t             k,
+                                                               const rocsparse_float_complex* alpha,
+                                                               const rocsparse_mat_descr descr_A,
+                                                               int64_t                   nnz_A,
+                                                               const int64_t* csr_row_ptr_A,
+                                                               const int32_t* csr_col_ind_A,
+                                                               const rocsparse_mat_descr descr_B,
+                                                               int64_t                   nnz_B,
+                                                               const int64_t* csr_row_ptr_B,
+                                                               const int32_t* csr_col_ind_B,
+                                                               const rocsparse_float_complex* beta,
+                                                               const rocsparse_mat_descr descr_D,
+                                                               int64_t                   nnz_D,
+                                                               const int64_t*     csr_row_ptr_D,
+                                                               const int32_t*     csr_col_ind_D,
+                                                               rocsparse_mat_info info_C,
+                                                               size_t*            buffer_size)
+{
+    return rocsparse_csrgemm_buffer_size_template(handle,
+                                                  trans_A,
+                                                  trans_B,
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  descr_A,
+                                                  nnz_A,
+                                                  csr_row_ptr_A,
+                                                  csr_col_ind_A,
+                                                  descr_B,
+                                                  nnz_B,
+                                                  csr_row_ptr_B,
+                                                  csr_col_ind_B,
+                                                  beta,
+                                                  descr_D,
+                                                  nnz_D,
+                                                  csr_row_ptr_D,
+                                                  csr_col_ind_D,
+                                                  info_C,
+                                                  buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrgemm_buffer_size_i64(
+    rocsparse_handle                handle,
+    rocsparse_operation             trans_A,
+    rocsparse_operation             trans_B,
+    int32_t                         m,
+    int32_t                         n,
+    int32_t                         k,
+    const rocsparse_double_complex* alpha,
+    const rocsparse_mat_descr       descr_A,
+    int64_t                         nnz_A,
+    const int64_t*                  csr_row_ptr_A,
+    const int32_t*                  csr_col_ind_A,
+    const rocsparse_mat_descr       descr_B,
+    int64_t                         nnz_B,
+    const int64_t*                  csr_row_ptr_B,
+    const int32_t*                  csr_col_ind_B,
+    const rocsparse_double_complex* beta,
+    const rocsparse_mat_descr       descr_D,
+    int64_t                         nnz_D,
+    const int64_t*                  csr_row_ptr_D,
+    const int32_t*                  csr_col_ind_D,
+    rocsparse_mat_info              info_C,
+    size_t*                         buffer_size)
+{
+    return rocsparse_csrgemm_buffer_size_template(handle,
+                                                  trans_A,
+                                                  trans_B,
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  descr_A,
+                                                  nnz_A,
+                                                  csr_row_ptr_A,
+                                                  csr_col_ind_A,
+                                                  descr_B,
+                                                  nnz_B,
+                                                  csr_row_ptr_B,
+                                                  csr_col_ind_B,
+                                                  beta,
+                                                  descr_D,
+                                                  nnz_D,
+                                                  csr_row_ptr_D,
+                                                  csr_col_ind_D,
+                                                  info_C,
+                                                  buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_csrgemm_nnz(rocsparse_handle          handle,
+                                                  rocsparse_operation       trans_A,
+                                                  rocsparse_operation       trans_B,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             n,
+                                                  rocsparse_int             k,
+                                                  const rocsparse_mat_descr descr_A,
+                                                  rocsparse_int             nnz_A,
+                                                  const rocsparse_int*      csr_row_ptr_A,
+                                                  const rocsparse_int*      csr_col_ind_A,
+                                                  const rocsparse_mat_descr descr_B,
+                                                  rocsparse_int             nnz_B,
+                                                  const rocsparse_int*      csr_row_ptr_B,
+                                                  const rocsparse_int*      csr_col_ind_B,
+                                                  const rocsparse_mat_descr descr_D,
+                                                  rocsparse_int             nnz_D,
+                                                  const rocsparse_int*      csr_row_ptr_D,
+                                                  const rocsparse_int*      csr_col_ind_D,
+                                                  const rocsparse_mat_descr descr_C,
+                                                  rocsparse_int*            csr_row_ptr_C,
+                                                  rocsparse_int*            nnz_C,
+                                                  const rocsparse_mat_info  info_C,
+                                                  void*                     temp_buffer)
+{
+    return rocsparse_csrgemm_nnz_template(handle,
+                                          trans_A,
+                                          trans_B,
+                                          m,
+                                          n,
+                                          k,
+                                          descr_A,
+                                          nnz_A,
+                                          csr_row_ptr_A,
+                                          csr_col_ind_A,
+                                          descr_B,
+                                          nnz_B,
+                                          csr_row_ptr_B,
+                                          csr_col_ind_B,
+                                          descr_D,
+                                          nnz_D,
+                                          csr_row_ptr_D,
+                                          csr_col_ind_D,
+                                          descr_C,
+                                          csr_row_ptr_C,
+                                          nnz_C,
+                                          info_C,
+                                          temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_csrgemm_nnz_i64(rocsparse_handle          handle,
+                                                      rocsparse_operation       trans_A,
+                                                      rocsparse_operation       trans_B,
+                                                      int32_t                   m,
+                                                      int32_t                   n,
+                                                      int32_t                   k,
+                                                      const rocsparse_mat_descr descr_A,
+                                                      int64_t                   nnz_A,
+                                                      const int64_t*            csr_row_ptr_A,
+                                                      const int32_t*            csr_col_ind_A,
+                                                      const rocsparse_mat_descr descr_B,
+                                                      int64_t                   nnz_B,
+                                                      const int64_t*            csr_row_ptr_B,
+                                                      const int32_t*            csr_col_ind_B,
+                                                      const rocsparse_mat_descr descr_D,
+                                                      int64_t                   nnz_D,
+                                                      const int64_t*            csr_row_ptr_D,
+                                                      const int32_t*            csr_col_ind_D,
+                                                      const rocsparse_mat_descr descr_C,
+                                                      int64_t*                  csr_row_ptr_C,
+                                                      int64_t*                  nnz_C,
+                                                      const rocsparse_mat_info  info_C,
+                                                      void*                     temp_buffer)
+{
+    return rocsparse_csrgemm_nnz_template(handle,
+                                          trans_A,
+                                          trans_B,
+                                          m,
+                                          n,
+                                          k,
+                                          descr_A,
+                                          nnz_A,
+                                          csr_row_ptr_A,
+                                          csr_col_ind_A,
+                                          descr_B,
+                                          nnz_B,
+                                          csr_row_ptr_B,
+                                          csr_col_ind_B,
+                                          descr_D,
+                                          nnz_D,
+                                          csr_row_ptr_D,
+                                          csr_col_ind_D,
+                                          descr_C,
+                                          csr_row_ptr_C,
+                                          nnz_C,
+                                          info_C,
+                                          temp_buffer);
+}
+
 extern "C" rocsparse_status rocsparse_scsrgemm(rocsparse_handle          handle,
                                                rocsparse_operation       trans_A,
                                                rocsparse_operation       trans_B,
@@ -1320,3 +1740,247 @@ extern "C" rocsparse_status rocsparse_zcsrgemm(rocsparse_handle                h
                                       info_C,
                                       temp_buffer);
 }
+
+extern "C" rocsparse_status rocsparse_scsrgemm_i64(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_B,
+                                                   int32_t                   m,
+                                                   int32_t                   n,
+                                                   int32_t                   k,
+                                                   const float*              alpha,
+                                                   const rocsparse_mat_descr descr_A,
+                                                   int64_t                   nnz_A,
+                                                   const float*              csr_val_A,
+                                                   const int64_t*            csr_row_ptr_A,
+                                                   const int32_t*            csr_col_ind_A,
+                                                   const rocsparse_mat_descr descr_B,
+                                                   int64_t                   nnz_B,
+                                                   const float*              csr_val_B,
+                                                   const int64_t*            csr_row_ptr_B,
+                                                   const int32_t*            csr_col_ind_B,
+                                                   const float*              beta,
+                                                   const rocsparse_mat_descr descr_D,
+                                                   int64_t                   nnz_D,
+                                                   const float*              csr_val_D,
+                                                   const int64_t*            csr_row_ptr_D,
+                                                   const int32_t*            csr_col_ind_D,
+                                                   const rocsparse_mat_descr descr_C,
+                                                   float*                    csr_val_C,
+                                                   const int64_t*            csr_row_ptr_C,
+                                                   int32_t*                  csr_col_ind_C,
+                                                   const rocsparse_mat_info  info_C,
+                                                   void*                     temp_buffer)
+{
+    return rocsparse_csrgemm_template(handle,
+                                      trans_A,
+                                      trans_B,
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      descr_A,
+                                      nnz_A,
+                                      csr_val_A,
+                                      csr_row_ptr_A,
+                                      csr_col_ind_A,
+                                      descr_B,
+                                      nnz_B,
+                                      csr_val_B,
+                                      csr_row_ptr_B,
+                                      csr_col_ind_B,
+                                      beta,
+                                      descr_D,
+                                      nnz_D,
+                                      csr_val_D,
+                                      csr_row_ptr_D,
+                                      csr_col_ind_D,
+                                      descr_C,
+                                      csr_val_C,
+                                      csr_row_ptr_C,
+                                      csr_col_ind_C,
+                                      info_C,
+                                      temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrgemm_i64(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_B,
+                                                   int32_t                   m,
+                                                   int32_t                   n,
+                                                   int32_t                   k,
+                                                   const double*             alpha,
+                                                   const rocsparse_mat_descr descr_A,
+                                                   int64_t                   nnz_A,
+                                                   const double*             csr_val_A,
+                                                   const int64_t*            csr_row_ptr_A,
+                                                   const int32_t*            csr_col_ind_A,
+                                                   const rocsparse_mat_descr descr_B,
+                                                   int64_t                   nnz_B,
+                                                   const double*             csr_val_B,
+                                                   const int64_t*            csr_row_ptr_B,
+                                                   const int32_t*            csr_col_ind_B,
+                                                   const double*             beta,
+                                                   const rocsparse_mat_descr descr_D,
+                                                   int64_t                   nnz_D,
+                                                   const double*             csr_val_D,
+                                                   const int64_t*            csr_row_ptr_D,
+                                                   const int32_t*            csr_col_ind_D,
+                                                   const rocsparse_mat_descr descr_C,
+                                                   double*                   csr_val_C,
+                                                   const int64_t*            csr_row_ptr_C,
+                                                   int32_t*                  csr_col_ind_C,
+                                                   const rocsparse_mat_info  info_C,
+                                                   void*                     temp_buffer)
+{
+    return rocsparse_csrgemm_template(handle,
+                                      trans_A,
+                                      trans_B,
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      descr_A,
+                                      nnz_A,
+                                      csr_val_A,
+                                      csr_row_ptr_A,
+                                      csr_col_ind_A,
+                                      descr_B,
+                                      nnz_B,
+                                      csr_val_B,
+                                      csr_row_ptr_B,
+                                      csr_col_ind_B,
+                                      beta,
+                                      descr_D,
+                                      nnz_D,
+                                      csr_val_D,
+                                      csr_row_ptr_D,
+                                      csr_col_ind_D,
+                                      descr_C,
+                                      csr_val_C,
+                                      csr_row_ptr_C,
+                                      csr_col_ind_C,
+                                      info_C,
+                                      temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_ccsrgemm_i64(rocsparse_handle               handle,
+                                                   rocsparse_operation            trans_A,
+                                                   rocsparse_operation            trans_B,
+                                                   int32_t                        m,
+                                                   int32_t                        n,
+                                                   int32_t                        k,
+                                                   const rocsparse_float_complex* alpha,
+                                                   const rocsparse_mat_descr      descr_A,
+                                                   int64_t                        nnz_A,
+                                                   const rocsparse_float_complex* csr_val_A,
+                                                   const int64_t*                 csr_row_ptr_A,
+                                                   const int32_t*                 csr_col_ind_A,
+                                                   const rocsparse_mat_descr      descr_B,
+                                                   int64_t                        nnz_B,
+                                                   const rocsparse_float_complex* csr_val_B,
+                                                   const int64_t*                 csr_row_ptr_B,
+                                                   const int32_t*                 csr_col_ind_B,
+                                                   const rocsparse_float_complex* beta,
+                                                   const rocsparse_mat_descr      descr_D,
+                                                   int64_t                        nnz_D,
+                                                   const rocsparse_float_complex* csr_val_D,
+                                                   const int64_t*                 csr_row_ptr_D,
+                                                   const int32_t*                 csr_col_ind_D,
+                                                   const rocsparse_mat_descr      descr_C,
+                                                   rocsparse_float_complex*       csr_val_C,
+                                                   const int64_t*                 csr_row_ptr_C,
+                                                   int32_t*                       csr_col_ind_C,
+                                                   const rocsparse_mat_info       info_C,
+                                                   void*                          temp_buffer)
+{
+    return rocsparse_csrgemm_template(handle,
+                                      trans_A,
+                                      trans_B,
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      descr_A,
+                                      nnz_A,
+                                      csr_val_A,
+                                      csr_row_ptr_A,
+                                      csr_col_ind_A,
+                                      descr_B,
+                                      nnz_B,
+                                      csr_val_B,
+                                      csr_row_ptr_B,
+                                      csr_col_ind_B,
+                                      beta,
+                                      descr_D,
+                                      nnz_D,
+                                      csr_val_D,
+                                      csr_row_ptr_D,
+                                      csr_col_ind_D,
+                                      descr_C,
+                                      csr_val_C,
+                                      csr_row_ptr_C,
+                                      csr_col_ind_C,
+                                      info_C,
+                                      temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrgemm_i64(rocsparse_handle                handle,
+                                                   rocsparse_operation             trans_A,
+                                                   rocsparse_operation             trans_B,
+                                                   int32_t                         m,
+                                                   int32_t                         n,
+                                                   int32_t                         k,
+                                                   const rocsparse_double_complex* alpha,
+                                                   const rocsparse_mat_descr       descr_A,
+                                                   int64_t                         nnz_A,
+                                                   const rocsparse_double_complex* csr_val_A,
+                                                   const int64_t*                  csr_row_ptr_A,
+                                                   const int32_t*                  csr_col_ind_A,
+                                                   const rocsparse_mat_descr       descr_B,
+                                                   int64_t                         nnz_B,
+                                                   const rocsparse_double_complex* csr_val_B,
+                                                   const int64_t*                  csr_row_ptr_B,
+                                                   const int32_t*                  csr_col_ind_B,
+                                                   const rocsparse_double_complex* beta,
+                                                   const rocsparse_mat_descr       descr_D,
+                                                   int64_t                         nnz_D,
+                                                   const rocsparse_double_complex* csr_val_D,
+                                                   const int64_t*                  csr_row_ptr_D,
+                                                   const int32_t*                  csr_col_ind_D,
+                                                   const rocsparse_mat_descr       descr_C,
+                                                   rocsparse_double_complex*       csr_val_C,
+                                                   const int64_t*                  csr_row_ptr_C,
+                                                   int32_t*                        csr_col_ind_C,
+                                                   const rocsparse_mat_info        info_C,
+                                                   void*                           temp_buffer)
+{
+    return rocsparse_csrgemm_template(handle,
+                                      trans_A,
+                                      trans_B,
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      descr_A,
+                                      nnz_A,
+                                      csr_val_A,
+                                      csr_row_ptr_A,
+                                      csr_col_ind_A,
+                                      descr_B,
+                                      nnz_B,
+                                      csr_val_B,
+                                      csr_row_ptr_B,
+                                      csr_col_ind_B,
+                                      beta,
+                                      descr_D,
+                                      nnz_D,
+                                      csr_val_D,
+                                      csr_row_ptr_D,
+                                      csr_col_ind_D,
+                                      descr_C,
+                                      csr_val_C,
+                                      csr_row_ptr_C,
+                                      csr_col_ind_C,
+                                      info_C,
+                                      temp_buffer);
+}
@@ -31,6 +31,11 @@
 #include "rocsparse.h"
 #include "utility.h"
 
+#include "../conversion/rocsparse_coo2csr.hpp"
+#include "../conversion/rocsparse_csr2coo.hpp"
+#include "../conversion/rocsparse_identity.hpp"
+#include "../level1/rocsparse_gthr.hpp"
+
 #include <hip/hip_runtime.h>
 #include <rocprim/rocprim.hpp>
 #include <type_traits>
@@ -39,29 +44,182 @@
 #define CSRGEMM_NNZ_HASH 79
 #define CSRGEMM_FLL_HASH 137
 
-template <typename T,
+// Temporary storage buffer that is required by rocsparse_csrgemm_transpose() to transpose
+// a sparse CSR matrix with n columns and nnz non-zero entries
+template <typename I, typename J>
+static inline rocsparse_status rocsparse_csrgemm_transpose_buffer_size(rocsparse_handle handle,
+                                                                       J                n,
+                                                                       I                nnz,
+                                                                       size_t* buffer_size)
+{
+    // Column indices are sorted as keys, carrying the permutation along
+    J* keys = reinterpret_cast<J*>(buffer_size);
+    I* perm = reinterpret_cast<I*>(buffer_size);
+
+    rocprim::double_buffer<J> dummy_keys(keys, keys);
+    rocprim::double_buffer<I> dummy_vals(perm, perm);
+
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        nullptr, *buffer_size, dummy_keys, dummy_vals, nnz, 0, rocsparse_clz(n), handle->stream));
+
+    // rocPRIM does not support in-place sorting, so we need additional buffers
+    *buffer_size = ((*buffer_size - 1) / 256 + 1) * 256;
+    *buffer_size += sizeof(J) * ((nnz - 1) / 256 + 1) * 256;
+    *buffer_size += sizeof(I) * ((nnz - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+// Build the structure of the transpose of the m x n sparse CSR matrix A. The permutation
+// maps each entry of A^T to its position in A, such that the values of A can be gathered
+// during computation. All output arrays are allocated by the caller.
+template <typename I, typename J>
+static inline rocsparse_status rocsparse_csrgemm_transpose(rocsparse_handle     handle,
+                                                           J                    m,
+                                                           J                    n,
+                                                           I                    nnz,
+                                                           const I*             csr_row_ptr,
+                                                           const J*             csr_col_ind,
+                                                           rocsparse_index_base base,
+                                                           I*                   trans_row_ptr,
+                                                           J*                   trans_col_ind,
+                                                           I*                   trans_perm,
+                                                           void*                temp_buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // work1 buffer
+    J* tmp_work1 = reinterpret_cast<J*>(ptr);
+    ptr += sizeof(J) * ((nnz - 1) / 256 + 1) * 256;
+
+    // work2 buffer
+    I* tmp_work2 = reinterpret_cast<I*>(ptr);
+    ptr += sizeof(I) * ((nnz - 1) / 256 + 1) * 256;
+
+    // rocprim buffer
+    void* rocprim_buffer = reinterpret_cast<void*>(ptr);
+
+    // Load CSR column indices into work1 buffer
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        tmp_work1, csr_col_ind, sizeof(J) * nnz, hipMemcpyDeviceToDevice, stream));
+
+    // Create identity permutation
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_create_identity_permutation_template(handle, nnz, trans_perm));
+
+    // Stable sort COO by columns
+    rocprim::double_buffer<J> keys(tmp_work1, trans_col_ind);
+    rocprim::double_buffer<I> vals(trans_perm, tmp_work2);
+
+    unsigned int startbit = 0;
+    unsigned int endbit   = rocsparse_clz(n);
+
+    size_t rocprim_size;
+
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        nullptr, rocprim_size, keys, vals, nnz, startbit, endbit, stream));
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        rocprim_buffer, rocprim_size, keys, vals, nnz, startbit, endbit, stream));
+
+    // Copy permutation vector, if not already available
+    if(vals.current() != trans_perm)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            trans_perm, vals.current(), sizeof(I) * nnz, hipMemcpyDeviceToDevice, stream));
+    }
+
+    // Create row pointers of A^T
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_coo2csr_template(handle, keys.current(), nnz, n, trans_row_ptr, base));
+
+    // Create row indices of A, which are the column indices of A^T
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csr2coo_template(handle, csr_row_ptr, nnz, m, tmp_work1, base));
+
+    // Permute column indices
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_gthr_template(
+        handle, nnz, tmp_work1, trans_col_ind, trans_perm, rocsparse_index_base_zero));
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename T, unsigned int BLOCKSIZE, bool CONJ>
+__launch_bounds__(BLOCKSIZE) __global__ void csrgemm_gather(I size,
+                                                            const I* __restrict__ perm,
+                                                            const T* __restrict__ in,
+                                                            T* __restrict__ out)
+{
+    csrgemm_gather_device<I, T, BLOCKSIZE, CONJ>(size, perm, in, out);
+}
+
+// Gather the values of a transposed operand in the order of its transposed structure
+template <typename I, typename T>
+static rocsparse_status rocsparse_csrgemm_gather(rocsparse_handle    handle,
+                                                 rocsparse_operation trans,
+                                                 I                   nnz,
+                                                 const I*            perm,
+                                                 const T*            csr_val,
+                                                 T*                  trans_val)
+{
+#define CSRGEMM_DIM 1024
+    if(trans == rocsparse_operation_conjugate_transpose)
+    {
+        hipLaunchKernelGGL((csrgemm_gather<I, T, CSRGEMM_DIM, true>),
+                           dim3((nnz - 1) / CSRGEMM_DIM + 1),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           handle->stream,
+                           nnz,
+                           perm,
+                           csr_val,
+                           trans_val);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrgemm_gather<I, T, CSRGEMM_DIM, false>),
+                           dim3((nnz - 1) / CSRGEMM_DIM + 1),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           handle->stream,
+                           nnz,
+                           perm,
+                           csr_val,
+                           trans_val);
+    }
+#undef CSRGEMM_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename I,
+          typename     J,
+          typename     T,
           unsigned int BLOCKSIZE,
           unsigned int WFSIZE,
           unsigned int HASHSIZE,
           unsigned int HASHVAL>
 __launch_bounds__(BLOCKSIZE) __global__
-    void csrgemm_fill_wf_per_row_host_pointer(rocsparse_int m,
-                                              rocsparse_int nk,
-                                              const rocsparse_int* __restrict__ offset,
-                                              const rocsparse_int* __restrict__ perm,
+    void csrgemm_fill_wf_per_row_host_pointer(J m,
+                                              J nk,
+                                              const J* __restrict__ offset,
+                                              const J* __restrict__ perm,
                                               T alpha,
-                                              const rocsparse_int* __restrict__ csr_row_ptr_A,
-                                              const rocsparse_int* __restrict__ csr_col_ind_A,
+                                              const I* __restrict__ csr_row_ptr_A,
+                                              const J* __restrict__ csr_col_ind_A,
                                               const T* __restrict__ csr_val_A,
-                                              const rocsparse_int* __restrict__ csr_row_ptr_B,
-                                              const rocsparse_int* __restrict__ csr_col_ind_B,
+                                              const I* __restrict__ csr_row_ptr_B,
+                                              const J* __restrict__ csr_col_ind_B,
                                               const T* __restrict__ csr_val_B,
                                               T beta,
-                                              const rocsparse_int* __restrict__ csr_row_ptr_D,
-                                              const rocsparse_int* __restrict__ csr_col_ind_D,
+                                              const I* __restrict__ csr_row_ptr_D,
+                                              const J* __restrict__ csr_col_ind_D,
                                               const T* __restrict__ csr_val_D,
-                                              const rocsparse_int* __restrict__ csr_row_ptr_C,
-                                              rocsparse_int* __restrict__ csr_col_ind_C,
+                                              const I* __restrict__ csr_row_ptr_C,
+                                              J* __restrict__ csr_col_ind_C,
                                               T* __restrict__ csr_val_C,
                                               rocsparse_index_base idx_base_A,
                                               rocsparse_index_base idx_base_B,
@@ -70,55 +228,57 @@ __launch_bounds__(BLOCKSIZE) __global__
                                               bool                 mul,
                                               bool                 add)
 {
-    csrgemm_fill_wf_per_row_device<T, BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(m,
-                                                                            nk,
-                                                                            offset,
-                                                                            perm,
-                                                                            alpha,
-                                                                            csr_row_ptr_A,
-                                                                            csr_col_ind_A,
-                                                                            csr_val_A,
-                                                                            csr_row_ptr_B,
-                                                                            csr_col_ind_B,
-                                                                            csr_val_B,
-                                                                            beta,
-                                                                            csr_row_ptr_D,
-                                                                            csr_col_ind_D,
-                                                                            csr_val_D,
-                                                                            csr_row_ptr_C,
-                                                                            csr_col_ind_C,
-                                                                            csr_val_C,
-                                                                            idx_base_A,
-                                                                            idx_base_B,
-                                                                            idx_base_C,
-                                                                            idx_base_D,
-                                                                            mul,
-                                                                            add);
+    csrgemm_fill_wf_per_row_device<I, J, T, BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(m,
+                                                                                  nk,
+                                                                                  offset,
+                                                                                  perm,
+                                                                                  alpha,
+                                                                                  csr_row_ptr_A,
+                                                                                  csr_col_ind_A,
+                                                                                  csr_val_A,
+                                                                                  csr_row_ptr_B,
+                                                                                  csr_col_ind_B,
+                                                                                  csr_val_B,
+                                                                                  beta,
+                                                                                  csr_row_ptr_D,
+                                                                                  csr_col_ind_D,
+                                                                                  csr_val_D,
+                                                                                  csr_row_ptr_C,
+                                                                                  csr_col_ind_C,
+                                                                                  csr_val_C,
+                                                                                  idx_base_A,
+                                                                                  idx_base_B,
+                                                                                  idx_base_C,
+                                                                                  idx_base_D,
+                                                                                  mul,
+                                                                                  add);
 }
 
-template <typename T,
+template <typename I,
+          typename     J,
+          typename     T,
           unsigned int BLOCKSIZE,
           unsigned int WFSIZE,
           unsigned int HASHSIZE,
           unsigned int HASHVAL>
 __launch_bounds__(BLOCKSIZE) __global__
-    void csrgemm_fill_wf_per_row_device_pointer(rocsparse_int m,
-                                                rocsparse_int nk,
-                                                const rocsparse_int* __restrict__ offset,
-                                                const rocsparse_int* __restrict__ perm,
+    void csrgemm_fill_wf_per_row_device_pointer(J m,
+                                                J nk,
+                                                const J* __restrict__ offset,
+                                                const J* __restrict__ perm,
                                                 const T* __restrict__ alpha,
-                                                const rocsparse_int* __restrict__ csr_row_ptr_A,
-                                                const rocsparse_int* __restrict__ csr_col_ind_A,
+                                                const I* __restrict__ csr_row_ptr_A,
+                                                const J* __restrict__ csr_col_ind_A,
                                                 const T* __restrict__ csr_val_A,
-                                                const rocsparse_int* __restrict__ csr_row_ptr_B,
-                                                const rocsparse_int* __restrict__ csr_col_ind_B,
+                                                const I* __restrict__ csr_row_ptr_B,
+                                                const J* __restrict__ csr_col_ind_B,
                                                 const T* __restrict__ csr_val_B,
                                                 const T* __restrict__ beta,
-                                                const rocsparse_int* __restrict__ csr_row_ptr_D,
-                                                const rocsparse_int* __restrict__ csr_col_ind_D,
+                                                const I* __restrict__ csr_row_ptr_D,
+                                                const J* __restrict__ csr_col_ind_D,
                                                 const T* __restrict__ csr_val_D,
-                                                const rocsparse_int* __restrict__ csr_row_ptr_C,
-                                                rocsparse_int* __restrict__ csr_col_ind_C,
+                                                const I* __restrict__ csr_row_ptr_C,
+                                                J* __restrict__ csr_col_ind_C,
                                                 T* __restrict__ csr_val_C,
                                                 rocsparse_index_base idx_base_A,
                                                 rocsparse_index_base idx_base_B,
@@ -127,7 +287,7 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                 bool                 mul,
                                                 bool                 add)
 {
-    csrgemm_fill_wf_per_row_device<T, BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(
+    csrgemm_fill_wf_per_row_device<I, J, T, BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(
         m,
         nk,
         offset,
@@ -154,28 +314,30 @@ __launch_bounds__(BLOCKSIZE) __global__
         add);
 }
 
-template <typename T,
+template <typename I,
+          typename     J,
+          typename     T,
           unsigned int BLOCKSIZE,
           unsigned int WFSIZE,
           unsigned int HASHSIZE,
           unsigned int HASHVAL>
 __launch_bounds__(BLOCKSIZE) __global__
-    void csrgemm_fill_block_per_row_host_pointer(rocsparse_int nk,
-                                                 const rocsparse_int* __restrict__ offset,
-                                                 const rocsparse_int* __restrict__ perm,
+    void csrgemm_fill_block_per_row_host_pointer(J nk,
+                                                 const J* __restrict__ offset,
+                                                 const J* __restrict__ perm,
                                                  T alpha,
-                                                 const rocsparse_int* __restrict__ csr_row_ptr_A,
-                                                 const rocsparse_int* __restrict__ csr_col_ind_A,
+                                                 const I* __restrict__ csr_row_ptr_A,
+                                                 const J* __restrict__ csr_col_ind_A,
                                                  const T* __restrict__ csr_val_A,
-                                                 const rocsparse_int* __restrict__ csr_row_ptr_B,
-                                                 const rocsparse_int* __restrict__ csr_col_ind_B,
+                                                 const I* __restrict__ csr_row_ptr_B,
+                                                 const J* __restrict__ csr_col_ind_B,
                                                  const T* __restrict__ csr_val_B,
                                                  T beta,
-                                                 const rocsparse_int* __restrict__ csr_row_ptr_D,
-                                                 const rocsparse_int* __restrict__ csr_col_ind_D,
+                                                 const I* __restrict__ csr_row_ptr_D,
+                                                 const J* __restrict__ csr_col_ind_D,
                                                  const T* __restrict__ csr_val_D,
-                                                 const rocsparse_int* __restrict__ csr_row_ptr_C,
-                                                 rocsparse_int* __restrict__ csr_col_ind_C,
+                                                 const I* __restrict__ csr_row_ptr_C,
+                                                 J* __restrict__ csr_col_ind_C,
                                                  T* __restrict__ csr_val_C,
                                                  rocsparse_index_base idx_base_A,
                                                  rocsparse_index_base idx_base_B,
@@ -184,53 +346,55 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                  bool                 mul,
                                                  bool                 add)
 {
-    csrgemm_fill_block_per_row_device<T, BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(nk,
-                                                                               offset,
-                                                                               perm,
-                                                                               alpha,
-                                                                               csr_row_ptr_A,
-                                                                               csr_col_ind_A,
-                                                                               csr_val_A,
-                                                                               csr_row_ptr_B,
-                                                                               csr_col_ind_B,
-                                                                               csr_val_B,
-                                                                               beta,
-                                                                               csr_row_ptr_D,
-                                                                               csr_col_ind_D,
-                                                                               csr_val_D,
-                                                                               csr_row_ptr_C,
-                                                                               csr_col_ind_C,
-                                                                               csr_val_C,
-                                                                               idx_base_A,
-                                                                               idx_base_B,
-                                                                               idx_base_C,
-                                                                               idx_base_D,
-                                                                               mul,
-                                                                               add);
+    csrgemm_fill_block_per_row_device<I, J, T, BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(nk,
+                                                                                     offset,
+                                                                                     perm,
+                                                                                     alpha,
+                                                                                     csr_row_ptr_A,
+                                                                                     csr_col_ind_A,
+                                                                                     csr_val_A,
+                                                                                     csr_row_ptr_B,
+                                                                                     csr_col_ind_B,
+                                                                                     csr_val_B,
+                                                                                     beta,
+                                                                                     csr_row_ptr_D,
+                                                                                     csr_col_ind_D,
+                                                                                     csr_val_D,
+                                                                                     csr_row_ptr_C,
+                                                                                     csr_col_ind_C,
+                                                                                     csr_val_C,
+                                                                                     idx_base_A,
+                                                                                     idx_base_B,
+                                                                                     idx_base_C,
+                                                                                     idx_base_D,
+                                                                                     mul,
+                                                                                     add);
 }
 
-template <typename T,
+template <typename I,
+          typename     J,
+          typename     T,
           unsigned int BLOCKSIZE,
           unsigned int WFSIZE,
           unsigned int HASHSIZE,
           unsigned int HASHVAL>
 __launch_bounds__(BLOCKSIZE) __global__
-    void csrgemm_fill_block_per_row_device_pointer(rocsparse_int nk,
-                                                   const rocsparse_int* __restrict__ offset,
-                                                   const rocsparse_int* __restrict__ perm,
+    void csrgemm_fill_block_per_row_device_pointer(J nk,
+                                                   const J* __restrict__ offset,
+                                                   const J* __restrict__ perm,
                                                    const T* __restrict__ alpha,
-                                                   const rocsparse_int* __restrict__ csr_row_ptr_A,
-                                                   const rocsparse_int* __restrict__ csr_col_ind_A,
+                                                   const I* __restrict__ csr_row_ptr_A,
+                                                   const J* __restrict__ csr_col_ind_A,
                                                    const T* __restrict__ csr_val_A,
-                                                   const rocsparse_int* __restrict__ csr_row_ptr_B,
-                                                   const rocsparse_int* __restrict__ csr_col_ind_B,
+                                                   const I* __restrict__ csr_row_ptr_B,
+                                                   const J* __restrict__ csr_col_ind_B,
                                                    const T* __restrict__ csr_val_B,
                                                    const T* __restrict__ beta,
-                                                   const rocsparse_int* __restrict__ csr_row_ptr_D,
-                                                   const rocsparse_int* __restrict__ csr_col_ind_D,
+                                                   const I* __restrict__ csr_row_ptr_D,
+                                                   const J* __restrict__ csr_col_ind_D,
                                                    const T* __restrict__ csr_val_D,
-                                                   const rocsparse_int* __restrict__ csr_row_ptr_C,
-                                                   rocsparse_int* __restrict__ csr_col_ind_C,
+                                                   const I* __restrict__ csr_row_ptr_C,
+                                                   J* __restrict__ csr_col_ind_C,
                                                    T* __restrict__ csr_val_C,
                                                    rocsparse_index_base idx_base_A,
                                                    rocsparse_index_base idx_base_B,
@@ -239,7 +403,7 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                    bool                 mul,
                                                    bool                 add)
 {
-    csrgemm_fill_block_per_row_device<T, BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(
+    csrgemm_fill_block_per_row_device<I, J, T, BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(
         nk,
         offset,
         perm,
@@ -265,87 +429,98 @@ __launch_bounds__(BLOCKSIZE) __global__
         add);
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE, unsigned int CHUNKSIZE>
-__launch_bounds__(BLOCKSIZE) __global__ void csrgemm_fill_block_per_row_multipass_host_pointer(
-    rocsparse_int n,
-    const rocsparse_int* __restrict__ offset,
-    const rocsparse_int* __restrict__ perm,
-    T alpha,
-    const rocsparse_int* __restrict__ csr_row_ptr_A,
-    const rocsparse_int* __restrict__ csr_col_ind_A,
-    const T* __restrict__ csr_val_A,
-    const rocsparse_int* __restrict__ csr_row_ptr_B,
-    const rocsparse_int* __restrict__ csr_col_ind_B,
-    const T* __restrict__ csr_val_B,
-    T beta,
-    const rocsparse_int* __restrict__ csr_row_ptr_D,
-    const rocsparse_int* __restrict__ csr_col_ind_D,
-    const T* __restrict__ csr_val_D,
-    const rocsparse_int* __restrict__ csr_row_ptr_C,
-    rocsparse_int* __restrict__ csr_col_ind_C,
-    T* __restrict__ csr_val_C,
-    rocsparse_int* __restrict__ workspace_B,
-    rocsparse_index_base idx_base_A,
-    rocsparse_index_base idx_base_B,
-    rocsparse_index_base idx_base_C,
-    rocsparse_index_base idx_base_D,
-    bool                 mul,
-    bool                 add)
+template <typename I,
+          typename     J,
+          typename     T,
+          unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int CHUNKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_fill_block_per_row_multipass_host_pointer(J n,
+                                                           const J* __restrict__ offset,
+                                                           const J* __restrict__ perm,
+                                                           T alpha,
+                                                           const I* __restrict__ csr_row_ptr_A,
+                                                           const J* __restrict__ csr_col_ind_A,
+                                                           const T* __restrict__ csr_val_A,
+                                                           const I* __restrict__ csr_row_ptr_B,
+                                                           const J* __restrict__ csr_col_ind_B,
+                                                           const T* __restrict__ csr_val_B,
+                                                           T beta,
+                                                           const I* __restrict__ csr_row_ptr_D,
+                                                           const J* __restrict__ csr_col_ind_D,
+                                                           const T* __restrict__ csr_val_D,
+                                                           const I* __restrict__ csr_row_ptr_C,
+                                                           J* __restrict__ csr_col_ind_C,
+                                                           T* __restrict__ csr_val_C,
+                                                           I* __restrict__ workspace_B,
+                                                           rocsparse_index_base idx_base_A,
+                                                           rocsparse_index_base idx_base_B,
+                                                           rocsparse_index_base idx_base_C,
+                                                           rocsparse_index_base idx_base_D,
+                                                           bool                 mul,
+                                                           bool                 add)
 {
-    csrgemm_fill_block_per_row_multipass_device<T, BLOCKSIZE, WFSIZE, CHUNKSIZE>(n,
-                                                                                 offset,
-                                                                                 perm,
-                                                                                 alpha,
-                                                                                 csr_row_ptr_A,
-                                                                                 csr_col_ind_A,
-                                                                                 csr_val_A,
-                                                                                 csr_row_ptr_B,
-                                                                                 csr_col_ind_B,
-                                                                                 csr_val_B,
-                                                                                 beta,
-                                                                                 csr_row_ptr_D,
-                                                                                 csr_col_ind_D,
-                                                                                 csr_val_D,
-                                                                                 csr_row_ptr_C,
-                                                                                 csr_col_ind_C,
-                                                                                 csr_val_C,
-                                                                                 workspace_B,
-                                                                                 idx_base_A,
-                                                                                 idx_base_B,
-                                                                                 idx_base_C,
-                                                                                 idx_base_D,
-                                                                                 mul,
-                                                                                 add);
+    csrgemm_fill_block_per_row_multipass_device<I, J, T, BLOCKSIZE, WFSIZE, CHUNKSIZE>(
+        n,
+        offset,
+        perm,
+        alpha,
+        csr_row_ptr_A,
+        csr_col_ind_A,
+        csr_val_A,
+        csr_row_ptr_B,
+        csr_col_ind_B,
+        csr_val_B,
+        beta,
+        csr_row_ptr_D,
+        csr_col_ind_D,
+        csr_val_D,
+        csr_row_ptr_C,
+        csr_col_ind_C,
+        csr_val_C,
+        workspace_B,
+        idx_base_A,
+        idx_base_B,
+        idx_base_C,
+        idx_base_D,
+        mul,
+        add);
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE, unsigned int CHUNKSIZE>
-__launch_bounds__(BLOCKSIZE) __global__ void csrgemm_fill_block_per_row_multipass_device_pointer(
-    rocsparse_int n,
-    const rocsparse_int* __restrict__ offset,
-    const rocsparse_int* __restrict__ perm,
-    const T* __restrict__ alpha,
-    const rocsparse_int* __restrict__ csr_row_ptr_A,
-    const rocsparse_int* __restrict__ csr_col_ind_A,
-    const T* __restrict__ csr_val_A,
-    const rocsparse_int* __restrict__ csr_row_ptr_B,
-    const rocsparse_int* __restrict__ csr_col_ind_B,
-    const T* __restrict__ csr_val_B,
-    const T* __restrict__ beta,
-    const rocsparse_int* __restrict__ csr_row_ptr_D,
-    const rocsparse_int* __restrict__ csr_col_ind_D,
-    const T* __restrict__ csr_val_D,
-    const rocsparse_int* __restrict__ csr_row_ptr_C,
-    rocsparse_int* __restrict__ csr_col_ind_C,
-    T* __restrict__ csr_val_C,
-    rocsparse_int* __restrict__ workspace_B,
-    rocsparse_index_base idx_base_A,
-    rocsparse_index_base idx_base_B,
-    rocsparse_index_base idx_base_C,
-    rocsparse_index_base idx_base_D,
-    bool                 mul,
-    bool                 add)
+template <typename I,
+          typename     J,
+          typename     T,
+          unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int CHUNKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_fill_block_per_row_multipass_device_pointer(J n,
+                                                             const J* __restrict__ offset,
+                                                             const J* __restrict__ perm,
+                                                             const T* __restrict__ alpha,
+                                                             const I* __restrict__ csr_row_ptr_A,
+                                                             const J* __restrict__ csr_col_ind_A,
+                                                             const T* __restrict__ csr_val_A,
+                                                             const I* __restrict__ csr_row_ptr_B,
+                                                             const J* __restrict__ csr_col_ind_B,
+                                                             const T* __restrict__ csr_val_B,
+                                                             const T* __restrict__ beta,
+                                                             const I* __restrict__ csr_row_ptr_D,
+                                                             const J* __restrict__ csr_col_ind_D,
+                                                             const T* __restrict__ csr_val_D,
+                                                             const I* __restrict__ csr_row_ptr_C,
+                                                             J* __restrict__ csr_col_ind_C,
+                                                             T* __restrict__ csr_val_C,
+                                                             I* __restrict__ workspace_B,
+                                                             rocsparse_index_base idx_base_A,
+                                                             rocsparse_index_base idx_base_B,
+                                                             rocsparse_index_base idx_base_C,
+                                                             rocsparse_index_base idx_base_D,
+                                                             bool                 mul,
+                                                             bool                 add)
 {
-    csrgemm_fill_block_per_row_multipass_device<T, BLOCKSIZE, WFSIZE, CHUNKSIZE>(
+    csrgemm_fill_block_per_row_multipass_device<I, J, T, BLOCKSIZE, WFSIZE, CHUNKSIZE>(
         n,
         offset,
         perm,
@@ -372,24 +547,24 @@ __launch_bounds__(BLOCKSIZE) __global__ void csrgemm_fill_block_per_row_multipas
         add);
 }
 
-template <typename T>
+template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrgemm_mult_buffer_size_template(rocsparse_handle          handle,
                                                              rocsparse_operation       trans_A,
                                                              rocsparse_operation       trans_B,
-                                                             rocsparse_int             m,
-                                                             rocsparse_int             n,
-                                                             rocsparse_int             k,
+                                                             J                         m,
+                                                             J                         n,
+                                                             J                         k,
                                                              const T*                  alpha,
                                                              const rocsparse_mat_descr descr_A,
-                                                             rocsparse_int             nnz_A,
-                                                             const rocsparse_int* csr_row_ptr_A,
-                                                             const rocsparse_int* csr_col_ind_A,
+                                                             I                         nnz_A,
+                                                             const I* csr_row_ptr_A,
+                                                             const J* csr_col_ind_A,
                                                              const rocsparse_mat_descr descr_B,
-                                                             rocsparse_int             nnz_B,
-                                                             const rocsparse_int* csr_row_ptr_B,
-                                                             const rocsparse_int* csr_col_ind_B,
-                                                             rocsparse_mat_info   info_C,
-                                                             size_t*              buffer_size)
+                                                             I                         nnz_B,
+                                                             const I*           csr_row_ptr_B,
+                                                             const J*           csr_col_ind_B,
+                                                             rocsparse_mat_info info_C,
+                                                             size_t*            buffer_size)
 {
     // Check for valid handle and info structure
     if(handle == nullptr)
@@ -462,7 +637,7 @@ rocsparse_status rocsparse_csrgemm_mult_buffer_size_template(rocsparse_handle
                                         &nnz_A,
                                         0,
                                         m,
-                                        rocprim::maximum<rocsparse_int>(),
+                                        rocprim::maximum<I>(),
                                         stream));
     rocprim_max = std::max(rocprim_max, rocprim_size);
 
@@ -473,42 +648,73 @@ rocsparse_status rocsparse_csrgemm_mult_buffer_size_template(rocsparse_handle
                                                 &nnz_A,
                                                 0,
                                                 m + 1,
-                                                rocprim::plus<rocsparse_int>(),
+                                                rocprim::plus<I>(),
                                                 stream));
     rocprim_max = std::max(rocprim_max, rocprim_size);
 
     // rocprim::radix_sort_pairs
-    rocprim::double_buffer<rocsparse_int> buf(&nnz_A, &nnz_B);
+    J                         dummy_perm;
+    rocprim::double_buffer<I> keys(&nnz_A, &nnz_B);
+    rocprim::double_buffer<J> vals(&dummy_perm, &dummy_perm);
     RETURN_IF_HIP_ERROR(
-        rocprim::radix_sort_pairs(nullptr, rocprim_size, buf, buf, m, 0, 3, stream));
+        rocprim::radix_sort_pairs(nullptr, rocprim_size, keys, vals, m, 0, 3, stream));
     rocprim_max = std::max(rocprim_max, rocprim_size);
 
     *buffer_size = ((rocprim_max - 1) / 256 + 1) * 256;
 
     // Group arrays
-    *buffer_size += sizeof(rocsparse_int) * 256 * CSRGEMM_MAXGROUPS;
-    *buffer_size += sizeof(rocsparse_int) * 256;
-    *buffer_size += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+    *buffer_size += sizeof(J) * 256 * CSRGEMM_MAXGROUPS;
+    *buffer_size += sizeof(J) * 256;
+    *buffer_size += ((sizeof(I) * m - 1) / 256 + 1) * 256;
 
     // Permutation arrays
-    *buffer_size += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
-    *buffer_size += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
-    *buffer_size += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+    *buffer_size += ((sizeof(I) * m - 1) / 256 + 1) * 256;
+    *buffer_size += ((sizeof(I) * m - 1) / 256 + 1) * 256;
+    *buffer_size += ((sizeof(I) * m - 1) / 256 + 1) * 256;
+
+    // The structure of transposed operands is computed in csrgemm_nnz, where the
+    // buffer is not required otherwise. A is a k x m matrix, B is a n x k matrix.
+    size_t transpose_size;
+
+    if(trans_A != rocsparse_operation_none)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csrgemm_transpose_buffer_size(handle, m, nnz_A, &transpose_size));
+        *buffer_size = std::max(*buffer_size, transpose_size);
+    }
+
+    if(trans_B != rocsparse_operation_none)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csrgemm_transpose_buffer_size(handle, k, nnz_B, &transpose_size));
+        *buffer_size = std::max(*buffer_size, transpose_size);
+    }
+
+    // The values of transposed operands are gathered in front of the buffer
+    if(trans_A != rocsparse_operation_none)
+    {
+        *buffer_size += ((sizeof(T) * nnz_A - 1) / 256 + 1) * 256;
+    }
+
+    if(trans_B != rocsparse_operation_none)
+    {
+        *buffer_size += ((sizeof(T) * nnz_B - 1) / 256 + 1) * 256;
+    }
 
     return rocsparse_status_success;
 }
 
-template <typename T>
+template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrgemm_scal_buffer_size_template(rocsparse_handle          handle,
-                                                             rocsparse_int             m,
-                                                             rocsparse_int             n,
+                                                             J                         m,
+                                                             J                         n,
                                                              const T*                  beta,
                                                              const rocsparse_mat_descr descr_D,
-                                                             rocsparse_int             nnz_D,
-                                                             const rocsparse_int* csr_row_ptr_D,
-                                                             const rocsparse_int* csr_col_ind_D,
-                                                             rocsparse_mat_info   info_C,
-                                                             size_t*              buffer_size)
+                                                             I                         nnz_D,
+                                                             const I*           csr_row_ptr_D,
+                                                             const J*           csr_col_ind_D,
+                                                             rocsparse_mat_info info_C,
+                                                             size_t*            buffer_size)
 {
     // Check for valid handle and info structure
     if(handle == nullptr)
@@ -555,27 +761,27 @@ rocsparse_status rocsparse_csrgemm_scal_buffer_size_template(rocsparse_handle
     return rocsparse_status_success;
 }
 
-template <typename T>
+template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrgemm_buffer_size_template(rocsparse_handle          handle,
                                                         rocsparse_operation       trans_A,
                                                         rocsparse_operation       trans_B,
-                                                        rocsparse_int             m,
-                                                        rocsparse_int             n,
-                                                        rocsparse_int             k,
+                                                        J                         m,
+                                                        J                         n,
+                                                        J                         k,
                                                         const T*                  alpha,
                                                         const rocsparse_mat_descr descr_A,
-                                                        rocsparse_int             nnz_A,
-                                                        const rocsparse_int*      csr_row_ptr_A,
-                                                        const rocsparse_int*      csr_col_ind_A,
+                                                        I                         nnz_A,
+                                                        const I*                  csr_row_ptr_A,
+                                                        const J*                  csr_col_ind_A,
                                                         const rocsparse_mat_descr descr_B,
-                                                        rocsparse_int             nnz_B,
-                                                        const rocsparse_int*      csr_row_ptr_B,
-                                                        const rocsparse_int*      csr_col_ind_B,
+                                                        I                         nnz_B,
+                                                        const I*                  csr_row_ptr_B,
+                                                        const J*                  csr_col_ind_B,
                                                         const T*                  beta,
                                                         const rocsparse_mat_descr descr_D,
-                                                        rocsparse_int             nnz_D,
-                                                        const rocsparse_int*      csr_row_ptr_D,
-                                                        const rocsparse_int*      csr_col_ind_D,
+                                                        I                         nnz_D,
+                                                        const I*                  csr_row_ptr_D,
+                                                        const J*                  csr_col_ind_D,
                                                         rocsparse_mat_info        info_C,
                                                         size_t*                   buffer_size)
 {
@@ -589,7 +795,7 @@ rocsparse_status rocsparse_csrgemm_buffer_size_template(rocsparse_handle
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrgemm_buffer_size"),
+                  appendIJ<I, J>(replaceX<T>("rocsparse_Xcsrgemm_buffer_size")),
                   trans_A,
                   trans_B,
                   m,
@@ -615,7 +821,7 @@ rocsparse_status rocsparse_csrgemm_buffer_size_template(rocsparse_handle
     else
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrgemm_buffer_size"),
+                  appendIJ<I, J>(replaceX<T>("rocsparse_Xcsrgemm_buffer_size")),
                   trans_A,
                   trans_B,
                   m,
@@ -654,6 +860,8 @@ rocsparse_status rocsparse_csrgemm_buffer_size_template(rocsparse_handle
     // Set info parameters
     info_C->csrgemm_info->mul = (alpha != nullptr);
     info_C->csrgemm_info->add = (beta != nullptr);
+    info_C->csrgemm_info->trans_A = trans_A;
+    info_C->csrgemm_info->trans_B = trans_B;
 
     // Either alpha or beta can be nullptr
     if(alpha != nullptr && beta != nullptr)
@@ -666,28 +874,28 @@ rocsparse_status rocsparse_csrgemm_buffer_size_template(rocsparse_handle
     else if(alpha != nullptr && beta == nullptr)
     {
         // alpha != nullptr && beta == nullptr
-        return rocsparse_csrgemm_mult_buffer_size_template<T>(handle,
-                                                              trans_A,
-                                                              trans_B,
-                                                              m,
-                                                              n,
-                                                              k,
-                                                              alpha,
-                                                              descr_A,
-                                                              nnz_A,
-                                                              csr_row_ptr_A,
-                                                              csr_col_ind_A,
-                                                              descr_B,
-                                                              nnz_B,
-                                                              csr_row_ptr_B,
-                                                              csr_col_ind_B,
-                                                              info_C,
-                                                              buffer_size);
+        return rocsparse_csrgemm_mult_buffer_size_template<I, J, T>(handle,
+                                                                    trans_A,
+                                                                    trans_B,
+                                                                    m,
+                                                                    n,
+                                                                    k,
+                                                                    alpha,
+                                                                    descr_A,
+                                                                    nnz_A,
+                                                                    csr_row_ptr_A,
+                                                                    csr_col_ind_A,
+                                                                    descr_B,
+                                                                    nnz_B,
+                                                                    csr_row_ptr_B,
+                                                                    csr_col_ind_B,
+                                                                    info_C,
+                                                                    buffer_size);
     }
     else if(alpha == nullptr && beta != nullptr)
     {
         // alpha == nullptr && beta != nullptr
-        return rocsparse_csrgemm_scal_buffer_size_template<T>(
+        return rocsparse_csrgemm_scal_buffer_size_template<I, J, T>(
             handle, m, n, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, buffer_size);
     }
     else
@@ -700,28 +908,30 @@ rocsparse_status rocsparse_csrgemm_buffer_size_template(rocsparse_handle
 }
 
 // Disable for rocsparse_double_complex, as required size would exceed available memory
-template <typename T,
+template <typename I,
+          typename J,
+          typename T,
           typename std::enable_if<std::is_same<T, rocsparse_double_complex>::value, int>::type = 0>
 inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
-                                         rocsparse_int        group_size,
-                                         const rocsparse_int* group_offset,
-                                         const rocsparse_int* perm,
-                                         rocsparse_int        m,
-                                         rocsparse_int        n,
-                                         rocsparse_int        k,
+                                         J                    group_size,
+                                         const J*             group_offset,
+                                         const J*             perm,
+                                         J                    m,
+                                         J                    n,
+                                         J                    k,
                                          const T*             alpha,
-                                         const rocsparse_int* csr_row_ptr_A,
-                                         const rocsparse_int* csr_col_ind_A,
+                                         const I*             csr_row_ptr_A,
+                                         const J*             csr_col_ind_A,
                                          const T*             csr_val_A,
-                                         const rocsparse_int* csr_row_ptr_B,
-                                         const rocsparse_int* csr_col_ind_B,
+                                         const I*             csr_row_ptr_B,
+                                         const J*             csr_col_ind_B,
                                          const T*             csr_val_B,
                                          const T*             beta,
-                                         const rocsparse_int* csr_row_ptr_D,
-                                         const rocsparse_int* csr_col_ind_D,
+                                         const I*             csr_row_ptr_D,
+                                         const J*             csr_col_ind_D,
                                          const T*             csr_val_D,
-                                         const rocsparse_int* csr_row_ptr_C,
-                                         rocsparse_int*       csr_col_ind_C,
+                                         const I*             csr_row_ptr_C,
+                                         J*                   csr_col_ind_C,
                                          T*                   csr_val_C,
                                          rocsparse_index_base base_A,
                                          rocsparse_index_base base_B,
@@ -733,31 +943,33 @@ inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
     return rocsparse_status_internal_error;
 }
 
-template <typename T,
+template <typename I,
+          typename J,
+          typename T,
           typename std::enable_if<std::is_same<T, float>::value || std::is_same<T, double>::value
                                       || std::is_same<T, rocsparse_float_complex>::value,
                                   int>::type
           = 0>
 inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
-                                         rocsparse_int        group_size,
-                                         const rocsparse_int* group_offset,
-                                         const rocsparse_int* perm,
-                                         rocsparse_int        m,
-                                         rocsparse_int        n,
-                                         rocsparse_int        k,
+                                         J                    group_size,
+                                         const J*             group_offset,
+                                         const J*             perm,
+                                         J                    m,
+                                         J                    n,
+                                         J                    k,
                                          const T*             alpha,
-                                         const rocsparse_int* csr_row_ptr_A,
-                                         const rocsparse_int* csr_col_ind_A,
+                                         const I*             csr_row_ptr_A,
+                                         const J*             csr_col_ind_A,
                                          const T*             csr_val_A,
-                                         const rocsparse_int* csr_row_ptr_B,
-                                         const rocsparse_int* csr_col_ind_B,
+                                         const I*             csr_row_ptr_B,
+                                         const J*             csr_col_ind_B,
                                          const T*             csr_val_B,
                                          const T*             beta,
-                                         const rocsparse_int* csr_row_ptr_D,
-                                         const rocsparse_int* csr_col_ind_D,
+                                         const I*             csr_row_ptr_D,
+                                         const J*             csr_col_ind_D,
                                          const T*             csr_val_D,
-                                         const rocsparse_int* csr_row_ptr_C,
-                                         rocsparse_int*       csr_col_ind_C,
+                                         const I*             csr_row_ptr_C,
+                                         J*                   csr_col_ind_C,
                                          T*                   csr_val_C,
                                          rocsparse_index_base base_A,
                                          rocsparse_index_base base_B,
@@ -771,7 +983,9 @@ inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
 #define CSRGEMM_HASHSIZE 4096
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
-        hipLaunchKernelGGL((csrgemm_fill_block_per_row_device_pointer<T,
+        hipLaunchKernelGGL((csrgemm_fill_block_per_row_device_pointer<I,
+                                                                      J,
+                                                                      T,
                                                                       CSRGEMM_DIM,
                                                                       CSRGEMM_SUB,
                                                                       CSRGEMM_HASHSIZE,
@@ -806,7 +1020,9 @@ inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
     }
     else
     {
-        hipLaunchKernelGGL((csrgemm_fill_block_per_row_host_pointer<T,
+        hipLaunchKernelGGL((csrgemm_fill_block_per_row_host_pointer<I,
+                                                                    J,
+                                                                    T,
                                                                     CSRGEMM_DIM,
                                                                     CSRGEMM_SUB,
                                                                     CSRGEMM_HASHSIZE,
@@ -846,34 +1062,34 @@ inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
     return rocsparse_status_success;
 }
 
-template <typename T>
+template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handle,
                                                  rocsparse_operation       trans_A,
                                                  rocsparse_operation       trans_B,
-                                                 rocsparse_int             m,
-                                                 rocsparse_int             n,
-                                                 rocsparse_int             k,
+                                                 J                         m,
+                                                 J                         n,
+                                                 J                         k,
                                                  const T*                  alpha,
                                                  const rocsparse_mat_descr descr_A,
-                                                 rocsparse_int             nnz_A,
+                                                 I                         nnz_A,
                                                  const T*                  csr_val_A,
-                                                 const rocsparse_int*      csr_row_ptr_A,
-                                                 const rocsparse_int*      csr_col_ind_A,
+                                                 const I*                  csr_row_ptr_A,
+                                                 const J*                  csr_col_ind_A,
                                                  const rocsparse_mat_descr descr_B,
-                                                 rocsparse_int             nnz_B,
+                                                 I                         nnz_B,
                                                  const T*                  csr_val_B,
-                                                 const rocsparse_int*      csr_row_ptr_B,
-                                                 const rocsparse_int*      csr_col_ind_B,
+                                                 const I*                  csr_row_ptr_B,
+                                                 const J*                  csr_col_ind_B,
                                                  const T*                  beta,
                                                  const rocsparse_mat_descr descr_D,
-                                                 rocsparse_int             nnz_D,
+                                                 I                         nnz_D,
                                                  const T*                  csr_val_D,
-                                                 const rocsparse_int*      csr_row_ptr_D,
-                                                 const rocsparse_int*      csr_col_ind_D,
+                                                 const I*                  csr_row_ptr_D,
+                                                 const J*                  csr_col_ind_D,
                                                  const rocsparse_mat_descr descr_C,
                                                  T*                        csr_val_C,
-                                                 const rocsparse_int*      csr_row_ptr_C,
-                                                 rocsparse_int*            csr_col_ind_C,
+                                                 const I*                  csr_row_ptr_C,
+                                                 J*                        csr_col_ind_C,
                                                  const rocsparse_mat_info  info_C,
                                                  void*                     temp_buffer)
 {
@@ -899,10 +1115,10 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
     void*  rocprim_buffer;
 
     // Determine maximum non-zero entries per row of all rows
-    rocsparse_int* workspace = reinterpret_cast<rocsparse_int*>(buffer);
+    I* workspace = reinterpret_cast<I*>(buffer);
 
 #define CSRGEMM_DIM 256
-    hipLaunchKernelGGL((csrgemm_max_row_nnz_part1<CSRGEMM_DIM>),
+    hipLaunchKernelGGL((csrgemm_max_row_nnz_part1<I, J, CSRGEMM_DIM>),
                        dim3(CSRGEMM_DIM),
                        dim3(CSRGEMM_DIM),
                        0,
@@ -911,55 +1127,59 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
                        csr_row_ptr_C,
                        workspace);
 
-    hipLaunchKernelGGL(
-        (csrgemm_max_row_nnz_part2<CSRGEMM_DIM>), dim3(1), dim3(CSRGEMM_DIM), 0, stream, workspace);
+    hipLaunchKernelGGL((csrgemm_max_row_nnz_part2<I, CSRGEMM_DIM>),
+                       dim3(1),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       workspace);
 #undef CSRGEMM_DIM
 
-    rocsparse_int nnz_max;
+    I nnz_max;
     RETURN_IF_HIP_ERROR(
-        hipMemcpyAsync(&nnz_max, workspace, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+        hipMemcpyAsync(&nnz_max, workspace, sizeof(I), hipMemcpyDeviceToHost, stream));
 
     // Wait for host transfer to finish
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
     // Group offset buffer
-    rocsparse_int* d_group_offset = reinterpret_cast<rocsparse_int*>(buffer);
-    buffer += sizeof(rocsparse_int) * 256;
+    J* d_group_offset = reinterpret_cast<J*>(buffer);
+    buffer += sizeof(J) * 256;
 
     // Group size buffer
-    rocsparse_int h_group_size[CSRGEMM_MAXGROUPS];
+    J h_group_size[CSRGEMM_MAXGROUPS];
 
     // Initialize group sizes with zero
-    memset(&h_group_size[0], 0, sizeof(rocsparse_int) * CSRGEMM_MAXGROUPS);
+    memset(&h_group_size[0], 0, sizeof(J) * CSRGEMM_MAXGROUPS);
 
     // Permutation array
-    rocsparse_int* d_perm = nullptr;
+    J* d_perm = nullptr;
 
     // If maximum of row nnz exceeds 16, we process the rows in groups of
     // similar sized row nnz
     if(nnz_max > 16)
     {
         // Group size buffer
-        rocsparse_int* d_group_size = reinterpret_cast<rocsparse_int*>(buffer);
-        buffer += sizeof(rocsparse_int) * 256 * CSRGEMM_MAXGROUPS;
+        J* d_group_size = reinterpret_cast<J*>(buffer);
+        buffer += sizeof(J) * 256 * CSRGEMM_MAXGROUPS;
 
         // Permutation temporary arrays
-        rocsparse_int* tmp_vals = reinterpret_cast<rocsparse_int*>(buffer);
-        buffer += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+        J* tmp_vals = reinterpret_cast<J*>(buffer);
+        buffer += ((sizeof(J) * m - 1) / 256 + 1) * 256;
 
-        rocsparse_int* tmp_perm = reinterpret_cast<rocsparse_int*>(buffer);
-        buffer += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+        J* tmp_perm = reinterpret_cast<J*>(buffer);
+        buffer += ((sizeof(J) * m - 1) / 256 + 1) * 256;
 
-        rocsparse_int* tmp_keys = reinterpret_cast<rocsparse_int*>(buffer);
-        buffer += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+        J* tmp_keys = reinterpret_cast<J*>(buffer);
+        buffer += ((sizeof(J) * m - 1) / 256 + 1) * 256;
 
-        rocsparse_int* tmp_groups = reinterpret_cast<rocsparse_int*>(buffer);
-        buffer += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+        J* tmp_groups = reinterpret_cast<J*>(buffer);
+        buffer += ((sizeof(J) * m - 1) / 256 + 1) * 256;
 
         // Determine number of rows per group
 #define CSRGEMM_DIM 256
         hipLaunchKernelGGL(
-            (csrgemm_group_reduce_part2<CSRGEMM_DIM, CSRGEMM_MAXGROUPS, is_double_complex>),
+            (csrgemm_group_reduce_part2<I, J, CSRGEMM_DIM, CSRGEMM_MAXGROUPS, is_double_complex>),
             dim3(CSRGEMM_DIM),
             dim3(CSRGEMM_DIM),
             0,
@@ -969,7 +1189,7 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
             d_group_size,
             tmp_groups);
 
-        hipLaunchKernelGGL((csrgemm_group_reduce_part3<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
+        hipLaunchKernelGGL((csrgemm_group_reduce_part3<J, CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
                            dim3(1),
                            dim3(CSRGEMM_DIM),
                            0,
@@ -984,7 +1204,7 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
                                                     d_group_offset,
                                                     0,
                                                     CSRGEMM_MAXGROUPS,
-                                                    rocprim::plus<rocsparse_int>(),
+                                                    rocprim::plus<J>(),
                                                     stream));
         rocprim_buffer = reinterpret_cast<void*>(buffer);
         RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
@@ -993,13 +1213,13 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
                                                     d_group_offset,
                                                     0,
                                                     CSRGEMM_MAXGROUPS,
-                                                    rocprim::plus<rocsparse_int>(),
+                                                    rocprim::plus<J>(),
                                                     stream));
 
         // Copy group sizes to host
         RETURN_IF_HIP_ERROR(hipMemcpyAsync(&h_group_size,
                                            d_group_size,
-                                           sizeof(rocsparse_int) * CSRGEMM_MAXGROUPS,
+                                           sizeof(J) * CSRGEMM_MAXGROUPS,
                                            hipMemcpyDeviceToHost,
                                            stream));
 
@@ -1007,10 +1227,11 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
         RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
         // Create identity permutation for group access
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, m, tmp_perm));
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_create_identity_permutation_template(handle, m, tmp_perm));
 
-        rocprim::double_buffer<rocsparse_int> d_keys(tmp_groups, tmp_keys);
-        rocprim::double_buffer<rocsparse_int> d_vals(tmp_perm, tmp_vals);
+        rocprim::double_buffer<J> d_keys(tmp_groups, tmp_keys);
+        rocprim::double_buffer<J> d_vals(tmp_perm, tmp_vals);
 
         // Sort pairs (by groups)
         RETURN_IF_HIP_ERROR(
@@ -1022,16 +1243,16 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
         d_perm = d_vals.current();
 
         // Release tmp_groups buffer
-        buffer -= ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+        buffer -= ((sizeof(J) * m - 1) / 256 + 1) * 256;
 
         // Release tmp_keys buffer
-        buffer -= ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+        buffer -= ((sizeof(J) * m - 1) / 256 + 1) * 256;
     }
     else
     {
         // First group processes all rows
         h_group_size[0] = m;
-        RETURN_IF_HIP_ERROR(hipMemsetAsync(d_group_offset, 0, sizeof(rocsparse_int), stream));
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(d_group_offset, 0, sizeof(J), stream));
     }
 
     // Compute columns and accumulate values for each group
@@ -1045,7 +1266,9 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 8
 #define CSRGEMM_HASHSIZE 16
-            hipLaunchKernelGGL((csrgemm_fill_wf_per_row_device_pointer<T,
+            hipLaunchKernelGGL((csrgemm_fill_wf_per_row_device_pointer<I,
+                                                                       J,
+                                                                       T,
                                                                        CSRGEMM_DIM,
                                                                        CSRGEMM_SUB,
                                                                        CSRGEMM_HASHSIZE,
@@ -1089,7 +1312,9 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 16
 #define CSRGEMM_HASHSIZE 32
-            hipLaunchKernelGGL((csrgemm_fill_wf_per_row_device_pointer<T,
+            hipLaunchKernelGGL((csrgemm_fill_wf_per_row_device_pointer<I,
+                                                                       J,
+                                                                       T,
                                                                        CSRGEMM_DIM,
                                                                        CSRGEMM_SUB,
                                                                        CSRGEMM_HASHSIZE,
@@ -1133,7 +1358,9 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
 #define CSRGEMM_DIM 128
 #define CSRGEMM_SUB 16
 #define CSRGEMM_HASHSIZE 256
-            hipLaunchKernelGGL((csrgemm_fill_block_per_row_device_pointer<T,
+            hipLaunchKernelGGL((csrgemm_fill_block_per_row_device_pointer<I,
+                                                                          J,
+                                                                          T,
                                                                           CSRGEMM_DIM,
                                                                           CSRGEMM_SUB,
                                                                           CSRGEMM_HASHSIZE,
@@ -1176,7 +1403,9 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 32
 #define CSRGEMM_HASHSIZE 512
-            hipLaunchKernelGGL((csrgemm_fill_block_per_row_device_pointer<T,
+            hipLaunchKernelGGL((csrgemm_fill_block_per_row_device_pointer<I,
+                                                                          J,
+                                                                          T,
                                                                           CSRGEMM_DIM,
                                                                           CSRGEMM_SUB,
                                                                           CSRGEMM_HASHSIZE,
@@ -1219,7 +1448,9 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
 #define CSRGEMM_DIM 512
 #define CSRGEMM_SUB 32
 #define CSRGEMM_HASHSIZE 1024
-            hipLaunchKernelGGL((csrgemm_fill_block_per_row_device_pointer<T,
+            hipLaunchKernelGGL((csrgemm_fill_block_per_row_device_pointer<I,
+                                                                          J,
+                                                                          T,
                                                                           CSRGEMM_DIM,
                                                                           CSRGEMM_SUB,
                                                                           CSRGEMM_HASHSIZE,
@@ -1262,7 +1493,9 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
 #define CSRGEMM_DIM 1024
 #define CSRGEMM_SUB 32
 #define CSRGEMM_HASHSIZE 2048
-            hipLaunchKernelGGL((csrgemm_fill_block_per_row_device_pointer<T,
+            hipLaunchKernelGGL((csrgemm_fill_block_per_row_device_pointer<I,
+                                                                          J,
+                                                                          T,
                                                                           CSRGEMM_DIM,
                                                                           CSRGEMM_SUB,
                                                                           CSRGEMM_HASHSIZE,
@@ -1303,33 +1536,33 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
         // Group 6: 2049 - 4096 non-zeros per row
         if(h_group_size[6] > 0 && !is_double_complex)
         {
-            RETURN_IF_ROCSPARSE_ERROR(csrgemm_launcher<T>(handle,
-                                                          h_group_size[6],
-                                                          &d_group_offset[6],
-                                                          d_perm,
-                                                          m,
-                                                          n,
-                                                          k,
-                                                          alpha,
-                                                          csr_row_ptr_A,
-                                                          csr_col_ind_A,
-                                                          csr_val_A,
-                                                          csr_row_ptr_B,
-                                                          csr_col_ind_B,
-                                                          csr_val_B,
-                                                          beta,
-                                                          csr_row_ptr_D,
-                                                          csr_col_ind_D,
-                                                          csr_val_D,
-                                                          csr_row_ptr_C,
-                                                          csr_col_ind_C,
-                                                          csr_val_C,
-                                                          base_A,
-                                                          base_B,
-                                                          descr_C->base,
-                                                          base_D,
-                                                          info_C->csrgemm_info->mul,
-                                                          info_C->csrgemm_info->add));
+            RETURN_IF_ROCSPARSE_ERROR(csrgemm_launcher(handle,
+                                                       h_group_size[6],
+                                                       &d_group_offset[6],
+                                                       d_perm,
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       csr_row_ptr_A,
+                                                       csr_col_ind_A,
+                                                       csr_val_A,
+                                                       csr_row_ptr_B,
+                                                       csr_col_ind_B,
+                                                       csr_val_B,
+                                                       beta,
+                                                       csr_row_ptr_D,
+                                                       csr_col_ind_D,
+                                                       csr_val_D,
+                                                       csr_row_ptr_C,
+                                                       csr_col_ind_C,
+                                                       csr_val_C,
+                                                       base_A,
+                                                       base_B,
+                                                       descr_C->base,
+                                                       base_D,
+                                                       info_C->csrgemm_info->mul,
+                                                       info_C->csrgemm_info->add));
         }
 #endif
 
@@ -1339,16 +1572,18 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
 #define CSRGEMM_DIM 512
 #define CSRGEMM_SUB 16
 #define CSRGEMM_CHUNKSIZE 2048
-            rocsparse_int* workspace_B = nullptr;
+            I* workspace_B = nullptr;
 
             if(info_C->csrgemm_info->mul == true)
             {
                 // Allocate additional buffer for C = alpha * A * B
-                RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace_B, sizeof(rocsparse_int) * nnz_A));
+                RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace_B, sizeof(I) * nnz_A));
             }
 
             hipLaunchKernelGGL(
-                (csrgemm_fill_block_per_row_multipass_device_pointer<T,
+                (csrgemm_fill_block_per_row_multipass_device_pointer<I,
+                                                                     J,
+                                                                     T,
                                                                      CSRGEMM_DIM,
                                                                      CSRGEMM_SUB,
                                                                      CSRGEMM_CHUNKSIZE>),
@@ -1398,7 +1633,9 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 8
 #define CSRGEMM_HASHSIZE 16
-            hipLaunchKernelGGL((csrgemm_fill_wf_per_row_host_pointer<T,
+            hipLaunchKernelGGL((csrgemm_fill_wf_per_row_host_pointer<I,
+                                                                     J,
+                                                                     T,
                                                                      CSRGEMM_DIM,
                                                                      CSRGEMM_SUB,
                                                                      CSRGEMM_HASHSIZE,
@@ -1442,7 +1679,9 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 16
 #define CSRGEMM_HASHSIZE 32
-            hipLaunchKernelGGL((csrgemm_fill_wf_per_row_host_pointer<T,
+            hipLaunchKernelGGL((csrgemm_fill_wf_per_row_host_pointer<I,
+                                                                     J,
+                                                                     T,
                                                                      CSRGEMM_DIM,
                                                                      CSRGEMM_SUB,
                                                                      CSRGEMM_HASHSIZE,
@@ -1486,7 +1725,9 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
 #define CSRGEMM_DIM 128
 #define CSRGEMM_SUB 16
 #define CSRGEMM_HASHSIZE 256
-            hipLaunchKernelGGL((csrgemm_fill_block_per_row_host_pointer<T,
+            hipLaunchKernelGGL((csrgemm_fill_block_per_row_host_pointer<I,
+                                                                        J,
+                                                                        T,
                                                                         CSRGEMM_DIM,
                                                                         CSRGEMM_SUB,
                                                                         CSRGEMM_HASHSIZE,
@@ -1529,7 +1770,9 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 32
 #define CSRGEMM_HASHSIZE 512
-            hipLaunchKernelGGL((csrgemm_fill_block_per_row_host_pointer<T,
+            hipLaunchKernelGGL((csrgemm_fill_block_per_row_host_pointer<I,
+                                                                        J,
+                                                                        T,
                                                                         CSRGEMM_DIM,
                                                                         CSRGEMM_SUB,
                                                                         CSRGEMM_HASHSIZE,
@@ -1572,7 +1815,9 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
 #define CSRGEMM_DIM 512
 #define CSRGEMM_SUB 32
 #define CSRGEMM_HASHSIZE 1024
-            hipLaunchKernelGGL((csrgemm_fill_block_per_row_host_pointer<T,
+            hipLaunchKernelGGL((csrgemm_fill_block_per_row_host_pointer<I,
+                                                                        J,
+                                                                        T,
                                                                         CSRGEMM_DIM,
                                                                         CSRGEMM_SUB,
                                                                         CSRGEMM_HASHSIZE,
@@ -1615,7 +1860,9 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
 #define CSRGEMM_DIM 1024
 #define CSRGEMM_SUB 32
 #define CSRGEMM_HASHSIZE 2048
-            hipLaunchKernelGGL((csrgemm_fill_block_per_row_host_pointer<T,
+            hipLaunchKernelGGL((csrgemm_fill_block_per_row_host_pointer<I,
+                                                                        J,
+                                                                        T,
                                                                         CSRGEMM_DIM,
                                                                         CSRGEMM_SUB,
                                                                         CSRGEMM_HASHSIZE,
@@ -1656,33 +1903,33 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
         // Group 6: 2049 - 4096 non-zeros per row
         if(h_group_size[6] > 0 && !is_double_complex)
         {
-            RETURN_IF_ROCSPARSE_ERROR(csrgemm_launcher<T>(handle,
-                                                          h_group_size[6],
-                                                          &d_group_offset[6],
-                                                          d_perm,
-                                                          m,
-                                                          n,
-                                                          k,
-                                                          alpha,
-                                                          csr_row_ptr_A,
-                                                          csr_col_ind_A,
-                                                          csr_val_A,
-                                                          csr_row_ptr_B,
-                                                          csr_col_ind_B,
-                                                          csr_val_B,
-                                                          beta,
-                                                          csr_row_ptr_D,
-                                                          csr_col_ind_D,
-                                                          csr_val_D,
-                                                          csr_row_ptr_C,
-                                                          csr_col_ind_C,
-                                                          csr_val_C,
-                                                          base_A,
-                                                          base_B,
-                                                          descr_C->base,
-                                                          base_D,
-                                                          info_C->csrgemm_info->mul,
-                                                          info_C->csrgemm_info->add));
+            RETURN_IF_ROCSPARSE_ERROR(csrgemm_launcher(handle,
+                                                       h_group_size[6],
+                                                       &d_group_offset[6],
+                                                       d_perm,
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       csr_row_ptr_A,
+                                                       csr_col_ind_A,
+                                                       csr_val_A,
+                                                       csr_row_ptr_B,
+                                                       csr_col_ind_B,
+                                                       csr_val_B,
+                                                       beta,
+                                                       csr_row_ptr_D,
+                                                       csr_col_ind_D,
+                                                       csr_val_D,
+                                                       csr_row_ptr_C,
+                                                       csr_col_ind_C,
+                                                       csr_val_C,
+                                                       base_A,
+                                                       base_B,
+                                                       descr_C->base,
+                                                       base_D,
+                                                       info_C->csrgemm_info->mul,
+                                                       info_C->csrgemm_info->add));
         }
 #endif
 
@@ -1692,16 +1939,18 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
 #define CSRGEMM_DIM 512
 #define CSRGEMM_SUB 16
 #define CSRGEMM_CHUNKSIZE 2048
-            rocsparse_int* workspace_B = nullptr;
+            I* workspace_B = nullptr;
 
             if(info_C->csrgemm_info->mul == true)
             {
                 // Allocate additional buffer for C = alpha * A * B
-                RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace_B, sizeof(rocsparse_int) * nnz_A));
+                RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace_B, sizeof(I) * nnz_A));
             }
 
             hipLaunchKernelGGL(
-                (csrgemm_fill_block_per_row_multipass_host_pointer<T,
+                (csrgemm_fill_block_per_row_multipass_host_pointer<I,
+                                                                   J,
+                                                                   T,
                                                                    CSRGEMM_DIM,
                                                                    CSRGEMM_SUB,
                                                                    CSRGEMM_CHUNKSIZE>),
@@ -1747,34 +1996,34 @@ rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handl
     return rocsparse_status_success;
 }
 
-template <typename T>
+template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrgemm_mult_template(rocsparse_handle          handle,
                                                  rocsparse_operation       trans_A,
                                                  rocsparse_operation       trans_B,
-                                                 rocsparse_int             m,
-                                                 rocsparse_int             n,
-                                                 rocsparse_int             k,
+                                                 J                         m,
+                                                 J                         n,
+                                                 J                         k,
                                                  const T*                  alpha,
                                                  const rocsparse_mat_descr descr_A,
-                                                 rocsparse_int             nnz_A,
+                                                 I                         nnz_A,
                                                  const T*                  csr_val_A,
-                                                 const rocsparse_int*      csr_row_ptr_A,
-                                                 const rocsparse_int*      csr_col_ind_A,
+                                                 const I*                  csr_row_ptr_A,
+                                                 const J*                  csr_col_ind_A,
                                                  const rocsparse_mat_descr descr_B,
-                                                 rocsparse_int             nnz_B,
+                                                 I                         nnz_B,
                                                  const T*                  csr_val_B,
-                                                 const rocsparse_int*      csr_row_ptr_B,
-                                                 const rocsparse_int*      csr_col_ind_B,
+                                                 const I*                  csr_row_ptr_B,
+                                                 const J*                  csr_col_ind_B,
                                                  const T*                  beta,
                                                  const rocsparse_mat_descr descr_D,
-                                                 rocsparse_int             nnz_D,
+                                                 I                         nnz_D,
                                                  const T*                  csr_val_D,
-                                                 const rocsparse_int*      csr_row_ptr_D,
-                                                 const rocsparse_int*      csr_col_ind_D,
+                                                 const I*                  csr_row_ptr_D,
+                                                 const J*                  csr_col_ind_D,
                                                  const rocsparse_mat_descr descr_C,
                                                  T*                        csr_val_C,
-                                                 const rocsparse_int*      csr_row_ptr_C,
-                                                 rocsparse_int*            csr_col_ind_C,
+                                                 const I*                  csr_row_ptr_C,
+                                                 J*                        csr_col_ind_C,
                                                  const rocsparse_mat_info  info_C,
                                                  void*                     temp_buffer)
 {
@@ -1828,72 +2077,143 @@ rocsparse_status rocsparse_csrgemm_mult_template(rocsparse_handle          handl
         return rocsparse_status_not_implemented;
     }
 
+    // Check that the operations match the ones that have been used in csrgemm_nnz
+    rocsparse_csrgemm_info info = info_C->csrgemm_info;
+
+    if(info->trans_A != trans_A || info->trans_B != trans_B)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
     // Quick return if possible
     if(m == 0 || n == 0 || k == 0 || nnz_A == 0 || nnz_B == 0)
     {
         return rocsparse_status_success;
     }
 
+    // The structure of transposed operands must have been computed by csrgemm_nnz
+    if((trans_A != rocsparse_operation_none && info->trans_row_ptr_A == nullptr)
+       || (trans_B != rocsparse_operation_none && info->trans_row_ptr_B == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // ... with the same index types
+    if((trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+       && (info->offset_size != sizeof(I) || info->index_size != sizeof(J)))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Temporary buffer
+    char* buffer = reinterpret_cast<char*>(temp_buffer);
+
+    // op(A)
+    const T* val_A     = csr_val_A;
+    const I* row_ptr_A = csr_row_ptr_A;
+    const J* col_ind_A = csr_col_ind_A;
+
+    if(trans_A != rocsparse_operation_none)
+    {
+        T* trans_val_A = reinterpret_cast<T*>(buffer);
+        buffer += ((sizeof(T) * nnz_A - 1) / 256 + 1) * 256;
+
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csrgemm_gather(handle,
+                                     trans_A,
+                                     nnz_A,
+                                     reinterpret_cast<const I*>(info->trans_perm_A),
+                                     csr_val_A,
+                                     trans_val_A));
+
+        val_A     = trans_val_A;
+        row_ptr_A = reinterpret_cast<const I*>(info->trans_row_ptr_A);
+        col_ind_A = reinterpret_cast<const J*>(info->trans_col_ind_A);
+    }
+
+    // op(B)
+    const T* val_B     = csr_val_B;
+    const I* row_ptr_B = csr_row_ptr_B;
+    const J* col_ind_B = csr_col_ind_B;
+
+    if(trans_B != rocsparse_operation_none)
+    {
+        T* trans_val_B = reinterpret_cast<T*>(buffer);
+        buffer += ((sizeof(T) * nnz_B - 1) / 256 + 1) * 256;
+
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csrgemm_gather(handle,
+                                     trans_B,
+                                     nnz_B,
+                                     reinterpret_cast<const I*>(info->trans_perm_B),
+                                     csr_val_B,
+                                     trans_val_B));
+
+        val_B     = trans_val_B;
+        row_ptr_B = reinterpret_cast<const I*>(info->trans_row_ptr_B);
+        col_ind_B = reinterpret_cast<const J*>(info->trans_col_ind_B);
+    }
+
     // Perform gemm calculation
-    return rocsparse_csrgemm_calc_template<T>(handle,
-                                              trans_A,
-                                              trans_B,
-                                              m,
-                                              n,
-                                              k,
-                                              alpha,
-                                              descr_A,
-                                              nnz_A,
-                                              csr_val_A,
-                                              csr_row_ptr_A,
-                                              csr_col_ind_A,
-                                              descr_B,
-                                              nnz_B,
-                                              csr_val_B,
-                                              csr_row_ptr_B,
-                                              csr_col_ind_B,
-                                              beta,
-                                              descr_D,
-                                              nnz_D,
-                                              csr_val_D,
-                                              csr_row_ptr_D,
-                                              csr_col_ind_D,
-                                              descr_C,
-                                              csr_val_C,
-                                              csr_row_ptr_C,
-                                              csr_col_ind_C,
-                                              info_C,
-                                              temp_buffer);
+    return rocsparse_csrgemm_calc_template<I, J, T>(handle,
+                                                    trans_A,
+                                                    trans_B,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    alpha,
+                                                    descr_A,
+                                                    nnz_A,
+                                                    val_A,
+                                                    row_ptr_A,
+                                                    col_ind_A,
+                                                    descr_B,
+                                                    nnz_B,
+                                                    val_B,
+                                                    row_ptr_B,
+                                                    col_ind_B,
+                                                    beta,
+                                                    descr_D,
+                                                    nnz_D,
+                                                    csr_val_D,
+                                                    csr_row_ptr_D,
+                                                    csr_col_ind_D,
+                                                    descr_C,
+                                                    csr_val_C,
+                                                    csr_row_ptr_C,
+                                                    csr_col_ind_C,
+                                                    info_C,
+                                                    buffer);
 }
 
-template <typename T, unsigned int BLOCKSIZE>
+template <typename I, typename T, unsigned int BLOCKSIZE>
 __launch_bounds__(BLOCKSIZE) __global__ void csrgemm_copy_scale_host_pointer(
-    rocsparse_int size, T alpha, const T* __restrict__ in, T* __restrict__ out)
+    I size, T alpha, const T* __restrict__ in, T* __restrict__ out)
 {
-    csrgemm_copy_scale_device<T, BLOCKSIZE>(size, alpha, in, out);
+    csrgemm_copy_scale_device<I, T, BLOCKSIZE>(size, alpha, in, out);
 }
 
-template <typename T, unsigned int BLOCKSIZE>
+template <typename I, typename T, unsigned int BLOCKSIZE>
 __launch_bounds__(BLOCKSIZE) __global__ void csrgemm_copy_scale_device_pointer(
-    rocsparse_int size, const T* __restrict__ alpha, const T* __restrict__ in, T* __restrict__ out)
+    I size, const T* __restrict__ alpha, const T* __restrict__ in, T* __restrict__ out)
 {
-    csrgemm_copy_scale_device<T, BLOCKSIZE>(size, *alpha, in, out);
+    csrgemm_copy_scale_device<I, T, BLOCKSIZE>(size, *alpha, in, out);
 }
 
-template <typename T>
+template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrgemm_scal_template(rocsparse_handle          handle,
-                                                 rocsparse_int             m,
-                                                 rocsparse_int             n,
+                                                 J                         m,
+                                                 J                         n,
                                                  const T*                  beta,
                                                  const rocsparse_mat_descr descr_D,
-                                                 rocsparse_int             nnz_D,
+                                                 I                         nnz_D,
                                                  const T*                  csr_val_D,
-                                                 const rocsparse_int*      csr_row_ptr_D,
-                                                 const rocsparse_int*      csr_col_ind_D,
+                                                 const I*                  csr_row_ptr_D,
+                                                 const J*                  csr_col_ind_D,
                                                  const rocsparse_mat_descr descr_C,
                                                  T*                        csr_val_C,
-                                                 const rocsparse_int*      csr_row_ptr_C,
-                                                 rocsparse_int*            csr_col_ind_C,
+                                                 const I*                  csr_row_ptr_C,
+                                                 J*                        csr_col_ind_C,
                                                  const rocsparse_mat_info  info_C,
                                                  void*                     temp_buffer)
 {
@@ -1952,7 +2272,7 @@ rocsparse_status rocsparse_csrgemm_scal_template(rocsparse_handle          handl
     dim3 csrgemm_blocks((nnz_D - 1) / CSRGEMM_DIM + 1);
     dim3 csrgemm_threads(CSRGEMM_DIM);
 
-    hipLaunchKernelGGL((csrgemm_copy<CSRGEMM_DIM>),
+    hipLaunchKernelGGL((csrgemm_copy<I, J, CSRGEMM_DIM>),
                        csrgemm_blocks,
                        csrgemm_threads,
                        0,
@@ -1966,7 +2286,7 @@ rocsparse_status rocsparse_csrgemm_scal_template(rocsparse_handle          handl
     // Scale the matrix
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
-        hipLaunchKernelGGL((csrgemm_copy_scale_device_pointer<T, CSRGEMM_DIM>),
+        hipLaunchKernelGGL((csrgemm_copy_scale_device_pointer<I, T, CSRGEMM_DIM>),
                            csrgemm_blocks,
                            csrgemm_threads,
                            0,
@@ -1978,7 +2298,7 @@ rocsparse_status rocsparse_csrgemm_scal_template(rocsparse_handle          handl
     }
     else
     {
-        hipLaunchKernelGGL((csrgemm_copy_scale_host_pointer<T, CSRGEMM_DIM>),
+        hipLaunchKernelGGL((csrgemm_copy_scale_host_pointer<I, T, CSRGEMM_DIM>),
                            csrgemm_blocks,
                            csrgemm_threads,
                            0,
@@ -1993,34 +2313,34 @@ rocsparse_status rocsparse_csrgemm_scal_template(rocsparse_handle          handl
     return rocsparse_status_success;
 }
 
-template <typename T>
+template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
                                             rocsparse_operation       trans_A,
                                             rocsparse_operation       trans_B,
-                                            rocsparse_int             m,
-                                            rocsparse_int             n,
-                                            rocsparse_int             k,
+                                            J                         m,
+                                            J                         n,
+                                            J                         k,
                                             const T*                  alpha,
                                             const rocsparse_mat_descr descr_A,
-                                            rocsparse_int             nnz_A,
+                                            I                         nnz_A,
                                             const T*                  csr_val_A,
-                                            const rocsparse_int*      csr_row_ptr_A,
-                                            const rocsparse_int*      csr_col_ind_A,
+                                            const I*                  csr_row_ptr_A,
+                                            const J*                  csr_col_ind_A,
                                             const rocsparse_mat_descr descr_B,
-                                            rocsparse_int             nnz_B,
+                                            I                         nnz_B,
                                             const T*                  csr_val_B,
-                                            const rocsparse_int*      csr_row_ptr_B,
-                                            const rocsparse_int*      csr_col_ind_B,
+                                            const I*                  csr_row_ptr_B,
+                                            const J*                  csr_col_ind_B,
                                             const T*                  beta,
                                             const rocsparse_mat_descr descr_D,
-                                            rocsparse_int             nnz_D,
+                                            I                         nnz_D,
                                             const T*                  csr_val_D,
-                                            const rocsparse_int*      csr_row_ptr_D,
-                                            const rocsparse_int*      csr_col_ind_D,
+                                            const I*                  csr_row_ptr_D,
+                                            const J*                  csr_col_ind_D,
                                             const rocsparse_mat_descr descr_C,
                                             T*                        csr_val_C,
-                                            const rocsparse_int*      csr_row_ptr_C,
-                                            rocsparse_int*            csr_col_ind_C,
+                                            const I*                  csr_row_ptr_C,
+                                            J*                        csr_col_ind_C,
                                             const rocsparse_mat_info  info_C,
                                             void*                     temp_buffer)
 {
@@ -2034,7 +2354,7 @@ rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrgemm"),
+                  appendIJ<I, J>(replaceX<T>("rocsparse_Xcsrgemm")),
                   trans_A,
                   trans_B,
                   m,
@@ -2065,7 +2385,7 @@ rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
                   (const void*&)temp_buffer);
 
         log_bench(handle,
-                  "./rocsparse-bench -f csrgemm -r",
+                  appendIJ<I, J>("./rocsparse-bench -f csrgemm") + " -r",
                   replaceX<T>("X"),
                   "--mtx <matrix.mtx> ",
                   "--alpha",
@@ -2076,7 +2396,7 @@ rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
     else
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrgemm"),
+                  appendIJ<I, J>(replaceX<T>("rocsparse_Xcsrgemm")),
                   trans_A,
                   trans_B,
                   m,
@@ -2129,54 +2449,54 @@ rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
     else if(info_C->csrgemm_info->mul == true && info_C->csrgemm_info->add == false)
     {
         // C = alpha * A * B
-        return rocsparse_csrgemm_mult_template<T>(handle,
-                                                  trans_A,
-                                                  trans_B,
-                                                  m,
-                                                  n,
-                                                  k,
-                                                  alpha,
-                                                  descr_A,
-                                                  nnz_A,
-                                                  csr_val_A,
-                                                  csr_row_ptr_A,
-                                                  csr_col_ind_A,
-                                                  descr_B,
-                                                  nnz_B,
-                                                  csr_val_B,
-                                                  csr_row_ptr_B,
-                                                  csr_col_ind_B,
-                                                  beta,
-                                                  descr_D,
-                                                  nnz_D,
-                                                  csr_val_D,
-                                                  csr_row_ptr_D,
-                                                  csr_col_ind_D,
-                                                  descr_C,
-                                                  csr_val_C,
-                                                  csr_row_ptr_C,
-                                                  csr_col_ind_C,
-                                                  info_C,
-                                                  temp_buffer);
+        return rocsparse_csrgemm_mult_template<I, J, T>(handle,
+                                                        trans_A,
+                                                        trans_B,
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        alpha,
+                                                        descr_A,
+                                                        nnz_A,
+                                                        csr_val_A,
+                                                        csr_row_ptr_A,
+                                                        csr_col_ind_A,
+                                                        descr_B,
+                                                        nnz_B,
+                                                        csr_val_B,
+                                                        csr_row_ptr_B,
+                                                        csr_col_ind_B,
+                                                        beta,
+                                                        descr_D,
+                                                        nnz_D,
+                                                        csr_val_D,
+                                                        csr_row_ptr_D,
+                                                        csr_col_ind_D,
+                                                        descr_C,
+                                                        csr_val_C,
+                                                        csr_row_ptr_C,
+                                                        csr_col_ind_C,
+                                                        info_C,
+                                                        temp_buffer);
     }
     else if(info_C->csrgemm_info->mul == false && info_C->csrgemm_info->add == true)
     {
         // C = beta * D
-        return rocsparse_csrgemm_scal_template<T>(handle,
-                                                  m,
-                                                  n,
-                                                  beta,
-                                                  descr_D,
-                                                  nnz_D,
-                                                  csr_val_D,
-                                                  csr_row_ptr_D,
-                                                  csr_col_ind_D,
-                                                  descr_C,
-                                                  csr_val_C,
-                                                  csr_row_ptr_C,
-                                                  csr_col_ind_C,
-                                                  info_C,
-                                                  temp_buffer);
+        return rocsparse_csrgemm_scal_template<I, J, T>(handle,
+                                                        m,
+                                                        n,
+                                                        beta,
+                                                        descr_D,
+                                                        nnz_D,
+                                                        csr_val_D,
+                                                        csr_row_ptr_D,
+                                                        csr_col_ind_D,
+                                                        descr_C,
+                                                        csr_val_C,
+                                                        csr_row_ptr_C,
+                                                        csr_col_ind_C,
+                                                        info_C,
+                                                        temp_buffer);
     }
     else
     {
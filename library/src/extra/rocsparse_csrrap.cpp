@@ -0,0 +1,667 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_csrrap.hpp"
+#include "rocsparse_csrgemm.hpp"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+#include <rocprim/rocprim.hpp>
+
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void csrrap_index_base(rocsparse_int* nnz)
+{
+    --(*nnz);
+}
+
+// Build the structure of op(R) = R^T from R, which is stored as n x m matrix, i.e. an
+// explicit transpose of the sparsity pattern of R. The permutation maps each entry of
+// op(R) to its position in R, such that the values of R can be gathered during
+// computation. The arrays are kept in the csrrap info, m + 1 + 2 * nnz_R integers.
+static rocsparse_status rocsparse_csrrap_transpose(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             n,
+                                                   const rocsparse_mat_descr descr_R,
+                                                   rocsparse_int             nnz_R,
+                                                   const rocsparse_int*      csr_row_ptr_R,
+                                                   const rocsparse_int*      csr_col_ind_R,
+                                                   rocsparse_csrrap_info     info,
+                                                   void*                     temp_buffer)
+{
+    // Release the structure of a previous call
+    if(info->trans_row_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->trans_row_ptr));
+        info->trans_row_ptr = nullptr;
+    }
+    if(info->trans_col_ind != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->trans_col_ind));
+        info->trans_col_ind = nullptr;
+    }
+    if(info->trans_perm != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->trans_perm));
+        info->trans_perm = nullptr;
+    }
+
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->trans_perm, sizeof(rocsparse_int) * nnz_R));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->trans_row_ptr, sizeof(rocsparse_int) * (m + 1)));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->trans_col_ind, sizeof(rocsparse_int) * nnz_R));
+
+    return rocsparse_csrgemm_transpose(handle,
+                                       n,
+                                       m,
+                                       nnz_R,
+                                       csr_row_ptr_R,
+                                       csr_col_ind_R,
+                                       descr_R->base,
+                                       info->trans_row_ptr,
+                                       info->trans_col_ind,
+                                       info->trans_perm,
+                                       temp_buffer);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csrrap_buffer_size(rocsparse_handle          handle,
+                                                         rocsparse_operation       trans_R,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             n,
+                                                         rocsparse_int             k,
+                                                         const rocsparse_mat_descr descr_R,
+                                                         rocsparse_int             nnz_R,
+                                                         const rocsparse_int*      csr_row_ptr_R,
+                                                         const rocsparse_int*      csr_col_ind_R,
+                                                         const rocsparse_mat_descr descr_A,
+                                                         rocsparse_int             nnz_A,
+                                                         const rocsparse_int*      csr_row_ptr_A,
+                                                         const rocsparse_int*      csr_col_ind_A,
+                                                         const rocsparse_mat_descr descr_P,
+                                                         rocsparse_int             nnz_P,
+                                                         const rocsparse_int*      csr_row_ptr_P,
+                                                         const rocsparse_int*      csr_col_ind_P,
+                                                         rocsparse_mat_info        info_C,
+                                                         size_t*                   buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrrap_buffer_size",
+              trans_R,
+              m,
+              n,
+              k,
+              (const void*&)descr_R,
+              nnz_R,
+              (const void*&)csr_row_ptr_R,
+              (const void*&)csr_col_ind_R,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_P,
+              nnz_P,
+              (const void*&)csr_row_ptr_P,
+              (const void*&)csr_col_ind_P,
+              (const void*&)info_C,
+              (const void*&)buffer_size);
+
+    // Check for valid rocsparse_mat_info
+    if(info_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_R < 0 || nnz_A < 0 || nnz_P < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr_R == nullptr || csr_row_ptr_R == nullptr || csr_col_ind_R == nullptr
+       || descr_A == nullptr || csr_row_ptr_A == nullptr || csr_col_ind_A == nullptr
+       || descr_P == nullptr || csr_row_ptr_P == nullptr || csr_col_ind_P == nullptr
+       || buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check index base
+    if(descr_R->base != rocsparse_index_base_zero && descr_R->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_A->base != rocsparse_index_base_zero && descr_A->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_P->base != rocsparse_index_base_zero && descr_P->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr_R->type != rocsparse_matrix_type_general
+       || descr_A->type != rocsparse_matrix_type_general
+       || descr_P->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Clear csrrap info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrrap_info(info_C->csrrap_info));
+
+    // Create csrrap info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrrap_info(&info_C->csrrap_info));
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || k == 0 || nnz_R == 0 || nnz_A == 0 || nnz_P == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // rocprim exclusive scan
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                csr_row_ptr_A,
+                                                &nnz_A,
+                                                0,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    *buffer_size = ((rocprim_size - 1) / 256 + 1) * 256;
+
+    // Structure of op(R) for transposed R
+    if(trans_R != rocsparse_operation_none)
+    {
+        size_t transpose_size;
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csrgemm_transpose_buffer_size(handle, m, nnz_R, &transpose_size));
+
+        *buffer_size = std::max(*buffer_size, transpose_size);
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrrap_nnz(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans_R,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             k,
+                                                 const rocsparse_mat_descr descr_R,
+                                                 rocsparse_int             nnz_R,
+                                                 const rocsparse_int*      csr_row_ptr_R,
+                                                 const rocsparse_int*      csr_col_ind_R,
+                                                 const rocsparse_mat_descr descr_A,
+                                                 rocsparse_int             nnz_A,
+                                                 const rocsparse_int*      csr_row_ptr_A,
+                                                 const rocsparse_int*      csr_col_ind_A,
+                                                 const rocsparse_mat_descr descr_P,
+                                                 rocsparse_int             nnz_P,
+                                                 const rocsparse_int*      csr_row_ptr_P,
+                                                 const rocsparse_int*      csr_col_ind_P,
+                                                 const rocsparse_mat_descr descr_C,
+                                                 rocsparse_int*            csr_row_ptr_C,
+                                                 rocsparse_int*            nnz_C,
+                                                 const rocsparse_mat_info  info_C,
+                                                 void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrrap_nnz",
+              trans_R,
+              m,
+              n,
+              k,
+              (const void*&)descr_R,
+              nnz_R,
+              (const void*&)csr_row_ptr_R,
+              (const void*&)csr_col_ind_R,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_P,
+              nnz_P,
+              (const void*&)csr_row_ptr_P,
+              (const void*&)csr_col_ind_P,
+              (const void*&)descr_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)nnz_C,
+              (const void*&)info_C,
+              (const void*&)temp_buffer);
+
+    // Check for valid rocsparse_mat_info and rocsparse_csrrap_info
+    if(info_C == nullptr || info_C->csrrap_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_R < 0 || nnz_A < 0 || nnz_P < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr_R == nullptr || csr_row_ptr_R == nullptr || csr_col_ind_R == nullptr
+       || descr_A == nullptr || csr_row_ptr_A == nullptr || csr_col_ind_A == nullptr
+       || descr_P == nullptr || csr_row_ptr_P == nullptr || csr_col_ind_P == nullptr
+       || descr_C == nullptr || csr_row_ptr_C == nullptr || nnz_C == nullptr
+       || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check index base
+    if(descr_R->base != rocsparse_index_base_zero && descr_R->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_A->base != rocsparse_index_base_zero && descr_A->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_P->base != rocsparse_index_base_zero && descr_P->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_C->base != rocsparse_index_base_zero && descr_C->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr_R->type != rocsparse_matrix_type_general
+       || descr_A->type != rocsparse_matrix_type_general
+       || descr_P->type != rocsparse_matrix_type_general
+       || descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Store data to verify the subsequent computation
+    rocsparse_csrrap_info info = info_C->csrrap_info;
+
+    info->trans_R       = trans_R;
+    info->m             = m;
+    info->n             = n;
+    info->k             = k;
+    info->nnz_R         = nnz_R;
+    info->csr_row_ptr_R = csr_row_ptr_R;
+    info->csr_col_ind_R = csr_col_ind_R;
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || k == 0 || nnz_R == 0 || nnz_A == 0 || nnz_P == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_C = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Structure of op(R)
+    const rocsparse_int* row_ptr_R = csr_row_ptr_R;
+    const rocsparse_int* col_ind_R = csr_col_ind_R;
+
+    if(trans_R != rocsparse_operation_none)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrrap_transpose(
+            handle, m, n, descr_R, nnz_R, csr_row_ptr_R, csr_col_ind_R, info, temp_buffer));
+
+        row_ptr_R = info->trans_row_ptr;
+        col_ind_R = info->trans_col_ind;
+    }
+
+    // Count the entries of each row of C, rows that exceed the hash table are flagged
+    hipLaunchKernelGGL((csrrap_nnz_block_per_row<CSRRAP_DIM,
+                                                 CSRRAP_SUB,
+                                                 CSRRAP_HASHSIZE,
+                                                 CSRRAP_NNZ_HASH,
+                                                 CSRRAP_LIMIT>),
+                       dim3(m),
+                       dim3(CSRRAP_DIM),
+                       0,
+                       stream,
+                       row_ptr_R,
+                       col_ind_R,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_row_ptr_P,
+                       csr_col_ind_P,
+                       csr_row_ptr_C,
+                       descr_R->base,
+                       descr_A->base,
+                       descr_P->base);
+
+    // Count the entries of all flagged rows
+    hipLaunchKernelGGL(
+        (csrrap_nnz_block_per_row_multipass<CSRRAP_DIM, CSRRAP_SUB, CSRRAP_CHUNKSIZE>),
+        dim3(m),
+        dim3(CSRRAP_DIM),
+        0,
+        stream,
+        k,
+        row_ptr_R,
+        col_ind_R,
+        csr_row_ptr_A,
+        csr_col_ind_A,
+        csr_row_ptr_P,
+        csr_col_ind_P,
+        csr_row_ptr_C,
+        descr_R->base,
+        descr_A->base,
+        descr_P->base);
+
+    // Exclusive sum to obtain row pointers of C
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                descr_C->base,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(temp_buffer,
+                                                rocprim_size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                descr_C->base,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Store nnz of C
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+
+        // Adjust nnz by index base
+        if(descr_C->base == rocsparse_index_base_one)
+        {
+            hipLaunchKernelGGL((csrrap_index_base<1>), dim3(1), dim3(1), 0, stream, nnz_C);
+        }
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Adjust nnz by index base
+        *nnz_C -= descr_C->base;
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsrrap(rocsparse_handle          handle,
+                                              rocsparse_operation       trans_R,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             k,
+                                              const rocsparse_mat_descr descr_R,
+                                              rocsparse_int             nnz_R,
+                                              const float*              csr_val_R,
+                                              const rocsparse_int*      csr_row_ptr_R,
+                                              const rocsparse_int*      csr_col_ind_R,
+                                              const rocsparse_mat_descr descr_A,
+                                              rocsparse_int             nnz_A,
+                                              const float*              csr_val_A,
+                                              const rocsparse_int*      csr_row_ptr_A,
+                                              const rocsparse_int*      csr_col_ind_A,
+                                              const rocsparse_mat_descr descr_P,
+                                              rocsparse_int             nnz_P,
+                                              const float*              csr_val_P,
+                                              const rocsparse_int*      csr_row_ptr_P,
+                                              const rocsparse_int*      csr_col_ind_P,
+                                              const rocsparse_mat_descr descr_C,
+                                              float*                    csr_val_C,
+                                              const rocsparse_int*      csr_row_ptr_C,
+                                              rocsparse_int*            csr_col_ind_C,
+                                              const rocsparse_mat_info  info_C)
+{
+    return rocsparse_csrrap_template(handle,
+                                     trans_R,
+                                     m,
+                                     n,
+                                     k,
+                                     descr_R,
+                                     nnz_R,
+                                     csr_val_R,
+                                     csr_row_ptr_R,
+                                     csr_col_ind_R,
+                                     descr_A,
+                                     nnz_A,
+                                     csr_val_A,
+                                     csr_row_ptr_A,
+                                     csr_col_ind_A,
+                                     descr_P,
+                                     nnz_P,
+                                     csr_val_P,
+                                     csr_row_ptr_P,
+                                     csr_col_ind_P,
+                                     descr_C,
+                                     csr_val_C,
+                                     csr_row_ptr_C,
+                                     csr_col_ind_C,
+                                     info_C);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrrap(rocsparse_handle          handle,
+                                              rocsparse_operation       trans_R,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             k,
+                                              const rocsparse_mat_descr descr_R,
+                                              rocsparse_int             nnz_R,
+                                              const double*             csr_val_R,
+                                              const rocsparse_int*      csr_row_ptr_R,
+                                              const rocsparse_int*      csr_col_ind_R,
+                                              const rocsparse_mat_descr descr_A,
+                                              rocsparse_int             nnz_A,
+                                              const double*             csr_val_A,
+                                              const rocsparse_int*      csr_row_ptr_A,
+                                              const rocsparse_int*      csr_col_ind_A,
+                                              const rocsparse_mat_descr descr_P,
+                                              rocsparse_int             nnz_P,
+                                              const double*             csr_val_P,
+                                              const rocsparse_int*      csr_row_ptr_P,
+                                              const rocsparse_int*      csr_col_ind_P,
+                                              const rocsparse_mat_descr descr_C,
+                                              double*                   csr_val_C,
+                                              const rocsparse_int*      csr_row_ptr_C,
+                                              rocsparse_int*            csr_col_ind_C,
+                                              const rocsparse_mat_info  info_C)
+{
+    return rocsparse_csrrap_template(handle,
+                                     trans_R,
+                                     m,
+                                     n,
+                                     k,
+                                     descr_R,
+                                     nnz_R,
+                                     csr_val_R,
+                                     csr_row_ptr_R,
+                                     csr_col_ind_R,
+                                     descr_A,
+                                     nnz_A,
+                                     csr_val_A,
+                                     csr_row_ptr_A,
+                                     csr_col_ind_A,
+                                     descr_P,
+                                     nnz_P,
+                                     csr_val_P,
+                                     csr_row_ptr_P,
+                                     csr_col_ind_P,
+                                     descr_C,
+                                     csr_val_C,
+                                     csr_row_ptr_C,
+                                     csr_col_ind_C,
+                                     info_C);
+}
+
+extern "C" rocsparse_status rocsparse_ccsrrap(rocsparse_handle               handle,
+                                              rocsparse_operation            trans_R,
+                                              rocsparse_int                  m,
+                                              rocsparse_int                  n,
+                                              rocsparse_int                  k,
+                                              const rocsparse_mat_descr      descr_R,
+                                              rocsparse_int                  nnz_R,
+                                              const rocsparse_float_complex* csr_val_R,
+                                              const rocsparse_int*           csr_row_ptr_R,
+                                              const rocsparse_int*           csr_col_ind_R,
+                                              const rocsparse_mat_descr      descr_A,
+                                              rocsparse_int                  nnz_A,
+                                              const rocsparse_float_complex* csr_val_A,
+                                              const rocsparse_int*           csr_row_ptr_A,
+                                              const rocsparse_int*           csr_col_ind_A,
+                                              const rocsparse_mat_descr      descr_P,
+                                              rocsparse_int                  nnz_P,
+                                              const rocsparse_float_complex* csr_val_P,
+                                              const rocsparse_int*           csr_row_ptr_P,
+                                              const rocsparse_int*           csr_col_ind_P,
+                                              const rocsparse_mat_descr      descr_C,
+                                              rocsparse_float_complex*       csr_val_C,
+                                              const rocsparse_int*           csr_row_ptr_C,
+                                              rocsparse_int*                 csr_col_ind_C,
+                                              const rocsparse_mat_info       info_C)
+{
+    return rocsparse_csrrap_template(handle,
+                                     trans_R,
+                                     m,
+                                     n,
+                                     k,
+                                     descr_R,
+                                     nnz_R,
+                                     csr_val_R,
+                                     csr_row_ptr_R,
+                                     csr_col_ind_R,
+                                     descr_A,
+                                     nnz_A,
+                                     csr_val_A,
+                                     csr_row_ptr_A,
+                                     csr_col_ind_A,
+                                     descr_P,
+                                     nnz_P,
+                                     csr_val_P,
+                                     csr_row_ptr_P,
+                                     csr_col_ind_P,
+                                     descr_C,
+                                     csr_val_C,
+                                     csr_row_ptr_C,
+                                     csr_col_ind_C,
+                                     info_C);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrrap(rocsparse_handle                handle,
+                                              rocsparse_operation             trans_R,
+                                              rocsparse_int                   m,
+                                              rocsparse_int                   n,
+                                              rocsparse_int                   k,
+                                              const rocsparse_mat_descr       descr_R,
+                                              rocsparse_int                   nnz_R,
+                                              const rocsparse_double_complex* csr_val_R,
+                                              const rocsparse_int*            csr_row_ptr_R,
+                                              const rocsparse_int*            csr_col_ind_R,
+                                              const rocsparse_mat_descr       descr_A,
+                                              rocsparse_int                   nnz_A,
+                                              const rocsparse_double_complex* csr_val_A,
+                                              const rocsparse_int*            csr_row_ptr_A,
+                                              const rocsparse_int*            csr_col_ind_A,
+                                              const rocsparse_mat_descr       descr_P,
+                                              rocsparse_int                   nnz_P,
+                                              const rocsparse_double_complex* csr_val_P,
+                                              const rocsparse_int*            csr_row_ptr_P,
+                                              const rocsparse_int*            csr_col_ind_P,
+                                              const rocsparse_mat_descr       descr_C,
+                                              rocsparse_double_complex*       csr_val_C,
+                                              const rocsparse_int*            csr_row_ptr_C,
+                                              rocsparse_int*                  csr_col_ind_C,
+                                              const rocsparse_mat_info        info_C)
+{
+    return rocsparse_csrrap_template(handle,
+                                     trans_R,
+                                     m,
+                                     n,
+                                     k,
+                                     descr_R,
+                                     nnz_R,
+                                     csr_val_R,
+                                     csr_row_ptr_R,
+                                     csr_col_ind_R,
+                                     descr_A,
+                                     nnz_A,
+                                     csr_val_A,
+                                     csr_row_ptr_A,
+                                     csr_col_ind_A,
+                                     descr_P,
+                                     nnz_P,
+                                     csr_val_P,
+                                     csr_row_ptr_P,
+                                     csr_col_ind_P,
+                                     descr_C,
+                                     csr_val_C,
+                                     csr_row_ptr_C,
+                                     csr_col_ind_C,
+                                     info_C);
+}
@@ -0,0 +1,318 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRRAP_HPP
+#define ROCSPARSE_CSRRAP_HPP
+
+#include "csrrap_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+#define CSRRAP_DIM 256
+#define CSRRAP_SUB 16
+#define CSRRAP_HASHSIZE 1024
+#define CSRRAP_CHUNKSIZE 1024
+#define CSRRAP_NNZ_HASH 79
+#define CSRRAP_FLL_HASH 137
+
+// Rows of C with less than CSRRAP_LIMIT entries are processed using a hash table in
+// shared memory. The hash table keeps space for one in-flight insertion per thread.
+#define CSRRAP_LIMIT (CSRRAP_HASHSIZE - CSRRAP_DIM)
+
+template <typename T, bool CONJ>
+static void csrrap_fill_launcher(hipStream_t          stream,
+                                 rocsparse_int        m,
+                                 rocsparse_int        k,
+                                 const rocsparse_int* csr_row_ptr_R,
+                                 const rocsparse_int* csr_col_ind_R,
+                                 const T*             csr_val_R,
+                                 const rocsparse_int* perm_R,
+                                 const rocsparse_int* csr_row_ptr_A,
+                                 const rocsparse_int* csr_col_ind_A,
+                                 const T*             csr_val_A,
+                                 const rocsparse_int* csr_row_ptr_P,
+                                 const rocsparse_int* csr_col_ind_P,
+                                 const T*             csr_val_P,
+                                 const rocsparse_int* csr_row_ptr_C,
+                                 rocsparse_int*       csr_col_ind_C,
+                                 T*                   csr_val_C,
+                                 rocsparse_index_base base_R,
+                                 rocsparse_index_base base_A,
+                                 rocsparse_index_base base_P,
+                                 rocsparse_index_base base_C)
+{
+    // Rows that fit into the hash table
+    hipLaunchKernelGGL((csrrap_fill_block_per_row<T,
+                                                  CSRRAP_DIM,
+                                                  CSRRAP_SUB,
+                                                  CSRRAP_HASHSIZE,
+                                                  CSRRAP_FLL_HASH,
+                                                  CSRRAP_LIMIT,
+                                                  CONJ>),
+                       dim3(m),
+                       dim3(CSRRAP_DIM),
+                       0,
+                       stream,
+                       csr_row_ptr_R,
+                       csr_col_ind_R,
+                       csr_val_R,
+                       perm_R,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_val_A,
+                       csr_row_ptr_P,
+                       csr_col_ind_P,
+                       csr_val_P,
+                       csr_row_ptr_C,
+                       csr_col_ind_C,
+                       csr_val_C,
+                       base_R,
+                       base_A,
+                       base_P,
+                       base_C);
+
+    // Remaining rows are processed in chunks
+    hipLaunchKernelGGL((csrrap_fill_block_per_row_multipass<T,
+                                                            CSRRAP_DIM,
+                                                            CSRRAP_SUB,
+                                                            CSRRAP_CHUNKSIZE,
+                                                            CSRRAP_LIMIT,
+                                                            CONJ>),
+                       dim3(m),
+                       dim3(CSRRAP_DIM),
+                       0,
+                       stream,
+                       k,
+                       csr_row_ptr_R,
+                       csr_col_ind_R,
+                       csr_val_R,
+                       perm_R,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_val_A,
+                       csr_row_ptr_P,
+                       csr_col_ind_P,
+                       csr_val_P,
+                       csr_row_ptr_C,
+                       csr_col_ind_C,
+                       csr_val_C,
+                       base_R,
+                       base_A,
+                       base_P,
+                       base_C);
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrrap_template(rocsparse_handle          handle,
+                                           rocsparse_operation       trans_R,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             k,
+                                           const rocsparse_mat_descr descr_R,
+                                           rocsparse_int             nnz_R,
+                                           const T*                  csr_val_R,
+                                           const rocsparse_int*      csr_row_ptr_R,
+                                           const rocsparse_int*      csr_col_ind_R,
+                                           const rocsparse_mat_descr descr_A,
+                                           rocsparse_int             nnz_A,
+                                           const T*                  csr_val_A,
+                                           const rocsparse_int*      csr_row_ptr_A,
+                                           const rocsparse_int*      csr_col_ind_A,
+                                           const rocsparse_mat_descr descr_P,
+                                           rocsparse_int             nnz_P,
+                                           const T*                  csr_val_P,
+                                           const rocsparse_int*      csr_row_ptr_P,
+                                           const rocsparse_int*      csr_col_ind_P,
+                                           const rocsparse_mat_descr descr_C,
+                                           T*                        csr_val_C,
+                                           const rocsparse_int*      csr_row_ptr_C,
+                                           rocsparse_int*            csr_col_ind_C,
+                                           const rocsparse_mat_info  info_C)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrrap"),
+              trans_R,
+              m,
+              n,
+              k,
+              (const void*&)descr_R,
+              nnz_R,
+              (const void*&)csr_val_R,
+              (const void*&)csr_row_ptr_R,
+              (const void*&)csr_col_ind_R,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_val_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_P,
+              nnz_P,
+              (const void*&)csr_val_P,
+              (const void*&)csr_row_ptr_P,
+              (const void*&)csr_col_ind_P,
+              (const void*&)descr_C,
+              (const void*&)csr_val_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)csr_col_ind_C,
+              (const void*&)info_C);
+
+    // Check for valid rocsparse_mat_info and rocsparse_csrrap_info
+    if(info_C == nullptr || info_C->csrrap_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_R < 0 || nnz_A < 0 || nnz_P < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr_R == nullptr || csr_val_R == nullptr || csr_row_ptr_R == nullptr
+       || csr_col_ind_R == nullptr || descr_A == nullptr || csr_val_A == nullptr
+       || csr_row_ptr_A == nullptr || csr_col_ind_A == nullptr || descr_P == nullptr
+       || csr_val_P == nullptr || csr_row_ptr_P == nullptr || csr_col_ind_P == nullptr
+       || descr_C == nullptr || csr_val_C == nullptr || csr_row_ptr_C == nullptr
+       || csr_col_ind_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check index base
+    if(descr_R->base != rocsparse_index_base_zero && descr_R->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_A->base != rocsparse_index_base_zero && descr_A->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_P->base != rocsparse_index_base_zero && descr_P->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_C->base != rocsparse_index_base_zero && descr_C->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr_R->type != rocsparse_matrix_type_general
+       || descr_A->type != rocsparse_matrix_type_general
+       || descr_P->type != rocsparse_matrix_type_general
+       || descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check that the structure of C has been computed for the same operation
+    rocsparse_csrrap_info info = info_C->csrrap_info;
+
+    if(info->trans_R != trans_R || info->m != m || info->n != n || info->k != k
+       || info->nnz_R != nnz_R || info->csr_row_ptr_R != csr_row_ptr_R
+       || info->csr_col_ind_R != csr_col_ind_R)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || k == 0 || nnz_R == 0 || nnz_A == 0 || nnz_P == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Structure of op(R), for transposed R, the values are gathered through the
+    // permutation that has been computed in csrrap_nnz
+    bool transposed = (trans_R != rocsparse_operation_none);
+
+    const rocsparse_int* row_ptr_R = transposed ? info->trans_row_ptr : csr_row_ptr_R;
+    const rocsparse_int* col_ind_R = transposed ? info->trans_col_ind : csr_col_ind_R;
+    const rocsparse_int* perm_R    = transposed ? info->trans_perm : nullptr;
+
+    if(trans_R == rocsparse_operation_conjugate_transpose)
+    {
+        csrrap_fill_launcher<T, true>(stream,
+                                      m,
+                                      k,
+                                      row_ptr_R,
+                                      col_ind_R,
+                                      csr_val_R,
+                                      perm_R,
+                                      csr_row_ptr_A,
+                                      csr_col_ind_A,
+                                      csr_val_A,
+                                      csr_row_ptr_P,
+                                      csr_col_ind_P,
+                                      csr_val_P,
+                                      csr_row_ptr_C,
+                                      csr_col_ind_C,
+                                      csr_val_C,
+                                      descr_R->base,
+                                      descr_A->base,
+                                      descr_P->base,
+                                      descr_C->base);
+    }
+    else
+    {
+        csrrap_fill_launcher<T, false>(stream,
+                                       m,
+                                       k,
+                                       row_ptr_R,
+                                       col_ind_R,
+                                       csr_val_R,
+                                       perm_R,
+                                       csr_row_ptr_A,
+                                       csr_col_ind_A,
+                                       csr_val_A,
+                                       csr_row_ptr_P,
+                                       csr_col_ind_P,
+                                       csr_val_P,
+                                       csr_row_ptr_C,
+                                       csr_col_ind_C,
+                                       csr_val_C,
+                                       descr_R->base,
+                                       descr_A->base,
+                                       descr_P->base,
+                                       descr_C->base);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSRRAP_HPP
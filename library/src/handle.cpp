@@ -27,64 +27,51 @@
 
 #include <hip/hip_runtime.h>
 
+#include <map>
+#include <mutex>
+
 __global__ void init_kernel(){};
 
+// Shared device states, one per device
+static std::mutex                              device_state_mutex;
+static std::map<int, _rocsparse_device_state*> device_states;
+
 /*******************************************************************************
- * constructor
+ * Initialize the shared state of a device
  ******************************************************************************/
-_rocsparse_handle::_rocsparse_handle()
+static void rocsparse_init_device_state(_rocsparse_device_state* state)
 {
-    // Default device is active device
-    THROW_IF_HIP_ERROR(hipGetDevice(&device));
-    THROW_IF_HIP_ERROR(hipGetDeviceProperties(&properties, device));
+    THROW_IF_HIP_ERROR(hipGetDeviceProperties(&state->properties, state->device));
 
     // Device wavefront size
-    wavefront_size = properties.warpSize;
+    state->wavefront_size = state->properties.warpSize;
 
 #if HIP_VERSION >= 307
     // ASIC revision
-    asic_rev = properties.asicRevision;
+    state->asic_rev = state->properties.asicRevision;
 #else
-    asic_rev = 0;
+    state->asic_rev = 0;
 #endif
 
-    // Layer mode
-    char* str_layer_mode;
-    if((str_layer_mode = getenv("ROCSPARSE_LAYER")) == NULL)
-    {
-        layer_mode = rocsparse_layer_mode_none;
-    }
-    else
-    {
-        layer_mode = (rocsparse_layer_mode)(atoi(str_layer_mode));
-    }
-
     // Obtain size for coomv device buffer
-    rocsparse_int nthreads = properties.maxThreadsPerBlock;
-    rocsparse_int nprocs   = properties.multiProcessorCount;
+    rocsparse_int nthreads = state->properties.maxThreadsPerBlock;
+    rocsparse_int nprocs   = state->properties.multiProcessorCount;
     rocsparse_int nblocks  = (nprocs * nthreads - 1) / 128 + 1;
-    rocsparse_int nwfs     = nblocks * (128 / properties.warpSize);
+    rocsparse_int nwfs     = nblocks * (128 / state->properties.warpSize);
 
     size_t coomv_size = (((sizeof(rocsparse_int) + 16) * nwfs - 1) / 256 + 1) * 256;
 
-    // Allocate device buffer
-    buffer_size = (coomv_size > 1024 * 1024) ? coomv_size : 1024 * 1024;
-    THROW_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    // Device buffer size
+    state->buffer_size = (coomv_size > 1024 * 1024) ? coomv_size : 1024 * 1024;
 
     // Device one
-    THROW_IF_HIP_ERROR(hipMalloc(&sone, sizeof(float)));
-    THROW_IF_HIP_ERROR(hipMalloc(&done, sizeof(double)));
-    THROW_IF_HIP_ERROR(hipMalloc(&cone, sizeof(rocsparse_float_complex)));
-    THROW_IF_HIP_ERROR(hipMalloc(&zone, sizeof(rocsparse_double_complex)));
+    THROW_IF_HIP_ERROR(hipMalloc(&state->sone, sizeof(float)));
+    THROW_IF_HIP_ERROR(hipMalloc(&state->done, sizeof(double)));
+    THROW_IF_HIP_ERROR(hipMalloc(&state->cone, sizeof(rocsparse_float_complex)));
+    THROW_IF_HIP_ERROR(hipMalloc(&state->zone, sizeof(rocsparse_double_complex)));
 
     // Execute empty kernel for initialization
-    hipLaunchKernelGGL(init_kernel, dim3(1), dim3(1), 0, stream);
-
-    // Execute memset for initialization
-    THROW_IF_HIP_ERROR(hipMemsetAsync(sone, 0, sizeof(float), stream));
-    THROW_IF_HIP_ERROR(hipMemsetAsync(done, 0, sizeof(double), stream));
-    THROW_IF_HIP_ERROR(hipMemsetAsync(cone, 0, sizeof(rocsparse_float_complex), stream));
-    THROW_IF_HIP_ERROR(hipMemsetAsync(zone, 0, sizeof(rocsparse_double_complex), stream));
+    hipLaunchKernelGGL(init_kernel, dim3(1), dim3(1), 0, 0);
 
     float  hsone = 1.0f;
     double hdone = 1.0;
@@ -92,15 +79,107 @@ _rocsparse_handle::_rocsparse_handle()
     rocsparse_float_complex  hcone = rocsparse_float_complex(1.0f, 0.0f);
     rocsparse_double_complex hzone = rocsparse_double_complex(1.0, 0.0);
 
-    THROW_IF_HIP_ERROR(hipMemcpyAsync(sone, &hsone, sizeof(float), hipMemcpyHostToDevice, stream));
-    THROW_IF_HIP_ERROR(hipMemcpyAsync(done, &hdone, sizeof(double), hipMemcpyHostToDevice, stream));
-    THROW_IF_HIP_ERROR(hipMemcpyAsync(
-        cone, &hcone, sizeof(rocsparse_float_complex), hipMemcpyHostToDevice, stream));
-    THROW_IF_HIP_ERROR(hipMemcpyAsync(
-        zone, &hzone, sizeof(rocsparse_double_complex), hipMemcpyHostToDevice, stream));
+    THROW_IF_HIP_ERROR(hipMemcpy(state->sone, &hsone, sizeof(float), hipMemcpyHostToDevice));
+    THROW_IF_HIP_ERROR(hipMemcpy(state->done, &hdone, sizeof(double), hipMemcpyHostToDevice));
+    THROW_IF_HIP_ERROR(
+        hipMemcpy(state->cone, &hcone, sizeof(rocsparse_float_complex), hipMemcpyHostToDevice));
+    THROW_IF_HIP_ERROR(
+        hipMemcpy(state->zone, &hzone, sizeof(rocsparse_double_complex), hipMemcpyHostToDevice));
+}
+
+/*******************************************************************************
+ * Destroy the shared state of a device
+ ******************************************************************************/
+static void rocsparse_destroy_device_state(_rocsparse_device_state* state)
+{
+    PRINT_IF_HIP_ERROR(hipFree(state->sone));
+    PRINT_IF_HIP_ERROR(hipFree(state->done));
+    PRINT_IF_HIP_ERROR(hipFree(state->cone));
+    PRINT_IF_HIP_ERROR(hipFree(state->zone));
+
+    delete state;
+}
+
+/*******************************************************************************
+ * Obtain the shared state of the currently active device
+ ******************************************************************************/
+_rocsparse_device_state* rocsparse_acquire_device_state()
+{
+    // Default device is active device
+    int device;
+    THROW_IF_HIP_ERROR(hipGetDevice(&device));
+
+    std::lock_guard<std::mutex> lock(device_state_mutex);
+
+    _rocsparse_device_state*& state = device_states[device];
+
+    // First handle on this device creates the shared state
+    if(state == nullptr)
+    {
+        state         = new _rocsparse_device_state;
+        state->device = device;
+
+        try
+        {
+            rocsparse_init_device_state(state);
+        }
+        catch(const rocsparse_status&)
+        {
+            rocsparse_destroy_device_state(state);
+            device_states.erase(device);
+            throw;
+        }
+    }
 
-    // Wait for device transfer to finish
-    THROW_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    ++state->ref_count;
+
+    return state;
+}
+
+/*******************************************************************************
+ * Release the shared state of a device
+ ******************************************************************************/
+void rocsparse_release_device_state(_rocsparse_device_state* state)
+{
+    std::lock_guard<std::mutex> lock(device_state_mutex);
+
+    // Last handle on this device destroys the shared state
+    if(--state->ref_count == 0)
+    {
+        device_states.erase(state->device);
+        rocsparse_destroy_device_state(state);
+    }
+}
+
+/*******************************************************************************
+ * constructor
+ ******************************************************************************/
+_rocsparse_handle::_rocsparse_handle()
+    : shared(rocsparse_acquire_device_state())
+    , properties(shared->properties)
+{
+    // Device properties are shared by all handles on the same device
+    device         = shared->device;
+    wavefront_size = shared->wavefront_size;
+    asic_rev       = shared->asic_rev;
+    buffer_size    = shared->buffer_size;
+
+    // Device one
+    sone = shared->sone;
+    done = shared->done;
+    cone = shared->cone;
+    zone = shared->zone;
+
+    // Layer mode
+    char* str_layer_mode;
+    if((str_layer_mode = getenv("ROCSPARSE_LAYER")) == NULL)
+    {
+        layer_mode = rocsparse_layer_mode_none;
+    }
+    else
+    {
+        layer_mode = (rocsparse_layer_mode)(atoi(str_layer_mode));
+    }
 
     // Open log file
     if(layer_mode & rocsparse_layer_mode_log_trace)
@@ -120,11 +199,12 @@ _rocsparse_handle::_rocsparse_handle()
  ******************************************************************************/
 _rocsparse_handle::~_rocsparse_handle()
 {
-    PRINT_IF_HIP_ERROR(hipFree(buffer));
-    PRINT_IF_HIP_ERROR(hipFree(sone));
-    PRINT_IF_HIP_ERROR(hipFree(done));
-    PRINT_IF_HIP_ERROR(hipFree(cone));
-    PRINT_IF_HIP_ERROR(hipFree(zone));
+    if(buffer != nullptr)
+    {
+        PRINT_IF_HIP_ERROR(hipFree(buffer));
+    }
+
+    rocsparse_release_device_state(shared);
 
     // Close log files
     if(log_trace_ofs.is_open())
@@ -137,6 +217,21 @@ _rocsparse_handle::~_rocsparse_handle()
     }
 }
 
+/*******************************************************************************
+ * allocate device buffer:
+   The device buffer is only allocated when it is used for the first time,
+   such that handle creation does not require any device memory allocation
+ ******************************************************************************/
+rocsparse_status _rocsparse_handle::alloc_buffer()
+{
+    if(buffer == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
+    }
+
+    return rocsparse_status_success;
+}
+
 /*******************************************************************************
  * Exactly like cuSPARSE, rocSPARSE only uses one stream for one API routine
  ******************************************************************************/
@@ -200,11 +295,220 @@ rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info)
     }
 
     // Clean up row blocks
-    if(info->size > 0)
+    if(info->row_blocks != nullptr)
     {
         RETURN_IF_HIP_ERROR(hipFree(info->row_blocks));
+        info->row_blocks = nullptr;
+    }
+
+    // Destruct
+    try
+    {
+        delete info;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_csrmv_info_size returns the number of bytes of device memory
+ * held by the csrmv info structure.
+ *******************************************************************************/
+size_t rocsparse_csrmv_info_size(const rocsparse_csrmv_info info)
+{
+    if(info == nullptr)
+    {
+        return 0;
+    }
+
+    // Row blocks, including the num entries and chunk offsets
+    if(info->row_blocks != nullptr)
+    {
+        return sizeof(unsigned long long) * (info->max_size + 1 + info->num_chunks);
+    }
+
+    return 0;
+}
+
+/********************************************************************************
+ * \brief rocsparse_bsrmv_info is a structure holding the rocsparse bsrmv info
+ * data gathered during bsrmv_ex_analysis. It must be initialized using the
+ * rocsparse_create_bsrmv_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_bsrmv_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_bsrmv_info(rocsparse_bsrmv_info* info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *info = new _rocsparse_bsrmv_info;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief Destroy bsrmv info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_bsrmv_info(rocsparse_bsrmv_info info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Clean up block transpose
+    if(info->trans_col_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->trans_col_ptr));
+        info->trans_col_ptr = nullptr;
+    }
+
+    if(info->trans_row_ind != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->trans_row_ind));
+        info->trans_row_ind = nullptr;
+    }
+
+    if(info->trans_val != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->trans_val));
+        info->trans_val = nullptr;
+    }
+
+    // Destruct
+    try
+    {
+        delete info;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_bsrmv_info_size returns the number of bytes of device memory
+ * held by the bsrmv info structure.
+ *******************************************************************************/
+size_t rocsparse_bsrmv_info_size(const rocsparse_bsrmv_info info)
+{
+    if(info == nullptr || info->trans_col_ptr == nullptr)
+    {
+        return 0;
+    }
+
+    // Block transpose column pointers, row indices and values
+    return sizeof(rocsparse_int) * (info->nb + 1 + info->nnzb) + info->trans_val_size;
+}
+
+/********************************************************************************
+ * \brief rocsparse_csrmv_format_info is a structure holding the rocsparse
+ * csrmv_format info data gathered during csrmv_format_analysis. It must be
+ * initialized using the rocsparse_create_csrmv_format_info() routine. It should
+ * be destroyed at the end using rocsparse_destroy_csrmv_format_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csrmv_format_info(rocsparse_csrmv_format_info* info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *info = new _rocsparse_csrmv_format_info;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief rocsparse_csrmv_format_info_clear releases the ELL, HYB and BSR
+ * representation held by the csrmv_format info structure.
+ *******************************************************************************/
+rocsparse_status rocsparse_csrmv_format_info_clear(rocsparse_csrmv_format_info info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Clean up ELL representation
+    if(info->ell_col_ind != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->ell_col_ind));
+        info->ell_col_ind = nullptr;
+    }
+
+    if(info->ell_val != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->ell_val));
+        info->ell_val = nullptr;
+    }
+
+    // Clean up HYB representation
+    if(info->hyb != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_hyb_mat(info->hyb));
+        info->hyb = nullptr;
+    }
+
+    // Clean up BSR representation
+    if(info->bsr_row_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->bsr_row_ptr));
+        info->bsr_row_ptr = nullptr;
+    }
+
+    if(info->bsr_col_ind != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->bsr_col_ind));
+        info->bsr_col_ind = nullptr;
+    }
+
+    if(info->bsr_val != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->bsr_val));
+        info->bsr_val = nullptr;
+    }
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Destroy csrmv_format info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csrmv_format_info(rocsparse_csrmv_format_info info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_success;
     }
 
+    // Clean up representation
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_format_info_clear(info));
+
     // Destruct
     try
     {
@@ -217,6 +521,49 @@ rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info)
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief rocsparse_csrmv_format_info_size returns the number of bytes of device
+ * memory held by the csrmv_format info structure.
+ *******************************************************************************/
+size_t rocsparse_csrmv_format_info_size(const rocsparse_csrmv_format_info info)
+{
+    if(info == nullptr)
+    {
+        return 0;
+    }
+
+    size_t size = 0;
+
+    // ELL column indices and values
+    if(info->ell_col_ind != nullptr)
+    {
+        size += (sizeof(rocsparse_int) + info->val_size) * info->ell_width * info->m;
+    }
+
+    // HYB matrix
+    if(info->hyb != nullptr)
+    {
+        size_t ell_size;
+        size_t coo_size;
+        size_t hyb_size;
+
+        if(rocsparse_get_hyb_mat_size(info->hyb, &ell_size, &coo_size, &hyb_size)
+           == rocsparse_status_success)
+        {
+            size += hyb_size;
+        }
+    }
+
+    // BSR row pointers, column indices and blocks
+    if(info->bsr_row_ptr != nullptr)
+    {
+        size += sizeof(rocsparse_int) * (info->mb + 1 + info->nnzb)
+                + info->val_size * info->nnzb * info->bsr_dim * info->bsr_dim;
+    }
+
+    return size;
+}
+
 /********************************************************************************
  * \brief rocsparse_trm_info is a structure holding the rocsparse bsrsv, csrsv,
  * csrsm, csrilu0 and csric0 data gathered during csrsv_analysis,
@@ -268,6 +615,12 @@ rocsparse_status rocsparse_destroy_trm_info(rocsparse_trm_info info)
         info->trm_diag_ind = nullptr;
     }
 
+    if(info->d_max_nnz != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->d_max_nnz));
+        info->d_max_nnz = nullptr;
+    }
+
     // Clear trmt arrays
     if(info->trmt_perm != nullptr)
     {
@@ -299,6 +652,54 @@ rocsparse_status rocsparse_destroy_trm_info(rocsparse_trm_info info)
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief rocsparse_trm_info_size returns the number of bytes of device memory
+ * held by the trm info structure.
+ *******************************************************************************/
+size_t rocsparse_trm_info_size(const rocsparse_trm_info info)
+{
+    if(info == nullptr)
+    {
+        return 0;
+    }
+
+    size_t size = 0;
+
+    // Row map and diagonal entry pointers
+    if(info->row_map != nullptr)
+    {
+        size += sizeof(rocsparse_int) * info->m;
+    }
+
+    if(info->trm_diag_ind != nullptr)
+    {
+        size += info->offset_size * info->m;
+    }
+
+    if(info->d_max_nnz != nullptr)
+    {
+        size += sizeof(rocsparse_int);
+    }
+
+    // Transposed data
+    if(info->trmt_perm != nullptr)
+    {
+        size += info->offset_size * info->nnz;
+    }
+
+    if(info->trmt_row_ptr != nullptr)
+    {
+        size += info->offset_size * (info->m + 1);
+    }
+
+    if(info->trmt_col_ind != nullptr)
+    {
+        size += info->index_size * info->nnz;
+    }
+
+    return size;
+}
+
 /********************************************************************************
  * \brief rocsparse_check_trm_shared checks if the given trm info structure
  * shares its meta data with another trm info structure.
@@ -320,6 +721,14 @@ bool rocsparse_check_trm_shared(const rocsparse_mat_info info, rocsparse_trm_inf
         ++shared;
     if(trm == info->bsrsvt_upper_info)
         ++shared;
+    if(trm == info->bsrsm_lower_info)
+        ++shared;
+    if(trm == info->bsrsm_upper_info)
+        ++shared;
+    if(trm == info->bsrilu0_info)
+        ++shared;
+    if(trm == info->bsric0_info)
+        ++shared;
     if(trm == info->csrilu0_info)
         ++shared;
     if(trm == info->csric0_info)
@@ -377,6 +786,142 @@ rocsparse_status rocsparse_destroy_csrgemm_info(rocsparse_csrgemm_info info)
         return rocsparse_status_success;
     }
 
+    // Clean up structure of transposed A
+    if(info->trans_row_ptr_A != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->trans_row_ptr_A));
+        info->trans_row_ptr_A = nullptr;
+    }
+
+    if(info->trans_col_ind_A != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->trans_col_ind_A));
+        info->trans_col_ind_A = nullptr;
+    }
+
+    if(info->trans_perm_A != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->trans_perm_A));
+        info->trans_perm_A = nullptr;
+    }
+
+    // Clean up structure of transposed B
+    if(info->trans_row_ptr_B != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->trans_row_ptr_B));
+        info->trans_row_ptr_B = nullptr;
+    }
+
+    if(info->trans_col_ind_B != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->trans_col_ind_B));
+        info->trans_col_ind_B = nullptr;
+    }
+
+    if(info->trans_perm_B != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->trans_perm_B));
+        info->trans_perm_B = nullptr;
+    }
+
+    // Destruct
+    try
+    {
+        delete info;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_csrgemm_info_size returns the number of bytes of device memory
+ * held by the csrgemm info structure.
+ *******************************************************************************/
+size_t rocsparse_csrgemm_info_size(const rocsparse_csrgemm_info info)
+{
+    if(info == nullptr)
+    {
+        return 0;
+    }
+
+    size_t size = 0;
+
+    // Row pointers, column indices and permutation of transposed A
+    if(info->trans_row_ptr_A != nullptr)
+    {
+        size += info->offset_size * (info->m + 1 + info->nnz_A);
+        size += info->index_size * info->nnz_A;
+    }
+
+    // Row pointers, column indices and permutation of transposed B
+    if(info->trans_row_ptr_B != nullptr)
+    {
+        size += info->offset_size * (info->k + 1 + info->nnz_B);
+        size += info->index_size * info->nnz_B;
+    }
+
+    return size;
+}
+
+/********************************************************************************
+ * \brief rocsparse_csrrap_info is a structure holding the rocsparse csrrap info
+ * data gathered during csrrap_buffer_size and csrrap_nnz. It must be initialized
+ * using the rocsparse_create_csrrap_info() routine. It should be destroyed at the
+ * end using rocsparse_destroy_csrrap_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csrrap_info(rocsparse_csrrap_info* info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *info = new _rocsparse_csrrap_info;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief Destroy csrrap info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csrrap_info(rocsparse_csrrap_info info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Clean up structure of transposed R
+    if(info->trans_row_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->trans_row_ptr));
+        info->trans_row_ptr = nullptr;
+    }
+
+    if(info->trans_col_ind != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->trans_col_ind));
+        info->trans_col_ind = nullptr;
+    }
+
+    if(info->trans_perm != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->trans_perm));
+        info->trans_perm = nullptr;
+    }
+
     // Destruct
     try
     {
@@ -388,3 +933,18 @@ rocsparse_status rocsparse_destroy_csrgemm_info(rocsparse_csrgemm_info info)
     }
     return rocsparse_status_success;
 }
+
+/********************************************************************************
+ * \brief rocsparse_csrrap_info_size returns the number of bytes of device memory
+ * held by the csrrap info structure.
+ *******************************************************************************/
+size_t rocsparse_csrrap_info_size(const rocsparse_csrrap_info info)
+{
+    if(info == nullptr || info->trans_row_ptr == nullptr)
+    {
+        return 0;
+    }
+
+    // Row pointers, column indices and permutation of transposed R
+    return sizeof(rocsparse_int) * (info->m + 1 + 2 * info->nnz_R);
+}
@@ -27,6 +27,7 @@
 
 #include "rocsparse.h"
 
+#include <hip/hip_fp16.h>
 #include <hip/hip_runtime.h>
 
 // clang-format off
@@ -40,7 +41,10 @@ __device__ __forceinline__ float rocsparse_ldg(const float* ptr) { return __ldg(
 __device__ __forceinline__ double rocsparse_ldg(const double* ptr) { return __ldg(ptr); }
 __device__ __forceinline__ rocsparse_float_complex rocsparse_ldg(const rocsparse_float_complex* ptr) { return rocsparse_float_complex(__ldg((const float*)ptr), __ldg((const float*)ptr + 1)); }
 __device__ __forceinline__ rocsparse_double_complex rocsparse_ldg(const rocsparse_double_complex* ptr) { return rocsparse_double_complex(__ldg((const double*)ptr), __ldg((const double*)ptr + 1)); }
-__device__ __forceinline__ rocsparse_int rocsparse_ldg(const rocsparse_int* ptr) { return __ldg(ptr); }
+__device__ __forceinline__ int32_t rocsparse_ldg(const int32_t* ptr) { return __ldg(ptr); }
+__device__ __forceinline__ int64_t rocsparse_ldg(const int64_t* ptr) { return __ldg(ptr); }
+__device__ __forceinline__ rocsparse_half rocsparse_ldg(const rocsparse_half* ptr) { return rocsparse_half{__ldg(&ptr->data)}; }
+__device__ __forceinline__ rocsparse_bfloat16 rocsparse_ldg(const rocsparse_bfloat16* ptr) { return rocsparse_bfloat16{__ldg(&ptr->data)}; }
 
 __device__ __forceinline__ float rocsparse_fma(float p, float q, float r) { return fma(p, q, r); }
 __device__ __forceinline__ double rocsparse_fma(double p, double q, double r) { return fma(p, q, r); }
@@ -54,6 +58,8 @@ __device__ __forceinline__ double rocsparse_abs(rocsparse_double_complex x) { re
 
 __device__ __forceinline__ float rocsparse_conj(const float& x) { return x; }
 __device__ __forceinline__ double rocsparse_conj(const double& x) { return x; }
+__device__ __forceinline__ rocsparse_half rocsparse_conj(const rocsparse_half& x) { return x; }
+__device__ __forceinline__ rocsparse_bfloat16 rocsparse_conj(const rocsparse_bfloat16& x) { return x; }
 __device__ __forceinline__ rocsparse_float_complex rocsparse_conj(const rocsparse_float_complex& x) { return std::conj(x); }
 __device__ __forceinline__ rocsparse_double_complex rocsparse_conj(const rocsparse_double_complex& x) { return std::conj(x); }
 
@@ -62,17 +68,33 @@ __device__ __forceinline__ double rocsparse_real(const double& x) { return x; }
 __device__ __forceinline__ float rocsparse_real(const rocsparse_float_complex& x) { return std::real(x); }
 __device__ __forceinline__ double rocsparse_real(const rocsparse_double_complex& x) { return std::real(x); }
 
+// Conversion into the precision of T, e.g. for factors stored in lower precision
+template <typename T> __device__ __forceinline__ T rocsparse_convert(float x) { return static_cast<T>(x); }
+template <typename T> __device__ __forceinline__ T rocsparse_convert(double x) { return static_cast<T>(x); }
+template <typename T> __device__ __forceinline__ T rocsparse_convert(rocsparse_float_complex x) { return T(std::real(x), std::imag(x)); }
+template <typename T> __device__ __forceinline__ T rocsparse_convert(rocsparse_double_complex x) { return T(std::real(x), std::imag(x)); }
+template <typename T> __device__ __forceinline__ T rocsparse_convert(rocsparse_half x) { return static_cast<T>(__half2float(__ushort_as_half(x.data))); }
+template <typename T> __device__ __forceinline__ T rocsparse_convert(rocsparse_bfloat16 x) { return static_cast<T>(__uint_as_float(static_cast<uint32_t>(x.data) << 16)); }
+
+// Matrix values stored in 16 bit precision are accumulated in single precision
+__device__ __forceinline__ float rocsparse_fma(rocsparse_half p, float q, float r) { return fma(rocsparse_convert<float>(p), q, r); }
+__device__ __forceinline__ float rocsparse_fma(rocsparse_bfloat16 p, float q, float r) { return fma(rocsparse_convert<float>(p), q, r); }
+
 __device__ __forceinline__ float rocsparse_nontemporal_load(const float* ptr) { return __builtin_nontemporal_load(ptr); }
 __device__ __forceinline__ double rocsparse_nontemporal_load(const double* ptr) { return __builtin_nontemporal_load(ptr); }
 __device__ __forceinline__ rocsparse_float_complex rocsparse_nontemporal_load(const rocsparse_float_complex* ptr) { return rocsparse_float_complex(__builtin_nontemporal_load((const float*)ptr), __builtin_nontemporal_load((const float*)ptr + 1)); }
 __device__ __forceinline__ rocsparse_double_complex rocsparse_nontemporal_load(const rocsparse_double_complex* ptr) { return rocsparse_double_complex(__builtin_nontemporal_load((const double*)ptr), __builtin_nontemporal_load((const double*)ptr + 1)); }
-__device__ __forceinline__ rocsparse_int rocsparse_nontemporal_load(const rocsparse_int* ptr) { return __builtin_nontemporal_load(ptr); }
+__device__ __forceinline__ int32_t rocsparse_nontemporal_load(const int32_t* ptr) { return __builtin_nontemporal_load(ptr); }
+__device__ __forceinline__ int64_t rocsparse_nontemporal_load(const int64_t* ptr) { return __builtin_nontemporal_load(ptr); }
+__device__ __forceinline__ rocsparse_half rocsparse_nontemporal_load(const rocsparse_half* ptr) { return rocsparse_half{__builtin_nontemporal_load(&ptr->data)}; }
+__device__ __forceinline__ rocsparse_bfloat16 rocsparse_nontemporal_load(const rocsparse_bfloat16* ptr) { return rocsparse_bfloat16{__builtin_nontemporal_load(&ptr->data)}; }
 
 __device__ __forceinline__ void rocsparse_nontemporal_store(float val, float* ptr) { __builtin_nontemporal_store(val, ptr); }
 __device__ __forceinline__ void rocsparse_nontemporal_store(double val, double* ptr) { __builtin_nontemporal_store(val, ptr); }
 __device__ __forceinline__ void rocsparse_nontemporal_store(rocsparse_float_complex val, rocsparse_float_complex* ptr) { __builtin_nontemporal_store(std::real(val), (float*)ptr); __builtin_nontemporal_store(std::imag(val), (float*)ptr + 1); }
 __device__ __forceinline__ void rocsparse_nontemporal_store(rocsparse_double_complex val, rocsparse_double_complex* ptr) { __builtin_nontemporal_store(std::real(val), (double*)ptr); __builtin_nontemporal_store(std::imag(val), (double*)ptr + 1); }
-__device__ __forceinline__ void rocsparse_nontemporal_store(rocsparse_int val, rocsparse_int* ptr) { __builtin_nontemporal_store(val, ptr); }
+__device__ __forceinline__ void rocsparse_nontemporal_store(int32_t val, int32_t* ptr) { __builtin_nontemporal_store(val, ptr); }
+__device__ __forceinline__ void rocsparse_nontemporal_store(int64_t val, int64_t* ptr) { __builtin_nontemporal_store(val, ptr); }
 
 __device__ __forceinline__ float rocsparse_shfl(float var, int src_lane, int width = warpSize) { return __shfl(var, src_lane, width); }
 __device__ __forceinline__ double rocsparse_shfl(double var, int src_lane, int width = warpSize) { return __shfl(var, src_lane, width); }
@@ -82,7 +104,8 @@ __device__ __forceinline__ rocsparse_double_complex rocsparse_shfl(rocsparse_dou
 __device__ __forceinline__ int32_t rocsparse_mul24(int32_t x, int32_t y) { return ((x << 8) >> 8) * ((y << 8) >> 8); }
 __device__ __forceinline__ int64_t rocsparse_mul24(int64_t x, int64_t y) { return ((x << 40) >> 40) * ((y << 40) >> 40); }
 
-__device__ __forceinline__ rocsparse_int rocsparse_mad24(rocsparse_int x, rocsparse_int y, rocsparse_int z) { return rocsparse_mul24(x, y) + z; }
+__device__ __forceinline__ int32_t rocsparse_mad24(int32_t x, int32_t y, int32_t z) { return rocsparse_mul24(x, y) + z; }
+__device__ __forceinline__ int64_t rocsparse_mad24(int64_t x, int64_t y, int64_t z) { return rocsparse_mul24(x, y) + z; }
 
 __device__ __forceinline__ int64_t atomicMin(int64_t* ptr, int64_t val) { return atomicMin((unsigned long long*)ptr, val); }
 __device__ __forceinline__ int64_t atomicMax(int64_t* ptr, int64_t val) { return atomicMax((unsigned long long*)ptr, val); }
@@ -431,4 +454,30 @@ __device__ __forceinline__ rocsparse_double_complex rocsparse_wfreduce_sum(rocsp
 }
 // clang-format on
 
+// Position of the first entry in [begin, end) of a sorted column index array, that is
+// greater or equal to col
+__device__ __forceinline__ rocsparse_int
+    rocsparse_lower_bound(const rocsparse_int* __restrict__ col_ind,
+                          rocsparse_int        begin,
+                          rocsparse_int        end,
+                          rocsparse_int        col,
+                          rocsparse_index_base idx_base)
+{
+    while(begin < end)
+    {
+        rocsparse_int mid = begin + ((end - begin) >> 1);
+
+        if(col_ind[mid] - idx_base < col)
+        {
+            begin = mid + 1;
+        }
+        else
+        {
+            end = mid;
+        }
+    }
+
+    return begin;
+}
+
 #endif // COMMON_H
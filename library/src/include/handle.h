@@ -33,9 +33,52 @@
 #include <vector>
 
 /*! \brief typedefs to opaque info structs */
-typedef struct _rocsparse_trm_info*     rocsparse_trm_info;
-typedef struct _rocsparse_csrmv_info*   rocsparse_csrmv_info;
-typedef struct _rocsparse_csrgemm_info* rocsparse_csrgemm_info;
+typedef struct _rocsparse_trm_info*          rocsparse_trm_info;
+typedef struct _rocsparse_csrmv_info*        rocsparse_csrmv_info;
+typedef struct _rocsparse_bsrmv_info*        rocsparse_bsrmv_info;
+typedef struct _rocsparse_csrmv_format_info* rocsparse_csrmv_format_info;
+typedef struct _rocsparse_csrgemm_info*      rocsparse_csrgemm_info;
+typedef struct _rocsparse_csrrap_info*       rocsparse_csrrap_info;
+
+/********************************************************************************
+ * \brief rocsparse_device_state is a structure holding the state that is shared
+ * by all handles on the same device, i.e. device properties and device
+ * constants. It is created together with the first handle on a device and
+ * destroyed together with the last handle on that device.
+ *******************************************************************************/
+struct _rocsparse_device_state
+{
+    // device id
+    int device;
+    // device properties
+    hipDeviceProp_t properties;
+    // device wavefront size
+    int wavefront_size;
+    // asic revision
+    int asic_rev;
+    // size of the device buffer of each handle
+    size_t buffer_size;
+    // device one
+    float*  sone = nullptr;
+    double* done = nullptr;
+    // device complex one
+    rocsparse_float_complex*  cone = nullptr;
+    rocsparse_double_complex* zone = nullptr;
+    // number of handles referencing this state
+    int ref_count = 0;
+};
+
+/********************************************************************************
+ * \brief Obtain the shared state of the currently active device. The state is
+ * created, if no handle on this device exists yet. Throws on error.
+ *******************************************************************************/
+_rocsparse_device_state* rocsparse_acquire_device_state();
+
+/********************************************************************************
+ * \brief Release the shared state of a device. The state is destroyed, if no
+ * handle on this device remains.
+ *******************************************************************************/
+void rocsparse_release_device_state(_rocsparse_device_state* state);
 
 /********************************************************************************
  * \brief rocsparse_handle is a structure holding the rocsparse library context.
@@ -55,11 +98,16 @@ struct _rocsparse_handle
     rocsparse_status set_stream(hipStream_t user_stream);
     // get stream
     rocsparse_status get_stream(hipStream_t* user_stream) const;
+    // allocate device buffer, if not already available
+    rocsparse_status alloc_buffer();
+
+    // shared device state
+    _rocsparse_device_state* shared;
 
     // device id
     int device;
     // device properties
-    hipDeviceProp_t properties;
+    const hipDeviceProp_t& properties;
     // device wavefront size
     int wavefront_size;
     // asic revision
@@ -70,9 +118,9 @@ struct _rocsparse_handle
     rocsparse_pointer_mode pointer_mode = rocsparse_pointer_mode_host;
     // logging mode
     rocsparse_layer_mode layer_mode;
-    // device buffer
+    // device buffer, allocated on first use
     size_t buffer_size;
-    void*  buffer;
+    void*  buffer = nullptr;
     // device one
     float*  sone;
     double* done;
@@ -134,6 +182,9 @@ struct _rocsparse_hyb_mat
     rocsparse_int* coo_row_ind = nullptr;
     rocsparse_int* coo_col_ind = nullptr;
     void*          coo_val     = nullptr;
+
+    // size of a single ELL / COO value in bytes
+    size_t val_size = 0;
 };
 
 /********************************************************************************
@@ -150,21 +201,28 @@ struct _rocsparse_mat_info
     rocsparse_trm_info bsrsv_lower_info  = nullptr;
     rocsparse_trm_info bsrsvt_upper_info = nullptr;
     rocsparse_trm_info bsrsvt_lower_info = nullptr;
+    rocsparse_trm_info bsrsm_upper_info  = nullptr;
+    rocsparse_trm_info bsrsm_lower_info  = nullptr;
     rocsparse_trm_info bsric0_info       = nullptr;
     rocsparse_trm_info bsrilu0_info      = nullptr;
 
-    rocsparse_csrmv_info   csrmv_info        = nullptr;
-    rocsparse_trm_info     csric0_info       = nullptr;
-    rocsparse_trm_info     csrilu0_info      = nullptr;
-    rocsparse_trm_info     csrsv_upper_info  = nullptr;
-    rocsparse_trm_info     csrsv_lower_info  = nullptr;
-    rocsparse_trm_info     csrsvt_upper_info = nullptr;
-    rocsparse_trm_info     csrsvt_lower_info = nullptr;
-    rocsparse_trm_info     csrsm_upper_info  = nullptr;
-    rocsparse_trm_info     csrsm_lower_info  = nullptr;
-    rocsparse_trm_info     csrsmt_upper_info = nullptr;
-    rocsparse_trm_info     csrsmt_lower_info = nullptr;
-    rocsparse_csrgemm_info csrgemm_info      = nullptr;
+    rocsparse_csrmv_info        csrmv_info        = nullptr;
+    rocsparse_bsrmv_info        bsrmv_info        = nullptr;
+    rocsparse_csrmv_format_info csrmv_format_info = nullptr;
+    rocsparse_trm_info          csric0_info       = nullptr;
+    rocsparse_trm_info          csrilu0_info      = nullptr;
+    rocsparse_trm_info          csrsv_upper_info  = nullptr;
+    rocsparse_trm_info          csrsv_lower_info  = nullptr;
+    rocsparse_trm_info          csrsvt_upper_info = nullptr;
+    rocsparse_trm_info          csrsvt_lower_info = nullptr;
+    rocsparse_trm_info          csrsm_upper_info  = nullptr;
+    rocsparse_trm_info          csrsm_lower_info  = nullptr;
+    rocsparse_trm_info          csrsmt_upper_info = nullptr;
+    rocsparse_trm_info          csrsmt_lower_info = nullptr;
+    rocsparse_csrgemm_info      csrgemm_info      = nullptr;
+    rocsparse_csrrap_info       csrrap_info       = nullptr;
+    rocsparse_bsrmv_info        csrmm_info        = nullptr;
+    rocsparse_bsrmv_info        bsrmm_info        = nullptr;
 
     // zero pivot for csrsv, csrsm, csrilu0, csric0
     rocsparse_int* zero_pivot = nullptr;
@@ -178,19 +236,23 @@ struct _rocsparse_mat_info
  *******************************************************************************/
 struct _rocsparse_csrmv_info
 {
-    // num row blocks
-    size_t size = 0;
-    // row blocks
+    // upper bound for the num row blocks, including the entry marking the end of
+    // the final row block. The actual number is only stored on the device.
+    size_t max_size = 0;
+    // num chunks of rows the row blocks are computed for
+    size_t num_chunks = 0;
+    // row blocks, followed by the num entries and the offset of each chunk
     unsigned long long* row_blocks = nullptr;
 
-    // some data to verify correct execution
+    // some data to verify correct execution, the index arrays might either be of
+    // type rocsparse_int or hold 64-bit row offsets and 32-bit column indices
     rocsparse_operation         trans;
     rocsparse_int               m;
     rocsparse_int               n;
-    rocsparse_int               nnz;
+    int64_t                     nnz;
     const _rocsparse_mat_descr* descr;
-    const rocsparse_int*        csr_row_ptr;
-    const rocsparse_int*        csr_col_ind;
+    const void*                 csr_row_ptr;
+    const void*                 csr_col_ind;
 };
 
 /********************************************************************************
@@ -206,26 +268,162 @@ rocsparse_status rocsparse_create_csrmv_info(rocsparse_csrmv_info* info);
  *******************************************************************************/
 rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info);
 
+/********************************************************************************
+ * \brief rocsparse_csrmv_info_size returns the number of bytes of device memory
+ * held by the csrmv info structure.
+ *******************************************************************************/
+size_t rocsparse_csrmv_info_size(const rocsparse_csrmv_info info);
+
+/********************************************************************************
+ * \brief rocsparse_bsrmv_info is a structure holding the rocsparse bsrmv info
+ * data gathered during bsrmv_ex_analysis. It also holds the transpose that is
+ * gathered during csrmm_ex_analysis and bsrmm_ex_analysis, where a CSR matrix is
+ * treated as a BSR matrix with block dimension one. It must be initialized using
+ * the rocsparse_create_bsrmv_info() routine. It should be destroyed at the end
+ * rocsparse_destroy_bsrmv_info().
+ *******************************************************************************/
+struct _rocsparse_bsrmv_info
+{
+    // device arrays holding the block transpose, i.e. the BSC column pointers,
+    // the BSC row indices and the (conjugated) BSC blocks, in opposite storage
+    // direction
+    rocsparse_int* trans_col_ptr  = nullptr;
+    rocsparse_int* trans_row_ind  = nullptr;
+    void*          trans_val      = nullptr;
+    size_t         trans_val_size = 0;
+
+    // some data to verify correct execution
+    rocsparse_direction         dir;
+    rocsparse_operation         trans;
+    rocsparse_int               mb;
+    rocsparse_int               nb;
+    rocsparse_int               nnzb;
+    rocsparse_int               bsr_dim;
+    const _rocsparse_mat_descr* descr;
+    const void*                 bsr_val;
+    const rocsparse_int*        bsr_row_ptr;
+    const rocsparse_int*        bsr_col_ind;
+};
+
+/********************************************************************************
+ * \brief rocsparse_bsrmv_info is a structure holding the rocsparse bsrmv info
+ * data gathered during bsrmv_ex_analysis. It must be initialized using the
+ * rocsparse_create_bsrmv_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_bsrmv_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_bsrmv_info(rocsparse_bsrmv_info* info);
+
+/********************************************************************************
+ * \brief Destroy bsrmv info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_bsrmv_info(rocsparse_bsrmv_info info);
+
+/********************************************************************************
+ * \brief rocsparse_bsrmv_info_size returns the number of bytes of device memory
+ * held by the bsrmv info structure.
+ *******************************************************************************/
+size_t rocsparse_bsrmv_info_size(const rocsparse_bsrmv_info info);
+
+/********************************************************************************
+ * \brief rocsparse_csrmv_format_info is a structure holding the rocsparse
+ * csrmv_format info data gathered during csrmv_format_analysis. It must be
+ * initialized using the rocsparse_create_csrmv_format_info() routine. It should
+ * be destroyed at the end rocsparse_destroy_csrmv_format_info().
+ *******************************************************************************/
+struct _rocsparse_csrmv_format_info
+{
+    // selected storage format
+    rocsparse_spmv_format format = rocsparse_spmv_format_csr;
+
+    // predicted and measured cost of each storage format, relative to csr
+    float predicted_cost[rocsparse_spmv_format_bsr + 1];
+    float measured_cost[rocsparse_spmv_format_bsr + 1];
+
+    // size of a single value in bytes
+    size_t val_size = 0;
+
+    // ELL representation
+    rocsparse_int  ell_width   = 0;
+    rocsparse_int* ell_col_ind = nullptr;
+    void*          ell_val     = nullptr;
+
+    // HYB representation
+    rocsparse_hyb_mat hyb = nullptr;
+
+    // BSR representation, block dimension and direction of the best candidate
+    rocsparse_direction bsr_dir     = rocsparse_direction_row;
+    rocsparse_int       bsr_dim     = 0;
+    rocsparse_int       mb          = 0;
+    rocsparse_int       nb          = 0;
+    rocsparse_int       nnzb        = 0;
+    rocsparse_int*      bsr_row_ptr = nullptr;
+    rocsparse_int*      bsr_col_ind = nullptr;
+    void*               bsr_val     = nullptr;
+
+    // some data to verify correct execution
+    rocsparse_operation         trans;
+    rocsparse_int               m;
+    rocsparse_int               n;
+    rocsparse_int               nnz;
+    const _rocsparse_mat_descr* descr;
+    const void*                 csr_val;
+    const rocsparse_int*        csr_row_ptr;
+    const rocsparse_int*        csr_col_ind;
+};
+
+/********************************************************************************
+ * \brief rocsparse_csrmv_format_info is a structure holding the rocsparse
+ * csrmv_format info data gathered during csrmv_format_analysis. It must be
+ * initialized using the rocsparse_create_csrmv_format_info() routine. It should
+ * be destroyed at the end using rocsparse_destroy_csrmv_format_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csrmv_format_info(rocsparse_csrmv_format_info* info);
+
+/********************************************************************************
+ * \brief Destroy csrmv_format info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csrmv_format_info(rocsparse_csrmv_format_info info);
+
+/********************************************************************************
+ * \brief rocsparse_csrmv_format_info_clear releases the ELL, HYB and BSR
+ * representation held by the csrmv_format info structure.
+ *******************************************************************************/
+rocsparse_status rocsparse_csrmv_format_info_clear(rocsparse_csrmv_format_info info);
+
+/********************************************************************************
+ * \brief rocsparse_csrmv_format_info_size returns the number of bytes of device
+ * memory held by the csrmv_format info structure.
+ *******************************************************************************/
+size_t rocsparse_csrmv_format_info_size(const rocsparse_csrmv_format_info info);
+
 struct _rocsparse_trm_info
 {
-    // maximum non-zero entries per row
+    // maximum non-zero entries per row, only fetched to the host on demand
     rocsparse_int max_nnz = 0;
+    // device pointer to hold maximum non-zero entries per row
+    rocsparse_int* d_max_nnz = nullptr;
 
     // device array to hold row permutation
     rocsparse_int* row_map = nullptr;
-    // device array to hold pointer to diagonal entry
-    rocsparse_int* trm_diag_ind = nullptr;
-    // device pointers to hold transposed data
-    rocsparse_int* trmt_perm    = nullptr;
-    rocsparse_int* trmt_row_ptr = nullptr;
-    rocsparse_int* trmt_col_ind = nullptr;
+    // device array to hold pointer to diagonal entry, of the row offset type
+    void* trm_diag_ind = nullptr;
+    // device pointers to hold transposed data, perm and row_ptr are of the row offset
+    // type, col_ind is of the column index type
+    void* trmt_perm    = nullptr;
+    void* trmt_row_ptr = nullptr;
+    void* trmt_col_ind = nullptr;
+
+    // size in bytes of the row offset and column index types the analysis has been
+    // performed with
+    size_t offset_size = sizeof(rocsparse_int);
+    size_t index_size  = sizeof(rocsparse_int);
 
     // some data to verify correct execution
-    rocsparse_int               m;
-    rocsparse_int               nnz;
+    rocsparse_int               m   = 0;
+    int64_t                     nnz = 0;
     const _rocsparse_mat_descr* descr;
-    const rocsparse_int*        trm_row_ptr;
-    const rocsparse_int*        trm_col_ind;
+    const void*                 trm_row_ptr;
+    const void*                 trm_col_ind;
 };
 
 /********************************************************************************
@@ -242,6 +440,12 @@ rocsparse_status rocsparse_create_trm_info(rocsparse_trm_info* info);
  *******************************************************************************/
 rocsparse_status rocsparse_destroy_trm_info(rocsparse_trm_info info);
 
+/********************************************************************************
+ * \brief rocsparse_trm_info_size returns the number of bytes of device memory
+ * held by the trm info structure.
+ *******************************************************************************/
+size_t rocsparse_trm_info_size(const rocsparse_trm_info info);
+
 /********************************************************************************
  * \brief rocsparse_check_trm_shared checks if the given trm info structure
  * shares its meta data with another trm info structure.
@@ -260,6 +464,32 @@ struct _rocsparse_csrgemm_info
     bool mul = true;
     // Perform beta * D
     bool add = true;
+
+    // Operations on A and B
+    rocsparse_operation trans_A = rocsparse_operation_none;
+    rocsparse_operation trans_B = rocsparse_operation_none;
+
+    // Dimensions and number of non-zeros of op(A) and op(B)
+    rocsparse_int m     = 0;
+    rocsparse_int k     = 0;
+    int64_t       nnz_A = 0;
+    int64_t       nnz_B = 0;
+
+    // device arrays holding the structure of op(A) and op(B) for transposed operands,
+    // i.e. the CSC column pointers and row indices of A and B and the permutations that
+    // gather their values in CSC order. Column pointers and permutations are of the row
+    // offset type, row indices are of the column index type
+    void* trans_row_ptr_A = nullptr;
+    void* trans_col_ind_A = nullptr;
+    void* trans_perm_A    = nullptr;
+    void* trans_row_ptr_B = nullptr;
+    void* trans_col_ind_B = nullptr;
+    void* trans_perm_B    = nullptr;
+
+    // size in bytes of the row offset and column index types the structure of the
+    // transposed operands has been computed with
+    size_t offset_size = sizeof(rocsparse_int);
+    size_t index_size  = sizeof(rocsparse_int);
 };
 
 /********************************************************************************
@@ -275,6 +505,57 @@ rocsparse_status rocsparse_create_csrgemm_info(rocsparse_csrgemm_info* info);
  *******************************************************************************/
 rocsparse_status rocsparse_destroy_csrgemm_info(rocsparse_csrgemm_info info);
 
+/********************************************************************************
+ * \brief rocsparse_csrgemm_info_size returns the number of bytes of device memory
+ * held by the csrgemm info structure.
+ *******************************************************************************/
+size_t rocsparse_csrgemm_info_size(const rocsparse_csrgemm_info info);
+
+/********************************************************************************
+ * \brief rocsparse_csrrap_info is a structure holding the rocsparse csrrap info
+ * data gathered during csrrap_buffer_size and csrrap_nnz. It must be initialized
+ * using the rocsparse_create_csrrap_info() routine. It should be destroyed at the
+ * end using rocsparse_destroy_csrrap_info().
+ *******************************************************************************/
+struct _rocsparse_csrrap_info
+{
+    // device arrays holding the explicit transpose of the structure of R for
+    // transposed R, i.e. the CSC column pointers and row indices of R and the
+    // permutation that gathers the values of R in CSC order. They occupy
+    // m + 1 + 2 * nnz_R integers until the info is destroyed.
+    rocsparse_int* trans_row_ptr = nullptr;
+    rocsparse_int* trans_col_ind = nullptr;
+    rocsparse_int* trans_perm    = nullptr;
+
+    // some data to verify correct execution
+    rocsparse_operation  trans_R;
+    rocsparse_int        m;
+    rocsparse_int        n;
+    rocsparse_int        k;
+    rocsparse_int        nnz_R;
+    const rocsparse_int* csr_row_ptr_R;
+    const rocsparse_int* csr_col_ind_R;
+};
+
+/********************************************************************************
+ * \brief rocsparse_csrrap_info is a structure holding the rocsparse csrrap info
+ * data gathered during csrrap_buffer_size and csrrap_nnz. It must be initialized
+ * using the rocsparse_create_csrrap_info() routine. It should be destroyed at the
+ * end using rocsparse_destroy_csrrap_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csrrap_info(rocsparse_csrrap_info* info);
+
+/********************************************************************************
+ * \brief Destroy csrrap info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csrrap_info(rocsparse_csrrap_info info);
+
+/********************************************************************************
+ * \brief rocsparse_csrrap_info_size returns the number of bytes of device memory
+ * held by the csrrap info structure.
+ *******************************************************************************/
+size_t rocsparse_csrrap_info_size(const rocsparse_csrrap_info info);
+
 /********************************************************************************
  * \brief ELL format indexing
  *******************************************************************************/
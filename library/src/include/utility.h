@@ -33,6 +33,7 @@
 #include <exception>
 #include <fstream>
 #include <string>
+#include <utility>
 
 // Return the leftmost significant bit position
 #if defined(rocsparse_ILP64)
@@ -47,6 +48,53 @@ static inline rocsparse_int rocsparse_clz(rocsparse_int n)
 }
 #endif
 
+// Compile-time list of integral values, e.g. BSR block dimensions, that have a
+// dedicated kernel instantiation
+template <rocsparse_int... VALUES>
+using rocsparse_value_list = std::integer_sequence<rocsparse_int, VALUES...>;
+
+// Invoke f with std::integral_constant<rocsparse_int, V>, where V is the entry of the
+// compile-time list that matches value. Returns false if value is not in the list.
+template <typename F>
+static inline bool rocsparse_dispatch_value(rocsparse_int, rocsparse_value_list<>, F&&)
+{
+    return false;
+}
+
+template <rocsparse_int V, rocsparse_int... VALUES, typename F>
+static inline bool
+    rocsparse_dispatch_value(rocsparse_int value, rocsparse_value_list<V, VALUES...>, F&& f)
+{
+    if(value == V)
+    {
+        f(std::integral_constant<rocsparse_int, V>{});
+        return true;
+    }
+
+    return rocsparse_dispatch_value(value, rocsparse_value_list<VALUES...>{}, std::forward<F>(f));
+}
+
+// Number of bits per column delta of a CSRDC matrix
+using rocsparse_csrdc_delta_bits = rocsparse_value_list<8, 16>;
+
+// Storage type of the column deltas of a CSRDC matrix with BITS bits per delta. The
+// largest value of the type is reserved as escape, marking entries whose column is
+// stored explicitly in the exception array
+template <rocsparse_int BITS>
+struct rocsparse_csrdc_delta;
+
+template <>
+struct rocsparse_csrdc_delta<8>
+{
+    using type = uint8_t;
+};
+
+template <>
+struct rocsparse_csrdc_delta<16>
+{
+    using type = uint16_t;
+};
+
 // Return one on the device
 static inline void rocsparse_one(const rocsparse_handle handle, float** one)
 {
@@ -120,6 +168,14 @@ std::string replaceX(std::string input_string)
     {
         std::replace(input_string.begin(), input_string.end(), 'X', 'd');
     }
+    else if(std::is_same<T, rocsparse_half>::value)
+    {
+        std::replace(input_string.begin(), input_string.end(), 'X', 'h');
+    }
+    else if(std::is_same<T, rocsparse_bfloat16>::value)
+    {
+        std::replace(input_string.begin(), input_string.end(), 'X', 'b');
+    }
     /*
     else if(std::is_same<T, rocsparse_float_complex>::value)
     {
@@ -129,11 +185,42 @@ std::string replaceX(std::string input_string)
     {
         std::replace(input_string.begin(), input_string.end(), 'X', 'z');
     }
-    else if(std::is_same<T, rocsparse_half>::value)
+    */
+    return input_string;
+}
+
+// replaces X in string with the precision of T and Y with the precision of U,
+// Y is dropped if both precisions coincide (mixed precision routines)
+template <typename T, typename U>
+std::string replaceXY(std::string input_string)
+{
+    size_t pos = input_string.find('Y');
+
+    if(pos != std::string::npos)
     {
-        std::replace(input_string.begin(), input_string.end(), 'X', 'h');
+        if(std::is_same<T, U>::value)
+        {
+            input_string.erase(pos, 1);
+        }
+        else
+        {
+            input_string.replace(pos, 1, replaceX<U>("X"));
+        }
     }
-    */
+
+    return replaceX<T>(input_string);
+}
+
+// appends _i64 to routines that operate on CSR matrices with 64-bit row offsets I
+// and 32-bit column indices J
+template <typename I, typename J>
+std::string appendIJ(std::string input_string)
+{
+    if(!std::is_same<I, J>::value)
+    {
+        input_string += "_i64";
+    }
+
     return input_string;
 }
 
@@ -27,14 +27,11 @@
 
 #include <hip/hip_runtime.h>
 
-template <typename T, unsigned int BLOCKSIZE>
-__launch_bounds__(BLOCKSIZE) __global__ void gthr_kernel(rocsparse_int        nnz,
-                                                         const T*             y,
-                                                         T*                   x_val,
-                                                         const rocsparse_int* x_ind,
-                                                         rocsparse_index_base idx_base)
+template <typename I, typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void gthr_kernel(
+    I nnz, const T* y, T* x_val, const I* x_ind, rocsparse_index_base idx_base)
 {
-    rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    I idx = static_cast<I>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
 
     if(idx >= nnz)
     {
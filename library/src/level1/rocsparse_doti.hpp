@@ -115,6 +115,7 @@ rocsparse_status rocsparse_doti_template(rocsparse_handle     handle,
 
 #define DOTI_DIM 256
     // Get workspace from handle device buffer
+    RETURN_IF_ROCSPARSE_ERROR(handle->alloc_buffer());
     T* workspace = reinterpret_cast<T*>(handle->buffer);
 
     hipLaunchKernelGGL((doti_kernel_part1<T, DOTI_DIM>),
@@ -32,12 +32,12 @@
 
 #include <hip/hip_runtime.h>
 
-template <typename T>
+template <typename I, typename T>
 rocsparse_status rocsparse_gthr_template(rocsparse_handle     handle,
-                                         rocsparse_int        nnz,
+                                         I                    nnz,
                                          const T*             y,
                                          T*                   x_val,
-                                         const rocsparse_int* x_ind,
+                                         const I*             x_ind,
                                          rocsparse_index_base idx_base)
 {
     // Check for valid handle
@@ -96,7 +96,7 @@ rocsparse_status rocsparse_gthr_template(rocsparse_handle     handle,
     dim3 gthr_blocks((nnz - 1) / GTHR_DIM + 1);
     dim3 gthr_threads(GTHR_DIM);
 
-    hipLaunchKernelGGL((gthr_kernel<T, GTHR_DIM>),
+    hipLaunchKernelGGL((gthr_kernel<I, T, GTHR_DIM>),
                        gthr_blocks,
                        gthr_threads,
                        0,
@@ -30,89 +30,14 @@
 
 #include <hip/hip_runtime.h>
 
-// General BSRMV that works for any BSR block dimensions
-template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE>
-__device__ void bsrmvn_general_device(rocsparse_direction dir,
-                                      T                   alpha,
-                                      const rocsparse_int* __restrict__ bsr_row_ptr,
-                                      const rocsparse_int* __restrict__ bsr_col_ind,
-                                      const T* __restrict__ bsr_val,
-                                      rocsparse_int bsr_dim,
-                                      const T* __restrict__ x,
-                                      T beta,
-                                      T* __restrict__ y,
-                                      rocsparse_index_base idx_base)
-{
-    // Lane id
-    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
-
-    // Wavefront id
-    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
-
-    // Each thread block processes a BSR row
-    rocsparse_int row = hipBlockIdx_x;
-
-    // BSR row entry and exit point
-    rocsparse_int row_begin = bsr_row_ptr[row] - idx_base;
-    rocsparse_int row_end   = bsr_row_ptr[row + 1] - idx_base;
-
-    // Each wavefront processes a row of the BSR block.
-    // If the number of BSR block rows exceed the number of wavefronts, each wavefront
-    // processes multiple rows. 'bi' is the row index into the BSR block and 'bj' is
-    // the column index.
-    // BLOCKSIZE must be the square of WFSIZE.
-
-    // Loop over the rows of the BSR block in chunks of WFSIZE, such that each
-    // wavefront will process a row
-    for(rocsparse_int bi = wid; bi < bsr_dim; bi += WFSIZE)
-    {
-        // BSR block row accumulator
-        T sum = static_cast<T>(0);
-
-        // Loop over all BSR blocks in the current row
-        for(rocsparse_int j = row_begin; j < row_end; ++j)
-        {
-            // BSR column index
-            rocsparse_int col = bsr_col_ind[j] - idx_base;
-
-            // Loop over the columns of the BSR block in chunks of WFSIZE, such that
-            // each lane will process a single value of the BSR block
-            for(rocsparse_int bj = lid; bj < bsr_dim; bj += WFSIZE)
-            {
-                // Each lane computes the sum of a specific entry over all BSR blocks in
-                // the current row
-                sum = rocsparse_fma(bsr_val[BSR_IND(j, bi, bj, dir)],
-                                    x[bsr_dim * col + bj],
-                                    sum);
-            }
-        }
-
-        // Each wavefront accumulates its BSR block row sum
-        sum = rocsparse_wfreduce_sum<WFSIZE>(sum);
-
-        // Last lane of each wavefront writes its result to global memory
-        if(lid == WFSIZE - 1)
-        {
-            if(beta != static_cast<T>(0))
-            {
-                y[row * bsr_dim + bi] = rocsparse_fma(beta, y[row * bsr_dim + bi], alpha * sum);
-            }
-            else
-            {
-                y[row * bsr_dim + bi] = alpha * sum;
-            }
-        }
-    }
-}
-
 // BSRMV kernel for BSR block dimension of 2
-template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WFSIZE>
 __device__ void bsrmvn_2x2_device(rocsparse_int       mb,
                                   rocsparse_direction dir,
                                   T                   alpha,
                                   const rocsparse_int* __restrict__ bsr_row_ptr,
                                   const rocsparse_int* __restrict__ bsr_col_ind,
-                                  const T* __restrict__ bsr_val,
+                                  const U* __restrict__ bsr_val,
                                   const T* __restrict__ x,
                                   T beta,
                                   T* __restrict__ y,
@@ -196,13 +121,13 @@ __device__ void bsrmvn_2x2_device(rocsparse_int       mb,
 }
 
 // BSRMV kernel for BSR block dimension of 3
-template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WFSIZE>
 __device__ void bsrmvn_3x3_device(rocsparse_int       mb,
                                   rocsparse_direction dir,
                                   T                   alpha,
                                   const rocsparse_int* __restrict__ bsr_row_ptr,
                                   const rocsparse_int* __restrict__ bsr_col_ind,
-                                  const T* __restrict__ bsr_val,
+                                  const U* __restrict__ bsr_val,
                                   const T* __restrict__ x,
                                   T beta,
                                   T* __restrict__ y,
@@ -295,13 +220,13 @@ __device__ void bsrmvn_3x3_device(rocsparse_int       mb,
 }
 
 // BSRMV kernel for BSR block dimension of 4
-template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WFSIZE>
 __device__ void bsrmvn_4x4_device(rocsparse_int       mb,
                                   rocsparse_direction dir,
                                   T                   alpha,
                                   const rocsparse_int* __restrict__ bsr_row_ptr,
                                   const rocsparse_int* __restrict__ bsr_col_ind,
-                                  const T* __restrict__ bsr_val,
+                                  const U* __restrict__ bsr_val,
                                   const T* __restrict__ x,
                                   T beta,
                                   T* __restrict__ y,
@@ -421,13 +346,13 @@ __device__ void bsrmvn_4x4_device(rocsparse_int       mb,
 }
 
 // BSRMV kernel for BSR block dimension of 5
-template <typename T, unsigned int BLOCKSIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE>
 __device__ void bsrmvn_5x5_device(rocsparse_int       mb,
                                   rocsparse_direction dir,
                                   T                   alpha,
                                   const rocsparse_int* __restrict__ bsr_row_ptr,
                                   const rocsparse_int* __restrict__ bsr_col_ind,
-                                  const T* __restrict__ bsr_val,
+                                  const U* __restrict__ bsr_val,
                                   const T* __restrict__ x,
                                   T beta,
                                   T* __restrict__ y,
@@ -531,13 +456,13 @@ __device__ void bsrmvn_5x5_device(rocsparse_int       mb,
 }
 
 // BSRMV kernel for BSR block dimension of 8
-template <typename T, unsigned int BLOCKSIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE>
 __device__ void bsrmvn_8x8_device(rocsparse_int       mb,
                                   rocsparse_direction dir,
                                   T                   alpha,
                                   const rocsparse_int* __restrict__ bsr_row_ptr,
                                   const rocsparse_int* __restrict__ bsr_col_ind,
-                                  const T* __restrict__ bsr_val,
+                                  const U* __restrict__ bsr_val,
                                   const T* __restrict__ x,
                                   T beta,
                                   T* __restrict__ y,
@@ -641,13 +566,13 @@ __device__ void bsrmvn_8x8_device(rocsparse_int       mb,
 }
 
 // BSRMV kernel for BSR block dimension of 16
-template <typename T, unsigned int BLOCKSIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE>
 __device__ void bsrmvn_16x16_device(rocsparse_int       mb,
                                     rocsparse_direction dir,
                                     T                   alpha,
                                     const rocsparse_int* __restrict__ bsr_row_ptr,
                                     const rocsparse_int* __restrict__ bsr_col_ind,
-                                    const T* __restrict__ bsr_val,
+                                    const U* __restrict__ bsr_val,
                                     const T* __restrict__ x,
                                     T beta,
                                     T* __restrict__ y,
@@ -746,13 +671,13 @@ __device__ void bsrmvn_16x16_device(rocsparse_int       mb,
 }
 
 // BSRMV kernel for BSR block dimension of 17 to 32
-template <typename T, unsigned int BSRDIM>
+template <typename T, typename U, unsigned int BSRDIM>
 __device__ void bsrmvn_17_32_device(rocsparse_int       mb,
                                     rocsparse_direction dir,
                                     T                   alpha,
                                     const rocsparse_int* __restrict__ bsr_row_ptr,
                                     const rocsparse_int* __restrict__ bsr_col_ind,
-                                    const T* __restrict__ bsr_val,
+                                    const U* __restrict__ bsr_val,
                                     const T* __restrict__ x,
                                     T beta,
                                     T* __restrict__ y,
@@ -853,4 +778,440 @@ __device__ void bsrmvn_17_32_device(rocsparse_int       mb,
     }
 }
 
+// Largest power of two that is smaller than n
+static constexpr unsigned int bsrmvn_reduction_size(unsigned int n)
+{
+    return (n <= 2) ? 1 : 2 * bsrmvn_reduction_size((n + 1) / 2);
+}
+
+// BSRMV kernel for BSR block dimensions up to 32 without a hand-tuned kernel, where each
+// thread processes a single entry of a BSR block. BLOCKSIZE must be a multiple of
+// BSRDIM * BSRDIM.
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int BSRDIM>
+__device__ void bsrmvn_NxN_device(rocsparse_int       mb,
+                                  rocsparse_direction dir,
+                                  T                   alpha,
+                                  const rocsparse_int* __restrict__ bsr_row_ptr,
+                                  const rocsparse_int* __restrict__ bsr_col_ind,
+                                  const U* __restrict__ bsr_val,
+                                  const T* __restrict__ x,
+                                  T beta,
+                                  T* __restrict__ y,
+                                  rocsparse_index_base idx_base)
+{
+    // Number of BSR blocks processed at the same time
+    static constexpr unsigned int NBLOCKS = BLOCKSIZE / (BSRDIM * BSRDIM);
+
+    // Initial stride of the intra block reduction
+    static constexpr unsigned int POW2 = bsrmvn_reduction_size(BSRDIM);
+
+    // BSR block lane id
+    rocsparse_int lid = hipThreadIdx_x % BSRDIM;
+
+    // Each thread block processes a single BSR row
+    rocsparse_int row = hipBlockIdx_x;
+
+    // Offset into x vector
+    rocsparse_int idx
+        = (dir == rocsparse_direction_column) ? ((hipThreadIdx_x / BSRDIM) % BSRDIM) : lid;
+
+    // BSR row entry and exit point
+    rocsparse_int row_begin = bsr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = bsr_row_ptr[row + 1] - idx_base;
+
+    // BSR block row accumulator
+    T sum = static_cast<T>(0);
+
+    // Loop over all BSR blocks in the current row where each lane
+    // processes a BSR block value
+    for(rocsparse_int j = row_begin; j < row_end; j += NBLOCKS)
+    {
+        rocsparse_int k = j + hipThreadIdx_x / (BSRDIM * BSRDIM);
+
+        // Do not exceed the row
+        if(k < row_end)
+        {
+            // Column index into x vector
+            rocsparse_int col = (bsr_col_ind[k] - idx_base) * BSRDIM;
+
+            // Compute the sum of the two rows within the BSR blocks of the current
+            // BSR row
+            sum = rocsparse_fma(bsr_val[j * BSRDIM * BSRDIM + hipThreadIdx_x], x[col + idx], sum);
+        }
+    }
+
+    // Accumulate each row sum of the BSR block
+    __shared__ T sdata[BLOCKSIZE];
+
+    sdata[hipThreadIdx_x] = sum;
+
+    __syncthreads();
+
+    // Accumulate the row sum for different blocks
+    if(NBLOCKS > 1)
+    {
+        if(hipThreadIdx_x < BSRDIM * BSRDIM)
+        {
+            for(unsigned int i = 1; i < NBLOCKS; ++i)
+            {
+                sdata[hipThreadIdx_x] += sdata[hipThreadIdx_x + i * BSRDIM * BSRDIM];
+            }
+        }
+
+        __syncthreads();
+    }
+
+    if(dir == rocsparse_direction_column)
+    {
+        if(hipThreadIdx_x < (BSRDIM - POW2) * BSRDIM)
+            sdata[hipThreadIdx_x] += sdata[hipThreadIdx_x + BSRDIM * POW2];
+        __syncthreads();
+
+#pragma unroll
+        for(unsigned int i = POW2 >> 1; i > 0; i >>= 1)
+        {
+            if(hipThreadIdx_x < BSRDIM * i)
+                sdata[hipThreadIdx_x] += sdata[hipThreadIdx_x + BSRDIM * i];
+            __syncthreads();
+        }
+
+        // Final reduction
+        if(hipThreadIdx_x < BSRDIM)
+            sum = sdata[hipThreadIdx_x];
+    }
+    else
+    {
+        // Reduce the intra block row sum
+        if(hipThreadIdx_x < BSRDIM * BSRDIM && lid < BSRDIM - POW2)
+            sdata[hipThreadIdx_x] += sdata[hipThreadIdx_x + POW2];
+        __syncthreads();
+
+#pragma unroll
+        for(unsigned int i = POW2 >> 1; i > 0; i >>= 1)
+        {
+            if(hipThreadIdx_x < BSRDIM * BSRDIM && lid < i)
+                sdata[hipThreadIdx_x] += sdata[hipThreadIdx_x + i];
+            __syncthreads();
+        }
+
+        // Final reduction
+        if(hipThreadIdx_x < BSRDIM)
+            sum = sdata[hipThreadIdx_x * BSRDIM];
+    }
+
+    // First bunch of threads write row sums to global memory
+    if(hipThreadIdx_x < BSRDIM)
+    {
+        if(beta != static_cast<T>(0))
+        {
+            y[row * BSRDIM + hipThreadIdx_x]
+                = rocsparse_fma(beta, y[row * BSRDIM + hipThreadIdx_x], alpha * sum);
+        }
+        else
+        {
+            y[row * BSRDIM + hipThreadIdx_x] = alpha * sum;
+        }
+    }
+}
+
+// BSRMV kernel for large BSR block dimensions. Each thread keeps TILE row sums of the
+// BSR block in registers, such that each x entry is loaded once per TILE rows.
+// For row major blocks, each wavefront processes TILE rows and its lanes stride over
+// the columns. For column major blocks, each lane processes TILE rows and the wavefronts
+// stride over the columns.
+template <typename T,
+          typename            U,
+          unsigned int        BLOCKSIZE,
+          unsigned int        WFSIZE,
+          unsigned int        TILE,
+          rocsparse_direction DIR>
+__device__ void bsrmvn_tiled_device(T alpha,
+                                    const rocsparse_int* __restrict__ bsr_row_ptr,
+                                    const rocsparse_int* __restrict__ bsr_col_ind,
+                                    const U* __restrict__ bsr_val,
+                                    rocsparse_int bsr_dim,
+                                    const T* __restrict__ x,
+                                    T beta,
+                                    T* __restrict__ y,
+                                    rocsparse_index_base idx_base)
+{
+    // Number of wavefronts per thread block
+    static constexpr unsigned int NWF = BLOCKSIZE / WFSIZE;
+
+    // Lane id
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+
+    // Wavefront id
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each thread block processes a BSR row
+    rocsparse_int row = hipBlockIdx_x;
+
+    // BSR row entry and exit point
+    rocsparse_int row_begin = bsr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = bsr_row_ptr[row + 1] - idx_base;
+
+    if(DIR == rocsparse_direction_row)
+    {
+        // Loop over the rows of the BSR block in chunks of TILE rows per wavefront
+        for(rocsparse_int bi = wid * TILE; bi < bsr_dim; bi += NWF * TILE)
+        {
+            // Register tile of BSR block row accumulators
+            T sum[TILE];
+
+#pragma unroll
+            for(unsigned int t = 0; t < TILE; ++t)
+            {
+                sum[t] = static_cast<T>(0);
+            }
+
+            // Loop over all BSR blocks in the current row
+            for(rocsparse_int j = row_begin; j < row_end; ++j)
+            {
+                // BSR column index
+                rocsparse_int col = bsr_col_ind[j] - idx_base;
+
+                // Loop over the columns of the BSR block in chunks of WFSIZE
+                for(rocsparse_int bj = lid; bj < bsr_dim; bj += WFSIZE)
+                {
+                    T xj = x[bsr_dim * col + bj];
+
+#pragma unroll
+                    for(unsigned int t = 0; t < TILE; ++t)
+                    {
+                        if(bi + t < bsr_dim)
+                        {
+                            sum[t] = rocsparse_fma(
+                                bsr_val[BSR_IND(j, bi + t, bj, DIR)], xj, sum[t]);
+                        }
+                    }
+                }
+            }
+
+#pragma unroll
+            for(unsigned int t = 0; t < TILE; ++t)
+            {
+                // Each wavefront accumulates its BSR block row sums
+                sum[t] = rocsparse_wfreduce_sum<WFSIZE>(sum[t]);
+
+                // Last lane of each wavefront writes its result to global memory
+                if(lid == WFSIZE - 1 && bi + t < bsr_dim)
+                {
+                    if(beta != static_cast<T>(0))
+                    {
+                        y[row * bsr_dim + bi + t]
+                            = rocsparse_fma(beta, y[row * bsr_dim + bi + t], alpha * sum[t]);
+                    }
+                    else
+                    {
+                        y[row * bsr_dim + bi + t] = alpha * sum[t];
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        __shared__ T sdata[BLOCKSIZE];
+
+        // Loop over the rows of the BSR block in chunks of TILE rows per lane
+        for(rocsparse_int chunk = 0; chunk < bsr_dim; chunk += WFSIZE * TILE)
+        {
+            // Register tile of BSR block row accumulators
+            T sum[TILE];
+
+#pragma unroll
+            for(unsigned int t = 0; t < TILE; ++t)
+            {
+                sum[t] = static_cast<T>(0);
+            }
+
+            // Loop over all BSR blocks in the current row
+            for(rocsparse_int j = row_begin; j < row_end; ++j)
+            {
+                // BSR column index
+                rocsparse_int col = bsr_col_ind[j] - idx_base;
+
+                // Loop over the columns of the BSR block in chunks of NWF
+                for(rocsparse_int bj = wid; bj < bsr_dim; bj += NWF)
+                {
+                    T xj = x[bsr_dim * col + bj];
+
+#pragma unroll
+                    for(unsigned int t = 0; t < TILE; ++t)
+                    {
+                        rocsparse_int bi = chunk + t * WFSIZE + lid;
+
+                        if(bi < bsr_dim)
+                        {
+                            sum[t] = rocsparse_fma(bsr_val[BSR_IND(j, bi, bj, DIR)], xj, sum[t]);
+                        }
+                    }
+                }
+            }
+
+#pragma unroll
+            for(unsigned int t = 0; t < TILE; ++t)
+            {
+                // Accumulate the partial row sums of all wavefronts
+                sdata[hipThreadIdx_x] = sum[t];
+
+                __syncthreads();
+
+#pragma unroll
+                for(unsigned int i = NWF >> 1; i > 0; i >>= 1)
+                {
+                    if(wid < i)
+                    {
+                        sdata[hipThreadIdx_x] += sdata[hipThreadIdx_x + WFSIZE * i];
+                    }
+
+                    __syncthreads();
+                }
+
+                rocsparse_int bi = chunk + t * WFSIZE + lid;
+
+                // First wavefront writes its result to global memory
+                if(wid == 0 && bi < bsr_dim)
+                {
+                    if(beta != static_cast<T>(0))
+                    {
+                        y[row * bsr_dim + bi]
+                            = rocsparse_fma(beta, y[row * bsr_dim + bi], alpha * sdata[lid]);
+                    }
+                    else
+                    {
+                        y[row * bsr_dim + bi] = alpha * sdata[lid];
+                    }
+                }
+            }
+        }
+    }
+}
+
+// BSRMV kernel for transposed, symmetric and hermitian BSR matrices. Each segment of
+// WF_SEGMENT_SIZE lanes processes a BSR row, where each lane multiplies a row and / or a
+// column of a BSR block with x and atomically accumulates the result into y, which has
+// been scaled by beta beforehand. For symmetric and hermitian matrices, blocks outside
+// of the stored block triangle are ignored and off-diagonal blocks are applied twice,
+// as stored and mirrored. Diagonal blocks are stored in full.
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WF_SEGMENT_SIZE>
+__device__ void bsrmv_atomic_device(rocsparse_int         mb,
+                                    rocsparse_direction   dir,
+                                    rocsparse_operation   trans,
+                                    rocsparse_matrix_type type,
+                                    rocsparse_fill_mode   fill_mode,
+                                    T                     alpha,
+                                    const rocsparse_int* __restrict__ bsr_row_ptr,
+                                    const rocsparse_int* __restrict__ bsr_col_ind,
+                                    const U* __restrict__ bsr_val,
+                                    rocsparse_int bsr_dim,
+                                    const T* __restrict__ x,
+                                    T* __restrict__ y,
+                                    rocsparse_index_base idx_base)
+{
+    // Lane id
+    rocsparse_int lid = hipThreadIdx_x & (WF_SEGMENT_SIZE - 1);
+
+    // Each segment processes a BSR row
+    rocsparse_int row = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / WF_SEGMENT_SIZE;
+
+    if(row >= mb)
+    {
+        return;
+    }
+
+    bool general = (type == rocsparse_matrix_type_general);
+
+    // Conjugation of the stored and the mirrored blocks
+    bool conj_stored = (type == rocsparse_matrix_type_symmetric
+                        && trans == rocsparse_operation_conjugate_transpose)
+                       || (type == rocsparse_matrix_type_hermitian
+                           && trans == rocsparse_operation_transpose);
+    bool conj_mirror = general ? (trans == rocsparse_operation_conjugate_transpose)
+                               : (conj_stored != (type == rocsparse_matrix_type_hermitian));
+
+    // BSR row entry and exit point
+    rocsparse_int row_begin = bsr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = bsr_row_ptr[row + 1] - idx_base;
+
+    // Each lane processes a row / column index of a BSR block
+    rocsparse_int size = (row_end - row_begin) * bsr_dim;
+
+    for(rocsparse_int idx = lid; idx < size; idx += WF_SEGMENT_SIZE)
+    {
+        rocsparse_int j   = row_begin + idx / bsr_dim;
+        rocsparse_int bi  = idx % bsr_dim;
+        rocsparse_int col = bsr_col_ind[j] - idx_base;
+
+        // Skip blocks outside of the stored triangle
+        if(!general
+           && ((fill_mode == rocsparse_fill_mode_lower && col > row)
+               || (fill_mode == rocsparse_fill_mode_upper && col < row)))
+        {
+            continue;
+        }
+
+        // Row bi of the stored block
+        if(!general)
+        {
+            T sum = static_cast<T>(0);
+
+            for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
+            {
+                T val = rocsparse_convert<T>(bsr_val[BSR_IND(j, bi, bj, dir)]);
+
+                sum = rocsparse_fma(conj_stored ? rocsparse_conj(val) : val,
+                                    x[bsr_dim * col + bj],
+                                    sum);
+            }
+
+            atomicAdd(&y[bsr_dim * row + bi], alpha * sum);
+        }
+
+        // Column bi of the stored block, i.e. row bi of the mirrored block
+        if(general || col != row)
+        {
+            T sum = static_cast<T>(0);
+
+            for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
+            {
+                T val = rocsparse_convert<T>(bsr_val[BSR_IND(j, bj, bi, dir)]);
+
+                sum = rocsparse_fma(conj_mirror ? rocsparse_conj(val) : val,
+                                    x[bsr_dim * row + bj],
+                                    sum);
+            }
+
+            atomicAdd(&y[bsr_dim * col + bi], alpha * sum);
+        }
+    }
+}
+
+// Gather the BSR blocks in block transpose order. Interpreted in the opposite block
+// storage direction, the gathered blocks form the values of the transposed BSR matrix.
+template <typename T, unsigned int BLOCKSIZE, bool CONJ>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrmv_transpose_gather_kernel(rocsparse_int nnzb,
+                                       rocsparse_int bsr_dim,
+                                       const rocsparse_int* __restrict__ perm,
+                                       const T* __restrict__ bsr_val,
+                                       T* __restrict__ bsrt_val)
+{
+    rocsparse_int gid        = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    rocsparse_int block_size = bsr_dim * bsr_dim;
+
+    if(gid >= nnzb * block_size)
+    {
+        return;
+    }
+
+    rocsparse_int j = gid / block_size;
+    rocsparse_int k = gid % block_size;
+
+    T val = bsr_val[block_size * perm[j] + k];
+
+    bsrt_val[gid] = CONJ ? rocsparse_conj(val) : val;
+}
+
 #endif // BSRMV_DEVICE_H
@@ -46,13 +46,13 @@ __device__ void coomv_scale_device(rocsparse_int size, T beta, T* __restrict__ d
 // Implementation motivated by papers 'Efficient Sparse Matrix-Vector Multiplication on CUDA',
 // 'Implementing Sparse Matrix-Vector Multiplication on Throughput-Oriented Processors' and
 // 'Segmented operations for sparse matrix computation on vector multiprocessors'
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
 static __device__ void coomvn_general_wf_reduce(rocsparse_int        nnz,
                                                 rocsparse_int        loops,
                                                 T                    alpha,
                                                 const rocsparse_int* coo_row_ind,
                                                 const rocsparse_int* coo_col_ind,
-                                                const T*             coo_val,
+                                                const U*             coo_val,
                                                 const T*             x,
                                                 T*                   y,
                                                 rocsparse_int*       row_block_red,
@@ -108,7 +108,7 @@ static __device__ void coomvn_general_wf_reduce(rocsparse_int        nnz,
         if(idx < nnz)
         {
             row = rocsparse_nontemporal_load(coo_row_ind + idx) - idx_base;
-            val = alpha * rocsparse_nontemporal_load(coo_val + idx)
+            val = alpha * rocsparse_convert<T>(rocsparse_nontemporal_load(coo_val + idx))
                   * rocsparse_ldg(x + rocsparse_nontemporal_load(coo_col_ind + idx) - idx_base);
         }
         else
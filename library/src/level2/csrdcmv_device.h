@@ -0,0 +1,144 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef CSRDCMV_DEVICE_H
+#define CSRDCMV_DEVICE_H
+
+#include "common.h"
+#include "rocsparse.h"
+
+#include <hip/hip_runtime.h>
+
+// CSRDCMV kernel where each sub-wavefront of WFSIZE lanes processes a row. The row is
+// processed in chunks of WFSIZE consecutive entries. The lanes of a chunk decode their
+// column indices by a segmented inclusive scan over the deltas, where an escaped delta
+// starts a new segment at the column read from the exceptions. The position of an
+// exception is given by the number of escapes of the preceding lanes.
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WFSIZE>
+__device__ void csrdcmvn_device(rocsparse_int m,
+                                T             alpha,
+                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                const rocsparse_int* __restrict__ csrdc_col_base,
+                                const U* __restrict__ csrdc_delta,
+                                const rocsparse_int* __restrict__ csrdc_exc_ptr,
+                                const rocsparse_int* __restrict__ csrdc_exc_col,
+                                const T* __restrict__ csr_val,
+                                const T* __restrict__ x,
+                                T beta,
+                                T* __restrict__ y,
+                                rocsparse_index_base idx_base)
+{
+    static constexpr U escape = static_cast<U>(-1);
+
+    // Lanes of the sub-wavefront within the ballot mask
+    static constexpr unsigned long long lanemask = UINT64_MAX >> (64 - WFSIZE);
+
+    // Lane id
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+
+    // Sub-wavefront id
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each thread block processes (BLOCKSIZE / WFSIZE) rows
+    rocsparse_int row = hipBlockIdx_x * (BLOCKSIZE / WFSIZE) + wid;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Position of the sub-wavefront within the hardware wavefront
+    unsigned int shift = __lane_id() - lid;
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Column of the last entry of the previous chunk and next exception of the row
+    rocsparse_int carry = csrdc_col_base[row] - idx_base;
+    rocsparse_int exc   = csrdc_exc_ptr[row] - idx_base;
+
+    T sum = static_cast<T>(0);
+
+    for(rocsparse_int j = row_begin + lid; j - lid < row_end; j += WFSIZE)
+    {
+        bool          active = j < row_end;
+        rocsparse_int col    = active ? csrdc_delta[j] : 0;
+        bool          reset  = active && col == escape;
+
+        // Escapes of the sub-wavefront
+        unsigned long long mask = (__ballot(reset) >> shift) & lanemask;
+
+        if(reset)
+        {
+            col = csrdc_exc_col[exc + __popcll(mask & ((1ULL << lid) - 1))] - idx_base;
+        }
+
+        exc += __popcll(mask);
+
+        // Segmented inclusive scan of the deltas
+        for(unsigned int i = 1; i < WFSIZE; i <<= 1)
+        {
+            rocsparse_int prev_col   = __shfl_up(col, i, WFSIZE);
+            int           prev_reset = __shfl_up(static_cast<int>(reset), i, WFSIZE);
+
+            if(lid >= i && !reset)
+            {
+                col += prev_col;
+                reset = prev_reset;
+            }
+        }
+
+        if(!reset)
+        {
+            col += carry;
+        }
+
+        carry = __shfl(col, WFSIZE - 1, WFSIZE);
+
+        if(active)
+        {
+            sum = rocsparse_fma(csr_val[j], x[col], sum);
+        }
+    }
+
+    // Each sub-wavefront accumulates its row sum
+    sum = rocsparse_wfreduce_sum<WFSIZE>(sum);
+
+    // Last lane of each sub-wavefront writes the row sum to global memory
+    if(lid == WFSIZE - 1)
+    {
+        if(beta != static_cast<T>(0))
+        {
+            y[row] = rocsparse_fma(beta, y[row], alpha * sum);
+        }
+        else
+        {
+            y[row] = alpha * sum;
+        }
+    }
+}
+
+#endif // CSRDCMV_DEVICE_H
@@ -29,25 +29,98 @@
 
 #include <hip/hip_runtime.h>
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
-static __device__ void csrmvn_general_device(rocsparse_int        m,
+template <typename I,
+          typename     J,
+          typename     T,
+          typename     U,
+          unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE>
+static __device__ void csrmvn_general_device(J                    m,
                                              T                    alpha,
-                                             const rocsparse_int* row_offset,
-                                             const rocsparse_int* csr_col_ind,
-                                             const T*             csr_val,
+                                             const I*             row_offset,
+                                             const J*             csr_col_ind,
+                                             const U*             csr_val,
                                              const T*             x,
                                              T                    beta,
                                              T*                   y,
                                              rocsparse_index_base idx_base)
+{
+    J tid = hipThreadIdx_x;
+    J gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    J lid = tid & (WF_SIZE - 1);
+    J nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    // Loop over rows
+    for(J row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        // Each wavefront processes one row
+        I row_start = row_offset[row] - idx_base;
+        I row_end   = row_offset[row + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        // Loop over non-zero elements
+        for(I j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            sum = rocsparse_fma(alpha * rocsparse_convert<T>(csr_val[j]),
+                                rocsparse_ldg(x + csr_col_ind[j] - idx_base),
+                                sum);
+        }
+
+        // Obtain row sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // First thread of each wavefront writes result into global memory
+        if(lid == WF_SIZE - 1)
+        {
+            if(beta == static_cast<T>(0))
+            {
+                y[row] = sum;
+            }
+            else
+            {
+                y[row] = rocsparse_fma(beta, y[row], sum);
+            }
+        }
+    }
+}
+
+// Batch of sparse matrices sharing the same sparsity pattern. Rows of all matrices of the
+// batch are processed in a single grid, such that many small matrices can be handled by
+// a single kernel launch.
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+static __device__ void csrmvn_strided_batched_device(rocsparse_int        m,
+                                                     rocsparse_int        batch_count,
+                                                     T                    alpha,
+                                                     const rocsparse_int* row_offset,
+                                                     const rocsparse_int* csr_col_ind,
+                                                     const T*             csr_val,
+                                                     rocsparse_int        stride_val,
+                                                     const T*             x,
+                                                     rocsparse_int        stride_x,
+                                                     T                    beta,
+                                                     T*                   y,
+                                                     rocsparse_int        stride_y,
+                                                     rocsparse_index_base idx_base)
 {
     rocsparse_int tid = hipThreadIdx_x;
-    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    int64_t       gid = static_cast<int64_t>(hipBlockIdx_x) * BLOCKSIZE + tid;
     rocsparse_int lid = tid & (WF_SIZE - 1);
-    rocsparse_int nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+    int64_t       nwf = static_cast<int64_t>(hipGridDim_x) * BLOCKSIZE / WF_SIZE;
 
-    // Loop over rows
-    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    int64_t nrows = static_cast<int64_t>(m) * batch_count;
+
+    // Loop over the rows of all matrices
+    for(int64_t idx = gid / WF_SIZE; idx < nrows; idx += nwf)
     {
+        rocsparse_int batch = idx / m;
+        rocsparse_int row   = idx - static_cast<int64_t>(batch) * m;
+
+        // Matrix and vectors of the current batch
+        const T* val_b = csr_val + static_cast<int64_t>(stride_val) * batch;
+        const T* x_b   = x + static_cast<int64_t>(stride_x) * batch;
+        T*       y_b   = y + static_cast<int64_t>(stride_y) * batch;
+
         // Each wavefront processes one row
         rocsparse_int row_start = row_offset[row] - idx_base;
         rocsparse_int row_end   = row_offset[row + 1] - idx_base;
@@ -58,7 +131,7 @@ static __device__ void csrmvn_general_device(rocsparse_int        m,
         for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
         {
             sum = rocsparse_fma(
-                alpha * csr_val[j], rocsparse_ldg(x + csr_col_ind[j] - idx_base), sum);
+                alpha * val_b[j], rocsparse_ldg(x_b + csr_col_ind[j] - idx_base), sum);
         }
 
         // Obtain row sum using parallel reduction
@@ -69,16 +142,37 @@ static __device__ void csrmvn_general_device(rocsparse_int        m,
         {
             if(beta == static_cast<T>(0))
             {
-                y[row] = sum;
+                y_b[row] = sum;
             }
             else
             {
-                y[row] = rocsparse_fma(beta, y[row], sum);
+                y_b[row] = rocsparse_fma(beta, y_b[row], sum);
             }
         }
     }
 }
 
+// Scale y of all matrices of the batch by beta, if the matrices are empty
+template <typename T, unsigned int BLOCKSIZE>
+static __device__ void csrmvn_strided_batched_scale_device(
+    rocsparse_int m, rocsparse_int batch_count, T beta, T* y, rocsparse_int stride_y)
+{
+    int64_t gid = static_cast<int64_t>(hipBlockIdx_x) * BLOCKSIZE + hipThreadIdx_x;
+    int64_t inc = static_cast<int64_t>(hipGridDim_x) * BLOCKSIZE;
+
+    int64_t nrows = static_cast<int64_t>(m) * batch_count;
+
+    for(int64_t idx = gid; idx < nrows; idx += inc)
+    {
+        rocsparse_int batch = idx / m;
+        rocsparse_int row   = idx - static_cast<int64_t>(batch) * m;
+
+        T* y_b = y + static_cast<int64_t>(stride_y) * batch;
+
+        y_b[row] = (beta == static_cast<T>(0)) ? static_cast<T>(0) : beta * y_b[row];
+    }
+}
+
 template <typename T>
 static inline __device__ T sum2_reduce(
     T cur_sum, T* partial, rocsparse_int lid, rocsparse_int max_size, rocsparse_int reduc_size)
@@ -92,25 +186,215 @@ static inline __device__ T sum2_reduce(
     return cur_sum;
 }
 
-template <typename T,
+// Compute the row blocks of the rows [row, chunk_end) for csrmv adaptive on the
+// device. A single wavefront walks the rows of the chunk greedily, following the
+// former host ComputeRowBlocks, and the first row of each chunk starts a new row
+// block. Each block is terminated by the first row that exceeds the block size or
+// switches between short and long row regions. If row_blocks is nullptr, the row
+// blocks are only counted. Returns the number of row blocks of the chunk.
+template <typename I,
+          typename      J,
+          unsigned int  WF_SIZE,
+          rocsparse_int BLOCKSIZE,
+          rocsparse_int BLOCK_MULTIPLIER,
+          rocsparse_int ROWS_FOR_VECTOR,
+          rocsparse_int WG_BITS,
+          rocsparse_int ROW_BITS,
+          rocsparse_int WG_SIZE>
+static __device__ unsigned long long csrmvn_analysis_device(J                   row,
+                                                            J                   chunk_end,
+                                                            const I*            csr_row_ptr,
+                                                            unsigned long long* row_blocks)
+{
+    J lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    // Number of row blocks of this chunk
+    unsigned long long size = 0;
+
+    while(row < chunk_end)
+    {
+        I row_begin = csr_row_ptr[row];
+        I row_nnz   = csr_row_ptr[row + 1] - row_begin;
+
+        // Long row, processed by multiple workgroups (CSR-LongRows) or by a
+        // single workgroup (CSR-Vector)
+        if(row_nnz > BLOCKSIZE)
+        {
+            I nwg = (row_nnz - 1) / (BLOCK_MULTIPLIER * BLOCKSIZE) + 1;
+
+            // Number of workgroups must fit into WG_BITS bits, if not then the
+            // last workgroup will do all the remaining work
+            nwg = min(nwg, static_cast<I>(1 << WG_BITS));
+
+            if(row_blocks != nullptr)
+            {
+                for(I w = lid; w < nwg; w += WF_SIZE)
+                {
+                    row_blocks[size + w]
+                        = (static_cast<unsigned long long>(row) << (64 - ROW_BITS)) | w;
+                }
+            }
+
+            size += nwg;
+            ++row;
+
+            continue;
+        }
+
+        // First row that is not part of the current row block
+        J row_end = row + 1;
+
+        if(row_nnz < BLOCKSIZE)
+        {
+            // Rows with more than 128 entries start a long row region that is
+            // terminated by the first row with less than 32 entries. Short row
+            // regions are terminated by the first row with more than 128 entries.
+            bool long_region = row_nnz > 128;
+
+            for(J i = row + 1;; i += WF_SIZE)
+            {
+                J    local_row = i + lid;
+                J    local_end = chunk_end;
+                bool stop      = true;
+
+                if(local_row < chunk_end)
+                {
+                    I local_begin = csr_row_ptr[local_row];
+                    I local_next  = csr_row_ptr[local_row + 1];
+                    I local_nnz   = local_next - local_begin;
+                    I sum         = local_next - row_begin;
+
+                    bool cut = long_region ? (local_nnz < 32) : (local_nnz > 128);
+
+                    if(cut || sum > BLOCKSIZE)
+                    {
+                        // Row block ends before this row
+                        local_end = local_row;
+                    }
+                    else if(sum == BLOCKSIZE)
+                    {
+                        // Row block ends with this row
+                        local_end = local_row + 1;
+                    }
+                    else
+                    {
+                        stop = false;
+                    }
+                }
+
+                // The first lane that terminates the row block determines its end
+                unsigned long long mask = __ballot(stop);
+
+                if(mask != 0)
+                {
+                    row_end = __shfl(local_end, __ffsll(mask) - 1, WF_SIZE);
+                    break;
+                }
+            }
+        }
+
+        // Store the first row of the row block, the lower bits hold the number
+        // of threads that can be used for the reduction of each row
+        if(lid == 0 && row_blocks != nullptr)
+        {
+            J                  num_rows = row_end - row;
+            unsigned long long entry = static_cast<unsigned long long>(row) << (64 - ROW_BITS);
+
+            if(num_rows > ROWS_FOR_VECTOR)
+            {
+                entry |= WG_SIZE >> (32 - __clz(num_rows - 1));
+            }
+
+            row_blocks[size] = entry;
+        }
+
+        ++size;
+        row = row_end;
+    }
+
+    return size;
+}
+
+// Turn the number of row blocks of each chunk into the offset of the chunk in the
+// row blocks array, using a single workgroup. Additionally, the entry marking the
+// end of the final row block and the total number of entries are stored.
+template <unsigned int BLOCKSIZE, rocsparse_int ROW_BITS, typename J>
+static __device__ void csrmvn_analysis_scan_device(J                   m,
+                                                   size_t              num_chunks,
+                                                   unsigned long long* chunk_offset,
+                                                   unsigned long long* row_blocks,
+                                                   size_t              max_size)
+{
+    unsigned int tid = hipThreadIdx_x;
+
+    __shared__ unsigned long long sdata[BLOCKSIZE];
+
+    unsigned long long carry = 0;
+
+    for(size_t base = 0; base < num_chunks; base += BLOCKSIZE)
+    {
+        size_t             idx = base + tid;
+        unsigned long long val = (idx < num_chunks) ? chunk_offset[idx] : 0;
+
+        sdata[tid] = val;
+
+        __syncthreads();
+
+        // Inclusive scan of the current part
+        for(unsigned int i = 1; i < BLOCKSIZE; i <<= 1)
+        {
+            unsigned long long t = (tid >= i) ? sdata[tid - i] : 0;
+
+            __syncthreads();
+
+            sdata[tid] += t;
+
+            __syncthreads();
+        }
+
+        if(idx < num_chunks)
+        {
+            chunk_offset[idx] = carry + sdata[tid] - val;
+        }
+
+        carry += sdata[BLOCKSIZE - 1];
+
+        __syncthreads();
+    }
+
+    if(tid == 0)
+    {
+        // Last entry marks the end of the final row block
+        row_blocks[carry] = static_cast<unsigned long long>(m) << (64 - ROW_BITS);
+
+        // Number of entries, including the final one
+        row_blocks[max_size] = carry + 1;
+    }
+}
+
+template <typename I,
+          typename      J,
+          typename      T,
+          typename      U,
           rocsparse_int BLOCKSIZE,
           rocsparse_int BLOCK_MULTIPLIER,
           rocsparse_int ROWS_FOR_VECTOR,
           rocsparse_int WG_BITS,
           rocsparse_int ROW_BITS,
           rocsparse_int WG_SIZE>
-__device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
+__device__ void csrmvn_adaptive_device(rocsparse_int        gid,
+                                       rocsparse_int        num_blocks,
+                                       unsigned long long*  row_blocks,
                                        T                    alpha,
-                                       const rocsparse_int* csr_row_ptr,
-                                       const rocsparse_int* csr_col_ind,
-                                       const T*             csr_val,
+                                       const I*             csr_row_ptr,
+                                       const J*             csr_col_ind,
+                                       const U*             csr_val,
                                        const T*             x,
                                        T                    beta,
                                        T*                   y,
                                        rocsparse_index_base idx_base)
 {
     __shared__ T  partialSums[BLOCKSIZE];
-    rocsparse_int gid = hipBlockIdx_x;
     rocsparse_int lid = hipThreadIdx_x;
 
     // The row blocks buffer holds a packed set of information used to inform each
@@ -129,25 +413,24 @@ __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
     // part of the row to operate on.
     // Alternately, on short row blocks, the lower bits are used to communicate
     // the number of threads that should be used for the reduction. Pre-calculating
-    // this on the CPU-side results in a noticable performance uplift on many matrices.
+    // this during the analysis results in a noticable performance uplift on many matrices.
     // Bit 24 is a flag bit used so that the multiple WGs calculating a long row can
     // know when the first workgroup for that row has finished initializing the output
     // value. While this bit is the same as the first workgroup's flag bit, this
     // workgroup will spin-loop.
-    rocsparse_int row = ((row_blocks[gid] >> (64 - ROW_BITS)) & ((1ULL << ROW_BITS) - 1ULL));
-    rocsparse_int stop_row
-        = ((row_blocks[gid + 1] >> (64 - ROW_BITS)) & ((1ULL << ROW_BITS) - 1ULL));
-    rocsparse_int num_rows = stop_row - row;
+    J row      = ((row_blocks[gid] >> (64 - ROW_BITS)) & ((1ULL << ROW_BITS) - 1ULL));
+    J stop_row = ((row_blocks[gid + 1] >> (64 - ROW_BITS)) & ((1ULL << ROW_BITS) - 1ULL));
+    J num_rows = stop_row - row;
 
     // Get the workgroup within this long row ID out of the bottom bits of the row block.
     rocsparse_int wg = row_blocks[gid] & ((1 << WG_BITS) - 1);
 
     // Any workgroup only calculates, at most, BLOCK_MULTIPLIER*BLOCKSIZE items in a row.
     // If there are more items in this row, we assign more workgroups.
-    rocsparse_int vecStart
-        = rocsparse_mad24(wg, BLOCK_MULTIPLIER * BLOCKSIZE, csr_row_ptr[row] - idx_base);
-    rocsparse_int vecEnd
-        = min(csr_row_ptr[row + 1] - idx_base, vecStart + BLOCK_MULTIPLIER * BLOCKSIZE);
+    I vecStart = rocsparse_mad24(static_cast<I>(wg),
+                                 static_cast<I>(BLOCK_MULTIPLIER * BLOCKSIZE),
+                                 csr_row_ptr[row] - idx_base);
+    I vecEnd   = min(csr_row_ptr[row + 1] - idx_base, vecStart + BLOCK_MULTIPLIER * BLOCKSIZE);
 
     T temp_sum = static_cast<T>(0);
 
@@ -181,17 +464,17 @@ __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
         // threads, 4 rows = 64 threads, 5 rows = 32 threads, etc.
         // int numThreadsForRed = get_local_size(0) >> ((CHAR_BIT*sizeof(unsigned
         // int))-clz(num_rows-1));
-        rocsparse_int numThreadsForRed = wg; // Same calculation as above, done on host.
+        rocsparse_int numThreadsForRed = wg; // Same calculation as above, done in analysis.
 
         // Stream all of this row block's matrix values into local memory.
         // Perform the matvec in parallel with this work.
-        rocsparse_int col = csr_row_ptr[row] + lid - idx_base;
-        if(gid != (gridDim.x - 1))
+        I col = csr_row_ptr[row] + lid - idx_base;
+        if(gid != (num_blocks - 1))
         {
             for(rocsparse_int i = 0; i < BLOCKSIZE; i += WG_SIZE)
             {
-                partialSums[lid + i]
-                    = alpha * csr_val[col + i] * x[csr_col_ind[col + i] - idx_base];
+                partialSums[lid + i] = alpha * rocsparse_convert<T>(csr_val[col + i])
+                                       * x[csr_col_ind[col + i] - idx_base];
             }
         }
         else
@@ -201,12 +484,12 @@ __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
             // we will buffer overflow. On today's dGPUs, this doesn't cause problems.
             // The values are within a dGPU's page, which is zeroed out on allocation.
             // However, this may change in the future (e.g. with shared virtual memory.)
-            // This causes a minor performance loss because this is the last workgroup
-            // to be launched, and this loop can't be unrolled.
+            // This causes a minor performance loss because this is the last row block
+            // to be processed, and this loop can't be unrolled.
             for(rocsparse_int i = 0; col + i < csr_row_ptr[stop_row] - idx_base; i += WG_SIZE)
             {
-                partialSums[lid + i]
-                    = alpha * csr_val[col + i] * x[csr_col_ind[col + i] - idx_base];
+                partialSums[lid + i] = alpha * rocsparse_convert<T>(csr_val[col + i])
+                                       * x[csr_col_ind[col + i] - idx_base];
             }
         }
         __syncthreads();
@@ -224,9 +507,9 @@ __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
             // numThreadsForRed guaranteed to be a power of two, so the clz code below
             // avoids an integer divide. ~2% perf gain in EXTRA_PRECISION.
             // size_t st = lid/numThreadsForRed;
-            rocsparse_int local_row       = row + (lid >> (31 - __clz(numThreadsForRed)));
-            rocsparse_int local_first_val = csr_row_ptr[local_row] - csr_row_ptr[row];
-            rocsparse_int local_last_val  = csr_row_ptr[local_row + 1] - csr_row_ptr[row];
+            J             local_row       = row + (lid >> (31 - __clz(numThreadsForRed)));
+            I             local_first_val = csr_row_ptr[local_row] - csr_row_ptr[row];
+            I             local_last_val  = csr_row_ptr[local_row + 1] - csr_row_ptr[row];
             rocsparse_int threadInBlock   = lid & (numThreadsForRed - 1);
 
             // Not all row blocks are full -- they may have an odd number of rows. As such,
@@ -236,7 +519,7 @@ __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
                 // This is dangerous -- will infinite loop if your last value is within
                 // numThreadsForRed of MAX_UINT. Noticable performance gain to avoid a
                 // long induction variable here, though.
-                for(rocsparse_int local_cur_val = local_first_val + threadInBlock;
+                for(I local_cur_val = local_first_val + threadInBlock;
                     local_cur_val < local_last_val;
                     local_cur_val += numThreadsForRed)
                 {
@@ -278,13 +561,13 @@ __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
             // However, this reduction is also much faster than CSR-Scalar, because local memory
             // is designed for scatter-gather operations.
             // We need a while loop because there may be more rows than threads in the WG.
-            rocsparse_int local_row = row + lid;
+            J local_row = row + lid;
             while(local_row < stop_row)
             {
-                rocsparse_int local_first_val = (csr_row_ptr[local_row] - csr_row_ptr[row]);
-                rocsparse_int local_last_val  = csr_row_ptr[local_row + 1] - csr_row_ptr[row];
-                temp_sum                      = static_cast<T>(0);
-                for(rocsparse_int local_cur_val = local_first_val; local_cur_val < local_last_val;
+                I local_first_val = (csr_row_ptr[local_row] - csr_row_ptr[row]);
+                I local_last_val  = csr_row_ptr[local_row + 1] - csr_row_ptr[row];
+                temp_sum          = static_cast<T>(0);
+                for(I local_cur_val = local_first_val; local_cur_val < local_last_val;
                     ++local_cur_val)
                 {
                     temp_sum = temp_sum + partialSums[local_cur_val];
@@ -326,10 +609,11 @@ __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
             // Then dump the partially reduced answers into the LDS for inter-work-item reduction.
             // Using a long induction variable to make sure unsigned int overflow doesn't break
             // things.
-            for(rocsparse_int j = vecStart + lid; j < vecEnd; j += WG_SIZE)
+            for(I j = vecStart + lid; j < vecEnd; j += WG_SIZE)
             {
-                temp_sum
-                    = rocsparse_fma(alpha * csr_val[j], x[csr_col_ind[j] - idx_base], temp_sum);
+                temp_sum = rocsparse_fma(alpha * rocsparse_convert<T>(csr_val[j]),
+                                         x[csr_col_ind[j] - idx_base],
+                                         temp_sum);
             }
 
             partialSums[lid] = temp_sum;
@@ -399,9 +683,11 @@ __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
         // Load in a bunch of partial results into your register space, rather than LDS (no
         // contention)
         // Then dump the partially reduced answers into the LDS for inter-work-item reduction.
-        for(rocsparse_int j = vecStart + lid; j < vecEnd; j += WG_SIZE)
+        for(I j = vecStart + lid; j < vecEnd; j += WG_SIZE)
         {
-            temp_sum = rocsparse_fma(alpha * csr_val[j], x[csr_col_ind[j] - idx_base], temp_sum);
+            temp_sum = rocsparse_fma(alpha * rocsparse_convert<T>(csr_val[j]),
+                                     x[csr_col_ind[j] - idx_base],
+                                     temp_sum);
         }
 
         partialSums[lid] = temp_sum;
@@ -418,4 +704,78 @@ __device__ void csrmvn_adaptive_device(unsigned long long*  row_blocks,
     }
 }
 
+// Workgroups fetch row blocks from a counter until all row blocks are processed,
+// such that the grid size does not depend on the number of row blocks, which is
+// only known on the device. Row blocks are fetched in increasing order, thus the
+// first workgroup of a long row has always been started before the remaining ones
+// spin on its flag. row_blocks[max_size] holds the number of entries. The counter
+// must be zero on entry and belongs to the call, not to the shared csrmv info.
+template <typename I,
+          typename      J,
+          typename      T,
+          typename      U,
+          rocsparse_int BLOCKSIZE,
+          rocsparse_int BLOCK_MULTIPLIER,
+          rocsparse_int ROWS_FOR_VECTOR,
+          rocsparse_int WG_BITS,
+          rocsparse_int ROW_BITS,
+          rocsparse_int WG_SIZE>
+__device__ void csrmvn_adaptive_persistent_device(unsigned long long*  row_blocks,
+                                                  size_t               max_size,
+                                                  unsigned long long*  counter,
+                                                  T                    alpha,
+                                                  const I*             csr_row_ptr,
+                                                  const J*             csr_col_ind,
+                                                  const U*             csr_val,
+                                                  const T*             x,
+                                                  T                    beta,
+                                                  T*                   y,
+                                                  rocsparse_index_base idx_base)
+{
+    __shared__ rocsparse_int sgid;
+
+    // Number of row blocks, the final entry only marks the end of the last block
+    rocsparse_int num_blocks = row_blocks[max_size] - 1;
+
+    while(true)
+    {
+        if(hipThreadIdx_x == 0)
+        {
+            sgid = atomicAdd(counter, 1ULL);
+        }
+
+        __syncthreads();
+
+        rocsparse_int gid = sgid;
+
+        __syncthreads();
+
+        if(gid >= num_blocks)
+        {
+            return;
+        }
+
+        csrmvn_adaptive_device<I,
+                               J,
+                               T,
+                               U,
+                               BLOCKSIZE,
+                               BLOCK_MULTIPLIER,
+                               ROWS_FOR_VECTOR,
+                               WG_BITS,
+                               ROW_BITS,
+                               WG_SIZE>(gid,
+                                        num_blocks,
+                                        row_blocks,
+                                        alpha,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        csr_val,
+                                        x,
+                                        beta,
+                                        y,
+                                        idx_base);
+    }
+}
+
 #endif // CSRMV_DEVICE_H
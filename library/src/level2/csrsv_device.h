@@ -31,12 +31,12 @@
 
 extern "C" void __builtin_amdgcn_s_sleep(int);
 
-template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SLEEP>
+template <typename I, typename J, unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SLEEP>
 __launch_bounds__(BLOCKSIZE) __global__
-    void csrsv_analysis_lower_kernel(rocsparse_int m,
-                                     const rocsparse_int* __restrict__ csr_row_ptr,
-                                     const rocsparse_int* __restrict__ csr_col_ind,
-                                     rocsparse_int* __restrict__ csr_diag_ind,
+    void csrsv_analysis_lower_kernel(J m,
+                                     const I* __restrict__ csr_row_ptr,
+                                     const J* __restrict__ csr_col_ind,
+                                     I* __restrict__ csr_diag_ind,
                                      int* __restrict__ done_array,
                                      rocsparse_int* __restrict__ max_nnz,
                                      rocsparse_int* __restrict__ zero_pivot,
@@ -47,10 +47,10 @@ __launch_bounds__(BLOCKSIZE) __global__
     int wid = hipThreadIdx_x / WF_SIZE;
 
     // First row in this block
-    rocsparse_int first_row = hipBlockIdx_x * BLOCKSIZE / WF_SIZE;
+    J first_row = hipBlockIdx_x * BLOCKSIZE / WF_SIZE;
 
     // Row that the wavefront will process
-    rocsparse_int row = first_row + wid;
+    J row = first_row + wid;
 
     // Shared memory to set done flag for intra-block dependencies
     __shared__ int local_done_array[BLOCKSIZE / WF_SIZE];
@@ -76,13 +76,13 @@ __launch_bounds__(BLOCKSIZE) __global__
     // Local depth
     int local_max = 0;
 
-    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
-    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+    I row_begin = csr_row_ptr[row] - idx_base;
+    I row_end   = csr_row_ptr[row + 1] - idx_base;
 
     // This wavefront operates on a single row, from its beginning to end.
     // First, we process all nodes that have dependencies outside the current block.
-    rocsparse_int local_col = -1;
-    rocsparse_int j;
+    J local_col = -1;
+    I j;
     for(j = row_begin + lid; j < row_end; j += WF_SIZE)
     {
         // local_col will tell us, for this iteration of the above for loop
@@ -175,22 +175,22 @@ __launch_bounds__(BLOCKSIZE) __global__
         atomicOr(&done_array[row], local_max + 1);
 
         // Obtain maximum nnz
-        atomicMax(max_nnz, row_end - row_begin);
+        atomicMax(max_nnz, static_cast<rocsparse_int>(row_end - row_begin));
 
         if(csr_diag_ind[row] == -1 && diag_type == rocsparse_diag_type_non_unit)
         {
             // We are looking for the first zero pivot
-            atomicMin(zero_pivot, row + idx_base);
+            atomicMin(zero_pivot, static_cast<rocsparse_int>(row + idx_base));
         }
     }
 }
 
-template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SLEEP>
+template <typename I, typename J, unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SLEEP>
 __launch_bounds__(BLOCKSIZE) __global__
-    void csrsv_analysis_upper_kernel(rocsparse_int m,
-                                     const rocsparse_int* __restrict__ csr_row_ptr,
-                                     const rocsparse_int* __restrict__ csr_col_ind,
-                                     rocsparse_int* __restrict__ csr_diag_ind,
+    void csrsv_analysis_upper_kernel(J m,
+                                     const I* __restrict__ csr_row_ptr,
+                                     const J* __restrict__ csr_col_ind,
+                                     I* __restrict__ csr_diag_ind,
                                      int* __restrict__ done_array,
                                      rocsparse_int* __restrict__ max_nnz,
                                      rocsparse_int* __restrict__ zero_pivot,
@@ -201,10 +201,10 @@ __launch_bounds__(BLOCKSIZE) __global__
     int wid = hipThreadIdx_x / WF_SIZE;
 
     // Last row in this block
-    rocsparse_int last_row = m - 1 - hipBlockIdx_x * BLOCKSIZE / WF_SIZE;
+    J last_row = m - 1 - hipBlockIdx_x * BLOCKSIZE / WF_SIZE;
 
     // Row that the wavefront will process
-    rocsparse_int row = last_row - wid;
+    J row = last_row - wid;
 
     // Shared memory to set done flag for intra-block dependencies
     __shared__ int local_done_array[BLOCKSIZE / WF_SIZE];
@@ -230,13 +230,13 @@ __launch_bounds__(BLOCKSIZE) __global__
     // Local depth
     int local_max = 0;
 
-    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
-    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+    I row_begin = csr_row_ptr[row] - idx_base;
+    I row_end   = csr_row_ptr[row + 1] - idx_base;
 
     // This wavefront operates on a single row, from its end to its begin.
     // First, we process all nodes that have dependencies outside the current block.
-    rocsparse_int local_col = -1;
-    rocsparse_int j;
+    J local_col = -1;
+    I j;
     for(j = row_end - 1 - lid; j >= row_begin; j -= WF_SIZE)
     {
         // local_col will tell us, for this iteration of the above for loop
@@ -329,24 +329,33 @@ __launch_bounds__(BLOCKSIZE) __global__
         atomicOr(&done_array[row], local_max + 1);
 
         // Obtain maximum nnz
-        atomicMax(max_nnz, row_end - row_begin);
+        atomicMax(max_nnz, static_cast<rocsparse_int>(row_end - row_begin));
 
         if(csr_diag_ind[row] == -1 && diag_type == rocsparse_diag_type_non_unit)
         {
             // We are looking for the first zero pivot
-            atomicMin(zero_pivot, row + idx_base);
+            atomicMin(zero_pivot, static_cast<rocsparse_int>(row + idx_base));
         }
     }
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SLEEP>
-__device__ void csrsv_device(rocsparse_int m,
-                             T             alpha,
-                             const rocsparse_int* __restrict__ csr_row_ptr,
-                             const rocsparse_int* __restrict__ csr_col_ind,
-                             const T* __restrict__ csr_val,
+template <typename I,
+          typename     J,
+          typename     T,
+          typename     U,
+          unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          bool         SLEEP>
+__device__ void csrsv_device(J m,
+                             T alpha,
+                             const I* __restrict__ csr_row_ptr,
+                             const J* __restrict__ csr_col_ind,
+                             const U* __restrict__ csr_val,
+                             rocsparse_int stride_val,
                              const T* __restrict__ x,
+                             rocsparse_int stride_x,
                              T* __restrict__ y,
+                             rocsparse_int stride_y,
                              int* __restrict__ done_array,
                              rocsparse_int* __restrict__ map,
                              rocsparse_int offset,
@@ -359,7 +368,7 @@ __device__ void csrsv_device(rocsparse_int m,
     int wid = hipThreadIdx_x / WF_SIZE;
 
     // Index into the row map
-    rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
+    J idx = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
 
     // Shared memory to hold diagonal entry
     __shared__ T diagonal[BLOCKSIZE / WF_SIZE];
@@ -370,12 +379,20 @@ __device__ void csrsv_device(rocsparse_int m,
         return;
     }
 
+    // Matrix and vectors of the batch this warp will operate on
+    int64_t batch = hipBlockIdx_y;
+
+    csr_val += batch * stride_val;
+    x += batch * stride_x;
+    y += batch * stride_y;
+    done_array += batch * m;
+
     // Get the row this warp will operate on
-    rocsparse_int row = map[idx + offset];
+    J row = map[idx + offset];
 
     // Current row entry point and exit point
-    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
-    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+    I row_begin = csr_row_ptr[row] - idx_base;
+    I row_end   = csr_row_ptr[row + 1] - idx_base;
 
     // Local summation variable.
     T local_sum = static_cast<T>(0);
@@ -386,13 +403,13 @@ __device__ void csrsv_device(rocsparse_int m,
         local_sum = alpha * rocsparse_nontemporal_load(x + row);
     }
 
-    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    for(I j = row_begin + lid; j < row_end; j += WF_SIZE)
     {
         // Current column this lane operates on
-        rocsparse_int local_col = rocsparse_nontemporal_load(csr_col_ind + j) - idx_base;
+        J local_col = rocsparse_nontemporal_load(csr_col_ind + j) - idx_base;
 
-        // Local value this lane operates with
-        T local_val = rocsparse_nontemporal_load(csr_val + j);
+        // Local value this lane operates with, the matrix might be stored in lower precision
+        T local_val = rocsparse_convert<T>(rocsparse_nontemporal_load(csr_val + j));
 
         // Check for numerical zero
         if(local_val == static_cast<T>(0) && local_col == row
@@ -400,7 +417,7 @@ __device__ void csrsv_device(rocsparse_int m,
         {
             // Numerical zero pivot found, avoid division by 0
             // and store index for later use.
-            atomicMin(zero_pivot, row + idx_base);
+            atomicMin(zero_pivot, static_cast<rocsparse_int>(row + idx_base));
             local_val = static_cast<T>(1);
         }
 
@@ -505,4 +522,28 @@ __device__ void csrsv_device(rocsparse_int m,
     }
 }
 
+// Copy values into a different precision, e.g. to set up factors that are stored in
+// lower precision than the matrix they are computed from
+template <unsigned int BLOCKSIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_convert_kernel(rocsparse_int size, const U* __restrict__ in, T* __restrict__ out)
+{
+    rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(idx >= size)
+    {
+        return;
+    }
+
+    out[idx] = rocsparse_convert<T>(in[idx]);
+}
+
+// Set the zero pivot on the device, such that no host to device transfer and
+// thus no stream synchronization is required
+template <typename I>
+__global__ void csrsv_init_zero_pivot_kernel(I* __restrict__ zero_pivot, I value)
+{
+    *zero_pivot = value;
+}
+
 #endif // CSRSV_DEVICE_H
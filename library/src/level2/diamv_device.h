@@ -0,0 +1,98 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef DIAMV_DEVICE_H
+#define DIAMV_DEVICE_H
+
+#include "common.h"
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+// DIA SpMV for general, non-transposed matrices. The diagonal offsets are staged in
+// LDS, chunk by chunk, as they are shared by all rows of the block.
+template <typename T, unsigned int BLOCKSIZE>
+static __device__ void diamvn_device(rocsparse_int        m,
+                                     rocsparse_int        n,
+                                     rocsparse_int        dia_num_diag,
+                                     T                    alpha,
+                                     const rocsparse_int* dia_offset,
+                                     const T*             dia_val,
+                                     const T*             x,
+                                     T                    beta,
+                                     T*                   y)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int ai  = BLOCKSIZE * hipBlockIdx_x + tid;
+
+    __shared__ rocsparse_int soffset[BLOCKSIZE];
+
+    T sum = static_cast<T>(0);
+
+    for(rocsparse_int d0 = 0; d0 < dia_num_diag; d0 += BLOCKSIZE)
+    {
+        __syncthreads();
+
+        if(d0 + tid < dia_num_diag)
+        {
+            soffset[tid] = dia_offset[d0 + tid];
+        }
+
+        __syncthreads();
+
+        if(ai < m)
+        {
+            rocsparse_int nd = min(static_cast<rocsparse_int>(BLOCKSIZE), dia_num_diag - d0);
+
+            for(rocsparse_int d = 0; d < nd; ++d)
+            {
+                rocsparse_int col = ai + soffset[d];
+
+                if(col >= 0 && col < n)
+                {
+                    sum = rocsparse_fma(rocsparse_nontemporal_load(dia_val + m * (d0 + d) + ai),
+                                        rocsparse_ldg(x + col),
+                                        sum);
+                }
+            }
+        }
+    }
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    if(beta != static_cast<T>(0))
+    {
+        T yv = rocsparse_nontemporal_load(y + ai);
+        rocsparse_nontemporal_store(rocsparse_fma(beta, yv, alpha * sum), y + ai);
+    }
+    else
+    {
+        rocsparse_nontemporal_store(alpha * sum, y + ai);
+    }
+}
+
+#endif // DIAMV_DEVICE_H
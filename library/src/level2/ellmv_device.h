@@ -31,13 +31,13 @@
 #include <hip/hip_runtime.h>
 
 // ELL SpMV for general, non-transposed matrices
-template <typename T, unsigned int BLOCKSIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE>
 static __device__ void ellmvn_device(rocsparse_int        m,
                                      rocsparse_int        n,
                                      rocsparse_int        ell_width,
                                      T                    alpha,
                                      const rocsparse_int* ell_col_ind,
-                                     const T*             ell_val,
+                                     const U*             ell_val,
                                      const T*             x,
                                      T                    beta,
                                      T*                   y,
@@ -58,8 +58,9 @@ static __device__ void ellmvn_device(rocsparse_int        m,
 
         if(col >= 0 && col < n)
         {
-            sum = rocsparse_fma(
-                rocsparse_nontemporal_load(ell_val + idx), rocsparse_ldg(x + col), sum);
+            sum = rocsparse_fma(rocsparse_convert<T>(rocsparse_nontemporal_load(ell_val + idx)),
+                                rocsparse_ldg(x + col),
+                                sum);
         }
         else
         {
@@ -161,3 +161,340 @@ extern "C" rocsparse_status rocsparse_zbsrmv(rocsparse_handle                han
                                     beta,
                                     y);
 }
+
+extern "C" rocsparse_status rocsparse_shbsrmv(rocsparse_handle          handle,
+                                              rocsparse_direction       dir,
+                                              rocsparse_operation       trans,
+                                              rocsparse_int             mb,
+                                              rocsparse_int             nb,
+                                              rocsparse_int             nnzb,
+                                              const float*              alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const rocsparse_half*     bsr_val,
+                                              const rocsparse_int*      bsr_row_ptr,
+                                              const rocsparse_int*      bsr_col_ind,
+                                              rocsparse_int             bsr_dim,
+                                              const float*              x,
+                                              const float*              beta,
+                                              float*                    y)
+{
+    return rocsparse_bsrmv_template(handle,
+                                    dir,
+                                    trans,
+                                    mb,
+                                    nb,
+                                    nnzb,
+                                    alpha,
+                                    descr,
+                                    bsr_val,
+                                    bsr_row_ptr,
+                                    bsr_col_ind,
+                                    bsr_dim,
+                                    x,
+                                    beta,
+                                    y);
+}
+
+extern "C" rocsparse_status rocsparse_sbbsrmv(rocsparse_handle          handle,
+                                              rocsparse_direction       dir,
+                                              rocsparse_operation       trans,
+                                              rocsparse_int             mb,
+                                              rocsparse_int             nb,
+                                              rocsparse_int             nnzb,
+                                              const float*              alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const rocsparse_bfloat16* bsr_val,
+                                              const rocsparse_int*      bsr_row_ptr,
+                                              const rocsparse_int*      bsr_col_ind,
+                                              rocsparse_int             bsr_dim,
+                                              const float*              x,
+                                              const float*              beta,
+                                              float*                    y)
+{
+    return rocsparse_bsrmv_template(handle,
+                                    dir,
+                                    trans,
+                                    mb,
+                                    nb,
+                                    nnzb,
+                                    alpha,
+                                    descr,
+                                    bsr_val,
+                                    bsr_row_ptr,
+                                    bsr_col_ind,
+                                    bsr_dim,
+                                    x,
+                                    beta,
+                                    y);
+}
+
+extern "C" rocsparse_status rocsparse_sbsrmv_ex_analysis(rocsparse_handle          handle,
+                                                         rocsparse_direction       dir,
+                                                         rocsparse_operation       trans,
+                                                         rocsparse_int             mb,
+                                                         rocsparse_int             nb,
+                                                         rocsparse_int             nnzb,
+                                                         const rocsparse_mat_descr descr,
+                                                         const float*              bsr_val,
+                                                         const rocsparse_int*      bsr_row_ptr,
+                                                         const rocsparse_int*      bsr_col_ind,
+                                                         rocsparse_int             bsr_dim,
+                                                         rocsparse_mat_info        info)
+{
+    return rocsparse_bsrmv_ex_analysis_template(handle,
+                                                dir,
+                                                trans,
+                                                mb,
+                                                nb,
+                                                nnzb,
+                                                descr,
+                                                bsr_val,
+                                                bsr_row_ptr,
+                                                bsr_col_ind,
+                                                bsr_dim,
+                                                info);
+}
+
+extern "C" rocsparse_status rocsparse_dbsrmv_ex_analysis(rocsparse_handle          handle,
+                                                         rocsparse_direction       dir,
+                                                         rocsparse_operation       trans,
+                                                         rocsparse_int             mb,
+                                                         rocsparse_int             nb,
+                                                         rocsparse_int             nnzb,
+                                                         const rocsparse_mat_descr descr,
+                                                         const double*             bsr_val,
+                                                         const rocsparse_int*      bsr_row_ptr,
+                                                         const rocsparse_int*      bsr_col_ind,
+                                                         rocsparse_int             bsr_dim,
+                                                         rocsparse_mat_info        info)
+{
+    return rocsparse_bsrmv_ex_analysis_template(handle,
+                                                dir,
+                                                trans,
+                                                mb,
+                                                nb,
+                                                nnzb,
+                                                descr,
+                                                bsr_val,
+                                                bsr_row_ptr,
+                                                bsr_col_ind,
+                                                bsr_dim,
+                                                info);
+}
+
+extern "C" rocsparse_status rocsparse_cbsrmv_ex_analysis(rocsparse_handle               handle,
+                                                         rocsparse_direction            dir,
+                                                         rocsparse_operation            trans,
+                                                         rocsparse_int                  mb,
+                                                         rocsparse_int                  nb,
+                                                         rocsparse_int                  nnzb,
+                                                         const rocsparse_mat_descr      descr,
+                                                         const rocsparse_float_complex* bsr_val,
+                                                         const rocsparse_int*           bsr_row_ptr,
+                                                         const rocsparse_int*           bsr_col_ind,
+                                                         rocsparse_int                  bsr_dim,
+                                                         rocsparse_mat_info             info)
+{
+    return rocsparse_bsrmv_ex_analysis_template(handle,
+                                                dir,
+                                                trans,
+                                                mb,
+                                                nb,
+                                                nnzb,
+                                                descr,
+                                                bsr_val,
+                                                bsr_row_ptr,
+                                                bsr_col_ind,
+                                                bsr_dim,
+                                                info);
+}
+
+extern "C" rocsparse_status rocsparse_zbsrmv_ex_analysis(rocsparse_handle                handle,
+                                                         rocsparse_direction             dir,
+                                                         rocsparse_operation             trans,
+                                                         rocsparse_int                   mb,
+                                                         rocsparse_int                   nb,
+                                                         rocsparse_int                   nnzb,
+                                                         const rocsparse_mat_descr       descr,
+                                                         const rocsparse_double_complex* bsr_val,
+                                                         const rocsparse_int* bsr_row_ptr,
+                                                         const rocsparse_int* bsr_col_ind,
+                                                         rocsparse_int                   bsr_dim,
+                                                         rocsparse_mat_info              info)
+{
+    return rocsparse_bsrmv_ex_analysis_template(handle,
+                                                dir,
+                                                trans,
+                                                mb,
+                                                nb,
+                                                nnzb,
+                                                descr,
+                                                bsr_val,
+                                                bsr_row_ptr,
+                                                bsr_col_ind,
+                                                bsr_dim,
+                                                info);
+}
+
+extern "C" rocsparse_status rocsparse_bsrmv_ex_clear(rocsparse_handle   handle,
+                                                     rocsparse_mat_info info)
+{
+    // Check for valid handle and matrix info
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_bsrmv_ex_clear", (const void*&)info);
+
+    // Destroy bsrmv info struct
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_bsrmv_info(info->bsrmv_info));
+    info->bsrmv_info = nullptr;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_sbsrmv_ex(rocsparse_handle          handle,
+                                                rocsparse_direction       dir,
+                                                rocsparse_operation       trans,
+                                                rocsparse_int             mb,
+                                                rocsparse_int             nb,
+                                                rocsparse_int             nnzb,
+                                                const float*              alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              bsr_val,
+                                                const rocsparse_int*      bsr_row_ptr,
+                                                const rocsparse_int*      bsr_col_ind,
+                                                rocsparse_int             bsr_dim,
+                                                rocsparse_mat_info        info,
+                                                const float*              x,
+                                                const float*              beta,
+                                                float*                    y)
+{
+    return rocsparse_bsrmv_ex_template(handle,
+                                       dir,
+                                       trans,
+                                       mb,
+                                       nb,
+                                       nnzb,
+                                       alpha,
+                                       descr,
+                                       bsr_val,
+                                       bsr_row_ptr,
+                                       bsr_col_ind,
+                                       bsr_dim,
+                                       info,
+                                       x,
+                                       beta,
+                                       y);
+}
+
+extern "C" rocsparse_status rocsparse_dbsrmv_ex(rocsparse_handle          handle,
+                                                rocsparse_direction       dir,
+                                                rocsparse_operation       trans,
+                                                rocsparse_int             mb,
+                                                rocsparse_int             nb,
+                                                rocsparse_int             nnzb,
+                                                const double*             alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             bsr_val,
+                                                const rocsparse_int*      bsr_row_ptr,
+                                                const rocsparse_int*      bsr_col_ind,
+                                                rocsparse_int             bsr_dim,
+                                                rocsparse_mat_info        info,
+                                                const double*             x,
+                                                const double*             beta,
+                                                double*                   y)
+{
+    return rocsparse_bsrmv_ex_template(handle,
+                                       dir,
+                                       trans,
+                                       mb,
+                                       nb,
+                                       nnzb,
+                                       alpha,
+                                       descr,
+                                       bsr_val,
+                                       bsr_row_ptr,
+                                       bsr_col_ind,
+                                       bsr_dim,
+                                       info,
+                                       x,
+                                       beta,
+                                       y);
+}
+
+extern "C" rocsparse_status rocsparse_cbsrmv_ex(rocsparse_handle               handle,
+                                                rocsparse_direction            dir,
+                                                rocsparse_operation            trans,
+                                                rocsparse_int                  mb,
+                                                rocsparse_int                  nb,
+                                                rocsparse_int                  nnzb,
+                                                const rocsparse_float_complex* alpha,
+                                                const rocsparse_mat_descr      descr,
+                                                const rocsparse_float_complex* bsr_val,
+                                                const rocsparse_int*           bsr_row_ptr,
+                                                const rocsparse_int*           bsr_col_ind,
+                                                rocsparse_int                  bsr_dim,
+                                                rocsparse_mat_info             info,
+                                                const rocsparse_float_complex* x,
+                                                const rocsparse_float_complex* beta,
+                                                rocsparse_float_complex*       y)
+{
+    return rocsparse_bsrmv_ex_template(handle,
+                                       dir,
+                                       trans,
+                                       mb,
+                                       nb,
+                                       nnzb,
+                                       alpha,
+                                       descr,
+                                       bsr_val,
+                                       bsr_row_ptr,
+                                       bsr_col_ind,
+                                       bsr_dim,
+                                       info,
+                                       x,
+                                       beta,
+                                       y);
+}
+
+extern "C" rocsparse_status rocsparse_zbsrmv_ex(rocsparse_handle                handle,
+                                                rocsparse_direction             dir,
+                                                rocsparse_operation             trans,
+                                                rocsparse_int                   mb,
+                                                rocsparse_int                   nb,
+                                                rocsparse_int                   nnzb,
+                                                const rocsparse_double_complex* alpha,
+                                                const rocsparse_mat_descr       descr,
+                                                const rocsparse_double_complex* bsr_val,
+                                                const rocsparse_int*            bsr_row_ptr,
+                                                const rocsparse_int*            bsr_col_ind,
+                                                rocsparse_int                   bsr_dim,
+                                                rocsparse_mat_info              info,
+                                                const rocsparse_double_complex* x,
+                                                const rocsparse_double_complex* beta,
+                                                rocsparse_double_complex*       y)
+{
+    return rocsparse_bsrmv_ex_template(handle,
+                                       dir,
+                                       trans,
+                                       mb,
+                                       nb,
+                                       nnzb,
+                                       alpha,
+                                       descr,
+                                       bsr_val,
+                                       bsr_row_ptr,
+                                       bsr_col_ind,
+                                       bsr_dim,
+                                       info,
+                                       x,
+                                       beta,
+                                       y);
+}
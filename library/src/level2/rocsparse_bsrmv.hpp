@@ -29,80 +29,81 @@
 #include "definitions.h"
 #include "handle.h"
 #include "rocsparse.h"
+#include "rocsparse_coomv.hpp"
 #include "rocsparse_csrmv.hpp"
 #include "utility.h"
 
+#include "../level1/rocsparse_gthr.hpp"
+
 #include <hip/hip_runtime.h>
+#include <rocprim/rocprim.hpp>
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE>
-__launch_bounds__(BLOCKSIZE) __global__
-    void bsrmvn_general_kernel_host_pointer(rocsparse_direction dir,
-                                            T                   alpha,
-                                            const rocsparse_int* __restrict__ bsr_row_ptr,
-                                            const rocsparse_int* __restrict__ bsr_col_ind,
-                                            const T* __restrict__ bsr_val,
-                                            rocsparse_int bsr_dim,
-                                            const T* __restrict__ x,
-                                            T beta,
-                                            T* __restrict__ y,
-                                            rocsparse_index_base idx_base)
-{
-    bsrmvn_general_device<T, BLOCKSIZE, WFSIZE>(
-        dir, alpha, bsr_row_ptr, bsr_col_ind, bsr_val, bsr_dim, x, beta, y, idx_base);
-}
+// Sub-wavefront sizes of the 2x2, 3x3 and 4x4 kernels
+using bsrmvn_small_wfsizes = rocsparse_value_list<4, 8, 16, 32, 64>;
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE>
-__launch_bounds__(BLOCKSIZE) __global__
-    void bsrmvn_general_kernel_device_pointer(rocsparse_direction dir,
-                                              const T*            alpha,
-                                              const rocsparse_int* __restrict__ bsr_row_ptr,
-                                              const rocsparse_int* __restrict__ bsr_col_ind,
-                                              const T* __restrict__ bsr_val,
-                                              rocsparse_int bsr_dim,
-                                              const T* __restrict__ x,
-                                              const T* beta,
-                                              T* __restrict__ y,
-                                              rocsparse_index_base idx_base)
+// Sub-wavefront size of the 2x2, 3x3 and 4x4 kernels, depending on the average number
+// of BSR blocks per row
+static inline rocsparse_int bsrmvn_small_wfsize(rocsparse_int blocks_per_row,
+                                                rocsparse_int wavefront_size)
 {
-    bsrmvn_general_device<T, BLOCKSIZE, WFSIZE>(
-        dir, *alpha, bsr_row_ptr, bsr_col_ind, bsr_val, bsr_dim, x, *beta, y, idx_base);
+    rocsparse_int wfsize = 64;
+
+    if(blocks_per_row < 8)
+    {
+        wfsize = 4;
+    }
+    else if(blocks_per_row < 16)
+    {
+        wfsize = 8;
+    }
+    else if(blocks_per_row < 32)
+    {
+        wfsize = 16;
+    }
+    else if(blocks_per_row < 64)
+    {
+        wfsize = 32;
+    }
+
+    // Sub-wavefronts must not exceed the hardware wavefront
+    return std::min(wfsize, wavefront_size);
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WFSIZE>
 __launch_bounds__(BLOCKSIZE) __global__
     void bsrmvn_2x2_kernel_host_pointer(rocsparse_int       mb,
                                         rocsparse_direction dir,
                                         T                   alpha,
                                         const rocsparse_int* __restrict__ bsr_row_ptr,
                                         const rocsparse_int* __restrict__ bsr_col_ind,
-                                        const T* __restrict__ bsr_val,
+                                        const U* __restrict__ bsr_val,
                                         const T* __restrict__ x,
                                         T beta,
                                         T* __restrict__ y,
                                         rocsparse_index_base idx_base)
 {
-    bsrmvn_2x2_device<T, BLOCKSIZE, WFSIZE>(
+    bsrmvn_2x2_device<T, U, BLOCKSIZE, WFSIZE>(
         mb, dir, alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, beta, y, idx_base);
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WFSIZE>
 __launch_bounds__(BLOCKSIZE) __global__
     void bsrmvn_2x2_kernel_device_pointer(rocsparse_int       mb,
                                           rocsparse_direction dir,
                                           const T*            alpha,
                                           const rocsparse_int* __restrict__ bsr_row_ptr,
                                           const rocsparse_int* __restrict__ bsr_col_ind,
-                                          const T* __restrict__ bsr_val,
+                                          const U* __restrict__ bsr_val,
                                           const T* __restrict__ x,
                                           const T* beta,
                                           T* __restrict__ y,
                                           rocsparse_index_base idx_base)
 {
-    bsrmvn_2x2_device<T, BLOCKSIZE, WFSIZE>(
+    bsrmvn_2x2_device<T, U, BLOCKSIZE, WFSIZE>(
         mb, dir, *alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, *beta, y, idx_base);
 }
 
-template <typename T>
+template <typename T, typename U>
 static void bsrmvn_2x2(rocsparse_handle     handle,
                        rocsparse_direction  dir,
                        rocsparse_int        mb,
@@ -110,75 +111,23 @@ static void bsrmvn_2x2(rocsparse_handle     handle,
                        const T*             alpha,
                        const rocsparse_int* bsr_row_ptr,
                        const rocsparse_int* bsr_col_ind,
-                       const T*             bsr_val,
+                       const U*             bsr_val,
                        const T*             x,
                        const T*             beta,
                        T*                   y,
                        rocsparse_index_base base)
 {
-    rocsparse_int blocks_per_row = nnzb / mb;
+    static constexpr unsigned int BSRMVN_DIM = 128;
 
-#define BSRMVN_DIM 128
-    if(handle->pointer_mode == rocsparse_pointer_mode_device)
-    {
-        if(blocks_per_row < 8)
-        {
-            hipLaunchKernelGGL((bsrmvn_2x2_kernel_device_pointer<T, BSRMVN_DIM, 4>),
-                               dim3((mb - 1) / (BSRMVN_DIM / 4) + 1),
-                               dim3(BSRMVN_DIM),
-                               0,
-                               handle->stream,
-                               mb,
-                               dir,
-                               alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               beta,
-                               y,
-                               base);
-        }
-        else if(blocks_per_row < 16)
-        {
-            hipLaunchKernelGGL((bsrmvn_2x2_kernel_device_pointer<T, BSRMVN_DIM, 8>),
-                               dim3((mb - 1) / (BSRMVN_DIM / 8) + 1),
-                               dim3(BSRMVN_DIM),
-                               0,
-                               handle->stream,
-                               mb,
-                               dir,
-                               alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               beta,
-                               y,
-                               base);
-        }
-        else if(blocks_per_row < 32)
-        {
-            hipLaunchKernelGGL((bsrmvn_2x2_kernel_device_pointer<T, BSRMVN_DIM, 16>),
-                               dim3((mb - 1) / (BSRMVN_DIM / 16) + 1),
-                               dim3(BSRMVN_DIM),
-                               0,
-                               handle->stream,
-                               mb,
-                               dir,
-                               alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               beta,
-                               y,
-                               base);
-        }
-        else if(blocks_per_row < 64)
+    rocsparse_int wfsize = bsrmvn_small_wfsize(nnzb / mb, handle->wavefront_size);
+
+    rocsparse_dispatch_value(wfsize, bsrmvn_small_wfsizes{}, [&](auto wf) {
+        constexpr unsigned int WFSIZE = decltype(wf)::value;
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
         {
-            hipLaunchKernelGGL((bsrmvn_2x2_kernel_device_pointer<T, BSRMVN_DIM, 32>),
-                               dim3((mb - 1) / (BSRMVN_DIM / 32) + 1),
+            hipLaunchKernelGGL((bsrmvn_2x2_kernel_device_pointer<T, U, BSRMVN_DIM, WFSIZE>),
+                               dim3((mb - 1) / (BSRMVN_DIM / WFSIZE) + 1),
                                dim3(BSRMVN_DIM),
                                0,
                                handle->stream,
@@ -193,159 +142,62 @@ static void bsrmvn_2x2(rocsparse_handle     handle,
                                y,
                                base);
         }
-        else
+        else if(*alpha != static_cast<T>(0) || *beta != static_cast<T>(1))
         {
-            hipLaunchKernelGGL((bsrmvn_2x2_kernel_device_pointer<T, BSRMVN_DIM, 64>),
-                               dim3((mb - 1) / (BSRMVN_DIM / 64) + 1),
+            hipLaunchKernelGGL((bsrmvn_2x2_kernel_host_pointer<T, U, BSRMVN_DIM, WFSIZE>),
+                               dim3((mb - 1) / (BSRMVN_DIM / WFSIZE) + 1),
                                dim3(BSRMVN_DIM),
                                0,
                                handle->stream,
                                mb,
                                dir,
-                               alpha,
+                               *alpha,
                                bsr_row_ptr,
                                bsr_col_ind,
                                bsr_val,
                                x,
-                               beta,
+                               *beta,
                                y,
                                base);
         }
-    }
-    else
-    {
-        if(*alpha != static_cast<T>(0) || *beta != static_cast<T>(1))
-        {
-            if(blocks_per_row < 8)
-            {
-                hipLaunchKernelGGL((bsrmvn_2x2_kernel_host_pointer<T, BSRMVN_DIM, 4>),
-                                   dim3((mb - 1) / (BSRMVN_DIM / 4) + 1),
-                                   dim3(BSRMVN_DIM),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            }
-            else if(blocks_per_row < 16)
-            {
-                hipLaunchKernelGGL((bsrmvn_2x2_kernel_host_pointer<T, BSRMVN_DIM, 8>),
-                                   dim3((mb - 1) / (BSRMVN_DIM / 8) + 1),
-                                   dim3(BSRMVN_DIM),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            }
-            else if(blocks_per_row < 32)
-            {
-                hipLaunchKernelGGL((bsrmvn_2x2_kernel_host_pointer<T, BSRMVN_DIM, 16>),
-                                   dim3((mb - 1) / (BSRMVN_DIM / 16) + 1),
-                                   dim3(BSRMVN_DIM),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            }
-            else if(blocks_per_row < 64)
-            {
-                hipLaunchKernelGGL((bsrmvn_2x2_kernel_host_pointer<T, BSRMVN_DIM, 32>),
-                                   dim3((mb - 1) / (BSRMVN_DIM / 32) + 1),
-                                   dim3(BSRMVN_DIM),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            }
-            else
-            {
-                hipLaunchKernelGGL((bsrmvn_2x2_kernel_host_pointer<T, BSRMVN_DIM, 64>),
-                                   dim3((mb - 1) / (BSRMVN_DIM / 64) + 1),
-                                   dim3(BSRMVN_DIM),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            }
-        }
-    }
-#undef BSRMVN_DIM
+    });
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WFSIZE>
 __launch_bounds__(BLOCKSIZE) __global__
     void bsrmvn_3x3_kernel_host_pointer(rocsparse_int       mb,
                                         rocsparse_direction dir,
                                         T                   alpha,
                                         const rocsparse_int* __restrict__ bsr_row_ptr,
                                         const rocsparse_int* __restrict__ bsr_col_ind,
-                                        const T* __restrict__ bsr_val,
+                                        const U* __restrict__ bsr_val,
                                         const T* __restrict__ x,
                                         T beta,
                                         T* __restrict__ y,
                                         rocsparse_index_base idx_base)
 {
-    bsrmvn_3x3_device<T, BLOCKSIZE, WFSIZE>(
+    bsrmvn_3x3_device<T, U, BLOCKSIZE, WFSIZE>(
         mb, dir, alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, beta, y, idx_base);
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WFSIZE>
 __launch_bounds__(BLOCKSIZE) __global__
     void bsrmvn_3x3_kernel_device_pointer(rocsparse_int       mb,
                                           rocsparse_direction dir,
                                           const T*            alpha,
                                           const rocsparse_int* __restrict__ bsr_row_ptr,
                                           const rocsparse_int* __restrict__ bsr_col_ind,
-                                          const T* __restrict__ bsr_val,
+                                          const U* __restrict__ bsr_val,
                                           const T* __restrict__ x,
                                           const T* beta,
                                           T* __restrict__ y,
                                           rocsparse_index_base idx_base)
 {
-    bsrmvn_3x3_device<T, BLOCKSIZE, WFSIZE>(
+    bsrmvn_3x3_device<T, U, BLOCKSIZE, WFSIZE>(
         mb, dir, *alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, *beta, y, idx_base);
 }
 
-template <typename T>
+template <typename T, typename U>
 static void bsrmvn_3x3(rocsparse_handle     handle,
                        rocsparse_direction  dir,
                        rocsparse_int        mb,
@@ -353,75 +205,23 @@ static void bsrmvn_3x3(rocsparse_handle     handle,
                        const T*             alpha,
                        const rocsparse_int* bsr_row_ptr,
                        const rocsparse_int* bsr_col_ind,
-                       const T*             bsr_val,
+                       const U*             bsr_val,
                        const T*             x,
                        const T*             beta,
                        T*                   y,
                        rocsparse_index_base base)
 {
-    rocsparse_int blocks_per_row = nnzb / mb;
+    static constexpr unsigned int BSRMVN_DIM = 256;
 
-#define BSRMVN_DIM 256
-    if(handle->pointer_mode == rocsparse_pointer_mode_device)
-    {
-        if(blocks_per_row < 8)
-        {
-            hipLaunchKernelGGL((bsrmvn_3x3_kernel_device_pointer<T, BSRMVN_DIM, 4>),
-                               dim3((mb - 1) / (BSRMVN_DIM / 4) + 1),
-                               dim3(BSRMVN_DIM),
-                               0,
-                               handle->stream,
-                               mb,
-                               dir,
-                               alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               beta,
-                               y,
-                               base);
-        }
-        else if(blocks_per_row < 16)
-        {
-            hipLaunchKernelGGL((bsrmvn_3x3_kernel_device_pointer<T, BSRMVN_DIM, 8>),
-                               dim3((mb - 1) / (BSRMVN_DIM / 8) + 1),
-                               dim3(BSRMVN_DIM),
-                               0,
-                               handle->stream,
-                               mb,
-                               dir,
-                               alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               beta,
-                               y,
-                               base);
-        }
-        else if(blocks_per_row < 32)
-        {
-            hipLaunchKernelGGL((bsrmvn_3x3_kernel_device_pointer<T, BSRMVN_DIM, 16>),
-                               dim3((mb - 1) / (BSRMVN_DIM / 16) + 1),
-                               dim3(BSRMVN_DIM),
-                               0,
-                               handle->stream,
-                               mb,
-                               dir,
-                               alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               beta,
-                               y,
-                               base);
-        }
-        else if(blocks_per_row < 64)
+    rocsparse_int wfsize = bsrmvn_small_wfsize(nnzb / mb, handle->wavefront_size);
+
+    rocsparse_dispatch_value(wfsize, bsrmvn_small_wfsizes{}, [&](auto wf) {
+        constexpr unsigned int WFSIZE = decltype(wf)::value;
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
         {
-            hipLaunchKernelGGL((bsrmvn_3x3_kernel_device_pointer<T, BSRMVN_DIM, 32>),
-                               dim3((mb - 1) / (BSRMVN_DIM / 32) + 1),
+            hipLaunchKernelGGL((bsrmvn_3x3_kernel_device_pointer<T, U, BSRMVN_DIM, WFSIZE>),
+                               dim3((mb - 1) / (BSRMVN_DIM / WFSIZE) + 1),
                                dim3(BSRMVN_DIM),
                                0,
                                handle->stream,
@@ -436,159 +236,62 @@ static void bsrmvn_3x3(rocsparse_handle     handle,
                                y,
                                base);
         }
-        else
+        else if(*alpha != static_cast<T>(0) || *beta != static_cast<T>(1))
         {
-            hipLaunchKernelGGL((bsrmvn_3x3_kernel_device_pointer<T, BSRMVN_DIM, 64>),
-                               dim3((mb - 1) / (BSRMVN_DIM / 64) + 1),
+            hipLaunchKernelGGL((bsrmvn_3x3_kernel_host_pointer<T, U, BSRMVN_DIM, WFSIZE>),
+                               dim3((mb - 1) / (BSRMVN_DIM / WFSIZE) + 1),
                                dim3(BSRMVN_DIM),
                                0,
                                handle->stream,
                                mb,
                                dir,
-                               alpha,
+                               *alpha,
                                bsr_row_ptr,
                                bsr_col_ind,
                                bsr_val,
                                x,
-                               beta,
+                               *beta,
                                y,
                                base);
         }
-    }
-    else
-    {
-        if(*alpha != static_cast<T>(0) || *beta != static_cast<T>(1))
-        {
-            if(blocks_per_row <= 4)
-            {
-                hipLaunchKernelGGL((bsrmvn_3x3_kernel_host_pointer<T, BSRMVN_DIM, 4>),
-                                   dim3((mb - 1) / (BSRMVN_DIM / 4) + 1),
-                                   dim3(BSRMVN_DIM),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            }
-            else if(blocks_per_row <= 8)
-            {
-                hipLaunchKernelGGL((bsrmvn_3x3_kernel_host_pointer<T, BSRMVN_DIM, 8>),
-                                   dim3((mb - 1) / (BSRMVN_DIM / 8) + 1),
-                                   dim3(BSRMVN_DIM),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            }
-            else if(blocks_per_row <= 16)
-            {
-                hipLaunchKernelGGL((bsrmvn_3x3_kernel_host_pointer<T, BSRMVN_DIM, 16>),
-                                   dim3((mb - 1) / (BSRMVN_DIM / 16) + 1),
-                                   dim3(BSRMVN_DIM),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            }
-            else if(blocks_per_row <= 32)
-            {
-                hipLaunchKernelGGL((bsrmvn_3x3_kernel_host_pointer<T, BSRMVN_DIM, 32>),
-                                   dim3((mb - 1) / (BSRMVN_DIM / 32) + 1),
-                                   dim3(BSRMVN_DIM),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            }
-            else
-            {
-                hipLaunchKernelGGL((bsrmvn_3x3_kernel_host_pointer<T, BSRMVN_DIM, 64>),
-                                   dim3((mb - 1) / (BSRMVN_DIM / 64) + 1),
-                                   dim3(BSRMVN_DIM),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            }
-        }
-    }
-#undef BSRMVN_DIM
+    });
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WFSIZE>
 __launch_bounds__(BLOCKSIZE) __global__
     void bsrmvn_4x4_kernel_host_pointer(rocsparse_int       mb,
                                         rocsparse_direction dir,
                                         T                   alpha,
                                         const rocsparse_int* __restrict__ bsr_row_ptr,
                                         const rocsparse_int* __restrict__ bsr_col_ind,
-                                        const T* __restrict__ bsr_val,
+                                        const U* __restrict__ bsr_val,
                                         const T* __restrict__ x,
                                         T beta,
                                         T* __restrict__ y,
                                         rocsparse_index_base idx_base)
 {
-    bsrmvn_4x4_device<T, BLOCKSIZE, WFSIZE>(
+    bsrmvn_4x4_device<T, U, BLOCKSIZE, WFSIZE>(
         mb, dir, alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, beta, y, idx_base);
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WFSIZE>
 __launch_bounds__(BLOCKSIZE) __global__
     void bsrmvn_4x4_kernel_device_pointer(rocsparse_int       mb,
                                           rocsparse_direction dir,
                                           const T*            alpha,
                                           const rocsparse_int* __restrict__ bsr_row_ptr,
                                           const rocsparse_int* __restrict__ bsr_col_ind,
-                                          const T* __restrict__ bsr_val,
+                                          const U* __restrict__ bsr_val,
                                           const T* __restrict__ x,
                                           const T* beta,
                                           T* __restrict__ y,
                                           rocsparse_index_base idx_base)
 {
-    bsrmvn_4x4_device<T, BLOCKSIZE, WFSIZE>(
+    bsrmvn_4x4_device<T, U, BLOCKSIZE, WFSIZE>(
         mb, dir, *alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, *beta, y, idx_base);
 }
 
-template <typename T>
+template <typename T, typename U>
 static void bsrmvn_4x4(rocsparse_handle     handle,
                        rocsparse_direction  dir,
                        rocsparse_int        mb,
@@ -596,75 +299,23 @@ static void bsrmvn_4x4(rocsparse_handle     handle,
                        const T*             alpha,
                        const rocsparse_int* bsr_row_ptr,
                        const rocsparse_int* bsr_col_ind,
-                       const T*             bsr_val,
+                       const U*             bsr_val,
                        const T*             x,
                        const T*             beta,
                        T*                   y,
                        rocsparse_index_base base)
 {
-    rocsparse_int blocks_per_row = nnzb / mb;
+    static constexpr unsigned int BSRMVN_DIM = 128;
 
-#define BSRMVN_DIM 128
-    if(handle->pointer_mode == rocsparse_pointer_mode_device)
-    {
-        if(blocks_per_row < 8)
-        {
-            hipLaunchKernelGGL((bsrmvn_4x4_kernel_device_pointer<T, BSRMVN_DIM, 4>),
-                               dim3((mb - 1) / (BSRMVN_DIM / 4) + 1),
-                               dim3(BSRMVN_DIM),
-                               0,
-                               handle->stream,
-                               mb,
-                               dir,
-                               alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               beta,
-                               y,
-                               base);
-        }
-        else if(blocks_per_row < 16)
-        {
-            hipLaunchKernelGGL((bsrmvn_4x4_kernel_device_pointer<T, BSRMVN_DIM, 8>),
-                               dim3((mb - 1) / (BSRMVN_DIM / 8) + 1),
-                               dim3(BSRMVN_DIM),
-                               0,
-                               handle->stream,
-                               mb,
-                               dir,
-                               alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               beta,
-                               y,
-                               base);
-        }
-        else if(blocks_per_row < 32)
-        {
-            hipLaunchKernelGGL((bsrmvn_4x4_kernel_device_pointer<T, BSRMVN_DIM, 16>),
-                               dim3((mb - 1) / (BSRMVN_DIM / 16) + 1),
-                               dim3(BSRMVN_DIM),
-                               0,
-                               handle->stream,
-                               mb,
-                               dir,
-                               alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               beta,
-                               y,
-                               base);
-        }
-        else if(blocks_per_row < 64)
+    rocsparse_int wfsize = bsrmvn_small_wfsize(nnzb / mb, handle->wavefront_size);
+
+    rocsparse_dispatch_value(wfsize, bsrmvn_small_wfsizes{}, [&](auto wf) {
+        constexpr unsigned int WFSIZE = decltype(wf)::value;
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
         {
-            hipLaunchKernelGGL((bsrmvn_4x4_kernel_device_pointer<T, BSRMVN_DIM, 32>),
-                               dim3((mb - 1) / (BSRMVN_DIM / 32) + 1),
+            hipLaunchKernelGGL((bsrmvn_4x4_kernel_device_pointer<T, U, BSRMVN_DIM, WFSIZE>),
+                               dim3((mb - 1) / (BSRMVN_DIM / WFSIZE) + 1),
                                dim3(BSRMVN_DIM),
                                0,
                                handle->stream,
@@ -679,177 +330,81 @@ static void bsrmvn_4x4(rocsparse_handle     handle,
                                y,
                                base);
         }
-        else
+        else if(*alpha != static_cast<T>(0) || *beta != static_cast<T>(1))
         {
-            hipLaunchKernelGGL((bsrmvn_4x4_kernel_device_pointer<T, BSRMVN_DIM, 64>),
-                               dim3((mb - 1) / (BSRMVN_DIM / 64) + 1),
+            hipLaunchKernelGGL((bsrmvn_4x4_kernel_host_pointer<T, U, BSRMVN_DIM, WFSIZE>),
+                               dim3((mb - 1) / (BSRMVN_DIM / WFSIZE) + 1),
                                dim3(BSRMVN_DIM),
                                0,
                                handle->stream,
                                mb,
                                dir,
-                               alpha,
+                               *alpha,
                                bsr_row_ptr,
                                bsr_col_ind,
                                bsr_val,
                                x,
-                               beta,
+                               *beta,
                                y,
                                base);
         }
-    }
-    else
-    {
-        if(*alpha != static_cast<T>(0) || *beta != static_cast<T>(1))
-        {
-            if(blocks_per_row < 8)
-            {
-                hipLaunchKernelGGL((bsrmvn_4x4_kernel_host_pointer<T, BSRMVN_DIM, 4>),
-                                   dim3((mb - 1) / (BSRMVN_DIM / 4) + 1),
-                                   dim3(BSRMVN_DIM),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            }
-            else if(blocks_per_row < 16)
-            {
-                hipLaunchKernelGGL((bsrmvn_4x4_kernel_host_pointer<T, BSRMVN_DIM, 8>),
-                                   dim3((mb - 1) / (BSRMVN_DIM / 8) + 1),
-                                   dim3(BSRMVN_DIM),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            }
-            else if(blocks_per_row < 32)
-            {
-                hipLaunchKernelGGL((bsrmvn_4x4_kernel_host_pointer<T, BSRMVN_DIM, 16>),
-                                   dim3((mb - 1) / (BSRMVN_DIM / 16) + 1),
-                                   dim3(BSRMVN_DIM),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            }
-            else if(blocks_per_row < 64)
-            {
-                hipLaunchKernelGGL((bsrmvn_4x4_kernel_host_pointer<T, BSRMVN_DIM, 32>),
-                                   dim3((mb - 1) / (BSRMVN_DIM / 32) + 1),
-                                   dim3(BSRMVN_DIM),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            }
-            else
-            {
-                hipLaunchKernelGGL((bsrmvn_4x4_kernel_host_pointer<T, BSRMVN_DIM, 64>),
-                                   dim3((mb - 1) / (BSRMVN_DIM / 64) + 1),
-                                   dim3(BSRMVN_DIM),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            }
-        }
-    }
-#undef BSRMVN_DIM
+    });
 }
 
-template <typename T, unsigned int BLOCKSIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE>
 __launch_bounds__(BLOCKSIZE) __global__
     void bsrmvn_5x5_kernel_host_pointer(rocsparse_int       mb,
                                         rocsparse_direction dir,
                                         T                   alpha,
                                         const rocsparse_int* __restrict__ bsr_row_ptr,
                                         const rocsparse_int* __restrict__ bsr_col_ind,
-                                        const T* __restrict__ bsr_val,
+                                        const U* __restrict__ bsr_val,
                                         const T* __restrict__ x,
                                         T beta,
                                         T* __restrict__ y,
                                         rocsparse_index_base idx_base)
 {
-    bsrmvn_5x5_device<T, BLOCKSIZE>(
+    bsrmvn_5x5_device<T, U, BLOCKSIZE>(
         mb, dir, alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, beta, y, idx_base);
 }
 
-template <typename T, unsigned int BLOCKSIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE>
 __launch_bounds__(BLOCKSIZE) __global__
     void bsrmvn_5x5_kernel_device_pointer(rocsparse_int       mb,
                                           rocsparse_direction dir,
                                           const T*            alpha,
                                           const rocsparse_int* __restrict__ bsr_row_ptr,
                                           const rocsparse_int* __restrict__ bsr_col_ind,
-                                          const T* __restrict__ bsr_val,
+                                          const U* __restrict__ bsr_val,
                                           const T* __restrict__ x,
                                           const T* beta,
                                           T* __restrict__ y,
                                           rocsparse_index_base idx_base)
 {
-    bsrmvn_5x5_device<T, BLOCKSIZE>(
+    bsrmvn_5x5_device<T, U, BLOCKSIZE>(
         mb, dir, *alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, *beta, y, idx_base);
 }
 
-template <typename T>
+template <typename T, typename U>
 static void bsrmvn_5x5(rocsparse_handle     handle,
                        rocsparse_direction  dir,
                        rocsparse_int        mb,
-                       rocsparse_int        nnzb,
                        const T*             alpha,
                        const rocsparse_int* bsr_row_ptr,
                        const rocsparse_int* bsr_col_ind,
-                       const T*             bsr_val,
+                       const U*             bsr_val,
                        const T*             x,
                        const T*             beta,
                        T*                   y,
                        rocsparse_index_base base)
 {
+    static constexpr unsigned int BSRMVN_DIM = 50;
+
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
-        hipLaunchKernelGGL((bsrmvn_5x5_kernel_device_pointer<T, 50>),
+        hipLaunchKernelGGL((bsrmvn_5x5_kernel_device_pointer<T, U, BSRMVN_DIM>),
                            dim3(mb),
-                           dim3(50),
+                           dim3(BSRMVN_DIM),
                            0,
                            handle->stream,
                            mb,
@@ -863,82 +418,80 @@ static void bsrmvn_5x5(rocsparse_handle     handle,
                            y,
                            base);
     }
-    else
+    else if(*alpha != static_cast<T>(0) || *beta != static_cast<T>(1))
     {
-        if(*alpha != static_cast<T>(0) || *beta != static_cast<T>(1))
-        {
-            hipLaunchKernelGGL((bsrmvn_5x5_kernel_host_pointer<T, 50>),
-                               dim3(mb),
-                               dim3(50),
-                               0,
-                               handle->stream,
-                               mb,
-                               dir,
-                               *alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               *beta,
-                               y,
-                               base);
-        }
+        hipLaunchKernelGGL((bsrmvn_5x5_kernel_host_pointer<T, U, BSRMVN_DIM>),
+                           dim3(mb),
+                           dim3(BSRMVN_DIM),
+                           0,
+                           handle->stream,
+                           mb,
+                           dir,
+                           *alpha,
+                           bsr_row_ptr,
+                           bsr_col_ind,
+                           bsr_val,
+                           x,
+                           *beta,
+                           y,
+                           base);
     }
 }
 
-template <typename T, unsigned int BLOCKSIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE>
 __launch_bounds__(BLOCKSIZE) __global__
     void bsrmvn_8x8_kernel_host_pointer(rocsparse_int       mb,
                                         rocsparse_direction dir,
                                         T                   alpha,
                                         const rocsparse_int* __restrict__ bsr_row_ptr,
                                         const rocsparse_int* __restrict__ bsr_col_ind,
-                                        const T* __restrict__ bsr_val,
+                                        const U* __restrict__ bsr_val,
                                         const T* __restrict__ x,
                                         T beta,
                                         T* __restrict__ y,
                                         rocsparse_index_base idx_base)
 {
-    bsrmvn_8x8_device<T, BLOCKSIZE>(
+    bsrmvn_8x8_device<T, U, BLOCKSIZE>(
         mb, dir, alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, beta, y, idx_base);
 }
 
-template <typename T, unsigned int BLOCKSIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE>
 __launch_bounds__(BLOCKSIZE) __global__
     void bsrmvn_8x8_kernel_device_pointer(rocsparse_int       mb,
                                           rocsparse_direction dir,
                                           const T*            alpha,
                                           const rocsparse_int* __restrict__ bsr_row_ptr,
                                           const rocsparse_int* __restrict__ bsr_col_ind,
-                                          const T* __restrict__ bsr_val,
+                                          const U* __restrict__ bsr_val,
                                           const T* __restrict__ x,
                                           const T* beta,
                                           T* __restrict__ y,
                                           rocsparse_index_base idx_base)
 {
-    bsrmvn_8x8_device<T, BLOCKSIZE>(
+    bsrmvn_8x8_device<T, U, BLOCKSIZE>(
         mb, dir, *alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, *beta, y, idx_base);
 }
 
-template <typename T>
+template <typename T, typename U>
 static void bsrmvn_8x8(rocsparse_handle     handle,
                        rocsparse_direction  dir,
                        rocsparse_int        mb,
-                       rocsparse_int        nnzb,
                        const T*             alpha,
                        const rocsparse_int* bsr_row_ptr,
                        const rocsparse_int* bsr_col_ind,
-                       const T*             bsr_val,
+                       const U*             bsr_val,
                        const T*             x,
                        const T*             beta,
                        T*                   y,
                        rocsparse_index_base base)
 {
+    static constexpr unsigned int BSRMVN_DIM = 128;
+
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
-        hipLaunchKernelGGL((bsrmvn_8x8_kernel_device_pointer<T, 128>),
+        hipLaunchKernelGGL((bsrmvn_8x8_kernel_device_pointer<T, U, BSRMVN_DIM>),
                            dim3(mb),
-                           dim3(128),
+                           dim3(BSRMVN_DIM),
                            0,
                            handle->stream,
                            mb,
@@ -952,82 +505,80 @@ static void bsrmvn_8x8(rocsparse_handle     handle,
                            y,
                            base);
     }
-    else
+    else if(*alpha != static_cast<T>(0) || *beta != static_cast<T>(1))
     {
-        if(*alpha != static_cast<T>(0) || *beta != static_cast<T>(1))
-        {
-            hipLaunchKernelGGL((bsrmvn_8x8_kernel_host_pointer<T, 128>),
-                               dim3(mb),
-                               dim3(128),
-                               0,
-                               handle->stream,
-                               mb,
-                               dir,
-                               *alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               *beta,
-                               y,
-                               base);
-        }
-    }
-}
-
-template <typename T, unsigned int BLOCKSIZE>
+        hipLaunchKernelGGL((bsrmvn_8x8_kernel_host_pointer<T, U, BSRMVN_DIM>),
+                           dim3(mb),
+                           dim3(BSRMVN_DIM),
+                           0,
+                           handle->stream,
+                           mb,
+                           dir,
+                           *alpha,
+                           bsr_row_ptr,
+                           bsr_col_ind,
+                           bsr_val,
+                           x,
+                           *beta,
+                           y,
+                           base);
+    }
+}
+
+template <typename T, typename U, unsigned int BLOCKSIZE>
 __launch_bounds__(BLOCKSIZE) __global__
     void bsrmvn_16x16_kernel_host_pointer(rocsparse_int       mb,
                                           rocsparse_direction dir,
                                           T                   alpha,
                                           const rocsparse_int* __restrict__ bsr_row_ptr,
                                           const rocsparse_int* __restrict__ bsr_col_ind,
-                                          const T* __restrict__ bsr_val,
+                                          const U* __restrict__ bsr_val,
                                           const T* __restrict__ x,
                                           T beta,
                                           T* __restrict__ y,
                                           rocsparse_index_base idx_base)
 {
-    bsrmvn_16x16_device<T, BLOCKSIZE>(
+    bsrmvn_16x16_device<T, U, BLOCKSIZE>(
         mb, dir, alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, beta, y, idx_base);
 }
 
-template <typename T, unsigned int BLOCKSIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE>
 __launch_bounds__(BLOCKSIZE) __global__
     void bsrmvn_16x16_kernel_device_pointer(rocsparse_int       mb,
                                             rocsparse_direction dir,
                                             const T*            alpha,
                                             const rocsparse_int* __restrict__ bsr_row_ptr,
                                             const rocsparse_int* __restrict__ bsr_col_ind,
-                                            const T* __restrict__ bsr_val,
+                                            const U* __restrict__ bsr_val,
                                             const T* __restrict__ x,
                                             const T* beta,
                                             T* __restrict__ y,
                                             rocsparse_index_base idx_base)
 {
-    bsrmvn_16x16_device<T, BLOCKSIZE>(
+    bsrmvn_16x16_device<T, U, BLOCKSIZE>(
         mb, dir, *alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, *beta, y, idx_base);
 }
 
-template <typename T>
+template <typename T, typename U>
 static void bsrmvn_16x16(rocsparse_handle     handle,
                          rocsparse_direction  dir,
                          rocsparse_int        mb,
-                         rocsparse_int        nnzb,
                          const T*             alpha,
                          const rocsparse_int* bsr_row_ptr,
                          const rocsparse_int* bsr_col_ind,
-                         const T*             bsr_val,
+                         const U*             bsr_val,
                          const T*             x,
                          const T*             beta,
                          T*                   y,
                          rocsparse_index_base base)
 {
+    static constexpr unsigned int BSRMVN_DIM = 256;
+
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
-        hipLaunchKernelGGL((bsrmvn_16x16_kernel_device_pointer<T, 256>),
+        hipLaunchKernelGGL((bsrmvn_16x16_kernel_device_pointer<T, U, BSRMVN_DIM>),
                            dim3(mb),
-                           dim3(256),
+                           dim3(BSRMVN_DIM),
                            0,
                            handle->stream,
                            mb,
@@ -1041,101 +592,89 @@ static void bsrmvn_16x16(rocsparse_handle     handle,
                            y,
                            base);
     }
-    else
+    else if(*alpha != static_cast<T>(0) || *beta != static_cast<T>(1))
     {
-        if(*alpha != static_cast<T>(0) || *beta != static_cast<T>(1))
-        {
-            hipLaunchKernelGGL((bsrmvn_16x16_kernel_host_pointer<T, 256>),
-                               dim3(mb),
-                               dim3(256),
-                               0,
-                               handle->stream,
-                               mb,
-                               dir,
-                               *alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               *beta,
-                               y,
-                               base);
-        }
+        hipLaunchKernelGGL((bsrmvn_16x16_kernel_host_pointer<T, U, BSRMVN_DIM>),
+                           dim3(mb),
+                           dim3(BSRMVN_DIM),
+                           0,
+                           handle->stream,
+                           mb,
+                           dir,
+                           *alpha,
+                           bsr_row_ptr,
+                           bsr_col_ind,
+                           bsr_val,
+                           x,
+                           *beta,
+                           y,
+                           base);
     }
 }
 
 // Kernels for BSR block dimensions of 17 to 32
-template <typename T, unsigned int BSRDIM>
+template <typename T, typename U, unsigned int BSRDIM>
 __launch_bounds__(BSRDIM* BSRDIM) __global__
     void bsrmvn_17_32_kernel_host_pointer(rocsparse_int       mb,
                                           rocsparse_direction dir,
                                           T                   alpha,
                                           const rocsparse_int* __restrict__ bsr_row_ptr,
                                           const rocsparse_int* __restrict__ bsr_col_ind,
-                                          const T* __restrict__ bsr_val,
+                                          const U* __restrict__ bsr_val,
                                           const T* __restrict__ x,
                                           T beta,
                                           T* __restrict__ y,
                                           rocsparse_index_base idx_base)
 {
-    bsrmvn_17_32_device<T, BSRDIM>(
+    bsrmvn_17_32_device<T, U, BSRDIM>(
         mb, dir, alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, beta, y, idx_base);
 }
 
-template <typename T, unsigned int BSRDIM>
+template <typename T, typename U, unsigned int BSRDIM>
 __launch_bounds__(BSRDIM* BSRDIM) __global__
     void bsrmvn_17_32_kernel_device_pointer(rocsparse_int       mb,
                                             rocsparse_direction dir,
                                             const T*            alpha,
                                             const rocsparse_int* __restrict__ bsr_row_ptr,
                                             const rocsparse_int* __restrict__ bsr_col_ind,
-                                            const T* __restrict__ bsr_val,
+                                            const U* __restrict__ bsr_val,
                                             const T* __restrict__ x,
                                             const T* beta,
                                             T* __restrict__ y,
                                             rocsparse_index_base idx_base)
 {
-    bsrmvn_17_32_device<T, BSRDIM>(
+    bsrmvn_17_32_device<T, U, BSRDIM>(
         mb, dir, *alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, *beta, y, idx_base);
 }
 
-template <typename T>
+// BSR block dimensions with a dedicated instantiation of the 17 to 32 kernel
+// clang-format off
+using bsrmvn_17_32_dims = rocsparse_value_list<17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28,
+                                               29, 30, 31, 32>;
+// clang-format on
+
+template <typename T, typename U>
 static void bsrmvn_17_32(rocsparse_handle     handle,
                          rocsparse_direction  dir,
                          rocsparse_int        mb,
-                         rocsparse_int        nnzb,
                          const T*             alpha,
                          const rocsparse_int* bsr_row_ptr,
                          const rocsparse_int* bsr_col_ind,
-                         const T*             bsr_val,
+                         const U*             bsr_val,
                          rocsparse_int        bsr_dim,
                          const T*             x,
                          const T*             beta,
                          T*                   y,
                          rocsparse_index_base base)
 {
-    if(handle->pointer_mode == rocsparse_pointer_mode_device)
-    {
-        if(bsr_dim == 17)
-            hipLaunchKernelGGL((bsrmvn_17_32_kernel_device_pointer<T, 17>),
-                               dim3(mb),
-                               dim3(17 * 17),
-                               0,
-                               handle->stream,
-                               mb,
-                               dir,
-                               alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               beta,
-                               y,
-                               base);
-        else if(bsr_dim == 18)
-            hipLaunchKernelGGL((bsrmvn_17_32_kernel_device_pointer<T, 18>),
+    rocsparse_dispatch_value(bsr_dim, bsrmvn_17_32_dims{}, [&](auto dim) {
+        constexpr unsigned int BSRDIM = decltype(dim)::value;
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((bsrmvn_17_32_kernel_device_pointer<T, U, BSRDIM>),
                                dim3(mb),
-                               dim3(18 * 18),
+                               dim3(BSRDIM * BSRDIM),
                                0,
                                handle->stream,
                                mb,
@@ -1148,26 +687,98 @@ static void bsrmvn_17_32(rocsparse_handle     handle,
                                beta,
                                y,
                                base);
-        else if(bsr_dim == 19)
-            hipLaunchKernelGGL((bsrmvn_17_32_kernel_device_pointer<T, 19>),
+        }
+        else if(*alpha != static_cast<T>(0) || *beta != static_cast<T>(1))
+        {
+            hipLaunchKernelGGL((bsrmvn_17_32_kernel_host_pointer<T, U, BSRDIM>),
                                dim3(mb),
-                               dim3(19 * 19),
+                               dim3(BSRDIM * BSRDIM),
                                0,
                                handle->stream,
                                mb,
                                dir,
-                               alpha,
+                               *alpha,
                                bsr_row_ptr,
                                bsr_col_ind,
                                bsr_val,
                                x,
-                               beta,
+                               *beta,
                                y,
                                base);
-        else if(bsr_dim == 20)
-            hipLaunchKernelGGL((bsrmvn_17_32_kernel_device_pointer<T, 20>),
+        }
+    });
+}
+
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int BSRDIM>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrmvn_NxN_kernel_host_pointer(rocsparse_int       mb,
+                                        rocsparse_direction dir,
+                                        T                   alpha,
+                                        const rocsparse_int* __restrict__ bsr_row_ptr,
+                                        const rocsparse_int* __restrict__ bsr_col_ind,
+                                        const U* __restrict__ bsr_val,
+                                        const T* __restrict__ x,
+                                        T beta,
+                                        T* __restrict__ y,
+                                        rocsparse_index_base idx_base)
+{
+    bsrmvn_NxN_device<T, U, BLOCKSIZE, BSRDIM>(
+        mb, dir, alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, beta, y, idx_base);
+}
+
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int BSRDIM>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrmvn_NxN_kernel_device_pointer(rocsparse_int       mb,
+                                          rocsparse_direction dir,
+                                          const T*            alpha,
+                                          const rocsparse_int* __restrict__ bsr_row_ptr,
+                                          const rocsparse_int* __restrict__ bsr_col_ind,
+                                          const U* __restrict__ bsr_val,
+                                          const T* __restrict__ x,
+                                          const T* beta,
+                                          T* __restrict__ y,
+                                          rocsparse_index_base idx_base)
+{
+    bsrmvn_NxN_device<T, U, BLOCKSIZE, BSRDIM>(
+        mb, dir, *alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, *beta, y, idx_base);
+}
+
+// BSR block dimensions without a hand-tuned kernel, served by an instantiation of the
+// NxN kernel
+using bsrmvn_NxN_dims = rocsparse_value_list<6, 7, 9, 10, 11, 12, 13, 14, 15>;
+
+// Number of BSR blocks processed at the same time by a thread block of the kernels for
+// BSR block dimensions 5 to 32, i.e. the hand-tuned kernels and the NxN kernel
+static constexpr rocsparse_int bsrmvn_NxN_blocks(rocsparse_int bsr_dim)
+{
+    return (bsr_dim <= 8) ? 2 : 1;
+}
+
+template <typename T, typename U>
+static void bsrmvn_NxN(rocsparse_handle     handle,
+                       rocsparse_direction  dir,
+                       rocsparse_int        mb,
+                       const T*             alpha,
+                       const rocsparse_int* bsr_row_ptr,
+                       const rocsparse_int* bsr_col_ind,
+                       const U*             bsr_val,
+                       rocsparse_int        bsr_dim,
+                       const T*             x,
+                       const T*             beta,
+                       T*                   y,
+                       rocsparse_index_base base)
+{
+    rocsparse_dispatch_value(bsr_dim, bsrmvn_NxN_dims{}, [&](auto dim) {
+        constexpr unsigned int BSRDIM = decltype(dim)::value;
+
+        // Small blocks are processed in pairs, to keep the thread blocks busy
+        constexpr unsigned int BSRMVN_DIM = BSRDIM * BSRDIM * bsrmvn_NxN_blocks(BSRDIM);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((bsrmvn_NxN_kernel_device_pointer<T, U, BSRMVN_DIM, BSRDIM>),
                                dim3(mb),
-                               dim3(20 * 20),
+                               dim3(BSRMVN_DIM),
                                0,
                                handle->stream,
                                mb,
@@ -1180,601 +791,542 @@ static void bsrmvn_17_32(rocsparse_handle     handle,
                                beta,
                                y,
                                base);
-        else if(bsr_dim == 21)
-            hipLaunchKernelGGL((bsrmvn_17_32_kernel_device_pointer<T, 21>),
+        }
+        else if(*alpha != static_cast<T>(0) || *beta != static_cast<T>(1))
+        {
+            hipLaunchKernelGGL((bsrmvn_NxN_kernel_host_pointer<T, U, BSRMVN_DIM, BSRDIM>),
                                dim3(mb),
-                               dim3(21 * 21),
+                               dim3(BSRMVN_DIM),
                                0,
                                handle->stream,
                                mb,
                                dir,
-                               alpha,
+                               *alpha,
                                bsr_row_ptr,
                                bsr_col_ind,
                                bsr_val,
                                x,
-                               beta,
+                               *beta,
                                y,
                                base);
-        else if(bsr_dim == 22)
-            hipLaunchKernelGGL((bsrmvn_17_32_kernel_device_pointer<T, 22>),
-                               dim3(mb),
-                               dim3(22 * 22),
-                               0,
-                               handle->stream,
-                               mb,
+        }
+    });
+}
+
+template <typename T,
+          typename            U,
+          unsigned int        BLOCKSIZE,
+          unsigned int        WFSIZE,
+          unsigned int        TILE,
+          rocsparse_direction DIR>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrmvn_tiled_kernel_host_pointer(T alpha,
+                                          const rocsparse_int* __restrict__ bsr_row_ptr,
+                                          const rocsparse_int* __restrict__ bsr_col_ind,
+                                          const U* __restrict__ bsr_val,
+                                          rocsparse_int bsr_dim,
+                                          const T* __restrict__ x,
+                                          T beta,
+                                          T* __restrict__ y,
+                                          rocsparse_index_base idx_base)
+{
+    bsrmvn_tiled_device<T, U, BLOCKSIZE, WFSIZE, TILE, DIR>(
+        alpha, bsr_row_ptr, bsr_col_ind, bsr_val, bsr_dim, x, beta, y, idx_base);
+}
+
+template <typename T,
+          typename            U,
+          unsigned int        BLOCKSIZE,
+          unsigned int        WFSIZE,
+          unsigned int        TILE,
+          rocsparse_direction DIR>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrmvn_tiled_kernel_device_pointer(const T* alpha,
+                                            const rocsparse_int* __restrict__ bsr_row_ptr,
+                                            const rocsparse_int* __restrict__ bsr_col_ind,
+                                            const U* __restrict__ bsr_val,
+                                            rocsparse_int bsr_dim,
+                                            const T* __restrict__ x,
+                                            const T* beta,
+                                            T* __restrict__ y,
+                                            rocsparse_index_base idx_base)
+{
+    bsrmvn_tiled_device<T, U, BLOCKSIZE, WFSIZE, TILE, DIR>(
+        *alpha, bsr_row_ptr, bsr_col_ind, bsr_val, bsr_dim, x, *beta, y, idx_base);
+}
+
+// Register tile sizes of the tiled kernel, for row and column major BSR blocks
+using bsrmvn_tiled_row_tiles    = rocsparse_value_list<4, 8>;
+using bsrmvn_tiled_column_tiles = rocsparse_value_list<1, 2, 4>;
+
+// Rows of the BSR block per wavefront of the tiled kernel for row major blocks, such
+// that a single pass of the thread block covers the BSR block
+static inline rocsparse_int bsrmvn_tiled_row_tile(rocsparse_int bsr_dim, rocsparse_int nwf)
+{
+    return ((bsr_dim - 1) / nwf + 1 <= 4) ? 4 : 8;
+}
+
+// Rows of the BSR block per lane of the tiled kernel for column major blocks, such
+// that a single pass of the wavefront covers the BSR block
+static inline rocsparse_int bsrmvn_tiled_column_tile(rocsparse_int bsr_dim, rocsparse_int wfsize)
+{
+    rocsparse_int rows = (bsr_dim - 1) / wfsize + 1;
+
+    return (rows <= 1) ? 1 : ((rows <= 2) ? 2 : 4);
+}
+
+template <typename T, typename U, unsigned int WFSIZE, rocsparse_direction DIR, typename TILES>
+static void bsrmvn_tiled_dispatch(rocsparse_handle     handle,
+                                  rocsparse_int        mb,
+                                  const T*             alpha,
+                                  const rocsparse_int* bsr_row_ptr,
+                                  const rocsparse_int* bsr_col_ind,
+                                  const U*             bsr_val,
+                                  rocsparse_int        bsr_dim,
+                                  const T*             x,
+                                  const T*             beta,
+                                  T*                   y,
+                                  rocsparse_index_base base,
+                                  rocsparse_int        tile)
+{
+    rocsparse_dispatch_value(tile, TILES{}, [&](auto t) {
+        constexpr unsigned int TILE       = decltype(t)::value;
+        constexpr unsigned int BSRMVN_DIM = 256;
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL(
+                (bsrmvn_tiled_kernel_device_pointer<T, U, BSRMVN_DIM, WFSIZE, TILE, DIR>),
+                dim3(mb),
+                dim3(BSRMVN_DIM),
+                0,
+                handle->stream,
+                alpha,
+                bsr_row_ptr,
+                bsr_col_ind,
+                bsr_val,
+                bsr_dim,
+                x,
+                beta,
+                y,
+                base);
+        }
+        else if(*alpha != static_cast<T>(0) || *beta != static_cast<T>(1))
+        {
+            hipLaunchKernelGGL(
+                (bsrmvn_tiled_kernel_host_pointer<T, U, BSRMVN_DIM, WFSIZE, TILE, DIR>),
+                dim3(mb),
+                dim3(BSRMVN_DIM),
+                0,
+                handle->stream,
+                *alpha,
+                bsr_row_ptr,
+                bsr_col_ind,
+                bsr_val,
+                bsr_dim,
+                x,
+                *beta,
+                y,
+                base);
+        }
+    });
+}
+
+template <typename T, typename U, unsigned int WFSIZE>
+static void bsrmvn_tiled(rocsparse_handle     handle,
+                         rocsparse_direction  dir,
+                         rocsparse_int        mb,
+                         const T*             alpha,
+                         const rocsparse_int* bsr_row_ptr,
+                         const rocsparse_int* bsr_col_ind,
+                         const U*             bsr_val,
+                         rocsparse_int        bsr_dim,
+                         const T*             x,
+                         const T*             beta,
+                         T*                   y,
+                         rocsparse_index_base base)
+{
+    // Number of wavefronts per thread block of the tiled kernel
+    constexpr rocsparse_int NWF = 256 / WFSIZE;
+
+    if(dir == rocsparse_direction_row)
+    {
+        rocsparse_int tile = bsrmvn_tiled_row_tile(bsr_dim, NWF);
+
+        bsrmvn_tiled_dispatch<T, U, WFSIZE, rocsparse_direction_row, bsrmvn_tiled_row_tiles>(
+            handle, mb, alpha, bsr_row_ptr, bsr_col_ind, bsr_val, bsr_dim, x, beta, y, base, tile);
+    }
+    else
+    {
+        rocsparse_int tile = bsrmvn_tiled_column_tile(bsr_dim, WFSIZE);
+
+        bsrmvn_tiled_dispatch<T, U, WFSIZE, rocsparse_direction_column, bsrmvn_tiled_column_tiles>(
+            handle, mb, alpha, bsr_row_ptr, bsr_col_ind, bsr_val, bsr_dim, x, beta, y, base, tile);
+    }
+}
+
+template <typename T, typename U>
+static rocsparse_status bsrmvn_dispatch(rocsparse_handle          handle,
+                                        rocsparse_direction       dir,
+                                        rocsparse_int             mb,
+                                        rocsparse_int             nb,
+                                        rocsparse_int             nnzb,
+                                        const T*                  alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const U*                  bsr_val,
+                                        const rocsparse_int*      bsr_row_ptr,
+                                        const rocsparse_int*      bsr_col_ind,
+                                        rocsparse_int             bsr_dim,
+                                        const T*                  x,
+                                        const T*                  beta,
+                                        T*                        y)
+{
+    // bsr_dim == 1 is the CSR case
+    if(bsr_dim == 1)
+    {
+        return rocsparse_csrmv_template(handle,
+                                        rocsparse_operation_none,
+                                        mb,
+                                        nb,
+                                        nnzb,
+                                        alpha,
+                                        descr,
+                                        bsr_val,
+                                        bsr_row_ptr,
+                                        bsr_col_ind,
+                                        nullptr,
+                                        x,
+                                        beta,
+                                        y);
+    }
+
+    // Run different bsrmv kernels
+    if(bsr_dim == 2)
+    {
+        bsrmvn_2x2(handle,
+                   dir,
+                   mb,
+                   nnzb,
+                   alpha,
+                   bsr_row_ptr,
+                   bsr_col_ind,
+                   bsr_val,
+                   x,
+                   beta,
+                   y,
+                   descr->base);
+    }
+    else if(bsr_dim == 3)
+    {
+        bsrmvn_3x3(handle,
+                   dir,
+                   mb,
+                   nnzb,
+                   alpha,
+                   bsr_row_ptr,
+                   bsr_col_ind,
+                   bsr_val,
+                   x,
+                   beta,
+                   y,
+                   descr->base);
+    }
+    else if(bsr_dim == 4)
+    {
+        bsrmvn_4x4(handle,
+                   dir,
+                   mb,
+                   nnzb,
+                   alpha,
+                   bsr_row_ptr,
+                   bsr_col_ind,
+                   bsr_val,
+                   x,
+                   beta,
+                   y,
+                   descr->base);
+    }
+    else if(bsr_dim == 5)
+    {
+        bsrmvn_5x5(
+            handle, dir, mb, alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, beta, y, descr->base);
+    }
+    else if(bsr_dim == 8)
+    {
+        bsrmvn_8x8(
+            handle, dir, mb, alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, beta, y, descr->base);
+    }
+    else if(bsr_dim == 16)
+    {
+        bsrmvn_16x16(
+            handle, dir, mb, alpha, bsr_row_ptr, bsr_col_ind, bsr_val, x, beta, y, descr->base);
+    }
+    else if(bsr_dim > 16 && bsr_dim <= 32)
+    {
+        bsrmvn_17_32(handle,
+                     dir,
+                     mb,
+                     alpha,
+                     bsr_row_ptr,
+                     bsr_col_ind,
+                     bsr_val,
+                     bsr_dim,
+                     x,
+                     beta,
+                     y,
+                     descr->base);
+    }
+    else if(bsr_dim < 16)
+    {
+        bsrmvn_NxN(handle,
+                   dir,
+                   mb,
+                   alpha,
+                   bsr_row_ptr,
+                   bsr_col_ind,
+                   bsr_val,
+                   bsr_dim,
+                   x,
+                   beta,
+                   y,
+                   descr->base);
+    }
+    else if(handle->wavefront_size == 32)
+    {
+        bsrmvn_tiled<T, U, 32>(handle,
                                dir,
-                               alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               beta,
-                               y,
-                               base);
-        else if(bsr_dim == 23)
-            hipLaunchKernelGGL((bsrmvn_17_32_kernel_device_pointer<T, 23>),
-                               dim3(mb),
-                               dim3(23 * 23),
-                               0,
-                               handle->stream,
                                mb,
-                               dir,
                                alpha,
                                bsr_row_ptr,
                                bsr_col_ind,
                                bsr_val,
+                               bsr_dim,
                                x,
                                beta,
                                y,
-                               base);
-        else if(bsr_dim == 24)
-            hipLaunchKernelGGL((bsrmvn_17_32_kernel_device_pointer<T, 24>),
-                               dim3(mb),
-                               dim3(24 * 24),
-                               0,
-                               handle->stream,
-                               mb,
+                               descr->base);
+    }
+    else if(handle->wavefront_size == 64)
+    {
+        bsrmvn_tiled<T, U, 64>(handle,
                                dir,
-                               alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               beta,
-                               y,
-                               base);
-        else if(bsr_dim == 25)
-            hipLaunchKernelGGL((bsrmvn_17_32_kernel_device_pointer<T, 25>),
-                               dim3(mb),
-                               dim3(25 * 25),
-                               0,
-                               handle->stream,
                                mb,
-                               dir,
                                alpha,
                                bsr_row_ptr,
                                bsr_col_ind,
                                bsr_val,
+                               bsr_dim,
                                x,
                                beta,
                                y,
-                               base);
-        else if(bsr_dim == 26)
-            hipLaunchKernelGGL((bsrmvn_17_32_kernel_device_pointer<T, 26>),
-                               dim3(mb),
-                               dim3(26 * 26),
-                               0,
-                               handle->stream,
-                               mb,
-                               dir,
-                               alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               beta,
-                               y,
-                               base);
-        else if(bsr_dim == 27)
-            hipLaunchKernelGGL((bsrmvn_17_32_kernel_device_pointer<T, 27>),
-                               dim3(mb),
-                               dim3(27 * 27),
-                               0,
-                               handle->stream,
-                               mb,
-                               dir,
-                               alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               beta,
-                               y,
-                               base);
-        else if(bsr_dim == 28)
-            hipLaunchKernelGGL((bsrmvn_17_32_kernel_device_pointer<T, 28>),
-                               dim3(mb),
-                               dim3(28 * 28),
-                               0,
-                               handle->stream,
-                               mb,
-                               dir,
-                               alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               beta,
-                               y,
-                               base);
-        else if(bsr_dim == 29)
-            hipLaunchKernelGGL((bsrmvn_17_32_kernel_device_pointer<T, 29>),
-                               dim3(mb),
-                               dim3(29 * 29),
-                               0,
-                               handle->stream,
-                               mb,
-                               dir,
-                               alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               beta,
-                               y,
-                               base);
-        else if(bsr_dim == 30)
-            hipLaunchKernelGGL((bsrmvn_17_32_kernel_device_pointer<T, 30>),
-                               dim3(mb),
-                               dim3(30 * 30),
-                               0,
-                               handle->stream,
-                               mb,
-                               dir,
-                               alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               beta,
-                               y,
-                               base);
-        else if(bsr_dim == 31)
-            hipLaunchKernelGGL((bsrmvn_17_32_kernel_device_pointer<T, 31>),
-                               dim3(mb),
-                               dim3(31 * 31),
-                               0,
-                               handle->stream,
-                               mb,
-                               dir,
-                               alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               beta,
-                               y,
-                               base);
-        else if(bsr_dim == 32)
-            hipLaunchKernelGGL((bsrmvn_17_32_kernel_device_pointer<T, 32>),
-                               dim3(mb),
-                               dim3(32 * 32),
-                               0,
-                               handle->stream,
-                               mb,
-                               dir,
-                               alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               x,
-                               beta,
-                               y,
-                               base);
+                               descr->base);
     }
     else
     {
-        if(*alpha != static_cast<T>(0) || *beta != static_cast<T>(1))
-        {
-            if(bsr_dim == 17)
-                hipLaunchKernelGGL((bsrmvn_17_32_kernel_host_pointer<T, 17>),
-                                   dim3(mb),
-                                   dim3(17 * 17),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            else if(bsr_dim == 18)
-                hipLaunchKernelGGL((bsrmvn_17_32_kernel_host_pointer<T, 18>),
-                                   dim3(mb),
-                                   dim3(18 * 18),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            else if(bsr_dim == 19)
-                hipLaunchKernelGGL((bsrmvn_17_32_kernel_host_pointer<T, 19>),
-                                   dim3(mb),
-                                   dim3(19 * 19),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            else if(bsr_dim == 20)
-                hipLaunchKernelGGL((bsrmvn_17_32_kernel_host_pointer<T, 20>),
-                                   dim3(mb),
-                                   dim3(20 * 20),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            else if(bsr_dim == 21)
-                hipLaunchKernelGGL((bsrmvn_17_32_kernel_host_pointer<T, 21>),
-                                   dim3(mb),
-                                   dim3(21 * 21),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            else if(bsr_dim == 22)
-                hipLaunchKernelGGL((bsrmvn_17_32_kernel_host_pointer<T, 22>),
-                                   dim3(mb),
-                                   dim3(22 * 22),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            else if(bsr_dim == 23)
-                hipLaunchKernelGGL((bsrmvn_17_32_kernel_host_pointer<T, 23>),
-                                   dim3(mb),
-                                   dim3(23 * 23),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            else if(bsr_dim == 24)
-                hipLaunchKernelGGL((bsrmvn_17_32_kernel_host_pointer<T, 24>),
-                                   dim3(mb),
-                                   dim3(24 * 24),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            else if(bsr_dim == 25)
-                hipLaunchKernelGGL((bsrmvn_17_32_kernel_host_pointer<T, 25>),
-                                   dim3(mb),
-                                   dim3(25 * 25),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            else if(bsr_dim == 26)
-            {
-                hipLaunchKernelGGL((bsrmvn_17_32_kernel_host_pointer<T, 26>),
-                                   dim3(mb),
-                                   dim3(26 * 26),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            }
-            else if(bsr_dim == 27)
-                hipLaunchKernelGGL((bsrmvn_17_32_kernel_host_pointer<T, 27>),
-                                   dim3(mb),
-                                   dim3(27 * 27),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            else if(bsr_dim == 28)
-                hipLaunchKernelGGL((bsrmvn_17_32_kernel_host_pointer<T, 28>),
-                                   dim3(mb),
-                                   dim3(28 * 28),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            else if(bsr_dim == 29)
-                hipLaunchKernelGGL((bsrmvn_17_32_kernel_host_pointer<T, 29>),
-                                   dim3(mb),
-                                   dim3(29 * 29),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            else if(bsr_dim == 30)
-                hipLaunchKernelGGL((bsrmvn_17_32_kernel_host_pointer<T, 30>),
-                                   dim3(mb),
-                                   dim3(30 * 30),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            else if(bsr_dim == 31)
-                hipLaunchKernelGGL((bsrmvn_17_32_kernel_host_pointer<T, 31>),
-                                   dim3(mb),
-                                   dim3(31 * 31),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            else if(bsr_dim == 32)
-                hipLaunchKernelGGL((bsrmvn_17_32_kernel_host_pointer<T, 32>),
-                                   dim3(mb),
-                                   dim3(32 * 32),
-                                   0,
-                                   handle->stream,
-                                   mb,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-        }
+        return rocsparse_status_arch_mismatch;
     }
+
+    return rocsparse_status_success;
 }
 
-template <typename T>
-static void bsrmvn_general(rocsparse_handle     handle,
-                           rocsparse_direction  dir,
-                           rocsparse_int        mb,
-                           const T*             alpha,
-                           const rocsparse_int* bsr_row_ptr,
-                           const rocsparse_int* bsr_col_ind,
-                           const T*             bsr_val,
-                           rocsparse_int        bsr_dim,
-                           const T*             x,
-                           const T*             beta,
-                           T*                   y,
-                           rocsparse_index_base base)
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WF_SEGMENT_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrmv_atomic_kernel_host_pointer(rocsparse_int         mb,
+                                          rocsparse_direction   dir,
+                                          rocsparse_operation   trans,
+                                          rocsparse_matrix_type type,
+                                          rocsparse_fill_mode   fill_mode,
+                                          T                     alpha,
+                                          const rocsparse_int* __restrict__ bsr_row_ptr,
+                                          const rocsparse_int* __restrict__ bsr_col_ind,
+                                          const U* __restrict__ bsr_val,
+                                          rocsparse_int bsr_dim,
+                                          const T* __restrict__ x,
+                                          T* __restrict__ y,
+                                          rocsparse_index_base idx_base)
 {
+    bsrmv_atomic_device<T, U, BLOCKSIZE, WF_SEGMENT_SIZE>(mb,
+                                                          dir,
+                                                          trans,
+                                                          type,
+                                                          fill_mode,
+                                                          alpha,
+                                                          bsr_row_ptr,
+                                                          bsr_col_ind,
+                                                          bsr_val,
+                                                          bsr_dim,
+                                                          x,
+                                                          y,
+                                                          idx_base);
+}
+
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WF_SEGMENT_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrmv_atomic_kernel_device_pointer(rocsparse_int         mb,
+                                            rocsparse_direction   dir,
+                                            rocsparse_operation   trans,
+                                            rocsparse_matrix_type type,
+                                            rocsparse_fill_mode   fill_mode,
+                                            const T*              alpha,
+                                            const rocsparse_int* __restrict__ bsr_row_ptr,
+                                            const rocsparse_int* __restrict__ bsr_col_ind,
+                                            const U* __restrict__ bsr_val,
+                                            rocsparse_int bsr_dim,
+                                            const T* __restrict__ x,
+                                            T* __restrict__ y,
+                                            rocsparse_index_base idx_base)
+{
+    if(*alpha == static_cast<T>(0))
+    {
+        return;
+    }
+
+    bsrmv_atomic_device<T, U, BLOCKSIZE, WF_SEGMENT_SIZE>(mb,
+                                                          dir,
+                                                          trans,
+                                                          type,
+                                                          fill_mode,
+                                                          *alpha,
+                                                          bsr_row_ptr,
+                                                          bsr_col_ind,
+                                                          bsr_val,
+                                                          bsr_dim,
+                                                          x,
+                                                          y,
+                                                          idx_base);
+}
+
+// Segment sizes of the atomic kernel
+using bsrmv_atomic_wfsizes = rocsparse_value_list<4, 8, 16, 32, 64>;
+
+// Transposed, symmetric and hermitian bsrmv without a cached transpose. y is scaled by
+// beta first, afterwards the products of all BSR blocks are accumulated atomically.
+template <typename T, typename U>
+static rocsparse_status bsrmv_atomic(rocsparse_handle          handle,
+                                     rocsparse_direction       dir,
+                                     rocsparse_operation       trans,
+                                     rocsparse_int             mb,
+                                     rocsparse_int             nb,
+                                     rocsparse_int             nnzb,
+                                     const T*                  alpha,
+                                     const rocsparse_mat_descr descr,
+                                     const U*                  bsr_val,
+                                     const rocsparse_int*      bsr_row_ptr,
+                                     const rocsparse_int*      bsr_col_ind,
+                                     rocsparse_int             bsr_dim,
+                                     const T*                  x,
+                                     const T*                  beta,
+                                     T*                        y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Size of y
+    rocsparse_int ysize = ((descr->type == rocsparse_matrix_type_general) ? nb : mb) * bsr_dim;
+
+    // Scale y with beta
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
-        // Differentiate BSR block dimensions
-        if(bsr_dim <= 8)
+        hipLaunchKernelGGL((coomv_scale_device_pointer<T, 1024>),
+                           dim3((ysize - 1) / 1024 + 1),
+                           dim3(1024),
+                           0,
+                           stream,
+                           ysize,
+                           beta,
+                           y);
+    }
+    else
+    {
+        if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
         {
-            hipLaunchKernelGGL((bsrmvn_general_kernel_device_pointer<T, 64, 8>),
-                               dim3(mb),
-                               dim3(8 * 8),
+            return rocsparse_status_success;
+        }
+
+        // If beta == 0.0 we need to set y to 0
+        if(*beta == static_cast<T>(0))
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(y, 0, sizeof(T) * ysize, stream));
+        }
+        else if(*beta != static_cast<T>(1))
+        {
+            hipLaunchKernelGGL((coomv_scale_host_pointer<T, 1024>),
+                               dim3((ysize - 1) / 1024 + 1),
+                               dim3(1024),
                                0,
-                               handle->stream,
-                               dir,
-                               alpha,
-                               bsr_row_ptr,
-                               bsr_col_ind,
-                               bsr_val,
-                               bsr_dim,
-                               x,
-                               beta,
-                               y,
-                               base);
+                               stream,
+                               ysize,
+                               *beta,
+                               y);
         }
-        else if(bsr_dim <= 16)
+
+        if(*alpha == static_cast<T>(0))
         {
-            hipLaunchKernelGGL((bsrmvn_general_kernel_device_pointer<T, 256, 16>),
-                               dim3(mb),
-                               dim3(16 * 16),
+            return rocsparse_status_success;
+        }
+    }
+
+    // Segment size, depending on the average number of block rows and columns per
+    // BSR row
+    rocsparse_int wfsize
+        = bsrmvn_small_wfsize(((nnzb - 1) / mb + 1) * bsr_dim, handle->wavefront_size);
+
+    constexpr unsigned int BSRMV_DIM = 256;
+
+    bool dispatched = rocsparse_dispatch_value(wfsize, bsrmv_atomic_wfsizes{}, [&](auto w) {
+        constexpr unsigned int WFSIZE = decltype(w)::value;
+
+        dim3 bsrmv_blocks((mb - 1) / (BSRMV_DIM / WFSIZE) + 1);
+        dim3 bsrmv_threads(BSRMV_DIM);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((bsrmv_atomic_kernel_device_pointer<T, U, BSRMV_DIM, WFSIZE>),
+                               bsrmv_blocks,
+                               bsrmv_threads,
                                0,
-                               handle->stream,
+                               stream,
+                               mb,
                                dir,
+                               trans,
+                               descr->type,
+                               descr->fill_mode,
                                alpha,
                                bsr_row_ptr,
                                bsr_col_ind,
                                bsr_val,
                                bsr_dim,
                                x,
-                               beta,
                                y,
-                               base);
+                               descr->base);
         }
         else
         {
-            hipLaunchKernelGGL((bsrmvn_general_kernel_device_pointer<T, 1024, 32>),
-                               dim3(mb),
-                               dim3(32 * 32),
+            hipLaunchKernelGGL((bsrmv_atomic_kernel_host_pointer<T, U, BSRMV_DIM, WFSIZE>),
+                               bsrmv_blocks,
+                               bsrmv_threads,
                                0,
-                               handle->stream,
+                               stream,
+                               mb,
                                dir,
-                               alpha,
+                               trans,
+                               descr->type,
+                               descr->fill_mode,
+                               *alpha,
                                bsr_row_ptr,
                                bsr_col_ind,
                                bsr_val,
                                bsr_dim,
                                x,
-                               beta,
                                y,
-                               base);
+                               descr->base);
         }
-    }
-    else
-    {
-        if(*alpha != static_cast<T>(0) || *beta != static_cast<T>(1))
-        {
-            // Differentiate BSR block dimensions
-            if(bsr_dim <= 8)
-            {
-                hipLaunchKernelGGL((bsrmvn_general_kernel_host_pointer<T, 64, 8>),
-                                   dim3(mb),
-                                   dim3(8 * 8),
-                                   0,
-                                   handle->stream,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   bsr_dim,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            }
-            else if(bsr_dim <= 16)
-            {
-                hipLaunchKernelGGL((bsrmvn_general_kernel_host_pointer<T, 256, 16>),
-                                   dim3(mb),
-                                   dim3(16 * 16),
-                                   0,
-                                   handle->stream,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   bsr_dim,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            }
-            else
-            {
-                hipLaunchKernelGGL((bsrmvn_general_kernel_host_pointer<T, 1024, 32>),
-                                   dim3(mb),
-                                   dim3(32 * 32),
-                                   0,
-                                   handle->stream,
-                                   dir,
-                                   *alpha,
-                                   bsr_row_ptr,
-                                   bsr_col_ind,
-                                   bsr_val,
-                                   bsr_dim,
-                                   x,
-                                   *beta,
-                                   y,
-                                   base);
-            }
-        }
-    }
+    });
+
+    return dispatched ? rocsparse_status_success : rocsparse_status_arch_mismatch;
 }
 
-template <typename T>
+template <typename T, typename U>
 rocsparse_status rocsparse_bsrmv_template(rocsparse_handle          handle,
                                           rocsparse_direction       dir,
                                           rocsparse_operation       trans,
@@ -1783,7 +1335,7 @@ rocsparse_status rocsparse_bsrmv_template(rocsparse_handle          handle,
                                           rocsparse_int             nnzb,
                                           const T*                  alpha,
                                           const rocsparse_mat_descr descr,
-                                          const T*                  bsr_val,
+                                          const U*                  bsr_val,
                                           const rocsparse_int*      bsr_row_ptr,
                                           const rocsparse_int*      bsr_col_ind,
                                           rocsparse_int             bsr_dim,
@@ -1805,7 +1357,7 @@ rocsparse_status rocsparse_bsrmv_template(rocsparse_handle          handle,
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xbsrmv"),
+                  replaceXY<T, U>("rocsparse_XYbsrmv"),
                   dir,
                   trans,
                   mb,
@@ -1822,8 +1374,9 @@ rocsparse_status rocsparse_bsrmv_template(rocsparse_handle          handle,
                   (const void*&)y);
 
         log_bench(handle,
-                  "./rocsparse-bench -f bsrmv -r",
-                  replaceX<T>("X"),
+                  std::is_same<T, U>() ? "./rocsparse-bench -f bsrmv -r"
+                                       : "./rocsparse-bench -f bsrmv_mixed -r",
+                  replaceX<U>("X"),
                   "--mtx <matrix.mtx> "
                   "--bsrdim",
                   bsr_dim,
@@ -1835,7 +1388,7 @@ rocsparse_status rocsparse_bsrmv_template(rocsparse_handle          handle,
     else
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xbsrmv"),
+                  replaceXY<T, U>("rocsparse_XYbsrmv"),
                   dir,
                   trans,
                   mb,
@@ -1857,7 +1410,7 @@ rocsparse_status rocsparse_bsrmv_template(rocsparse_handle          handle,
     {
         return rocsparse_status_invalid_value;
     }
-    if(descr->type != rocsparse_matrix_type_general)
+    if(descr->type == rocsparse_matrix_type_triangular)
     {
         // TODO
         return rocsparse_status_not_implemented;
@@ -1880,6 +1433,10 @@ rocsparse_status rocsparse_bsrmv_template(rocsparse_handle          handle,
     {
         return rocsparse_status_invalid_size;
     }
+    else if(descr->type != rocsparse_matrix_type_general && mb != nb)
+    {
+        return rocsparse_status_invalid_size;
+    }
 
     // Quick return if possible
     if(mb == 0 || nb == 0 || nnzb == 0 || bsr_dim == 0)
@@ -1917,159 +1474,578 @@ rocsparse_status rocsparse_bsrmv_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
-    // bsr_dim == 1 is the CSR case
-    if(bsr_dim == 1)
+    // Non-transposed general matrices
+    if(trans == rocsparse_operation_none && descr->type == rocsparse_matrix_type_general)
     {
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_template(handle,
-                                                           trans,
-                                                           mb,
-                                                           nb,
-                                                           nnzb,
-                                                           alpha,
-                                                           descr,
-                                                           bsr_val,
-                                                           bsr_row_ptr,
-                                                           bsr_col_ind,
-                                                           nullptr,
-                                                           x,
-                                                           beta,
-                                                           y));
-
-        return rocsparse_status_success;
+        return bsrmvn_dispatch(handle,
+                               dir,
+                               mb,
+                               nb,
+                               nnzb,
+                               alpha,
+                               descr,
+                               bsr_val,
+                               bsr_row_ptr,
+                               bsr_col_ind,
+                               bsr_dim,
+                               x,
+                               beta,
+                               y);
     }
 
-    // Run different bsrmv kernels
-    if(trans == rocsparse_operation_none)
+    // Transposed, symmetric and hermitian matrices
+    return bsrmv_atomic(handle,
+                        dir,
+                        trans,
+                        mb,
+                        nb,
+                        nnzb,
+                        alpha,
+                        descr,
+                        bsr_val,
+                        bsr_row_ptr,
+                        bsr_col_ind,
+                        bsr_dim,
+                        x,
+                        beta,
+                        y);
+}
+
+// Size of the temporary storage that is required by bsrmv_transpose
+static rocsparse_status bsrmv_transpose_buffer_size(rocsparse_handle handle,
+                                                    rocsparse_int    nb,
+                                                    rocsparse_int    nnzb,
+                                                    size_t*          buffer_size)
+{
+    rocprim::double_buffer<rocsparse_int> keys;
+    rocprim::double_buffer<rocsparse_int> vals;
+
+    size_t rocprim_size;
+
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        nullptr, rocprim_size, keys, vals, nnzb, 0, rocsparse_clz(nb), handle->stream));
+
+    // Sort keys, permutation and block row indices, followed by the rocprim buffer
+    *buffer_size = sizeof(rocsparse_int) * ((nnzb - 1) / 256 + 1) * 256 * 3 + rocprim_size;
+
+    return rocsparse_status_success;
+}
+
+// Compute the block transpose of a BSR matrix, i.e. the BSC column pointers, the BSC
+// row indices and the (conjugated) BSC blocks. Interpreted in the opposite block storage
+// direction, the block transpose is the transposed matrix in BSR format. temp_buffer
+// holds at least the number of bytes returned by bsrmv_transpose_buffer_size.
+template <typename T>
+static rocsparse_status bsrmv_transpose(rocsparse_handle     handle,
+                                        rocsparse_operation  trans,
+                                        rocsparse_int        mb,
+                                        rocsparse_int        nb,
+                                        rocsparse_int        nnzb,
+                                        rocsparse_int        bsr_dim,
+                                        rocsparse_index_base idx_base,
+                                        const T*             bsr_val,
+                                        const rocsparse_int* bsr_row_ptr,
+                                        const rocsparse_int* bsr_col_ind,
+                                        T*                   bsrt_val,
+                                        rocsparse_int*       bsrt_row_ind,
+                                        rocsparse_int*       bsrt_col_ptr,
+                                        void*                temp_buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Sort keys and permutation
+    rocprim::double_buffer<rocsparse_int> keys;
+    rocprim::double_buffer<rocsparse_int> vals;
+
+    unsigned int startbit = 0;
+    unsigned int endbit   = rocsparse_clz(nb);
+
+    size_t rocprim_size;
+
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        nullptr, rocprim_size, keys, vals, nnzb, startbit, endbit, stream));
+
+    size_t work_size = sizeof(rocsparse_int) * ((nnzb - 1) / 256 + 1) * 256;
+
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // work buffers
+    rocsparse_int* tmp_work1 = reinterpret_cast<rocsparse_int*>(ptr);
+    rocsparse_int* tmp_work2 = reinterpret_cast<rocsparse_int*>(ptr + work_size);
+    rocsparse_int* tmp_perm  = reinterpret_cast<rocsparse_int*>(ptr + 2 * work_size);
+
+    // rocprim buffer
+    void* rocprim_buffer = reinterpret_cast<void*>(ptr + 3 * work_size);
+
+    // Load BSR column indices into work1 buffer
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(tmp_work1,
+                                       bsr_col_ind,
+                                       sizeof(rocsparse_int) * nnzb,
+                                       hipMemcpyDeviceToDevice,
+                                       stream));
+
+    // Create identity permutation
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, nnzb, tmp_perm));
+
+    // Stable sort blocks by block columns
+    keys = rocprim::double_buffer<rocsparse_int>(tmp_work1, bsrt_row_ind);
+    vals = rocprim::double_buffer<rocsparse_int>(tmp_perm, tmp_work2);
+
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        rocprim_buffer, rocprim_size, keys, vals, nnzb, startbit, endbit, stream));
+
+    rocsparse_int* perm = vals.current();
+
+    // Create block column pointers
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_coo2csr(handle, keys.current(), nnzb, nb, bsrt_col_ptr, idx_base));
+
+    // Create block row indices
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csr2coo(handle, bsr_row_ptr, nnzb, mb, tmp_work1, idx_base));
+
+    // Permute block row indices
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_gthr_template(handle,
+                                                      nnzb,
+                                                      tmp_work1,
+                                                      bsrt_row_ind,
+                                                      perm,
+                                                      rocsparse_index_base_zero));
+
+// Gather the BSR blocks in block transpose order
+#define BSRMV_GTHR_DIM 1024
+    dim3 bsrmv_blocks((nnzb * bsr_dim * bsr_dim - 1) / BSRMV_GTHR_DIM + 1);
+    dim3 bsrmv_threads(BSRMV_GTHR_DIM);
+
+    if(trans == rocsparse_operation_conjugate_transpose)
     {
-        if(bsr_dim == 2)
-        {
-            bsrmvn_2x2(handle,
-                       dir,
-                       mb,
-                       nnzb,
-                       alpha,
-                       bsr_row_ptr,
-                       bsr_col_ind,
-                       bsr_val,
-                       x,
-                       beta,
-                       y,
-                       descr->base);
-        }
-        else if(bsr_dim == 3)
-        {
-            bsrmvn_3x3(handle,
-                       dir,
-                       mb,
-                       nnzb,
-                       alpha,
-                       bsr_row_ptr,
-                       bsr_col_ind,
-                       bsr_val,
-                       x,
-                       beta,
-                       y,
-                       descr->base);
-        }
-        else if(bsr_dim == 4)
-        {
-            bsrmvn_4x4(handle,
-                       dir,
-                       mb,
-                       nnzb,
-                       alpha,
-                       bsr_row_ptr,
-                       bsr_col_ind,
-                       bsr_val,
-                       x,
-                       beta,
-                       y,
-                       descr->base);
-        }
-        else if(bsr_dim == 5)
-        {
-            bsrmvn_5x5(handle,
-                       dir,
-                       mb,
-                       nnzb,
-                       alpha,
-                       bsr_row_ptr,
-                       bsr_col_ind,
-                       bsr_val,
-                       x,
-                       beta,
-                       y,
-                       descr->base);
-        }
-        else if(bsr_dim == 8)
-        {
-            bsrmvn_8x8(handle,
-                       dir,
-                       mb,
-                       nnzb,
-                       alpha,
-                       bsr_row_ptr,
-                       bsr_col_ind,
-                       bsr_val,
-                       x,
-                       beta,
-                       y,
-                       descr->base);
-        }
-        else if(bsr_dim == 16)
-        {
-            bsrmvn_16x16(handle,
-                         dir,
-                         mb,
-                         nnzb,
-                         alpha,
-                         bsr_row_ptr,
-                         bsr_col_ind,
-                         bsr_val,
-                         x,
-                         beta,
-                         y,
-                         descr->base);
-        }
-        else if(bsr_dim > 16 && bsr_dim <= 32)
-        {
-            bsrmvn_17_32(handle,
-                         dir,
-                         mb,
-                         nnzb,
-                         alpha,
-                         bsr_row_ptr,
-                         bsr_col_ind,
-                         bsr_val,
-                         bsr_dim,
-                         x,
-                         beta,
-                         y,
-                         descr->base);
-        }
-        else
-        {
-            bsrmvn_general(handle,
-                           dir,
-                           mb,
-                           alpha,
-                           bsr_row_ptr,
-                           bsr_col_ind,
-                           bsr_val,
+        hipLaunchKernelGGL((bsrmv_transpose_gather_kernel<T, BSRMV_GTHR_DIM, true>),
+                           bsrmv_blocks,
+                           bsrmv_threads,
+                           0,
+                           stream,
+                           nnzb,
                            bsr_dim,
-                           x,
-                           beta,
-                           y,
-                           descr->base);
-        }
+                           perm,
+                           bsr_val,
+                           bsrt_val);
     }
     else
+    {
+        hipLaunchKernelGGL((bsrmv_transpose_gather_kernel<T, BSRMV_GTHR_DIM, false>),
+                           bsrmv_blocks,
+                           bsrmv_threads,
+                           0,
+                           stream,
+                           nnzb,
+                           bsr_dim,
+                           perm,
+                           bsr_val,
+                           bsrt_val);
+    }
+#undef BSRMV_GTHR_DIM
+
+    return rocsparse_status_success;
+}
+
+// Compute the block transpose of a BSR matrix into the arrays of a bsrmv info
+// structure and store the data that is required to verify its later use
+template <typename T>
+static rocsparse_status bsrmv_transpose_info(rocsparse_handle          handle,
+                                             rocsparse_direction       dir,
+                                             rocsparse_operation       trans,
+                                             rocsparse_int             mb,
+                                             rocsparse_int             nb,
+                                             rocsparse_int             nnzb,
+                                             const rocsparse_mat_descr descr,
+                                             const T*                  bsr_val,
+                                             const rocsparse_int*      bsr_row_ptr,
+                                             const rocsparse_int*      bsr_col_ind,
+                                             rocsparse_int             bsr_dim,
+                                             rocsparse_bsrmv_info      info)
+{
+    // Allocate memory on device to hold the block transpose
+    info->trans_val_size = sizeof(T) * nnzb * bsr_dim * bsr_dim;
+
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->trans_col_ptr, sizeof(rocsparse_int) * (nb + 1)));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->trans_row_ind, sizeof(rocsparse_int) * nnzb));
+    RETURN_IF_HIP_ERROR(hipMalloc(&info->trans_val, info->trans_val_size));
+
+    // Temporary storage of the transposition
+    size_t buffer_size;
+    RETURN_IF_ROCSPARSE_ERROR(bsrmv_transpose_buffer_size(handle, nb, nnzb, &buffer_size));
+
+    void* temp_buffer = nullptr;
+    RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, buffer_size));
+
+    // Compute the block transpose
+    rocsparse_status status = bsrmv_transpose(handle,
+                                              trans,
+                                              mb,
+                                              nb,
+                                              nnzb,
+                                              bsr_dim,
+                                              descr->base,
+                                              bsr_val,
+                                              bsr_row_ptr,
+                                              bsr_col_ind,
+                                              static_cast<T*>(info->trans_val),
+                                              info->trans_row_ind,
+                                              info->trans_col_ptr,
+                                              temp_buffer);
+
+    // The temporary storage is released, regardless whether the transposition succeeded
+    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
+    RETURN_IF_ROCSPARSE_ERROR(status);
+
+    // Store some pointers to verify correct execution
+    info->dir         = dir;
+    info->trans       = trans;
+    info->mb          = mb;
+    info->nb          = nb;
+    info->nnzb        = nnzb;
+    info->bsr_dim     = bsr_dim;
+    info->descr       = descr;
+    info->bsr_val     = bsr_val;
+    info->bsr_row_ptr = bsr_row_ptr;
+    info->bsr_col_ind = bsr_col_ind;
+
+    return rocsparse_status_success;
+}
+
+// Create a bsrmv info structure holding the block transpose of a BSR matrix. On
+// failure, all memory allocated so far is released and *info remains nullptr.
+template <typename T>
+static rocsparse_status bsrmv_create_transpose_info(rocsparse_handle          handle,
+                                                    rocsparse_direction       dir,
+                                                    rocsparse_operation       trans,
+                                                    rocsparse_int             mb,
+                                                    rocsparse_int             nb,
+                                                    rocsparse_int             nnzb,
+                                                    const rocsparse_mat_descr descr,
+                                                    const T*                  bsr_val,
+                                                    const rocsparse_int*      bsr_row_ptr,
+                                                    const rocsparse_int*      bsr_col_ind,
+                                                    rocsparse_int             bsr_dim,
+                                                    rocsparse_bsrmv_info*     info)
+{
+    rocsparse_bsrmv_info trans_info = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_bsrmv_info(&trans_info));
+
+    rocsparse_status status = bsrmv_transpose_info(handle,
+                                                   dir,
+                                                   trans,
+                                                   mb,
+                                                   nb,
+                                                   nnzb,
+                                                   descr,
+                                                   bsr_val,
+                                                   bsr_row_ptr,
+                                                   bsr_col_ind,
+                                                   bsr_dim,
+                                                   trans_info);
+
+    if(status != rocsparse_status_success)
+    {
+        rocsparse_destroy_bsrmv_info(trans_info);
+        return status;
+    }
+
+    *info = trans_info;
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_bsrmv_ex_analysis_template(rocsparse_handle          handle,
+                                                      rocsparse_direction       dir,
+                                                      rocsparse_operation       trans,
+                                                      rocsparse_int             mb,
+                                                      rocsparse_int             nb,
+                                                      rocsparse_int             nnzb,
+                                                      const rocsparse_mat_descr descr,
+                                                      const T*                  bsr_val,
+                                                      const rocsparse_int*      bsr_row_ptr,
+                                                      const rocsparse_int*      bsr_col_ind,
+                                                      rocsparse_int             bsr_dim,
+                                                      rocsparse_mat_info        info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xbsrmv_ex_analysis"),
+              dir,
+              trans,
+              mb,
+              nb,
+              nnzb,
+              (const void*&)descr,
+              (const void*&)bsr_val,
+              (const void*&)bsr_row_ptr,
+              (const void*&)bsr_col_ind,
+              bsr_dim,
+              (const void*&)info);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type == rocsparse_matrix_type_triangular)
     {
         // TODO
         return rocsparse_status_not_implemented;
     }
 
+    // Check sizes
+    if(mb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnzb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(bsr_dim < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(descr->type != rocsparse_matrix_type_general && mb != nb)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Clear bsrmv info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_bsrmv_info(info->bsrmv_info));
+    info->bsrmv_info = nullptr;
+
+    // Quick return if possible
+    if(mb == 0 || nb == 0 || nnzb == 0 || bsr_dim == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(bsr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Only transposed general matrices benefit from the block transpose, all other
+    // cases are computed directly by bsrmv
+    if(trans == rocsparse_operation_none || descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Create bsrmv info holding the block transpose
+    RETURN_IF_ROCSPARSE_ERROR(bsrmv_create_transpose_info(handle,
+                                                          dir,
+                                                          trans,
+                                                          mb,
+                                                          nb,
+                                                          nnzb,
+                                                          descr,
+                                                          bsr_val,
+                                                          bsr_row_ptr,
+                                                          bsr_col_ind,
+                                                          bsr_dim,
+                                                          &info->bsrmv_info));
+
     return rocsparse_status_success;
 }
 
+template <typename T>
+rocsparse_status rocsparse_bsrmv_ex_template(rocsparse_handle          handle,
+                                             rocsparse_direction       dir,
+                                             rocsparse_operation       trans,
+                                             rocsparse_int             mb,
+                                             rocsparse_int             nb,
+                                             rocsparse_int             nnzb,
+                                             const T*                  alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const T*                  bsr_val,
+                                             const rocsparse_int*      bsr_row_ptr,
+                                             const rocsparse_int*      bsr_col_ind,
+                                             rocsparse_int             bsr_dim,
+                                             rocsparse_mat_info        info,
+                                             const T*                  x,
+                                             const T*                  beta,
+                                             T*                        y)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Without block transpose, call bsrmv
+    if(info == nullptr || info->bsrmv_info == nullptr)
+    {
+        return rocsparse_bsrmv_template(handle,
+                                        dir,
+                                        trans,
+                                        mb,
+                                        nb,
+                                        nnzb,
+                                        alpha,
+                                        descr,
+                                        bsr_val,
+                                        bsr_row_ptr,
+                                        bsr_col_ind,
+                                        bsr_dim,
+                                        x,
+                                        beta,
+                                        y);
+    }
+
+    rocsparse_bsrmv_info bsrmv_info = info->bsrmv_info;
+
+    // Check if info matches current matrix and options
+    if(bsrmv_info->dir != dir)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(bsrmv_info->trans != trans)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(bsrmv_info->mb != mb)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(bsrmv_info->nb != nb)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(bsrmv_info->nnzb != nnzb)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(bsrmv_info->bsr_dim != bsr_dim)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(bsrmv_info->descr != descr)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(bsrmv_info->bsr_val != bsr_val)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsrmv_info->bsr_row_ptr != bsr_row_ptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsrmv_info->bsr_col_ind != bsr_col_ind)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xbsrmv_ex"),
+                  dir,
+                  trans,
+                  mb,
+                  nb,
+                  nnzb,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)bsr_val,
+                  (const void*&)bsr_row_ptr,
+                  (const void*&)bsr_col_ind,
+                  bsr_dim,
+                  (const void*&)info,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xbsrmv_ex"),
+                  dir,
+                  trans,
+                  mb,
+                  nb,
+                  nnzb,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)bsr_val,
+                  (const void*&)bsr_row_ptr,
+                  (const void*&)bsr_col_ind,
+                  bsr_dim,
+                  (const void*&)info,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check pointer arguments
+    if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // op(A) is the block transpose, stored in opposite direction, multiplied
+    // non-transposed
+    return bsrmvn_dispatch(handle,
+                           (dir == rocsparse_direction_row) ? rocsparse_direction_column
+                                                            : rocsparse_direction_row,
+                           nb,
+                           mb,
+                           nnzb,
+                           alpha,
+                           descr,
+                           static_cast<const T*>(bsrmv_info->trans_val),
+                           bsrmv_info->trans_col_ptr,
+                           bsrmv_info->trans_row_ind,
+                           bsr_dim,
+                           x,
+                           beta,
+                           y);
+}
+
 #endif // ROCSPARSE_BSRMV_HPP
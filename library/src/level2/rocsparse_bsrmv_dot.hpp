@@ -0,0 +1,347 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_BSRMV_DOT_HPP
+#define ROCSPARSE_BSRMV_DOT_HPP
+
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "rocsparse_spmv_dot.hpp"
+#include "spmv_dot_device.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrmvn_dot_kernel_host_pointer(rocsparse_int       mb,
+                                        rocsparse_direction dir,
+                                        T                   alpha,
+                                        const rocsparse_int* __restrict__ bsr_row_ptr,
+                                        const rocsparse_int* __restrict__ bsr_col_ind,
+                                        const T* __restrict__ bsr_val,
+                                        rocsparse_int bsr_dim,
+                                        const T* __restrict__ x,
+                                        T beta,
+                                        T* __restrict__ y,
+                                        bool compute_xy,
+                                        T* __restrict__ workspace,
+                                        rocsparse_index_base idx_base)
+{
+    bsrmvn_dot_device<T, BLOCKSIZE, WF_SIZE>(mb,
+                                             dir,
+                                             alpha,
+                                             bsr_row_ptr,
+                                             bsr_col_ind,
+                                             bsr_val,
+                                             bsr_dim,
+                                             x,
+                                             beta,
+                                             y,
+                                             compute_xy,
+                                             workspace,
+                                             idx_base);
+}
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrmvn_dot_kernel_device_pointer(rocsparse_int       mb,
+                                          rocsparse_direction dir,
+                                          const T*            alpha,
+                                          const rocsparse_int* __restrict__ bsr_row_ptr,
+                                          const rocsparse_int* __restrict__ bsr_col_ind,
+                                          const T* __restrict__ bsr_val,
+                                          rocsparse_int bsr_dim,
+                                          const T* __restrict__ x,
+                                          const T* beta,
+                                          T* __restrict__ y,
+                                          bool compute_xy,
+                                          T* __restrict__ workspace,
+                                          rocsparse_index_base idx_base)
+{
+    bsrmvn_dot_device<T, BLOCKSIZE, WF_SIZE>(mb,
+                                             dir,
+                                             *alpha,
+                                             bsr_row_ptr,
+                                             bsr_col_ind,
+                                             bsr_val,
+                                             bsr_dim,
+                                             x,
+                                             *beta,
+                                             y,
+                                             compute_xy,
+                                             workspace,
+                                             idx_base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_bsrmv_dot_template(rocsparse_handle          handle,
+                                              rocsparse_direction       dir,
+                                              rocsparse_operation       trans,
+                                              rocsparse_int             mb,
+                                              rocsparse_int             nb,
+                                              rocsparse_int             nnzb,
+                                              const T*                  alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const T*                  bsr_val,
+                                              const rocsparse_int*      bsr_row_ptr,
+                                              const rocsparse_int*      bsr_col_ind,
+                                              rocsparse_int             bsr_dim,
+                                              const T*                  x,
+                                              const T*                  beta,
+                                              T*                        y,
+                                              T*                        dot_xy,
+                                              T*                        dot_yy)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xbsrmv_dot"),
+                  dir,
+                  trans,
+                  mb,
+                  nb,
+                  nnzb,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)bsr_val,
+                  (const void*&)bsr_row_ptr,
+                  (const void*&)bsr_col_ind,
+                  bsr_dim,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y,
+                  (const void*&)dot_xy,
+                  (const void*&)dot_yy);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f bsrmv_dot -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> "
+                  "--bsrdim",
+                  bsr_dim,
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xbsrmv_dot"),
+                  dir,
+                  trans,
+                  mb,
+                  nb,
+                  nnzb,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)bsr_val,
+                  (const void*&)bsr_row_ptr,
+                  (const void*&)bsr_col_ind,
+                  bsr_dim,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y,
+                  (const void*&)dot_xy,
+                  (const void*&)dot_yy);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type and operation
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    else if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(mb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnzb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(bsr_dim < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Sanity check
+    if((mb == 0 || nb == 0) && nnzb != 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // x^H * y requires x and y to be of same length
+    if(dot_xy != nullptr && mb != nb)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(mb == 0 || bsr_dim == 0)
+    {
+        return rocsparse_spmv_dot_zero(handle, dot_xy, dot_yy);
+    }
+
+    // Check pointer arguments
+    if(bsr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Without non-zero blocks, y is only scaled by beta
+    if(nb == 0 || nnzb == 0)
+    {
+        return rocsparse_spmv_dot_scale(handle, mb * bsr_dim, x, beta, y, dot_xy, dot_yy);
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Get workspace from handle device buffer
+    RETURN_IF_ROCSPARSE_ERROR(handle->alloc_buffer());
+    T* workspace = reinterpret_cast<T*>(handle->buffer);
+
+    bool compute_xy = (dot_xy != nullptr);
+
+    // Wavefront size, depending on the average number of entries per row of the
+    // expanded matrix
+    rocsparse_int wfsize = spmv_dot_wfsize(nnzb / mb * bsr_dim, handle->wavefront_size);
+
+#define BSRMVN_DOT_DIM 512
+    rocsparse_int nblocks = 0;
+
+    bool dispatched = rocsparse_dispatch_value(wfsize, spmv_dot_wfsizes{}, [&](auto w) {
+        constexpr unsigned int WF_SIZE = decltype(w)::value;
+
+        nblocks = spmv_dot_nblocks(mb * bsr_dim, BSRMVN_DOT_DIM / WF_SIZE);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((bsrmvn_dot_kernel_device_pointer<T, BSRMVN_DOT_DIM, WF_SIZE>),
+                               dim3(nblocks),
+                               dim3(BSRMVN_DOT_DIM),
+                               0,
+                               stream,
+                               mb,
+                               dir,
+                               alpha,
+                               bsr_row_ptr,
+                               bsr_col_ind,
+                               bsr_val,
+                               bsr_dim,
+                               x,
+                               beta,
+                               y,
+                               compute_xy,
+                               workspace,
+                               descr->base);
+        }
+        else
+        {
+            hipLaunchKernelGGL((bsrmvn_dot_kernel_host_pointer<T, BSRMVN_DOT_DIM, WF_SIZE>),
+                               dim3(nblocks),
+                               dim3(BSRMVN_DOT_DIM),
+                               0,
+                               stream,
+                               mb,
+                               dir,
+                               *alpha,
+                               bsr_row_ptr,
+                               bsr_col_ind,
+                               bsr_val,
+                               bsr_dim,
+                               x,
+                               *beta,
+                               y,
+                               compute_xy,
+                               workspace,
+                               descr->base);
+        }
+    });
+#undef BSRMVN_DOT_DIM
+
+    if(!dispatched)
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+    return rocsparse_spmv_dot_finalize(handle, nblocks, workspace, dot_xy, dot_yy);
+}
+
+#endif // ROCSPARSE_BSRMV_DOT_HPP
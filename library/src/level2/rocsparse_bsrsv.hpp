@@ -42,7 +42,7 @@
                        0,                                              \
                        stream,                                         \
                        nnzb,                                           \
-                       bsrsv->trmt_perm,                               \
+                       (const rocsparse_int*)bsrsv->trmt_perm,         \
                        bsr_val,                                        \
                        bsrt_val,                                       \
                        bsr_dim);
@@ -475,13 +475,13 @@ rocsparse_status rocsparse_bsrsv_analysis_template(rocsparse_handle          han
                 return rocsparse_status_success;
             }
 
-            //            // Check for other upper analysis meta data that could be used
-            //            if(trans == rocsparse_operation_none && info->bsrsm_upper_info != nullptr)
-            //            {
-            //                // bsrsm meta data
-            //                info->bsrsv_upper_info = info->bsrsm_upper_info;
-            //                return rocsparse_status_success;
-            //            }
+            // Check for other upper analysis meta data that could be used
+            if(trans == rocsparse_operation_none && info->bsrsm_upper_info != nullptr)
+            {
+                // bsrsm meta data
+                info->bsrsv_upper_info = info->bsrsm_upper_info;
+                return rocsparse_status_success;
+            }
         }
 
         // User is explicitly asking to force a re-analysis, or no valid data has been
@@ -537,18 +537,18 @@ rocsparse_status rocsparse_bsrsv_analysis_template(rocsparse_handle          han
                 info->bsrsv_lower_info = info->bsric0_info;
                 return rocsparse_status_success;
             }
-            // else if(trans == rocsparse_operation_none && info->bsrilu0_info != nullptr)
-            // {
-            //     // bsrilu0 meta data
-            //     info->bsrsv_lower_info = info->bsrilu0_info;
-            //     return rocsparse_status_success;
-            // }
-            // else if(trans == rocsparse_operation_none && info->bsrsm_lower_info != nullptr)
-            // {
-            //     // bsrsm meta data
-            //     info->bsrsv_lower_info = info->bsrsm_lower_info;
-            //     return rocsparse_status_success;
-            // }
+            else if(trans == rocsparse_operation_none && info->bsrilu0_info != nullptr)
+            {
+                // bsrilu0 meta data
+                info->bsrsv_lower_info = info->bsrilu0_info;
+                return rocsparse_status_success;
+            }
+            else if(trans == rocsparse_operation_none && info->bsrsm_lower_info != nullptr)
+            {
+                // bsrsm meta data
+                info->bsrsv_lower_info = info->bsrsm_lower_info;
+                return rocsparse_status_success;
+            }
         }
 
         // User is explicitly asking to force a re-analysis, or no valid data has been
@@ -1031,12 +1031,13 @@ rocsparse_status rocsparse_bsrsv_solve_template(rocsparse_handle          handle
     // If diag type is unit, re-initialize zero pivot to remove structural zeros
     if(descr->diag_type == rocsparse_diag_type_unit)
     {
-        rocsparse_int max = std::numeric_limits<rocsparse_int>::max();
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-            info->zero_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
-
-        // Wait for device transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        hipLaunchKernelGGL((csrsv_init_zero_pivot_kernel<rocsparse_int>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           info->zero_pivot,
+                           std::numeric_limits<rocsparse_int>::max());
     }
 
     // Pointers to differentiate between transpose mode
@@ -1055,8 +1056,8 @@ rocsparse_status rocsparse_bsrsv_solve_template(rocsparse_handle          handle
         // Gather transposed values
         LAUNCH_BSRSV_GTHR(256, 64, bsr_dim);
 
-        local_bsr_row_ptr = bsrsv->trmt_row_ptr;
-        local_bsr_col_ind = bsrsv->trmt_col_ind;
+        local_bsr_row_ptr = (const rocsparse_int*)bsrsv->trmt_row_ptr;
+        local_bsr_col_ind = (const rocsparse_int*)bsrsv->trmt_col_ind;
         local_bsr_val     = bsrt_val;
 
         fill_mode = (fill_mode == rocsparse_fill_mode_lower) ? rocsparse_fill_mode_upper
@@ -101,3 +101,39 @@ extern "C" rocsparse_status rocsparse_zcoomv(rocsparse_handle                han
     return rocsparse_coomv_template(
         handle, trans, m, n, nnz, alpha, descr, coo_val, coo_row_ind, coo_col_ind, x, beta, y);
 }
+
+extern "C" rocsparse_status rocsparse_shcoomv(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             nnz,
+                                              const float*              alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const rocsparse_half*     coo_val,
+                                              const rocsparse_int*      coo_row_ind,
+                                              const rocsparse_int*      coo_col_ind,
+                                              const float*              x,
+                                              const float*              beta,
+                                              float*                    y)
+{
+    return rocsparse_coomv_template(
+        handle, trans, m, n, nnz, alpha, descr, coo_val, coo_row_ind, coo_col_ind, x, beta, y);
+}
+
+extern "C" rocsparse_status rocsparse_sbcoomv(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             nnz,
+                                              const float*              alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const rocsparse_bfloat16* coo_val,
+                                              const rocsparse_int*      coo_row_ind,
+                                              const rocsparse_int*      coo_col_ind,
+                                              const float*              x,
+                                              const float*              beta,
+                                              float*                    y)
+{
+    return rocsparse_coomv_template(
+        handle, trans, m, n, nnz, alpha, descr, coo_val, coo_row_ind, coo_col_ind, x, beta, y);
+}
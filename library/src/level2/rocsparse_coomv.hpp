@@ -53,61 +53,61 @@ __launch_bounds__(BLOCKSIZE) __global__ void coomv_scale_device_pointer(rocspars
     coomv_scale_device<T>(size, *beta, data);
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
 __launch_bounds__(BLOCKSIZE) __global__
     void coomvn_wf_host_pointer(rocsparse_int nnz,
                                 rocsparse_int loops,
                                 T             alpha,
                                 const rocsparse_int* __restrict__ coo_row_ind,
                                 const rocsparse_int* __restrict__ coo_col_ind,
-                                const T* __restrict__ coo_val,
+                                const U* __restrict__ coo_val,
                                 const T* __restrict__ x,
                                 T* __restrict__ y,
                                 rocsparse_int* __restrict__ row_block_red,
                                 T* __restrict__ val_block_red,
                                 rocsparse_index_base idx_base)
 {
-    coomvn_general_wf_reduce<T, BLOCKSIZE, WF_SIZE>(nnz,
-                                                    loops,
-                                                    alpha,
-                                                    coo_row_ind,
-                                                    coo_col_ind,
-                                                    coo_val,
-                                                    x,
-                                                    y,
-                                                    row_block_red,
-                                                    val_block_red,
-                                                    idx_base);
+    coomvn_general_wf_reduce<T, U, BLOCKSIZE, WF_SIZE>(nnz,
+                                                       loops,
+                                                       alpha,
+                                                       coo_row_ind,
+                                                       coo_col_ind,
+                                                       coo_val,
+                                                       x,
+                                                       y,
+                                                       row_block_red,
+                                                       val_block_red,
+                                                       idx_base);
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
 __launch_bounds__(BLOCKSIZE) __global__
     void coomvn_wf_device_pointer(rocsparse_int nnz,
                                   rocsparse_int loops,
                                   const T*      alpha,
                                   const rocsparse_int* __restrict__ coo_row_ind,
                                   const rocsparse_int* __restrict__ coo_col_ind,
-                                  const T* __restrict__ coo_val,
+                                  const U* __restrict__ coo_val,
                                   const T* __restrict__ x,
                                   T* __restrict__ y,
                                   rocsparse_int* __restrict__ row_block_red,
                                   T* __restrict__ val_block_red,
                                   rocsparse_index_base idx_base)
 {
-    coomvn_general_wf_reduce<T, BLOCKSIZE, WF_SIZE>(nnz,
-                                                    loops,
-                                                    *alpha,
-                                                    coo_row_ind,
-                                                    coo_col_ind,
-                                                    coo_val,
-                                                    x,
-                                                    y,
-                                                    row_block_red,
-                                                    val_block_red,
-                                                    idx_base);
+    coomvn_general_wf_reduce<T, U, BLOCKSIZE, WF_SIZE>(nnz,
+                                                       loops,
+                                                       *alpha,
+                                                       coo_row_ind,
+                                                       coo_col_ind,
+                                                       coo_val,
+                                                       x,
+                                                       y,
+                                                       row_block_red,
+                                                       val_block_red,
+                                                       idx_base);
 }
 
-template <typename T>
+template <typename T, typename U>
 rocsparse_status rocsparse_coomv_template(rocsparse_handle          handle,
                                           rocsparse_operation       trans,
                                           rocsparse_int             m,
@@ -115,7 +115,7 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle          handle,
                                           rocsparse_int             nnz,
                                           const T*                  alpha,
                                           const rocsparse_mat_descr descr,
-                                          const T*                  coo_val,
+                                          const U*                  coo_val,
                                           const rocsparse_int*      coo_row_ind,
                                           const rocsparse_int*      coo_col_ind,
                                           const T*                  x,
@@ -136,7 +136,7 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle          handle,
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcoomv"),
+                  replaceXY<T, U>("rocsparse_XYcoomv"),
                   trans,
                   m,
                   n,
@@ -151,8 +151,9 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle          handle,
                   (const void*&)y);
 
         log_bench(handle,
-                  "./rocsparse-bench -f coomv -r",
-                  replaceX<T>("X"),
+                  std::is_same<T, U>() ? "./rocsparse-bench -f coomv -r"
+                                       : "./rocsparse-bench -f coomv_mixed -r",
+                  replaceX<U>("X"),
                   "--mtx <matrix.mtx> ",
                   "--alpha",
                   *alpha,
@@ -162,7 +163,7 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle          handle,
     else
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcoomv"),
+                  replaceXY<T, U>("rocsparse_XYcoomv"),
                   trans,
                   m,
                   n,
@@ -259,6 +260,7 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle          handle,
         dim3 coomvn_threads(COOMVN_DIM);
 
         // Buffer
+        RETURN_IF_ROCSPARSE_ERROR(handle->alloc_buffer());
         char* ptr = reinterpret_cast<char*>(handle->buffer);
         ptr += 256;
 
@@ -283,7 +285,7 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle          handle,
 
             if(handle->wavefront_size == 32)
             {
-                hipLaunchKernelGGL((coomvn_wf_device_pointer<T, COOMVN_DIM, 32>),
+                hipLaunchKernelGGL((coomvn_wf_device_pointer<T, U, COOMVN_DIM, 32>),
                                    coomvn_blocks,
                                    coomvn_threads,
                                    0,
@@ -302,7 +304,7 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle          handle,
             }
             else if(handle->wavefront_size == 64)
             {
-                hipLaunchKernelGGL((coomvn_wf_device_pointer<T, COOMVN_DIM, 64>),
+                hipLaunchKernelGGL((coomvn_wf_device_pointer<T, U, COOMVN_DIM, 64>),
                                    coomvn_blocks,
                                    coomvn_threads,
                                    0,
@@ -350,7 +352,7 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle          handle,
 
             if(handle->wavefront_size == 32)
             {
-                hipLaunchKernelGGL((coomvn_wf_host_pointer<T, COOMVN_DIM, 32>),
+                hipLaunchKernelGGL((coomvn_wf_host_pointer<T, U, COOMVN_DIM, 32>),
                                    coomvn_blocks,
                                    coomvn_threads,
                                    0,
@@ -369,7 +371,7 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle          handle,
             }
             else if(handle->wavefront_size == 64)
             {
-                hipLaunchKernelGGL((coomvn_wf_host_pointer<T, COOMVN_DIM, 64>),
+                hipLaunchKernelGGL((coomvn_wf_host_pointer<T, U, COOMVN_DIM, 64>),
                                    coomvn_blocks,
                                    coomvn_threads,
                                    0,
@@ -0,0 +1,339 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROCSPARSE_CSRDCMV_HPP
+#define ROCSPARSE_CSRDCMV_HPP
+
+#include "csrdcmv_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+// Wavefront sizes of the CSRDCMV kernel
+using csrdcmvn_wfsizes = rocsparse_value_list<2, 4, 8, 16, 32, 64>;
+
+// Wavefront size of the CSRDCMV kernel, depending on the average number of non-zero
+// entries per row
+static inline rocsparse_int
+    csrdcmvn_wfsize(rocsparse_int m, rocsparse_int nnz, rocsparse_int wavefront_size)
+{
+    rocsparse_int nnz_per_row = nnz / m;
+    rocsparse_int wfsize      = 2;
+
+    while(2 * wfsize <= nnz_per_row && wfsize < wavefront_size)
+    {
+        wfsize <<= 1;
+    }
+
+    return wfsize;
+}
+
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WFSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrdcmvn_kernel_host_pointer(rocsparse_int m,
+                                      T             alpha,
+                                      const rocsparse_int* __restrict__ csr_row_ptr,
+                                      const rocsparse_int* __restrict__ csrdc_col_base,
+                                      const U* __restrict__ csrdc_delta,
+                                      const rocsparse_int* __restrict__ csrdc_exc_ptr,
+                                      const rocsparse_int* __restrict__ csrdc_exc_col,
+                                      const T* __restrict__ csr_val,
+                                      const T* __restrict__ x,
+                                      T beta,
+                                      T* __restrict__ y,
+                                      rocsparse_index_base idx_base)
+{
+    csrdcmvn_device<T, U, BLOCKSIZE, WFSIZE>(m,
+                                             alpha,
+                                             csr_row_ptr,
+                                             csrdc_col_base,
+                                             csrdc_delta,
+                                             csrdc_exc_ptr,
+                                             csrdc_exc_col,
+                                             csr_val,
+                                             x,
+                                             beta,
+                                             y,
+                                             idx_base);
+}
+
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WFSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrdcmvn_kernel_device_pointer(rocsparse_int m,
+                                        const T*      alpha,
+                                        const rocsparse_int* __restrict__ csr_row_ptr,
+                                        const rocsparse_int* __restrict__ csrdc_col_base,
+                                        const U* __restrict__ csrdc_delta,
+                                        const rocsparse_int* __restrict__ csrdc_exc_ptr,
+                                        const rocsparse_int* __restrict__ csrdc_exc_col,
+                                        const T* __restrict__ csr_val,
+                                        const T* __restrict__ x,
+                                        const T* beta,
+                                        T* __restrict__ y,
+                                        rocsparse_index_base idx_base)
+{
+    csrdcmvn_device<T, U, BLOCKSIZE, WFSIZE>(m,
+                                             *alpha,
+                                             csr_row_ptr,
+                                             csrdc_col_base,
+                                             csrdc_delta,
+                                             csrdc_exc_ptr,
+                                             csrdc_exc_col,
+                                             csr_val,
+                                             x,
+                                             *beta,
+                                             y,
+                                             idx_base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrdcmv_template(rocsparse_handle          handle,
+                                            rocsparse_operation       trans,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            rocsparse_int             nnz,
+                                            const T*                  alpha,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            rocsparse_int             delta_bits,
+                                            const rocsparse_int*      csrdc_col_base,
+                                            const void*               csrdc_delta,
+                                            const rocsparse_int*      csrdc_exc_ptr,
+                                            const rocsparse_int*      csrdc_exc_col,
+                                            const T*                  x,
+                                            const T*                  beta,
+                                            T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrdcmv"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  delta_bits,
+                  (const void*&)csrdc_col_base,
+                  (const void*&)csrdc_delta,
+                  (const void*&)csrdc_exc_ptr,
+                  (const void*&)csrdc_exc_col,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f csrdcmv -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> "
+                  "--deltabits",
+                  delta_bits,
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrdcmv"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  delta_bits,
+                  (const void*&)csrdc_col_base,
+                  (const void*&)csrdc_delta,
+                  (const void*&)csrdc_exc_ptr,
+                  (const void*&)csrdc_exc_col,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check delta width
+    if(delta_bits != 8 && delta_bits != 16)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrdc_col_base == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrdc_delta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrdc_exc_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    static constexpr unsigned int CSRDCMVN_DIM = 256;
+
+    rocsparse_int wfsize = csrdcmvn_wfsize(m, nnz, handle->wavefront_size);
+
+    bool launched = false;
+
+    rocsparse_dispatch_value(delta_bits, rocsparse_csrdc_delta_bits{}, [&](auto bits) {
+        using U = typename rocsparse_csrdc_delta<decltype(bits)::value>::type;
+
+        const U* delta = reinterpret_cast<const U*>(csrdc_delta);
+
+        launched = rocsparse_dispatch_value(wfsize, csrdcmvn_wfsizes{}, [&](auto wf) {
+            constexpr unsigned int WFSIZE = decltype(wf)::value;
+
+            if(handle->pointer_mode == rocsparse_pointer_mode_device)
+            {
+                hipLaunchKernelGGL((csrdcmvn_kernel_device_pointer<T, U, CSRDCMVN_DIM, WFSIZE>),
+                                   dim3((m - 1) / (CSRDCMVN_DIM / WFSIZE) + 1),
+                                   dim3(CSRDCMVN_DIM),
+                                   0,
+                                   handle->stream,
+                                   m,
+                                   alpha,
+                                   csr_row_ptr,
+                                   csrdc_col_base,
+                                   delta,
+                                   csrdc_exc_ptr,
+                                   csrdc_exc_col,
+                                   csr_val,
+                                   x,
+                                   beta,
+                                   y,
+                                   descr->base);
+            }
+            else if(*alpha != static_cast<T>(0) || *beta != static_cast<T>(1))
+            {
+                hipLaunchKernelGGL((csrdcmvn_kernel_host_pointer<T, U, CSRDCMVN_DIM, WFSIZE>),
+                                   dim3((m - 1) / (CSRDCMVN_DIM / WFSIZE) + 1),
+                                   dim3(CSRDCMVN_DIM),
+                                   0,
+                                   handle->stream,
+                                   m,
+                                   *alpha,
+                                   csr_row_ptr,
+                                   csrdc_col_base,
+                                   delta,
+                                   csrdc_exc_ptr,
+                                   csrdc_exc_col,
+                                   csr_val,
+                                   x,
+                                   *beta,
+                                   y,
+                                   descr->base);
+            }
+        });
+    });
+
+    return launched ? rocsparse_status_success : rocsparse_status_arch_mismatch;
+}
+
+#endif // ROCSPARSE_CSRDCMV_HPP
@@ -91,6 +91,96 @@ extern "C" rocsparse_status rocsparse_zcsrmv_analysis(rocsparse_handle
         handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
 }
 
+extern "C" rocsparse_status rocsparse_shcsrmv_analysis(rocsparse_handle          handle,
+                                                       rocsparse_operation       trans,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             n,
+                                                       rocsparse_int             nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const rocsparse_half*     csr_val,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       rocsparse_mat_info        info)
+{
+    return rocsparse_csrmv_analysis_template(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+extern "C" rocsparse_status rocsparse_sbcsrmv_analysis(rocsparse_handle          handle,
+                                                       rocsparse_operation       trans,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             n,
+                                                       rocsparse_int             nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const rocsparse_bfloat16* csr_val,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       rocsparse_mat_info        info)
+{
+    return rocsparse_csrmv_analysis_template(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+extern "C" rocsparse_status rocsparse_scsrmv_analysis_i64(rocsparse_handle          handle,
+                                                          rocsparse_operation       trans,
+                                                          int32_t                   m,
+                                                          int32_t                   n,
+                                                          int64_t                   nnz,
+                                                          const rocsparse_mat_descr descr,
+                                                          const float*              csr_val,
+                                                          const int64_t*            csr_row_ptr,
+                                                          const int32_t*            csr_col_ind,
+                                                          rocsparse_mat_info        info)
+{
+    return rocsparse_csrmv_analysis_template(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmv_analysis_i64(rocsparse_handle          handle,
+                                                          rocsparse_operation       trans,
+                                                          int32_t                   m,
+                                                          int32_t                   n,
+                                                          int64_t                   nnz,
+                                                          const rocsparse_mat_descr descr,
+                                                          const double*             csr_val,
+                                                          const int64_t*            csr_row_ptr,
+                                                          const int32_t*            csr_col_ind,
+                                                          rocsparse_mat_info        info)
+{
+    return rocsparse_csrmv_analysis_template(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+extern "C" rocsparse_status rocsparse_ccsrmv_analysis_i64(rocsparse_handle               handle,
+                                                          rocsparse_operation            trans,
+                                                          int32_t                        m,
+                                                          int32_t                        n,
+                                                          int64_t                        nnz,
+                                                          const rocsparse_mat_descr      descr,
+                                                          const rocsparse_float_complex* csr_val,
+                                                          const int64_t*     csr_row_ptr,
+                                                          const int32_t*     csr_col_ind,
+                                                          rocsparse_mat_info info)
+{
+    return rocsparse_csrmv_analysis_template(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrmv_analysis_i64(rocsparse_handle                handle,
+                                                          rocsparse_operation             trans,
+                                                          int32_t                         m,
+                                                          int32_t                         n,
+                                                          int64_t                         nnz,
+                                                          const rocsparse_mat_descr       descr,
+                                                          const rocsparse_double_complex* csr_val,
+                                                          const int64_t*     csr_row_ptr,
+                                                          const int32_t*     csr_col_ind,
+                                                          rocsparse_mat_info info)
+{
+    return rocsparse_csrmv_analysis_template(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
 extern "C" rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_info info)
 {
     // Check for valid handle and matrix descriptor
@@ -236,3 +326,189 @@ extern "C" rocsparse_status rocsparse_zcsrmv(rocsparse_handle                han
                                     beta,
                                     y);
 }
+
+extern "C" rocsparse_status rocsparse_shcsrmv(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             nnz,
+                                              const float*              alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const rocsparse_half*     csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              const float*              x,
+                                              const float*              beta,
+                                              float*                    y)
+{
+    return rocsparse_csrmv_template(handle,
+                                    trans,
+                                    m,
+                                    n,
+                                    nnz,
+                                    alpha,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    info,
+                                    x,
+                                    beta,
+                                    y);
+}
+
+extern "C" rocsparse_status rocsparse_sbcsrmv(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             nnz,
+                                              const float*              alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const rocsparse_bfloat16* csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              const float*              x,
+                                              const float*              beta,
+                                              float*                    y)
+{
+    return rocsparse_csrmv_template(handle,
+                                    trans,
+                                    m,
+                                    n,
+                                    nnz,
+                                    alpha,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    info,
+                                    x,
+                                    beta,
+                                    y);
+}
+
+extern "C" rocsparse_status rocsparse_scsrmv_i64(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 int32_t                   m,
+                                                 int32_t                   n,
+                                                 int64_t                   nnz,
+                                                 const float*              alpha,
+                                                 const rocsparse_mat_descr descr,
+                                                 const float*              csr_val,
+                                                 const int64_t*            csr_row_ptr,
+                                                 const int32_t*            csr_col_ind,
+                                                 rocsparse_mat_info        info,
+                                                 const float*              x,
+                                                 const float*              beta,
+                                                 float*                    y)
+{
+    return rocsparse_csrmv_template(handle,
+                                    trans,
+                                    m,
+                                    n,
+                                    nnz,
+                                    alpha,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    info,
+                                    x,
+                                    beta,
+                                    y);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmv_i64(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 int32_t                   m,
+                                                 int32_t                   n,
+                                                 int64_t                   nnz,
+                                                 const double*             alpha,
+                                                 const rocsparse_mat_descr descr,
+                                                 const double*             csr_val,
+                                                 const int64_t*            csr_row_ptr,
+                                                 const int32_t*            csr_col_ind,
+                                                 rocsparse_mat_info        info,
+                                                 const double*             x,
+                                                 const double*             beta,
+                                                 double*                   y)
+{
+    return rocsparse_csrmv_template(handle,
+                                    trans,
+                                    m,
+                                    n,
+                                    nnz,
+                                    alpha,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    info,
+                                    x,
+                                    beta,
+                                    y);
+}
+
+extern "C" rocsparse_status rocsparse_ccsrmv_i64(rocsparse_handle               handle,
+                                                 rocsparse_operation            trans,
+                                                 int32_t                        m,
+                                                 int32_t                        n,
+                                                 int64_t                        nnz,
+                                                 const rocsparse_float_complex* alpha,
+                                                 const rocsparse_mat_descr      descr,
+                                                 const rocsparse_float_complex* csr_val,
+                                                 const int64_t*                 csr_row_ptr,
+                                                 const int32_t*                 csr_col_ind,
+                                                 rocsparse_mat_info             info,
+                                                 const rocsparse_float_complex* x,
+                                                 const rocsparse_float_complex* beta,
+                                                 rocsparse_float_complex*       y)
+{
+    return rocsparse_csrmv_template(handle,
+                                    trans,
+                                    m,
+                                    n,
+                                    nnz,
+                                    alpha,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    info,
+                                    x,
+                                    beta,
+                                    y);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrmv_i64(rocsparse_handle                handle,
+                                                 rocsparse_operation             trans,
+                                                 int32_t                         m,
+                                                 int32_t                         n,
+                                                 int64_t                         nnz,
+                                                 const rocsparse_double_complex* alpha,
+                                                 const rocsparse_mat_descr       descr,
+                                                 const rocsparse_double_complex* csr_val,
+                                                 const int64_t*                  csr_row_ptr,
+                                                 const int32_t*                  csr_col_ind,
+                                                 rocsparse_mat_info              info,
+                                                 const rocsparse_double_complex* x,
+                                                 const rocsparse_double_complex* beta,
+                                                 rocsparse_double_complex*       y)
+{
+    return rocsparse_csrmv_template(handle,
+                                    trans,
+                                    m,
+                                    n,
+                                    nnz,
+                                    alpha,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    info,
+                                    x,
+                                    beta,
+                                    y);
+}
@@ -31,6 +31,7 @@
 #include "handle.h"
 #include "utility.h"
 
+#include <algorithm>
 #include <hip/hip_runtime.h>
 
 #define BLOCK_SIZE 1024
@@ -39,269 +40,140 @@
 #define WG_BITS 24
 #define ROW_BITS 32
 #define WG_SIZE 256
+#define CSRMVN_ANALYSIS_CHUNK 4096
+#define CSRMVN_ADAPTIVE_WG_PER_CU 8
 
-__attribute__((unused)) static unsigned int flp2(unsigned int x)
-{
-    x |= (x >> 1);
-    x |= (x >> 2);
-    x |= (x >> 4);
-    x |= (x >> 8);
-    x |= (x >> 16);
-    return x - (x >> 1);
-}
-
-// Short rows in CSR-Adaptive are batched together into a single row block.
-// If there are a relatively small number of these, then we choose to do
-// a horizontal reduction (groups of threads all reduce the same row).
-// If there are many threads (e.g. more threads than the maximum size
-// of our workgroup) then we choose to have each thread serially reduce
-// the row.
-// This function calculates the number of threads that could team up
-// to reduce these groups of rows. For instance, if you have a
-// workgroup size of 256 and 4 rows, you could have 64 threads
-// working on each row. If you have 5 rows, only 32 threads could
-// reliably work on each row because our reduction assumes power-of-2.
-static unsigned long long numThreadsForReduction(unsigned long long num_rows)
-{
-#if defined(__INTEL_COMPILER)
-    return WG_SIZE >> (_bit_scan_reverse(num_rows - 1) + 1);
-#elif(defined(__clang__) && __has_builtin(__builtin_clz)) \
-    || !defined(__clang) && defined(__GNUG__)             \
-           && ((__GNUC__ * 10000 + __GNUC_MINOR__ * 100 + __GNUC_PATCHLEVEL__) > 30202)
-    return (WG_SIZE >> (8 * sizeof(int) - __builtin_clz(num_rows - 1)));
-#elif defined(_MSC_VER) && (_MSC_VER >= 1400)
-    unsigned long long bit_returned;
-    _BitScanReverse(&bit_returned, (num_rows - 1));
-    return WG_SIZE >> (bit_returned + 1);
-#else
-    return flp2(WG_SIZE / num_rows);
-#endif
-}
-
-static inline void ComputeRowBlocks(unsigned long long*  rowBlocks,
-                                    size_t&              rowBlockSize,
-                                    const rocsparse_int* rowDelimiters,
-                                    rocsparse_int        nRows,
-                                    bool                 allocate_row_blocks = true)
+template <typename I, typename J, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_analysis_count_kernel(J m,
+                                      const I* __restrict__ csr_row_ptr,
+                                      unsigned long long* __restrict__ chunk_size)
 {
-    unsigned long long* rowBlocksBase;
-
-    // Start at one because of rowBlock[0]
-    rocsparse_int total_row_blocks = 1;
+    int64_t chunk = static_cast<int64_t>(hipBlockIdx_x) * (BLOCKSIZE / WF_SIZE)
+                    + hipThreadIdx_x / WF_SIZE;
+    int64_t row   = chunk * CSRMVN_ANALYSIS_CHUNK;
 
-    if(allocate_row_blocks)
+    if(row >= m)
     {
-        rowBlocksBase = rowBlocks;
-        *rowBlocks    = 0;
-        ++rowBlocks;
+        return;
     }
 
-    unsigned long long sum = 0;
-    unsigned long long i;
-    unsigned long long last_i = 0;
+    J chunk_end = min(static_cast<int64_t>(m), row + CSRMVN_ANALYSIS_CHUNK);
 
-    // Check to ensure nRows can fit in 32 bits
-    if(static_cast<unsigned long long>(nRows)
-       > static_cast<unsigned long long>(std::pow(2, ROW_BITS)))
-    {
-        fprintf(stderr, "nrow does not fit in 32 bits\n");
-        exit(1);
-    }
+    unsigned long long size = csrmvn_analysis_device<I,
+                                                     J,
+                                                     WF_SIZE,
+                                                     BLOCK_SIZE,
+                                                     BLOCK_MULTIPLIER,
+                                                     ROWS_FOR_VECTOR,
+                                                     WG_BITS,
+                                                     ROW_BITS,
+                                                     WG_SIZE>(row, chunk_end, csr_row_ptr, nullptr);
 
-    rocsparse_int consecutive_long_rows = 0;
-    for(i = 1; i <= static_cast<unsigned long long>(nRows); ++i)
+    if((hipThreadIdx_x & (WF_SIZE - 1)) == 0)
     {
-        rocsparse_int row_length = (rowDelimiters[i] - rowDelimiters[i - 1]);
-        sum += row_length;
-
-        // The following section of code calculates whether you're moving between
-        // a series of "short" rows and a series of "long" rows.
-        // This is because the reduction in CSR-Adaptive likes things to be
-        // roughly the same length. Long rows can be reduced horizontally.
-        // Short rows can be reduced one-thread-per-row. Try not to mix them.
-        if(row_length > 128)
-        {
-            ++consecutive_long_rows;
-        }
-        else if(consecutive_long_rows > 0)
-        {
-            // If it turns out we WERE in a long-row region, cut if off now.
-            if(row_length < 32) // Now we're in a short-row region
-            {
-                consecutive_long_rows = -1;
-            }
-            else
-            {
-                consecutive_long_rows++;
-            }
-        }
-
-        // If you just entered into a "long" row from a series of short rows,
-        // then we need to make sure we cut off those short rows. Put them in
-        // their own workgroup.
-        if(consecutive_long_rows == 1)
-        {
-            // Assuming there *was* a previous workgroup. If not, nothing to do here.
-            if(i - last_i > 1)
-            {
-                if(allocate_row_blocks)
-                {
-                    *rowBlocks = ((i - 1) << (64 - ROW_BITS));
-
-                    // If this row fits into CSR-Stream, calculate how many rows
-                    // can be used to do a parallel reduction.
-                    // Fill in the low-order bits with the numThreadsForRed
-                    if(((i - 1) - last_i) > static_cast<unsigned long long>(ROWS_FOR_VECTOR))
-                    {
-                        *(rowBlocks - 1) |= numThreadsForReduction((i - 1) - last_i);
-                    }
-
-                    ++rowBlocks;
-                }
-
-                ++total_row_blocks;
-                last_i = i - 1;
-                sum    = row_length;
-            }
-        }
-        else if(consecutive_long_rows == -1)
-        {
-            // We see the first short row after some long ones that
-            // didn't previously fill up a row block.
-            if(allocate_row_blocks)
-            {
-                *rowBlocks = ((i - 1) << (64 - ROW_BITS));
-                if(((i - 1) - last_i) > static_cast<unsigned long long>(ROWS_FOR_VECTOR))
-                {
-                    *(rowBlocks - 1) |= numThreadsForReduction((i - 1) - last_i);
-                }
-
-                ++rowBlocks;
-            }
-
-            ++total_row_blocks;
-            last_i                = i - 1;
-            sum                   = row_length;
-            consecutive_long_rows = 0;
-        }
-
-        // Now, what's up with this row? What did it do?
-
-        // exactly one row results in non-zero elements to be greater than blockSize
-        // This is csr-vector case; bottom WGBITS == workgroup ID
-        if((i - last_i == 1) && sum > static_cast<unsigned long long>(BLOCK_SIZE))
-        {
-            rocsparse_int numWGReq = static_cast<rocsparse_int>(
-                std::ceil(static_cast<double>(row_length) / (BLOCK_MULTIPLIER * BLOCK_SIZE)));
-
-            // Check to ensure #workgroups can fit in WGBITS bits, if not
-            // then the last workgroup will do all the remaining work
-            numWGReq = (numWGReq < static_cast<rocsparse_int>(std::pow(2, WG_BITS)))
-                           ? numWGReq
-                           : static_cast<rocsparse_int>(std::pow(2, WG_BITS));
-
-            if(allocate_row_blocks)
-            {
-                for(rocsparse_int w = 1; w < numWGReq; ++w)
-                {
-                    *rowBlocks = ((i - 1) << (64 - ROW_BITS));
-                    *rowBlocks |= static_cast<unsigned long long>(w);
-                    ++rowBlocks;
-                }
-
-                *rowBlocks = (i << (64 - ROW_BITS));
-                ++rowBlocks;
-            }
-
-            total_row_blocks += numWGReq;
-            last_i                = i;
-            sum                   = 0;
-            consecutive_long_rows = 0;
-        }
-        // more than one row results in non-zero elements to be greater than blockSize
-        // This is csr-stream case; bottom WGBITS = number of parallel reduction threads
-        else if((i - last_i > 1) && sum > static_cast<unsigned long long>(BLOCK_SIZE))
-        {
-            // This row won't fit, so back off one.
-            --i;
-
-            if(allocate_row_blocks)
-            {
-                *rowBlocks = (i << (64 - ROW_BITS));
-                if((i - last_i) > static_cast<unsigned long long>(ROWS_FOR_VECTOR))
-                {
-                    *(rowBlocks - 1) |= numThreadsForReduction(i - last_i);
-                }
-
-                ++rowBlocks;
-            }
-
-            ++total_row_blocks;
-            last_i                = i;
-            sum                   = 0;
-            consecutive_long_rows = 0;
-        }
-        // This is csr-stream case; bottom WGBITS = number of parallel reduction threads
-        else if(sum == static_cast<unsigned long long>(BLOCK_SIZE))
-        {
-            if(allocate_row_blocks)
-            {
-                *rowBlocks = (i << (64 - ROW_BITS));
-                if((i - last_i) > static_cast<unsigned long long>(ROWS_FOR_VECTOR))
-                {
-                    *(rowBlocks - 1) |= numThreadsForReduction(i - last_i);
-                }
+        chunk_size[chunk] = size;
+    }
+}
 
-                ++rowBlocks;
-            }
+template <unsigned int BLOCKSIZE, typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_analysis_scan_kernel(J      m,
+                                     size_t num_chunks,
+                                     unsigned long long* __restrict__ chunk_offset,
+                                     unsigned long long* __restrict__ row_blocks,
+                                     size_t max_size)
+{
+    csrmvn_analysis_scan_device<BLOCKSIZE, ROW_BITS>(
+        m, num_chunks, chunk_offset, row_blocks, max_size);
+}
 
-            ++total_row_blocks;
-            last_i                = i;
-            sum                   = 0;
-            consecutive_long_rows = 0;
-        }
-    }
+template <typename I, typename J, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_analysis_fill_kernel(J m,
+                                     const I* __restrict__ csr_row_ptr,
+                                     const unsigned long long* __restrict__ chunk_offset,
+                                     unsigned long long* __restrict__ row_blocks)
+{
+    int64_t chunk = static_cast<int64_t>(hipBlockIdx_x) * (BLOCKSIZE / WF_SIZE)
+                    + hipThreadIdx_x / WF_SIZE;
+    int64_t row   = chunk * CSRMVN_ANALYSIS_CHUNK;
 
-    // If we didn't fill a row block with the last row, make sure we don't lose it.
-    if(allocate_row_blocks
-       && (*(rowBlocks - 1) >> (64 - ROW_BITS)) != static_cast<unsigned long long>(nRows))
+    if(row >= m)
     {
-        *rowBlocks = (static_cast<unsigned long long>(nRows) << (64 - ROW_BITS));
-        if((nRows - last_i) > static_cast<unsigned long long>(ROWS_FOR_VECTOR))
-        {
-            *(rowBlocks - 1) |= numThreadsForReduction(i - last_i);
-        }
-
-        ++rowBlocks;
+        return;
     }
 
-    ++total_row_blocks;
+    J chunk_end = min(static_cast<int64_t>(m), row + CSRMVN_ANALYSIS_CHUNK);
 
-    if(allocate_row_blocks)
-    {
-        size_t dist = std::distance(rowBlocksBase, rowBlocks);
-        assert((2 * dist) <= rowBlockSize);
-        // Update the size of rowBlocks to reflect the actual amount of memory used
-        // We're multiplying the size by two because the extended precision form of
-        // CSR-Adaptive requires more space for the final global reduction.
-        rowBlockSize = 2 * dist;
-    }
-    else
-    {
-        rowBlockSize = 2 * total_row_blocks;
-    }
+    csrmvn_analysis_device<I,
+                           J,
+                           WF_SIZE,
+                           BLOCK_SIZE,
+                           BLOCK_MULTIPLIER,
+                           ROWS_FOR_VECTOR,
+                           WG_BITS,
+                           ROW_BITS,
+                           WG_SIZE>(row, chunk_end, csr_row_ptr, row_blocks + chunk_offset[chunk]);
+}
+
+template <typename I, typename J, unsigned int WF_SIZE>
+static void csrmvn_analysis_launch(hipStream_t          stream,
+                                   J                    m,
+                                   const I*             csr_row_ptr,
+                                   rocsparse_csrmv_info info)
+{
+#define CSRMVN_ANALYSIS_DIM 256
+    unsigned long long* chunk_offset = info->row_blocks + info->max_size + 1;
+
+    dim3 analysis_blocks((info->num_chunks - 1) / (CSRMVN_ANALYSIS_DIM / WF_SIZE) + 1);
+    dim3 analysis_threads(CSRMVN_ANALYSIS_DIM);
+
+    // Count the row blocks of each chunk
+    hipLaunchKernelGGL((csrmvn_analysis_count_kernel<I, J, CSRMVN_ANALYSIS_DIM, WF_SIZE>),
+                       analysis_blocks,
+                       analysis_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       chunk_offset);
+
+    // Offset of each chunk into the row blocks array
+    hipLaunchKernelGGL((csrmvn_analysis_scan_kernel<1024>),
+                       dim3(1),
+                       dim3(1024),
+                       0,
+                       stream,
+                       m,
+                       info->num_chunks,
+                       chunk_offset,
+                       info->row_blocks,
+                       info->max_size);
+
+    // Write the row blocks of each chunk
+    hipLaunchKernelGGL((csrmvn_analysis_fill_kernel<I, J, CSRMVN_ANALYSIS_DIM, WF_SIZE>),
+                       analysis_blocks,
+                       analysis_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       chunk_offset,
+                       info->row_blocks);
+#undef CSRMVN_ANALYSIS_DIM
 }
 
-template <typename T>
+template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          handle,
                                                    rocsparse_operation       trans,
-                                                   rocsparse_int             m,
-                                                   rocsparse_int             n,
-                                                   rocsparse_int             nnz,
+                                                   J                         m,
+                                                   J                         n,
+                                                   I                         nnz,
                                                    const rocsparse_mat_descr descr,
                                                    const T*                  csr_val,
-                                                   const rocsparse_int*      csr_row_ptr,
-                                                   const rocsparse_int*      csr_col_ind,
+                                                   const I*                  csr_row_ptr,
+                                                   const J*                  csr_col_ind,
                                                    rocsparse_mat_info        info)
 {
     // Check for valid handle and matrix descriptor
@@ -320,7 +192,7 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
 
     // Logging
     log_trace(handle,
-              "rocsparse_csrmv_analysis",
+              appendIJ<I, J>("rocsparse_csrmv_analysis"),
               trans,
               m,
               n,
@@ -385,40 +257,37 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
     // Stream
     hipStream_t stream = handle->stream;
 
-    // row blocks size
-    info->csrmv_info->size = 0;
-
-    // Temporary arrays to hold device data
-    std::vector<rocsparse_int> hptr(m + 1);
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        hptr.data(), csr_row_ptr, sizeof(rocsparse_int) * (m + 1), hipMemcpyDeviceToHost, stream));
-
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
-
-    // Determine row blocks array size
-    ComputeRowBlocks((unsigned long long*)NULL, info->csrmv_info->size, hptr.data(), m, false);
-
-    // Create row blocks structure
-    std::vector<unsigned long long> row_blocks(info->csrmv_info->size, 0);
-
-    ComputeRowBlocks(row_blocks.data(), info->csrmv_info->size, hptr.data(), m, true);
-
-    // Allocate memory on device to hold csrmv info, if required
-    if(info->csrmv_info->size > 0)
+    // Row blocks are computed independently for each chunk of rows, the first row of
+    // each chunk starts a new row block
+    info->csrmv_info->num_chunks = (m - 1) / CSRMVN_ANALYSIS_CHUNK + 1;
+
+    // Each row block holds at least one distinct row, and a long row with r entries
+    // requires (r - 1) / (BLOCK_MULTIPLIER * BLOCK_SIZE) additional entries. Thus, the
+    // number of row blocks does not exceed m + nnz / (BLOCK_MULTIPLIER * BLOCK_SIZE).
+    // One more entry marks the end of the final row block.
+    info->csrmv_info->max_size
+        = static_cast<size_t>(m) + nnz / (BLOCK_MULTIPLIER * BLOCK_SIZE) + 1;
+
+    // Allocate memory on device to hold csrmv info. The row blocks are followed by
+    // the number of entries and the offset of each chunk.
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->csrmv_info->row_blocks,
+                                  sizeof(unsigned long long)
+                                      * (info->csrmv_info->max_size + 1
+                                         + info->csrmv_info->num_chunks)));
+
+    // Compute row blocks on the device, such that no host synchronization is required.
+    // The number of row blocks remains on the device.
+    if(handle->wavefront_size == 32)
     {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->csrmv_info->row_blocks,
-                                      sizeof(unsigned long long) * info->csrmv_info->size));
-
-        // Copy row blocks information to device
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csrmv_info->row_blocks,
-                                           row_blocks.data(),
-                                           sizeof(unsigned long long) * info->csrmv_info->size,
-                                           hipMemcpyHostToDevice,
-                                           stream));
-
-        // Wait for device transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        csrmvn_analysis_launch<I, J, 32>(stream, m, csr_row_ptr, info->csrmv_info);
+    }
+    else if(handle->wavefront_size == 64)
+    {
+        csrmvn_analysis_launch<I, J, 64>(stream, m, csr_row_ptr, info->csrmv_info);
+    }
+    else
+    {
+        return rocsparse_status_arch_mismatch;
     }
 
     // Store some pointers to verify correct execution
@@ -433,93 +302,131 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
     return rocsparse_status_success;
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+template <typename I,
+          typename     J,
+          typename     T,
+          typename     U,
+          unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE>
 __launch_bounds__(BLOCKSIZE) __global__
-    void csrmvn_general_kernel_host_pointer(rocsparse_int m,
-                                            T             alpha,
-                                            const rocsparse_int* __restrict__ csr_row_ptr,
-                                            const rocsparse_int* __restrict__ csr_col_ind,
-                                            const T* __restrict__ csr_val,
+    void csrmvn_general_kernel_host_pointer(J m,
+                                            T alpha,
+                                            const I* __restrict__ csr_row_ptr,
+                                            const J* __restrict__ csr_col_ind,
+                                            const U* __restrict__ csr_val,
                                             const T* __restrict__ x,
                                             T beta,
                                             T* __restrict__ y,
                                             rocsparse_index_base idx_base)
 {
-    csrmvn_general_device<T, BLOCKSIZE, WF_SIZE>(
+    csrmvn_general_device<I, J, T, U, BLOCKSIZE, WF_SIZE>(
         m, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, idx_base);
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+template <typename I,
+          typename     J,
+          typename     T,
+          typename     U,
+          unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE>
 __launch_bounds__(BLOCKSIZE) __global__
-    void csrmvn_general_kernel_device_pointer(rocsparse_int m,
-                                              const T*      alpha,
-                                              const rocsparse_int* __restrict__ csr_row_ptr,
-                                              const rocsparse_int* __restrict__ csr_col_ind,
-                                              const T* __restrict__ csr_val,
+    void csrmvn_general_kernel_device_pointer(J        m,
+                                              const T* alpha,
+                                              const I* __restrict__ csr_row_ptr,
+                                              const J* __restrict__ csr_col_ind,
+                                              const U* __restrict__ csr_val,
                                               const T* __restrict__ x,
                                               const T* beta,
                                               T* __restrict__ y,
                                               rocsparse_index_base idx_base)
 {
-    csrmvn_general_device<T, BLOCKSIZE, WF_SIZE>(
+    csrmvn_general_device<I, J, T, U, BLOCKSIZE, WF_SIZE>(
         m, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, *beta, y, idx_base);
 }
 
-template <typename T>
+template <typename I, typename J, typename T, typename U>
 __launch_bounds__(WG_SIZE) __global__
     void csrmvn_adaptive_kernel_host_pointer(unsigned long long* __restrict__ row_blocks,
+                                             size_t max_size,
+                                             unsigned long long* __restrict__ counter,
                                              T alpha,
-                                             const rocsparse_int* __restrict__ csr_row_ptr,
-                                             const rocsparse_int* __restrict__ csr_col_ind,
-                                             const T* __restrict__ csr_val,
+                                             const I* __restrict__ csr_row_ptr,
+                                             const J* __restrict__ csr_col_ind,
+                                             const U* __restrict__ csr_val,
                                              const T* __restrict__ x,
                                              T beta,
                                              T* __restrict__ y,
                                              rocsparse_index_base idx_base)
 {
-    csrmvn_adaptive_device<T,
-                           BLOCK_SIZE,
-                           BLOCK_MULTIPLIER,
-                           ROWS_FOR_VECTOR,
-                           WG_BITS,
-                           ROW_BITS,
-                           WG_SIZE>(
-        row_blocks, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, idx_base);
+    csrmvn_adaptive_persistent_device<I,
+                                      J,
+                                      T,
+                                      U,
+                                      BLOCK_SIZE,
+                                      BLOCK_MULTIPLIER,
+                                      ROWS_FOR_VECTOR,
+                                      WG_BITS,
+                                      ROW_BITS,
+                                      WG_SIZE>(row_blocks,
+                                               max_size,
+                                               counter,
+                                               alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               x,
+                                               beta,
+                                               y,
+                                               idx_base);
 }
 
-template <typename T>
+template <typename I, typename J, typename T, typename U>
 __launch_bounds__(WG_SIZE) __global__
     void csrmvn_adaptive_kernel_device_pointer(unsigned long long* __restrict__ row_blocks,
+                                               size_t max_size,
+                                               unsigned long long* __restrict__ counter,
                                                const T* alpha,
-                                               const rocsparse_int* __restrict__ csr_row_ptr,
-                                               const rocsparse_int* __restrict__ csr_col_ind,
-                                               const T* __restrict__ csr_val,
+                                               const I* __restrict__ csr_row_ptr,
+                                               const J* __restrict__ csr_col_ind,
+                                               const U* __restrict__ csr_val,
                                                const T* __restrict__ x,
                                                const T* beta,
                                                T* __restrict__ y,
                                                rocsparse_index_base idx_base)
 {
-    csrmvn_adaptive_device<T,
-                           BLOCK_SIZE,
-                           BLOCK_MULTIPLIER,
-                           ROWS_FOR_VECTOR,
-                           WG_BITS,
-                           ROW_BITS,
-                           WG_SIZE>(
-        row_blocks, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, *beta, y, idx_base);
+    csrmvn_adaptive_persistent_device<I,
+                                      J,
+                                      T,
+                                      U,
+                                      BLOCK_SIZE,
+                                      BLOCK_MULTIPLIER,
+                                      ROWS_FOR_VECTOR,
+                                      WG_BITS,
+                                      ROW_BITS,
+                                      WG_SIZE>(row_blocks,
+                                               max_size,
+                                               counter,
+                                               *alpha,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csr_val,
+                                               x,
+                                               *beta,
+                                               y,
+                                               idx_base);
 }
 
-template <typename T>
+template <typename I, typename J, typename T, typename U>
 rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
                                           rocsparse_operation       trans,
-                                          rocsparse_int             m,
-                                          rocsparse_int             n,
-                                          rocsparse_int             nnz,
+                                          J                         m,
+                                          J                         n,
+                                          I                         nnz,
                                           const T*                  alpha,
                                           const rocsparse_mat_descr descr,
-                                          const T*                  csr_val,
-                                          const rocsparse_int*      csr_row_ptr,
-                                          const rocsparse_int*      csr_col_ind,
+                                          const U*                  csr_val,
+                                          const I*                  csr_row_ptr,
+                                          const J*                  csr_col_ind,
                                           rocsparse_mat_info        info,
                                           const T*                  x,
                                           const T*                  beta,
@@ -539,7 +446,7 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrmv"),
+                  appendIJ<I, J>(replaceXY<T, U>("rocsparse_XYcsrmv")),
                   trans,
                   m,
                   n,
@@ -555,8 +462,10 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
                   (const void*&)info);
 
         log_bench(handle,
-                  "./rocsparse-bench -f csrmv -r",
-                  replaceX<T>("X"),
+                  appendIJ<I, J>(std::is_same<T, U>() ? "./rocsparse-bench -f csrmv"
+                                                      : "./rocsparse-bench -f csrmv_mixed")
+                      + " -r",
+                  replaceX<U>("X"),
                   "--mtx <matrix.mtx> "
                   "--alpha",
                   *alpha,
@@ -566,7 +475,7 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
     else
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrmv"),
+                  appendIJ<I, J>(replaceXY<T, U>("rocsparse_XYcsrmv")),
                   trans,
                   m,
                   n,
@@ -674,17 +583,17 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
     }
 }
 
-template <typename T>
+template <typename I, typename J, typename T, typename U>
 rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle          handle,
                                                   rocsparse_operation       trans,
-                                                  rocsparse_int             m,
-                                                  rocsparse_int             n,
-                                                  rocsparse_int             nnz,
+                                                  J                         m,
+                                                  J                         n,
+                                                  I                         nnz,
                                                   const T*                  alpha,
                                                   const rocsparse_mat_descr descr,
-                                                  const T*                  csr_val,
-                                                  const rocsparse_int*      csr_row_ptr,
-                                                  const rocsparse_int*      csr_col_ind,
+                                                  const U*                  csr_val,
+                                                  const I*                  csr_row_ptr,
+                                                  const J*                  csr_col_ind,
                                                   const T*                  x,
                                                   const T*                  beta,
                                                   T*                        y)
@@ -696,7 +605,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle          hand
     if(trans == rocsparse_operation_none)
     {
 #define CSRMVN_DIM 512
-        rocsparse_int nnz_per_row = nnz / m;
+        I nnz_per_row = nnz / m;
 
         dim3 csrmvn_blocks((m - 1) / CSRMVN_DIM + 1);
         dim3 csrmvn_threads(CSRMVN_DIM);
@@ -707,193 +616,204 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle          hand
             {
                 if(nnz_per_row < 4)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, CSRMVN_DIM, 2>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_device_pointer<I, J, T, U, CSRMVN_DIM, 2>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        beta,
+                        y,
+                        descr->base);
                 }
                 else if(nnz_per_row < 8)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, CSRMVN_DIM, 4>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_device_pointer<I, J, T, U, CSRMVN_DIM, 4>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        beta,
+                        y,
+                        descr->base);
                 }
                 else if(nnz_per_row < 16)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, CSRMVN_DIM, 8>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_device_pointer<I, J, T, U, CSRMVN_DIM, 8>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        beta,
+                        y,
+                        descr->base);
                 }
                 else if(nnz_per_row < 32)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, CSRMVN_DIM, 16>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_device_pointer<I, J, T, U, CSRMVN_DIM, 16>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        beta,
+                        y,
+                        descr->base);
                 }
                 else
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, CSRMVN_DIM, 32>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_device_pointer<I, J, T, U, CSRMVN_DIM, 32>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        beta,
+                        y,
+                        descr->base);
                 }
             }
             else if(handle->wavefront_size == 64)
             {
                 if(nnz_per_row < 4)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, CSRMVN_DIM, 2>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_device_pointer<I, J, T, U, CSRMVN_DIM, 2>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        beta,
+                        y,
+                        descr->base);
                 }
                 else if(nnz_per_row < 8)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, CSRMVN_DIM, 4>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_device_pointer<I, J, T, U, CSRMVN_DIM, 4>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        beta,
+                        y,
+                        descr->base);
                 }
                 else if(nnz_per_row < 16)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, CSRMVN_DIM, 8>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_device_pointer<I, J, T, U, CSRMVN_DIM, 8>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        beta,
+                        y,
+                        descr->base);
                 }
                 else if(nnz_per_row < 32)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, CSRMVN_DIM, 16>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_device_pointer<I, J, T, U, CSRMVN_DIM, 16>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        beta,
+                        y,
+                        descr->base);
                 }
                 else if(nnz_per_row < 64)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, CSRMVN_DIM, 32>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_device_pointer<I, J, T, U, CSRMVN_DIM, 32>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        beta,
+                        y,
+                        descr->base);
                 }
                 else
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, CSRMVN_DIM, 64>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_device_pointer<I, J, T, U, CSRMVN_DIM, 64>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        beta,
+                        y,
+                        descr->base);
                 }
             }
             else
@@ -912,193 +832,204 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle          hand
             {
                 if(nnz_per_row < 4)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, CSRMVN_DIM, 2>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_host_pointer<I, J, T, U, CSRMVN_DIM, 2>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        *alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        *beta,
+                        y,
+                        descr->base);
                 }
                 else if(nnz_per_row < 8)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, CSRMVN_DIM, 4>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_host_pointer<I, J, T, U, CSRMVN_DIM, 4>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        *alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        *beta,
+                        y,
+                        descr->base);
                 }
                 else if(nnz_per_row < 16)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, CSRMVN_DIM, 8>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_host_pointer<I, J, T, U, CSRMVN_DIM, 8>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        *alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        *beta,
+                        y,
+                        descr->base);
                 }
                 else if(nnz_per_row < 32)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, CSRMVN_DIM, 16>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_host_pointer<I, J, T, U, CSRMVN_DIM, 16>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        *alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        *beta,
+                        y,
+                        descr->base);
                 }
                 else
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, CSRMVN_DIM, 32>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_host_pointer<I, J, T, U, CSRMVN_DIM, 32>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        *alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        *beta,
+                        y,
+                        descr->base);
                 }
             }
             else if(handle->wavefront_size == 64)
             {
                 if(nnz_per_row < 4)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, CSRMVN_DIM, 2>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_host_pointer<I, J, T, U, CSRMVN_DIM, 2>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        *alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        *beta,
+                        y,
+                        descr->base);
                 }
                 else if(nnz_per_row < 8)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, CSRMVN_DIM, 4>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_host_pointer<I, J, T, U, CSRMVN_DIM, 4>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        *alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        *beta,
+                        y,
+                        descr->base);
                 }
                 else if(nnz_per_row < 16)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, CSRMVN_DIM, 8>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_host_pointer<I, J, T, U, CSRMVN_DIM, 8>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        *alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        *beta,
+                        y,
+                        descr->base);
                 }
                 else if(nnz_per_row < 32)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, CSRMVN_DIM, 16>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_host_pointer<I, J, T, U, CSRMVN_DIM, 16>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        *alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        *beta,
+                        y,
+                        descr->base);
                 }
                 else if(nnz_per_row < 64)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, CSRMVN_DIM, 32>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_host_pointer<I, J, T, U, CSRMVN_DIM, 32>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        *alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        *beta,
+                        y,
+                        descr->base);
                 }
                 else
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, CSRMVN_DIM, 64>),
-                                       csrmvn_blocks,
-                                       csrmvn_threads,
-                                       0,
-                                       stream,
-                                       m,
-                                       *alpha,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       csr_val,
-                                       x,
-                                       *beta,
-                                       y,
-                                       descr->base);
+                    hipLaunchKernelGGL(
+                        (csrmvn_general_kernel_host_pointer<I, J, T, U, CSRMVN_DIM, 64>),
+                        csrmvn_blocks,
+                        csrmvn_threads,
+                        0,
+                        stream,
+                        m,
+                        *alpha,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        csr_val,
+                        x,
+                        *beta,
+                        y,
+                        descr->base);
                 }
             }
             else
@@ -1116,17 +1047,17 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle          hand
     return rocsparse_status_success;
 }
 
-template <typename T>
+template <typename I, typename J, typename T, typename U>
 rocsparse_status rocsparse_csrmv_adaptive_template(rocsparse_handle          handle,
                                                    rocsparse_operation       trans,
-                                                   rocsparse_int             m,
-                                                   rocsparse_int             n,
-                                                   rocsparse_int             nnz,
+                                                   J                         m,
+                                                   J                         n,
+                                                   I                         nnz,
                                                    const T*                  alpha,
                                                    const rocsparse_mat_descr descr,
-                                                   const T*                  csr_val,
-                                                   const rocsparse_int*      csr_row_ptr,
-                                                   const rocsparse_int*      csr_col_ind,
+                                                   const U*                  csr_val,
+                                                   const I*                  csr_row_ptr,
+                                                   const J*                  csr_col_ind,
                                                    rocsparse_csrmv_info      info,
                                                    const T*                  x,
                                                    const T*                  beta,
@@ -1168,17 +1099,31 @@ rocsparse_status rocsparse_csrmv_adaptive_template(rocsparse_handle          han
     // Run different csrmv kernels
     if(trans == rocsparse_operation_none)
     {
-        dim3 csrmvn_blocks((info->size / 2) - 1);
+        // The number of row blocks is only known on the device, workgroups fetch
+        // row blocks from a counter that is reset for each call. The counter lives
+        // in the handle device buffer, such that calls sharing the csrmv info on
+        // different streams or handles do not interfere.
+        size_t max_wg = static_cast<size_t>(handle->properties.multiProcessorCount)
+                        * CSRMVN_ADAPTIVE_WG_PER_CU;
+
+        dim3 csrmvn_blocks(std::min(info->max_size - 1, max_wg));
         dim3 csrmvn_threads(WG_SIZE);
 
+        RETURN_IF_ROCSPARSE_ERROR(handle->alloc_buffer());
+        unsigned long long* counter = reinterpret_cast<unsigned long long*>(handle->buffer);
+
         if(handle->pointer_mode == rocsparse_pointer_mode_device)
         {
-            hipLaunchKernelGGL((csrmvn_adaptive_kernel_device_pointer<T>),
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(counter, 0, sizeof(unsigned long long), stream));
+
+            hipLaunchKernelGGL((csrmvn_adaptive_kernel_device_pointer<I, J, T, U>),
                                csrmvn_blocks,
                                csrmvn_threads,
                                0,
                                stream,
                                info->row_blocks,
+                               info->max_size,
+                               counter,
                                alpha,
                                csr_row_ptr,
                                csr_col_ind,
@@ -1195,12 +1140,16 @@ rocsparse_status rocsparse_csrmv_adaptive_template(rocsparse_handle          han
                 return rocsparse_status_success;
             }
 
-            hipLaunchKernelGGL((csrmvn_adaptive_kernel_host_pointer<T>),
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(counter, 0, sizeof(unsigned long long), stream));
+
+            hipLaunchKernelGGL((csrmvn_adaptive_kernel_host_pointer<I, J, T, U>),
                                csrmvn_blocks,
                                csrmvn_threads,
                                0,
                                stream,
                                info->row_blocks,
+                               info->max_size,
+                               counter,
                                *alpha,
                                csr_row_ptr,
                                csr_col_ind,
@@ -0,0 +1,307 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_csrmv_format.hpp"
+#include "rocsparse.h"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status
+    rocsparse_scsrmv_format_analysis(rocsparse_handle          handle,
+                                     rocsparse_operation       trans,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     const float*              csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_int             benchmark_iter,
+                                     rocsparse_mat_info        info)
+{
+    return rocsparse_csrmv_format_analysis_template(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, benchmark_iter, info);
+}
+
+extern "C" rocsparse_status
+    rocsparse_dcsrmv_format_analysis(rocsparse_handle          handle,
+                                     rocsparse_operation       trans,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     const double*             csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_int             benchmark_iter,
+                                     rocsparse_mat_info        info)
+{
+    return rocsparse_csrmv_format_analysis_template(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, benchmark_iter, info);
+}
+
+extern "C" rocsparse_status
+    rocsparse_ccsrmv_format_analysis(rocsparse_handle               handle,
+                                     rocsparse_operation            trans,
+                                     rocsparse_int                  m,
+                                     rocsparse_int                  n,
+                                     rocsparse_int                  nnz,
+                                     const rocsparse_mat_descr      descr,
+                                     const rocsparse_float_complex* csr_val,
+                                     const rocsparse_int*           csr_row_ptr,
+                                     const rocsparse_int*           csr_col_ind,
+                                     rocsparse_int                  benchmark_iter,
+                                     rocsparse_mat_info             info)
+{
+    return rocsparse_csrmv_format_analysis_template(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, benchmark_iter, info);
+}
+
+extern "C" rocsparse_status
+    rocsparse_zcsrmv_format_analysis(rocsparse_handle                handle,
+                                     rocsparse_operation             trans,
+                                     rocsparse_int                   m,
+                                     rocsparse_int                   n,
+                                     rocsparse_int                   nnz,
+                                     const rocsparse_mat_descr       descr,
+                                     const rocsparse_double_complex* csr_val,
+                                     const rocsparse_int*            csr_row_ptr,
+                                     const rocsparse_int*            csr_col_ind,
+                                     rocsparse_int                   benchmark_iter,
+                                     rocsparse_mat_info              info)
+{
+    return rocsparse_csrmv_format_analysis_template(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, benchmark_iter, info);
+}
+
+extern "C" rocsparse_status rocsparse_csrmv_format_get_info(rocsparse_handle         handle,
+                                                            const rocsparse_mat_info info,
+                                                            rocsparse_spmv_format*   format,
+                                                            rocsparse_int*           bsr_dim,
+                                                            float*                   predicted_cost,
+                                                            float*                   measured_cost)
+{
+    // Check for valid handle and matrix info
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrmv_format_get_info",
+              (const void*&)info,
+              (const void*&)format,
+              (const void*&)bsr_dim,
+              (const void*&)predicted_cost,
+              (const void*&)measured_cost);
+
+    // Check for valid analysis
+    if(info->csrmv_format_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_csrmv_format_info format_info = info->csrmv_format_info;
+
+    // All output arguments are optional
+    if(format != nullptr)
+    {
+        *format = format_info->format;
+    }
+
+    if(bsr_dim != nullptr)
+    {
+        *bsr_dim = format_info->bsr_dim;
+    }
+
+    for(int f = 0; f < CSRMV_FORMAT_NUM; ++f)
+    {
+        if(predicted_cost != nullptr)
+        {
+            predicted_cost[f] = format_info->predicted_cost[f];
+        }
+
+        if(measured_cost != nullptr)
+        {
+            measured_cost[f] = format_info->measured_cost[f];
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrmv_format_clear(rocsparse_handle   handle,
+                                                         rocsparse_mat_info info)
+{
+    // Check for valid handle and matrix info
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrmv_format_clear", (const void*&)info);
+
+    // Destroy csrmv_format info struct
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_format_info(info->csrmv_format_info));
+    info->csrmv_format_info = nullptr;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsrmv_format(rocsparse_handle          handle,
+                                                    rocsparse_operation       trans,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    rocsparse_int             nnz,
+                                                    const float*              alpha,
+                                                    const rocsparse_mat_descr descr,
+                                                    const float*              csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_mat_info        info,
+                                                    const float*              x,
+                                                    const float*              beta,
+                                                    float*                    y)
+{
+    return rocsparse_csrmv_format_template(handle,
+                                           trans,
+                                           m,
+                                           n,
+                                           nnz,
+                                           alpha,
+                                           descr,
+                                           csr_val,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           info,
+                                           x,
+                                           beta,
+                                           y);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmv_format(rocsparse_handle          handle,
+                                                    rocsparse_operation       trans,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    rocsparse_int             nnz,
+                                                    const double*             alpha,
+                                                    const rocsparse_mat_descr descr,
+                                                    const double*             csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_mat_info        info,
+                                                    const double*             x,
+                                                    const double*             beta,
+                                                    double*                   y)
+{
+    return rocsparse_csrmv_format_template(handle,
+                                           trans,
+                                           m,
+                                           n,
+                                           nnz,
+                                           alpha,
+                                           descr,
+                                           csr_val,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           info,
+                                           x,
+                                           beta,
+                                           y);
+}
+
+extern "C" rocsparse_status rocsparse_ccsrmv_format(rocsparse_handle               handle,
+                                                    rocsparse_operation            trans,
+                                                    rocsparse_int                  m,
+                                                    rocsparse_int                  n,
+                                                    rocsparse_int                  nnz,
+                                                    const rocsparse_float_complex* alpha,
+                                                    const rocsparse_mat_descr      descr,
+                                                    const rocsparse_float_complex* csr_val,
+                                                    const rocsparse_int*           csr_row_ptr,
+                                                    const rocsparse_int*           csr_col_ind,
+                                                    rocsparse_mat_info             info,
+                                                    const rocsparse_float_complex* x,
+                                                    const rocsparse_float_complex* beta,
+                                                    rocsparse_float_complex*       y)
+{
+    return rocsparse_csrmv_format_template(handle,
+                                           trans,
+                                           m,
+                                           n,
+                                           nnz,
+                                           alpha,
+                                           descr,
+                                           csr_val,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           info,
+                                           x,
+                                           beta,
+                                           y);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrmv_format(rocsparse_handle                handle,
+                                                    rocsparse_operation             trans,
+                                                    rocsparse_int                   m,
+                                                    rocsparse_int                   n,
+                                                    rocsparse_int                   nnz,
+                                                    const rocsparse_double_complex* alpha,
+                                                    const rocsparse_mat_descr       descr,
+                                                    const rocsparse_double_complex* csr_val,
+                                                    const rocsparse_int*            csr_row_ptr,
+                                                    const rocsparse_int*            csr_col_ind,
+                                                    rocsparse_mat_info              info,
+                                                    const rocsparse_double_complex* x,
+                                                    const rocsparse_double_complex* beta,
+                                                    rocsparse_double_complex*       y)
+{
+    return rocsparse_csrmv_format_template(handle,
+                                           trans,
+                                           m,
+                                           n,
+                                           nnz,
+                                           alpha,
+                                           descr,
+                                           csr_val,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           info,
+                                           x,
+                                           beta,
+                                           y);
+}
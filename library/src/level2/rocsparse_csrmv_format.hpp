@@ -0,0 +1,795 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRMV_FORMAT_HPP
+#define ROCSPARSE_CSRMV_FORMAT_HPP
+
+#include "../conversion/rocsparse_csr2bsr.hpp"
+#include "../conversion/rocsparse_csr2bsr_block_dim_analysis.hpp"
+#include "../conversion/rocsparse_csr2ell.hpp"
+#include "../conversion/rocsparse_csr2hyb.hpp"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "rocsparse_bsrmv.hpp"
+#include "rocsparse_csrmv.hpp"
+#include "rocsparse_ellmv.hpp"
+#include "rocsparse_hybmv.hpp"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+#include <limits>
+
+// Number of storage formats considered by the analysis
+#define CSRMV_FORMAT_NUM (rocsparse_spmv_format_bsr + 1)
+
+// Candidate block dimensions of the BSR storage format
+static constexpr rocsparse_int csrmv_format_bsr_dims[] = {2, 3, 4, 8, 16};
+
+// Memory traffic of csrmv in bytes, the reference of all predicted costs
+template <typename T>
+static inline double csrmv_format_csr_bytes(rocsparse_int m, rocsparse_int n, rocsparse_int nnz)
+{
+    return (m + 1.0 + nnz) * sizeof(rocsparse_int) + (m + n + nnz) * sizeof(T);
+}
+
+// Memory traffic of ellmv in bytes, padded entries are loaded as well
+template <typename T>
+static inline double
+    csrmv_format_ell_bytes(rocsparse_int m, rocsparse_int n, rocsparse_int ell_width)
+{
+    return static_cast<double>(m) * ell_width * (sizeof(rocsparse_int) + sizeof(T))
+           + (m + static_cast<double>(n)) * sizeof(T);
+}
+
+// Memory traffic of hybmv in bytes, the COO part updates y in a second pass
+template <typename T>
+static inline double csrmv_format_hyb_bytes(rocsparse_int m,
+                                            rocsparse_int n,
+                                            rocsparse_int ell_width,
+                                            rocsparse_int coo_nnz)
+{
+    return csr2hyb_partition_bytes<T>(m, ell_width, coo_nnz)
+           + (m + static_cast<double>(n)) * sizeof(T);
+}
+
+// Converts the CSR matrix into the given storage format and stores the representation
+// in the csrmv_format info. Storage format parameters, i.e. the ELL width and the BSR
+// block dimension, direction and number of blocks, must be set in the info beforehand.
+template <typename T>
+rocsparse_status csrmv_format_build(rocsparse_handle            handle,
+                                    rocsparse_spmv_format       format,
+                                    const rocsparse_mat_descr   descr,
+                                    const T*                    csr_val,
+                                    const rocsparse_int*        csr_row_ptr,
+                                    const rocsparse_int*        csr_col_ind,
+                                    rocsparse_csrmv_format_info info)
+{
+    // Release the previous representation
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_format_info_clear(info));
+
+    info->format = format;
+
+    rocsparse_int m = info->m;
+    rocsparse_int n = info->n;
+
+    if(format == rocsparse_spmv_format_ell)
+    {
+        size_t ell_nnz = static_cast<size_t>(m) * info->ell_width;
+
+        RETURN_IF_HIP_ERROR(
+            hipMalloc((void**)&info->ell_col_ind, sizeof(rocsparse_int) * ell_nnz));
+        RETURN_IF_HIP_ERROR(hipMalloc(&info->ell_val, sizeof(T) * ell_nnz));
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2ell_template(handle,
+                                                             m,
+                                                             descr,
+                                                             csr_val,
+                                                             csr_row_ptr,
+                                                             csr_col_ind,
+                                                             descr,
+                                                             info->ell_width,
+                                                             (T*)info->ell_val,
+                                                             info->ell_col_ind));
+    }
+    else if(format == rocsparse_spmv_format_hyb)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_hyb_mat(&info->hyb));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2hyb_template(handle,
+                                                             m,
+                                                             n,
+                                                             descr,
+                                                             csr_val,
+                                                             csr_row_ptr,
+                                                             csr_col_ind,
+                                                             info->hyb,
+                                                             0,
+                                                             rocsparse_hyb_partition_auto));
+    }
+    else if(format == rocsparse_spmv_format_bsr)
+    {
+        size_t bsr_nnz = static_cast<size_t>(info->nnzb) * info->bsr_dim * info->bsr_dim;
+
+        RETURN_IF_HIP_ERROR(
+            hipMalloc((void**)&info->bsr_row_ptr, sizeof(rocsparse_int) * (info->mb + 1)));
+        RETURN_IF_HIP_ERROR(
+            hipMalloc((void**)&info->bsr_col_ind, sizeof(rocsparse_int) * info->nnzb));
+        RETURN_IF_HIP_ERROR(hipMalloc(&info->bsr_val, sizeof(T) * bsr_nnz));
+
+        // The number of blocks is already known from the analysis. In device pointer
+        // mode, it is written to the column index array, before it is filled.
+        rocsparse_int  nnzb     = 0;
+        rocsparse_int* nnzb_ptr = (handle->pointer_mode == rocsparse_pointer_mode_device)
+                                      ? info->bsr_col_ind
+                                      : &nnzb;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2bsr_nnz(handle,
+                                                        info->bsr_dir,
+                                                        m,
+                                                        n,
+                                                        descr,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        info->bsr_dim,
+                                                        descr,
+                                                        info->bsr_row_ptr,
+                                                        nnzb_ptr));
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2bsr_template(handle,
+                                                             info->bsr_dir,
+                                                             m,
+                                                             n,
+                                                             descr,
+                                                             csr_val,
+                                                             csr_row_ptr,
+                                                             csr_col_ind,
+                                                             info->bsr_dim,
+                                                             descr,
+                                                             (T*)info->bsr_val,
+                                                             info->bsr_row_ptr,
+                                                             info->bsr_col_ind));
+    }
+
+    info->val_size = sizeof(T);
+
+    return rocsparse_status_success;
+}
+
+// Computes the sparse matrix vector multiplication using the storage format that is
+// held by the csrmv_format info
+template <typename T>
+rocsparse_status csrmv_format_dispatch(rocsparse_handle          handle,
+                                       rocsparse_operation       trans,
+                                       const T*                  alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const T*                  csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_mat_info        info,
+                                       const T*                  x,
+                                       const T*                  beta,
+                                       T*                        y)
+{
+    rocsparse_csrmv_format_info format_info = info->csrmv_format_info;
+
+    switch(format_info->format)
+    {
+    case rocsparse_spmv_format_ell:
+    {
+        return rocsparse_ellmv_template(handle,
+                                        trans,
+                                        format_info->m,
+                                        format_info->n,
+                                        alpha,
+                                        descr,
+                                        (const T*)format_info->ell_val,
+                                        format_info->ell_col_ind,
+                                        format_info->ell_width,
+                                        x,
+                                        beta,
+                                        y);
+    }
+    case rocsparse_spmv_format_hyb:
+    {
+        return rocsparse_hybmv_template(handle, trans, alpha, descr, format_info->hyb, x, beta, y);
+    }
+    case rocsparse_spmv_format_bsr:
+    {
+        return rocsparse_bsrmv_template(handle,
+                                        format_info->bsr_dir,
+                                        trans,
+                                        format_info->mb,
+                                        format_info->nb,
+                                        format_info->nnzb,
+                                        alpha,
+                                        descr,
+                                        (const T*)format_info->bsr_val,
+                                        format_info->bsr_row_ptr,
+                                        format_info->bsr_col_ind,
+                                        format_info->bsr_dim,
+                                        x,
+                                        beta,
+                                        y);
+    }
+    case rocsparse_spmv_format_csr:
+    {
+        // csrmv uses the adaptive kernel, if the csrmv analysis has been performed
+        return rocsparse_csrmv_template(handle,
+                                        trans,
+                                        format_info->m,
+                                        format_info->n,
+                                        format_info->nnz,
+                                        alpha,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        info,
+                                        x,
+                                        beta,
+                                        y);
+    }
+    }
+
+    return rocsparse_status_invalid_value;
+}
+
+// Times each storage format with a finite predicted cost on the device. The candidates
+// are built one after another, such that only a single representation is held at a
+// time. The storage format with the lowest time is kept.
+template <typename T>
+rocsparse_status csrmv_format_benchmark(rocsparse_handle          handle,
+                                        rocsparse_operation       trans,
+                                        const rocsparse_mat_descr descr,
+                                        const T*                  csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_int             benchmark_iter,
+                                        rocsparse_mat_info        info)
+{
+    rocsparse_csrmv_format_info format_info = info->csrmv_format_info;
+
+    rocsparse_int m = format_info->m;
+    rocsparse_int n = format_info->n;
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Device memory for x, y, alpha and beta
+    T* temp_buffer = nullptr;
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&temp_buffer, sizeof(T) * (m + n + 2)));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(temp_buffer, 0, sizeof(T) * (m + n + 2), stream));
+
+    T* x = temp_buffer;
+    T* y = temp_buffer + n;
+
+    // y := x, scalars depending on the pointer mode
+    T halpha = static_cast<T>(1);
+    T hbeta  = static_cast<T>(0);
+
+    const T* alpha = &halpha;
+    const T* beta  = &hbeta;
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            temp_buffer + m + n, &halpha, sizeof(T), hipMemcpyHostToDevice, stream));
+
+        alpha = temp_buffer + m + n;
+        beta  = temp_buffer + m + n + 1;
+    }
+
+    hipEvent_t start;
+    hipEvent_t stop;
+
+    RETURN_IF_HIP_ERROR(hipEventCreate(&start));
+    RETURN_IF_HIP_ERROR(hipEventCreate(&stop));
+
+    float time[CSRMV_FORMAT_NUM];
+
+    rocsparse_spmv_format best = rocsparse_spmv_format_csr;
+
+    for(int f = 0; f < CSRMV_FORMAT_NUM; ++f)
+    {
+        rocsparse_spmv_format format = static_cast<rocsparse_spmv_format>(f);
+
+        if(format_info->predicted_cost[f] == std::numeric_limits<float>::infinity())
+        {
+            time[f] = std::numeric_limits<float>::infinity();
+            continue;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(csrmv_format_build(
+            handle, format, descr, csr_val, csr_row_ptr, csr_col_ind, format_info));
+
+        // Warm up
+        RETURN_IF_ROCSPARSE_ERROR(csrmv_format_dispatch(
+            handle, trans, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, info, x, beta, y));
+
+        RETURN_IF_HIP_ERROR(hipEventRecord(start, stream));
+
+        for(rocsparse_int iter = 0; iter < benchmark_iter; ++iter)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(csrmv_format_dispatch(
+                handle, trans, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, info, x, beta, y));
+        }
+
+        RETURN_IF_HIP_ERROR(hipEventRecord(stop, stream));
+        RETURN_IF_HIP_ERROR(hipEventSynchronize(stop));
+        RETURN_IF_HIP_ERROR(hipEventElapsedTime(&time[f], start, stop));
+
+        if(time[f] < time[best])
+        {
+            best = format;
+        }
+    }
+
+    RETURN_IF_HIP_ERROR(hipEventDestroy(start));
+    RETURN_IF_HIP_ERROR(hipEventDestroy(stop));
+    RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
+
+    // Measured cost relative to csrmv
+    for(int f = 0; f < CSRMV_FORMAT_NUM; ++f)
+    {
+        format_info->measured_cost[f] = (time[rocsparse_spmv_format_csr] > 0.0f)
+                                            ? time[f] / time[rocsparse_spmv_format_csr]
+                                            : 1.0f;
+    }
+
+    // Keep the fastest storage format
+    if(format_info->format != best)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(csrmv_format_build(
+            handle, best, descr, csr_val, csr_row_ptr, csr_col_ind, format_info));
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_format_analysis_template(rocsparse_handle          handle,
+                                                          rocsparse_operation       trans,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             n,
+                                                          rocsparse_int             nnz,
+                                                          const rocsparse_mat_descr descr,
+                                                          const T*                  csr_val,
+                                                          const rocsparse_int*      csr_row_ptr,
+                                                          const rocsparse_int*      csr_col_ind,
+                                                          rocsparse_int             benchmark_iter,
+                                                          rocsparse_mat_info        info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrmv_format_analysis"),
+              trans,
+              m,
+              n,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              benchmark_iter,
+              (const void*&)info);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(benchmark_iter < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(m > 0 && n > 0 && nnz > 0)
+    {
+        if(csr_row_ptr == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(csr_col_ind == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(csr_val == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+    }
+
+    // Clear csrmv_format info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_format_info(info->csrmv_format_info));
+    info->csrmv_format_info = nullptr;
+
+    // Create csrmv_format info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrmv_format_info(&info->csrmv_format_info));
+
+    rocsparse_csrmv_format_info format_info = info->csrmv_format_info;
+
+    // Store some pointers to verify correct execution
+    format_info->trans       = trans;
+    format_info->m           = m;
+    format_info->n           = n;
+    format_info->nnz         = nnz;
+    format_info->descr       = descr;
+    format_info->csr_val     = csr_val;
+    format_info->csr_row_ptr = csr_row_ptr;
+    format_info->csr_col_ind = csr_col_ind;
+
+    // Empty matrices are computed by csrmv
+    for(int f = 0; f < CSRMV_FORMAT_NUM; ++f)
+    {
+        format_info->predicted_cost[f] = 1.0f;
+        format_info->measured_cost[f]  = 0.0f;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    static constexpr float inf = std::numeric_limits<float>::infinity();
+
+    // ellmv and hybmv do not support transposed matrices, the cost model of bsrmv only
+    // covers the non-transposed kernels
+    if(trans != rocsparse_operation_none)
+    {
+        format_info->predicted_cost[rocsparse_spmv_format_ell] = inf;
+        format_info->predicted_cost[rocsparse_spmv_format_hyb] = inf;
+        format_info->predicted_cost[rocsparse_spmv_format_bsr] = inf;
+
+        if(benchmark_iter > 0)
+        {
+            return csrmv_format_benchmark(
+                handle, trans, descr, csr_val, csr_row_ptr, csr_col_ind, benchmark_iter, info);
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRMV_FORMAT_DIM 256
+    // Workspace for the maximum reduction
+    rocsparse_int nblocks = CSRMV_FORMAT_DIM;
+
+    rocsparse_int* workspace = nullptr;
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace, sizeof(rocsparse_int) * nblocks));
+
+    // Maximum non-zero entries per row, i.e. the ELL width
+    hipLaunchKernelGGL((ell_width_kernel_part1<CSRMV_FORMAT_DIM>),
+                       dim3(nblocks),
+                       dim3(CSRMV_FORMAT_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       workspace);
+
+    hipLaunchKernelGGL((ell_width_kernel_part2<CSRMV_FORMAT_DIM>),
+                       dim3(1),
+                       dim3(CSRMV_FORMAT_DIM),
+                       0,
+                       stream,
+                       nblocks,
+                       workspace);
+#undef CSRMV_FORMAT_DIM
+
+    rocsparse_int ell_width;
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(&ell_width, workspace, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+    RETURN_IF_HIP_ERROR(hipFree(workspace));
+
+    // ELL width and COO part of the HYB format, as determined by the auto partition of
+    // csr2hyb
+    rocsparse_int hyb_width;
+    rocsparse_int coo_nnz;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2hyb_auto_width<T>(
+        handle, m, nnz, csr_row_ptr, &hyb_width, &coo_nnz, nullptr));
+
+    double csr_bytes = csrmv_format_csr_bytes<T>(m, n, nnz);
+
+    // ELL storage must be addressable by rocsparse_int, the auto partition of csr2hyb
+    // already limits the HYB width accordingly
+    format_info->ell_width = ell_width;
+    format_info->predicted_cost[rocsparse_spmv_format_ell]
+        = (static_cast<int64_t>(m) * ell_width <= std::numeric_limits<rocsparse_int>::max())
+              ? static_cast<float>(csrmv_format_ell_bytes<T>(m, n, ell_width) / csr_bytes)
+              : inf;
+    format_info->predicted_cost[rocsparse_spmv_format_hyb]
+        = static_cast<float>(csrmv_format_hyb_bytes<T>(m, n, hyb_width, coo_nnz) / csr_bytes);
+
+    // bsrmv computes all rows and columns of the block rows and columns, thus only block
+    // dimensions that divide both matrix dimensions are considered
+    rocsparse_int bsr_dims[sizeof(csrmv_format_bsr_dims) / sizeof(rocsparse_int)];
+    rocsparse_int num_bsr_dims = 0;
+
+    for(rocsparse_int bsr_dim : csrmv_format_bsr_dims)
+    {
+        if(m % bsr_dim == 0 && n % bsr_dim == 0)
+        {
+            bsr_dims[num_bsr_dims++] = bsr_dim;
+        }
+    }
+
+    format_info->predicted_cost[rocsparse_spmv_format_bsr] = inf;
+
+    if(num_bsr_dims > 0)
+    {
+        // Exact number of blocks and predicted bsrmv cost of each candidate
+        rocsparse_int bsr_nnzb[sizeof(csrmv_format_bsr_dims) / sizeof(rocsparse_int)];
+        float         fill_ratio[sizeof(csrmv_format_bsr_dims) / sizeof(rocsparse_int)];
+        float         bsrmv_cost[2 * sizeof(csrmv_format_bsr_dims) / sizeof(rocsparse_int)];
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2bsr_block_dim_analysis_template<T>(handle,
+                                                                                   m,
+                                                                                   n,
+                                                                                   descr,
+                                                                                   csr_row_ptr,
+                                                                                   csr_col_ind,
+                                                                                   num_bsr_dims,
+                                                                                   bsr_dims,
+                                                                                   0,
+                                                                                   bsr_nnzb,
+                                                                                   fill_ratio,
+                                                                                   bsrmv_cost));
+
+        for(rocsparse_int i = 0; i < num_bsr_dims; ++i)
+        {
+            // BSR blocks must be addressable by rocsparse_int
+            if(static_cast<int64_t>(bsr_nnzb[i]) * bsr_dims[i] * bsr_dims[i]
+               > std::numeric_limits<rocsparse_int>::max())
+            {
+                continue;
+            }
+
+            for(int dir = rocsparse_direction_row; dir <= rocsparse_direction_column; ++dir)
+            {
+                if(bsrmv_cost[2 * i + dir] < format_info->predicted_cost[rocsparse_spmv_format_bsr])
+                {
+                    format_info->predicted_cost[rocsparse_spmv_format_bsr]
+                        = bsrmv_cost[2 * i + dir];
+
+                    format_info->bsr_dir = static_cast<rocsparse_direction>(dir);
+                    format_info->bsr_dim = bsr_dims[i];
+                    format_info->mb      = m / bsr_dims[i];
+                    format_info->nb      = n / bsr_dims[i];
+                    format_info->nnzb    = bsr_nnzb[i];
+                }
+            }
+        }
+    }
+
+    // Time the candidates, if requested
+    if(benchmark_iter > 0)
+    {
+        return csrmv_format_benchmark(
+            handle, trans, descr, csr_val, csr_row_ptr, csr_col_ind, benchmark_iter, info);
+    }
+
+    // Otherwise, select the storage format with the lowest predicted cost
+    rocsparse_spmv_format best = rocsparse_spmv_format_csr;
+
+    for(int f = 0; f < CSRMV_FORMAT_NUM; ++f)
+    {
+        if(format_info->predicted_cost[f] < format_info->predicted_cost[best])
+        {
+            best = static_cast<rocsparse_spmv_format>(f);
+        }
+    }
+
+    return csrmv_format_build(handle, best, descr, csr_val, csr_row_ptr, csr_col_ind, format_info);
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_format_template(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             nnz,
+                                                 const T*                  alpha,
+                                                 const rocsparse_mat_descr descr,
+                                                 const T*                  csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 rocsparse_mat_info        info,
+                                                 const T*                  x,
+                                                 const T*                  beta,
+                                                 T*                        y)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Without analysis, call csrmv
+    if(info == nullptr || info->csrmv_format_info == nullptr)
+    {
+        return rocsparse_csrmv_template(handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        nnz,
+                                        alpha,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        info,
+                                        x,
+                                        beta,
+                                        y);
+    }
+
+    rocsparse_csrmv_format_info format_info = info->csrmv_format_info;
+
+    // Check if info matches current matrix and options
+    if(format_info->trans != trans)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(format_info->m != m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(format_info->n != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(format_info->nnz != nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(format_info->descr != descr)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(format_info->csr_val != csr_val)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(format_info->csr_row_ptr != csr_row_ptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(format_info->csr_col_ind != csr_col_ind)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_format"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f csrmv_format -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> "
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_format"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return csrmv_format_dispatch(
+        handle, trans, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, info, x, beta, y);
+}
+
+#endif // ROCSPARSE_CSRMV_FORMAT_HPP
@@ -0,0 +1,181 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse.h"
+
+#include "rocsparse_csrmv_strided_batched.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_scsrmv_strided_batched(rocsparse_handle          handle,
+                                                             rocsparse_operation       trans,
+                                                             rocsparse_int             m,
+                                                             rocsparse_int             n,
+                                                             rocsparse_int             nnz,
+                                                             const float*              alpha,
+                                                             const rocsparse_mat_descr descr,
+                                                             const float*              csr_val,
+                                                             rocsparse_int             stride_val,
+                                                             const rocsparse_int*      csr_row_ptr,
+                                                             const rocsparse_int*      csr_col_ind,
+                                                             const float*              x,
+                                                             rocsparse_int             stride_x,
+                                                             const float*              beta,
+                                                             float*                    y,
+                                                             rocsparse_int             stride_y,
+                                                             rocsparse_int             batch_count)
+{
+    return rocsparse_csrmv_strided_batched_template(handle,
+                                                    trans,
+                                                    m,
+                                                    n,
+                                                    nnz,
+                                                    alpha,
+                                                    descr,
+                                                    csr_val,
+                                                    stride_val,
+                                                    csr_row_ptr,
+                                                    csr_col_ind,
+                                                    x,
+                                                    stride_x,
+                                                    beta,
+                                                    y,
+                                                    stride_y,
+                                                    batch_count);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmv_strided_batched(rocsparse_handle          handle,
+                                                             rocsparse_operation       trans,
+                                                             rocsparse_int             m,
+                                                             rocsparse_int             n,
+                                                             rocsparse_int             nnz,
+                                                             const double*             alpha,
+                                                             const rocsparse_mat_descr descr,
+                                                             const double*             csr_val,
+                                                             rocsparse_int             stride_val,
+                                                             const rocsparse_int*      csr_row_ptr,
+                                                             const rocsparse_int*      csr_col_ind,
+                                                             const double*             x,
+                                                             rocsparse_int             stride_x,
+                                                             const double*             beta,
+                                                             double*                   y,
+                                                             rocsparse_int             stride_y,
+                                                             rocsparse_int             batch_count)
+{
+    return rocsparse_csrmv_strided_batched_template(handle,
+                                                    trans,
+                                                    m,
+                                                    n,
+                                                    nnz,
+                                                    alpha,
+                                                    descr,
+                                                    csr_val,
+                                                    stride_val,
+                                                    csr_row_ptr,
+                                                    csr_col_ind,
+                                                    x,
+                                                    stride_x,
+                                                    beta,
+                                                    y,
+                                                    stride_y,
+                                                    batch_count);
+}
+
+extern "C" rocsparse_status rocsparse_ccsrmv_strided_batched(rocsparse_handle               handle,
+                                                             rocsparse_operation            trans,
+                                                             rocsparse_int                  m,
+                                                             rocsparse_int                  n,
+                                                             rocsparse_int                  nnz,
+                                                             const rocsparse_float_complex* alpha,
+                                                             const rocsparse_mat_descr      descr,
+                                                             const rocsparse_float_complex* csr_val,
+                                                             rocsparse_int stride_val,
+                                                             const rocsparse_int* csr_row_ptr,
+                                                             const rocsparse_int* csr_col_ind,
+                                                             const rocsparse_float_complex* x,
+                                                             rocsparse_int stride_x,
+                                                             const rocsparse_float_complex* beta,
+                                                             rocsparse_float_complex*       y,
+                                                             rocsparse_int stride_y,
+                                                             rocsparse_int batch_count)
+{
+    return rocsparse_csrmv_strided_batched_template(handle,
+                                                    trans,
+                                                    m,
+                                                    n,
+                                                    nnz,
+                                                    alpha,
+                                                    descr,
+                                                    csr_val,
+                                                    stride_val,
+                                                    csr_row_ptr,
+                                                    csr_col_ind,
+                                                    x,
+                                                    stride_x,
+                                                    beta,
+                                                    y,
+                                                    stride_y,
+                                                    batch_count);
+}
+
+extern "C" rocsparse_status
+    rocsparse_zcsrmv_strided_batched(rocsparse_handle                handle,
+                                     rocsparse_operation             trans,
+                                     rocsparse_int                   m,
+                                     rocsparse_int                   n,
+                                     rocsparse_int                   nnz,
+                                     const rocsparse_double_complex* alpha,
+                                     const rocsparse_mat_descr       descr,
+                                     const rocsparse_double_complex* csr_val,
+                                     rocsparse_int                   stride_val,
+                                     const rocsparse_int*            csr_row_ptr,
+                                     const rocsparse_int*            csr_col_ind,
+                                     const rocsparse_double_complex* x,
+                                     rocsparse_int                   stride_x,
+                                     const rocsparse_double_complex* beta,
+                                     rocsparse_double_complex*       y,
+                                     rocsparse_int                   stride_y,
+                                     rocsparse_int                   batch_count)
+{
+    return rocsparse_csrmv_strided_batched_template(handle,
+                                                    trans,
+                                                    m,
+                                                    n,
+                                                    nnz,
+                                                    alpha,
+                                                    descr,
+                                                    csr_val,
+                                                    stride_val,
+                                                    csr_row_ptr,
+                                                    csr_col_ind,
+                                                    x,
+                                                    stride_x,
+                                                    beta,
+                                                    y,
+                                                    stride_y,
+                                                    batch_count);
+}
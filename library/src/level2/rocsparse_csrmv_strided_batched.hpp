@@ -0,0 +1,435 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRMV_STRIDED_BATCHED_HPP
+#define ROCSPARSE_CSRMV_STRIDED_BATCHED_HPP
+
+#include "csrmv_device.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+// Wavefront sizes of the batched kernel
+using csrmvn_batched_wfsizes = rocsparse_value_list<2, 4, 8, 16, 32, 64>;
+
+// Upper bound of the grid size, remaining rows are processed by grid striding
+static constexpr int64_t csrmvn_batched_max_blocks = 65536;
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_batched_kernel_host_pointer(rocsparse_int m,
+                                            rocsparse_int batch_count,
+                                            T             alpha,
+                                            const rocsparse_int* __restrict__ csr_row_ptr,
+                                            const rocsparse_int* __restrict__ csr_col_ind,
+                                            const T* __restrict__ csr_val,
+                                            rocsparse_int stride_val,
+                                            const T* __restrict__ x,
+                                            rocsparse_int stride_x,
+                                            T             beta,
+                                            T* __restrict__ y,
+                                            rocsparse_int        stride_y,
+                                            rocsparse_index_base idx_base)
+{
+    csrmvn_strided_batched_device<T, BLOCKSIZE, WF_SIZE>(m,
+                                                         batch_count,
+                                                         alpha,
+                                                         csr_row_ptr,
+                                                         csr_col_ind,
+                                                         csr_val,
+                                                         stride_val,
+                                                         x,
+                                                         stride_x,
+                                                         beta,
+                                                         y,
+                                                         stride_y,
+                                                         idx_base);
+}
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_batched_kernel_device_pointer(rocsparse_int m,
+                                              rocsparse_int batch_count,
+                                              const T*      alpha,
+                                              const rocsparse_int* __restrict__ csr_row_ptr,
+                                              const rocsparse_int* __restrict__ csr_col_ind,
+                                              const T* __restrict__ csr_val,
+                                              rocsparse_int stride_val,
+                                              const T* __restrict__ x,
+                                              rocsparse_int stride_x,
+                                              const T*      beta,
+                                              T* __restrict__ y,
+                                              rocsparse_int        stride_y,
+                                              rocsparse_index_base idx_base)
+{
+    csrmvn_strided_batched_device<T, BLOCKSIZE, WF_SIZE>(m,
+                                                         batch_count,
+                                                         *alpha,
+                                                         csr_row_ptr,
+                                                         csr_col_ind,
+                                                         csr_val,
+                                                         stride_val,
+                                                         x,
+                                                         stride_x,
+                                                         *beta,
+                                                         y,
+                                                         stride_y,
+                                                         idx_base);
+}
+
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_batched_scale_kernel_host_pointer(
+        rocsparse_int m, rocsparse_int batch_count, T beta, T* y, rocsparse_int stride_y)
+{
+    csrmvn_strided_batched_scale_device<T, BLOCKSIZE>(m, batch_count, beta, y, stride_y);
+}
+
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_batched_scale_kernel_device_pointer(
+        rocsparse_int m, rocsparse_int batch_count, const T* beta, T* y, rocsparse_int stride_y)
+{
+    csrmvn_strided_batched_scale_device<T, BLOCKSIZE>(m, batch_count, *beta, y, stride_y);
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_strided_batched_template(rocsparse_handle          handle,
+                                                          rocsparse_operation       trans,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             n,
+                                                          rocsparse_int             nnz,
+                                                          const T*                  alpha,
+                                                          const rocsparse_mat_descr descr,
+                                                          const T*                  csr_val,
+                                                          rocsparse_int             stride_val,
+                                                          const rocsparse_int*      csr_row_ptr,
+                                                          const rocsparse_int*      csr_col_ind,
+                                                          const T*                  x,
+                                                          rocsparse_int             stride_x,
+                                                          const T*                  beta,
+                                                          T*                        y,
+                                                          rocsparse_int             stride_y,
+                                                          rocsparse_int             batch_count)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_strided_batched"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  stride_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  stride_x,
+                  *beta,
+                  (const void*&)y,
+                  stride_y,
+                  batch_count);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f csrmv_strided_batched -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> "
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta,
+                  "--batch_count",
+                  batch_count);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_strided_batched"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  stride_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  stride_x,
+                  (const void*&)beta,
+                  (const void*&)y,
+                  stride_y,
+                  batch_count);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type and operation
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    else if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(stride_val < 0 || stride_x < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Sanity check
+    if((m == 0 || n == 0) && nnz != 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Output vectors of different batches must not overlap
+    if(batch_count > 1 && stride_y < m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Total number of rows of the batch
+    int64_t nrows = static_cast<int64_t>(m) * batch_count;
+
+    // Without non-zero entries, y is only scaled by beta
+    if(n == 0 || nnz == 0)
+    {
+#define CSRMVN_BATCHED_SCALE_DIM 512
+        dim3 blocks(std::min((nrows - 1) / CSRMVN_BATCHED_SCALE_DIM + 1,
+                             csrmvn_batched_max_blocks));
+        dim3 threads(CSRMVN_BATCHED_SCALE_DIM);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL(
+                (csrmvn_batched_scale_kernel_device_pointer<T, CSRMVN_BATCHED_SCALE_DIM>),
+                blocks,
+                threads,
+                0,
+                stream,
+                m,
+                batch_count,
+                beta,
+                y,
+                stride_y);
+        }
+        else
+        {
+            if(*beta == static_cast<T>(1))
+            {
+                return rocsparse_status_success;
+            }
+
+            hipLaunchKernelGGL(
+                (csrmvn_batched_scale_kernel_host_pointer<T, CSRMVN_BATCHED_SCALE_DIM>),
+                blocks,
+                threads,
+                0,
+                stream,
+                m,
+                batch_count,
+                *beta,
+                y,
+                stride_y);
+        }
+#undef CSRMVN_BATCHED_SCALE_DIM
+
+        return rocsparse_status_success;
+    }
+
+    // Wavefront size, depending on the average number of non-zero entries per row, as
+    // all matrices of the batch share the same sparsity pattern
+    rocsparse_int nnz_per_row = nnz / m;
+    rocsparse_int wfsize      = 64;
+
+    if(nnz_per_row < 4)
+    {
+        wfsize = 2;
+    }
+    else if(nnz_per_row < 8)
+    {
+        wfsize = 4;
+    }
+    else if(nnz_per_row < 16)
+    {
+        wfsize = 8;
+    }
+    else if(nnz_per_row < 32)
+    {
+        wfsize = 16;
+    }
+    else if(nnz_per_row < 64)
+    {
+        wfsize = 32;
+    }
+
+    wfsize = std::min(wfsize, handle->wavefront_size);
+
+#define CSRMVN_BATCH_DIM 512
+    bool dispatched = rocsparse_dispatch_value(wfsize, csrmvn_batched_wfsizes{}, [&](auto w) {
+        constexpr unsigned int WF_SIZE = decltype(w)::value;
+
+        // Each wavefront processes a single row of a single matrix of the batch
+        dim3 blocks(std::min((nrows * WF_SIZE - 1) / CSRMVN_BATCH_DIM + 1,
+                             csrmvn_batched_max_blocks));
+        dim3 threads(CSRMVN_BATCH_DIM);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((csrmvn_batched_kernel_device_pointer<T, CSRMVN_BATCH_DIM, WF_SIZE>),
+                               blocks,
+                               threads,
+                               0,
+                               stream,
+                               m,
+                               batch_count,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               stride_val,
+                               x,
+                               stride_x,
+                               beta,
+                               y,
+                               stride_y,
+                               descr->base);
+        }
+        else
+        {
+            hipLaunchKernelGGL((csrmvn_batched_kernel_host_pointer<T, CSRMVN_BATCH_DIM, WF_SIZE>),
+                               blocks,
+                               threads,
+                               0,
+                               stream,
+                               m,
+                               batch_count,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               stride_val,
+                               x,
+                               stride_x,
+                               *beta,
+                               y,
+                               stride_y,
+                               descr->base);
+        }
+    });
+#undef CSRMVN_BATCH_DIM
+
+    if(!dispatched)
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSRMV_STRIDED_BATCHED_HPP
@@ -93,6 +93,67 @@ extern "C" rocsparse_status rocsparse_zcsrsv_buffer_size(rocsparse_handle
         handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
 }
 
+extern "C" rocsparse_status rocsparse_scsrsv_buffer_size_i64(rocsparse_handle          handle,
+                                                             rocsparse_operation       trans,
+                                                             int32_t                   m,
+                                                             int64_t                   nnz,
+                                                             const rocsparse_mat_descr descr,
+                                                             const float*              csr_val,
+                                                             const int64_t*            csr_row_ptr,
+                                                             const int32_t*            csr_col_ind,
+                                                             rocsparse_mat_info        info,
+                                                             size_t*                   buffer_size)
+{
+    return rocsparse_csrsv_buffer_size_template(
+        handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrsv_buffer_size_i64(rocsparse_handle          handle,
+                                                             rocsparse_operation       trans,
+                                                             int32_t                   m,
+                                                             int64_t                   nnz,
+                                                             const rocsparse_mat_descr descr,
+                                                             const double*             csr_val,
+                                                             const int64_t*            csr_row_ptr,
+                                                             const int32_t*            csr_col_ind,
+                                                             rocsparse_mat_info        info,
+                                                             size_t*                   buffer_size)
+{
+    return rocsparse_csrsv_buffer_size_template(
+        handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_ccsrsv_buffer_size_i64(rocsparse_handle               handle,
+                                                             rocsparse_operation            trans,
+                                                             int32_t                        m,
+                                                             int64_t                        nnz,
+                                                             const rocsparse_mat_descr      descr,
+                                                             const rocsparse_float_complex* csr_val,
+                                                             const int64_t*     csr_row_ptr,
+                                                             const int32_t*     csr_col_ind,
+                                                             rocsparse_mat_info info,
+                                                             size_t*            buffer_size)
+{
+    return rocsparse_csrsv_buffer_size_template(
+        handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrsv_buffer_size_i64(
+    rocsparse_handle                handle,
+    rocsparse_operation             trans,
+    int32_t                         m,
+    int64_t                         nnz,
+    const rocsparse_mat_descr       descr,
+    const rocsparse_double_complex* csr_val,
+    const int64_t*                  csr_row_ptr,
+    const int32_t*                  csr_col_ind,
+    rocsparse_mat_info              info,
+    size_t*                         buffer_size)
+{
+    return rocsparse_csrsv_buffer_size_template(
+        handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
 extern "C" rocsparse_status rocsparse_scsrsv_analysis(rocsparse_handle          handle,
                                                       rocsparse_operation       trans,
                                                       rocsparse_int             m,
@@ -201,6 +262,114 @@ extern "C" rocsparse_status rocsparse_zcsrsv_analysis(rocsparse_handle
                                              temp_buffer);
 }
 
+extern "C" rocsparse_status rocsparse_scsrsv_analysis_i64(rocsparse_handle          handle,
+                                                          rocsparse_operation       trans,
+                                                          int32_t                   m,
+                                                          int64_t                   nnz,
+                                                          const rocsparse_mat_descr descr,
+                                                          const float*              csr_val,
+                                                          const int64_t*            csr_row_ptr,
+                                                          const int32_t*            csr_col_ind,
+                                                          rocsparse_mat_info        info,
+                                                          rocsparse_analysis_policy analysis,
+                                                          rocsparse_solve_policy    solve,
+                                                          void*                     temp_buffer)
+{
+    return rocsparse_csrsv_analysis_template(handle,
+                                             trans,
+                                             m,
+                                             nnz,
+                                             descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             info,
+                                             analysis,
+                                             solve,
+                                             temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrsv_analysis_i64(rocsparse_handle          handle,
+                                                          rocsparse_operation       trans,
+                                                          int32_t                   m,
+                                                          int64_t                   nnz,
+                                                          const rocsparse_mat_descr descr,
+                                                          const double*             csr_val,
+                                                          const int64_t*            csr_row_ptr,
+                                                          const int32_t*            csr_col_ind,
+                                                          rocsparse_mat_info        info,
+                                                          rocsparse_analysis_policy analysis,
+                                                          rocsparse_solve_policy    solve,
+                                                          void*                     temp_buffer)
+{
+    return rocsparse_csrsv_analysis_template(handle,
+                                             trans,
+                                             m,
+                                             nnz,
+                                             descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             info,
+                                             analysis,
+                                             solve,
+                                             temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_ccsrsv_analysis_i64(rocsparse_handle               handle,
+                                                          rocsparse_operation            trans,
+                                                          int32_t                        m,
+                                                          int64_t                        nnz,
+                                                          const rocsparse_mat_descr      descr,
+                                                          const rocsparse_float_complex* csr_val,
+                                                          const int64_t*            csr_row_ptr,
+                                                          const int32_t*            csr_col_ind,
+                                                          rocsparse_mat_info        info,
+                                                          rocsparse_analysis_policy analysis,
+                                                          rocsparse_solve_policy    solve,
+                                                          void*                     temp_buffer)
+{
+    return rocsparse_csrsv_analysis_template(handle,
+                                             trans,
+                                             m,
+                                             nnz,
+                                             descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             info,
+                                             analysis,
+                                             solve,
+                                             temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrsv_analysis_i64(rocsparse_handle                handle,
+                                                          rocsparse_operation             trans,
+                                                          int32_t                         m,
+                                                          int64_t                         nnz,
+                                                          const rocsparse_mat_descr       descr,
+                                                          const rocsparse_double_complex* csr_val,
+                                                          const int64_t*            csr_row_ptr,
+                                                          const int32_t*            csr_col_ind,
+                                                          rocsparse_mat_info        info,
+                                                          rocsparse_analysis_policy analysis,
+                                                          rocsparse_solve_policy    solve,
+                                                          void*                     temp_buffer)
+{
+    return rocsparse_csrsv_analysis_template(handle,
+                                             trans,
+                                             m,
+                                             nnz,
+                                             descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             info,
+                                             analysis,
+                                             solve,
+                                             temp_buffer);
+}
+
 extern "C" rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          handle,
                                                   const rocsparse_mat_descr descr,
                                                   rocsparse_mat_info        info)
@@ -372,6 +541,192 @@ extern "C" rocsparse_status rocsparse_zcsrsv_solve(rocsparse_handle
                                           temp_buffer);
 }
 
+extern "C" rocsparse_status rocsparse_dscsrsv_solve(rocsparse_handle          handle,
+                                                    rocsparse_operation       trans,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             nnz,
+                                                    const double*             alpha,
+                                                    const rocsparse_mat_descr descr,
+                                                    const float*              csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_mat_info        info,
+                                                    const double*             x,
+                                                    double*                   y,
+                                                    rocsparse_solve_policy    policy,
+                                                    void*                     temp_buffer)
+{
+    return rocsparse_csrsv_solve_template(handle,
+                                          trans,
+                                          m,
+                                          nnz,
+                                          alpha,
+                                          descr,
+                                          csr_val,
+                                          csr_row_ptr,
+                                          csr_col_ind,
+                                          info,
+                                          x,
+                                          y,
+                                          policy,
+                                          temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zccsrsv_solve(rocsparse_handle                handle,
+                                                    rocsparse_operation             trans,
+                                                    rocsparse_int                   m,
+                                                    rocsparse_int                   nnz,
+                                                    const rocsparse_double_complex* alpha,
+                                                    const rocsparse_mat_descr       descr,
+                                                    const rocsparse_float_complex*  csr_val,
+                                                    const rocsparse_int*            csr_row_ptr,
+                                                    const rocsparse_int*            csr_col_ind,
+                                                    rocsparse_mat_info              info,
+                                                    const rocsparse_double_complex* x,
+                                                    rocsparse_double_complex*       y,
+                                                    rocsparse_solve_policy          policy,
+                                                    void*                           temp_buffer)
+{
+    return rocsparse_csrsv_solve_template(handle,
+                                          trans,
+                                          m,
+                                          nnz,
+                                          alpha,
+                                          descr,
+                                          csr_val,
+                                          csr_row_ptr,
+                                          csr_col_ind,
+                                          info,
+                                          x,
+                                          y,
+                                          policy,
+                                          temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_scsrsv_solve_i64(rocsparse_handle          handle,
+                                                       rocsparse_operation       trans,
+                                                       int32_t                   m,
+                                                       int64_t                   nnz,
+                                                       const float*              alpha,
+                                                       const rocsparse_mat_descr descr,
+                                                       const float*              csr_val,
+                                                       const int64_t*            csr_row_ptr,
+                                                       const int32_t*            csr_col_ind,
+                                                       rocsparse_mat_info        info,
+                                                       const float*              x,
+                                                       float*                    y,
+                                                       rocsparse_solve_policy    policy,
+                                                       void*                     temp_buffer)
+{
+    return rocsparse_csrsv_solve_template(handle,
+                                          trans,
+                                          m,
+                                          nnz,
+                                          alpha,
+                                          descr,
+                                          csr_val,
+                                          csr_row_ptr,
+                                          csr_col_ind,
+                                          info,
+                                          x,
+                                          y,
+                                          policy,
+                                          temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrsv_solve_i64(rocsparse_handle          handle,
+                                                       rocsparse_operation       trans,
+                                                       int32_t                   m,
+                                                       int64_t                   nnz,
+                                                       const double*             alpha,
+                                                       const rocsparse_mat_descr descr,
+                                                       const double*             csr_val,
+                                                       const int64_t*            csr_row_ptr,
+                                                       const int32_t*            csr_col_ind,
+                                                       rocsparse_mat_info        info,
+                                                       const double*             x,
+                                                       double*                   y,
+                                                       rocsparse_solve_policy    policy,
+                                                       void*                     temp_buffer)
+{
+    return rocsparse_csrsv_solve_template(handle,
+                                          trans,
+                                          m,
+                                          nnz,
+                                          alpha,
+                                          descr,
+                                          csr_val,
+                                          csr_row_ptr,
+                                          csr_col_ind,
+                                          info,
+                                          x,
+                                          y,
+                                          policy,
+                                          temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_ccsrsv_solve_i64(rocsparse_handle               handle,
+                                                       rocsparse_operation            trans,
+                                                       int32_t                        m,
+                                                       int64_t                        nnz,
+                                                       const rocsparse_float_complex* alpha,
+                                                       const rocsparse_mat_descr      descr,
+                                                       const rocsparse_float_complex* csr_val,
+                                                       const int64_t*                 csr_row_ptr,
+                                                       const int32_t*                 csr_col_ind,
+                                                       rocsparse_mat_info             info,
+                                                       const rocsparse_float_complex* x,
+                                                       rocsparse_float_complex*       y,
+                                                       rocsparse_solve_policy         policy,
+                                                       void*                          temp_buffer)
+{
+    return rocsparse_csrsv_solve_template(handle,
+                                          trans,
+                                          m,
+                                          nnz,
+                                          alpha,
+                                          descr,
+                                          csr_val,
+                                          csr_row_ptr,
+                                          csr_col_ind,
+                                          info,
+                                          x,
+                                          y,
+                                          policy,
+                                          temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrsv_solve_i64(rocsparse_handle                handle,
+                                                       rocsparse_operation             trans,
+                                                       int32_t                         m,
+                                                       int64_t                         nnz,
+                                                       const rocsparse_double_complex* alpha,
+                                                       const rocsparse_mat_descr       descr,
+                                                       const rocsparse_double_complex* csr_val,
+                                                       const int64_t*                  csr_row_ptr,
+                                                       const int32_t*                  csr_col_ind,
+                                                       rocsparse_mat_info              info,
+                                                       const rocsparse_double_complex* x,
+                                                       rocsparse_double_complex*       y,
+                                                       rocsparse_solve_policy          policy,
+                                                       void*                           temp_buffer)
+{
+    return rocsparse_csrsv_solve_template(handle,
+                                          trans,
+                                          m,
+                                          nnz,
+                                          alpha,
+                                          descr,
+                                          csr_val,
+                                          csr_row_ptr,
+                                          csr_col_ind,
+                                          info,
+                                          x,
+                                          y,
+                                          policy,
+                                          temp_buffer);
+}
+
 extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle          handle,
                                                        const rocsparse_mat_descr descr,
                                                        rocsparse_mat_info        info,
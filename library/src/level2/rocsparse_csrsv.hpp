@@ -31,6 +31,9 @@
 #include "handle.h"
 #include "utility.h"
 
+#include "../conversion/rocsparse_coo2csr.hpp"
+#include "../conversion/rocsparse_csr2coo.hpp"
+#include "../conversion/rocsparse_identity.hpp"
 #include "../level1/rocsparse_gthr.hpp"
 #include "csrsv_device.h"
 
@@ -39,15 +42,15 @@
 #include <hip/hip_runtime.h>
 #include <rocprim/rocprim.hpp>
 
-template <typename T>
+template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrsv_buffer_size_template(rocsparse_handle          handle,
                                                       rocsparse_operation       trans,
-                                                      rocsparse_int             m,
-                                                      rocsparse_int             nnz,
+                                                      J                         m,
+                                                      I                         nnz,
                                                       const rocsparse_mat_descr descr,
                                                       const T*                  csr_val,
-                                                      const rocsparse_int*      csr_row_ptr,
-                                                      const rocsparse_int*      csr_col_ind,
+                                                      const I*                  csr_row_ptr,
+                                                      const J*                  csr_col_ind,
                                                       rocsparse_mat_info        info,
                                                       size_t*                   buffer_size)
 {
@@ -67,7 +70,7 @@ rocsparse_status rocsparse_csrsv_buffer_size_template(rocsparse_handle
 
     // Logging
     log_trace(handle,
-              replaceX<T>("rocsparse_Xcsrsv_buffer_size"),
+              appendIJ<I, J>(replaceX<T>("rocsparse_Xcsrsv_buffer_size")),
               trans,
               m,
               nnz,
@@ -166,12 +169,19 @@ rocsparse_status rocsparse_csrsv_buffer_size_template(rocsparse_handle
     {
         size_t transpose_size;
 
+        // Column indices are sorted as keys, carrying the permutation along
+        J* ptr_J = reinterpret_cast<J*>(buffer_size);
+        I* ptr_I = reinterpret_cast<I*>(buffer_size);
+
+        rocprim::double_buffer<J> dummy_keys(ptr_J, ptr_J);
+        rocprim::double_buffer<I> dummy_vals(ptr_I, ptr_I);
+
         // Determine rocprim buffer size
-        RETURN_IF_HIP_ERROR(
-            rocprim::radix_sort_pairs(nullptr, transpose_size, dummy, dummy, nnz, 0, 32, stream));
+        RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+            nullptr, transpose_size, dummy_keys, dummy_vals, nnz, 0, 32, stream));
 
         // rocPRIM does not support in-place sorting, so we need an additional buffer
-        transpose_size += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+        transpose_size += sizeof(I) * ((nnz - 1) / 256 + 1) * 256;
         transpose_size += sizeof(T) * ((nnz - 1) / 256 + 1) * 256;
 
         *buffer_size = std::max(*buffer_size, transpose_size);
@@ -180,15 +190,15 @@ rocsparse_status rocsparse_csrsv_buffer_size_template(rocsparse_handle
     return rocsparse_status_success;
 }
 
-template <typename T>
+template <typename I, typename J, typename T>
 static rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
                                                rocsparse_operation       trans,
-                                               rocsparse_int             m,
-                                               rocsparse_int             nnz,
+                                               J                         m,
+                                               I                         nnz,
                                                const rocsparse_mat_descr descr,
                                                const T*                  csr_val,
-                                               const rocsparse_int*      csr_row_ptr,
-                                               const rocsparse_int*      csr_col_ind,
+                                               const I*                  csr_row_ptr,
+                                               const J*                  csr_col_ind,
                                                rocsparse_trm_info        info,
                                                rocsparse_int**           zero_pivot,
                                                void*                     temp_buffer)
@@ -209,32 +219,35 @@ static rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
         char* ptr = reinterpret_cast<char*>(temp_buffer);
 
         // work1 buffer
-        rocsparse_int* tmp_work1 = reinterpret_cast<rocsparse_int*>(ptr);
-        ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+        J* tmp_work1 = reinterpret_cast<J*>(ptr);
+        ptr += sizeof(J) * ((nnz - 1) / 256 + 1) * 256;
 
         // work2 buffer
-        rocsparse_int* tmp_work2 = reinterpret_cast<rocsparse_int*>(ptr);
-        ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+        I* tmp_work2 = reinterpret_cast<I*>(ptr);
+        ptr += sizeof(I) * ((nnz - 1) / 256 + 1) * 256;
 
         // rocprim buffer
         void* rocprim_buffer = reinterpret_cast<void*>(ptr);
 
         // Load CSR column indices into work1 buffer
         RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-            tmp_work1, csr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToDevice, stream));
+            tmp_work1, csr_col_ind, sizeof(J) * nnz, hipMemcpyDeviceToDevice, stream));
 
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->trmt_perm, sizeof(rocsparse_int) * nnz));
-        RETURN_IF_HIP_ERROR(
-            hipMalloc((void**)&info->trmt_row_ptr, sizeof(rocsparse_int) * (m + 1)));
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->trmt_col_ind, sizeof(rocsparse_int) * nnz));
+        RETURN_IF_HIP_ERROR(hipMalloc(&info->trmt_perm, sizeof(I) * nnz));
+        RETURN_IF_HIP_ERROR(hipMalloc(&info->trmt_row_ptr, sizeof(I) * (m + 1)));
+        RETURN_IF_HIP_ERROR(hipMalloc(&info->trmt_col_ind, sizeof(J) * nnz));
+
+        I* trmt_perm    = reinterpret_cast<I*>(info->trmt_perm);
+        I* trmt_row_ptr = reinterpret_cast<I*>(info->trmt_row_ptr);
+        J* trmt_col_ind = reinterpret_cast<J*>(info->trmt_col_ind);
 
         // Create identity permutation
         RETURN_IF_ROCSPARSE_ERROR(
-            rocsparse_create_identity_permutation(handle, nnz, info->trmt_perm));
+            rocsparse_create_identity_permutation_template(handle, nnz, trmt_perm));
 
         // Stable sort COO by columns
-        rocprim::double_buffer<rocsparse_int> keys(tmp_work1, info->trmt_col_ind);
-        rocprim::double_buffer<rocsparse_int> vals(info->trmt_perm, tmp_work2);
+        rocprim::double_buffer<J> keys(tmp_work1, trmt_col_ind);
+        rocprim::double_buffer<I> vals(trmt_perm, tmp_work2);
 
         unsigned int startbit = 0;
         unsigned int endbit   = rocsparse_clz(m);
@@ -247,30 +260,26 @@ static rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
             rocprim_buffer, rocprim_size, keys, vals, nnz, startbit, endbit, stream));
 
         // Copy permutation vector, if not already available
-        if(vals.current() != info->trmt_perm)
+        if(vals.current() != trmt_perm)
         {
-            RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->trmt_perm,
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(trmt_perm,
                                                vals.current(),
-                                               sizeof(rocsparse_int) * nnz,
+                                               sizeof(I) * nnz,
                                                hipMemcpyDeviceToDevice,
                                                stream));
         }
 
         // Create column pointers
-        RETURN_IF_ROCSPARSE_ERROR(
-            rocsparse_coo2csr(handle, keys.current(), nnz, m, info->trmt_row_ptr, descr->base));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_coo2csr_template(
+            handle, keys.current(), nnz, m, trmt_row_ptr, descr->base));
 
         // Create row indices
         RETURN_IF_ROCSPARSE_ERROR(
-            rocsparse_csr2coo(handle, csr_row_ptr, nnz, m, tmp_work1, descr->base));
+            rocsparse_csr2coo_template(handle, csr_row_ptr, nnz, m, tmp_work1, descr->base));
 
         // Permute column indices
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_gthr_template(handle,
-                                                          nnz,
-                                                          tmp_work1,
-                                                          info->trmt_col_ind,
-                                                          info->trmt_perm,
-                                                          rocsparse_index_base_zero));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_gthr_template(
+            handle, nnz, tmp_work1, trmt_col_ind, trmt_perm, rocsparse_index_base_zero));
     }
 
     // Buffer
@@ -300,21 +309,38 @@ static rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
     void* rocprim_buffer = reinterpret_cast<void*>(ptr);
 
     // Allocate buffer to hold diagonal entry point
-    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->trm_diag_ind, sizeof(rocsparse_int) * m));
+    RETURN_IF_HIP_ERROR(hipMalloc(&info->trm_diag_ind, sizeof(I) * m));
+
+    I* trm_diag_ind = reinterpret_cast<I*>(info->trm_diag_ind);
 
-    // Allocate buffer to hold zero pivot
-    RETURN_IF_HIP_ERROR(hipMalloc((void**)zero_pivot, sizeof(rocsparse_int)));
+    // Matrix to be analyzed, the transposed matrix has been set up above
+    const I* trm_row_ptr = (trans == rocsparse_operation_none)
+                               ? csr_row_ptr
+                               : reinterpret_cast<const I*>(info->trmt_row_ptr);
+    const J* trm_col_ind = (trans == rocsparse_operation_none)
+                               ? csr_col_ind
+                               : reinterpret_cast<const J*>(info->trmt_col_ind);
+
+    // Allocate buffer to hold zero pivot, if not already available
+    if(*zero_pivot == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)zero_pivot, sizeof(rocsparse_int)));
+    }
+
+    // Allocate buffer to hold maximum number of non-zeros per row
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->d_max_nnz, sizeof(rocsparse_int)));
 
     // Allocate buffer to hold row map
     RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->row_map, sizeof(rocsparse_int) * m));
 
-    // Initialize zero pivot
-    rocsparse_int max = std::numeric_limits<rocsparse_int>::max();
-    RETURN_IF_HIP_ERROR(
-        hipMemcpyAsync(*zero_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
-
-    // Wait for device transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    // Initialize zero pivot on the device, to avoid synchronization
+    hipLaunchKernelGGL((csrsv_init_zero_pivot_kernel<rocsparse_int>),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       stream,
+                       *zero_pivot,
+                       std::numeric_limits<rocsparse_int>::max());
 
     // Determine gcnArch and ASIC revision
     int gcnArch = handle->properties.gcnArch;
@@ -331,15 +357,15 @@ static rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
         {
             if(descr->fill_mode == rocsparse_fill_mode_upper)
             {
-                hipLaunchKernelGGL((csrsv_analysis_upper_kernel<CSRSV_DIM, 64, true>),
+                hipLaunchKernelGGL((csrsv_analysis_upper_kernel<I, J, CSRSV_DIM, 64, true>),
                                    csrsv_blocks,
                                    csrsv_threads,
                                    0,
                                    stream,
                                    m,
-                                   csr_row_ptr,
-                                   csr_col_ind,
-                                   info->trm_diag_ind,
+                                   trm_row_ptr,
+                                   trm_col_ind,
+                                   trm_diag_ind,
                                    done_array,
                                    d_max_nnz,
                                    *zero_pivot,
@@ -348,15 +374,15 @@ static rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
             }
             else if(descr->fill_mode == rocsparse_fill_mode_lower)
             {
-                hipLaunchKernelGGL((csrsv_analysis_lower_kernel<CSRSV_DIM, 64, true>),
+                hipLaunchKernelGGL((csrsv_analysis_lower_kernel<I, J, CSRSV_DIM, 64, true>),
                                    csrsv_blocks,
                                    csrsv_threads,
                                    0,
                                    stream,
                                    m,
-                                   csr_row_ptr,
-                                   csr_col_ind,
-                                   info->trm_diag_ind,
+                                   trm_row_ptr,
+                                   trm_col_ind,
+                                   trm_diag_ind,
                                    done_array,
                                    d_max_nnz,
                                    *zero_pivot,
@@ -370,15 +396,15 @@ static rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
             {
                 if(descr->fill_mode == rocsparse_fill_mode_upper)
                 {
-                    hipLaunchKernelGGL((csrsv_analysis_upper_kernel<CSRSV_DIM, 32, false>),
+                    hipLaunchKernelGGL((csrsv_analysis_upper_kernel<I, J, CSRSV_DIM, 32, false>),
                                        csrsv_blocks,
                                        csrsv_threads,
                                        0,
                                        stream,
                                        m,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       info->trm_diag_ind,
+                                       trm_row_ptr,
+                                       trm_col_ind,
+                                       trm_diag_ind,
                                        done_array,
                                        d_max_nnz,
                                        *zero_pivot,
@@ -387,15 +413,15 @@ static rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
                 }
                 else if(descr->fill_mode == rocsparse_fill_mode_lower)
                 {
-                    hipLaunchKernelGGL((csrsv_analysis_lower_kernel<CSRSV_DIM, 32, false>),
+                    hipLaunchKernelGGL((csrsv_analysis_lower_kernel<I, J, CSRSV_DIM, 32, false>),
                                        csrsv_blocks,
                                        csrsv_threads,
                                        0,
                                        stream,
                                        m,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       info->trm_diag_ind,
+                                       trm_row_ptr,
+                                       trm_col_ind,
+                                       trm_diag_ind,
                                        done_array,
                                        d_max_nnz,
                                        *zero_pivot,
@@ -407,15 +433,15 @@ static rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
             {
                 if(descr->fill_mode == rocsparse_fill_mode_upper)
                 {
-                    hipLaunchKernelGGL((csrsv_analysis_upper_kernel<CSRSV_DIM, 64, false>),
+                    hipLaunchKernelGGL((csrsv_analysis_upper_kernel<I, J, CSRSV_DIM, 64, false>),
                                        csrsv_blocks,
                                        csrsv_threads,
                                        0,
                                        stream,
                                        m,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       info->trm_diag_ind,
+                                       trm_row_ptr,
+                                       trm_col_ind,
+                                       trm_diag_ind,
                                        done_array,
                                        d_max_nnz,
                                        *zero_pivot,
@@ -424,15 +450,15 @@ static rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
                 }
                 else if(descr->fill_mode == rocsparse_fill_mode_lower)
                 {
-                    hipLaunchKernelGGL((csrsv_analysis_lower_kernel<CSRSV_DIM, 64, false>),
+                    hipLaunchKernelGGL((csrsv_analysis_lower_kernel<I, J, CSRSV_DIM, 64, false>),
                                        csrsv_blocks,
                                        csrsv_threads,
                                        0,
                                        stream,
                                        m,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       info->trm_diag_ind,
+                                       trm_row_ptr,
+                                       trm_col_ind,
+                                       trm_diag_ind,
                                        done_array,
                                        d_max_nnz,
                                        *zero_pivot,
@@ -452,15 +478,15 @@ static rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
         {
             if(descr->fill_mode == rocsparse_fill_mode_upper)
             {
-                hipLaunchKernelGGL((csrsv_analysis_lower_kernel<CSRSV_DIM, 64, true>),
+                hipLaunchKernelGGL((csrsv_analysis_lower_kernel<I, J, CSRSV_DIM, 64, true>),
                                    csrsv_blocks,
                                    csrsv_threads,
                                    0,
                                    stream,
                                    m,
-                                   info->trmt_row_ptr,
-                                   info->trmt_col_ind,
-                                   info->trm_diag_ind,
+                                   trm_row_ptr,
+                                   trm_col_ind,
+                                   trm_diag_ind,
                                    done_array,
                                    d_max_nnz,
                                    *zero_pivot,
@@ -469,15 +495,15 @@ static rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
             }
             else if(descr->fill_mode == rocsparse_fill_mode_lower)
             {
-                hipLaunchKernelGGL((csrsv_analysis_upper_kernel<CSRSV_DIM, 64, true>),
+                hipLaunchKernelGGL((csrsv_analysis_upper_kernel<I, J, CSRSV_DIM, 64, true>),
                                    csrsv_blocks,
                                    csrsv_threads,
                                    0,
                                    stream,
                                    m,
-                                   info->trmt_row_ptr,
-                                   info->trmt_col_ind,
-                                   info->trm_diag_ind,
+                                   trm_row_ptr,
+                                   trm_col_ind,
+                                   trm_diag_ind,
                                    done_array,
                                    d_max_nnz,
                                    *zero_pivot,
@@ -491,15 +517,15 @@ static rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
             {
                 if(descr->fill_mode == rocsparse_fill_mode_upper)
                 {
-                    hipLaunchKernelGGL((csrsv_analysis_lower_kernel<CSRSV_DIM, 32, false>),
+                    hipLaunchKernelGGL((csrsv_analysis_lower_kernel<I, J, CSRSV_DIM, 32, false>),
                                        csrsv_blocks,
                                        csrsv_threads,
                                        0,
                                        stream,
                                        m,
-                                       info->trmt_row_ptr,
-                                       info->trmt_col_ind,
-                                       info->trm_diag_ind,
+                                       trm_row_ptr,
+                                       trm_col_ind,
+                                       trm_diag_ind,
                                        done_array,
                                        d_max_nnz,
                                        *zero_pivot,
@@ -508,15 +534,15 @@ static rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
                 }
                 else if(descr->fill_mode == rocsparse_fill_mode_lower)
                 {
-                    hipLaunchKernelGGL((csrsv_analysis_upper_kernel<CSRSV_DIM, 32, false>),
+                    hipLaunchKernelGGL((csrsv_analysis_upper_kernel<I, J, CSRSV_DIM, 32, false>),
                                        csrsv_blocks,
                                        csrsv_threads,
                                        0,
                                        stream,
                                        m,
-                                       info->trmt_row_ptr,
-                                       info->trmt_col_ind,
-                                       info->trm_diag_ind,
+                                       trm_row_ptr,
+                                       trm_col_ind,
+                                       trm_diag_ind,
                                        done_array,
                                        d_max_nnz,
                                        *zero_pivot,
@@ -528,15 +554,15 @@ static rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
             {
                 if(descr->fill_mode == rocsparse_fill_mode_upper)
                 {
-                    hipLaunchKernelGGL((csrsv_analysis_lower_kernel<CSRSV_DIM, 64, false>),
+                    hipLaunchKernelGGL((csrsv_analysis_lower_kernel<I, J, CSRSV_DIM, 64, false>),
                                        csrsv_blocks,
                                        csrsv_threads,
                                        0,
                                        stream,
                                        m,
-                                       info->trmt_row_ptr,
-                                       info->trmt_col_ind,
-                                       info->trm_diag_ind,
+                                       trm_row_ptr,
+                                       trm_col_ind,
+                                       trm_diag_ind,
                                        done_array,
                                        d_max_nnz,
                                        *zero_pivot,
@@ -545,15 +571,15 @@ static rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
                 }
                 else if(descr->fill_mode == rocsparse_fill_mode_lower)
                 {
-                    hipLaunchKernelGGL((csrsv_analysis_upper_kernel<CSRSV_DIM, 64, false>),
+                    hipLaunchKernelGGL((csrsv_analysis_upper_kernel<I, J, CSRSV_DIM, 64, false>),
                                        csrsv_blocks,
                                        csrsv_threads,
                                        0,
                                        stream,
                                        m,
-                                       info->trmt_row_ptr,
-                                       info->trmt_col_ind,
-                                       info->trm_diag_ind,
+                                       trm_row_ptr,
+                                       trm_col_ind,
+                                       trm_diag_ind,
                                        done_array,
                                        d_max_nnz,
                                        *zero_pivot,
@@ -573,12 +599,13 @@ static rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
     }
 #undef CSRSV_DIM
 
-    // Post processing
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        &info->max_nnz, d_max_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
-
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    // Post processing - maximum number of non-zeros per row stays on the device.
+    // Routines that need it on the host fetch it on demand.
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->d_max_nnz,
+                                       d_max_nnz,
+                                       sizeof(rocsparse_int),
+                                       hipMemcpyDeviceToDevice,
+                                       stream));
 
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, m, workspace));
 
@@ -608,21 +635,23 @@ static rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
     info->m           = m;
     info->nnz         = nnz;
     info->descr       = descr;
-    info->trm_row_ptr = (trans == rocsparse_operation_none) ? csr_row_ptr : info->trmt_row_ptr;
-    info->trm_col_ind = (trans == rocsparse_operation_none) ? csr_col_ind : info->trmt_col_ind;
+    info->trm_row_ptr = trm_row_ptr;
+    info->trm_col_ind = trm_col_ind;
+    info->offset_size = sizeof(I);
+    info->index_size  = sizeof(J);
 
     return rocsparse_status_success;
 }
 
-template <typename T>
+template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          handle,
                                                    rocsparse_operation       trans,
-                                                   rocsparse_int             m,
-                                                   rocsparse_int             nnz,
+                                                   J                         m,
+                                                   I                         nnz,
                                                    const rocsparse_mat_descr descr,
                                                    const T*                  csr_val,
-                                                   const rocsparse_int*      csr_row_ptr,
-                                                   const rocsparse_int*      csr_col_ind,
+                                                   const I*                  csr_row_ptr,
+                                                   const J*                  csr_col_ind,
                                                    rocsparse_mat_info        info,
                                                    rocsparse_analysis_policy analysis,
                                                    rocsparse_solve_policy    solve,
@@ -644,7 +673,7 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
 
     // Logging
     log_trace(handle,
-              replaceX<T>("rocsparse_Xcsrsv_analysis"),
+              appendIJ<I, J>(replaceX<T>("rocsparse_Xcsrsv_analysis")),
               trans,
               m,
               nnz,
@@ -853,15 +882,24 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
     return rocsparse_status_success;
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SLEEP>
+template <typename I,
+          typename     J,
+          typename     T,
+          typename     U,
+          unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          bool         SLEEP>
 __launch_bounds__(BLOCKSIZE) __global__
-    void csrsv_host_pointer(rocsparse_int m,
-                            T             alpha,
-                            const rocsparse_int* __restrict__ csr_row_ptr,
-                            const rocsparse_int* __restrict__ csr_col_ind,
-                            const T* __restrict__ csr_val,
+    void csrsv_host_pointer(J m,
+                            T alpha,
+                            const I* __restrict__ csr_row_ptr,
+                            const J* __restrict__ csr_col_ind,
+                            const U* __restrict__ csr_val,
+                            rocsparse_int stride_val,
                             const T* __restrict__ x,
+                            rocsparse_int stride_x,
                             T* __restrict__ y,
+                            rocsparse_int stride_y,
                             int* __restrict__ done_array,
                             rocsparse_int* __restrict__ map,
                             rocsparse_int offset,
@@ -870,31 +908,43 @@ __launch_bounds__(BLOCKSIZE) __global__
                             rocsparse_fill_mode  fill_mode,
                             rocsparse_diag_type  diag_type)
 {
-    csrsv_device<T, BLOCKSIZE, WF_SIZE, SLEEP>(m,
-                                               alpha,
-                                               csr_row_ptr,
-                                               csr_col_ind,
-                                               csr_val,
-                                               x,
-                                               y,
-                                               done_array,
-                                               map,
-                                               offset,
-                                               zero_pivot,
-                                               idx_base,
-                                               fill_mode,
-                                               diag_type);
+    csrsv_device<I, J, T, U, BLOCKSIZE, WF_SIZE, SLEEP>(m,
+                                                        alpha,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        csr_val,
+                                                        stride_val,
+                                                        x,
+                                                        stride_x,
+                                                        y,
+                                                        stride_y,
+                                                        done_array,
+                                                        map,
+                                                        offset,
+                                                        zero_pivot,
+                                                        idx_base,
+                                                        fill_mode,
+                                                        diag_type);
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SLEEP>
+template <typename I,
+          typename     J,
+          typename     T,
+          typename     U,
+          unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          bool         SLEEP>
 __launch_bounds__(BLOCKSIZE) __global__
-    void csrsv_device_pointer(rocsparse_int m,
-                              const T*      alpha,
-                              const rocsparse_int* __restrict__ csr_row_ptr,
-                              const rocsparse_int* __restrict__ csr_col_ind,
-                              const T* __restrict__ csr_val,
+    void csrsv_device_pointer(J        m,
+                              const T* alpha,
+                              const I* __restrict__ csr_row_ptr,
+                              const J* __restrict__ csr_col_ind,
+                              const U* __restrict__ csr_val,
+                              rocsparse_int stride_val,
                               const T* __restrict__ x,
+                              rocsparse_int stride_x,
                               T* __restrict__ y,
+                              rocsparse_int stride_y,
                               int* __restrict__ done_array,
                               rocsparse_int* __restrict__ map,
                               rocsparse_int offset,
@@ -903,32 +953,245 @@ __launch_bounds__(BLOCKSIZE) __global__
                               rocsparse_fill_mode  fill_mode,
                               rocsparse_diag_type  diag_type)
 {
-    csrsv_device<T, BLOCKSIZE, WF_SIZE, SLEEP>(m,
-                                               *alpha,
-                                               csr_row_ptr,
-                                               csr_col_ind,
-                                               csr_val,
-                                               x,
-                                               y,
-                                               done_array,
-                                               map,
-                                               offset,
-                                               zero_pivot,
-                                               idx_base,
-                                               fill_mode,
-                                               diag_type);
+    csrsv_device<I, J, T, U, BLOCKSIZE, WF_SIZE, SLEEP>(m,
+                                                        *alpha,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        csr_val,
+                                                        stride_val,
+                                                        x,
+                                                        stride_x,
+                                                        y,
+                                                        stride_y,
+                                                        done_array,
+                                                        map,
+                                                        offset,
+                                                        zero_pivot,
+                                                        idx_base,
+                                                        fill_mode,
+                                                        diag_type);
 }
 
-template <typename T>
+template <typename I, typename J, typename T, typename U>
+static rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle     handle,
+                                                       J                    m,
+                                                       const T*             alpha,
+                                                       const I*             csr_row_ptr,
+                                                       const J*             csr_col_ind,
+                                                       const U*             csr_val,
+                                                       rocsparse_int        stride_val,
+                                                       const T*             x,
+                                                       rocsparse_int        stride_x,
+                                                       T*                   y,
+                                                       rocsparse_int        stride_y,
+                                                       rocsparse_int        batch_count,
+                                                       int*                 done_array,
+                                                       rocsparse_trm_info   csrsv,
+                                                       rocsparse_int*       zero_pivot,
+                                                       rocsparse_index_base base,
+                                                       rocsparse_fill_mode  fill_mode,
+                                                       rocsparse_diag_type  diag_type)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Determine gcnArch
+    int gcnArch = handle->properties.gcnArch;
+    int asicRev = handle->asic_rev;
+
+#define CSRSV_DIM 1024
+    dim3 csrsv_blocks((handle->wavefront_size * m - 1) / CSRSV_DIM + 1, batch_count);
+    dim3 csrsv_threads(CSRSV_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // gfx908
+        if(gcnArch == 908 && asicRev < 2)
+        {
+            hipLaunchKernelGGL((csrsv_device_pointer<I, J, T, U, CSRSV_DIM, 64, true>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               m,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               stride_val,
+                               x,
+                               stride_x,
+                               y,
+                               stride_y,
+                               done_array,
+                               csrsv->row_map,
+                               0,
+                               zero_pivot,
+                               base,
+                               fill_mode,
+                               diag_type);
+        }
+        else
+        {
+            // rocsparse_pointer_mode_device
+            if(handle->wavefront_size == 32)
+            {
+                hipLaunchKernelGGL((csrsv_device_pointer<I, J, T, U, CSRSV_DIM, 32, false>),
+                                   csrsv_blocks,
+                                   csrsv_threads,
+                                   0,
+                                   stream,
+                                   m,
+                                   alpha,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   csr_val,
+                                   stride_val,
+                                   x,
+                                   stride_x,
+                                   y,
+                                   stride_y,
+                                   done_array,
+                                   csrsv->row_map,
+                                   0,
+                                   zero_pivot,
+                                   base,
+                                   fill_mode,
+                                   diag_type);
+            }
+            else if(handle->wavefront_size == 64)
+            {
+                hipLaunchKernelGGL((csrsv_device_pointer<I, J, T, U, CSRSV_DIM, 64, false>),
+                                   csrsv_blocks,
+                                   csrsv_threads,
+                                   0,
+                                   stream,
+                                   m,
+                                   alpha,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   csr_val,
+                                   stride_val,
+                                   x,
+                                   stride_x,
+                                   y,
+                                   stride_y,
+                                   done_array,
+                                   csrsv->row_map,
+                                   0,
+                                   zero_pivot,
+                                   base,
+                                   fill_mode,
+                                   diag_type);
+            }
+            else
+            {
+                return rocsparse_status_arch_mismatch;
+            }
+        }
+    }
+    else
+    {
+        // gfx908
+        if(gcnArch == 908 && asicRev < 2)
+        {
+            hipLaunchKernelGGL((csrsv_host_pointer<I, J, T, U, CSRSV_DIM, 64, true>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               m,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               stride_val,
+                               x,
+                               stride_x,
+                               y,
+                               stride_y,
+                               done_array,
+                               csrsv->row_map,
+                               0,
+                               zero_pivot,
+                               base,
+                               fill_mode,
+                               diag_type);
+        }
+        else
+        {
+            // rocsparse_pointer_mode_host
+            if(handle->wavefront_size == 32)
+            {
+                hipLaunchKernelGGL((csrsv_host_pointer<I, J, T, U, CSRSV_DIM, 32, false>),
+                                   csrsv_blocks,
+                                   csrsv_threads,
+                                   0,
+                                   stream,
+                                   m,
+                                   *alpha,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   csr_val,
+                                   stride_val,
+                                   x,
+                                   stride_x,
+                                   y,
+                                   stride_y,
+                                   done_array,
+                                   csrsv->row_map,
+                                   0,
+                                   zero_pivot,
+                                   base,
+                                   fill_mode,
+                                   diag_type);
+            }
+            else if(handle->wavefront_size == 64)
+            {
+                hipLaunchKernelGGL((csrsv_host_pointer<I, J, T, U, CSRSV_DIM, 64, false>),
+                                   csrsv_blocks,
+                                   csrsv_threads,
+                                   0,
+                                   stream,
+                                   m,
+                                   *alpha,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   csr_val,
+                                   stride_val,
+                                   x,
+                                   stride_x,
+                                   y,
+                                   stride_y,
+                                   done_array,
+                                   csrsv->row_map,
+                                   0,
+                                   zero_pivot,
+                                   base,
+                                   fill_mode,
+                                   diag_type);
+            }
+            else
+            {
+                return rocsparse_status_arch_mismatch;
+            }
+        }
+    }
+#undef CSRSV_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T, typename U>
 rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle,
                                                 rocsparse_operation       trans,
-                                                rocsparse_int             m,
-                                                rocsparse_int             nnz,
+                                                J                         m,
+                                                I                         nnz,
                                                 const T*                  alpha,
                                                 const rocsparse_mat_descr descr,
-                                                const T*                  csr_val,
-                                                const rocsparse_int*      csr_row_ptr,
-                                                const rocsparse_int*      csr_col_ind,
+                                                const U*                  csr_val,
+                                                const I*                  csr_row_ptr,
+                                                const J*                  csr_col_ind,
                                                 rocsparse_mat_info        info,
                                                 const T*                  x,
                                                 T*                        y,
@@ -953,7 +1216,7 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrsv"),
+                  appendIJ<I, J>(replaceXY<T, U>("rocsparse_XYcsrsv")),
                   trans,
                   m,
                   nnz,
@@ -969,7 +1232,9 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
                   (const void*&)temp_buffer);
 
         log_bench(handle,
-                  "./rocsparse-bench -f csrsv -r",
+                  appendIJ<I, J>(std::is_same<T, U>() ? "./rocsparse-bench -f csrsv"
+                                                      : "./rocsparse-bench -f csrsv_mixed")
+                      + " -r",
                   replaceX<T>("X"),
                   "--mtx <matrix.mtx> ",
                   "--alpha",
@@ -978,7 +1243,7 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
     else
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrsv"),
+                  appendIJ<I, J>(replaceXY<T, U>("rocsparse_XYcsrsv")),
                   trans,
                   m,
                   nnz,
@@ -1084,21 +1349,28 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
         return rocsparse_status_invalid_pointer;
     }
 
+    // Check that the meta data has been gathered for the same index types
+    if(csrsv->offset_size != sizeof(I) || csrsv->index_size != sizeof(J))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
     // If diag type is unit, re-initialize zero pivot to remove structural zeros
     if(descr->diag_type == rocsparse_diag_type_unit)
     {
-        rocsparse_int max = std::numeric_limits<rocsparse_int>::max();
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-            info->zero_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
-
-        // Wait for device transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        hipLaunchKernelGGL((csrsv_init_zero_pivot_kernel<rocsparse_int>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           info->zero_pivot,
+                           std::numeric_limits<rocsparse_int>::max());
     }
 
     // Pointers to differentiate between transpose mode
-    const rocsparse_int* local_csr_row_ptr = csr_row_ptr;
-    const rocsparse_int* local_csr_col_ind = csr_col_ind;
-    const T*             local_csr_val     = csr_val;
+    const I* local_csr_row_ptr = csr_row_ptr;
+    const J* local_csr_col_ind = csr_col_ind;
+    const U* local_csr_val     = csr_val;
 
     rocsparse_fill_mode fill_mode = descr->fill_mode;
 
@@ -1106,187 +1378,42 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle          handle
     // transposed matrix values
     if(trans == rocsparse_operation_transpose)
     {
-        T* csrt_val = reinterpret_cast<T*>(ptr);
+        U* csrt_val = reinterpret_cast<U*>(ptr);
 
         // Gather values
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_gthr_template(
-            handle, nnz, csr_val, csrt_val, csrsv->trmt_perm, rocsparse_index_base_zero));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_gthr_template(handle,
+                                                          nnz,
+                                                          csr_val,
+                                                          csrt_val,
+                                                          (const I*)csrsv->trmt_perm,
+                                                          rocsparse_index_base_zero));
 
-        local_csr_row_ptr = csrsv->trmt_row_ptr;
-        local_csr_col_ind = csrsv->trmt_col_ind;
+        local_csr_row_ptr = (const I*)csrsv->trmt_row_ptr;
+        local_csr_col_ind = (const J*)csrsv->trmt_col_ind;
         local_csr_val     = csrt_val;
 
         fill_mode = (fill_mode == rocsparse_fill_mode_lower) ? rocsparse_fill_mode_upper
                                                              : rocsparse_fill_mode_lower;
     }
 
-    // Determine gcnArch
-    int gcnArch = handle->properties.gcnArch;
-    int asicRev = handle->asic_rev;
-
-#define CSRSV_DIM 1024
-    dim3 csrsv_blocks((handle->wavefront_size * m - 1) / CSRSV_DIM + 1);
-    dim3 csrsv_threads(CSRSV_DIM);
-
-    if(handle->pointer_mode == rocsparse_pointer_mode_device)
-    {
-        // gfx908
-        if(gcnArch == 908 && asicRev < 2)
-        {
-            hipLaunchKernelGGL((csrsv_device_pointer<T, CSRSV_DIM, 64, true>),
-                               csrsv_blocks,
-                               csrsv_threads,
-                               0,
-                               stream,
-                               m,
-                               alpha,
-                               local_csr_row_ptr,
-                               local_csr_col_ind,
-                               local_csr_val,
-                               x,
-                               y,
-                               done_array,
-                               csrsv->row_map,
-                               0,
-                               info->zero_pivot,
-                               descr->base,
-                               fill_mode,
-                               descr->diag_type);
-        }
-        else
-        {
-            // rocsparse_pointer_mode_device
-            if(handle->wavefront_size == 32)
-            {
-                hipLaunchKernelGGL((csrsv_device_pointer<T, CSRSV_DIM, 32, false>),
-                                   csrsv_blocks,
-                                   csrsv_threads,
-                                   0,
-                                   stream,
-                                   m,
-                                   alpha,
-                                   local_csr_row_ptr,
-                                   local_csr_col_ind,
-                                   local_csr_val,
-                                   x,
-                                   y,
-                                   done_array,
-                                   csrsv->row_map,
-                                   0,
-                                   info->zero_pivot,
-                                   descr->base,
-                                   fill_mode,
-                                   descr->diag_type);
-            }
-            else if(handle->wavefront_size == 64)
-            {
-                hipLaunchKernelGGL((csrsv_device_pointer<T, CSRSV_DIM, 64, false>),
-                                   csrsv_blocks,
-                                   csrsv_threads,
-                                   0,
-                                   stream,
-                                   m,
-                                   alpha,
-                                   local_csr_row_ptr,
-                                   local_csr_col_ind,
-                                   local_csr_val,
-                                   x,
-                                   y,
-                                   done_array,
-                                   csrsv->row_map,
-                                   0,
-                                   info->zero_pivot,
-                                   descr->base,
-                                   fill_mode,
-                                   descr->diag_type);
-            }
-            else
-            {
-                return rocsparse_status_arch_mismatch;
-            }
-        }
-    }
-    else
-    {
-        // gfx908
-        if(gcnArch == 908 && asicRev < 2)
-        {
-            hipLaunchKernelGGL((csrsv_host_pointer<T, CSRSV_DIM, 64, true>),
-                               csrsv_blocks,
-                               csrsv_threads,
-                               0,
-                               stream,
-                               m,
-                               *alpha,
-                               local_csr_row_ptr,
-                               local_csr_col_ind,
-                               local_csr_val,
-                               x,
-                               y,
-                               done_array,
-                               csrsv->row_map,
-                               0,
-                               info->zero_pivot,
-                               descr->base,
-                               fill_mode,
-                               descr->diag_type);
-        }
-        else
-        {
-            // rocsparse_pointer_mode_host
-            if(handle->wavefront_size == 32)
-            {
-                hipLaunchKernelGGL((csrsv_host_pointer<T, CSRSV_DIM, 32, false>),
-                                   csrsv_blocks,
-                                   csrsv_threads,
-                                   0,
-                                   stream,
-                                   m,
-                                   *alpha,
-                                   local_csr_row_ptr,
-                                   local_csr_col_ind,
-                                   local_csr_val,
-                                   x,
-                                   y,
-                                   done_array,
-                                   csrsv->row_map,
-                                   0,
-                                   info->zero_pivot,
-                                   descr->base,
-                                   fill_mode,
-                                   descr->diag_type);
-            }
-            else if(handle->wavefront_size == 64)
-            {
-                hipLaunchKernelGGL((csrsv_host_pointer<T, CSRSV_DIM, 64, false>),
-                                   csrsv_blocks,
-                                   csrsv_threads,
-                                   0,
-                                   stream,
-                                   m,
-                                   *alpha,
-                                   local_csr_row_ptr,
-                                   local_csr_col_ind,
-                                   local_csr_val,
-                                   x,
-                                   y,
-                                   done_array,
-                                   csrsv->row_map,
-                                   0,
-                                   info->zero_pivot,
-                                   descr->base,
-                                   fill_mode,
-                                   descr->diag_type);
-            }
-            else
-            {
-                return rocsparse_status_arch_mismatch;
-            }
-        }
-    }
-#undef CSRSV_DIM
-
-    return rocsparse_status_success;
+    return rocsparse_csrsv_solve_dispatch(handle,
+                                          m,
+                                          alpha,
+                                          local_csr_row_ptr,
+                                          local_csr_col_ind,
+                                          local_csr_val,
+                                          0,
+                                          x,
+                                          0,
+                                          y,
+                                          0,
+                                          1,
+                                          done_array,
+                                          csrsv,
+                                          info->zero_pivot,
+                                          descr->base,
+                                          fill_mode,
+                                          descr->diag_type);
 }
 
 #endif // ROCSPARSE_CSRSV_HPP
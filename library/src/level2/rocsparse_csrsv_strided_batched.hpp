@@ -0,0 +1,319 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRSV_STRIDED_BATCHED_HPP
+#define ROCSPARSE_CSRSV_STRIDED_BATCHED_HPP
+
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "rocsparse_csrsv.hpp"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T>
+rocsparse_status
+    rocsparse_csrsv_strided_batched_buffer_size_template(rocsparse_handle          handle,
+                                                         rocsparse_operation       trans,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             nnz,
+                                                         const rocsparse_mat_descr descr,
+                                                         const T*                  csr_val,
+                                                         const rocsparse_int*      csr_row_ptr,
+                                                         const rocsparse_int*      csr_col_ind,
+                                                         rocsparse_mat_info        info,
+                                                         rocsparse_int             batch_count,
+                                                         size_t*                   buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrsv_strided_batched_buffer_size"),
+              trans,
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              batch_count,
+              (const void*&)buffer_size);
+
+    // Check batch size
+    if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // The analysis and the single solve share the same buffer layout
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size_template(
+        handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size));
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Each matrix of the batch requires its own done array
+    size_t batch_size = 256;
+    batch_size += sizeof(int) * (((size_t)m * batch_count - 1) / 256 + 1) * 256;
+
+    *buffer_size = std::max(*buffer_size, batch_size);
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status
+    rocsparse_csrsv_solve_strided_batched_template(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nnz,
+                                                   const T*                  alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csr_val,
+                                                   rocsparse_int             stride_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_mat_info        info,
+                                                   const T*                  x,
+                                                   rocsparse_int             stride_x,
+                                                   T*                        y,
+                                                   rocsparse_int             stride_y,
+                                                   rocsparse_int             batch_count,
+                                                   rocsparse_solve_policy    policy,
+                                                   void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrsv_solve_strided_batched"),
+                  trans,
+                  m,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  stride_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)x,
+                  stride_x,
+                  (const void*&)y,
+                  stride_y,
+                  batch_count,
+                  policy,
+                  (const void*&)temp_buffer);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f csrsv_strided_batched -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> ",
+                  "--alpha",
+                  *alpha,
+                  "--batch_count",
+                  batch_count);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrsv_solve_strided_batched"),
+                  trans,
+                  m,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  stride_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)x,
+                  stride_x,
+                  (const void*&)y,
+                  stride_y,
+                  batch_count,
+                  policy,
+                  (const void*&)temp_buffer);
+    }
+
+    // Check operation type
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(stride_val < 0 || stride_x < 0 || stride_y < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Solution vectors of the batch must not overlap
+    if(batch_count > 1 && stride_y < m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The analysis meta data is shared by all matrices of the batch
+    rocsparse_trm_info csrsv = (descr->fill_mode == rocsparse_fill_mode_upper)
+                                   ? info->csrsv_upper_info
+                                   : info->csrsv_lower_info;
+
+    if(csrsv == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    ptr += 256;
+
+    // done array, one for each matrix of the batch
+    int* done_array = reinterpret_cast<int*>(ptr);
+
+    // Initialize buffers
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(done_array, 0, sizeof(int) * m * batch_count, stream));
+
+    // If diag type is unit, re-initialize zero pivot to remove structural zeros
+    if(descr->diag_type == rocsparse_diag_type_unit)
+    {
+        hipLaunchKernelGGL((csrsv_init_zero_pivot_kernel<rocsparse_int>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           info->zero_pivot,
+                           std::numeric_limits<rocsparse_int>::max());
+    }
+
+    return rocsparse_csrsv_solve_dispatch(handle,
+                                          m,
+                                          alpha,
+                                          csr_row_ptr,
+                                          csr_col_ind,
+                                          csr_val,
+                                          stride_val,
+                                          x,
+                                          stride_x,
+                                          y,
+                                          stride_y,
+                                          batch_count,
+                                          done_array,
+                                          csrsv,
+                                          info->zero_pivot,
+                                          descr->base,
+                                          descr->fill_mode,
+                                          descr->diag_type);
+}
+
+#endif // ROCSPARSE_CSRSV_STRIDED_BATCHED_HPP
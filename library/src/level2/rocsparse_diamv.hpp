@@ -0,0 +1,255 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_DIAMV_HPP
+#define ROCSPARSE_DIAMV_HPP
+
+#include "definitions.h"
+#include "diamv_device.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void diamvn_kernel_host_pointer(rocsparse_int m,
+                                    rocsparse_int n,
+                                    rocsparse_int dia_num_diag,
+                                    T             alpha,
+                                    const rocsparse_int* __restrict__ dia_offset,
+                                    const T* __restrict__ dia_val,
+                                    const T* __restrict__ x,
+                                    T beta,
+                                    T* __restrict__ y)
+{
+    diamvn_device<T, BLOCKSIZE>(m, n, dia_num_diag, alpha, dia_offset, dia_val, x, beta, y);
+}
+
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void diamvn_kernel_device_pointer(rocsparse_int m,
+                                      rocsparse_int n,
+                                      rocsparse_int dia_num_diag,
+                                      const T*      alpha,
+                                      const rocsparse_int* __restrict__ dia_offset,
+                                      const T* __restrict__ dia_val,
+                                      const T* __restrict__ x,
+                                      const T* beta,
+                                      T* __restrict__ y)
+{
+    diamvn_device<T, BLOCKSIZE>(m, n, dia_num_diag, *alpha, dia_offset, dia_val, x, *beta, y);
+}
+
+template <typename T>
+rocsparse_status rocsparse_diamv_template(rocsparse_handle          handle,
+                                          rocsparse_operation       trans,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          const T*                  alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const T*                  dia_val,
+                                          const rocsparse_int*      dia_offset,
+                                          rocsparse_int             dia_num_diag,
+                                          const T*                  x,
+                                          const T*                  beta,
+                                          T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xdiamv"),
+                  trans,
+                  m,
+                  n,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)dia_val,
+                  (const void*&)dia_offset,
+                  dia_num_diag,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f diamv -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> "
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xdiamv"),
+                  trans,
+                  m,
+                  n,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)dia_val,
+                  (const void*&)dia_offset,
+                  dia_num_diag,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(dia_num_diag < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Sanity check
+    if((m == 0 || n == 0) && dia_num_diag != 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || dia_num_diag == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(dia_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(dia_offset == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Run different diamv kernels
+    if(trans == rocsparse_operation_none)
+    {
+#define DIAMVN_DIM 256
+        dim3 diamvn_blocks((m - 1) / DIAMVN_DIM + 1);
+        dim3 diamvn_threads(DIAMVN_DIM);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((diamvn_kernel_device_pointer<T, DIAMVN_DIM>),
+                               diamvn_blocks,
+                               diamvn_threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               dia_num_diag,
+                               alpha,
+                               dia_offset,
+                               dia_val,
+                               x,
+                               beta,
+                               y);
+        }
+        else
+        {
+            if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+            {
+                return rocsparse_status_success;
+            }
+
+            hipLaunchKernelGGL((diamvn_kernel_host_pointer<T, DIAMVN_DIM>),
+                               diamvn_blocks,
+                               diamvn_threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               dia_num_diag,
+                               *alpha,
+                               dia_offset,
+                               dia_val,
+                               x,
+                               *beta,
+                               y);
+        }
+#undef DIAMVN_DIM
+    }
+    else
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_DIAMV_HPP
@@ -98,3 +98,37 @@ extern "C" rocsparse_status rocsparse_zellmv(rocsparse_handle                han
     return rocsparse_ellmv_template(
         handle, trans, m, n, alpha, descr, ell_val, ell_col_ind, ell_width, x, beta, y);
 }
+
+extern "C" rocsparse_status rocsparse_shellmv(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              const float*              alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const rocsparse_half*     ell_val,
+                                              const rocsparse_int*      ell_col_ind,
+                                              rocsparse_int             ell_width,
+                                              const float*              x,
+                                              const float*              beta,
+                                              float*                    y)
+{
+    return rocsparse_ellmv_template(
+        handle, trans, m, n, alpha, descr, ell_val, ell_col_ind, ell_width, x, beta, y);
+}
+
+extern "C" rocsparse_status rocsparse_sbellmv(rocsparse_handle          handle,
+                                              rocsparse_operation       trans,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              const float*              alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const rocsparse_bfloat16* ell_val,
+                                              const rocsparse_int*      ell_col_ind,
+                                              rocsparse_int             ell_width,
+                                              const float*              x,
+                                              const float*              beta,
+                                              float*                    y)
+{
+    return rocsparse_ellmv_template(
+        handle, trans, m, n, alpha, descr, ell_val, ell_col_ind, ell_width, x, beta, y);
+}
@@ -33,47 +33,48 @@
 
 #include <hip/hip_runtime.h>
 
-template <typename T, unsigned int BLOCKSIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE>
 __launch_bounds__(BLOCKSIZE) __global__
     void ellmvn_kernel_host_pointer(rocsparse_int m,
                                     rocsparse_int n,
                                     rocsparse_int ell_width,
                                     T             alpha,
                                     const rocsparse_int* __restrict__ ell_col_ind,
-                                    const T* __restrict__ ell_val,
+                                    const U* __restrict__ ell_val,
                                     const T* __restrict__ x,
                                     T beta,
                                     T* __restrict__ y,
                                     rocsparse_index_base idx_base)
 {
-    ellmvn_device<T, BLOCKSIZE>(m, n, ell_width, alpha, ell_col_ind, ell_val, x, beta, y, idx_base);
+    ellmvn_device<T, U, BLOCKSIZE>(
+        m, n, ell_width, alpha, ell_col_ind, ell_val, x, beta, y, idx_base);
 }
 
-template <typename T, unsigned int BLOCKSIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE>
 __launch_bounds__(BLOCKSIZE) __global__
     void ellmvn_kernel_device_pointer(rocsparse_int m,
                                       rocsparse_int n,
                                       rocsparse_int ell_width,
                                       const T*      alpha,
                                       const rocsparse_int* __restrict__ ell_col_ind,
-                                      const T* __restrict__ ell_val,
+                                      const U* __restrict__ ell_val,
                                       const T* __restrict__ x,
                                       const T* beta,
                                       T* __restrict__ y,
                                       rocsparse_index_base idx_base)
 {
-    ellmvn_device<T, BLOCKSIZE>(
+    ellmvn_device<T, U, BLOCKSIZE>(
         m, n, ell_width, *alpha, ell_col_ind, ell_val, x, *beta, y, idx_base);
 }
 
-template <typename T>
+template <typename T, typename U>
 rocsparse_status rocsparse_ellmv_template(rocsparse_handle          handle,
                                           rocsparse_operation       trans,
                                           rocsparse_int             m,
                                           rocsparse_int             n,
                                           const T*                  alpha,
                                           const rocsparse_mat_descr descr,
-                                          const T*                  ell_val,
+                                          const U*                  ell_val,
                                           const rocsparse_int*      ell_col_ind,
                                           rocsparse_int             ell_width,
                                           const T*                  x,
@@ -94,7 +95,7 @@ rocsparse_status rocsparse_ellmv_template(rocsparse_handle          handle,
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xellmv"),
+                  replaceXY<T, U>("rocsparse_XYellmv"),
                   trans,
                   m,
                   n,
@@ -108,8 +109,9 @@ rocsparse_status rocsparse_ellmv_template(rocsparse_handle          handle,
                   (const void*&)y);
 
         log_bench(handle,
-                  "./rocsparse-bench -f ellmv -r",
-                  replaceX<T>("X"),
+                  std::is_same<T, U>() ? "./rocsparse-bench -f ellmv -r"
+                                       : "./rocsparse-bench -f ellmv_mixed -r",
+                  replaceX<U>("X"),
                   "--mtx <matrix.mtx> "
                   "--alpha",
                   *alpha,
@@ -119,7 +121,7 @@ rocsparse_status rocsparse_ellmv_template(rocsparse_handle          handle,
     else
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xellmv"),
+                  replaceXY<T, U>("rocsparse_XYellmv"),
                   trans,
                   m,
                   n,
@@ -208,7 +210,7 @@ rocsparse_status rocsparse_ellmv_template(rocsparse_handle          handle,
 
         if(handle->pointer_mode == rocsparse_pointer_mode_device)
         {
-            hipLaunchKernelGGL((ellmvn_kernel_device_pointer<T, ELLMVN_DIM>),
+            hipLaunchKernelGGL((ellmvn_kernel_device_pointer<T, U, ELLMVN_DIM>),
                                ellmvn_blocks,
                                ellmvn_threads,
                                0,
@@ -231,7 +233,7 @@ rocsparse_status rocsparse_ellmv_template(rocsparse_handle          handle,
                 return rocsparse_status_success;
             }
 
-            hipLaunchKernelGGL((ellmvn_kernel_host_pointer<T, ELLMVN_DIM>),
+            hipLaunchKernelGGL((ellmvn_kernel_host_pointer<T, U, ELLMVN_DIM>),
                                ellmvn_blocks,
                                ellmvn_threads,
                                0,
@@ -0,0 +1,243 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_SPMV_DOT_HPP
+#define ROCSPARSE_SPMV_DOT_HPP
+
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "spmv_dot_device.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+// Wavefront sizes of the fused CSR and BSR kernels
+using spmv_dot_wfsizes = rocsparse_value_list<2, 4, 8, 16, 32, 64>;
+
+// Maximum number of blocks of the fused kernels, each block contributes one partial sum
+// of x^H * y and y^H * y to the workspace
+static constexpr rocsparse_int spmv_dot_max_blocks = 1024;
+
+// Wavefront size of the fused CSR and BSR kernels, depending on the average number of
+// non-zero entries per row
+static inline rocsparse_int spmv_dot_wfsize(rocsparse_int nnz_per_row,
+                                            rocsparse_int wavefront_size)
+{
+    rocsparse_int wfsize = 64;
+
+    if(nnz_per_row < 4)
+    {
+        wfsize = 2;
+    }
+    else if(nnz_per_row < 8)
+    {
+        wfsize = 4;
+    }
+    else if(nnz_per_row < 16)
+    {
+        wfsize = 8;
+    }
+    else if(nnz_per_row < 32)
+    {
+        wfsize = 16;
+    }
+    else if(nnz_per_row < 64)
+    {
+        wfsize = 32;
+    }
+
+    return std::min(wfsize, wavefront_size);
+}
+
+// Number of blocks of the fused kernels, where each block processes rows_per_block rows
+// per iteration
+static inline rocsparse_int spmv_dot_nblocks(rocsparse_int m, rocsparse_int rows_per_block)
+{
+    return std::min((m - 1) / rows_per_block + 1, spmv_dot_max_blocks);
+}
+
+// Set the requested reduction results to zero, e.g. for empty y
+template <typename T>
+static rocsparse_status rocsparse_spmv_dot_zero(rocsparse_handle handle, T* dot_xy, T* dot_yy)
+{
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        if(dot_xy != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(dot_xy, 0, sizeof(T), handle->stream));
+        }
+
+        if(dot_yy != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(dot_yy, 0, sizeof(T), handle->stream));
+        }
+    }
+    else
+    {
+        if(dot_xy != nullptr)
+        {
+            *dot_xy = static_cast<T>(0);
+        }
+
+        if(dot_yy != nullptr)
+        {
+            *dot_yy = static_cast<T>(0);
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+// Reduce the partial sums of the fused kernel and store the results according to the
+// pointer mode
+template <typename T>
+static rocsparse_status rocsparse_spmv_dot_finalize(
+    rocsparse_handle handle, rocsparse_int nblocks, T* workspace, T* dot_xy, T* dot_yy)
+{
+    hipStream_t stream = handle->stream;
+
+#define SPMV_DOT_REDUCE_DIM 256
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((spmv_dot_reduce_kernel<T, SPMV_DOT_REDUCE_DIM>),
+                           dim3(1),
+                           dim3(SPMV_DOT_REDUCE_DIM),
+                           0,
+                           stream,
+                           nblocks,
+                           workspace,
+                           dot_xy,
+                           dot_yy);
+    }
+    else
+    {
+        hipLaunchKernelGGL((spmv_dot_reduce_kernel<T, SPMV_DOT_REDUCE_DIM>),
+                           dim3(1),
+                           dim3(SPMV_DOT_REDUCE_DIM),
+                           0,
+                           stream,
+                           nblocks,
+                           workspace,
+                           (T*)nullptr,
+                           (T*)nullptr);
+
+        T result[2];
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(result, workspace, sizeof(T) * 2, hipMemcpyDeviceToHost));
+
+        if(dot_xy != nullptr)
+        {
+            *dot_xy = result[0];
+        }
+
+        if(dot_yy != nullptr)
+        {
+            *dot_yy = result[1];
+        }
+    }
+#undef SPMV_DOT_REDUCE_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void spmv_dot_scale_kernel_host_pointer(rocsparse_int m,
+                                            const T* __restrict__ x,
+                                            T beta,
+                                            T* __restrict__ y,
+                                            bool compute_xy,
+                                            T*   workspace)
+{
+    spmv_dot_scale_device<T, BLOCKSIZE>(m, x, beta, y, compute_xy, workspace);
+}
+
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void spmv_dot_scale_kernel_device_pointer(rocsparse_int m,
+                                              const T* __restrict__ x,
+                                              const T* beta,
+                                              T* __restrict__ y,
+                                              bool compute_xy,
+                                              T*   workspace)
+{
+    spmv_dot_scale_device<T, BLOCKSIZE>(m, x, *beta, y, compute_xy, workspace);
+}
+
+// Fused routines for matrices without non-zero entries, where y is only scaled by beta
+template <typename T>
+static rocsparse_status rocsparse_spmv_dot_scale(rocsparse_handle handle,
+                                                 rocsparse_int    m,
+                                                 const T*         x,
+                                                 const T*         beta,
+                                                 T*               y,
+                                                 T*               dot_xy,
+                                                 T*               dot_yy)
+{
+    hipStream_t stream = handle->stream;
+
+    // Get workspace from handle device buffer
+    RETURN_IF_ROCSPARSE_ERROR(handle->alloc_buffer());
+    T* workspace = reinterpret_cast<T*>(handle->buffer);
+
+    bool compute_xy = (dot_xy != nullptr);
+
+#define SPMV_DOT_SCALE_DIM 512
+    rocsparse_int nblocks = spmv_dot_nblocks(m, SPMV_DOT_SCALE_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((spmv_dot_scale_kernel_device_pointer<T, SPMV_DOT_SCALE_DIM>),
+                           dim3(nblocks),
+                           dim3(SPMV_DOT_SCALE_DIM),
+                           0,
+                           stream,
+                           m,
+                           x,
+                           beta,
+                           y,
+                           compute_xy,
+                           workspace);
+    }
+    else
+    {
+        hipLaunchKernelGGL((spmv_dot_scale_kernel_host_pointer<T, SPMV_DOT_SCALE_DIM>),
+                           dim3(nblocks),
+                           dim3(SPMV_DOT_SCALE_DIM),
+                           0,
+                           stream,
+                           m,
+                           x,
+                           *beta,
+                           y,
+                           compute_xy,
+                           workspace);
+    }
+#undef SPMV_DOT_SCALE_DIM
+
+    return rocsparse_spmv_dot_finalize(handle, nblocks, workspace, dot_xy, dot_yy);
+}
+
+#endif // ROCSPARSE_SPMV_DOT_HPP
@@ -0,0 +1,339 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROCSPARSE_VBRMV_HPP
+#define ROCSPARSE_VBRMV_HPP
+
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+#include "vbrmv_device.h"
+
+#include <hip/hip_runtime.h>
+
+// Wavefront sizes of the VBRMV kernel
+using vbrmvn_wfsizes = rocsparse_value_list<4, 8, 16, 32, 64>;
+
+// Wavefront size of the VBRMV kernel. The length of a row is estimated from the average
+// number of blocks per block row, assuming blocks of four columns
+static inline rocsparse_int
+    vbrmvn_wfsize(rocsparse_int mb, rocsparse_int nnzb, rocsparse_int wavefront_size)
+{
+    rocsparse_int row_length = 4 * (nnzb / mb);
+    rocsparse_int wfsize     = 4;
+
+    while(wfsize < row_length && wfsize < wavefront_size)
+    {
+        wfsize <<= 1;
+    }
+
+    return wfsize;
+}
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void vbrmvn_kernel_host_pointer(rocsparse_int       mb,
+                                    rocsparse_direction dir,
+                                    T                   alpha,
+                                    const rocsparse_int* __restrict__ vbr_val_ptr,
+                                    const rocsparse_int* __restrict__ vbr_row_ptr,
+                                    const rocsparse_int* __restrict__ vbr_col_ind,
+                                    const rocsparse_int* __restrict__ vbr_row_ptn,
+                                    const rocsparse_int* __restrict__ vbr_col_ptn,
+                                    const T* __restrict__ vbr_val,
+                                    const T* __restrict__ x,
+                                    T beta,
+                                    T* __restrict__ y,
+                                    rocsparse_index_base idx_base)
+{
+    vbrmvn_device<T, BLOCKSIZE, WFSIZE>(mb,
+                                        dir,
+                                        alpha,
+                                        vbr_val_ptr,
+                                        vbr_row_ptr,
+                                        vbr_col_ind,
+                                        vbr_row_ptn,
+                                        vbr_col_ptn,
+                                        vbr_val,
+                                        x,
+                                        beta,
+                                        y,
+                                        idx_base);
+}
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void vbrmvn_kernel_device_pointer(rocsparse_int       mb,
+                                      rocsparse_direction dir,
+                                      const T*            alpha,
+                                      const rocsparse_int* __restrict__ vbr_val_ptr,
+                                      const rocsparse_int* __restrict__ vbr_row_ptr,
+                                      const rocsparse_int* __restrict__ vbr_col_ind,
+                                      const rocsparse_int* __restrict__ vbr_row_ptn,
+                                      const rocsparse_int* __restrict__ vbr_col_ptn,
+                                      const T* __restrict__ vbr_val,
+                                      const T* __restrict__ x,
+                                      const T* beta,
+                                      T* __restrict__ y,
+                                      rocsparse_index_base idx_base)
+{
+    vbrmvn_device<T, BLOCKSIZE, WFSIZE>(mb,
+                                        dir,
+                                        *alpha,
+                                        vbr_val_ptr,
+                                        vbr_row_ptr,
+                                        vbr_col_ind,
+                                        vbr_row_ptn,
+                                        vbr_col_ptn,
+                                        vbr_val,
+                                        x,
+                                        *beta,
+                                        y,
+                                        idx_base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_vbrmv_template(rocsparse_handle          handle,
+                                          rocsparse_direction       dir,
+                                          rocsparse_operation       trans,
+                                          rocsparse_int             mb,
+                                          rocsparse_int             nb,
+                                          rocsparse_int             nnzb,
+                                          const T*                  alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const T*                  vbr_val,
+                                          const rocsparse_int*      vbr_val_ptr,
+                                          const rocsparse_int*      vbr_row_ptr,
+                                          const rocsparse_int*      vbr_col_ind,
+                                          const rocsparse_int*      vbr_row_ptn,
+                                          const rocsparse_int*      vbr_col_ptn,
+                                          const T*                  x,
+                                          const T*                  beta,
+                                          T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xvbrmv"),
+                  dir,
+                  trans,
+                  mb,
+                  nb,
+                  nnzb,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)vbr_val,
+                  (const void*&)vbr_val_ptr,
+                  (const void*&)vbr_row_ptr,
+                  (const void*&)vbr_col_ind,
+                  (const void*&)vbr_row_ptn,
+                  (const void*&)vbr_col_ptn,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f vbrmv -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> "
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xvbrmv"),
+                  dir,
+                  trans,
+                  mb,
+                  nb,
+                  nnzb,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)vbr_val,
+                  (const void*&)vbr_val_ptr,
+                  (const void*&)vbr_row_ptr,
+                  (const void*&)vbr_col_ind,
+                  (const void*&)vbr_row_ptn,
+                  (const void*&)vbr_col_ptn,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check direction
+    if(dir != rocsparse_direction_row && dir != rocsparse_direction_column)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(mb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnzb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(mb == 0 || nb == 0 || nnzb == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(vbr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(vbr_val_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(vbr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(vbr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(vbr_row_ptn == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(vbr_col_ptn == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    static constexpr unsigned int VBRMVN_DIM = 256;
+
+    rocsparse_int wfsize = vbrmvn_wfsize(mb, nnzb, handle->wavefront_size);
+
+    bool launched = rocsparse_dispatch_value(wfsize, vbrmvn_wfsizes{}, [&](auto wf) {
+        constexpr unsigned int WFSIZE = decltype(wf)::value;
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((vbrmvn_kernel_device_pointer<T, VBRMVN_DIM, WFSIZE>),
+                               dim3((mb - 1) / (VBRMVN_DIM / WFSIZE) + 1),
+                               dim3(VBRMVN_DIM),
+                               0,
+                               handle->stream,
+                               mb,
+                               dir,
+                               alpha,
+                               vbr_val_ptr,
+                               vbr_row_ptr,
+                               vbr_col_ind,
+                               vbr_row_ptn,
+                               vbr_col_ptn,
+                               vbr_val,
+                               x,
+                               beta,
+                               y,
+                               descr->base);
+        }
+        else if(*alpha != static_cast<T>(0) || *beta != static_cast<T>(1))
+        {
+            hipLaunchKernelGGL((vbrmvn_kernel_host_pointer<T, VBRMVN_DIM, WFSIZE>),
+                               dim3((mb - 1) / (VBRMVN_DIM / WFSIZE) + 1),
+                               dim3(VBRMVN_DIM),
+                               0,
+                               handle->stream,
+                               mb,
+                               dir,
+                               *alpha,
+                               vbr_val_ptr,
+                               vbr_row_ptr,
+                               vbr_col_ind,
+                               vbr_row_ptn,
+                               vbr_col_ptn,
+                               vbr_val,
+                               x,
+                               *beta,
+                               y,
+                               descr->base);
+        }
+    });
+
+    return launched ? rocsparse_status_success : rocsparse_status_arch_mismatch;
+}
+
+#endif // ROCSPARSE_VBRMV_HPP
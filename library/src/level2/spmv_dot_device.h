@@ -0,0 +1,305 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef SPMV_DOT_DEVICE_H
+#define SPMV_DOT_DEVICE_H
+
+#include "common.h"
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+// Update y[row] = alpha * sum + beta * y[row] and accumulate the contributions of row to
+// x^H * y and y^H * y
+template <typename T>
+static __device__ __forceinline__ void spmv_dot_update(rocsparse_int row,
+                                                       T             alpha,
+                                                       T             sum,
+                                                       const T*      x,
+                                                       T             beta,
+                                                       T*            y,
+                                                       bool          compute_xy,
+                                                       T&            xy,
+                                                       T&            yy)
+{
+    T yv = alpha * sum;
+
+    if(beta != static_cast<T>(0))
+    {
+        yv = rocsparse_fma(beta, y[row], yv);
+    }
+
+    y[row] = yv;
+
+    if(compute_xy)
+    {
+        xy = rocsparse_fma(rocsparse_conj(rocsparse_ldg(x + row)), yv, xy);
+    }
+
+    yy = rocsparse_fma(rocsparse_conj(yv), yv, yy);
+}
+
+// Reduce the thread local x^H * y and y^H * y within the block, the first half of the
+// workspace holds the x^H * y partial sum of each block, the second half y^H * y
+template <typename T, unsigned int BLOCKSIZE>
+static __device__ __forceinline__ void spmv_dot_blockreduce(T xy, T yy, T* workspace)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+
+    __shared__ T sxy[BLOCKSIZE];
+    __shared__ T syy[BLOCKSIZE];
+
+    sxy[tid] = xy;
+    syy[tid] = yy;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<T, BLOCKSIZE>(tid, sxy);
+    rocsparse_blockreduce_sum<T, BLOCKSIZE>(tid, syy);
+
+    if(tid == 0)
+    {
+        workspace[hipBlockIdx_x]                = sxy[0];
+        workspace[hipGridDim_x + hipBlockIdx_x] = syy[0];
+    }
+}
+
+// Fused CSR SpMV with x^H * y and y^H * y, one wavefront per row
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+static __device__ void csrmvn_dot_device(rocsparse_int        m,
+                                         T                    alpha,
+                                         const rocsparse_int* csr_row_ptr,
+                                         const rocsparse_int* csr_col_ind,
+                                         const T*             csr_val,
+                                         const T*             x,
+                                         T                    beta,
+                                         T*                   y,
+                                         bool                 compute_xy,
+                                         T*                   workspace,
+                                         rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    T xy = static_cast<T>(0);
+    T yy = static_cast<T>(0);
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+        {
+            sum = rocsparse_fma(csr_val[j], rocsparse_ldg(x + csr_col_ind[j] - idx_base), sum);
+        }
+
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // Last lane of the wavefront writes y and accumulates the reductions
+        if(lid == WF_SIZE - 1)
+        {
+            spmv_dot_update(row, alpha, sum, x, beta, y, compute_xy, xy, yy);
+        }
+    }
+
+    spmv_dot_blockreduce<T, BLOCKSIZE>(xy, yy, workspace);
+}
+
+// Fused BSR SpMV with x^H * y and y^H * y, one wavefront per row of the expanded matrix
+template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+static __device__ void bsrmvn_dot_device(rocsparse_int        mb,
+                                         rocsparse_direction  dir,
+                                         T                    alpha,
+                                         const rocsparse_int* bsr_row_ptr,
+                                         const rocsparse_int* bsr_col_ind,
+                                         const T*             bsr_val,
+                                         rocsparse_int        bsr_dim,
+                                         const T*             x,
+                                         T                    beta,
+                                         T*                   y,
+                                         bool                 compute_xy,
+                                         T*                   workspace,
+                                         rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    T xy = static_cast<T>(0);
+    T yy = static_cast<T>(0);
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < mb * bsr_dim; row += nwf)
+    {
+        rocsparse_int brow = row / bsr_dim;
+        rocsparse_int bi   = row % bsr_dim;
+
+        rocsparse_int row_begin = bsr_row_ptr[brow] - idx_base;
+        rocsparse_int row_end   = bsr_row_ptr[brow + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        // Lanes stride over the columns of all blocks of the block row
+        for(rocsparse_int k = lid; k < (row_end - row_begin) * bsr_dim; k += WF_SIZE)
+        {
+            rocsparse_int j  = row_begin + k / bsr_dim;
+            rocsparse_int bj = k % bsr_dim;
+
+            sum = rocsparse_fma(
+                bsr_val[BSR_IND(j, bi, bj, dir)],
+                rocsparse_ldg(x + (bsr_col_ind[j] - idx_base) * bsr_dim + bj),
+                sum);
+        }
+
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // Last lane of the wavefront writes y and accumulates the reductions
+        if(lid == WF_SIZE - 1)
+        {
+            spmv_dot_update(row, alpha, sum, x, beta, y, compute_xy, xy, yy);
+        }
+    }
+
+    spmv_dot_blockreduce<T, BLOCKSIZE>(xy, yy, workspace);
+}
+
+// Fused ELL SpMV with x^H * y and y^H * y, one thread per row
+template <typename T, unsigned int BLOCKSIZE>
+static __device__ void ellmvn_dot_device(rocsparse_int        m,
+                                         rocsparse_int        n,
+                                         rocsparse_int        ell_width,
+                                         T                    alpha,
+                                         const rocsparse_int* ell_col_ind,
+                                         const T*             ell_val,
+                                         const T*             x,
+                                         T                    beta,
+                                         T*                   y,
+                                         bool                 compute_xy,
+                                         T*                   workspace,
+                                         rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    T xy = static_cast<T>(0);
+    T yy = static_cast<T>(0);
+
+    // Loop over rows
+    for(rocsparse_int ai = gid; ai < m; ai += hipGridDim_x * BLOCKSIZE)
+    {
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int p = 0; p < ell_width; ++p)
+        {
+            rocsparse_int idx = ELL_IND(ai, p, m, ell_width);
+            rocsparse_int col = rocsparse_nontemporal_load(ell_col_ind + idx) - idx_base;
+
+            if(col >= 0 && col < n)
+            {
+                sum = rocsparse_fma(
+                    rocsparse_nontemporal_load(ell_val + idx), rocsparse_ldg(x + col), sum);
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        spmv_dot_update(ai, alpha, sum, x, beta, y, compute_xy, xy, yy);
+    }
+
+    spmv_dot_blockreduce<T, BLOCKSIZE>(xy, yy, workspace);
+}
+
+// Scale y with beta and compute x^H * y and y^H * y, for matrices without non-zero entries
+template <typename T, unsigned int BLOCKSIZE>
+static __device__ void spmv_dot_scale_device(
+    rocsparse_int m, const T* x, T beta, T* y, bool compute_xy, T* workspace)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    T xy = static_cast<T>(0);
+    T yy = static_cast<T>(0);
+
+    for(rocsparse_int i = gid; i < m; i += hipGridDim_x * BLOCKSIZE)
+    {
+        spmv_dot_update(
+            i, static_cast<T>(0), static_cast<T>(0), x, beta, y, compute_xy, xy, yy);
+    }
+
+    spmv_dot_blockreduce<T, BLOCKSIZE>(xy, yy, workspace);
+}
+
+// Sum up the partial results of all blocks
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void spmv_dot_reduce_kernel(rocsparse_int nblocks, T* workspace, T* dot_xy, T* dot_yy)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+
+    __shared__ T sxy[BLOCKSIZE];
+    __shared__ T syy[BLOCKSIZE];
+
+    T xy = static_cast<T>(0);
+    T yy = static_cast<T>(0);
+
+    for(rocsparse_int i = tid; i < nblocks; i += BLOCKSIZE)
+    {
+        xy = xy + workspace[i];
+        yy = yy + workspace[nblocks + i];
+    }
+
+    sxy[tid] = xy;
+    syy[tid] = yy;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<T, BLOCKSIZE>(tid, sxy);
+    rocsparse_blockreduce_sum<T, BLOCKSIZE>(tid, syy);
+
+    // Results are either stored to the device pointers or to the start of the workspace
+    if(tid == 0)
+    {
+        if(dot_xy != nullptr)
+        {
+            *dot_xy = sxy[0];
+        }
+
+        if(dot_yy != nullptr)
+        {
+            *dot_yy = syy[0];
+        }
+
+        workspace[0] = sxy[0];
+        workspace[1] = syy[0];
+    }
+}
+
+#endif // SPMV_DOT_DEVICE_H
@@ -0,0 +1,123 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef VBRMV_DEVICE_H
+#define VBRMV_DEVICE_H
+
+#include "common.h"
+#include "rocsparse.h"
+
+#include <hip/hip_runtime.h>
+
+// VBRMV kernel where each wavefront of WFSIZE lanes processes a VBR block row. The
+// rows of the block row are processed one after another. The entries of a row are
+// distributed over the lanes as if all blocks of the row were concatenated, such that
+// lanes do not idle on narrow blocks.
+template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE>
+__device__ void vbrmvn_device(rocsparse_int       mb,
+                              rocsparse_direction dir,
+                              T                   alpha,
+                              const rocsparse_int* __restrict__ vbr_val_ptr,
+                              const rocsparse_int* __restrict__ vbr_row_ptr,
+                              const rocsparse_int* __restrict__ vbr_col_ind,
+                              const rocsparse_int* __restrict__ vbr_row_ptn,
+                              const rocsparse_int* __restrict__ vbr_col_ptn,
+                              const T* __restrict__ vbr_val,
+                              const T* __restrict__ x,
+                              T beta,
+                              T* __restrict__ y,
+                              rocsparse_index_base idx_base)
+{
+    // Lane id
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+
+    // Wavefront id
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each thread block processes (BLOCKSIZE / WFSIZE) VBR block rows
+    rocsparse_int block_row = hipBlockIdx_x * (BLOCKSIZE / WFSIZE) + wid;
+
+    // Do not run out of bounds
+    if(block_row >= mb)
+    {
+        return;
+    }
+
+    // VBR block row entry and exit point
+    rocsparse_int row_begin = vbr_row_ptr[block_row] - idx_base;
+    rocsparse_int row_end   = vbr_row_ptr[block_row + 1] - idx_base;
+
+    // Rows covered by the block row
+    rocsparse_int row_offset = vbr_row_ptn[block_row] - idx_base;
+    rocsparse_int row_height = vbr_row_ptn[block_row + 1] - idx_base - row_offset;
+
+    for(rocsparse_int r = 0; r < row_height; ++r)
+    {
+        T sum = static_cast<T>(0);
+
+        // Position of the current block within the concatenated row, modulo WFSIZE
+        rocsparse_int shift = 0;
+
+        for(rocsparse_int k = row_begin; k < row_end; ++k)
+        {
+            rocsparse_int col        = vbr_col_ind[k] - idx_base;
+            rocsparse_int col_offset = vbr_col_ptn[col] - idx_base;
+            rocsparse_int col_width  = vbr_col_ptn[col + 1] - idx_base - col_offset;
+
+            const T* block = vbr_val + (vbr_val_ptr[k] - idx_base);
+
+            // First column of the block processed by this lane
+            for(rocsparse_int j = (lid - shift) & (WFSIZE - 1); j < col_width; j += WFSIZE)
+            {
+                T val = (dir == rocsparse_direction_row) ? block[col_width * r + j]
+                                                         : block[row_height * j + r];
+
+                sum = rocsparse_fma(val, x[col_offset + j], sum);
+            }
+
+            shift = (shift + col_width) & (WFSIZE - 1);
+        }
+
+        // Each wavefront accumulates its row sum
+        sum = rocsparse_wfreduce_sum<WFSIZE>(sum);
+
+        // Last lane of each wavefront writes the row sum to global memory
+        if(lid == WFSIZE - 1)
+        {
+            rocsparse_int row = row_offset + r;
+
+            if(beta != static_cast<T>(0))
+            {
+                y[row] = rocsparse_fma(beta, y[row], alpha * sum);
+            }
+            else
+            {
+                y[row] = alpha * sum;
+            }
+        }
+    }
+}
+
+#endif // VBRMV_DEVICE_H
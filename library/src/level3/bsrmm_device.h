@@ -42,6 +42,7 @@ static __device__ void bsrmmnn_small_blockdim_device(rocsparse_direction directi
                                                      T             beta,
                                                      T* __restrict__ C,
                                                      rocsparse_int        ldc,
+                                                     rocsparse_order      order_C,
                                                      rocsparse_index_base idx_base)
 {
     constexpr rocsparse_int PADDED_BSR_BLOCK_DIM = (BSR_BLOCK_DIM + 1);
@@ -54,7 +55,6 @@ static __device__ void bsrmmnn_small_blockdim_device(rocsparse_direction directi
     rocsparse_int col  = lid + hipBlockIdx_y * WF_SIZE;
 
     rocsparse_int colB = col * ldb;
-    rocsparse_int colC = col * ldc;
 
     // global row
     rocsparse_int global_row = (gid / WF_SIZE);
@@ -195,13 +195,16 @@ static __device__ void bsrmmnn_small_blockdim_device(rocsparse_direction directi
 
         if(col < N)
         {
+            rocsparse_int idx_C = (order_C == rocsparse_order_column) ? global_row + col * ldc
+                                                                       : global_row * ldc + col;
+
             if(beta == static_cast<T>(0))
             {
-                C[global_row + colC] = alpha * sum;
+                C[idx_C] = alpha * sum;
             }
             else
             {
-                C[global_row + colC] = rocsparse_fma(beta, C[global_row + colC], alpha * sum);
+                C[idx_C] = rocsparse_fma(beta, C[idx_C], alpha * sum);
             }
         }
     }
@@ -220,6 +223,7 @@ static __device__ void bsrmmnt_small_blockdim_device(rocsparse_direction directi
                                                      T             beta,
                                                      T* __restrict__ C,
                                                      rocsparse_int        ldc,
+                                                     rocsparse_order      order_C,
                                                      rocsparse_index_base idx_base)
 {
     constexpr rocsparse_int PADDED_BSR_BLOCK_DIM = (BSR_BLOCK_DIM + 1);
@@ -253,7 +257,7 @@ static __device__ void bsrmmnt_small_blockdim_device(rocsparse_direction directi
             rocsparse_int k = j + lid;
 
             shared_col[wid][lid]
-                = (k < block_row_end) ? N * BSR_BLOCK_DIM * (bsr_col_ind[k] - idx_base) : 0;
+                = (k < block_row_end) ? ldb * BSR_BLOCK_DIM * (bsr_col_ind[k] - idx_base) : 0;
 
             if(direction == rocsparse_direction_row)
             {
@@ -338,7 +342,7 @@ static __device__ void bsrmmnt_small_blockdim_device(rocsparse_direction directi
                     // Perform:
                     // for(rocsparse_int p = 0; p < BSR_BLOCK_DIM; p++)
                     // {
-                    //     T val_B = rocsparse_ldg(B + col + N * p + shared_col[wid][i]);
+                    //     T val_B = rocsparse_ldg(B + col + ldb * p + shared_col[wid][i]);
                     //     sum = rocsparse_fma(shared_val[wid][PADDED_BSR_BLOCK_DIM * i + p], val_B, sum);
                     // }
                     // as unrolled loop.
@@ -346,19 +350,19 @@ static __device__ void bsrmmnt_small_blockdim_device(rocsparse_direction directi
                     sum     = rocsparse_fma(shared_val[wid][PADDED_BSR_BLOCK_DIM * i], val_B, sum);
                     if(BSR_BLOCK_DIM >= 2)
                     {
-                        val_B = rocsparse_ldg(B + col + N * 1 + shared_col[wid][i]);
+                        val_B = rocsparse_ldg(B + col + ldb * 1 + shared_col[wid][i]);
                         sum   = rocsparse_fma(
                             shared_val[wid][PADDED_BSR_BLOCK_DIM * i + 1], val_B, sum);
                     }
                     if(BSR_BLOCK_DIM >= 3)
                     {
-                        val_B = rocsparse_ldg(B + col + N * 2 + shared_col[wid][i]);
+                        val_B = rocsparse_ldg(B + col + ldb * 2 + shared_col[wid][i]);
                         sum   = rocsparse_fma(
                             shared_val[wid][PADDED_BSR_BLOCK_DIM * i + 2], val_B, sum);
                     }
                     if(BSR_BLOCK_DIM >= 4)
                     {
-                        val_B = rocsparse_ldg(B + col + N * 3 + shared_col[wid][i]);
+                        val_B = rocsparse_ldg(B + col + ldb * 3 + shared_col[wid][i]);
                         sum   = rocsparse_fma(
                             shared_val[wid][PADDED_BSR_BLOCK_DIM * i + 3], val_B, sum);
                     }
@@ -368,19 +372,23 @@ static __device__ void bsrmmnt_small_blockdim_device(rocsparse_direction directi
 
         if(col < N)
         {
+            rocsparse_int idx_C = (order_C == rocsparse_order_column) ? global_row + col * ldc
+                                                                       : global_row * ldc + col;
+
             if(beta == static_cast<T>(0))
             {
-                C[global_row + col * ldc] = alpha * sum;
+                C[idx_C] = alpha * sum;
             }
             else
             {
-                C[global_row + col * ldc]
-                    = rocsparse_fma(beta, C[global_row + col * ldc], alpha * sum);
+                C[idx_C] = rocsparse_fma(beta, C[idx_C], alpha * sum);
             }
         }
     }
 }
 
+// BSRMM kernel for BSR block dimensions up to 32. BSR_BLOCK_DIM must match the BSR block
+// dimension, such that the inner product is of compile-time length.
 template <typename T, rocsparse_int BSR_BLOCK_DIM, rocsparse_int BLK_SIZE_Y>
 static __device__ void bsrmm_large_blockdim_device(rocsparse_direction direction,
                                                    rocsparse_operation trans_B,
@@ -396,6 +404,7 @@ static __device__ void bsrmm_large_blockdim_device(rocsparse_direction direction
                                                    T             beta,
                                                    T* __restrict__ C,
                                                    rocsparse_int        ldc,
+                                                   rocsparse_order      order_C,
                                                    rocsparse_index_base idx_base)
 {
     rocsparse_int tidx = hipThreadIdx_x;
@@ -415,7 +424,6 @@ static __device__ void bsrmm_large_blockdim_device(rocsparse_direction direction
     }
 
     rocsparse_int colB = global_col * ldb;
-    rocsparse_int colC = global_col * ldc;
 
     __shared__ T shared_B[BSR_BLOCK_DIM * BLK_SIZE_Y];
     __shared__ T shared_A[BSR_BLOCK_DIM * BSR_BLOCK_DIM];
@@ -459,7 +467,8 @@ static __device__ void bsrmm_large_blockdim_device(rocsparse_direction direction
 
         __syncthreads();
 
-        for(rocsparse_int j = 0; j < block_dim; j++)
+#pragma unroll
+        for(rocsparse_int j = 0; j < BSR_BLOCK_DIM; j++)
         {
             sum = rocsparse_fma(
                 shared_A[BSR_BLOCK_DIM * j + tidx], shared_B[BSR_BLOCK_DIM * tidy + j], sum);
@@ -470,36 +479,47 @@ static __device__ void bsrmm_large_blockdim_device(rocsparse_direction direction
 
     if(block_row < Mb && global_col < N && tidx < block_dim)
     {
+        rocsparse_int idx_C = (order_C == rocsparse_order_column) ? global_row + global_col * ldc
+                                                                   : global_row * ldc + global_col;
+
         if(beta == static_cast<T>(0))
         {
-            C[global_row + colC] = alpha * sum;
+            C[idx_C] = alpha * sum;
         }
         else
         {
-            C[global_row + colC] = rocsparse_fma(beta, C[global_row + colC], alpha * sum);
+            C[idx_C] = rocsparse_fma(beta, C[idx_C], alpha * sum);
         }
     }
 }
 
-template <typename T, rocsparse_int BSR_BLOCK_DIM, rocsparse_int BLK_SIZE_Y>
-static __device__ void bsrmm_general_blockdim_device(rocsparse_direction direction,
-                                                     rocsparse_operation trans_B,
-                                                     rocsparse_int       Mb,
-                                                     rocsparse_int       N,
-                                                     T                   alpha,
-                                                     const rocsparse_int* __restrict__ bsr_row_ptr,
-                                                     const rocsparse_int* __restrict__ bsr_col_ind,
-                                                     const T* __restrict__ bsr_val,
-                                                     rocsparse_int block_dim,
-                                                     const T* __restrict__ B,
-                                                     rocsparse_int ldb,
-                                                     T             beta,
-                                                     T* __restrict__ C,
-                                                     rocsparse_int        ldc,
-                                                     rocsparse_index_base idx_base)
+// BSRMM kernel for large BSR block dimensions. The thread block computes BLK_SIZE_Y columns of
+// a BSR block row of C, where each thread keeps TILE rows in registers. This way, each tile of
+// B that is loaded into shared memory is reused for TILE * BSR_BLOCK_DIM rows of the BSR block.
+template <typename T, rocsparse_int BSR_BLOCK_DIM, rocsparse_int BLK_SIZE_Y, rocsparse_int TILE>
+static __device__ void bsrmm_tiled_blockdim_device(rocsparse_direction direction,
+                                                   rocsparse_operation trans_B,
+                                                   rocsparse_int       Mb,
+                                                   rocsparse_int       N,
+                                                   T                   alpha,
+                                                   const rocsparse_int* __restrict__ bsr_row_ptr,
+                                                   const rocsparse_int* __restrict__ bsr_col_ind,
+                                                   const T* __restrict__ bsr_val,
+                                                   rocsparse_int block_dim,
+                                                   const T* __restrict__ B,
+                                                   rocsparse_int ldb,
+                                                   T             beta,
+                                                   T* __restrict__ C,
+                                                   rocsparse_int        ldc,
+                                                   rocsparse_order      order_C,
+                                                   rocsparse_index_base idx_base)
 {
+    // Number of BSR block rows that are processed by a single pass
+    static constexpr rocsparse_int TILE_DIM = TILE * BSR_BLOCK_DIM;
+
     rocsparse_int tidx = hipThreadIdx_x;
     rocsparse_int tidy = hipThreadIdx_y;
+    rocsparse_int tid  = BSR_BLOCK_DIM * tidy + tidx;
 
     rocsparse_int block_row = hipBlockIdx_x;
 
@@ -512,79 +532,108 @@ static __device__ void bsrmm_general_blockdim_device(rocsparse_direction directi
     }
 
     __shared__ T shared_B[BSR_BLOCK_DIM * BLK_SIZE_Y];
-    __shared__ T shared_A[BSR_BLOCK_DIM * BSR_BLOCK_DIM];
+    __shared__ T shared_A[TILE_DIM * BSR_BLOCK_DIM];
 
     rocsparse_int global_col = tidy + hipBlockIdx_y * BLK_SIZE_Y;
 
     rocsparse_int colB = global_col * ldb;
-    rocsparse_int colC = global_col * ldc;
 
-    for(rocsparse_int x = 0; x < block_dim; x += BSR_BLOCK_DIM)
+    rocsparse_int block_dim_sqr = block_dim * block_dim;
+
+    for(rocsparse_int x = 0; x < block_dim; x += TILE_DIM)
     {
-        rocsparse_int global_row = tidx + x + hipBlockIdx_x * block_dim;
+        T sum[TILE];
 
-        T sum = static_cast<T>(0);
+#pragma unroll
+        for(rocsparse_int t = 0; t < TILE; ++t)
+        {
+            sum[t] = static_cast<T>(0);
+        }
 
         for(rocsparse_int k = block_row_start; k < block_row_end; k++)
         {
             rocsparse_int block_col = (bsr_col_ind[k] - idx_base);
 
-            for(rocsparse_int y = 0; y < block_dim; y += BLK_SIZE_Y)
+            for(rocsparse_int y = 0; y < block_dim; y += BSR_BLOCK_DIM)
             {
                 if(trans_B == rocsparse_operation_none)
                 {
-                    shared_B[BSR_BLOCK_DIM * tidy + tidx]
-                        = (global_col < N && (tidx + y) < block_dim)
-                              ? B[block_dim * block_col + (tidx + y) + colB]
-                              : static_cast<T>(0);
+                    shared_B[tid] = (global_col < N && (tidx + y) < block_dim)
+                                        ? B[block_dim * block_col + (tidx + y) + colB]
+                                        : static_cast<T>(0);
                 }
                 else
                 {
-                    shared_B[BSR_BLOCK_DIM * tidy + tidx]
-                        = (global_col < N && (tidx + y) < block_dim)
-                              ? B[global_col + ldb * (block_dim * block_col + (tidx + y))]
-                              : static_cast<T>(0);
+                    shared_B[tid] = (global_col < N && (tidx + y) < block_dim)
+                                        ? B[global_col + ldb * (block_dim * block_col + (tidx + y))]
+                                        : static_cast<T>(0);
                 }
 
-                if(direction == rocsparse_direction_row)
-                {
-                    shared_A[BSR_BLOCK_DIM * tidy + tidx]
-                        = ((tidx + x) < block_dim && (tidy + y) < block_dim)
-                              ? bsr_val[block_dim * block_dim * k + block_dim * (tidx + x)
-                                        + (tidy + y)]
-                              : static_cast<T>(0);
-                }
-                else
+                // Load the TILE_DIM x BSR_BLOCK_DIM tile of the BSR block, column major
+                for(rocsparse_int i = tid; i < TILE_DIM * BSR_BLOCK_DIM;
+                    i += BSR_BLOCK_DIM * BLK_SIZE_Y)
                 {
-                    shared_A[BSR_BLOCK_DIM * tidy + tidx]
-                        = ((tidx + x) < block_dim && (tidy + y) < block_dim)
-                              ? bsr_val[block_dim * block_dim * k + block_dim * (tidy + y)
-                                        + (tidx + x)]
-                              : static_cast<T>(0);
+                    if(direction == rocsparse_direction_row)
+                    {
+                        rocsparse_int r = i / BSR_BLOCK_DIM;
+                        rocsparse_int c = i % BSR_BLOCK_DIM;
+
+                        shared_A[TILE_DIM * c + r]
+                            = ((r + x) < block_dim && (c + y) < block_dim)
+                                  ? bsr_val[block_dim_sqr * k + block_dim * (r + x) + (c + y)]
+                                  : static_cast<T>(0);
+                    }
+                    else
+                    {
+                        rocsparse_int r = i % TILE_DIM;
+                        rocsparse_int c = i / TILE_DIM;
+
+                        shared_A[i]
+                            = ((r + x) < block_dim && (c + y) < block_dim)
+                                  ? bsr_val[block_dim_sqr * k + block_dim * (c + y) + (r + x)]
+                                  : static_cast<T>(0);
+                    }
                 }
 
                 __syncthreads();
 
+#pragma unroll
                 for(rocsparse_int j = 0; j < BSR_BLOCK_DIM; j++)
                 {
-                    sum = rocsparse_fma(shared_A[BSR_BLOCK_DIM * j + tidx],
-                                        shared_B[BSR_BLOCK_DIM * tidy + j],
-                                        sum);
+                    T b = shared_B[BSR_BLOCK_DIM * tidy + j];
+
+#pragma unroll
+                    for(rocsparse_int t = 0; t < TILE; ++t)
+                    {
+                        sum[t] = rocsparse_fma(
+                            shared_A[TILE_DIM * j + BSR_BLOCK_DIM * t + tidx], b, sum[t]);
+                    }
                 }
 
                 __syncthreads();
             }
         }
 
-        if(block_row < Mb && global_col < N && (tidx + x) < block_dim)
+#pragma unroll
+        for(rocsparse_int t = 0; t < TILE; ++t)
         {
-            if(beta == static_cast<T>(0))
-            {
-                C[global_row + colC] = alpha * sum;
-            }
-            else
+            rocsparse_int row = x + BSR_BLOCK_DIM * t + tidx;
+
+            if(block_row < Mb && global_col < N && row < block_dim)
             {
-                C[global_row + colC] = rocsparse_fma(beta, C[global_row + colC], alpha * sum);
+                rocsparse_int global_row = row + hipBlockIdx_x * block_dim;
+                rocsparse_int idx_C      = (order_C == rocsparse_order_column)
+                                               ? global_row + global_col * ldc
+                                               : global_row * ldc + global_col;
+
+                if(beta == static_cast<T>(0))
+                {
+                    C[idx_C] = alpha * sum[t];
+                }
+                else
+                {
+                    C[idx_C] = rocsparse_fma(beta, C[idx_C], alpha * sum[t]);
+                }
             }
         }
     }
@@ -0,0 +1,267 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef BSRSM_DEVICE_H
+#define BSRSM_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Each thread block processes one block row for BLOCKSIZE columns of the (transposed)
+// right-hand side matrix. Every thread owns a single column and all bsr_dim rows of the
+// block row, such that each block of A is loaded only once for all right-hand sides.
+template <typename T, unsigned int BLOCKSIZE, bool SLEEP>
+__device__ void bsrsm_device(rocsparse_int mb,
+                             rocsparse_int nrhs,
+                             T             alpha,
+                             const rocsparse_int* __restrict__ bsr_row_ptr,
+                             const rocsparse_int* __restrict__ bsr_col_ind,
+                             const T* __restrict__ bsr_val,
+                             rocsparse_int bsr_dim,
+                             T* __restrict__ B,
+                             rocsparse_int ldb,
+                             int* __restrict__ done_array,
+                             rocsparse_int* __restrict__ map,
+                             rocsparse_int* __restrict__ zero_pivot,
+                             rocsparse_index_base idx_base,
+                             rocsparse_fill_mode  fill_mode,
+                             rocsparse_diag_type  diag_type,
+                             rocsparse_direction  dir)
+{
+    // Index into the row map
+    rocsparse_int idx = hipBlockIdx_x % mb;
+
+    // Shared memory to hold the current block, if it fits
+    __shared__ T sbsr_val[BLOCKSIZE];
+
+    // Blocks that fit into shared memory are loaded once by the whole thread block
+    bool preload = (bsr_dim * bsr_dim <= BLOCKSIZE);
+
+    // Values are read from shared or global memory
+    const T* block_val = preload ? sbsr_val : bsr_val;
+
+    // Get the block row this thread block will operate on
+    rocsparse_int row = map[idx];
+
+    // Current block row entry point and exit point
+    rocsparse_int row_begin = bsr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = bsr_row_ptr[row + 1] - idx_base;
+
+    // Column index into B
+    rocsparse_int col_B = hipBlockIdx_x / mb * BLOCKSIZE + hipThreadIdx_x;
+
+    // Index into done array
+    rocsparse_int id = hipBlockIdx_x / mb * mb;
+
+    // Initialize B with alpha
+    if(col_B < nrhs)
+    {
+        for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+        {
+            B[(row * bsr_dim + bi) * ldb + col_B] *= alpha;
+        }
+    }
+
+    // Diagonal block
+    rocsparse_int diag = -1;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        // Current block column
+        rocsparse_int local_col = bsr_col_ind[j] - idx_base;
+
+        // Differentiate upper and lower triangular mode
+        if(fill_mode == rocsparse_fill_mode_upper)
+        {
+            // Ignore all blocks that are below the diagonal
+            if(local_col < row)
+            {
+                continue;
+            }
+
+            // Diagonal block is processed after all off-diagonal blocks
+            if(local_col == row)
+            {
+                diag = j;
+                continue;
+            }
+        }
+        else if(fill_mode == rocsparse_fill_mode_lower)
+        {
+            // Ignore all blocks that are above the diagonal
+            if(local_col > row)
+            {
+                break;
+            }
+
+            // Diagonal block
+            if(local_col == row)
+            {
+                diag = j;
+                break;
+            }
+        }
+
+        // Spin loop until dependency has been resolved
+        if(hipThreadIdx_x == 0)
+        {
+            int          local_done    = atomicOr(&done_array[local_col + id], 0);
+            unsigned int times_through = 0;
+            while(!local_done)
+            {
+                if(SLEEP)
+                {
+                    for(unsigned int i = 0; i < times_through; ++i)
+                    {
+                        __builtin_amdgcn_s_sleep(1);
+                    }
+
+                    if(times_through < 3907)
+                    {
+                        ++times_through;
+                    }
+                }
+
+                local_done = atomicOr(&done_array[local_col + id], 0);
+            }
+        }
+
+        // Preload the current block into shared memory
+        if(preload && hipThreadIdx_x < bsr_dim * bsr_dim)
+        {
+            sbsr_val[hipThreadIdx_x] = bsr_val[bsr_dim * bsr_dim * j + hipThreadIdx_x];
+        }
+
+        // Wait for spin looping thread to finish as the whole block depends on this row
+        __syncthreads();
+
+        // Make sure updated B is visible globally
+        __threadfence();
+
+        // Block offset into block_val
+        rocsparse_int k = preload ? 0 : j;
+
+        if(col_B < nrhs)
+        {
+            for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+            {
+                // Local sum accumulator
+                T local_sum = static_cast<T>(0);
+
+                for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
+                {
+                    local_sum = rocsparse_fma(block_val[BSR_IND(k, bi, bj, dir)],
+                                              B[(local_col * bsr_dim + bj) * ldb + col_B],
+                                              local_sum);
+                }
+
+                B[(row * bsr_dim + bi) * ldb + col_B] -= local_sum;
+            }
+        }
+
+        // Wait for all threads before the next block is loaded
+        __syncthreads();
+    }
+
+    // Process diagonal block
+    if(diag != -1)
+    {
+        // Preload the diagonal block into shared memory
+        if(preload && hipThreadIdx_x < bsr_dim * bsr_dim)
+        {
+            sbsr_val[hipThreadIdx_x] = bsr_val[bsr_dim * bsr_dim * diag + hipThreadIdx_x];
+        }
+
+        __syncthreads();
+
+        // Block offset into block_val
+        rocsparse_int k = preload ? 0 : diag;
+
+        // Check for numerical zero pivot
+        if(diag_type == rocsparse_diag_type_non_unit && hipThreadIdx_x == 0)
+        {
+            for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+            {
+                if(block_val[BSR_IND(k, bi, bi, dir)] == static_cast<T>(0))
+                {
+                    atomicMin(zero_pivot, row + idx_base);
+                    break;
+                }
+            }
+        }
+
+        if(col_B < nrhs)
+        {
+            // Forward (lower) or backward (upper) substitution within the block
+            for(rocsparse_int l = 0; l < bsr_dim; ++l)
+            {
+                rocsparse_int bi
+                    = (fill_mode == rocsparse_fill_mode_upper) ? bsr_dim - 1 - l : l;
+
+                // Load result of bi-th BSR row
+                T val = B[(row * bsr_dim + bi) * ldb + col_B];
+
+                // If diagonal type is non unit, do division by diagonal entry
+                if(diag_type == rocsparse_diag_type_non_unit)
+                {
+                    T diagonal = block_val[BSR_IND(k, bi, bi, dir)];
+
+                    // Avoid division by zero, the zero pivot has already been stored
+                    if(diagonal != static_cast<T>(0))
+                    {
+                        val /= diagonal;
+                        B[(row * bsr_dim + bi) * ldb + col_B] = val;
+                    }
+                }
+
+                // Update remaining rows of the block
+                rocsparse_int begin = (fill_mode == rocsparse_fill_mode_upper) ? 0 : bi + 1;
+                rocsparse_int end   = (fill_mode == rocsparse_fill_mode_upper) ? bi : bsr_dim;
+
+                for(rocsparse_int bj = begin; bj < end; ++bj)
+                {
+                    B[(row * bsr_dim + bj) * ldb + col_B]
+                        = rocsparse_fma(-val,
+                                        block_val[BSR_IND(k, bj, bi, dir)],
+                                        B[(row * bsr_dim + bj) * ldb + col_B]);
+                }
+            }
+        }
+    }
+
+    // Wait for all threads to finish writing into global memory before we mark the row "done"
+    __syncthreads();
+
+    // Make sure B is written to global memory before setting row is done flag
+    __threadfence();
+
+    if(hipThreadIdx_x == 0)
+    {
+        // Write the "row is done" flag
+        atomicOr(&done_array[row + id], 1);
+    }
+}
+
+#endif // BSRSM_DEVICE_H
@@ -29,7 +29,7 @@
 
 #include <hip/hip_runtime.h>
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
 static __device__ void csrmmnn_general_device(rocsparse_int M,
                                               rocsparse_int N,
                                               rocsparse_int K,
@@ -37,12 +37,13 @@ static __device__ void csrmmnn_general_device(rocsparse_int M,
                                               T             alpha,
                                               const rocsparse_int* __restrict__ csr_row_ptr,
                                               const rocsparse_int* __restrict__ csr_col_ind,
-                                              const T* __restrict__ csr_val,
+                                              const U* __restrict__ csr_val,
                                               const T* __restrict__ B,
                                               rocsparse_int ldb,
                                               T             beta,
                                               T* __restrict__ C,
                                               rocsparse_int        ldc,
+                                              rocsparse_order      order_C,
                                               rocsparse_index_base idx_base)
 {
     rocsparse_int tid = hipThreadIdx_x;
@@ -53,7 +54,6 @@ static __device__ void csrmmnn_general_device(rocsparse_int M,
     rocsparse_int col = lid + hipBlockIdx_y * WF_SIZE;
 
     rocsparse_int colB = col * ldb;
-    rocsparse_int colC = col * ldc;
 
     __shared__ rocsparse_int shared_col[BLOCKSIZE / WF_SIZE][WF_SIZE];
     __shared__ T             shared_val[BLOCKSIZE / WF_SIZE][WF_SIZE];
@@ -72,7 +72,8 @@ static __device__ void csrmmnn_general_device(rocsparse_int M,
             __syncthreads();
 
             shared_col[wid][lid] = (k < row_end) ? csr_col_ind[k] - idx_base : 0;
-            shared_val[wid][lid] = (k < row_end) ? csr_val[k] : static_cast<T>(0);
+            shared_val[wid][lid]
+                = (k < row_end) ? rocsparse_convert<T>(csr_val[k]) : static_cast<T>(0);
 
             __syncthreads();
 
@@ -84,19 +85,24 @@ static __device__ void csrmmnn_general_device(rocsparse_int M,
 
         if(col < N)
         {
+            rocsparse_int idx_C
+                = (order_C == rocsparse_order_column) ? row + col * ldc : row * ldc + col;
+
             if(beta == static_cast<T>(0))
             {
-                C[row + colC] = alpha * sum;
+                C[idx_C] = alpha * sum;
             }
             else
             {
-                C[row + colC] = rocsparse_fma(beta, C[row + colC], alpha * sum);
+                C[idx_C] = rocsparse_fma(beta, C[idx_C], alpha * sum);
             }
         }
     }
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+// Row-major op(B). Each lane accumulates LOOPS columns of C that are WF_SIZE apart, such
+// that a row of A is only loaded once for a strip of WF_SIZE * LOOPS columns of B.
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WF_SIZE, unsigned int LOOPS>
 static __device__ void csrmmnt_general_device(rocsparse_int offset,
                                               rocsparse_int ncol,
                                               rocsparse_int M,
@@ -106,12 +112,13 @@ static __device__ void csrmmnt_general_device(rocsparse_int offset,
                                               T             alpha,
                                               const rocsparse_int* __restrict__ csr_row_ptr,
                                               const rocsparse_int* __restrict__ csr_col_ind,
-                                              const T* __restrict__ csr_val,
+                                              const U* __restrict__ csr_val,
                                               const T* __restrict__ B,
                                               rocsparse_int ldb,
                                               T             beta,
                                               T* __restrict__ C,
                                               rocsparse_int        ldc,
+                                              rocsparse_order      order_C,
                                               rocsparse_index_base idx_base)
 {
     rocsparse_int tid = hipThreadIdx_x;
@@ -131,10 +138,15 @@ static __device__ void csrmmnt_general_device(rocsparse_int offset,
     rocsparse_int row_start = csr_row_ptr[row] - idx_base;
     rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
 
-    for(rocsparse_int l = offset; l < ncol; l += WF_SIZE)
+    for(rocsparse_int l = offset; l < ncol; l += WF_SIZE * LOOPS)
     {
-        rocsparse_int col = l + lid;
-        T             sum = static_cast<T>(0);
+        T sum[LOOPS];
+
+#pragma unroll
+        for(unsigned int p = 0; p < LOOPS; ++p)
+        {
+            sum[p] = static_cast<T>(0);
+        }
 
         for(rocsparse_int j = row_start; j < row_end; j += WF_SIZE)
         {
@@ -142,28 +154,44 @@ static __device__ void csrmmnt_general_device(rocsparse_int offset,
 
             __syncthreads();
 
-            shared_col[wid][lid] = (k < row_end) ? N * (csr_col_ind[k] - idx_base) : 0;
-            shared_val[wid][lid] = (k < row_end) ? csr_val[k] : static_cast<T>(0);
+            shared_col[wid][lid] = (k < row_end) ? ldb * (csr_col_ind[k] - idx_base) : 0;
+            shared_val[wid][lid]
+                = (k < row_end) ? rocsparse_convert<T>(csr_val[k]) : static_cast<T>(0);
 
             __syncthreads();
 
             for(rocsparse_int i = 0; i < WF_SIZE; ++i)
             {
-                T val_B = (col < ncol) ? rocsparse_ldg(B + col + shared_col[wid][i])
-                                       : static_cast<T>(0);
-                sum = rocsparse_fma(shared_val[wid][i], val_B, sum);
+#pragma unroll
+                for(unsigned int p = 0; p < LOOPS; ++p)
+                {
+                    rocsparse_int col = l + p * WF_SIZE + lid;
+
+                    T val_B = (col < ncol) ? rocsparse_ldg(B + col + shared_col[wid][i])
+                                           : static_cast<T>(0);
+                    sum[p] = rocsparse_fma(shared_val[wid][i], val_B, sum[p]);
+                }
             }
         }
 
-        if(col < ncol)
+#pragma unroll
+        for(unsigned int p = 0; p < LOOPS; ++p)
         {
-            if(beta == static_cast<T>(0))
-            {
-                C[row + col * ldc] = alpha * sum;
-            }
-            else
+            rocsparse_int col = l + p * WF_SIZE + lid;
+
+            if(col < ncol)
             {
-                C[row + col * ldc] = rocsparse_fma(beta, C[row + col * ldc], alpha * sum);
+                rocsparse_int idx_C
+                    = (order_C == rocsparse_order_column) ? row + col * ldc : row * ldc + col;
+
+                if(beta == static_cast<T>(0))
+                {
+                    C[idx_C] = alpha * sum[p];
+                }
+                else
+                {
+                    C[idx_C] = rocsparse_fma(beta, C[idx_C], alpha * sum[p]);
+                }
             }
         }
     }
@@ -117,13 +117,13 @@ __launch_bounds__(DIM_X* DIM_Y) __global__ void csrsm_transpose_back(rocsparse_i
     }
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SLEEP>
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SLEEP>
 __device__ void csrsm_device(rocsparse_int m,
                              rocsparse_int nrhs,
                              T             alpha,
                              const rocsparse_int* __restrict__ csr_row_ptr,
                              const rocsparse_int* __restrict__ csr_col_ind,
-                             const T* __restrict__ csr_val,
+                             const U* __restrict__ csr_val,
                              T* __restrict__ B,
                              rocsparse_int ldb,
                              int* __restrict__ done_array,
@@ -169,12 +169,14 @@ __device__ void csrsm_device(rocsparse_int m,
 
         // Preload column indices and values into shared memory
         // This happens only once for each chunk of BLOCKSIZE elements
+        // Values are promoted to the precision of B, if stored in lower precision
         if(k == 0)
         {
             scsr_col_ind[hipThreadIdx_x]
                 = (hipThreadIdx_x < row_end - j) ? csr_col_ind[hipThreadIdx_x + j] - idx_base : -1;
-            scsr_val[hipThreadIdx_x]
-                = (hipThreadIdx_x < row_end - j) ? csr_val[hipThreadIdx_x + j] : -1;
+            scsr_val[hipThreadIdx_x] = (hipThreadIdx_x < row_end - j)
+                                           ? rocsparse_convert<T>(csr_val[hipThreadIdx_x + j])
+                                           : -1;
         }
 
         // Wait for preload to finish
@@ -54,6 +54,8 @@ extern "C" rocsparse_status rocsparse_sbsrmm(rocsparse_handle          handle,
                                     dir,
                                     trans_A,
                                     trans_B,
+                                    rocsparse_order_column,
+                                    rocsparse_order_column,
                                     mb,
                                     n,
                                     kb,
@@ -64,6 +66,7 @@ extern "C" rocsparse_status rocsparse_sbsrmm(rocsparse_handle          handle,
                                     bsr_row_ptr,
                                     bsr_col_ind,
                                     block_dim,
+                                    nullptr,
                                     B,
                                     ldb,
                                     beta,
@@ -95,6 +98,8 @@ extern "C" rocsparse_status rocsparse_dbsrmm(rocsparse_handle          handle,
                                     dir,
                                     trans_A,
                                     trans_B,
+                                    rocsparse_order_column,
+                                    rocsparse_order_column,
                                     mb,
                                     n,
                                     kb,
@@ -105,6 +110,7 @@ extern "C" rocsparse_status rocsparse_dbsrmm(rocsparse_handle          handle,
                                     bsr_row_ptr,
                                     bsr_col_ind,
                                     block_dim,
+                                    nullptr,
                                     B,
                                     ldb,
                                     beta,
@@ -136,6 +142,8 @@ extern "C" rocsparse_status rocsparse_cbsrmm(rocsparse_handle               hand
                                     dir,
                                     trans_A,
                                     trans_B,
+                                    rocsparse_order_column,
+                                    rocsparse_order_column,
                                     mb,
                                     n,
                                     kb,
@@ -146,6 +154,7 @@ extern "C" rocsparse_status rocsparse_cbsrmm(rocsparse_handle               hand
                                     bsr_row_ptr,
                                     bsr_col_ind,
                                     block_dim,
+                                    nullptr,
                                     B,
                                     ldb,
                                     beta,
@@ -177,6 +186,8 @@ extern "C" rocsparse_status rocsparse_zbsrmm(rocsparse_handle                han
                                     dir,
                                     trans_A,
                                     trans_B,
+                                    rocsparse_order_column,
+                                    rocsparse_order_column,
                                     mb,
                                     n,
                                     kb,
@@ -187,6 +198,326 @@ extern "C" rocsparse_status rocsparse_zbsrmm(rocsparse_handle                han
                                     bsr_row_ptr,
                                     bsr_col_ind,
                                     block_dim,
+                                    nullptr,
+                                    B,
+                                    ldb,
+                                    beta,
+                                    C,
+                                    ldc);
+}
+
+extern "C" rocsparse_status rocsparse_sbsrmm_ex_analysis(rocsparse_handle          handle,
+                                                         rocsparse_direction       dir,
+                                                         rocsparse_operation       trans_A,
+                                                         rocsparse_int             mb,
+                                                         rocsparse_int             kb,
+                                                         rocsparse_int             nnzb,
+                                                         const rocsparse_mat_descr descr,
+                                                         const float*              bsr_val,
+                                                         const rocsparse_int*      bsr_row_ptr,
+                                                         const rocsparse_int*      bsr_col_ind,
+                                                         rocsparse_int             block_dim,
+                                                         rocsparse_mat_info        info)
+{
+    return rocsparse_bsrmm_ex_analysis_template(handle,
+                                                dir,
+                                                trans_A,
+                                                mb,
+                                                kb,
+                                                nnzb,
+                                                descr,
+                                                bsr_val,
+                                                bsr_row_ptr,
+                                                bsr_col_ind,
+                                                block_dim,
+                                                info);
+}
+
+extern "C" rocsparse_status rocsparse_dbsrmm_ex_analysis(rocsparse_handle          handle,
+                                                         rocsparse_direction       dir,
+                                                         rocsparse_operation       trans_A,
+                                                         rocsparse_int             mb,
+                                                         rocsparse_int             kb,
+                                                         rocsparse_int             nnzb,
+                                                         const rocsparse_mat_descr descr,
+                                                         const double*             bsr_val,
+                                                         const rocsparse_int*      bsr_row_ptr,
+                                                         const rocsparse_int*      bsr_col_ind,
+                                                         rocsparse_int             block_dim,
+                                                         rocsparse_mat_info        info)
+{
+    return rocsparse_bsrmm_ex_analysis_template(handle,
+                                                dir,
+                                                trans_A,
+                                                mb,
+                                                kb,
+                                                nnzb,
+                                                descr,
+                                                bsr_val,
+                                                bsr_row_ptr,
+                                                bsr_col_ind,
+                                                block_dim,
+                                                info);
+}
+
+extern "C" rocsparse_status rocsparse_cbsrmm_ex_analysis(rocsparse_handle               handle,
+                                                         rocsparse_direction            dir,
+                                                         rocsparse_operation            trans_A,
+                                                         rocsparse_int                  mb,
+                                                         rocsparse_int                  kb,
+                                                         rocsparse_int                  nnzb,
+                                                         const rocsparse_mat_descr      descr,
+                                                         const rocsparse_float_complex* bsr_val,
+                                                         const rocsparse_int*           bsr_row_ptr,
+                                                         const rocsparse_int*           bsr_col_ind,
+                                                         rocsparse_int                  block_dim,
+                                                         rocsparse_mat_info             info)
+{
+    return rocsparse_bsrmm_ex_analysis_template(handle,
+                                                dir,
+                                                trans_A,
+                                                mb,
+                                                kb,
+                                                nnzb,
+                                                descr,
+                                                bsr_val,
+                                                bsr_row_ptr,
+                                                bsr_col_ind,
+                                                block_dim,
+                                                info);
+}
+
+extern "C" rocsparse_status rocsparse_zbsrmm_ex_analysis(rocsparse_handle                handle,
+                                                         rocsparse_direction             dir,
+                                                         rocsparse_operation             trans_A,
+                                                         rocsparse_int                   mb,
+                                                         rocsparse_int                   kb,
+                                                         rocsparse_int                   nnzb,
+                                                         const rocsparse_mat_descr       descr,
+                                                         const rocsparse_double_complex* bsr_val,
+                                                         const rocsparse_int*            bsr_row_ptr,
+                                                         const rocsparse_int*            bsr_col_ind,
+                                                         rocsparse_int                   block_dim,
+                                                         rocsparse_mat_info              info)
+{
+    return rocsparse_bsrmm_ex_analysis_template(handle,
+                                                dir,
+                                                trans_A,
+                                                mb,
+                                                kb,
+                                                nnzb,
+                                                descr,
+                                                bsr_val,
+                                                bsr_row_ptr,
+                                                bsr_col_ind,
+                                                block_dim,
+                                                info);
+}
+
+extern "C" rocsparse_status rocsparse_bsrmm_ex_clear(rocsparse_handle   handle,
+                                                     rocsparse_mat_info info)
+{
+    // Check for valid handle and matrix info
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_bsrmm_ex_clear", (const void*&)info);
+
+    // Destroy bsrmm info struct
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_bsrmv_info(info->bsrmm_info));
+    info->bsrmm_info = nullptr;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_sbsrmm_ex(rocsparse_handle          handle,
+                                                rocsparse_direction       dir,
+                                                rocsparse_operation       trans_A,
+                                                rocsparse_operation       trans_B,
+                                                rocsparse_order           order_B,
+                                                rocsparse_order           order_C,
+                                                rocsparse_int             mb,
+                                                rocsparse_int             n,
+                                                rocsparse_int             kb,
+                                                rocsparse_int             nnzb,
+                                                const float*              alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              bsr_val,
+                                                const rocsparse_int*      bsr_row_ptr,
+                                                const rocsparse_int*      bsr_col_ind,
+                                                rocsparse_int             block_dim,
+                                                rocsparse_mat_info        info,
+                                                const float*              B,
+                                                rocsparse_int             ldb,
+                                                const float*              beta,
+                                                float*                    C,
+                                                rocsparse_int             ldc)
+{
+    return rocsparse_bsrmm_template(handle,
+                                    dir,
+                                    trans_A,
+                                    trans_B,
+                                    order_B,
+                                    order_C,
+                                    mb,
+                                    n,
+                                    kb,
+                                    nnzb,
+                                    alpha,
+                                    descr,
+                                    bsr_val,
+                                    bsr_row_ptr,
+                                    bsr_col_ind,
+                                    block_dim,
+                                    info,
+                                    B,
+                                    ldb,
+                                    beta,
+                                    C,
+                                    ldc);
+}
+
+extern "C" rocsparse_status rocsparse_dbsrmm_ex(rocsparse_handle          handle,
+                                                rocsparse_direction       dir,
+                                                rocsparse_operation       trans_A,
+                                                rocsparse_operation       trans_B,
+                                                rocsparse_order           order_B,
+                                                rocsparse_order           order_C,
+                                                rocsparse_int             mb,
+                                                rocsparse_int             n,
+                                                rocsparse_int             kb,
+                                                rocsparse_int             nnzb,
+                                                const double*             alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             bsr_val,
+                                                const rocsparse_int*      bsr_row_ptr,
+                                                const rocsparse_int*      bsr_col_ind,
+                                                rocsparse_int             block_dim,
+                                                rocsparse_mat_info        info,
+                                                const double*             B,
+                                                rocsparse_int             ldb,
+                                                const double*             beta,
+                                                double*                   C,
+                                                rocsparse_int             ldc)
+{
+    return rocsparse_bsrmm_template(handle,
+                                    dir,
+                                    trans_A,
+                                    trans_B,
+                                    order_B,
+                                    order_C,
+                                    mb,
+                                    n,
+                                    kb,
+                                    nnzb,
+                                    alpha,
+                                    descr,
+                                    bsr_val,
+                                    bsr_row_ptr,
+                                    bsr_col_ind,
+                                    block_dim,
+                                    info,
+                                    B,
+                                    ldb,
+                                    beta,
+                                    C,
+                                    ldc);
+}
+
+extern "C" rocsparse_status rocsparse_cbsrmm_ex(rocsparse_handle               handle,
+                                                rocsparse_direction            dir,
+                                                rocsparse_operation            trans_A,
+                                                rocsparse_operation            trans_B,
+                                                rocsparse_order                order_B,
+                                                rocsparse_order                order_C,
+                                                rocsparse_int                  mb,
+                                                rocsparse_int                  n,
+                                                rocsparse_int                  kb,
+                                                rocsparse_int                  nnzb,
+                                                const rocsparse_float_complex* alpha,
+                                                const rocsparse_mat_descr      descr,
+                                                const rocsparse_float_complex* bsr_val,
+                                                const rocsparse_int*           bsr_row_ptr,
+                                                const rocsparse_int*           bsr_col_ind,
+                                                rocsparse_int                  block_dim,
+                                                rocsparse_mat_info             info,
+                                                const rocsparse_float_complex* B,
+                                                rocsparse_int                  ldb,
+                                                const rocsparse_float_complex* beta,
+                                                rocsparse_float_complex*       C,
+                                                rocsparse_int                  ldc)
+{
+    return rocsparse_bsrmm_template(handle,
+                                    dir,
+                                    trans_A,
+                                    trans_B,
+                                    order_B,
+                                    order_C,
+                                    mb,
+                                    n,
+                                    kb,
+                                    nnzb,
+                                    alpha,
+                                    descr,
+                                    bsr_val,
+                                    bsr_row_ptr,
+                                    bsr_col_ind,
+                                    block_dim,
+                                    info,
+                                    B,
+                                    ldb,
+                                    beta,
+                                    C,
+                                    ldc);
+}
+
+extern "C" rocsparse_status rocsparse_zbsrmm_ex(rocsparse_handle                handle,
+                                                rocsparse_direction             dir,
+                                                rocsparse_operation             trans_A,
+                                                rocsparse_operation             trans_B,
+                                                rocsparse_order                 order_B,
+                                                rocsparse_order                 order_C,
+                                                rocsparse_int                   mb,
+                                                rocsparse_int                   n,
+                                                rocsparse_int                   kb,
+                                                rocsparse_int                   nnzb,
+                                                const rocsparse_double_complex* alpha,
+                                                const rocsparse_mat_descr       descr,
+                                                const rocsparse_double_complex* bsr_val,
+                                                const rocsparse_int*            bsr_row_ptr,
+                                                const rocsparse_int*            bsr_col_ind,
+                                                rocsparse_int                   block_dim,
+                                                rocsparse_mat_info              info,
+                                                const rocsparse_double_complex* B,
+                                                rocsparse_int                   ldb,
+                                                const rocsparse_double_complex* beta,
+                                                rocsparse_double_complex*       C,
+                                                rocsparse_int                   ldc)
+{
+    return rocsparse_bsrmm_template(handle,
+                                    dir,
+                                    trans_A,
+                                    trans_B,
+                                    order_B,
+                                    order_C,
+                                    mb,
+                                    n,
+                                    kb,
+                                    nnzb,
+                                    alpha,
+                                    descr,
+                                    bsr_val,
+                                    bsr_row_ptr,
+                                    bsr_col_ind,
+                                    block_dim,
+                                    info,
                                     B,
                                     ldb,
                                     beta,
@@ -53,6 +53,7 @@
         *beta,                                                                                   \
         C,                                                                                       \
         ldc,                                                                                     \
+        order_C,                                                                                 \
         descr->base);
 
 #define launch_bsrmmnn_small_blockdim_kernel_device_pointer(T, block_size, wf_size, bsr_block_dim) \
@@ -74,6 +75,7 @@
         beta,                                                                                      \
         C,                                                                                         \
         ldc,                                                                                       \
+        order_C,                                                                                   \
         descr->base);
 
 #define launch_bsrmmnt_small_blockdim_kernel_host_pointer(T, block_size, wf_size, bsr_block_dim) \
@@ -95,6 +97,7 @@
         *beta,                                                                                   \
         C,                                                                                       \
         ldc,                                                                                     \
+        order_C,                                                                                 \
         descr->base);
 
 #define launch_bsrmmnt_small_blockdim_kernel_device_pointer(T, block_size, wf_size, bsr_block_dim) \
@@ -116,6 +119,7 @@
         beta,                                                                                      \
         C,                                                                                         \
         ldc,                                                                                       \
+        order_C,                                                                                   \
         descr->base);
 
 #define launch_bsrmm_large_blockdim_kernel_host_pointer(T, bsr_block_dim, blk_size_y)            \
@@ -125,7 +129,7 @@
                        0,                                                                        \
                        stream,                                                                   \
                        dir,                                                                      \
-                       trans_B,                                                                  \
+                       op_B,                                                                     \
                        mb,                                                                       \
                        n,                                                                        \
                        *alpha,                                                                   \
@@ -138,6 +142,7 @@
                        *beta,                                                                    \
                        C,                                                                        \
                        ldc,                                                                      \
+                       order_C,                                                                  \
                        descr->base);
 
 #define launch_bsrmm_large_blockdim_kernel_device_pointer(T, bsr_block_dim, blk_size_y)            \
@@ -147,7 +152,7 @@
                        0,                                                                          \
                        stream,                                                                     \
                        dir,                                                                        \
-                       trans_B,                                                                    \
+                       op_B,                                                                       \
                        mb,                                                                         \
                        n,                                                                          \
                        alpha,                                                                      \
@@ -160,51 +165,55 @@
                        beta,                                                                       \
                        C,                                                                          \
                        ldc,                                                                        \
+                       order_C,                                                                    \
                        descr->base);
 
-#define launch_bsrmm_general_blockdim_kernel_host_pointer(T, bsr_block_dim, blk_size_y)            \
-    hipLaunchKernelGGL((bsrmm_general_blockdim_kernel_host_pointer<T, bsr_block_dim, blk_size_y>), \
-                       bsrmm_blocks,                                                               \
-                       bsrmm_threads,                                                              \
-                       0,                                                                          \
-                       stream,                                                                     \
-                       dir,                                                                        \
-                       trans_B,                                                                    \
-                       mb,                                                                         \
-                       n,                                                                          \
-                       *alpha,                                                                     \
-                       bsr_row_ptr,                                                                \
-                       bsr_col_ind,                                                                \
-                       bsr_val,                                                                    \
-                       block_dim,                                                                  \
-                       B,                                                                          \
-                       ldb,                                                                        \
-                       *beta,                                                                      \
-                       C,                                                                          \
-                       ldc,                                                                        \
-                       descr->base);
+#define launch_bsrmm_tiled_blockdim_kernel_host_pointer(T, bsr_block_dim, blk_size_y, tile) \
+    hipLaunchKernelGGL(                                                                     \
+        (bsrmm_tiled_blockdim_kernel_host_pointer<T, bsr_block_dim, blk_size_y, tile>),     \
+        bsrmm_blocks,                                                                       \
+        bsrmm_threads,                                                                      \
+        0,                                                                                  \
+        stream,                                                                             \
+        dir,                                                                                \
+        op_B,                                                                               \
+        mb,                                                                                 \
+        n,                                                                                  \
+        *alpha,                                                                             \
+        bsr_row_ptr,                                                                        \
+        bsr_col_ind,                                                                        \
+        bsr_val,                                                                            \
+        block_dim,                                                                          \
+        B,                                                                                  \
+        ldb,                                                                                \
+        *beta,                                                                              \
+        C,                                                                                  \
+        ldc,                                                                                \
+        order_C,                                                                            \
+        descr->base);
 
-#define launch_bsrmm_general_blockdim_kernel_device_pointer(T, bsr_block_dim, blk_size_y) \
-    hipLaunchKernelGGL(                                                                   \
-        (bsrmm_general_blockdim_kernel_device_pointer<T, bsr_block_dim, blk_size_y>),     \
-        bsrmm_blocks,                                                                     \
-        bsrmm_threads,                                                                    \
-        0,                                                                                \
-        stream,                                                                           \
-        dir,                                                                              \
-        trans_B,                                                                          \
-        mb,                                                                               \
-        n,                                                                                \
-        alpha,                                                                            \
-        bsr_row_ptr,                                                                      \
-        bsr_col_ind,                                                                      \
-        bsr_val,                                                                          \
-        block_dim,                                                                        \
-        B,                                                                                \
-        ldb,                                                                              \
-        beta,                                                                             \
-        C,                                                                                \
-        ldc,                                                                              \
+#define launch_bsrmm_tiled_blockdim_kernel_device_pointer(T, bsr_block_dim, blk_size_y, tile) \
+    hipLaunchKernelGGL(                                                                       \
+        (bsrmm_tiled_blockdim_kernel_device_pointer<T, bsr_block_dim, blk_size_y, tile>),     \
+        bsrmm_blocks,                                                                         \
+        bsrmm_threads,                                                                        \
+        0,                                                                                    \
+        stream,                                                                               \
+        dir,                                                                                  \
+        op_B,                                                                                 \
+        mb,                                                                                   \
+        n,                                                                                    \
+        alpha,                                                                                \
+        bsr_row_ptr,                                                                          \
+        bsr_col_ind,                                                                          \
+        bsr_val,                                                                              \
+        block_dim,                                                                            \
+        B,                                                                                    \
+        ldb,                                                                                  \
+        beta,                                                                                 \
+        C,                                                                                    \
+        ldc,                                                                                  \
+        order_C,                                                                              \
         descr->base);
 
 template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, rocsparse_int BSR_BLOCK_DIM>
@@ -221,6 +230,7 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                     T             beta,
                                                     T* __restrict__ C,
                                                     rocsparse_int        ldc,
+                                                    rocsparse_order      order_C,
                                                     rocsparse_index_base idx_base)
 {
     if(alpha == static_cast<T>(0) && beta == static_cast<T>(1))
@@ -228,8 +238,20 @@ __launch_bounds__(BLOCKSIZE) __global__
         return;
     }
 
-    bsrmmnn_small_blockdim_device<T, BLOCKSIZE, WF_SIZE, BSR_BLOCK_DIM>(
-        direction, mb, n, alpha, bsr_row_ptr, bsr_col_ind, bsr_val, B, ldb, beta, C, ldc, idx_base);
+    bsrmmnn_small_blockdim_device<T, BLOCKSIZE, WF_SIZE, BSR_BLOCK_DIM>(direction,
+                                                                        mb,
+                                                                        n,
+                                                                        alpha,
+                                                                        bsr_row_ptr,
+                                                                        bsr_col_ind,
+                                                                        bsr_val,
+                                                                        B,
+                                                                        ldb,
+                                                                        beta,
+                                                                        C,
+                                                                        ldc,
+                                                                        order_C,
+                                                                        idx_base);
 }
 
 template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, rocsparse_int BSR_BLOCK_DIM>
@@ -246,6 +268,7 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                       const T*      beta,
                                                       T* __restrict__ C,
                                                       rocsparse_int        ldc,
+                                                      rocsparse_order      order_C,
                                                       rocsparse_index_base idx_base)
 {
     if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
@@ -265,6 +288,7 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                                         *beta,
                                                                         C,
                                                                         ldc,
+                                                                        order_C,
                                                                         idx_base);
 }
 
@@ -282,6 +306,7 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                     T             beta,
                                                     T* __restrict__ C,
                                                     rocsparse_int        ldc,
+                                                    rocsparse_order      order_C,
                                                     rocsparse_index_base idx_base)
 {
     if(alpha == static_cast<T>(0) && beta == static_cast<T>(1))
@@ -289,8 +314,20 @@ __launch_bounds__(BLOCKSIZE) __global__
         return;
     }
 
-    bsrmmnt_small_blockdim_device<T, BLOCKSIZE, WF_SIZE, BSR_BLOCK_DIM>(
-        direction, mb, n, alpha, bsr_row_ptr, bsr_col_ind, bsr_val, B, ldb, beta, C, ldc, idx_base);
+    bsrmmnt_small_blockdim_device<T, BLOCKSIZE, WF_SIZE, BSR_BLOCK_DIM>(direction,
+                                                                        mb,
+                                                                        n,
+                                                                        alpha,
+                                                                        bsr_row_ptr,
+                                                                        bsr_col_ind,
+                                                                        bsr_val,
+                                                                        B,
+                                                                        ldb,
+                                                                        beta,
+                                                                        C,
+                                                                        ldc,
+                                                                        order_C,
+                                                                        idx_base);
 }
 
 template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, rocsparse_int BSR_BLOCK_DIM>
@@ -307,6 +344,7 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                       const T*      beta,
                                                       T* __restrict__ C,
                                                       rocsparse_int        ldc,
+                                                      rocsparse_order      order_C,
                                                       rocsparse_index_base idx_base)
 {
     if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
@@ -326,6 +364,7 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                                         *beta,
                                                                         C,
                                                                         ldc,
+                                                                        order_C,
                                                                         idx_base);
 }
 
@@ -345,6 +384,7 @@ __launch_bounds__(BSR_BLOCK_DIM* BLK_SIZE_Y) __global__
                                                   T             beta,
                                                   T* __restrict__ C,
                                                   rocsparse_int        ldc,
+                                                  rocsparse_order      order_C,
                                                   rocsparse_index_base idx_base)
 {
     if(alpha == static_cast<T>(0) && beta == static_cast<T>(1))
@@ -366,6 +406,7 @@ __launch_bounds__(BSR_BLOCK_DIM* BLK_SIZE_Y) __global__
                                                               beta,
                                                               C,
                                                               ldc,
+                                                              order_C,
                                                               idx_base);
 }
 
@@ -385,6 +426,7 @@ __launch_bounds__(BSR_BLOCK_DIM* BLK_SIZE_Y) __global__
                                                     const T*      beta,
                                                     T* __restrict__ C,
                                                     rocsparse_int        ldc,
+                                                    rocsparse_order      order_C,
                                                     rocsparse_index_base idx_base)
 {
     if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
@@ -406,87 +448,109 @@ __launch_bounds__(BSR_BLOCK_DIM* BLK_SIZE_Y) __global__
                                                               *beta,
                                                               C,
                                                               ldc,
+                                                              order_C,
                                                               idx_base);
 }
 
-template <typename T, rocsparse_int BSR_BLOCK_DIM, rocsparse_int BLK_SIZE_Y>
+template <typename T, rocsparse_int BSR_BLOCK_DIM, rocsparse_int BLK_SIZE_Y, rocsparse_int TILE>
+__launch_bounds__(BSR_BLOCK_DIM* BLK_SIZE_Y) __global__
+    void bsrmm_tiled_blockdim_kernel_host_pointer(rocsparse_direction direction,
+                                                  rocsparse_operation trans_B,
+                                                  rocsparse_int       mb,
+                                                  rocsparse_int       n,
+                                                  T                   alpha,
+                                                  const rocsparse_int* __restrict__ bsr_row_ptr,
+                                                  const rocsparse_int* __restrict__ bsr_col_ind,
+                                                  const T* __restrict__ bsr_val,
+                                                  rocsparse_int block_dim,
+                                                  const T* __restrict__ B,
+                                                  rocsparse_int ldb,
+                                                  T             beta,
+                                                  T* __restrict__ C,
+                                                  rocsparse_int        ldc,
+                                                  rocsparse_order      order_C,
+                                                  rocsparse_index_base idx_base)
+{
+    if(alpha == static_cast<T>(0) && beta == static_cast<T>(1))
+    {
+        return;
+    }
+
+    bsrmm_tiled_blockdim_device<T, BSR_BLOCK_DIM, BLK_SIZE_Y, TILE>(direction,
+                                                                    trans_B,
+                                                                    mb,
+                                                                    n,
+                                                                    alpha,
+                                                                    bsr_row_ptr,
+                                                                    bsr_col_ind,
+                                                                    bsr_val,
+                                                                    block_dim,
+                                                                    B,
+                                                                    ldb,
+                                                                    beta,
+                                                                    C,
+                                                                    ldc,
+                                                                    order_C,
+                                                                    idx_base);
+}
+
+template <typename T, rocsparse_int BSR_BLOCK_DIM, rocsparse_int BLK_SIZE_Y, rocsparse_int TILE>
 __launch_bounds__(BSR_BLOCK_DIM* BLK_SIZE_Y) __global__
-    void bsrmm_general_blockdim_kernel_host_pointer(rocsparse_direction direction,
+    void bsrmm_tiled_blockdim_kernel_device_pointer(rocsparse_direction direction,
                                                     rocsparse_operation trans_B,
                                                     rocsparse_int       mb,
                                                     rocsparse_int       n,
-                                                    T                   alpha,
+                                                    const T*            alpha,
                                                     const rocsparse_int* __restrict__ bsr_row_ptr,
                                                     const rocsparse_int* __restrict__ bsr_col_ind,
                                                     const T* __restrict__ bsr_val,
                                                     rocsparse_int block_dim,
                                                     const T* __restrict__ B,
                                                     rocsparse_int ldb,
-                                                    T             beta,
+                                                    const T*      beta,
                                                     T* __restrict__ C,
                                                     rocsparse_int        ldc,
+                                                    rocsparse_order      order_C,
                                                     rocsparse_index_base idx_base)
 {
-    if(alpha == static_cast<T>(0) && beta == static_cast<T>(1))
+    if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
     {
         return;
     }
 
-    bsrmm_general_blockdim_device<T, BSR_BLOCK_DIM, BLK_SIZE_Y>(direction,
-                                                                trans_B,
-                                                                mb,
-                                                                n,
-                                                                alpha,
-                                                                bsr_row_ptr,
-                                                                bsr_col_ind,
-                                                                bsr_val,
-                                                                block_dim,
-                                                                B,
-                                                                ldb,
-                                                                beta,
-                                                                C,
-                                                                ldc,
-                                                                idx_base);
+    bsrmm_tiled_blockdim_device<T, BSR_BLOCK_DIM, BLK_SIZE_Y, TILE>(direction,
+                                                                    trans_B,
+                                                                    mb,
+                                                                    n,
+                                                                    *alpha,
+                                                                    bsr_row_ptr,
+                                                                    bsr_col_ind,
+                                                                    bsr_val,
+                                                                    block_dim,
+                                                                    B,
+                                                                    ldb,
+                                                                    *beta,
+                                                                    C,
+                                                                    ldc,
+                                                                    order_C,
+                                                                    idx_base);
 }
 
-template <typename T, rocsparse_int BSR_BLOCK_DIM, rocsparse_int BLK_SIZE_Y>
-__launch_bounds__(BSR_BLOCK_DIM* BLK_SIZE_Y) __global__
-    void bsrmm_general_blockdim_kernel_device_pointer(rocsparse_direction direction,
-                                                      rocsparse_operation trans_B,
-                                                      rocsparse_int       mb,
-                                                      rocsparse_int       n,
-                                                      const T*            alpha,
-                                                      const rocsparse_int* __restrict__ bsr_row_ptr,
-                                                      const rocsparse_int* __restrict__ bsr_col_ind,
-                                                      const T* __restrict__ bsr_val,
-                                                      rocsparse_int block_dim,
-                                                      const T* __restrict__ B,
-                                                      rocsparse_int ldb,
-                                                      const T*      beta,
-                                                      T* __restrict__ C,
-                                                      rocsparse_int        ldc,
-                                                      rocsparse_index_base idx_base)
-{
-    if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
-    {
-        return;
-    }
+// BSR block dimensions with a dedicated instantiation of the large block dimension kernel
+// clang-format off
+using bsrmm_large_blockdim_dims = rocsparse_value_list< 3,  4,  5,  6,  7,  8,  9, 10, 11, 12,
+                                                       13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+                                                       23, 24, 25, 26, 27, 28, 29, 30, 31, 32>;
+// clang-format on
+
+// Register tile sizes of the tiled kernel, for BSR block dimensions larger than 32
+using bsrmm_tiled_blockdim_tiles = rocsparse_value_list<3, 4, 5, 6, 7, 8>;
 
-    bsrmm_general_blockdim_device<T, BSR_BLOCK_DIM, BLK_SIZE_Y>(direction,
-                                                                trans_B,
-                                                                mb,
-                                                                n,
-                                                                *alpha,
-                                                                bsr_row_ptr,
-                                                                bsr_col_ind,
-                                                                bsr_val,
-                                                                block_dim,
-                                                                B,
-                                                                ldb,
-                                                                *beta,
-                                                                C,
-                                                                ldc,
-                                                                idx_base);
+// Number of columns of B per thread block of the large block dimension kernel
+static constexpr rocsparse_int bsrmm_blk_size_y(rocsparse_int bsr_block_dim)
+{
+    return (bsr_block_dim <= 4) ? 16
+                                : ((bsr_block_dim <= 8) ? 32 : ((bsr_block_dim <= 16) ? 16 : 32));
 }
 
 template <typename T>
@@ -494,6 +558,8 @@ rocsparse_status rocsparse_bsrmm_template(rocsparse_handle          handle,
                                           rocsparse_direction       dir,
                                           rocsparse_operation       trans_A,
                                           rocsparse_operation       trans_B,
+                                          rocsparse_order           order_B,
+                                          rocsparse_order           order_C,
                                           rocsparse_int             mb,
                                           rocsparse_int             n,
                                           rocsparse_int             kb,
@@ -504,6 +570,7 @@ rocsparse_status rocsparse_bsrmm_template(rocsparse_handle          handle,
                                           const rocsparse_int*      bsr_row_ptr,
                                           const rocsparse_int*      bsr_col_ind,
                                           rocsparse_int             block_dim,
+                                          rocsparse_mat_info        info,
                                           const T*                  B,
                                           rocsparse_int             ldb,
                                           const T*                  beta,
@@ -528,6 +595,8 @@ rocsparse_status rocsparse_bsrmm_template(rocsparse_handle          handle,
                   dir,
                   trans_A,
                   trans_B,
+                  order_B,
+                  order_C,
                   mb,
                   n,
                   kb,
@@ -538,6 +607,7 @@ rocsparse_status rocsparse_bsrmm_template(rocsparse_handle          handle,
                   (const void*&)bsr_row_ptr,
                   (const void*&)bsr_col_ind,
                   block_dim,
+                  (const void*&)info,
                   (const void*&)B,
                   ldb,
                   *beta,
@@ -551,6 +621,8 @@ rocsparse_status rocsparse_bsrmm_template(rocsparse_handle          handle,
                   dir,
                   trans_A,
                   trans_B,
+                  order_B,
+                  order_C,
                   mb,
                   n,
                   kb,
@@ -561,6 +633,7 @@ rocsparse_status rocsparse_bsrmm_template(rocsparse_handle          handle,
                   (const void*&)bsr_row_ptr,
                   (const void*&)bsr_col_ind,
                   block_dim,
+                  (const void*&)info,
                   (const void*&)B,
                   ldb,
                   (const void*&)beta,
@@ -581,12 +654,15 @@ rocsparse_status rocsparse_bsrmm_template(rocsparse_handle          handle,
         return rocsparse_status_not_implemented;
     }
 
-    // Check operation
-    if(trans_A != rocsparse_operation_none)
+    // Check dense matrix orders
+    if((order_B != rocsparse_order_row && order_B != rocsparse_order_column)
+       || (order_C != rocsparse_order_row && order_C != rocsparse_order_column))
     {
-        return rocsparse_status_not_implemented;
+        return rocsparse_status_invalid_value;
     }
-    else if(trans_B != rocsparse_operation_none && trans_B != rocsparse_operation_transpose)
+
+    // Check operation
+    if(trans_B != rocsparse_operation_none && trans_B != rocsparse_operation_transpose)
     {
         return rocsparse_status_not_implemented;
     }
@@ -610,56 +686,154 @@ rocsparse_status rocsparse_bsrmm_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // op(B) is stored row by row, if either B is transposed or stored in row major order
+    bool row_major_B = ((trans_B == rocsparse_operation_none) == (order_B == rocsparse_order_row));
+
+    // The kernels only distinguish between column and row wise access of op(B)
+    rocsparse_operation op_B
+        = row_major_B ? rocsparse_operation_transpose : rocsparse_operation_none;
+
+    rocsparse_int m   = mb * block_dim;
+    rocsparse_int k   = kb * block_dim;
+    rocsparse_int nnz = nnzb * block_dim;
+
+    // Rows of op(B) and C
+    rocsparse_int nrow_B = (trans_A == rocsparse_operation_none) ? k : m;
+    rocsparse_int nrow_C = (trans_A == rocsparse_operation_none) ? m : k;
+
     // Check leading dimension of B
-    if(trans_B == rocsparse_operation_none)
+    if(ldb < std::max(1, row_major_B ? n : nrow_B))
     {
-        if(ldb < kb)
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check leading dimension of C
+    if(ldc < std::max(1, (order_C == rocsparse_order_column) ? nrow_C : n))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Transposed A is processed by the non-transposed kernels on the block transpose
+    // of A, which has been computed by bsrmm_ex_analysis
+    if(trans_A != rocsparse_operation_none)
+    {
+        if(info == nullptr)
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        rocsparse_bsrmv_info bsrmm_info = info->bsrmm_info;
+
+        // Without non-zero blocks, there is no analysis data
+        if(nnzb == 0)
+        {
+            return rocsparse_status_success;
+        }
+
+        // Check if info matches current matrix and options
+        if(bsrmm_info == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(bsrmm_info->dir != dir)
+        {
+            return rocsparse_status_invalid_value;
+        }
+        else if(bsrmm_info->trans != trans_A)
+        {
+            return rocsparse_status_invalid_value;
+        }
+        else if(bsrmm_info->mb != mb)
         {
             return rocsparse_status_invalid_size;
         }
-    }
-    else
-    {
-        if(ldb < n)
+        else if(bsrmm_info->nb != kb)
         {
             return rocsparse_status_invalid_size;
         }
-    }
+        else if(bsrmm_info->nnzb != nnzb)
+        {
+            return rocsparse_status_invalid_size;
+        }
+        else if(bsrmm_info->bsr_dim != block_dim)
+        {
+            return rocsparse_status_invalid_size;
+        }
+        else if(bsrmm_info->descr != descr)
+        {
+            return rocsparse_status_invalid_value;
+        }
+        else if(bsrmm_info->bsr_val != bsr_val)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(bsrmm_info->bsr_row_ptr != bsr_row_ptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(bsrmm_info->bsr_col_ind != bsr_col_ind)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
 
-    // Check leading dimension of C
-    if(ldc < mb)
-    {
-        return rocsparse_status_invalid_size;
+        // Quick return
+        if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == static_cast<T>(0)
+           && *beta == static_cast<T>(1))
+        {
+            return rocsparse_status_success;
+        }
+
+        // op(A) is the kb x mb block matrix given by the block transpose, with its blocks
+        // stored in the opposite direction
+        rocsparse_direction dir_t = (dir == rocsparse_direction_row) ? rocsparse_direction_column
+                                                                     : rocsparse_direction_row;
+
+        return rocsparse_bsrmm_template(handle,
+                                        dir_t,
+                                        rocsparse_operation_none,
+                                        trans_B,
+                                        order_B,
+                                        order_C,
+                                        kb,
+                                        n,
+                                        mb,
+                                        nnzb,
+                                        alpha,
+                                        descr,
+                                        static_cast<const T*>(bsrmm_info->trans_val),
+                                        bsrmm_info->trans_col_ptr,
+                                        bsrmm_info->trans_row_ind,
+                                        block_dim,
+                                        nullptr,
+                                        B,
+                                        ldb,
+                                        beta,
+                                        C,
+                                        ldc);
     }
 
     // Stream
     hipStream_t stream = handle->stream;
 
-    rocsparse_int m   = mb * block_dim;
-    rocsparse_int k   = kb * block_dim;
-    rocsparse_int nnz = nnzb * block_dim;
-
-    // If n is only 1 and B are non-transposed, then call bsrmv
-    if(n == 1)
+    // If n is only 1 and B and C are column vectors, then call bsrmv
+    if(n == 1 && trans_A == rocsparse_operation_none && op_B == rocsparse_operation_none
+       && order_C == rocsparse_order_column)
     {
-        if(trans_B == rocsparse_operation_none)
-        {
-            return rocsparse_bsrmv_template(handle,
-                                            dir,
-                                            trans_A,
-                                            mb,
-                                            kb,
-                                            nnzb,
-                                            alpha,
-                                            descr,
-                                            bsr_val,
-                                            bsr_row_ptr,
-                                            bsr_col_ind,
-                                            block_dim,
-                                            B,
-                                            beta,
-                                            C);
-        }
+        return rocsparse_bsrmv_template(handle,
+                                        dir,
+                                        trans_A,
+                                        mb,
+                                        kb,
+                                        nnzb,
+                                        alpha,
+                                        descr,
+                                        bsr_val,
+                                        bsr_row_ptr,
+                                        bsr_col_ind,
+                                        block_dim,
+                                        B,
+                                        beta,
+                                        C);
     }
 
     // If block dimension is one we can simply call csrmm
@@ -668,6 +842,8 @@ rocsparse_status rocsparse_bsrmm_template(rocsparse_handle          handle,
         return rocsparse_csrmm_template(handle,
                                         trans_A,
                                         trans_B,
+                                        order_B,
+                                        order_C,
                                         m,
                                         n,
                                         k,
@@ -677,6 +853,7 @@ rocsparse_status rocsparse_bsrmm_template(rocsparse_handle          handle,
                                         bsr_val,
                                         bsr_row_ptr,
                                         bsr_col_ind,
+                                        nullptr,
                                         B,
                                         ldb,
                                         beta,
@@ -688,7 +865,7 @@ rocsparse_status rocsparse_bsrmm_template(rocsparse_handle          handle,
     {
         if(handle->pointer_mode == rocsparse_pointer_mode_device)
         {
-            if(trans_B == rocsparse_operation_none)
+            if(op_B == rocsparse_operation_none)
             {
                 constexpr rocsparse_int BSRMMNN_DIM = 64;
                 constexpr rocsparse_int SUB_WF_SIZE = 8;
@@ -738,7 +915,7 @@ rocsparse_status rocsparse_bsrmm_template(rocsparse_handle          handle,
         }
         else
         {
-            if(trans_B == rocsparse_operation_none)
+            if(op_B == rocsparse_operation_none)
             {
                 constexpr rocsparse_int BSRMMNN_DIM = 64;
                 constexpr rocsparse_int SUB_WF_SIZE = 8;
@@ -791,91 +968,164 @@ rocsparse_status rocsparse_bsrmm_template(rocsparse_handle          handle,
     }
 
     // Run different bsrmm kernels for block dim > 2
-    if(n <= 16 && block_dim > 4 && block_dim <= 8)
+    if(block_dim <= 32)
     {
-        if(handle->pointer_mode == rocsparse_pointer_mode_device)
-        {
-            dim3 bsrmm_blocks((mb - 1) / 1 + 1, (n - 1) / 16 + 1);
-            dim3 bsrmm_threads(8, 16, 1);
-            launch_bsrmm_large_blockdim_kernel_device_pointer(T, 8, 16);
-        }
-        else
-        {
-            dim3 bsrmm_blocks((mb - 1) / 1 + 1, (n - 1) / 16 + 1);
-            dim3 bsrmm_threads(8, 16, 1);
-            launch_bsrmm_large_blockdim_kernel_host_pointer(T, 8, 16);
-        }
-    }
-    else
-    {
-        if(handle->pointer_mode == rocsparse_pointer_mode_device)
-        {
-            if(block_dim <= 4)
-            {
-                dim3 bsrmm_blocks((mb - 1) / 1 + 1, (n - 1) / 16 + 1);
-                dim3 bsrmm_threads(4, 16, 1);
-                launch_bsrmm_large_blockdim_kernel_device_pointer(T, 4, 16);
-            }
-            else if(block_dim <= 8)
-            {
-                dim3 bsrmm_blocks((mb - 1) / 1 + 1, (n - 1) / 32 + 1);
-                dim3 bsrmm_threads(8, 32, 1);
-                launch_bsrmm_large_blockdim_kernel_device_pointer(T, 8, 32);
-            }
-            else if(block_dim <= 16)
-            {
-                dim3 bsrmm_blocks((mb - 1) / 1 + 1, (n - 1) / 16 + 1);
-                dim3 bsrmm_threads(16, 16, 1);
-                launch_bsrmm_large_blockdim_kernel_device_pointer(T, 16, 16);
-            }
-            else if(block_dim <= 32)
+        rocsparse_dispatch_value(block_dim, bsrmm_large_blockdim_dims{}, [&](auto dim) {
+            constexpr rocsparse_int BSR_BLOCK_DIM = decltype(dim)::value;
+
+            // Small blocks use narrow thread blocks if B has only a few columns
+            constexpr rocsparse_int BLK_SIZE_Y        = bsrmm_blk_size_y(BSR_BLOCK_DIM);
+            constexpr rocsparse_int BLK_SIZE_Y_NARROW = (BSR_BLOCK_DIM <= 8) ? 16 : BLK_SIZE_Y;
+
+            auto launch = [&](auto blk) {
+                constexpr rocsparse_int BLK = decltype(blk)::value;
+
+                dim3 bsrmm_blocks((mb - 1) / 1 + 1, (n - 1) / BLK + 1);
+                dim3 bsrmm_threads(BSR_BLOCK_DIM, BLK, 1);
+
+                if(handle->pointer_mode == rocsparse_pointer_mode_device)
+                {
+                    launch_bsrmm_large_blockdim_kernel_device_pointer(T, BSR_BLOCK_DIM, BLK);
+                }
+                else
+                {
+                    launch_bsrmm_large_blockdim_kernel_host_pointer(T, BSR_BLOCK_DIM, BLK);
+                }
+            };
+
+            if(n <= 16)
             {
-                dim3 bsrmm_blocks((mb - 1) / 1 + 1, (n - 1) / 32 + 1);
-                dim3 bsrmm_threads(32, 32, 1);
-                launch_bsrmm_large_blockdim_kernel_device_pointer(T, 32, 32);
+                launch(std::integral_constant<rocsparse_int, BLK_SIZE_Y_NARROW>{});
             }
             else
             {
-                dim3 bsrmm_blocks((mb - 1) / 1 + 1, (n - 1) / 32 + 1);
-                dim3 bsrmm_threads(32, 32, 1);
-                launch_bsrmm_general_blockdim_kernel_device_pointer(T, 32, 32);
-            }
-        }
-        else
-        {
-            if(block_dim <= 4)
-            {
-                dim3 bsrmm_blocks((mb - 1) / 1 + 1, (n - 1) / 16 + 1);
-                dim3 bsrmm_threads(4, 16, 1);
-                launch_bsrmm_large_blockdim_kernel_host_pointer(T, 4, 16);
-            }
-            else if(block_dim <= 8)
-            {
-                dim3 bsrmm_blocks((mb - 1) / 1 + 1, (n - 1) / 32 + 1);
-                dim3 bsrmm_threads(8, 32, 1);
-                launch_bsrmm_large_blockdim_kernel_host_pointer(T, 8, 32);
+                launch(std::integral_constant<rocsparse_int, BLK_SIZE_Y>{});
             }
-            else if(block_dim <= 16)
-            {
-                dim3 bsrmm_blocks((mb - 1) / 1 + 1, (n - 1) / 16 + 1);
-                dim3 bsrmm_threads(16, 16, 1);
-                launch_bsrmm_large_blockdim_kernel_host_pointer(T, 16, 16);
-            }
-            else if(block_dim <= 32)
+        });
+    }
+    else
+    {
+        // Register tile size, such that a single pass covers the BSR block, if possible
+        rocsparse_int tile = std::min((block_dim - 1) / 16 + 1, 8);
+
+        rocsparse_dispatch_value(tile, bsrmm_tiled_blockdim_tiles{}, [&](auto t) {
+            constexpr rocsparse_int TILE = decltype(t)::value;
+
+            dim3 bsrmm_blocks((mb - 1) / 1 + 1, (n - 1) / 16 + 1);
+            dim3 bsrmm_threads(16, 16, 1);
+
+            if(handle->pointer_mode == rocsparse_pointer_mode_device)
             {
-                dim3 bsrmm_blocks((mb - 1) / 1 + 1, (n - 1) / 32 + 1);
-                dim3 bsrmm_threads(32, 32, 1);
-                launch_bsrmm_large_blockdim_kernel_host_pointer(T, 32, 32);
+                launch_bsrmm_tiled_blockdim_kernel_device_pointer(T, 16, 16, TILE);
             }
             else
             {
-                dim3 bsrmm_blocks((mb - 1) / 1 + 1, (n - 1) / 32 + 1);
-                dim3 bsrmm_threads(32, 32, 1);
-                launch_bsrmm_general_blockdim_kernel_host_pointer(T, 32, 32);
+                launch_bsrmm_tiled_blockdim_kernel_host_pointer(T, 16, 16, TILE);
             }
-        }
+        });
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_bsrmm_ex_analysis_template(rocsparse_handle          handle,
+                                                      rocsparse_direction       dir,
+                                                      rocsparse_operation       trans_A,
+                                                      rocsparse_int             mb,
+                                                      rocsparse_int             kb,
+                                                      rocsparse_int             nnzb,
+                                                      const rocsparse_mat_descr descr,
+                                                      const T*                  bsr_val,
+                                                      const rocsparse_int*      bsr_row_ptr,
+                                                      const rocsparse_int*      bsr_col_ind,
+                                                      rocsparse_int             block_dim,
+                                                      rocsparse_mat_info        info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xbsrmm_ex_analysis"),
+              dir,
+              trans_A,
+              mb,
+              kb,
+              nnzb,
+              (const void*&)descr,
+              (const void*&)bsr_val,
+              (const void*&)bsr_row_ptr,
+              (const void*&)bsr_col_ind,
+              block_dim,
+              (const void*&)info);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(mb < 0 || kb < 0 || nnzb < 0 || block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
     }
 
+    // Clear bsrmm info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_bsrmv_info(info->bsrmm_info));
+    info->bsrmm_info = nullptr;
+
+    // Quick return if possible
+    if(mb == 0 || kb == 0 || nnzb == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(bsr_val == nullptr || bsr_row_ptr == nullptr || bsr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Non-transposed A is multiplied directly
+    if(trans_A == rocsparse_operation_none)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Create bsrmm info holding the block transpose
+    RETURN_IF_ROCSPARSE_ERROR(bsrmv_create_transpose_info(handle,
+                                                          dir,
+                                                          trans_A,
+                                                          mb,
+                                                          kb,
+                                                          nnzb,
+                                                          descr,
+                                                          bsr_val,
+                                                          bsr_row_ptr,
+                                                          bsr_col_ind,
+                                                          block_dim,
+                                                          &info->bsrmm_info));
+
     return rocsparse_status_success;
 }
 
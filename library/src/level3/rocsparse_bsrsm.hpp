@@ -0,0 +1,914 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_BSRSM_HPP
+#define ROCSPARSE_BSRSM_HPP
+
+#include "../level2/rocsparse_csrsv.hpp"
+#include "bsrsm_device.h"
+#include "csrsm_device.h"
+#include "definitions.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+#include <limits>
+#include <rocprim/rocprim.hpp>
+
+// Number of right-hand sides that are processed by a single thread block
+static inline int rocsparse_bsrsm_blockdim(rocsparse_int nrhs)
+{
+    int blockdim = 512;
+    while(nrhs <= blockdim && blockdim > 32)
+    {
+        blockdim >>= 1;
+    }
+
+    return blockdim << 1;
+}
+
+template <typename T>
+rocsparse_status rocsparse_bsrsm_buffer_size_template(rocsparse_handle          handle,
+                                                      rocsparse_direction       dir,
+                                                      rocsparse_operation       trans_A,
+                                                      rocsparse_operation       trans_B,
+                                                      rocsparse_int             mb,
+                                                      rocsparse_int             nrhs,
+                                                      rocsparse_int             nnzb,
+                                                      const T*                  alpha,
+                                                      const rocsparse_mat_descr descr,
+                                                      const T*                  bsr_val,
+                                                      const rocsparse_int*      bsr_row_ptr,
+                                                      const rocsparse_int*      bsr_col_ind,
+                                                      rocsparse_int             block_dim,
+                                                      const T*                  B,
+                                                      rocsparse_int             ldb,
+                                                      rocsparse_mat_info        info,
+                                                      rocsparse_solve_policy    policy,
+                                                      size_t*                   buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xbsrsm_buffer_size"),
+              dir,
+              trans_A,
+              trans_B,
+              mb,
+              nrhs,
+              nnzb,
+              (const void*&)alpha,
+              (const void*&)descr,
+              (const void*&)bsr_val,
+              (const void*&)bsr_row_ptr,
+              (const void*&)bsr_col_ind,
+              block_dim,
+              (const void*&)B,
+              ldb,
+              (const void*&)info,
+              policy,
+              (const void*&)buffer_size);
+
+    // Check direction
+    if(dir != rocsparse_direction_row && dir != rocsparse_direction_column)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check operation type
+    if(trans_A != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    if(trans_B != rocsparse_operation_none && trans_B != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(mb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nrhs < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnzb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(block_dim < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check for valid buffer_size pointer
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(mb == 0 || nrhs == 0 || nnzb == 0 || block_dim == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(bsr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // rocsparse_int max_nnz
+    *buffer_size = 256;
+
+    // Each thread block performs at most blockdim columns of the
+    // rhs matrix, thus we need a done array for each chunk of
+    // columns.
+    int narrays = (nrhs - 1) / rocsparse_bsrsm_blockdim(nrhs) + 1;
+
+    // int done_array
+    *buffer_size += sizeof(int) * ((mb * narrays - 1) / 256 + 1) * 256;
+
+    // rocsparse_int workspace
+    *buffer_size += sizeof(rocsparse_int) * ((mb - 1) / 256 + 1) * 256;
+
+    // int workspace2
+    *buffer_size += sizeof(int) * ((mb - 1) / 256 + 1) * 256;
+
+    size_t         rocprim_size;
+    rocsparse_int* ptr  = reinterpret_cast<rocsparse_int*>(buffer_size);
+    int*           ptr2 = reinterpret_cast<int*>(buffer_size);
+
+    rocprim::double_buffer<rocsparse_int> dummy(ptr, ptr);
+    rocprim::double_buffer<int>           dummy2(ptr2, ptr2);
+
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(nullptr, rocprim_size, dummy2, dummy, mb, 0, 32, stream));
+
+    // rocprim buffer
+    *buffer_size += rocprim_size;
+
+    // Additional buffer to store transpose of B, if trans_B == rocsparse_operation_none
+    if(trans_B == rocsparse_operation_none)
+    {
+        *buffer_size += sizeof(T) * ((size_t(mb) * block_dim * nrhs - 1) / 256 + 1) * 256;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_bsrsm_analysis_template(rocsparse_handle          handle,
+                                                   rocsparse_direction       dir,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_B,
+                                                   rocsparse_int             mb,
+                                                   rocsparse_int             nrhs,
+                                                   rocsparse_int             nnzb,
+                                                   const T*                  alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  bsr_val,
+                                                   const rocsparse_int*      bsr_row_ptr,
+                                                   const rocsparse_int*      bsr_col_ind,
+                                                   rocsparse_int             block_dim,
+                                                   const T*                  B,
+                                                   rocsparse_int             ldb,
+                                                   rocsparse_mat_info        info,
+                                                   rocsparse_analysis_policy analysis,
+                                                   rocsparse_solve_policy    solve,
+                                                   void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xbsrsm_analysis"),
+              dir,
+              trans_A,
+              trans_B,
+              mb,
+              nrhs,
+              nnzb,
+              (const void*&)alpha,
+              (const void*&)descr,
+              (const void*&)bsr_val,
+              (const void*&)bsr_row_ptr,
+              (const void*&)bsr_col_ind,
+              block_dim,
+              (const void*&)B,
+              ldb,
+              (const void*&)info,
+              analysis,
+              solve,
+              (const void*&)temp_buffer);
+
+    // Check direction
+    if(dir != rocsparse_direction_row && dir != rocsparse_direction_column)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check operation type
+    if(trans_A != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    if(trans_B != rocsparse_operation_none && trans_B != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check analysis policy
+    if(analysis != rocsparse_analysis_policy_reuse && analysis != rocsparse_analysis_policy_force)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check solve policy
+    if(solve != rocsparse_solve_policy_auto)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(mb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nrhs < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnzb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(block_dim < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(mb == 0 || nrhs == 0 || nnzb == 0 || block_dim == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(bsr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Switch between lower and upper triangular analysis
+    if(descr->fill_mode == rocsparse_fill_mode_upper)
+    {
+        // Differentiate the analysis policies
+        if(analysis == rocsparse_analysis_policy_reuse)
+        {
+            // We try to re-use already analyzed upper part, if available.
+            // It is the user's responsibility that this data is still valid,
+            // since he passed the 'reuse' flag.
+
+            // If bsrsm meta data is already available, do nothing
+            if(info->bsrsm_upper_info != nullptr)
+            {
+                return rocsparse_status_success;
+            }
+
+            // Check for other upper analysis meta data
+            if(info->bsrsv_upper_info != nullptr)
+            {
+                // bsrsv meta data
+                info->bsrsm_upper_info = info->bsrsv_upper_info;
+                return rocsparse_status_success;
+            }
+        }
+
+        // User is explicitly asking to force a re-analysis, or no valid data has been
+        // found to be re-used
+
+        // Clear bsrsm info
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->bsrsm_upper_info));
+
+        // Create bsrsm info
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_trm_info(&info->bsrsm_upper_info));
+
+        // Perform analysis
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_trm_analysis(handle,
+                                                         trans_A,
+                                                         mb,
+                                                         nnzb,
+                                                         descr,
+                                                         bsr_val,
+                                                         bsr_row_ptr,
+                                                         bsr_col_ind,
+                                                         info->bsrsm_upper_info,
+                                                         &info->zero_pivot,
+                                                         temp_buffer));
+    }
+    else
+    {
+        // Differentiate the analysis policies
+        if(analysis == rocsparse_analysis_policy_reuse)
+        {
+            // We try to re-use already analyzed lower part, if available.
+            // It is the user's responsibility that this data is still valid,
+            // since he passed the 'reuse' flag.
+
+            // If bsrsm meta data is already available, do nothing
+            if(info->bsrsm_lower_info != nullptr)
+            {
+                return rocsparse_status_success;
+            }
+
+            // Check for other lower analysis meta data
+            if(info->bsrilu0_info != nullptr)
+            {
+                // bsrilu0 meta data
+                info->bsrsm_lower_info = info->bsrilu0_info;
+                return rocsparse_status_success;
+            }
+            else if(info->bsric0_info != nullptr)
+            {
+                // bsric0 meta data
+                info->bsrsm_lower_info = info->bsric0_info;
+                return rocsparse_status_success;
+            }
+            else if(info->bsrsv_lower_info != nullptr)
+            {
+                // bsrsv meta data
+                info->bsrsm_lower_info = info->bsrsv_lower_info;
+                return rocsparse_status_success;
+            }
+        }
+
+        // User is explicitly asking to force a re-analysis, or no valid data has been
+        // found to be re-used
+
+        // Clear bsrsm info
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->bsrsm_lower_info));
+
+        // Create bsrsm info
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_trm_info(&info->bsrsm_lower_info));
+
+        // Perform analysis
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_trm_analysis(handle,
+                                                         trans_A,
+                                                         mb,
+                                                         nnzb,
+                                                         descr,
+                                                         bsr_val,
+                                                         bsr_row_ptr,
+                                                         bsr_col_ind,
+                                                         info->bsrsm_lower_info,
+                                                         &info->zero_pivot,
+                                                         temp_buffer));
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T, unsigned int BLOCKSIZE, bool SLEEP>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrsm_host_pointer(rocsparse_int mb,
+                            rocsparse_int nrhs,
+                            T             alpha,
+                            const rocsparse_int* __restrict__ bsr_row_ptr,
+                            const rocsparse_int* __restrict__ bsr_col_ind,
+                            const T* __restrict__ bsr_val,
+                            rocsparse_int bsr_dim,
+                            T* __restrict__ B,
+                            rocsparse_int ldb,
+                            int* __restrict__ done_array,
+                            rocsparse_int* __restrict__ map,
+                            rocsparse_int* __restrict__ zero_pivot,
+                            rocsparse_index_base idx_base,
+                            rocsparse_fill_mode  fill_mode,
+                            rocsparse_diag_type  diag_type,
+                            rocsparse_direction  dir)
+{
+    bsrsm_device<T, BLOCKSIZE, SLEEP>(mb,
+                                      nrhs,
+                                      alpha,
+                                      bsr_row_ptr,
+                                      bsr_col_ind,
+                                      bsr_val,
+                                      bsr_dim,
+                                      B,
+                                      ldb,
+                                      done_array,
+                                      map,
+                                      zero_pivot,
+                                      idx_base,
+                                      fill_mode,
+                                      diag_type,
+                                      dir);
+}
+
+template <typename T, unsigned int BLOCKSIZE, bool SLEEP>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrsm_device_pointer(rocsparse_int mb,
+                              rocsparse_int nrhs,
+                              const T*      alpha,
+                              const rocsparse_int* __restrict__ bsr_row_ptr,
+                              const rocsparse_int* __restrict__ bsr_col_ind,
+                              const T* __restrict__ bsr_val,
+                              rocsparse_int bsr_dim,
+                              T* __restrict__ B,
+                              rocsparse_int ldb,
+                              int* __restrict__ done_array,
+                              rocsparse_int* __restrict__ map,
+                              rocsparse_int* __restrict__ zero_pivot,
+                              rocsparse_index_base idx_base,
+                              rocsparse_fill_mode  fill_mode,
+                              rocsparse_diag_type  diag_type,
+                              rocsparse_direction  dir)
+{
+    bsrsm_device<T, BLOCKSIZE, SLEEP>(mb,
+                                      nrhs,
+                                      *alpha,
+                                      bsr_row_ptr,
+                                      bsr_col_ind,
+                                      bsr_val,
+                                      bsr_dim,
+                                      B,
+                                      ldb,
+                                      done_array,
+                                      map,
+                                      zero_pivot,
+                                      idx_base,
+                                      fill_mode,
+                                      diag_type,
+                                      dir);
+}
+
+#define launch_bsrsm_kernel(ptr, alpha_arg, bsize, sleep)                       \
+    hipLaunchKernelGGL((bsrsm_##ptr##_pointer<T, bsize, sleep>),                \
+                       bsrsm_blocks,                                            \
+                       bsrsm_threads,                                           \
+                       0,                                                       \
+                       stream,                                                  \
+                       mb,                                                      \
+                       nrhs,                                                    \
+                       alpha_arg,                                               \
+                       bsr_row_ptr,                                             \
+                       bsr_col_ind,                                             \
+                       bsr_val,                                                 \
+                       block_dim,                                               \
+                       Bt,                                                      \
+                       ldimB,                                                   \
+                       done_array,                                              \
+                       bsrsm->row_map,                                          \
+                       info->zero_pivot,                                        \
+                       descr->base,                                             \
+                       descr->fill_mode,                                        \
+                       descr->diag_type,                                        \
+                       dir)
+
+#define launch_bsrsm_dispatch(ptr, alpha_arg, sleep)                            \
+    if(blockdim == 64)                                                          \
+    {                                                                           \
+        launch_bsrsm_kernel(ptr, alpha_arg, 64, sleep);                         \
+    }                                                                           \
+    else if(blockdim == 128)                                                    \
+    {                                                                           \
+        launch_bsrsm_kernel(ptr, alpha_arg, 128, sleep);                        \
+    }                                                                           \
+    else if(blockdim == 256)                                                    \
+    {                                                                           \
+        launch_bsrsm_kernel(ptr, alpha_arg, 256, sleep);                        \
+    }                                                                           \
+    else if(blockdim == 512)                                                    \
+    {                                                                           \
+        launch_bsrsm_kernel(ptr, alpha_arg, 512, sleep);                        \
+    }                                                                           \
+    else if(blockdim == 1024)                                                   \
+    {                                                                           \
+        launch_bsrsm_kernel(ptr, alpha_arg, 1024, sleep);                       \
+    }                                                                           \
+    else                                                                        \
+    {                                                                           \
+        return rocsparse_status_internal_error;                                 \
+    }
+
+template <typename T>
+rocsparse_status rocsparse_bsrsm_solve_template(rocsparse_handle          handle,
+                                                rocsparse_direction       dir,
+                                                rocsparse_operation       trans_A,
+                                                rocsparse_operation       trans_B,
+                                                rocsparse_int             mb,
+                                                rocsparse_int             nrhs,
+                                                rocsparse_int             nnzb,
+                                                const T*                  alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const T*                  bsr_val,
+                                                const rocsparse_int*      bsr_row_ptr,
+                                                const rocsparse_int*      bsr_col_ind,
+                                                rocsparse_int             block_dim,
+                                                T*                        B,
+                                                rocsparse_int             ldb,
+                                                rocsparse_mat_info        info,
+                                                rocsparse_solve_policy    policy,
+                                                void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xbsrsm_solve"),
+                  dir,
+                  trans_A,
+                  trans_B,
+                  mb,
+                  nrhs,
+                  nnzb,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)bsr_val,
+                  (const void*&)bsr_row_ptr,
+                  (const void*&)bsr_col_ind,
+                  block_dim,
+                  (const void*&)B,
+                  ldb,
+                  (const void*&)info,
+                  policy,
+                  (const void*&)temp_buffer);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f bsrsm -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.mtx> ",
+                  "--blockdim",
+                  block_dim,
+                  "--alpha",
+                  *alpha);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xbsrsm_solve"),
+                  dir,
+                  trans_A,
+                  trans_B,
+                  mb,
+                  nrhs,
+                  nnzb,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)bsr_val,
+                  (const void*&)bsr_row_ptr,
+                  (const void*&)bsr_col_ind,
+                  block_dim,
+                  (const void*&)B,
+                  ldb,
+                  (const void*&)info,
+                  policy,
+                  (const void*&)temp_buffer);
+    }
+
+    // Check direction
+    if(dir != rocsparse_direction_row && dir != rocsparse_direction_column)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check operation type
+    if(trans_A != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    if(trans_B != rocsparse_operation_none && trans_B != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(mb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nrhs < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnzb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(block_dim < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(mb == 0 || nrhs == 0 || nnzb == 0 || block_dim == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(bsr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check leading dimension of B
+    if(ldb < ((trans_B == rocsparse_operation_none) ? mb * block_dim : nrhs))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    rocsparse_trm_info bsrsm = (descr->fill_mode == rocsparse_fill_mode_upper)
+                                   ? info->bsrsm_upper_info
+                                   : info->bsrsm_lower_info;
+
+    // Check for analysis call
+    if(bsrsm == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    ptr += 256;
+
+    // Each thread block performs at most blockdim columns of the rhs matrix
+    int blockdim = rocsparse_bsrsm_blockdim(nrhs);
+    int narrays  = (nrhs - 1) / blockdim + 1;
+
+    // done array
+    int* done_array = reinterpret_cast<int*>(ptr);
+    ptr += sizeof(int) * ((mb * narrays - 1) / 256 + 1) * 256;
+
+    // Temporary array to store transpose of B
+    T* Bt = (trans_B == rocsparse_operation_none) ? reinterpret_cast<T*>(ptr) : B;
+
+    // Initialize buffers
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(done_array, 0, sizeof(int) * mb * narrays, stream));
+
+    // If diag type is unit, re-initialize zero pivot to remove structural zeros
+    if(descr->diag_type == rocsparse_diag_type_unit)
+    {
+        hipLaunchKernelGGL((csrsv_init_zero_pivot_kernel<rocsparse_int>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           info->zero_pivot,
+                           std::numeric_limits<rocsparse_int>::max());
+    }
+
+    // Number of rows of B
+    rocsparse_int m = mb * block_dim;
+
+    // Leading dimension
+    rocsparse_int ldimB = ldb;
+
+    // Transpose B if B is not transposed yet, such that all right-hand sides of a
+    // row are stored contiguously
+    if(trans_B == rocsparse_operation_none)
+    {
+        // Leading dimension for transposed B
+        ldimB = nrhs;
+
+#define BSRSM_DIM_X 32
+#define BSRSM_DIM_Y 8
+        dim3 bsrsm_blocks((m - 1) / BSRSM_DIM_X + 1);
+        dim3 bsrsm_threads(BSRSM_DIM_X * BSRSM_DIM_Y);
+
+        hipLaunchKernelGGL((csrsm_transpose<T, BSRSM_DIM_X, BSRSM_DIM_Y>),
+                           bsrsm_blocks,
+                           bsrsm_threads,
+                           0,
+                           stream,
+                           m,
+                           nrhs,
+                           B,
+                           ldb,
+                           Bt,
+                           ldimB);
+#undef BSRSM_DIM_X
+#undef BSRSM_DIM_Y
+    }
+
+    dim3 bsrsm_blocks(narrays * mb);
+    dim3 bsrsm_threads(blockdim);
+
+    // Determine gcnArch and ASIC revision
+    bool sleep = (handle->properties.gcnArch == 908 && handle->asic_rev < 2);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        if(sleep)
+        {
+            launch_bsrsm_dispatch(device, alpha, true);
+        }
+        else
+        {
+            launch_bsrsm_dispatch(device, alpha, false);
+        }
+    }
+    else
+    {
+        if(sleep)
+        {
+            launch_bsrsm_dispatch(host, *alpha, true);
+        }
+        else
+        {
+            launch_bsrsm_dispatch(host, *alpha, false);
+        }
+    }
+
+    // Transpose B back if B was not initially transposed
+    if(trans_B == rocsparse_operation_none)
+    {
+#define BSRSM_DIM_X 32
+#define BSRSM_DIM_Y 8
+        dim3 bsrsm_blocks((m - 1) / BSRSM_DIM_X + 1);
+        dim3 bsrsm_threads(BSRSM_DIM_X * BSRSM_DIM_Y);
+
+        hipLaunchKernelGGL((csrsm_transpose_back<T, BSRSM_DIM_X, BSRSM_DIM_Y>),
+                           bsrsm_blocks,
+                           bsrsm_threads,
+                           0,
+                           stream,
+                           m,
+                           nrhs,
+                           Bt,
+                           ldimB,
+                           B,
+                           ldb);
+#undef BSRSM_DIM_X
+#undef BSRSM_DIM_Y
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_BSRSM_HPP
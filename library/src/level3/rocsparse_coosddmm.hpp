@@ -0,0 +1,279 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROCSPARSE_COOSDDMM_HPP
+#define ROCSPARSE_COOSDDMM_HPP
+
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "rocsparse_csrsddmm.hpp"
+#include "sddmm_device.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void coosddmm_kernel_host_pointer(rocsparse_int   nnz,
+                                      rocsparse_int   k,
+                                      rocsparse_order order_A,
+                                      rocsparse_order order_B,
+                                      T               alpha,
+                                      const T* __restrict__ A,
+                                      rocsparse_int lda,
+                                      const T* __restrict__ B,
+                                      rocsparse_int ldb,
+                                      T             beta,
+                                      T* __restrict__ coo_val,
+                                      const rocsparse_int* __restrict__ coo_row_ind,
+                                      const rocsparse_int* __restrict__ coo_col_ind,
+                                      rocsparse_index_base base)
+{
+    coosddmm_device<T, BLOCKSIZE, WFSIZE>(nnz,
+                                          k,
+                                          order_A,
+                                          order_B,
+                                          alpha,
+                                          A,
+                                          lda,
+                                          B,
+                                          ldb,
+                                          beta,
+                                          coo_val,
+                                          coo_row_ind,
+                                          coo_col_ind,
+                                          base);
+}
+
+template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void coosddmm_kernel_device_pointer(rocsparse_int   nnz,
+                                        rocsparse_int   k,
+                                        rocsparse_order order_A,
+                                        rocsparse_order order_B,
+                                        const T*        alpha,
+                                        const T* __restrict__ A,
+                                        rocsparse_int lda,
+                                        const T* __restrict__ B,
+                                        rocsparse_int ldb,
+                                        const T*      beta,
+                                        T* __restrict__ coo_val,
+                                        const rocsparse_int* __restrict__ coo_row_ind,
+                                        const rocsparse_int* __restrict__ coo_col_ind,
+                                        rocsparse_index_base base)
+{
+    if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+    {
+        return;
+    }
+
+    coosddmm_device<T, BLOCKSIZE, WFSIZE>(nnz,
+                                          k,
+                                          order_A,
+                                          order_B,
+                                          *alpha,
+                                          A,
+                                          lda,
+                                          B,
+                                          ldb,
+                                          *beta,
+                                          coo_val,
+                                          coo_row_ind,
+                                          coo_col_ind,
+                                          base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_coosddmm_template(rocsparse_handle          handle,
+                                             rocsparse_order           order_A,
+                                             rocsparse_order           order_B,
+                                             rocsparse_int             m,
+                                             rocsparse_int             n,
+                                             rocsparse_int             k,
+                                             const T*                  alpha,
+                                             const T*                  A,
+                                             rocsparse_int             lda,
+                                             const T*                  B,
+                                             rocsparse_int             ldb,
+                                             const T*                  beta,
+                                             const rocsparse_mat_descr descr,
+                                             rocsparse_int             nnz,
+                                             T*                        coo_val,
+                                             const rocsparse_int*      coo_row_ind,
+                                             const rocsparse_int*      coo_col_ind)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcoosddmm"),
+                  order_A,
+                  order_B,
+                  m,
+                  n,
+                  k,
+                  *alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)B,
+                  ldb,
+                  *beta,
+                  (const void*&)descr,
+                  nnz,
+                  (const void*&)coo_val,
+                  (const void*&)coo_row_ind,
+                  (const void*&)coo_col_ind);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcoosddmm"),
+                  order_A,
+                  order_B,
+                  m,
+                  n,
+                  k,
+                  (const void*&)alpha,
+                  (const void*&)A,
+                  lda,
+                  (const void*&)B,
+                  ldb,
+                  (const void*&)beta,
+                  (const void*&)descr,
+                  nnz,
+                  (const void*&)coo_val,
+                  (const void*&)coo_row_ind,
+                  (const void*&)coo_col_ind);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || k < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check dense matrices
+    RETURN_IF_ROCSPARSE_ERROR(sddmm_check_dense(order_A, order_B, m, n, k, lda, ldb));
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha == nullptr || beta == nullptr || coo_val == nullptr || coo_row_ind == nullptr
+       || coo_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // A and B are only required if k != 0
+    if(k != 0 && (A == nullptr || B == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_int wfsize = sddmm_wfsize(k, handle->wavefront_size);
+
+    rocsparse_dispatch_value(wfsize, sddmm_wfsizes{}, [&](auto wf) {
+        constexpr unsigned int WFSIZE = decltype(wf)::value;
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((coosddmm_kernel_device_pointer<T, SDDMM_DIM, WFSIZE>),
+                               dim3((nnz - 1) / (SDDMM_DIM / WFSIZE) + 1),
+                               dim3(SDDMM_DIM),
+                               0,
+                               stream,
+                               nnz,
+                               k,
+                               order_A,
+                               order_B,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               coo_val,
+                               coo_row_ind,
+                               coo_col_ind,
+                               descr->base);
+        }
+        else if(*alpha != static_cast<T>(0) || *beta != static_cast<T>(1))
+        {
+            hipLaunchKernelGGL((coosddmm_kernel_host_pointer<T, SDDMM_DIM, WFSIZE>),
+                               dim3((nnz - 1) / (SDDMM_DIM / WFSIZE) + 1),
+                               dim3(SDDMM_DIM),
+                               0,
+                               stream,
+                               nnz,
+                               k,
+                               order_A,
+                               order_B,
+                               *alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               *beta,
+                               coo_val,
+                               coo_row_ind,
+                               coo_col_ind,
+                               descr->base);
+        }
+    });
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_COOSDDMM_HPP
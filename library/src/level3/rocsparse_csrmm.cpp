@@ -52,6 +52,8 @@ extern "C" rocsparse_status rocsparse_scsrmm(rocsparse_handle          handle,
     return rocsparse_csrmm_template(handle,
                                     trans_A,
                                     trans_B,
+                                    rocsparse_order_column,
+                                    rocsparse_order_column,
                                     m,
                                     n,
                                     k,
@@ -61,6 +63,7 @@ extern "C" rocsparse_status rocsparse_scsrmm(rocsparse_handle          handle,
                                     csr_val,
                                     csr_row_ptr,
                                     csr_col_ind,
+                                    nullptr,
                                     B,
                                     ldb,
                                     beta,
@@ -89,6 +92,8 @@ extern "C" rocsparse_status rocsparse_dcsrmm(rocsparse_handle          handle,
     return rocsparse_csrmm_template(handle,
                                     trans_A,
                                     trans_B,
+                                    rocsparse_order_column,
+                                    rocsparse_order_column,
                                     m,
                                     n,
                                     k,
@@ -98,6 +103,7 @@ extern "C" rocsparse_status rocsparse_dcsrmm(rocsparse_handle          handle,
                                     csr_val,
                                     csr_row_ptr,
                                     csr_col_ind,
+                                    nullptr,
                                     B,
                                     ldb,
                                     beta,
@@ -126,6 +132,8 @@ extern "C" rocsparse_status rocsparse_ccsrmm(rocsparse_handle               hand
     return rocsparse_csrmm_template(handle,
                                     trans_A,
                                     trans_B,
+                                    rocsparse_order_column,
+                                    rocsparse_order_column,
                                     m,
                                     n,
                                     k,
@@ -135,6 +143,7 @@ extern "C" rocsparse_status rocsparse_ccsrmm(rocsparse_handle               hand
                                     csr_val,
                                     csr_row_ptr,
                                     csr_col_ind,
+                                    nullptr,
                                     B,
                                     ldb,
                                     beta,
@@ -163,6 +172,8 @@ extern "C" rocsparse_status rocsparse_zcsrmm(rocsparse_handle                han
     return rocsparse_csrmm_template(handle,
                                     trans_A,
                                     trans_B,
+                                    rocsparse_order_column,
+                                    rocsparse_order_column,
                                     m,
                                     n,
                                     k,
@@ -172,6 +183,342 @@ extern "C" rocsparse_status rocsparse_zcsrmm(rocsparse_handle                han
                                     csr_val,
                                     csr_row_ptr,
                                     csr_col_ind,
+                                    nullptr,
+                                    B,
+                                    ldb,
+                                    beta,
+                                    C,
+                                    ldc);
+}
+
+extern "C" rocsparse_status rocsparse_shcsrmm(rocsparse_handle          handle,
+                                              rocsparse_operation       trans_A,
+                                              rocsparse_operation       trans_B,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             k,
+                                              rocsparse_int             nnz,
+                                              const float*              alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const rocsparse_half*     csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              const float*              B,
+                                              rocsparse_int             ldb,
+                                              const float*              beta,
+                                              float*                    C,
+                                              rocsparse_int             ldc)
+{
+    return rocsparse_csrmm_template(handle,
+                                    trans_A,
+                                    trans_B,
+                                    rocsparse_order_column,
+                                    rocsparse_order_column,
+                                    m,
+                                    n,
+                                    k,
+                                    nnz,
+                                    alpha,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    nullptr,
+                                    B,
+                                    ldb,
+                                    beta,
+                                    C,
+                                    ldc);
+}
+
+extern "C" rocsparse_status rocsparse_sbcsrmm(rocsparse_handle          handle,
+                                              rocsparse_operation       trans_A,
+                                              rocsparse_operation       trans_B,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             k,
+                                              rocsparse_int             nnz,
+                                              const float*              alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const rocsparse_bfloat16* csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              const float*              B,
+                                              rocsparse_int             ldb,
+                                              const float*              beta,
+                                              float*                    C,
+                                              rocsparse_int             ldc)
+{
+    return rocsparse_csrmm_template(handle,
+                                    trans_A,
+                                    trans_B,
+                                    rocsparse_order_column,
+                                    rocsparse_order_column,
+                                    m,
+                                    n,
+                                    k,
+                                    nnz,
+                                    alpha,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    nullptr,
+                                    B,
+                                    ldb,
+                                    beta,
+                                    C,
+                                    ldc);
+}
+
+extern "C" rocsparse_status rocsparse_scsrmm_ex_analysis(rocsparse_handle          handle,
+                                                         rocsparse_operation       trans_A,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             k,
+                                                         rocsparse_int             nnz,
+                                                         const rocsparse_mat_descr descr,
+                                                         const float*              csr_val,
+                                                         const rocsparse_int*      csr_row_ptr,
+                                                         const rocsparse_int*      csr_col_ind,
+                                                         rocsparse_mat_info        info)
+{
+    return rocsparse_csrmm_ex_analysis_template(
+        handle, trans_A, m, k, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmm_ex_analysis(rocsparse_handle          handle,
+                                                         rocsparse_operation       trans_A,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             k,
+                                                         rocsparse_int             nnz,
+                                                         const rocsparse_mat_descr descr,
+                                                         const double*             csr_val,
+                                                         const rocsparse_int*      csr_row_ptr,
+                                                         const rocsparse_int*      csr_col_ind,
+                                                         rocsparse_mat_info        info)
+{
+    return rocsparse_csrmm_ex_analysis_template(
+        handle, trans_A, m, k, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+extern "C" rocsparse_status rocsparse_ccsrmm_ex_analysis(rocsparse_handle               handle,
+                                                         rocsparse_operation            trans_A,
+                                                         rocsparse_int                  m,
+                                                         rocsparse_int                  k,
+                                                         rocsparse_int                  nnz,
+                                                         const rocsparse_mat_descr      descr,
+                                                         const rocsparse_float_complex* csr_val,
+                                                         const rocsparse_int*           csr_row_ptr,
+                                                         const rocsparse_int*           csr_col_ind,
+                                                         rocsparse_mat_info             info)
+{
+    return rocsparse_csrmm_ex_analysis_template(
+        handle, trans_A, m, k, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrmm_ex_analysis(rocsparse_handle                handle,
+                                                         rocsparse_operation             trans_A,
+                                                         rocsparse_int                   m,
+                                                         rocsparse_int                   k,
+                                                         rocsparse_int                   nnz,
+                                                         const rocsparse_mat_descr       descr,
+                                                         const rocsparse_double_complex* csr_val,
+                                                         const rocsparse_int*            csr_row_ptr,
+                                                         const rocsparse_int*            csr_col_ind,
+                                                         rocsparse_mat_info              info)
+{
+    return rocsparse_csrmm_ex_analysis_template(
+        handle, trans_A, m, k, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+extern "C" rocsparse_status rocsparse_csrmm_ex_clear(rocsparse_handle   handle,
+                                                     rocsparse_mat_info info)
+{
+    // Check for valid handle and matrix info
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrmm_ex_clear", (const void*&)info);
+
+    // Destroy csrmm info struct
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_bsrmv_info(info->csrmm_info));
+    info->csrmm_info = nullptr;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsrmm_ex(rocsparse_handle          handle,
+                                                rocsparse_operation       trans_A,
+                                                rocsparse_operation       trans_B,
+                                                rocsparse_order           order_B,
+                                                rocsparse_order           order_C,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                rocsparse_int             k,
+                                                rocsparse_int             nnz,
+                                                const float*              alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                const float*              B,
+                                                rocsparse_int             ldb,
+                                                const float*              beta,
+                                                float*                    C,
+                                                rocsparse_int             ldc)
+{
+    return rocsparse_csrmm_template(handle,
+                                    trans_A,
+                                    trans_B,
+                                    order_B,
+                                    order_C,
+                                    m,
+                                    n,
+                                    k,
+                                    nnz,
+                                    alpha,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    info,
+                                    B,
+                                    ldb,
+                                    beta,
+                                    C,
+                                    ldc);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmm_ex(rocsparse_handle          handle,
+                                                rocsparse_operation       trans_A,
+                                                rocsparse_operation       trans_B,
+                                                rocsparse_order           order_B,
+                                                rocsparse_order           order_C,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                rocsparse_int             k,
+                                                rocsparse_int             nnz,
+                                                const double*             alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                const double*             B,
+                                                rocsparse_int             ldb,
+                                                const double*             beta,
+                                                double*                   C,
+                                                rocsparse_int             ldc)
+{
+    return rocsparse_csrmm_template(handle,
+                                    trans_A,
+                                    trans_B,
+                                    order_B,
+                                    order_C,
+                                    m,
+                                    n,
+                                    k,
+                                    nnz,
+                                    alpha,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    info,
+                                    B,
+                                    ldb,
+                                    beta,
+                                    C,
+                                    ldc);
+}
+
+extern "C" rocsparse_status rocsparse_ccsrmm_ex(rocsparse_handle               handle,
+                                                rocsparse_operation            trans_A,
+                                                rocsparse_operation            trans_B,
+                                                rocsparse_order                order_B,
+                                                rocsparse_order                order_C,
+                                                rocsparse_int                  m,
+                                                rocsparse_int                  n,
+                                                rocsparse_int                  k,
+                                                rocsparse_int                  nnz,
+                                                const rocsparse_float_complex* alpha,
+                                                const rocsparse_mat_descr      descr,
+                                                const rocsparse_float_complex* csr_val,
+                                                const rocsparse_int*           csr_row_ptr,
+                                                const rocsparse_int*           csr_col_ind,
+                                                rocsparse_mat_info             info,
+                                                const rocsparse_float_complex* B,
+                                                rocsparse_int                  ldb,
+                                                const rocsparse_float_complex* beta,
+                                                rocsparse_float_complex*       C,
+                                                rocsparse_int                  ldc)
+{
+    return rocsparse_csrmm_template(handle,
+                                    trans_A,
+                                    trans_B,
+                                    order_B,
+                                    order_C,
+                                    m,
+                                    n,
+                                    k,
+                                    nnz,
+                                    alpha,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    info,
+                                    B,
+                                    ldb,
+                                    beta,
+                                    C,
+                                    ldc);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrmm_ex(rocsparse_handle                handle,
+                                                rocsparse_operation             trans_A,
+                                                rocsparse_operation             trans_B,
+                                                rocsparse_order                 order_B,
+                                                rocsparse_order                 order_C,
+                                                rocsparse_int                   m,
+                                                rocsparse_int                   n,
+                                                rocsparse_int                   k,
+                                                rocsparse_int                   nnz,
+                                                const rocsparse_double_complex* alpha,
+                                                const rocsparse_mat_descr       descr,
+                                                const rocsparse_double_complex* csr_val,
+                                                const rocsparse_int*            csr_row_ptr,
+                                                const rocsparse_int*            csr_col_ind,
+                                                rocsparse_mat_info              info,
+                                                const rocsparse_double_complex* B,
+                                                rocsparse_int                   ldb,
+                                                const rocsparse_double_complex* beta,
+                                                rocsparse_double_complex*       C,
+                                                rocsparse_int                   ldc)
+{
+    return rocsparse_csrmm_template(handle,
+                                    trans_A,
+                                    trans_B,
+                                    order_B,
+                                    order_C,
+                                    m,
+                                    n,
+                                    k,
+                                    nnz,
+                                    alpha,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    info,
                                     B,
                                     ldb,
                                     beta,
@@ -25,6 +25,7 @@
 #ifndef ROCSPARSE_CSRMM_HPP
 #define ROCSPARSE_CSRMM_HPP
 
+#include "../level2/rocsparse_bsrmv.hpp"
 #include "csrmm_device.h"
 #include "handle.h"
 #include "rocsparse.h"
@@ -32,7 +33,16 @@
 
 #include <hip/hip_runtime.h>
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+#define CSRMMNN_DIM 256
+#define CSRMMNT_DIM 256
+
+// Segment sizes of the csrmmnt kernels
+using csrmm_wfsizes = rocsparse_value_list<8, 16, 32, 64>;
+
+// Number of columns of C that are accumulated per lane of the csrmmnt kernel
+using csrmmnt_loops = rocsparse_value_list<1, 2, 4>;
+
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrmmnn_kernel_host_pointer(rocsparse_int m,
                                      rocsparse_int n,
@@ -41,19 +51,33 @@ __launch_bounds__(BLOCKSIZE) __global__
                                      T             alpha,
                                      const rocsparse_int* __restrict__ csr_row_ptr,
                                      const rocsparse_int* __restrict__ csr_col_ind,
-                                     const T* __restrict__ csr_val,
+                                     const U* __restrict__ csr_val,
                                      const T* __restrict__ B,
                                      rocsparse_int ldb,
                                      T             beta,
                                      T* __restrict__ C,
                                      rocsparse_int        ldc,
+                                     rocsparse_order      order_C,
                                      rocsparse_index_base idx_base)
 {
-    csrmmnn_general_device<T, BLOCKSIZE, WF_SIZE>(
-        m, n, k, nnz, alpha, csr_row_ptr, csr_col_ind, csr_val, B, ldb, beta, C, ldc, idx_base);
+    csrmmnn_general_device<T, U, BLOCKSIZE, WF_SIZE>(m,
+                                                     n,
+                                                     k,
+                                                     nnz,
+                                                     alpha,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     csr_val,
+                                                     B,
+                                                     ldb,
+                                                     beta,
+                                                     C,
+                                                     ldc,
+                                                     order_C,
+                                                     idx_base);
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrmmnn_kernel_device_pointer(rocsparse_int m,
                                        rocsparse_int n,
@@ -62,12 +86,13 @@ __launch_bounds__(BLOCKSIZE) __global__
                                        const T*      alpha,
                                        const rocsparse_int* __restrict__ csr_row_ptr,
                                        const rocsparse_int* __restrict__ csr_col_ind,
-                                       const T* __restrict__ csr_val,
+                                       const U* __restrict__ csr_val,
                                        const T* __restrict__ B,
                                        rocsparse_int ldb,
                                        const T*      beta,
                                        T* __restrict__ C,
                                        rocsparse_int        ldc,
+                                       rocsparse_order      order_C,
                                        rocsparse_index_base idx_base)
 {
     if(*alpha == 0.0 && *beta == 1.0)
@@ -75,11 +100,24 @@ __launch_bounds__(BLOCKSIZE) __global__
         return;
     }
 
-    csrmmnn_general_device<T, BLOCKSIZE, WF_SIZE>(
-        m, n, k, nnz, *alpha, csr_row_ptr, csr_col_ind, csr_val, B, ldb, *beta, C, ldc, idx_base);
+    csrmmnn_general_device<T, U, BLOCKSIZE, WF_SIZE>(m,
+                                                     n,
+                                                     k,
+                                                     nnz,
+                                                     *alpha,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     csr_val,
+                                                     B,
+                                                     ldb,
+                                                     *beta,
+                                                     C,
+                                                     ldc,
+                                                     order_C,
+                                                     idx_base);
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WF_SIZE, unsigned int LOOPS>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrmmnt_kernel_host_pointer(rocsparse_int offset,
                                      rocsparse_int ncol,
@@ -90,33 +128,35 @@ __launch_bounds__(BLOCKSIZE) __global__
                                      T             alpha,
                                      const rocsparse_int* __restrict__ csr_row_ptr,
                                      const rocsparse_int* __restrict__ csr_col_ind,
-                                     const T* __restrict__ csr_val,
+                                     const U* __restrict__ csr_val,
                                      const T* __restrict__ B,
                                      rocsparse_int ldb,
                                      T             beta,
                                      T* __restrict__ C,
                                      rocsparse_int        ldc,
+                                     rocsparse_order      order_C,
                                      rocsparse_index_base idx_base)
 {
-    csrmmnt_general_device<T, BLOCKSIZE, WF_SIZE>(offset,
-                                                  ncol,
-                                                  m,
-                                                  n,
-                                                  k,
-                                                  nnz,
-                                                  alpha,
-                                                  csr_row_ptr,
-                                                  csr_col_ind,
-                                                  csr_val,
-                                                  B,
-                                                  ldb,
-                                                  beta,
-                                                  C,
-                                                  ldc,
-                                                  idx_base);
+    csrmmnt_general_device<T, U, BLOCKSIZE, WF_SIZE, LOOPS>(offset,
+                                                            ncol,
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            nnz,
+                                                            alpha,
+                                                            csr_row_ptr,
+                                                            csr_col_ind,
+                                                            csr_val,
+                                                            B,
+                                                            ldb,
+                                                            beta,
+                                                            C,
+                                                            ldc,
+                                                            order_C,
+                                                            idx_base);
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WF_SIZE, unsigned int LOOPS>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrmmnt_kernel_device_pointer(rocsparse_int offset,
                                        rocsparse_int ncol,
@@ -127,12 +167,13 @@ __launch_bounds__(BLOCKSIZE) __global__
                                        const T*      alpha,
                                        const rocsparse_int* __restrict__ csr_row_ptr,
                                        const rocsparse_int* __restrict__ csr_col_ind,
-                                       const T* __restrict__ csr_val,
+                                       const U* __restrict__ csr_val,
                                        const T* __restrict__ B,
                                        rocsparse_int ldb,
                                        const T*      beta,
                                        T* __restrict__ C,
                                        rocsparse_int        ldc,
+                                       rocsparse_order      order_C,
                                        rocsparse_index_base idx_base)
 {
     if(*alpha == 0.0 && *beta == 1.0)
@@ -140,37 +181,54 @@ __launch_bounds__(BLOCKSIZE) __global__
         return;
     }
 
-    csrmmnt_general_device<T, BLOCKSIZE, WF_SIZE>(offset,
-                                                  ncol,
-                                                  m,
-                                                  n,
-                                                  k,
-                                                  nnz,
-                                                  *alpha,
-                                                  csr_row_ptr,
-                                                  csr_col_ind,
-                                                  csr_val,
-                                                  B,
-                                                  ldb,
-                                                  *beta,
-                                                  C,
-                                                  ldc,
-                                                  idx_base);
+    csrmmnt_general_device<T, U, BLOCKSIZE, WF_SIZE, LOOPS>(offset,
+                                                            ncol,
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            nnz,
+                                                            *alpha,
+                                                            csr_row_ptr,
+                                                            csr_col_ind,
+                                                            csr_val,
+                                                            B,
+                                                            ldb,
+                                                            *beta,
+                                                            C,
+                                                            ldc,
+                                                            order_C,
+                                                            idx_base);
 }
 
-template <typename T>
+// Smallest segment size that covers n columns, or the wavefront size
+static inline rocsparse_int csrmm_wfsize(rocsparse_int n, rocsparse_int wavefront_size)
+{
+    rocsparse_int wfsize = 8;
+
+    while(wfsize < n && wfsize < wavefront_size)
+    {
+        wfsize *= 2;
+    }
+
+    return wfsize;
+}
+
+template <typename T, typename U>
 rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                                           rocsparse_operation       trans_A,
                                           rocsparse_operation       trans_B,
+                                          rocsparse_order           order_B,
+                                          rocsparse_order           order_C,
                                           rocsparse_int             m,
                                           rocsparse_int             n,
                                           rocsparse_int             k,
                                           rocsparse_int             nnz,
                                           const T*                  alpha,
                                           const rocsparse_mat_descr descr,
-                                          const T*                  csr_val,
+                                          const U*                  csr_val,
                                           const rocsparse_int*      csr_row_ptr,
                                           const rocsparse_int*      csr_col_ind,
+                                          rocsparse_mat_info        info,
                                           const T*                  B,
                                           rocsparse_int             ldb,
                                           const T*                  beta,
@@ -191,9 +249,11 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrmm"),
+                  replaceXY<T, U>("rocsparse_XYcsrmm"),
                   trans_A,
                   trans_B,
+                  order_B,
+                  order_C,
                   m,
                   n,
                   k,
@@ -203,6 +263,7 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                   (const void*&)csr_val,
                   (const void*&)csr_row_ptr,
                   (const void*&)csr_col_ind,
+                  (const void*&)info,
                   (const void*&)B,
                   ldb,
                   *beta,
@@ -212,9 +273,11 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
     else
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrmm"),
+                  replaceXY<T, U>("rocsparse_XYcsrmm"),
                   trans_A,
                   trans_B,
+                  order_B,
+                  order_C,
                   m,
                   n,
                   k,
@@ -224,6 +287,7 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                   (const void*&)csr_val,
                   (const void*&)csr_row_ptr,
                   (const void*&)csr_col_ind,
+                  (const void*&)info,
                   (const void*&)B,
                   ldb,
                   (const void*&)beta,
@@ -242,6 +306,16 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
         return rocsparse_status_not_implemented;
     }
 
+    // Check storage order of B and C
+    if(order_B != rocsparse_order_row && order_B != rocsparse_order_column)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(order_C != rocsparse_order_row && order_C != rocsparse_order_column)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
     // Check sizes
     if(m < 0)
     {
@@ -296,96 +370,250 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Conjugate transposed B is not supported
+    if(trans_B == rocsparse_operation_conjugate_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // op(B) is stored row by row, if either B is transposed or stored in row-major order
+    bool row_major_B = (trans_B == rocsparse_operation_none) == (order_B == rocsparse_order_row);
+
+    // Number of rows of op(B) and C
+    rocsparse_int nrow_B = (trans_A == rocsparse_operation_none) ? k : m;
+    rocsparse_int nrow_C = (trans_A == rocsparse_operation_none) ? m : k;
+
     // Check leading dimension of B
     rocsparse_int one = 1;
-    if(trans_B == rocsparse_operation_none)
+    if(ldb < std::max(one, row_major_B ? n : nrow_B))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check leading dimension of C
+    if(ldc < std::max(one, (order_C == rocsparse_order_column) ? nrow_C : n))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Transposed A is processed by the non-transposed kernels on the transpose of A,
+    // which has been computed by csrmm_ex_analysis
+    rocsparse_bsrmv_info csrmm_info = nullptr;
+
+    if(trans_A != rocsparse_operation_none)
     {
-        if(trans_A == rocsparse_operation_none)
+        if(info == nullptr)
         {
-            if(ldb < std::max(one, k))
-            {
-                return rocsparse_status_invalid_size;
-            }
+            return rocsparse_status_not_implemented;
         }
-        else
+
+        csrmm_info = info->csrmm_info;
+
+        // Check if info matches current matrix and options
+        if(csrmm_info == nullptr)
         {
-            if(ldb < std::max(one, m))
-            {
-                return rocsparse_status_invalid_size;
-            }
+            return rocsparse_status_invalid_pointer;
         }
-    }
-    else
-    {
-        if(ldb < std::max(one, n))
+        else if(csrmm_info->trans != trans_A)
+        {
+            return rocsparse_status_invalid_value;
+        }
+        else if(csrmm_info->mb != m)
         {
             return rocsparse_status_invalid_size;
         }
-    }
-
-    // Check leading dimension of C
-    if(trans_A == rocsparse_operation_none)
-    {
-        if(ldc < std::max(one, m))
+        else if(csrmm_info->nb != k)
         {
             return rocsparse_status_invalid_size;
         }
-    }
-    else
-    {
-        if(ldc < std::max(one, k))
+        else if(csrmm_info->nnzb != nnz)
         {
             return rocsparse_status_invalid_size;
         }
+        else if(csrmm_info->descr != descr)
+        {
+            return rocsparse_status_invalid_value;
+        }
+        else if(csrmm_info->bsr_val != csr_val)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(csrmm_info->bsr_row_ptr != csr_row_ptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(csrmm_info->bsr_col_ind != csr_col_ind)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+    }
+
+    // Quick return
+    if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == 0.0 && *beta == 1.0)
+    {
+        return rocsparse_status_success;
+    }
+
+    if(trans_A != rocsparse_operation_none)
+    {
+        // op(A) is the k x m matrix given by the CSC arrays of A
+        return rocsparse_csrmm_template(handle,
+                                        rocsparse_operation_none,
+                                        trans_B,
+                                        order_B,
+                                        order_C,
+                                        k,
+                                        n,
+                                        m,
+                                        nnz,
+                                        alpha,
+                                        descr,
+                                        static_cast<const U*>(csrmm_info->trans_val),
+                                        csrmm_info->trans_col_ptr,
+                                        csrmm_info->trans_row_ind,
+                                        nullptr,
+                                        B,
+                                        ldb,
+                                        beta,
+                                        C,
+                                        ldc);
     }
 
     // Stream
     hipStream_t stream = handle->stream;
 
-    // Run different csrmv kernels
-    if(trans_A == rocsparse_operation_none)
+    // Run different csrmm kernels
+    if(!row_major_B)
     {
-        if(trans_B == rocsparse_operation_none)
-        {
-#define CSRMMNN_DIM 256
 #define SUB_WF_SIZE 8
-            dim3 csrmmnn_blocks((SUB_WF_SIZE * m - 1) / CSRMMNN_DIM + 1, (n - 1) / SUB_WF_SIZE + 1);
-            dim3 csrmmnn_threads(CSRMMNN_DIM);
+        dim3 csrmmnn_blocks((SUB_WF_SIZE * m - 1) / CSRMMNN_DIM + 1, (n - 1) / SUB_WF_SIZE + 1);
+        dim3 csrmmnn_threads(CSRMMNN_DIM);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((csrmmnn_kernel_device_pointer<T, U, CSRMMNN_DIM, SUB_WF_SIZE>),
+                               csrmmnn_blocks,
+                               csrmmnn_threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               k,
+                               nnz,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               B,
+                               ldb,
+                               beta,
+                               C,
+                               ldc,
+                               order_C,
+                               descr->base);
+        }
+        else
+        {
+            hipLaunchKernelGGL((csrmmnn_kernel_host_pointer<T, U, CSRMMNN_DIM, SUB_WF_SIZE>),
+                               csrmmnn_blocks,
+                               csrmmnn_threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               k,
+                               nnz,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               B,
+                               ldb,
+                               *beta,
+                               C,
+                               ldc,
+                               order_C,
+                               descr->base);
+        }
+#undef SUB_WF_SIZE
+    }
+    else
+    {
+        // Computation is split into two parts, main and remainder
+        // First step: Compute main, which is the maximum number of
+        //             columns of B that is dividable by the next
+        //             power of two of the average row nnz of A.
+        // Second step: Compute remainder, which is the remaining
+        //              columns of B.
+
+        // Average nnz per row of A
+        rocsparse_int avg_row_nnz = (nnz - 1) / m + 1;
+
+        // Segment size of the main part, depending on row nnz of A
+        rocsparse_int wfsize_main = (avg_row_nnz < 16)   ? 8
+                                    : (avg_row_nnz < 32) ? 16
+                                    : (avg_row_nnz < 64 || handle->wavefront_size == 32)
+                                        ? 32
+                                        : 64;
+
+        if(wfsize_main > handle->wavefront_size)
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+
+        rocsparse_int remainder = n % wfsize_main;
+        rocsparse_int main      = n - remainder;
+
+        // Segment size of the remainder
+        rocsparse_int wfsize_rem = csrmm_wfsize(remainder, handle->wavefront_size);
+
+        if(remainder > wfsize_rem)
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+
+        auto launch = [&](auto w, auto l, rocsparse_int offset, rocsparse_int ncol) {
+            constexpr unsigned int WF_SIZE = decltype(w)::value;
+            constexpr unsigned int LOOPS   = decltype(l)::value;
+
+            dim3 csrmmnt_blocks((WF_SIZE * m - 1) / CSRMMNT_DIM + 1);
+            dim3 csrmmnt_threads(CSRMMNT_DIM);
 
             if(handle->pointer_mode == rocsparse_pointer_mode_device)
             {
-                hipLaunchKernelGGL((csrmmnn_kernel_device_pointer<T, CSRMMNN_DIM, SUB_WF_SIZE>),
-                                   csrmmnn_blocks,
-                                   csrmmnn_threads,
-                                   0,
-                                   stream,
-                                   m,
-                                   n,
-                                   k,
-                                   nnz,
-                                   alpha,
-                                   csr_row_ptr,
-                                   csr_col_ind,
-                                   csr_val,
-                                   B,
-                                   ldb,
-                                   beta,
-                                   C,
-                                   ldc,
-                                   descr->base);
+                hipLaunchKernelGGL(
+                    (csrmmnt_kernel_device_pointer<T, U, CSRMMNT_DIM, WF_SIZE, LOOPS>),
+                    csrmmnt_blocks,
+                    csrmmnt_threads,
+                    0,
+                    stream,
+                    offset,
+                    ncol,
+                    m,
+                    n,
+                    k,
+                    nnz,
+                    alpha,
+                    csr_row_ptr,
+                    csr_col_ind,
+                    csr_val,
+                    B,
+                    ldb,
+                    beta,
+                    C,
+                    ldc,
+                    order_C,
+                    descr->base);
             }
             else
             {
-                if(*alpha == 0.0 && *beta == 1.0)
-                {
-                    return rocsparse_status_success;
-                }
-
-                hipLaunchKernelGGL((csrmmnn_kernel_host_pointer<T, CSRMMNN_DIM, SUB_WF_SIZE>),
-                                   csrmmnn_blocks,
-                                   csrmmnn_threads,
+                hipLaunchKernelGGL((csrmmnt_kernel_host_pointer<T, U, CSRMMNT_DIM, WF_SIZE, LOOPS>),
+                                   csrmmnt_blocks,
+                                   csrmmnt_threads,
                                    0,
                                    stream,
+                                   offset,
+                                   ncol,
                                    m,
                                    n,
                                    k,
@@ -399,520 +627,145 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                                    *beta,
                                    C,
                                    ldc,
+                                   order_C,
                                    descr->base);
             }
-#undef SUB_WF_SIZE
-#undef CSRMMNN_DIM
-        }
-        else if(trans_B == rocsparse_operation_transpose)
+        };
+
+        // Launch main kernel if enough columns of B. For many columns of B, each lane
+        // accumulates several columns of C, such that the rows of A are loaded only once
+        // for a wide strip of B.
+        if(main > 0)
         {
-            // Average nnz per row of A
-            rocsparse_int avg_row_nnz = (nnz - 1) / m + 1;
+            rocsparse_int segments = main / wfsize_main;
+            rocsparse_int loops    = (segments >= 4) ? 4 : (segments >= 2) ? 2 : 1;
 
-#define CSRMMNT_DIM 256
-            if(handle->pointer_mode == rocsparse_pointer_mode_device)
-            {
-                // Computation is split into two parts, main and remainder
-                // First step: Compute main, which is the maximum number of
-                //             columns of B that is dividable by the next
-                //             power of two of the average row nnz of A.
-                // Second step: Compute remainder, which is the remaining
-                //              columns of B.
-                rocsparse_int main      = 0;
-                rocsparse_int remainder = 0;
-
-                // Launch appropriate kernel depending on row nnz of A
-                if(avg_row_nnz < 16)
-                {
-                    remainder = n % 8;
-                    main      = n - remainder;
-
-                    // Launch main kernel if enough columns of B
-                    if(main > 0)
-                    {
-                        hipLaunchKernelGGL((csrmmnt_kernel_device_pointer<T, CSRMMNT_DIM, 8>),
-                                           dim3((8 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           0,
-                                           main,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
-                    }
-                }
-                else if(avg_row_nnz < 32)
-                {
-                    remainder = n % 16;
-                    main      = n - remainder;
-
-                    // Launch main kernel if enough columns of B
-                    if(main > 0)
-                    {
-                        hipLaunchKernelGGL((csrmmnt_kernel_device_pointer<T, CSRMMNT_DIM, 16>),
-                                           dim3((16 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           0,
-                                           main,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
-                    }
-                }
-                else if(avg_row_nnz < 64 || handle->wavefront_size == 32)
-                {
-                    remainder = n % 32;
-                    main      = n - remainder;
-
-                    // Launch main kernel if enough columns of B
-                    if(main > 0)
-                    {
-                        hipLaunchKernelGGL((csrmmnt_kernel_device_pointer<T, CSRMMNT_DIM, 32>),
-                                           dim3((32 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           0,
-                                           main,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
-                    }
-                }
-                else if(handle->wavefront_size == 64)
-                {
-                    remainder = n % 64;
-                    main      = n - remainder;
-
-                    // Launch main kernel if enough columns of B
-                    if(main > 0)
-                    {
-                        hipLaunchKernelGGL((csrmmnt_kernel_device_pointer<T, CSRMMNT_DIM, 64>),
-                                           dim3((64 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           0,
-                                           main,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
-                    }
-                }
-                else
-                {
-                    return rocsparse_status_arch_mismatch;
-                }
-
-                // Process remainder
-                if(remainder > 0)
-                {
-                    if(remainder <= 8)
-                    {
-                        hipLaunchKernelGGL((csrmmnt_kernel_device_pointer<T, CSRMMNT_DIM, 8>),
-                                           dim3((8 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           main,
-                                           n,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
-                    }
-                    else if(remainder <= 16)
-                    {
-                        hipLaunchKernelGGL((csrmmnt_kernel_device_pointer<T, CSRMMNT_DIM, 16>),
-                                           dim3((16 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           main,
-                                           n,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
-                    }
-                    else if(remainder <= 32 || handle->wavefront_size == 32)
-                    {
-                        hipLaunchKernelGGL((csrmmnt_kernel_device_pointer<T, CSRMMNT_DIM, 32>),
-                                           dim3((32 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           main,
-                                           n,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
-                    }
-                    else if(remainder <= 64)
-                    {
-                        hipLaunchKernelGGL((csrmmnt_kernel_device_pointer<T, CSRMMNT_DIM, 64>),
-                                           dim3((64 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           main,
-                                           n,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
-                    }
-                    else
-                    {
-                        return rocsparse_status_arch_mismatch;
-                    }
-                }
-            }
-            else
-            {
-                // Quick return
-                if(*alpha == 0.0 && *beta == 1.0)
-                {
-                    return rocsparse_status_success;
-                }
-
-                rocsparse_int main      = 0;
-                rocsparse_int remainder = 0;
-
-                // Launch appropriate kernel
-                if(avg_row_nnz < 16)
-                {
-                    remainder = n % 8;
-                    main      = n - remainder;
-
-                    // Launch main kernel if enough columns of B
-                    if(main > 0)
-                    {
-                        hipLaunchKernelGGL((csrmmnt_kernel_host_pointer<T, CSRMMNT_DIM, 8>),
-                                           dim3((8 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           0,
-                                           main,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           *alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           *beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
-                    }
-                }
-                else if(avg_row_nnz < 32)
-                {
-                    remainder = n % 16;
-                    main      = n - remainder;
-
-                    // Launch main kernel if enough columns of B
-                    if(main > 0)
-                    {
-                        hipLaunchKernelGGL((csrmmnt_kernel_host_pointer<T, CSRMMNT_DIM, 16>),
-                                           dim3((16 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           0,
-                                           main,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           *alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           *beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
-                    }
-                }
-                else if(avg_row_nnz < 64 || handle->wavefront_size == 32)
-                {
-                    remainder = n % 32;
-                    main      = n - remainder;
-
-                    // Launch main kernel if enough columns of B
-                    if(main > 0)
-                    {
-                        hipLaunchKernelGGL((csrmmnt_kernel_host_pointer<T, CSRMMNT_DIM, 32>),
-                                           dim3((32 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           0,
-                                           main,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           *alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           *beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
-                    }
-                }
-                else if(handle->wavefront_size == 64)
-                {
-                    remainder = n % 64;
-                    main      = n - remainder;
-
-                    // Launch main kernel if enough columns of B
-                    if(main > 0)
-                    {
-                        hipLaunchKernelGGL((csrmmnt_kernel_host_pointer<T, CSRMMNT_DIM, 64>),
-                                           dim3((64 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           0,
-                                           main,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           *alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           *beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
-                    }
-                }
-                else
-                {
-                    return rocsparse_status_arch_mismatch;
-                }
-
-                // Process remainder
-                if(remainder > 0)
-                {
-                    if(remainder <= 8)
-                    {
-                        hipLaunchKernelGGL((csrmmnt_kernel_host_pointer<T, CSRMMNT_DIM, 8>),
-                                           dim3((8 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           main,
-                                           n,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           *alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           *beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
-                    }
-                    else if(remainder <= 16)
-                    {
-                        hipLaunchKernelGGL((csrmmnt_kernel_host_pointer<T, CSRMMNT_DIM, 16>),
-                                           dim3((16 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           main,
-                                           n,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           *alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           *beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
-                    }
-                    else if(remainder <= 32 || handle->wavefront_size == 32)
-                    {
-                        hipLaunchKernelGGL((csrmmnt_kernel_host_pointer<T, CSRMMNT_DIM, 32>),
-                                           dim3((32 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           main,
-                                           n,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           *alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           *beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
-                    }
-                    else if(remainder <= 64)
-                    {
-                        hipLaunchKernelGGL((csrmmnt_kernel_host_pointer<T, CSRMMNT_DIM, 64>),
-                                           dim3((64 * m - 1) / CSRMMNT_DIM + 1),
-                                           dim3(CSRMMNT_DIM),
-                                           0,
-                                           stream,
-                                           main,
-                                           n,
-                                           m,
-                                           n,
-                                           k,
-                                           nnz,
-                                           *alpha,
-                                           csr_row_ptr,
-                                           csr_col_ind,
-                                           csr_val,
-                                           B,
-                                           ldb,
-                                           *beta,
-                                           C,
-                                           ldc,
-                                           descr->base);
-                    }
-                    else
-                    {
-                        return rocsparse_status_arch_mismatch;
-                    }
-                }
-            }
-#undef CSRMMNT_DIM
+            rocsparse_dispatch_value(wfsize_main, csrmm_wfsizes{}, [&](auto w) {
+                rocsparse_dispatch_value(
+                    loops, csrmmnt_loops{}, [&](auto l) { launch(w, l, 0, main); });
+            });
         }
-        else
+
+        // Process remainder
+        if(remainder > 0)
         {
-            return rocsparse_status_not_implemented;
+            rocsparse_dispatch_value(wfsize_rem, csrmm_wfsizes{}, [&](auto w) {
+                launch(w, std::integral_constant<rocsparse_int, 1>{}, main, n);
+            });
         }
     }
-    else
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmm_ex_analysis_template(rocsparse_handle          handle,
+                                                      rocsparse_operation       trans_A,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             k,
+                                                      rocsparse_int             nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      const T*                  csr_val,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      const rocsparse_int*      csr_col_ind,
+                                                      rocsparse_mat_info        info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
     {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrmm_ex_analysis"),
+              trans_A,
+              m,
+              k,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
         return rocsparse_status_not_implemented;
     }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(k < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Clear csrmm info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_bsrmv_info(info->csrmm_info));
+    info->csrmm_info = nullptr;
+
+    // Quick return if possible
+    if(m == 0 || k == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Non-transposed A is multiplied directly
+    if(trans_A == rocsparse_operation_none)
+    {
+        return rocsparse_status_success;
+    }
+
+    // The transpose of a CSR matrix is its block transpose with 1 x 1 blocks
+    RETURN_IF_ROCSPARSE_ERROR(bsrmv_create_transpose_info(handle,
+                                                          rocsparse_direction_row,
+                                                          trans_A,
+                                                          m,
+                                                          k,
+                                                          nnz,
+                                                          descr,
+                                                          csr_val,
+                                                          csr_row_ptr,
+                                                          csr_col_ind,
+                                                          1,
+                                                          &info->csrmm_info));
+
     return rocsparse_status_success;
 }
 
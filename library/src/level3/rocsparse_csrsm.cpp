@@ -263,6 +263,76 @@ extern "C" rocsparse_status rocsparse_zcsrsm_buffer_size(rocsparse_handle
                                                 buffer_size);
 }
 
+extern "C" rocsparse_status rocsparse_dscsrsm_buffer_size(rocsparse_handle          handle,
+                                                          rocsparse_operation       trans_A,
+                                                          rocsparse_operation       trans_B,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             nrhs,
+                                                          rocsparse_int             nnz,
+                                                          const double*             alpha,
+                                                          const rocsparse_mat_descr descr,
+                                                          const float*              csr_val,
+                                                          const rocsparse_int*      csr_row_ptr,
+                                                          const rocsparse_int*      csr_col_ind,
+                                                          const double*             B,
+                                                          rocsparse_int             ldb,
+                                                          rocsparse_mat_info        info,
+                                                          rocsparse_solve_policy    policy,
+                                                          size_t*                   buffer_size)
+{
+    return rocsparse_csrsm_buffer_size_template(handle,
+                                                trans_A,
+                                                trans_B,
+                                                m,
+                                                nrhs,
+                                                nnz,
+                                                alpha,
+                                                descr,
+                                                csr_val,
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                B,
+                                                ldb,
+                                                info,
+                                                policy,
+                                                buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_zccsrsm_buffer_size(rocsparse_handle                handle,
+                                                          rocsparse_operation             trans_A,
+                                                          rocsparse_operation             trans_B,
+                                                          rocsparse_int                   m,
+                                                          rocsparse_int                   nrhs,
+                                                          rocsparse_int                   nnz,
+                                                          const rocsparse_double_complex* alpha,
+                                                          const rocsparse_mat_descr       descr,
+                                                          const rocsparse_float_complex*  csr_val,
+                                                          const rocsparse_int* csr_row_ptr,
+                                                          const rocsparse_int* csr_col_ind,
+                                                          const rocsparse_double_complex* B,
+                                                          rocsparse_int                   ldb,
+                                                          rocsparse_mat_info              info,
+                                                          rocsparse_solve_policy          policy,
+                                                          size_t* buffer_size)
+{
+    return rocsparse_csrsm_buffer_size_template(handle,
+                                                trans_A,
+                                                trans_B,
+                                                m,
+                                                nrhs,
+                                                nnz,
+                                                alpha,
+                                                descr,
+                                                csr_val,
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                B,
+                                                ldb,
+                                                info,
+                                                policy,
+                                                buffer_size);
+}
+
 extern "C" rocsparse_status rocsparse_scsrsm_analysis(rocsparse_handle          handle,
                                                       rocsparse_operation       trans_A,
                                                       rocsparse_operation       trans_B,
@@ -411,6 +481,80 @@ extern "C" rocsparse_status rocsparse_zcsrsm_analysis(rocsparse_handle
                                              temp_buffer);
 }
 
+extern "C" rocsparse_status rocsparse_dscsrsm_analysis(rocsparse_handle          handle,
+                                                       rocsparse_operation       trans_A,
+                                                       rocsparse_operation       trans_B,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             nrhs,
+                                                       rocsparse_int             nnz,
+                                                       const double*             alpha,
+                                                       const rocsparse_mat_descr descr,
+                                                       const float*              csr_val,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       const double*             B,
+                                                       rocsparse_int             ldb,
+                                                       rocsparse_mat_info        info,
+                                                       rocsparse_analysis_policy analysis,
+                                                       rocsparse_solve_policy    solve,
+                                                       void*                     temp_buffer)
+{
+    return rocsparse_csrsm_analysis_template(handle,
+                                             trans_A,
+                                             trans_B,
+                                             m,
+                                             nrhs,
+                                             nnz,
+                                             alpha,
+                                             descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             B,
+                                             ldb,
+                                             info,
+                                             analysis,
+                                             solve,
+                                             temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zccsrsm_analysis(rocsparse_handle                handle,
+                                                       rocsparse_operation             trans_A,
+                                                       rocsparse_operation             trans_B,
+                                                       rocsparse_int                   m,
+                                                       rocsparse_int                   nrhs,
+                                                       rocsparse_int                   nnz,
+                                                       const rocsparse_double_complex* alpha,
+                                                       const rocsparse_mat_descr       descr,
+                                                       const rocsparse_float_complex*  csr_val,
+                                                       const rocsparse_int*            csr_row_ptr,
+                                                       const rocsparse_int*            csr_col_ind,
+                                                       const rocsparse_double_complex* B,
+                                                       rocsparse_int                   ldb,
+                                                       rocsparse_mat_info              info,
+                                                       rocsparse_analysis_policy       analysis,
+                                                       rocsparse_solve_policy          solve,
+                                                       void*                           temp_buffer)
+{
+    return rocsparse_csrsm_analysis_template(handle,
+                                             trans_A,
+                                             trans_B,
+                                             m,
+                                             nrhs,
+                                             nnz,
+                                             alpha,
+                                             descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             B,
+                                             ldb,
+                                             info,
+                                             analysis,
+                                             solve,
+                                             temp_buffer);
+}
+
 extern "C" rocsparse_status rocsparse_csrsm_clear(rocsparse_handle handle, rocsparse_mat_info info)
 {
     // Check for valid handle and matrix descriptor
@@ -581,3 +725,73 @@ extern "C" rocsparse_status rocsparse_zcsrsm_solve(rocsparse_handle
                                           policy,
                                           temp_buffer);
 }
+
+extern "C" rocsparse_status rocsparse_dscsrsm_solve(rocsparse_handle          handle,
+                                                    rocsparse_operation       trans_A,
+                                                    rocsparse_operation       trans_B,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             nrhs,
+                                                    rocsparse_int             nnz,
+                                                    const double*             alpha,
+                                                    const rocsparse_mat_descr descr,
+                                                    const float*              csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    double*                   B,
+                                                    rocsparse_int             ldb,
+                                                    rocsparse_mat_info        info,
+                                                    rocsparse_solve_policy    policy,
+                                                    void*                     temp_buffer)
+{
+    return rocsparse_csrsm_solve_template(handle,
+                                          trans_A,
+                                          trans_B,
+                                          m,
+                                          nrhs,
+                                          nnz,
+                                          alpha,
+                                          descr,
+                                          csr_val,
+                                          csr_row_ptr,
+                                          csr_col_ind,
+                                          B,
+                                          ldb,
+                                          info,
+                                          policy,
+                                          temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zccsrsm_solve(rocsparse_handle                handle,
+                                                    rocsparse_operation             trans_A,
+                                                    rocsparse_operation             trans_B,
+                                                    rocsparse_int                   m,
+                                                    rocsparse_int                   nrhs,
+                                                    rocsparse_int                   nnz,
+                                                    const rocsparse_double_complex* alpha,
+                                                    const rocsparse_mat_descr       descr,
+                                                    const rocsparse_float_complex*  csr_val,
+                                                    const rocsparse_int*            csr_row_ptr,
+                                                    const rocsparse_int*            csr_col_ind,
+                                                    rocsparse_double_complex*       B,
+                                                    rocsparse_int                   ldb,
+                                                    rocsparse_mat_info              info,
+                                                    rocsparse_solve_policy          policy,
+                                                    void*                           temp_buffer)
+{
+    return rocsparse_csrsm_solve_template(handle,
+                                          trans_A,
+                                          trans_B,
+                                          m,
+                                          nrhs,
+                                          nnz,
+                                          alpha,
+                                          descr,
+                                          csr_val,
+                                          csr_row_ptr,
+                                          csr_col_ind,
+                                          B,
+                                          ldb,
+                                          info,
+                                          policy,
+                                          temp_buffer);
+}
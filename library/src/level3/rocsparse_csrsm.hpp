@@ -35,7 +35,7 @@
 #include <limits>
 #include <rocprim/rocprim.hpp>
 
-template <typename T>
+template <typename T, typename U>
 rocsparse_status rocsparse_csrsm_buffer_size_template(rocsparse_handle          handle,
                                                       rocsparse_operation       trans_A,
                                                       rocsparse_operation       trans_B,
@@ -44,7 +44,7 @@ rocsparse_status rocsparse_csrsm_buffer_size_template(rocsparse_handle
                                                       rocsparse_int             nnz,
                                                       const T*                  alpha,
                                                       const rocsparse_mat_descr descr,
-                                                      const T*                  csr_val,
+                                                      const U*                  csr_val,
                                                       const rocsparse_int*      csr_row_ptr,
                                                       const rocsparse_int*      csr_col_ind,
                                                       const T*                  B,
@@ -71,7 +71,7 @@ rocsparse_status rocsparse_csrsm_buffer_size_template(rocsparse_handle
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrsm_buffer_size"),
+                  replaceXY<T, U>("rocsparse_XYcsrsm_buffer_size"),
                   trans_A,
                   trans_B,
                   m,
@@ -91,7 +91,7 @@ rocsparse_status rocsparse_csrsm_buffer_size_template(rocsparse_handle
     else
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrsm_buffer_size"),
+                  replaceXY<T, U>("rocsparse_XYcsrsm_buffer_size"),
                   trans_A,
                   trans_B,
                   m,
@@ -233,7 +233,7 @@ rocsparse_status rocsparse_csrsm_buffer_size_template(rocsparse_handle
     return rocsparse_status_success;
 }
 
-template <typename T>
+template <typename T, typename U>
 rocsparse_status rocsparse_csrsm_analysis_template(rocsparse_handle          handle,
                                                    rocsparse_operation       trans_A,
                                                    rocsparse_operation       trans_B,
@@ -242,7 +242,7 @@ rocsparse_status rocsparse_csrsm_analysis_template(rocsparse_handle          han
                                                    rocsparse_int             nnz,
                                                    const T*                  alpha,
                                                    const rocsparse_mat_descr descr,
-                                                   const T*                  csr_val,
+                                                   const U*                  csr_val,
                                                    const rocsparse_int*      csr_row_ptr,
                                                    const rocsparse_int*      csr_col_ind,
                                                    const T*                  B,
@@ -270,7 +270,7 @@ rocsparse_status rocsparse_csrsm_analysis_template(rocsparse_handle          han
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrsm_analysis"),
+                  replaceXY<T, U>("rocsparse_XYcsrsm_analysis"),
                   trans_A,
                   trans_B,
                   m,
@@ -291,7 +291,7 @@ rocsparse_status rocsparse_csrsm_analysis_template(rocsparse_handle          han
     else
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrsm_analysis"),
+                  replaceXY<T, U>("rocsparse_XYcsrsm_analysis"),
                   trans_A,
                   trans_B,
                   m,
@@ -510,14 +510,14 @@ rocsparse_status rocsparse_csrsm_analysis_template(rocsparse_handle          han
     return rocsparse_status_success;
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE, bool SLEEP>
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WFSIZE, bool SLEEP>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrsm_host_pointer(rocsparse_int m,
                             rocsparse_int nrhs,
                             T             alpha,
                             const rocsparse_int* __restrict__ csr_row_ptr,
                             const rocsparse_int* __restrict__ csr_col_ind,
-                            const T* __restrict__ csr_val,
+                            const U* __restrict__ csr_val,
                             T* __restrict__ B,
                             rocsparse_int ldb,
                             int* __restrict__ done_array,
@@ -527,30 +527,30 @@ __launch_bounds__(BLOCKSIZE) __global__
                             rocsparse_fill_mode  fill_mode,
                             rocsparse_diag_type  diag_type)
 {
-    csrsm_device<T, BLOCKSIZE, WFSIZE, SLEEP>(m,
-                                              nrhs,
-                                              alpha,
-                                              csr_row_ptr,
-                                              csr_col_ind,
-                                              csr_val,
-                                              B,
-                                              ldb,
-                                              done_array,
-                                              map,
-                                              zero_pivot,
-                                              idx_base,
-                                              fill_mode,
-                                              diag_type);
+    csrsm_device<T, U, BLOCKSIZE, WFSIZE, SLEEP>(m,
+                                                 nrhs,
+                                                 alpha,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 csr_val,
+                                                 B,
+                                                 ldb,
+                                                 done_array,
+                                                 map,
+                                                 zero_pivot,
+                                                 idx_base,
+                                                 fill_mode,
+                                                 diag_type);
 }
 
-template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE, bool SLEEP>
+template <typename T, typename U, unsigned int BLOCKSIZE, unsigned int WFSIZE, bool SLEEP>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrsm_device_pointer(rocsparse_int m,
                               rocsparse_int nrhs,
                               const T*      alpha,
                               const rocsparse_int* __restrict__ csr_row_ptr,
                               const rocsparse_int* __restrict__ csr_col_ind,
-                              const T* __restrict__ csr_val,
+                              const U* __restrict__ csr_val,
                               T* __restrict__ B,
                               rocsparse_int ldb,
                               int* __restrict__ done_array,
@@ -560,23 +560,23 @@ __launch_bounds__(BLOCKSIZE) __global__
                               rocsparse_fill_mode  fill_mode,
                               rocsparse_diag_type  diag_type)
 {
-    csrsm_device<T, BLOCKSIZE, WFSIZE, SLEEP>(m,
-                                              nrhs,
-                                              *alpha,
-                                              csr_row_ptr,
-                                              csr_col_ind,
-                                              csr_val,
-                                              B,
-                                              ldb,
-                                              done_array,
-                                              map,
-                                              zero_pivot,
-                                              idx_base,
-                                              fill_mode,
-                                              diag_type);
+    csrsm_device<T, U, BLOCKSIZE, WFSIZE, SLEEP>(m,
+                                                 nrhs,
+                                                 *alpha,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 csr_val,
+                                                 B,
+                                                 ldb,
+                                                 done_array,
+                                                 map,
+                                                 zero_pivot,
+                                                 idx_base,
+                                                 fill_mode,
+                                                 diag_type);
 }
 
-template <typename T>
+template <typename T, typename U>
 rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle,
                                                 rocsparse_operation       trans_A,
                                                 rocsparse_operation       trans_B,
@@ -585,7 +585,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
                                                 rocsparse_int             nnz,
                                                 const T*                  alpha,
                                                 const rocsparse_mat_descr descr,
-                                                const T*                  csr_val,
+                                                const U*                  csr_val,
                                                 const rocsparse_int*      csr_row_ptr,
                                                 const rocsparse_int*      csr_col_ind,
                                                 T*                        B,
@@ -612,7 +612,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrsm_solve"),
+                  replaceXY<T, U>("rocsparse_XYcsrsm_solve"),
                   trans_A,
                   trans_B,
                   m,
@@ -630,7 +630,8 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
                   (const void*&)temp_buffer);
 
         log_bench(handle,
-                  "./rocsparse-bench -f csrsm -r",
+                  std::is_same<T, U>() ? "./rocsparse-bench -f csrsm -r"
+                                       : "./rocsparse-bench -f csrsm_mixed -r",
                   replaceX<T>("X"),
                   "--mtx <matrix.mtx> ",
                   "--alpha",
@@ -639,7 +640,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
     else
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrsm_solve"),
+                  replaceXY<T, U>("rocsparse_XYcsrsm_solve"),
                   trans_A,
                   trans_B,
                   m,
@@ -768,12 +769,13 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
     // If diag type is unit, re-initialize zero pivot to remove structural zeros
     if(descr->diag_type == rocsparse_diag_type_unit)
     {
-        rocsparse_int max = std::numeric_limits<rocsparse_int>::max();
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-            info->zero_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
-
-        // Wait for device transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        hipLaunchKernelGGL((csrsv_init_zero_pivot_kernel<rocsparse_int>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           info->zero_pivot,
+                           std::numeric_limits<rocsparse_int>::max());
     }
 
     // Leading dimension
@@ -820,7 +822,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
         {
             if(gcnArch == 908 && asicRev < 2)
             {
-                hipLaunchKernelGGL((csrsm_device_pointer<T, 64, 64, true>),
+                hipLaunchKernelGGL((csrsm_device_pointer<T, U, 64, 64, true>),
                                    csrsm_blocks,
                                    csrsm_threads,
                                    0,
@@ -842,7 +844,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
             }
             else
             {
-                hipLaunchKernelGGL((csrsm_device_pointer<T, 64, 64, false>),
+                hipLaunchKernelGGL((csrsm_device_pointer<T, U, 64, 64, false>),
                                    csrsm_blocks,
                                    csrsm_threads,
                                    0,
@@ -867,7 +869,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
         {
             if(gcnArch == 908 && asicRev < 2)
             {
-                hipLaunchKernelGGL((csrsm_device_pointer<T, 128, 64, true>),
+                hipLaunchKernelGGL((csrsm_device_pointer<T, U, 128, 64, true>),
                                    csrsm_blocks,
                                    csrsm_threads,
                                    0,
@@ -889,7 +891,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
             }
             else
             {
-                hipLaunchKernelGGL((csrsm_device_pointer<T, 128, 64, false>),
+                hipLaunchKernelGGL((csrsm_device_pointer<T, U, 128, 64, false>),
                                    csrsm_blocks,
                                    csrsm_threads,
                                    0,
@@ -914,7 +916,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
         {
             if(gcnArch == 908 && asicRev < 2)
             {
-                hipLaunchKernelGGL((csrsm_device_pointer<T, 256, 64, true>),
+                hipLaunchKernelGGL((csrsm_device_pointer<T, U, 256, 64, true>),
                                    csrsm_blocks,
                                    csrsm_threads,
                                    0,
@@ -936,7 +938,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
             }
             else
             {
-                hipLaunchKernelGGL((csrsm_device_pointer<T, 256, 64, false>),
+                hipLaunchKernelGGL((csrsm_device_pointer<T, U, 256, 64, false>),
                                    csrsm_blocks,
                                    csrsm_threads,
                                    0,
@@ -961,7 +963,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
         {
             if(gcnArch == 908 && asicRev < 2)
             {
-                hipLaunchKernelGGL((csrsm_device_pointer<T, 512, 64, true>),
+                hipLaunchKernelGGL((csrsm_device_pointer<T, U, 512, 64, true>),
                                    csrsm_blocks,
                                    csrsm_threads,
                                    0,
@@ -983,7 +985,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
             }
             else
             {
-                hipLaunchKernelGGL((csrsm_device_pointer<T, 512, 64, false>),
+                hipLaunchKernelGGL((csrsm_device_pointer<T, U, 512, 64, false>),
                                    csrsm_blocks,
                                    csrsm_threads,
                                    0,
@@ -1008,7 +1010,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
         {
             if(gcnArch == 908 && asicRev < 2)
             {
-                hipLaunchKernelGGL((csrsm_device_pointer<T, 1024, 64, true>),
+                hipLaunchKernelGGL((csrsm_device_pointer<T, U, 1024, 64, true>),
                                    csrsm_blocks,
                                    csrsm_threads,
                                    0,
@@ -1030,7 +1032,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
             }
             else
             {
-                hipLaunchKernelGGL((csrsm_device_pointer<T, 1024, 64, false>),
+                hipLaunchKernelGGL((csrsm_device_pointer<T, U, 1024, 64, false>),
                                    csrsm_blocks,
                                    csrsm_threads,
                                    0,
@@ -1064,7 +1066,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
         {
             if(gcnArch == 908 && asicRev < 2)
             {
-                hipLaunchKernelGGL((csrsm_host_pointer<T, 64, 64, true>),
+                hipLaunchKernelGGL((csrsm_host_pointer<T, U, 64, 64, true>),
                                    csrsm_blocks,
                                    csrsm_threads,
                                    0,
@@ -1086,7 +1088,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
             }
             else
             {
-                hipLaunchKernelGGL((csrsm_host_pointer<T, 64, 64, false>),
+                hipLaunchKernelGGL((csrsm_host_pointer<T, U, 64, 64, false>),
                                    csrsm_blocks,
                                    csrsm_threads,
                                    0,
@@ -1111,7 +1113,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
         {
             if(gcnArch == 908 && asicRev < 2)
             {
-                hipLaunchKernelGGL((csrsm_host_pointer<T, 128, 64, true>),
+                hipLaunchKernelGGL((csrsm_host_pointer<T, U, 128, 64, true>),
                                    csrsm_blocks,
                                    csrsm_threads,
                                    0,
@@ -1133,7 +1135,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
             }
             else
             {
-                hipLaunchKernelGGL((csrsm_host_pointer<T, 128, 64, false>),
+                hipLaunchKernelGGL((csrsm_host_pointer<T, U, 128, 64, false>),
                                    csrsm_blocks,
                                    csrsm_threads,
                                    0,
@@ -1158,7 +1160,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
         {
             if(gcnArch == 908 && asicRev < 2)
             {
-                hipLaunchKernelGGL((csrsm_host_pointer<T, 256, 64, true>),
+                hipLaunchKernelGGL((csrsm_host_pointer<T, U, 256, 64, true>),
                                    csrsm_blocks,
                                    csrsm_threads,
                                    0,
@@ -1180,7 +1182,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
             }
             else
             {
-                hipLaunchKernelGGL((csrsm_host_pointer<T, 256, 64, false>),
+                hipLaunchKernelGGL((csrsm_host_pointer<T, U, 256, 64, false>),
                                    csrsm_blocks,
                                    csrsm_threads,
                                    0,
@@ -1205,7 +1207,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
         {
             if(gcnArch == 908 && asicRev < 2)
             {
-                hipLaunchKernelGGL((csrsm_host_pointer<T, 512, 64, true>),
+                hipLaunchKernelGGL((csrsm_host_pointer<T, U, 512, 64, true>),
                                    csrsm_blocks,
                                    csrsm_threads,
                                    0,
@@ -1227,7 +1229,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
             }
             else
             {
-                hipLaunchKernelGGL((csrsm_host_pointer<T, 512, 64, false>),
+                hipLaunchKernelGGL((csrsm_host_pointer<T, U, 512, 64, false>),
                                    csrsm_blocks,
                                    csrsm_threads,
                                    0,
@@ -1252,7 +1254,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
         {
             if(gcnArch == 908 && asicRev < 2)
             {
-                hipLaunchKernelGGL((csrsm_host_pointer<T, 1024, 64, true>),
+                hipLaunchKernelGGL((csrsm_host_pointer<T, U, 1024, 64, true>),
                                    csrsm_blocks,
                                    csrsm_threads,
                                    0,
@@ -1274,7 +1276,7 @@ rocsparse_status rocsparse_csrsm_solve_template(rocsparse_handle          handle
             }
             else
             {
-                hipLaunchKernelGGL((csrsm_host_pointer<T, 1024, 64, false>),
+                hipLaunchKernelGGL((csrsm_host_pointer<T, U, 1024, 64, false>),
                                    csrsm_blocks,
                                    csrsm_threads,
                                    0,
@@ -0,0 +1,168 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef SDDMM_DEVICE_H
+#define SDDMM_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Dot product of row i of A and column j of B, computed by a group of WFSIZE threads.
+// inc_A and inc_B are the strides between two consecutive entries of the row of A and
+// the column of B, respectively. The result is valid in the last thread of the group.
+template <typename T, unsigned int WFSIZE>
+__device__ __forceinline__ T sddmm_dot(rocsparse_int lid,
+                                       rocsparse_int k,
+                                       const T* __restrict__ A,
+                                       int64_t inc_A,
+                                       const T* __restrict__ B,
+                                       int64_t inc_B)
+{
+    T sum = static_cast<T>(0);
+
+    for(rocsparse_int p = lid; p < k; p += WFSIZE)
+    {
+        sum = rocsparse_fma(rocsparse_ldg(A + p * inc_A), rocsparse_ldg(B + p * inc_B), sum);
+    }
+
+    return rocsparse_wfreduce_sum<WFSIZE>(sum);
+}
+
+// Each group of WFSIZE threads processes a row of the sampling pattern
+template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE>
+__device__ void csrsddmm_device(rocsparse_int   m,
+                                rocsparse_int   k,
+                                rocsparse_order order_A,
+                                rocsparse_order order_B,
+                                T               alpha,
+                                const T* __restrict__ A,
+                                rocsparse_int lda,
+                                const T* __restrict__ B,
+                                rocsparse_int ldb,
+                                T             beta,
+                                T* __restrict__ csr_val,
+                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                const rocsparse_int* __restrict__ csr_col_ind,
+                                rocsparse_index_base base)
+{
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+    rocsparse_int row = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / WFSIZE;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Row of A
+    const T* A_row = (order_A == rocsparse_order_row) ? A + static_cast<int64_t>(row) * lda
+                                                      : A + row;
+    int64_t  inc_A = (order_A == rocsparse_order_row) ? 1 : lda;
+    int64_t  inc_B = (order_B == rocsparse_order_row) ? ldb : 1;
+
+    rocsparse_int row_begin = csr_row_ptr[row] - base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - base;
+
+    // Loop over the entries of the current row
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col = csr_col_ind[j] - base;
+
+        // Column of B
+        const T* B_col = (order_B == rocsparse_order_row) ? B + col
+                                                          : B + static_cast<int64_t>(col) * ldb;
+
+        T sum = sddmm_dot<T, WFSIZE>(lid, k, A_row, inc_A, B_col, inc_B);
+
+        // Last thread of the group writes the result
+        if(lid == WFSIZE - 1)
+        {
+            if(beta == static_cast<T>(0))
+            {
+                csr_val[j] = alpha * sum;
+            }
+            else
+            {
+                csr_val[j] = rocsparse_fma(beta, csr_val[j], alpha * sum);
+            }
+        }
+    }
+}
+
+// Each group of WFSIZE threads processes an entry of the sampling pattern
+template <typename T, unsigned int BLOCKSIZE, unsigned int WFSIZE>
+__device__ void coosddmm_device(rocsparse_int   nnz,
+                                rocsparse_int   k,
+                                rocsparse_order order_A,
+                                rocsparse_order order_B,
+                                T               alpha,
+                                const T* __restrict__ A,
+                                rocsparse_int lda,
+                                const T* __restrict__ B,
+                                rocsparse_int ldb,
+                                T             beta,
+                                T* __restrict__ coo_val,
+                                const rocsparse_int* __restrict__ coo_row_ind,
+                                const rocsparse_int* __restrict__ coo_col_ind,
+                                rocsparse_index_base base)
+{
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+    rocsparse_int idx = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / WFSIZE;
+
+    // Do not run out of bounds
+    if(idx >= nnz)
+    {
+        return;
+    }
+
+    rocsparse_int row = coo_row_ind[idx] - base;
+    rocsparse_int col = coo_col_ind[idx] - base;
+
+    // Row of A and column of B
+    const T* A_row = (order_A == rocsparse_order_row) ? A + static_cast<int64_t>(row) * lda
+                                                      : A + row;
+    const T* B_col = (order_B == rocsparse_order_row) ? B + col
+                                                      : B + static_cast<int64_t>(col) * ldb;
+    int64_t  inc_A = (order_A == rocsparse_order_row) ? 1 : lda;
+    int64_t  inc_B = (order_B == rocsparse_order_row) ? ldb : 1;
+
+    T sum = sddmm_dot<T, WFSIZE>(lid, k, A_row, inc_A, B_col, inc_B);
+
+    // Last thread of the group writes the result
+    if(lid == WFSIZE - 1)
+    {
+        if(beta == static_cast<T>(0))
+        {
+            coo_val[idx] = alpha * sum;
+        }
+        else
+        {
+            coo_val[idx] = rocsparse_fma(beta, coo_val[idx], alpha * sum);
+        }
+    }
+}
+
+#endif // SDDMM_DEVICE_H
@@ -0,0 +1,337 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef BSRILU0_DEVICE_H
+#define BSRILU0_DEVICE_H
+
+#include "common.h"
+
+#include <hip/hip_runtime.h>
+
+// Position of entry (row, col) of a block, depending on the block storage direction
+__device__ __forceinline__ rocsparse_int bsrilu0_index(rocsparse_direction direction,
+                                                       rocsparse_int       block_dim,
+                                                       rocsparse_int       block,
+                                                       rocsparse_int       row,
+                                                       rocsparse_int       col)
+{
+    return (direction == rocsparse_direction_row)
+               ? block_dim * block_dim * block + block_dim * row + col
+               : block_dim * block_dim * block + block_dim * col + row;
+}
+
+// Each wavefront factorizes one block row, THREADS_PER_ROW lanes are assigned to each
+// row of the block row. The diagonal blocks are factorized by dense LU without pivoting,
+// which is equivalent to ILU(0) of the scalar matrix with dense blocks.
+template <typename T,
+          unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int THREADS_PER_ROW,
+          bool         SLEEP>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrilu0_binsearch_kernel(rocsparse_direction direction,
+                                  rocsparse_int       mb,
+                                  rocsparse_int       block_dim,
+                                  const rocsparse_int* __restrict__ bsr_row_ptr,
+                                  const rocsparse_int* __restrict__ bsr_col_ind,
+                                  T* __restrict__ bsr_val,
+                                  const rocsparse_int* __restrict__ bsr_diag_ind,
+                                  int* __restrict__ block_done,
+                                  const rocsparse_int* __restrict__ block_map,
+                                  rocsparse_int* __restrict__ zero_pivot,
+                                  rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    int wid = hipThreadIdx_x / WFSIZE;
+    int rid = lid & (THREADS_PER_ROW - 1);
+
+    rocsparse_int idx = hipBlockIdx_x * (BLOCKSIZE / WFSIZE) + wid;
+
+    // Do not run out of bounds
+    if(idx >= mb)
+    {
+        return;
+    }
+
+    // Current block row this wavefront is working on
+    rocsparse_int block_row = block_map[idx];
+
+    // Block diagonal entry point of the current block row
+    rocsparse_int block_row_diag = bsr_diag_ind[block_row];
+
+    // If one thread in the warp breaks here, then all threads in
+    // the warp break so no divergence
+    if(block_row_diag == -1)
+    {
+        __threadfence();
+
+        if(lid == WFSIZE - 1)
+        {
+            atomicMin(zero_pivot, block_row + idx_base);
+
+            // Last lane in wavefront writes "we are done" flag for its block row
+            atomicOr(&block_done[block_row], 1);
+        }
+
+        return;
+    }
+
+    // Block row entry and exit point
+    rocsparse_int block_row_begin = bsr_row_ptr[block_row] - idx_base;
+    rocsparse_int block_row_end   = bsr_row_ptr[block_row + 1] - idx_base;
+
+    for(rocsparse_int i = 0; i < block_dim; i += (WFSIZE / THREADS_PER_ROW))
+    {
+        // Row of the block row this lane is working on
+        rocsparse_int local_row = lid / THREADS_PER_ROW + i;
+
+        // Loop over lower block columns of current block row
+        for(rocsparse_int j = block_row_begin; j < block_row_diag; ++j)
+        {
+            // Block column index currently being processed
+            rocsparse_int block_col = bsr_col_ind[j] - idx_base;
+
+            // Block diagonal entry point and exit point of block row 'block_col'
+            rocsparse_int local_block_diag = bsr_diag_ind[block_col];
+            rocsparse_int local_block_end  = bsr_row_ptr[block_col + 1] - idx_base;
+
+            // Structural zero pivot, do not process this block row
+            if(local_block_diag == -1)
+            {
+                // If one thread in the warp breaks here, then all threads in
+                // the warp break so no divergence
+                break;
+            }
+
+            // Spin loop until dependency has been resolved
+            int          local_done    = atomicOr(&block_done[block_col], 0);
+            unsigned int times_through = 0;
+            while(!local_done)
+            {
+                if(SLEEP)
+                {
+                    for(unsigned int k = 0; k < times_through; ++k)
+                    {
+                        __builtin_amdgcn_s_sleep(1);
+                    }
+
+                    if(times_through < 3907)
+                    {
+                        ++times_through;
+                    }
+                }
+
+                local_done = atomicOr(&block_done[block_col], 0);
+            }
+
+            __threadfence();
+
+            // Compute the multipliers of block j, column by column
+            for(rocsparse_int k = 0; k < block_dim; ++k)
+            {
+                // Load diagonal entry of U
+                T diag_val
+                    = bsr_val[bsrilu0_index(direction, block_dim, local_block_diag, k, k)];
+
+                // Row has numerical zero pivot
+                if(diag_val == static_cast<T>(0))
+                {
+                    if(lid == 0)
+                    {
+                        // We are looking for the first zero pivot
+                        atomicMin(zero_pivot, block_col + idx_base);
+                    }
+
+                    // Normally would break here but to avoid divergence set diag_val to one and continue
+                    // The zero pivot has already been set so further computation does not matter
+                    diag_val = static_cast<T>(1);
+                }
+
+                if(local_row < block_dim)
+                {
+                    // Multiplication factor
+                    T val = bsr_val[bsrilu0_index(direction, block_dim, j, local_row, k)]
+                            / diag_val;
+
+                    // Linear combination with the remaining columns of block j
+                    for(rocsparse_int t = k + 1 + rid; t < block_dim; t += THREADS_PER_ROW)
+                    {
+                        rocsparse_int pos = bsrilu0_index(direction, block_dim, j, local_row, t);
+
+                        bsr_val[pos] = rocsparse_fma(
+                            -val,
+                            bsr_val[bsrilu0_index(direction, block_dim, local_block_diag, k, t)],
+                            bsr_val[pos]);
+                    }
+
+                    if(rid == 0)
+                    {
+                        bsr_val[bsrilu0_index(direction, block_dim, j, local_row, k)] = val;
+                    }
+                }
+
+                // Ensure previous writes to global memory are seen by all threads
+                __threadfence();
+            }
+
+            // Linear combination with the upper blocks of block row 'block_col'.
+            // Each lane processes one block
+            if(local_row < block_dim)
+            {
+                for(rocsparse_int p = local_block_diag + 1 + rid; p < local_block_end;
+                    p += THREADS_PER_ROW)
+                {
+                    // Perform a binary search to find matching block columns,
+                    // they can only be located right of block j
+                    rocsparse_int l = j + 1;
+                    rocsparse_int r = block_row_end - 1;
+                    rocsparse_int m = (r + l) >> 1;
+
+                    rocsparse_int block_col_p = bsr_col_ind[p] - idx_base;
+
+                    if(l > r)
+                    {
+                        break;
+                    }
+
+                    rocsparse_int block_col_m = bsr_col_ind[m] - idx_base;
+
+                    // Binary search for block column
+                    while(l < r)
+                    {
+                        if(block_col_m < block_col_p)
+                        {
+                            l = m + 1;
+                        }
+                        else
+                        {
+                            r = m;
+                        }
+
+                        m           = (r + l) >> 1;
+                        block_col_m = bsr_col_ind[m] - idx_base;
+                    }
+
+                    // Check if a match has been found
+                    if(block_col_m != block_col_p)
+                    {
+                        continue;
+                    }
+
+                    for(rocsparse_int k = 0; k < block_dim; ++k)
+                    {
+                        T val = bsr_val[bsrilu0_index(direction, block_dim, j, local_row, k)];
+
+                        for(rocsparse_int t = 0; t < block_dim; ++t)
+                        {
+                            rocsparse_int pos
+                                = bsrilu0_index(direction, block_dim, m, local_row, t);
+
+                            bsr_val[pos] = rocsparse_fma(
+                                -val,
+                                bsr_val[bsrilu0_index(direction, block_dim, p, k, t)],
+                                bsr_val[pos]);
+                        }
+                    }
+                }
+            }
+
+            // Ensure previous writes to global memory are seen by all threads
+            __threadfence();
+        }
+
+        // Dense LU factorization of the diagonal block, row k is final at step k
+        for(rocsparse_int k = 0; k < block_dim; ++k)
+        {
+            // Load diagonal entry
+            T diag_val = bsr_val[bsrilu0_index(direction, block_dim, block_row_diag, k, k)];
+
+            // Row has numerical zero pivot
+            if(diag_val == static_cast<T>(0))
+            {
+                if(lid == 0)
+                {
+                    // We are looking for the first zero pivot
+                    atomicMin(zero_pivot, block_row + idx_base);
+                }
+
+                // Normally would break here but to avoid divergence set diag_val to one and continue
+                // The zero pivot has already been set so further computation does not matter
+                diag_val = static_cast<T>(1);
+            }
+
+            if(k < local_row && local_row < block_dim)
+            {
+                // Multiplication factor
+                T val
+                    = bsr_val[bsrilu0_index(direction, block_dim, block_row_diag, local_row, k)]
+                      / diag_val;
+
+                // Linear combination with the remaining columns of the diagonal block
+                for(rocsparse_int t = k + 1 + rid; t < block_dim; t += THREADS_PER_ROW)
+                {
+                    rocsparse_int pos
+                        = bsrilu0_index(direction, block_dim, block_row_diag, local_row, t);
+
+                    bsr_val[pos] = rocsparse_fma(
+                        -val,
+                        bsr_val[bsrilu0_index(direction, block_dim, block_row_diag, k, t)],
+                        bsr_val[pos]);
+                }
+
+                // Linear combination with the upper blocks, each lane processes one block
+                for(rocsparse_int p = block_row_diag + 1 + rid; p < block_row_end;
+                    p += THREADS_PER_ROW)
+                {
+                    for(rocsparse_int t = 0; t < block_dim; ++t)
+                    {
+                        rocsparse_int pos = bsrilu0_index(direction, block_dim, p, local_row, t);
+
+                        bsr_val[pos] = rocsparse_fma(
+                            -val, bsr_val[bsrilu0_index(direction, block_dim, p, k, t)], bsr_val[pos]);
+                    }
+                }
+
+                if(rid == 0)
+                {
+                    bsr_val[bsrilu0_index(direction, block_dim, block_row_diag, local_row, k)]
+                        = val;
+                }
+            }
+
+            // Ensure previous writes to global memory are seen by all threads
+            __threadfence();
+        }
+    }
+
+    __threadfence();
+
+    if(lid == WFSIZE - 1)
+    {
+        // Last lane writes "we are done" flag for current block row
+        atomicOr(&block_done[block_row], 1);
+    }
+}
+
+#endif // BSRILU0_DEVICE_H
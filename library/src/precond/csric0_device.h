@@ -80,10 +80,15 @@ __launch_bounds__(BLOCKSIZE) __global__
     // Row sum accumulator
     T sum = static_cast<T>(0);
 
+    // The hash table size is chosen from an estimate of the maximum non-zeros
+    // per row, to avoid a device to host transfer of the exact value. Rows that
+    // do not fit into the hash table fall back to binary search.
+    bool use_hash = (row_end - row_begin) < WFSIZE * HASH;
+
     // Fill hash table
     // Loop over columns of current row and fill hash table with row dependencies
     // Each lane processes one entry
-    for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+    for(rocsparse_int j = row_begin + lid; use_hash && j < row_end; j += WFSIZE)
     {
         // Insert key into hash table
         rocsparse_int key = csr_col_ind[j];
@@ -164,9 +169,46 @@ __launch_bounds__(BLOCKSIZE) __global__
         // Compute reciprocal
         diag_val = static_cast<T>(1) / diag_val;
 
+        // Row does not fit into the hash table, use binary search instead
         // Loop over the row the current column index depends on
         // Each lane processes one entry
-        for(rocsparse_int k = local_begin + lid; k < local_diag; k += WFSIZE)
+        rocsparse_int l = row_begin;
+        for(rocsparse_int k = local_begin + lid; !use_hash && k < local_diag; k += WFSIZE)
+        {
+            // Perform a binary search to find matching columns
+            rocsparse_int r     = row_end - 1;
+            rocsparse_int m     = (r + l) >> 1;
+            rocsparse_int col_j = csr_col_ind[m];
+
+            rocsparse_int col_k = csr_col_ind[k];
+
+            // Binary search
+            while(l < r)
+            {
+                if(col_j < col_k)
+                {
+                    l = m + 1;
+                }
+                else
+                {
+                    r = m;
+                }
+
+                m     = (r + l) >> 1;
+                col_j = csr_col_ind[m];
+            }
+
+            // Check if a match has been found
+            if(col_j == col_k)
+            {
+                // If a match has been found, do linear combination
+                local_sum = rocsparse_fma(csr_val[k], rocsparse_conj(csr_val[m]), local_sum);
+            }
+        }
+
+        // Loop over the row the current column index depends on
+        // Each lane processes one entry
+        for(rocsparse_int k = local_begin + lid; use_hash && k < local_diag; k += WFSIZE)
         {
             // Get value from hash table
             rocsparse_int key = csr_col_ind[k];
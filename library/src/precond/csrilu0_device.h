@@ -35,6 +35,7 @@ __launch_bounds__(BLOCKSIZE) __global__
                              const rocsparse_int* __restrict__ csr_row_ptr,
                              const rocsparse_int* __restrict__ csr_col_ind,
                              T* __restrict__ csr_val,
+                             rocsparse_int stride_val,
                              const rocsparse_int* __restrict__ csr_diag_ind,
                              int* __restrict__ done,
                              const rocsparse_int* __restrict__ map,
@@ -67,6 +68,10 @@ __launch_bounds__(BLOCKSIZE) __global__
         return;
     }
 
+    // Matrix of the batch this wavefront is working on
+    csr_val += static_cast<int64_t>(hipBlockIdx_y) * stride_val;
+    done += static_cast<int64_t>(hipBlockIdx_y) * m;
+
     // Current row this wavefront is working on
     rocsparse_int row = map[idx];
 
@@ -77,10 +82,15 @@ __launch_bounds__(BLOCKSIZE) __global__
     rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
     rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
 
+    // The hash table size is chosen from an estimate of the maximum non-zeros
+    // per row, to avoid a device to host transfer of the exact value. Rows that
+    // do not fit into the hash table fall back to binary search.
+    bool use_hash = (row_end - row_begin) < WFSIZE * HASH;
+
     // Fill hash table
     // Loop over columns of current row and fill hash table with row dependencies
     // Each lane processes one entry
-    for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+    for(rocsparse_int j = row_begin + lid; use_hash && j < row_end; j += WFSIZE)
     {
         // Insert key into hash table
         rocsparse_int key = csr_col_ind[j];
@@ -157,6 +167,48 @@ __launch_bounds__(BLOCKSIZE) __global__
 
         csr_val[j] = local_val = local_val / diag_val;
 
+        // Row does not fit into the hash table, use binary search instead
+        if(!use_hash)
+        {
+            // Loop over the row the current column index depends on
+            // Each lane processes one entry
+            rocsparse_int l = j + 1;
+            for(rocsparse_int k = local_diag + 1 + lid; k < local_end; k += WFSIZE)
+            {
+                // Perform a binary search to find matching columns
+                rocsparse_int r     = row_end - 1;
+                rocsparse_int m     = (r + l) >> 1;
+                rocsparse_int col_j = csr_col_ind[m];
+
+                rocsparse_int col_k = csr_col_ind[k];
+
+                // Binary search
+                while(l < r)
+                {
+                    if(col_j < col_k)
+                    {
+                        l = m + 1;
+                    }
+                    else
+                    {
+                        r = m;
+                    }
+
+                    m     = (r + l) >> 1;
+                    col_j = csr_col_ind[m];
+                }
+
+                // Check if a match has been found
+                if(col_j == col_k)
+                {
+                    // If a match has been found, do ILU computation
+                    csr_val[l] = rocsparse_fma(-local_val, csr_val[k], csr_val[l]);
+                }
+            }
+
+            continue;
+        }
+
         // Loop over the row the current column index depends on
         // Each lane processes one entry
         for(rocsparse_int k = local_diag + 1 + lid; k < local_end; k += WFSIZE)
@@ -207,6 +259,7 @@ __launch_bounds__(BLOCKSIZE) __global__
                                   const rocsparse_int* __restrict__ csr_row_ptr,
                                   const rocsparse_int* __restrict__ csr_col_ind,
                                   T* __restrict__ csr_val,
+                                  rocsparse_int stride_val,
                                   const rocsparse_int* __restrict__ csr_diag_ind,
                                   int* __restrict__ done,
                                   const rocsparse_int* __restrict__ map,
@@ -224,6 +277,10 @@ __launch_bounds__(BLOCKSIZE) __global__
         return;
     }
 
+    // Matrix of the batch this wavefront is working on
+    csr_val += static_cast<int64_t>(hipBlockIdx_y) * stride_val;
+    done += static_cast<int64_t>(hipBlockIdx_y) * m;
+
     // Current row this wavefront is working on
     rocsparse_int row = map[idx];
 
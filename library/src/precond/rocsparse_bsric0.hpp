@@ -51,7 +51,7 @@
                        bsr_row_ptr,                                              \
                        bsr_col_ind,                                              \
                        bsr_val,                                                  \
-                       info->bsric0_info->trm_diag_ind,                          \
+                       (const rocsparse_int*)info->bsric0_info->trm_diag_ind,    \
                        d_done_array,                                             \
                        info->bsric0_info->row_map,                               \
                        info->zero_pivot,                                         \
@@ -75,7 +75,7 @@
                        bsr_row_ptr,                                                    \
                        bsr_col_ind,                                                    \
                        bsr_val,                                                        \
-                       info->bsric0_info->trm_diag_ind,                                \
+                       (const rocsparse_int*)info->bsric0_info->trm_diag_ind,          \
                        d_done_array,                                                   \
                        info->bsric0_info->row_map,                                     \
                        info->zero_pivot,                                               \
@@ -99,7 +99,7 @@
                        bsr_row_ptr,                                                    \
                        bsr_col_ind,                                                    \
                        bsr_val,                                                        \
-                       info->bsric0_info->trm_diag_ind,                                \
+                       (const rocsparse_int*)info->bsric0_info->trm_diag_ind,          \
                        d_done_array,                                                   \
                        info->bsric0_info->row_map,                                     \
                        info->zero_pivot,                                               \
@@ -118,7 +118,7 @@
         bsr_row_ptr,                                                                              \
         bsr_col_ind,                                                                              \
         bsr_val,                                                                                  \
-        info->bsric0_info->trm_diag_ind,                                                          \
+        (const rocsparse_int*)info->bsric0_info->trm_diag_ind,                                    \
         d_done_array,                                                                             \
         info->bsric0_info->row_map,                                                               \
         info->zero_pivot,                                                                         \
@@ -136,7 +136,7 @@
                        bsr_row_ptr,                                                               \
                        bsr_col_ind,                                                               \
                        bsr_val,                                                                   \
-                       info->bsric0_info->trm_diag_ind,                                           \
+                       (const rocsparse_int*)info->bsric0_info->trm_diag_ind,                     \
                        d_done_array,                                                              \
                        info->bsric0_info->row_map,                                                \
                        info->zero_pivot,                                                          \
@@ -261,19 +261,22 @@ rocsparse_status rocsparse_bsric0_analysis_template(rocsparse_handle          ha
         }
 
         // Check for other lower analysis meta data
-        // Note: Uncomment when bsrilu0 is complete
-        // if(info->bsrilu0_info != nullptr)
-        // {
-        //     // bsrilu0 meta data
-        //     info->bsric0_info = info->bsrilu0_info;
-        //     return rocsparse_status_success;
-        // }
-
-        if(info->bsrsv_lower_info != nullptr)
+        if(info->bsrilu0_info != nullptr)
+        {
+            // bsrilu0 meta data
+            info->bsric0_info = info->bsrilu0_info;
+            return rocsparse_status_success;
+        }
+        else if(info->bsrsv_lower_info != nullptr)
         {
             info->bsric0_info = info->bsrsv_lower_info;
             return rocsparse_status_success;
         }
+        else if(info->bsrsm_lower_info != nullptr)
+        {
+            info->bsric0_info = info->bsrsm_lower_info;
+            return rocsparse_status_success;
+        }
     }
 
     // User is explicitly asking to force a re-analysis, or no valid data has been
@@ -405,6 +408,19 @@ rocsparse_status rocsparse_bsric0_template(rocsparse_handle          handle,
     // Initialize buffers
     RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(int) * mb, stream));
 
+    // Fetch max nnz blocks per row from the device, if not already available
+    if(info->bsric0_info->max_nnz == 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&info->bsric0_info->max_nnz,
+                                           info->bsric0_info->d_max_nnz,
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+
     // Max nnz blocks per row
     rocsparse_int max_nnzb = info->bsric0_info->max_nnz;
 
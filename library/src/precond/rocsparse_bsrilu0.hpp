@@ -0,0 +1,390 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_BSRILU0_HPP
+#define ROCSPARSE_BSRILU0_HPP
+
+#include "../level2/rocsparse_csrsv.hpp"
+#include "bsrilu0_device.h"
+#include "definitions.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+#define launch_bsrilu0_binsearch_kernel(T, block_size, wf_size, threads_per_row, sleep)            \
+    hipLaunchKernelGGL((bsrilu0_binsearch_kernel<T, block_size, wf_size, threads_per_row, sleep>), \
+                       dim3((mb * wf_size - 1) / block_size + 1),                                  \
+                       dim3(block_size),                                                           \
+                       0,                                                                          \
+                       stream,                                                                     \
+                       dir,                                                                        \
+                       mb,                                                                         \
+                       block_dim,                                                                  \
+                       bsr_row_ptr,                                                                \
+                       bsr_col_ind,                                                                \
+                       bsr_val,                                                                    \
+                       (const rocsparse_int*)info->bsrilu0_info->trm_diag_ind,                     \
+                       d_done_array,                                                               \
+                       info->bsrilu0_info->row_map,                                                \
+                       info->zero_pivot,                                                           \
+                       descr->base);
+
+// Assign as many lanes to each row of the block row as the block dimension allows
+#define launch_bsrilu0_dispatch(T, wf_size, sleep)                             \
+    if(block_dim <= 2)                                                         \
+    {                                                                          \
+        launch_bsrilu0_binsearch_kernel(T, 64, wf_size, wf_size / 2, sleep);   \
+    }                                                                          \
+    else if(block_dim <= 4)                                                    \
+    {                                                                          \
+        launch_bsrilu0_binsearch_kernel(T, 64, wf_size, wf_size / 4, sleep);   \
+    }                                                                          \
+    else if(block_dim <= 8)                                                    \
+    {                                                                          \
+        launch_bsrilu0_binsearch_kernel(T, 64, wf_size, wf_size / 8, sleep);   \
+    }                                                                          \
+    else if(block_dim <= 16)                                                   \
+    {                                                                          \
+        launch_bsrilu0_binsearch_kernel(T, 64, wf_size, wf_size / 16, sleep);  \
+    }                                                                          \
+    else if(block_dim <= 32)                                                   \
+    {                                                                          \
+        launch_bsrilu0_binsearch_kernel(T, 64, wf_size, wf_size / 32, sleep);  \
+    }                                                                          \
+    else                                                                       \
+    {                                                                          \
+        launch_bsrilu0_binsearch_kernel(T, 64, wf_size, 1, sleep);             \
+    }
+
+template <typename T>
+rocsparse_status rocsparse_bsrilu0_analysis_template(rocsparse_handle          handle,
+                                                     rocsparse_direction       dir,
+                                                     rocsparse_int             mb,
+                                                     rocsparse_int             nnzb,
+                                                     const rocsparse_mat_descr descr,
+                                                     const T*                  bsr_val,
+                                                     const rocsparse_int*      bsr_row_ptr,
+                                                     const rocsparse_int*      bsr_col_ind,
+                                                     rocsparse_int             block_dim,
+                                                     rocsparse_mat_info        info,
+                                                     rocsparse_analysis_policy analysis,
+                                                     rocsparse_solve_policy    solve,
+                                                     void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xbsrilu0_analysis"),
+              dir,
+              mb,
+              nnzb,
+              (const void*&)descr,
+              (const void*&)bsr_val,
+              (const void*&)bsr_row_ptr,
+              (const void*&)bsr_col_ind,
+              block_dim,
+              (const void*&)info,
+              solve,
+              analysis);
+
+    // Check direction
+    if(dir != rocsparse_direction_row && dir != rocsparse_direction_column)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check analysis policy
+    if(analysis != rocsparse_analysis_policy_reuse && analysis != rocsparse_analysis_policy_force)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check solve policy
+    if(solve != rocsparse_solve_policy_auto)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(mb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnzb < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(mb == 0 || nnzb == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(bsr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Differentiate the analysis policies
+    if(analysis == rocsparse_analysis_policy_reuse)
+    {
+        // We try to re-use already analyzed lower part, if available.
+        // It is the user's responsibility that this data is still valid,
+        // since he passed the 'reuse' flag.
+
+        // If bsrilu0 meta data is already available, do nothing
+        if(info->bsrilu0_info != nullptr)
+        {
+            return rocsparse_status_success;
+        }
+
+        // Check for other lower analysis meta data
+        if(info->bsric0_info != nullptr)
+        {
+            // bsric0 meta data
+            info->bsrilu0_info = info->bsric0_info;
+            return rocsparse_status_success;
+        }
+        else if(info->bsrsv_lower_info != nullptr)
+        {
+            // bsrsv meta data
+            info->bsrilu0_info = info->bsrsv_lower_info;
+            return rocsparse_status_success;
+        }
+        else if(info->bsrsm_lower_info != nullptr)
+        {
+            // bsrsm meta data
+            info->bsrilu0_info = info->bsrsm_lower_info;
+            return rocsparse_status_success;
+        }
+    }
+
+    // User is explicitly asking to force a re-analysis, or no valid data has been
+    // found to be re-used.
+
+    // Clear bsrilu0 info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->bsrilu0_info));
+
+    // Create bsrilu0 info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_trm_info(&info->bsrilu0_info));
+
+    // Perform analysis
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_trm_analysis(handle,
+                                                     rocsparse_operation_none,
+                                                     mb,
+                                                     nnzb,
+                                                     descr,
+                                                     bsr_val,
+                                                     bsr_row_ptr,
+                                                     bsr_col_ind,
+                                                     info->bsrilu0_info,
+                                                     &info->zero_pivot,
+                                                     temp_buffer));
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_bsrilu0_template(rocsparse_handle          handle,
+                                            rocsparse_direction       dir,
+                                            rocsparse_int             mb,
+                                            rocsparse_int             nnzb,
+                                            const rocsparse_mat_descr descr,
+                                            T*                        bsr_val,
+                                            const rocsparse_int*      bsr_row_ptr,
+                                            const rocsparse_int*      bsr_col_ind,
+                                            rocsparse_int             block_dim,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_solve_policy    policy,
+                                            void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xbsrilu0"),
+              dir,
+              mb,
+              nnzb,
+              (const void*&)descr,
+              (const void*&)bsr_val,
+              (const void*&)bsr_row_ptr,
+              (const void*&)bsr_col_ind,
+              block_dim,
+              (const void*&)info,
+              policy,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f bsrilu0 -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check direction
+    if(dir != rocsparse_direction_row && dir != rocsparse_direction_column)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(mb < 0 || nnzb < 0 || block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(mb == 0 || nnzb == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(bsr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(bsr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->bsrilu0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+    ptr += 256;
+
+    // done array
+    int* d_done_array = reinterpret_cast<int*>(ptr);
+
+    // Initialize buffers
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(int) * mb, stream));
+
+    // The binary search kernel does not depend on the maximum number of blocks
+    // per row, thus no host synchronization is required
+    if(handle->wavefront_size == 64)
+    {
+        // Determine gcnArch and ASIC revision
+        if(handle->properties.gcnArch == 908 && handle->asic_rev < 2)
+        {
+            launch_bsrilu0_dispatch(T, 64, true);
+        }
+        else
+        {
+            launch_bsrilu0_dispatch(T, 64, false);
+        }
+    }
+    else if(handle->wavefront_size == 32)
+    {
+        launch_bsrilu0_dispatch(T, 32, false);
+    }
+    else
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_BSRILU0_HPP
@@ -305,6 +305,56 @@ extern "C" rocsparse_status rocsparse_zcsric0(rocsparse_handle          handle,
         handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
 }
 
+extern "C" rocsparse_status rocsparse_dscsric0(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             csr_val,
+                                               float*                    ic_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               rocsparse_solve_policy    policy,
+                                               void*                     temp_buffer)
+{
+    return rocsparse_csric0_mixed_template(handle,
+                                           m,
+                                           nnz,
+                                           descr,
+                                           csr_val,
+                                           ic_val,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           info,
+                                           policy,
+                                           temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zccsric0(rocsparse_handle                handle,
+                                               rocsparse_int                   m,
+                                               rocsparse_int                   nnz,
+                                               const rocsparse_mat_descr       descr,
+                                               const rocsparse_double_complex* csr_val,
+                                               rocsparse_float_complex*        ic_val,
+                                               const rocsparse_int*            csr_row_ptr,
+                                               const rocsparse_int*            csr_col_ind,
+                                               rocsparse_mat_info              info,
+                                               rocsparse_solve_policy          policy,
+                                               void*                           temp_buffer)
+{
+    return rocsparse_csric0_mixed_template(handle,
+                                           m,
+                                           nnz,
+                                           descr,
+                                           csr_val,
+                                           ic_val,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           info,
+                                           policy,
+                                           temp_buffer);
+}
+
 extern "C" rocsparse_status rocsparse_csric0_zero_pivot(rocsparse_handle   handle,
                                                         rocsparse_mat_info info,
                                                         rocsparse_int*     position)
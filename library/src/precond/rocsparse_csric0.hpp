@@ -191,97 +191,16 @@ rocsparse_status rocsparse_csric0_analysis_template(rocsparse_handle          ha
 }
 
 template <typename T>
-rocsparse_status rocsparse_csric0_template(rocsparse_handle          handle,
-                                           rocsparse_int             m,
-                                           rocsparse_int             nnz,
-                                           const rocsparse_mat_descr descr,
-                                           T*                        csr_val,
-                                           const rocsparse_int*      csr_row_ptr,
-                                           const rocsparse_int*      csr_col_ind,
-                                           rocsparse_mat_info        info,
-                                           rocsparse_solve_policy    policy,
-                                           void*                     temp_buffer)
+static rocsparse_status rocsparse_csric0_dispatch(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  T*                        csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_mat_info        info,
+                                                  void*                     temp_buffer)
 {
-    // Check for valid handle and matrix descriptor
-    if(handle == nullptr)
-    {
-        return rocsparse_status_invalid_handle;
-    }
-    else if(descr == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(info == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-
-    // Logging
-    log_trace(handle,
-              replaceX<T>("rocsparse_Xcsric0"),
-              m,
-              nnz,
-              (const void*&)descr,
-              (const void*&)csr_val,
-              (const void*&)csr_row_ptr,
-              (const void*&)csr_col_ind,
-              (const void*&)info,
-              policy,
-              (const void*&)temp_buffer);
-
-    log_bench(handle, "./rocsparse-bench -f csric0 -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
-
-    // Check index base
-    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
-    {
-        return rocsparse_status_invalid_value;
-    }
-    if(descr->type != rocsparse_matrix_type_general)
-    {
-        // TODO
-        return rocsparse_status_not_implemented;
-    }
-
-    // Check sizes
-    if(m < 0)
-    {
-        return rocsparse_status_invalid_size;
-    }
-    else if(nnz < 0)
-    {
-        return rocsparse_status_invalid_size;
-    }
-
-    // Quick return if possible
-    if(m == 0 || nnz == 0)
-    {
-        return rocsparse_status_success;
-    }
-
-    // Check pointer arguments
-    if(csr_val == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(csr_row_ptr == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(csr_col_ind == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(temp_buffer == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-
-    // Check for analysis call
-    if(info->csric0_info == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-
     // Stream
     hipStream_t stream = handle->stream;
 
@@ -295,8 +214,9 @@ rocsparse_status rocsparse_csric0_template(rocsparse_handle          handle,
     // Initialize buffers
     RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(int) * m, stream));
 
-    // Max nnz per row
-    rocsparse_int max_nnz = info->csric0_info->max_nnz;
+    // Estimate max nnz per row from the average, to avoid a device to host
+    // transfer. The kernels fall back to binary search for longer rows.
+    rocsparse_int max_nnz = 2 * ((nnz - 1) / m + 1);
 
     // Determine gcnArch and ASIC revision
     int gcnArch = handle->properties.gcnArch;
@@ -317,7 +237,7 @@ rocsparse_status rocsparse_csric0_template(rocsparse_handle          handle,
                            csr_row_ptr,
                            csr_col_ind,
                            csr_val,
-                           info->csric0_info->trm_diag_ind,
+                           (const rocsparse_int*)info->csric0_info->trm_diag_ind,
                            d_done_array,
                            info->csric0_info->row_map,
                            info->zero_pivot,
@@ -338,7 +258,7 @@ rocsparse_status rocsparse_csric0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csric0_info->trm_diag_ind,
+                                   (const rocsparse_int*)info->csric0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csric0_info->row_map,
                                    info->zero_pivot,
@@ -355,7 +275,7 @@ rocsparse_status rocsparse_csric0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csric0_info->trm_diag_ind,
+                                   (const rocsparse_int*)info->csric0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csric0_info->row_map,
                                    info->zero_pivot,
@@ -372,7 +292,7 @@ rocsparse_status rocsparse_csric0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csric0_info->trm_diag_ind,
+                                   (const rocsparse_int*)info->csric0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csric0_info->row_map,
                                    info->zero_pivot,
@@ -389,7 +309,7 @@ rocsparse_status rocsparse_csric0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csric0_info->trm_diag_ind,
+                                   (const rocsparse_int*)info->csric0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csric0_info->row_map,
                                    info->zero_pivot,
@@ -406,7 +326,7 @@ rocsparse_status rocsparse_csric0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csric0_info->trm_diag_ind,
+                                   (const rocsparse_int*)info->csric0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csric0_info->row_map,
                                    info->zero_pivot,
@@ -423,7 +343,7 @@ rocsparse_status rocsparse_csric0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csric0_info->trm_diag_ind,
+                                   (const rocsparse_int*)info->csric0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csric0_info->row_map,
                                    info->zero_pivot,
@@ -443,7 +363,7 @@ rocsparse_status rocsparse_csric0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csric0_info->trm_diag_ind,
+                                   (const rocsparse_int*)info->csric0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csric0_info->row_map,
                                    info->zero_pivot,
@@ -460,7 +380,7 @@ rocsparse_status rocsparse_csric0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csric0_info->trm_diag_ind,
+                                   (const rocsparse_int*)info->csric0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csric0_info->row_map,
                                    info->zero_pivot,
@@ -477,7 +397,7 @@ rocsparse_status rocsparse_csric0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csric0_info->trm_diag_ind,
+                                   (const rocsparse_int*)info->csric0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csric0_info->row_map,
                                    info->zero_pivot,
@@ -494,7 +414,7 @@ rocsparse_status rocsparse_csric0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csric0_info->trm_diag_ind,
+                                   (const rocsparse_int*)info->csric0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csric0_info->row_map,
                                    info->zero_pivot,
@@ -511,7 +431,7 @@ rocsparse_status rocsparse_csric0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csric0_info->trm_diag_ind,
+                                   (const rocsparse_int*)info->csric0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csric0_info->row_map,
                                    info->zero_pivot,
@@ -528,7 +448,7 @@ rocsparse_status rocsparse_csric0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csric0_info->trm_diag_ind,
+                                   (const rocsparse_int*)info->csric0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csric0_info->row_map,
                                    info->zero_pivot,
@@ -545,4 +465,215 @@ rocsparse_status rocsparse_csric0_template(rocsparse_handle          handle,
     return rocsparse_status_success;
 }
 
+template <typename T>
+rocsparse_status rocsparse_csric0_template(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           T*                        csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           rocsparse_solve_policy    policy,
+                                           void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsric0"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              policy,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csric0 -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csric0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_csric0_dispatch(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, temp_buffer);
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csric0_mixed_template(rocsparse_handle          handle,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const T*                  csr_val,
+                                                 U*                        ic_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 rocsparse_mat_info        info,
+                                                 rocsparse_solve_policy    policy,
+                                                 void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceXY<T, U>("rocsparse_XYcsric0"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)ic_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              policy,
+              (const void*&)temp_buffer);
+
+    log_bench(
+        handle, "./rocsparse-bench -f csric0_mixed -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(ic_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csric0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Round the matrix into the precision of the factor, which is then computed in place
+#define CSRIC0_DIM 256
+    hipLaunchKernelGGL((csrsv_convert_kernel<CSRIC0_DIM, U, T>),
+                       dim3((nnz - 1) / CSRIC0_DIM + 1),
+                       dim3(CSRIC0_DIM),
+                       0,
+                       handle->stream,
+                       nnz,
+                       csr_val,
+                       ic_val);
+#undef CSRIC0_DIM
+
+    return rocsparse_csric0_dispatch(
+        handle, m, nnz, descr, ic_val, csr_row_ptr, csr_col_ind, info, temp_buffer);
+}
+
 #endif // ROCSPARSE_CSRIC0_HPP
@@ -306,6 +306,56 @@ extern "C" rocsparse_status rocsparse_zcsrilu0(rocsparse_handle          handle,
         handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
 }
 
+extern "C" rocsparse_status rocsparse_dscsrilu0(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             csr_val,
+                                                float*                    ilu_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                rocsparse_solve_policy    policy,
+                                                void*                     temp_buffer)
+{
+    return rocsparse_csrilu0_mixed_template(handle,
+                                            m,
+                                            nnz,
+                                            descr,
+                                            csr_val,
+                                            ilu_val,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            info,
+                                            policy,
+                                            temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zccsrilu0(rocsparse_handle                handle,
+                                                rocsparse_int                   m,
+                                                rocsparse_int                   nnz,
+                                                const rocsparse_mat_descr       descr,
+                                                const rocsparse_double_complex* csr_val,
+                                                rocsparse_float_complex*        ilu_val,
+                                                const rocsparse_int*            csr_row_ptr,
+                                                const rocsparse_int*            csr_col_ind,
+                                                rocsparse_mat_info              info,
+                                                rocsparse_solve_policy          policy,
+                                                void*                           temp_buffer)
+{
+    return rocsparse_csrilu0_mixed_template(handle,
+                                            m,
+                                            nnz,
+                                            descr,
+                                            csr_val,
+                                            ilu_val,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            info,
+                                            policy,
+                                            temp_buffer);
+}
+
 extern "C" rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle   handle,
                                                          rocsparse_mat_info info,
                                                          rocsparse_int*     position)
@@ -191,97 +191,18 @@ rocsparse_status rocsparse_csrilu0_analysis_template(rocsparse_handle          h
 }
 
 template <typename T>
-rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
-                                            rocsparse_int             m,
-                                            rocsparse_int             nnz,
-                                            const rocsparse_mat_descr descr,
-                                            T*                        csr_val,
-                                            const rocsparse_int*      csr_row_ptr,
-                                            const rocsparse_int*      csr_col_ind,
-                                            rocsparse_mat_info        info,
-                                            rocsparse_solve_policy    policy,
-                                            void*                     temp_buffer)
+static rocsparse_status rocsparse_csrilu0_dispatch(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   T*                        csr_val,
+                                                   rocsparse_int             stride_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_mat_info        info,
+                                                   rocsparse_int             batch_count,
+                                                   void*                     temp_buffer)
 {
-    // Check for valid handle and matrix descriptor
-    if(handle == nullptr)
-    {
-        return rocsparse_status_invalid_handle;
-    }
-    else if(descr == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(info == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-
-    // Logging
-    log_trace(handle,
-              replaceX<T>("rocsparse_Xcsrilu0"),
-              m,
-              nnz,
-              (const void*&)descr,
-              (const void*&)csr_val,
-              (const void*&)csr_row_ptr,
-              (const void*&)csr_col_ind,
-              (const void*&)info,
-              policy,
-              (const void*&)temp_buffer);
-
-    log_bench(handle, "./rocsparse-bench -f csrilu0 -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
-
-    // Check index base
-    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
-    {
-        return rocsparse_status_invalid_value;
-    }
-    if(descr->type != rocsparse_matrix_type_general)
-    {
-        // TODO
-        return rocsparse_status_not_implemented;
-    }
-
-    // Check sizes
-    if(m < 0)
-    {
-        return rocsparse_status_invalid_size;
-    }
-    else if(nnz < 0)
-    {
-        return rocsparse_status_invalid_size;
-    }
-
-    // Quick return if possible
-    if(m == 0 || nnz == 0)
-    {
-        return rocsparse_status_success;
-    }
-
-    // Check pointer arguments
-    if(csr_val == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(csr_row_ptr == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(csr_col_ind == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(temp_buffer == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-
-    // Check for analysis call
-    if(info->csrilu0_info == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-
     // Stream
     hipStream_t stream = handle->stream;
 
@@ -293,17 +214,18 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
     int* d_done_array = reinterpret_cast<int*>(ptr);
 
     // Initialize buffers
-    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(int) * m, stream));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(int) * m * batch_count, stream));
 
-    // Max nnz per row
-    rocsparse_int max_nnz = info->csrilu0_info->max_nnz;
+    // Estimate max nnz per row from the average, to avoid a device to host
+    // transfer. The kernels fall back to binary search for longer rows.
+    rocsparse_int max_nnz = 2 * ((nnz - 1) / m + 1);
 
     // Determine gcnArch and ASIC revision
     int gcnArch = handle->properties.gcnArch;
     int asicRev = handle->asic_rev;
 
 #define CSRILU0_DIM 256
-    dim3 csrilu0_blocks((m * handle->wavefront_size - 1) / CSRILU0_DIM + 1);
+    dim3 csrilu0_blocks((m * handle->wavefront_size - 1) / CSRILU0_DIM + 1, batch_count);
     dim3 csrilu0_threads(CSRILU0_DIM);
 
     if(gcnArch == 908 && asicRev < 2)
@@ -317,7 +239,8 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                            csr_row_ptr,
                            csr_col_ind,
                            csr_val,
-                           info->csrilu0_info->trm_diag_ind,
+                           stride_val,
+                           (const rocsparse_int*)info->csrilu0_info->trm_diag_ind,
                            d_done_array,
                            info->csrilu0_info->row_map,
                            info->zero_pivot,
@@ -338,7 +261,8 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csrilu0_info->trm_diag_ind,
+                                   stride_val,
+                                   (const rocsparse_int*)info->csrilu0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csrilu0_info->row_map,
                                    info->zero_pivot,
@@ -355,7 +279,8 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csrilu0_info->trm_diag_ind,
+                                   stride_val,
+                                   (const rocsparse_int*)info->csrilu0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csrilu0_info->row_map,
                                    info->zero_pivot,
@@ -372,7 +297,8 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csrilu0_info->trm_diag_ind,
+                                   stride_val,
+                                   (const rocsparse_int*)info->csrilu0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csrilu0_info->row_map,
                                    info->zero_pivot,
@@ -389,7 +315,8 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csrilu0_info->trm_diag_ind,
+                                   stride_val,
+                                   (const rocsparse_int*)info->csrilu0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csrilu0_info->row_map,
                                    info->zero_pivot,
@@ -406,7 +333,8 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csrilu0_info->trm_diag_ind,
+                                   stride_val,
+                                   (const rocsparse_int*)info->csrilu0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csrilu0_info->row_map,
                                    info->zero_pivot,
@@ -423,7 +351,8 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csrilu0_info->trm_diag_ind,
+                                   stride_val,
+                                   (const rocsparse_int*)info->csrilu0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csrilu0_info->row_map,
                                    info->zero_pivot,
@@ -443,7 +372,8 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csrilu0_info->trm_diag_ind,
+                                   stride_val,
+                                   (const rocsparse_int*)info->csrilu0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csrilu0_info->row_map,
                                    info->zero_pivot,
@@ -460,7 +390,8 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csrilu0_info->trm_diag_ind,
+                                   stride_val,
+                                   (const rocsparse_int*)info->csrilu0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csrilu0_info->row_map,
                                    info->zero_pivot,
@@ -477,7 +408,8 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csrilu0_info->trm_diag_ind,
+                                   stride_val,
+                                   (const rocsparse_int*)info->csrilu0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csrilu0_info->row_map,
                                    info->zero_pivot,
@@ -494,7 +426,8 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csrilu0_info->trm_diag_ind,
+                                   stride_val,
+                                   (const rocsparse_int*)info->csrilu0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csrilu0_info->row_map,
                                    info->zero_pivot,
@@ -511,7 +444,8 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csrilu0_info->trm_diag_ind,
+                                   stride_val,
+                                   (const rocsparse_int*)info->csrilu0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csrilu0_info->row_map,
                                    info->zero_pivot,
@@ -528,7 +462,8 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
-                                   info->csrilu0_info->trm_diag_ind,
+                                   stride_val,
+                                   (const rocsparse_int*)info->csrilu0_info->trm_diag_ind,
                                    d_done_array,
                                    info->csrilu0_info->row_map,
                                    info->zero_pivot,
@@ -545,4 +480,215 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
     return rocsparse_status_success;
 }
 
+template <typename T>
+rocsparse_status rocsparse_csrilu0_template(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            T*                        csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_solve_policy    policy,
+                                            void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilu0"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              policy,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csrilu0 -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csrilu0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_csrilu0_dispatch(
+        handle, m, nnz, descr, csr_val, 0, csr_row_ptr, csr_col_ind, info, 1, temp_buffer);
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrilu0_mixed_template(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const T*                  csr_val,
+                                                  U*                        ilu_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_mat_info        info,
+                                                  rocsparse_solve_policy    policy,
+                                                  void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceXY<T, U>("rocsparse_XYcsrilu0"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)ilu_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              policy,
+              (const void*&)temp_buffer);
+
+    log_bench(
+        handle, "./rocsparse-bench -f csrilu0_mixed -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(ilu_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csrilu0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Round the matrix into the precision of the factor, which is then computed in place
+#define CSRILU0_DIM 256
+    hipLaunchKernelGGL((csrsv_convert_kernel<CSRILU0_DIM, U, T>),
+                       dim3((nnz - 1) / CSRILU0_DIM + 1),
+                       dim3(CSRILU0_DIM),
+                       0,
+                       handle->stream,
+                       nnz,
+                       csr_val,
+                       ilu_val);
+#undef CSRILU0_DIM
+
+    return rocsparse_csrilu0_dispatch(
+        handle, m, nnz, descr, ilu_val, 0, csr_row_ptr, csr_col_ind, info, 1, temp_buffer);
+}
+
 #endif // ROCSPARSE_CSRILU0_HPP
@@ -0,0 +1,240 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse.h"
+
+#include "rocsparse_csrilu0_strided_batched.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status
+    rocsparse_scsrilu0_strided_batched_buffer_size(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const float*              csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_mat_info        info,
+                                                   rocsparse_int             batch_count,
+                                                   size_t*                   buffer_size)
+{
+    return rocsparse_scsrsv_strided_batched_buffer_size(handle,
+                                                        rocsparse_operation_none,
+                                                        m,
+                                                        nnz,
+                                                        descr,
+                                                        csr_val,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        info,
+                                                        batch_count,
+                                                        buffer_size);
+}
+
+extern "C" rocsparse_status
+    rocsparse_dcsrilu0_strided_batched_buffer_size(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const double*             csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_mat_info        info,
+                                                   rocsparse_int             batch_count,
+                                                   size_t*                   buffer_size)
+{
+    return rocsparse_dcsrsv_strided_batched_buffer_size(handle,
+                                                        rocsparse_operation_none,
+                                                        m,
+                                                        nnz,
+                                                        descr,
+                                                        csr_val,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        info,
+                                                        batch_count,
+                                                        buffer_size);
+}
+
+extern "C" rocsparse_status
+    rocsparse_ccsrilu0_strided_batched_buffer_size(rocsparse_handle               handle,
+                                                   rocsparse_int                  m,
+                                                   rocsparse_int                  nnz,
+                                                   const rocsparse_mat_descr      descr,
+                                                   const rocsparse_float_complex* csr_val,
+                                                   const rocsparse_int*           csr_row_ptr,
+                                                   const rocsparse_int*           csr_col_ind,
+                                                   rocsparse_mat_info             info,
+                                                   rocsparse_int                  batch_count,
+                                                   size_t*                        buffer_size)
+{
+    return rocsparse_ccsrsv_strided_batched_buffer_size(handle,
+                                                        rocsparse_operation_none,
+                                                        m,
+                                                        nnz,
+                                                        descr,
+                                                        csr_val,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        info,
+                                                        batch_count,
+                                                        buffer_size);
+}
+
+extern "C" rocsparse_status
+    rocsparse_zcsrilu0_strided_batched_buffer_size(rocsparse_handle                handle,
+                                                   rocsparse_int                   m,
+                                                   rocsparse_int                   nnz,
+                                                   const rocsparse_mat_descr       descr,
+                                                   const rocsparse_double_complex* csr_val,
+                                                   const rocsparse_int*            csr_row_ptr,
+                                                   const rocsparse_int*            csr_col_ind,
+                                                   rocsparse_mat_info              info,
+                                                   rocsparse_int                   batch_count,
+                                                   size_t*                         buffer_size)
+{
+    return rocsparse_zcsrsv_strided_batched_buffer_size(handle,
+                                                        rocsparse_operation_none,
+                                                        m,
+                                                        nnz,
+                                                        descr,
+                                                        csr_val,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        info,
+                                                        batch_count,
+                                                        buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_scsrilu0_strided_batched(rocsparse_handle          handle,
+                                                               rocsparse_int             m,
+                                                               rocsparse_int             nnz,
+                                                               const rocsparse_mat_descr descr,
+                                                               float*                    csr_val,
+                                                               rocsparse_int             stride_val,
+                                                               const rocsparse_int* csr_row_ptr,
+                                                               const rocsparse_int* csr_col_ind,
+                                                               rocsparse_mat_info        info,
+                                                               rocsparse_int batch_count,
+                                                               rocsparse_solve_policy    policy,
+                                                               void* temp_buffer)
+{
+    return rocsparse_csrilu0_strided_batched_template(handle,
+                                                      m,
+                                                      nnz,
+                                                      descr,
+                                                      csr_val,
+                                                      stride_val,
+                                                      csr_row_ptr,
+                                                      csr_col_ind,
+                                                      info,
+                                                      batch_count,
+                                                      policy,
+                                                      temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrilu0_strided_batched(rocsparse_handle          handle,
+                                                               rocsparse_int             m,
+                                                               rocsparse_int             nnz,
+                                                               const rocsparse_mat_descr descr,
+                                                               double*                   csr_val,
+                                                               rocsparse_int             stride_val,
+                                                               const rocsparse_int* csr_row_ptr,
+                                                               const rocsparse_int* csr_col_ind,
+                                                               rocsparse_mat_info        info,
+                                                               rocsparse_int batch_count,
+                                                               rocsparse_solve_policy    policy,
+                                                               void* temp_buffer)
+{
+    return rocsparse_csrilu0_strided_batched_template(handle,
+                                                      m,
+                                                      nnz,
+                                                      descr,
+                                                      csr_val,
+                                                      stride_val,
+                                                      csr_row_ptr,
+                                                      csr_col_ind,
+                                                      info,
+                                                      batch_count,
+                                                      policy,
+                                                      temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_ccsrilu0_strided_batched(rocsparse_handle          handle,
+                                                               rocsparse_int             m,
+                                                               rocsparse_int             nnz,
+                                                               const rocsparse_mat_descr descr,
+                                                               rocsparse_float_complex*  csr_val,
+                                                               rocsparse_int             stride_val,
+                                                               const rocsparse_int* csr_row_ptr,
+                                                               const rocsparse_int* csr_col_ind,
+                                                               rocsparse_mat_info        info,
+                                                               rocsparse_int batch_count,
+                                                               rocsparse_solve_policy    policy,
+                                                               void* temp_buffer)
+{
+    return rocsparse_csrilu0_strided_batched_template(handle,
+                                                      m,
+                                                      nnz,
+                                                      descr,
+                                                      csr_val,
+                                                      stride_val,
+                                                      csr_row_ptr,
+                                                      csr_col_ind,
+                                                      info,
+                                                      batch_count,
+                                                      policy,
+                                                      temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrilu0_strided_batched(rocsparse_handle          handle,
+                                                               rocsparse_int             m,
+                                                               rocsparse_int             nnz,
+                                                               const rocsparse_mat_descr descr,
+                                                               rocsparse_double_complex* csr_val,
+                                                               rocsparse_int             stride_val,
+                                                               const rocsparse_int* csr_row_ptr,
+                                                               const rocsparse_int* csr_col_ind,
+                                                               rocsparse_mat_info        info,
+                                                               rocsparse_int batch_count,
+                                                               rocsparse_solve_policy    policy,
+                                                               void* temp_buffer)
+{
+    return rocsparse_csrilu0_strided_batched_template(handle,
+                                                      m,
+                                                      nnz,
+                                                      descr,
+                                                      csr_val,
+                                                      stride_val,
+                                                      csr_row_ptr,
+                                                      csr_col_ind,
+                                                      info,
+                                                      batch_count,
+                                                      policy,
+                                                      temp_buffer);
+}
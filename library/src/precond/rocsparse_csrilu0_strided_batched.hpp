@@ -0,0 +1,162 @@
+/* ************************************************************************
+ * Copyright (c) 2020 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRILU0_STRIDED_BATCHED_HPP
+#define ROCSPARSE_CSRILU0_STRIDED_BATCHED_HPP
+
+#include "definitions.h"
+#include "rocsparse.h"
+#include "rocsparse_csrilu0.hpp"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T>
+rocsparse_status rocsparse_csrilu0_strided_batched_template(rocsparse_handle          handle,
+                                                            rocsparse_int             m,
+                                                            rocsparse_int             nnz,
+                                                            const rocsparse_mat_descr descr,
+                                                            T*                        csr_val,
+                                                            rocsparse_int             stride_val,
+                                                            const rocsparse_int*      csr_row_ptr,
+                                                            const rocsparse_int*      csr_col_ind,
+                                                            rocsparse_mat_info        info,
+                                                            rocsparse_int             batch_count,
+                                                            rocsparse_solve_policy    policy,
+                                                            void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilu0_strided_batched"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              stride_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              batch_count,
+              policy,
+              (const void*&)temp_buffer);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csrilu0_strided_batched -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> ",
+              "--batch_count",
+              batch_count);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(batch_count < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // The factorization is computed in place, thus the matrices of the batch
+    // must not overlap
+    if(batch_count > 1 && stride_val < nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0 || batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csrilu0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // All matrices of the batch are factorized by a single launch, reusing the
+    // level schedule and diagonal positions of the analysis
+    return rocsparse_csrilu0_dispatch(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_val,
+                                      stride_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      batch_count,
+                                      temp_buffer);
+}
+
+#endif // ROCSPARSE_CSRILU0_STRIDED_BATCHED_HPP
@@ -440,6 +440,65 @@ rocsparse_status rocsparse_destroy_hyb_mat(rocsparse_hyb_mat hyb)
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief Get device memory held by HYB matrix.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_hyb_mat_size(const rocsparse_hyb_mat hyb,
+                                            size_t*                 ell_size,
+                                            size_t*                 coo_size,
+                                            size_t*                 size)
+{
+    // Check for valid pointers
+    if(hyb == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(ell_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(coo_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // ELL part
+    *ell_size = 0;
+
+    if(hyb->ell_col_ind != nullptr)
+    {
+        *ell_size += sizeof(rocsparse_int) * hyb->ell_nnz;
+    }
+    if(hyb->ell_val != nullptr)
+    {
+        *ell_size += hyb->val_size * hyb->ell_nnz;
+    }
+
+    // COO part
+    *coo_size = 0;
+
+    if(hyb->coo_row_ind != nullptr)
+    {
+        *coo_size += sizeof(rocsparse_int) * hyb->coo_nnz;
+    }
+    if(hyb->coo_col_ind != nullptr)
+    {
+        *coo_size += sizeof(rocsparse_int) * hyb->coo_nnz;
+    }
+    if(hyb->coo_val != nullptr)
+    {
+        *coo_size += hyb->val_size * hyb->coo_nnz;
+    }
+
+    *size = *ell_size + *coo_size;
+
+    return rocsparse_status_success;
+}
+
 /********************************************************************************
  * \brief rocsparse_mat_info is a structure holding the matrix info data that is
  * gathered during the analysis routines. It must be initialized by calling
@@ -497,6 +556,31 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
         info->csrilu0_info = nullptr;
     }
 
+    // Uncouple shared meta data
+    if(info->bsrsv_lower_info == info->bsrilu0_info || info->bsrsv_lower_info == info->bsric0_info
+       || info->bsrsv_lower_info == info->bsrsm_lower_info)
+    {
+        info->bsrsv_lower_info = nullptr;
+    }
+
+    // Uncouple shared meta data
+    if(info->bsrsm_lower_info == info->bsrilu0_info || info->bsrsm_lower_info == info->bsric0_info)
+    {
+        info->bsrsm_lower_info = nullptr;
+    }
+
+    // Uncouple shared meta data
+    if(info->bsrilu0_info == info->bsric0_info)
+    {
+        info->bsrilu0_info = nullptr;
+    }
+
+    // Uncouple shared meta data
+    if(info->bsrsv_upper_info == info->bsrsm_upper_info)
+    {
+        info->bsrsv_upper_info = nullptr;
+    }
+
     // Uncouple shared meta data
     if(info->csrsv_upper_info == info->csrsm_upper_info)
     {
@@ -521,6 +605,30 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_info(info->csrmv_info));
     }
 
+    // Clear bsrmv info struct
+    if(info->bsrmv_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_bsrmv_info(info->bsrmv_info));
+    }
+
+    // Clear csrmm info struct
+    if(info->csrmm_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_bsrmv_info(info->csrmm_info));
+    }
+
+    // Clear bsrmm info struct
+    if(info->bsrmm_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_bsrmv_info(info->bsrmm_info));
+    }
+
+    // Clear csrmv_format info struct
+    if(info->csrmv_format_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_format_info(info->csrmv_format_info));
+    }
+
     // Clear bsrsvt upper info struct
     if(info->bsrsvt_upper_info != nullptr)
     {
@@ -569,6 +677,18 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->csrilu0_info));
     }
 
+    // Clear bsric0 info struct
+    if(info->bsric0_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->bsric0_info));
+    }
+
+    // Clear bsrilu0 info struct
+    if(info->bsrilu0_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->bsrilu0_info));
+    }
+
     // Clear bsrsv upper info struct
     if(info->bsrsv_upper_info != nullptr)
     {
@@ -581,6 +701,18 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->bsrsv_lower_info));
     }
 
+    // Clear bsrsm upper info struct
+    if(info->bsrsm_upper_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->bsrsm_upper_info));
+    }
+
+    // Clear bsrsm lower info struct
+    if(info->bsrsm_lower_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->bsrsm_lower_info));
+    }
+
     // Clear csrsv upper info struct
     if(info->csrsv_upper_info != nullptr)
     {
@@ -611,6 +743,12 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrgemm_info(info->csrgemm_info));
     }
 
+    // Clear csrrap info struct
+    if(info->csrrap_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrrap_info(info->csrrap_info));
+    }
+
     // Clear zero pivot
     if(info->zero_pivot != nullptr)
     {
@@ -630,6 +768,203 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief Get device memory held by mat info.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_mat_info_size(const rocsparse_mat_info info,
+                                             rocsparse_info_component component,
+                                             size_t*                  size)
+{
+    // Check for valid pointers
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // All trm info slots and the component they belong to
+    struct
+    {
+        rocsparse_info_component component;
+        rocsparse_trm_info       trm;
+    } slots[] = {{rocsparse_info_component_csrsv, info->csrsv_lower_info},
+                 {rocsparse_info_component_csrsv, info->csrsv_upper_info},
+                 {rocsparse_info_component_csrsv, info->csrsvt_lower_info},
+                 {rocsparse_info_component_csrsv, info->csrsvt_upper_info},
+                 {rocsparse_info_component_csrsm, info->csrsm_lower_info},
+                 {rocsparse_info_component_csrsm, info->csrsm_upper_info},
+                 {rocsparse_info_component_csrsm, info->csrsmt_lower_info},
+                 {rocsparse_info_component_csrsm, info->csrsmt_upper_info},
+                 {rocsparse_info_component_csrilu0, info->csrilu0_info},
+                 {rocsparse_info_component_csric0, info->csric0_info},
+                 {rocsparse_info_component_bsrsv, info->bsrsv_lower_info},
+                 {rocsparse_info_component_bsrsv, info->bsrsv_upper_info},
+                 {rocsparse_info_component_bsrsv, info->bsrsvt_lower_info},
+                 {rocsparse_info_component_bsrsv, info->bsrsvt_upper_info},
+                 {rocsparse_info_component_bsrsm, info->bsrsm_lower_info},
+                 {rocsparse_info_component_bsrsm, info->bsrsm_upper_info},
+                 {rocsparse_info_component_bsric0, info->bsric0_info},
+                 {rocsparse_info_component_bsrilu0, info->bsrilu0_info}};
+
+    static constexpr int nslots = sizeof(slots) / sizeof(slots[0]);
+
+    *size = 0;
+
+    switch(component)
+    {
+    case rocsparse_info_component_csrmv:
+    {
+        *size = rocsparse_csrmv_info_size(info->csrmv_info);
+        return rocsparse_status_success;
+    }
+    case rocsparse_info_component_bsrmv:
+    {
+        *size = rocsparse_bsrmv_info_size(info->bsrmv_info);
+        return rocsparse_status_success;
+    }
+    case rocsparse_info_component_csrmm:
+    {
+        *size = rocsparse_bsrmv_info_size(info->csrmm_info);
+        return rocsparse_status_success;
+    }
+    case rocsparse_info_component_bsrmm:
+    {
+        *size = rocsparse_bsrmv_info_size(info->bsrmm_info);
+        return rocsparse_status_success;
+    }
+    case rocsparse_info_component_csrmv_format:
+    {
+        *size = rocsparse_csrmv_format_info_size(info->csrmv_format_info);
+        return rocsparse_status_success;
+    }
+    case rocsparse_info_component_csrrap:
+    {
+        *size = rocsparse_csrrap_info_size(info->csrrap_info);
+        return rocsparse_status_success;
+    }
+    case rocsparse_info_component_csrgemm:
+    {
+        *size = rocsparse_csrgemm_info_size(info->csrgemm_info);
+        return rocsparse_status_success;
+    }
+    case rocsparse_info_component_csrsv:
+    case rocsparse_info_component_csrsm:
+    case rocsparse_info_component_csrilu0:
+    case rocsparse_info_component_csric0:
+    case rocsparse_info_component_bsrsv:
+    case rocsparse_info_component_bsrsm:
+    case rocsparse_info_component_bsric0:
+    case rocsparse_info_component_bsrilu0:
+    {
+        for(int i = 0; i < nslots; ++i)
+        {
+            if(slots[i].component != component || slots[i].trm == nullptr)
+            {
+                continue;
+            }
+
+            // Count each structure only once per component
+            bool seen = false;
+            for(int j = 0; j < i; ++j)
+            {
+                if(slots[j].component == component && slots[j].trm == slots[i].trm)
+                {
+                    seen = true;
+                    break;
+                }
+            }
+
+            if(!seen)
+            {
+                *size += rocsparse_trm_info_size(slots[i].trm);
+            }
+        }
+
+        return rocsparse_status_success;
+    }
+    case rocsparse_info_component_total:
+    case rocsparse_info_component_shared:
+    {
+        for(int i = 0; i < nslots; ++i)
+        {
+            if(slots[i].trm == nullptr)
+            {
+                continue;
+            }
+
+            // Skip structures that have already been accounted for
+            bool seen = false;
+            for(int j = 0; j < i; ++j)
+            {
+                if(slots[j].trm == slots[i].trm)
+                {
+                    seen = true;
+                    break;
+                }
+            }
+
+            if(seen)
+            {
+                continue;
+            }
+
+            // Check whether another component references the same structure
+            bool shared = false;
+            for(int j = i + 1; j < nslots; ++j)
+            {
+                if(slots[j].trm == slots[i].trm && slots[j].component != slots[i].component)
+                {
+                    shared = true;
+                    break;
+                }
+            }
+
+            if(component == rocsparse_info_component_total || shared)
+            {
+                *size += rocsparse_trm_info_size(slots[i].trm);
+            }
+        }
+
+        if(component == rocsparse_info_component_total)
+        {
+            // csrmv meta data
+            *size += rocsparse_csrmv_info_size(info->csrmv_info);
+
+            // bsrmv meta data
+            *size += rocsparse_bsrmv_info_size(info->bsrmv_info);
+
+            // csrmm meta data
+            *size += rocsparse_bsrmv_info_size(info->csrmm_info);
+
+            // bsrmm meta data
+            *size += rocsparse_bsrmv_info_size(info->bsrmm_info);
+
+            // csrmv_format meta data
+            *size += rocsparse_csrmv_format_info_size(info->csrmv_format_info);
+
+            // csrrap meta data
+            *size += rocsparse_csrrap_info_size(info->csrrap_info);
+
+            // csrgemm meta data
+            *size += rocsparse_csrgemm_info_size(info->csrgemm_info);
+
+            // zero pivot
+            if(info->zero_pivot != nullptr)
+            {
+                *size += sizeof(rocsparse_int);
+            }
+        }
+
+        return rocsparse_status_success;
+    }
+    }
+
+    return rocsparse_status_invalid_value;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -73,6 +73,12 @@ module rocsparse
         enumerator :: rocsparse_direction_column = 1
     end enum
 
+!   rocsparse_order
+    enum, bind(c)
+        enumerator :: rocsparse_order_row = 0
+        enumerator :: rocsparse_order_column = 1
+    end enum
+
 !   rocsparse_hyb_partition
     enum, bind(c)
         enumerator :: rocsparse_hyb_partition_auto = 0
@@ -80,6 +86,35 @@ module rocsparse
         enumerator :: rocsparse_hyb_partition_max = 2
     end enum
 
+!   rocsparse_spmv_format
+    enum, bind(c)
+        enumerator :: rocsparse_spmv_format_csr = 0
+        enumerator :: rocsparse_spmv_format_ell = 1
+        enumerator :: rocsparse_spmv_format_hyb = 2
+        enumerator :: rocsparse_spmv_format_bsr = 3
+    end enum
+
+!   rocsparse_info_component
+    enum, bind(c)
+        enumerator :: rocsparse_info_component_total = 0
+        enumerator :: rocsparse_info_component_csrmv = 1
+        enumerator :: rocsparse_info_component_csrsv = 2
+        enumerator :: rocsparse_info_component_csrsm = 3
+        enumerator :: rocsparse_info_component_csrilu0 = 4
+        enumerator :: rocsparse_info_component_csric0 = 5
+        enumerator :: rocsparse_info_component_bsrsv = 6
+        enumerator :: rocsparse_info_component_bsric0 = 7
+        enumerator :: rocsparse_info_component_bsrilu0 = 8
+        enumerator :: rocsparse_info_component_shared = 9
+        enumerator :: rocsparse_info_component_bsrsm = 10
+        enumerator :: rocsparse_info_component_bsrmv = 11
+        enumerator :: rocsparse_info_component_csrrap = 12
+        enumerator :: rocsparse_info_component_csrgemm = 13
+        enumerator :: rocsparse_info_component_csrmv_format = 14
+        enumerator :: rocsparse_info_component_csrmm = 15
+        enumerator :: rocsparse_info_component_bsrmm = 16
+    end enum
+
 !   rocsparse_analysis_policy
     enum, bind(c)
         enumerator :: rocsparse_analysis_policy_reuse = 0
@@ -313,6 +348,17 @@ module rocsparse
             type(c_ptr), value :: hyb
         end function rocsparse_destroy_hyb_mat
 
+        function rocsparse_get_hyb_mat_size(hyb, ell_size, coo_size, size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_get_hyb_mat_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), intent(in), value :: hyb
+            type(c_ptr), value :: ell_size
+            type(c_ptr), value :: coo_size
+            type(c_ptr), value :: size
+        end function rocsparse_get_hyb_mat_size
+
 !       rocsparse_mat_info
         function rocsparse_create_mat_info(info) &
                 result(c_int) &
@@ -330,6 +376,16 @@ module rocsparse
             type(c_ptr), value :: info
         end function rocsparse_destroy_mat_info
 
+        function rocsparse_get_mat_info_size(info, component, size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_get_mat_info_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), intent(in), value :: info
+            integer(c_int), value :: component
+            type(c_ptr), value :: size
+        end function rocsparse_get_mat_info_size
+
 ! ===========================================================================
 !   level 1 SPARSE
 ! ===========================================================================
@@ -764,28 +820,65 @@ module rocsparse
             type(c_ptr), value :: y
         end function rocsparse_zbsrmv
 
-!       rocsparse_bsrsv_zero_pivot
-        function rocsparse_bsrsv_zero_pivot(handle, info, position) &
+!       rocsparse_bsrmv_mixed
+        function rocsparse_shbsrmv(handle, dir, trans, mb, nb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_bsrsv_zero_pivot')
+                bind(c, name = 'rocsparse_shbsrmv')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            type(c_ptr), value :: info
-            type(c_ptr), value :: position
-        end function rocsparse_bsrsv_zero_pivot
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: bsr_dim
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_shbsrmv
 
-!       rocsparse_bsrsv_buffer_size
-        function rocsparse_sbsrsv_buffer_size(handle, dir, trans, mb, nnzb, descr, &
-                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, buffer_size) &
+        function rocsparse_sbbsrmv(handle, dir, trans, mb, nb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_sbsrsv_buffer_size')
+                bind(c, name = 'rocsparse_sbbsrmv')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: bsr_dim
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_sbbsrmv
+
+!       rocsparse_bsrmv_ex_analysis
+        function rocsparse_sbsrmv_ex_analysis(handle, dir, trans, mb, nb, nnzb, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_sbsrmv_ex_analysis')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
             integer(c_int), value :: trans
             integer(c_int), value :: mb
+            integer(c_int), value :: nb
             integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: bsr_val
@@ -793,19 +886,19 @@ module rocsparse
             type(c_ptr), intent(in), value :: bsr_col_ind
             integer(c_int), value :: bsr_dim
             type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_sbsrsv_buffer_size
+        end function rocsparse_sbsrmv_ex_analysis
 
-        function rocsparse_dbsrsv_buffer_size(handle, dir, trans, mb, nnzb, descr, &
-                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, buffer_size) &
+        function rocsparse_dbsrmv_ex_analysis(handle, dir, trans, mb, nb, nnzb, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dbsrsv_buffer_size')
+                bind(c, name = 'rocsparse_dbsrmv_ex_analysis')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
             integer(c_int), value :: trans
             integer(c_int), value :: mb
+            integer(c_int), value :: nb
             integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: bsr_val
@@ -813,19 +906,19 @@ module rocsparse
             type(c_ptr), intent(in), value :: bsr_col_ind
             integer(c_int), value :: bsr_dim
             type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_dbsrsv_buffer_size
+        end function rocsparse_dbsrmv_ex_analysis
 
-        function rocsparse_cbsrsv_buffer_size(handle, dir, trans, mb, nnzb, descr, &
-                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, buffer_size) &
+        function rocsparse_cbsrmv_ex_analysis(handle, dir, trans, mb, nb, nnzb, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_cbsrsv_buffer_size')
+                bind(c, name = 'rocsparse_cbsrmv_ex_analysis')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
             integer(c_int), value :: trans
             integer(c_int), value :: mb
+            integer(c_int), value :: nb
             integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: bsr_val
@@ -833,19 +926,19 @@ module rocsparse
             type(c_ptr), intent(in), value :: bsr_col_ind
             integer(c_int), value :: bsr_dim
             type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_cbsrsv_buffer_size
+        end function rocsparse_cbsrmv_ex_analysis
 
-        function rocsparse_zbsrsv_buffer_size(handle, dir, trans, mb, nnzb, descr, &
-                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, buffer_size) &
+        function rocsparse_zbsrmv_ex_analysis(handle, dir, trans, mb, nb, nnzb, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zbsrsv_buffer_size')
+                bind(c, name = 'rocsparse_zbsrmv_ex_analysis')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
             integer(c_int), value :: trans
             integer(c_int), value :: mb
+            integer(c_int), value :: nb
             integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: bsr_val
@@ -853,124 +946,127 @@ module rocsparse
             type(c_ptr), intent(in), value :: bsr_col_ind
             integer(c_int), value :: bsr_dim
             type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_zbsrsv_buffer_size
+        end function rocsparse_zbsrmv_ex_analysis
 
-!       rocsparse_bsrsv_analysis
-        function rocsparse_sbsrsv_analysis(handle, dir, trans, mb, nnzb, descr, &
-                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, analysis, solve, &
-                temp_buffer) &
+!       rocsparse_bsrmv_ex
+        function rocsparse_sbsrmv_ex(handle, dir, trans, mb, nb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_sbsrsv_analysis')
+                bind(c, name = 'rocsparse_sbsrmv_ex')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
             integer(c_int), value :: trans
             integer(c_int), value :: mb
+            integer(c_int), value :: nb
             integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: bsr_val
             type(c_ptr), intent(in), value :: bsr_row_ptr
             type(c_ptr), intent(in), value :: bsr_col_ind
             integer(c_int), value :: bsr_dim
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_sbsrsv_analysis
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_sbsrmv_ex
 
-        function rocsparse_dbsrsv_analysis(handle, dir, trans, mb, nnzb, descr, &
-                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, analysis, solve, &
-                temp_buffer) &
+        function rocsparse_dbsrmv_ex(handle, dir, trans, mb, nb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dbsrsv_analysis')
+                bind(c, name = 'rocsparse_dbsrmv_ex')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
             integer(c_int), value :: trans
             integer(c_int), value :: mb
+            integer(c_int), value :: nb
             integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: bsr_val
             type(c_ptr), intent(in), value :: bsr_row_ptr
             type(c_ptr), intent(in), value :: bsr_col_ind
             integer(c_int), value :: bsr_dim
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_dbsrsv_analysis
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_dbsrmv_ex
 
-        function rocsparse_cbsrsv_analysis(handle, dir, trans, mb, nnzb, descr, &
-                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, analysis, solve, &
-                temp_buffer) &
+        function rocsparse_cbsrmv_ex(handle, dir, trans, mb, nb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_cbsrsv_analysis')
+                bind(c, name = 'rocsparse_cbsrmv_ex')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
             integer(c_int), value :: trans
             integer(c_int), value :: mb
+            integer(c_int), value :: nb
             integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: bsr_val
             type(c_ptr), intent(in), value :: bsr_row_ptr
             type(c_ptr), intent(in), value :: bsr_col_ind
             integer(c_int), value :: bsr_dim
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_cbsrsv_analysis
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_cbsrmv_ex
 
-        function rocsparse_zbsrsv_analysis(handle, dir, trans, mb, nnzb, descr, &
-                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, analysis, solve, &
-                temp_buffer) &
+        function rocsparse_zbsrmv_ex(handle, dir, trans, mb, nb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zbsrsv_analysis')
+                bind(c, name = 'rocsparse_zbsrmv_ex')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
             integer(c_int), value :: trans
             integer(c_int), value :: mb
+            integer(c_int), value :: nb
             integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: bsr_val
             type(c_ptr), intent(in), value :: bsr_row_ptr
             type(c_ptr), intent(in), value :: bsr_col_ind
             integer(c_int), value :: bsr_dim
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_zbsrsv_analysis
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_zbsrmv_ex
 
-!       rocsparse_bsrsv_clear
-        function rocsparse_bsrsv_clear(handle, info) &
+!       rocsparse_bsrmv_ex_clear
+        function rocsparse_bsrmv_ex_clear(handle, info) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_bsrsv_clear')
+                bind(c, name = 'rocsparse_bsrmv_ex_clear')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             type(c_ptr), value :: info
-        end function rocsparse_bsrsv_clear
+        end function rocsparse_bsrmv_ex_clear
 
-!       rocsparse_bsrsv_solve
-        function rocsparse_sbsrsv_solve(handle, dir, trans, mb, nnzb, alpha, descr, &
-                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, x, y, policy, &
-                temp_buffer) &
+!       rocsparse_bsrmv_dot
+        function rocsparse_sbsrmv_dot(handle, dir, trans, mb, nb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, x, beta, y, dot_xy, dot_yy) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_sbsrsv_solve')
+                bind(c, name = 'rocsparse_sbsrmv_dot')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
             integer(c_int), value :: trans
             integer(c_int), value :: mb
+            integer(c_int), value :: nb
             integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
@@ -978,24 +1074,24 @@ module rocsparse
             type(c_ptr), intent(in), value :: bsr_row_ptr
             type(c_ptr), intent(in), value :: bsr_col_ind
             integer(c_int), value :: bsr_dim
-            type(c_ptr), value :: info
             type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: y
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_sbsrsv_solve
+            type(c_ptr), value :: dot_xy
+            type(c_ptr), value :: dot_yy
+        end function rocsparse_sbsrmv_dot
 
-        function rocsparse_dbsrsv_solve(handle, dir, trans, mb, nnzb, alpha, descr, &
-                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, x, y, policy, &
-                temp_buffer) &
+        function rocsparse_dbsrmv_dot(handle, dir, trans, mb, nb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, x, beta, y, dot_xy, dot_yy) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dbsrsv_solve')
+                bind(c, name = 'rocsparse_dbsrmv_dot')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
             integer(c_int), value :: trans
             integer(c_int), value :: mb
+            integer(c_int), value :: nb
             integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
@@ -1003,24 +1099,24 @@ module rocsparse
             type(c_ptr), intent(in), value :: bsr_row_ptr
             type(c_ptr), intent(in), value :: bsr_col_ind
             integer(c_int), value :: bsr_dim
-            type(c_ptr), value :: info
             type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: y
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_dbsrsv_solve
+            type(c_ptr), value :: dot_xy
+            type(c_ptr), value :: dot_yy
+        end function rocsparse_dbsrmv_dot
 
-        function rocsparse_cbsrsv_solve(handle, dir, trans, mb, nnzb, alpha, descr, &
-                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, x, y, policy, &
-                temp_buffer) &
+        function rocsparse_cbsrmv_dot(handle, dir, trans, mb, nb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, x, beta, y, dot_xy, dot_yy) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_cbsrsv_solve')
+                bind(c, name = 'rocsparse_cbsrmv_dot')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
             integer(c_int), value :: trans
             integer(c_int), value :: mb
+            integer(c_int), value :: nb
             integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
@@ -1028,24 +1124,24 @@ module rocsparse
             type(c_ptr), intent(in), value :: bsr_row_ptr
             type(c_ptr), intent(in), value :: bsr_col_ind
             integer(c_int), value :: bsr_dim
-            type(c_ptr), value :: info
             type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: y
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_cbsrsv_solve
+            type(c_ptr), value :: dot_xy
+            type(c_ptr), value :: dot_yy
+        end function rocsparse_cbsrmv_dot
 
-        function rocsparse_zbsrsv_solve(handle, dir, trans, mb, nnzb, alpha, descr, &
-                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, x, y, policy, &
-                temp_buffer) &
+        function rocsparse_zbsrmv_dot(handle, dir, trans, mb, nb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, x, beta, y, dot_xy, dot_yy) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zbsrsv_solve')
+                bind(c, name = 'rocsparse_zbsrmv_dot')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: dir
             integer(c_int), value :: trans
             integer(c_int), value :: mb
+            integer(c_int), value :: nb
             integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
@@ -1053,103 +1149,124 @@ module rocsparse
             type(c_ptr), intent(in), value :: bsr_row_ptr
             type(c_ptr), intent(in), value :: bsr_col_ind
             integer(c_int), value :: bsr_dim
-            type(c_ptr), value :: info
             type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: y
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_zbsrsv_solve
+            type(c_ptr), value :: dot_xy
+            type(c_ptr), value :: dot_yy
+        end function rocsparse_zbsrmv_dot
 
-!       rocsparse_coomv
-        function rocsparse_scoomv(handle, trans, m, n, nnz, alpha, descr, coo_val, &
-                coo_row_ind, coo_col_ind, x, beta, y) &
+!       rocsparse_vbrmv
+        function rocsparse_svbrmv(handle, dir, trans, mb, nb, nnzb, alpha, descr, &
+                vbr_val, vbr_val_ptr, vbr_row_ptr, vbr_col_ind, vbr_row_ptn, &
+                vbr_col_ptn, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_scoomv')
+                bind(c, name = 'rocsparse_svbrmv')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: nnz
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: coo_val
-            type(c_ptr), intent(in), value :: coo_row_ind
-            type(c_ptr), intent(in), value :: coo_col_ind
+            type(c_ptr), intent(in), value :: vbr_val
+            type(c_ptr), intent(in), value :: vbr_val_ptr
+            type(c_ptr), intent(in), value :: vbr_row_ptr
+            type(c_ptr), intent(in), value :: vbr_col_ind
+            type(c_ptr), intent(in), value :: vbr_row_ptn
+            type(c_ptr), intent(in), value :: vbr_col_ptn
             type(c_ptr), intent(in), value :: x
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: y
-        end function rocsparse_scoomv
+        end function rocsparse_svbrmv
 
-        function rocsparse_dcoomv(handle, trans, m, n, nnz, alpha, descr, coo_val, &
-                coo_row_ind, coo_col_ind, x, beta, y) &
+        function rocsparse_dvbrmv(handle, dir, trans, mb, nb, nnzb, alpha, descr, &
+                vbr_val, vbr_val_ptr, vbr_row_ptr, vbr_col_ind, vbr_row_ptn, &
+                vbr_col_ptn, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dcoomv')
+                bind(c, name = 'rocsparse_dvbrmv')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: nnz
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: coo_val
-            type(c_ptr), intent(in), value :: coo_row_ind
-            type(c_ptr), intent(in), value :: coo_col_ind
+            type(c_ptr), intent(in), value :: vbr_val
+            type(c_ptr), intent(in), value :: vbr_val_ptr
+            type(c_ptr), intent(in), value :: vbr_row_ptr
+            type(c_ptr), intent(in), value :: vbr_col_ind
+            type(c_ptr), intent(in), value :: vbr_row_ptn
+            type(c_ptr), intent(in), value :: vbr_col_ptn
             type(c_ptr), intent(in), value :: x
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: y
-        end function rocsparse_dcoomv
+        end function rocsparse_dvbrmv
 
-        function rocsparse_ccoomv(handle, trans, m, n, nnz, alpha, descr, coo_val, &
-                coo_row_ind, coo_col_ind, x, beta, y) &
+        function rocsparse_cvbrmv(handle, dir, trans, mb, nb, nnzb, alpha, descr, &
+                vbr_val, vbr_val_ptr, vbr_row_ptr, vbr_col_ind, vbr_row_ptn, &
+                vbr_col_ptn, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_ccoomv')
+                bind(c, name = 'rocsparse_cvbrmv')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: nnz
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: coo_val
-            type(c_ptr), intent(in), value :: coo_row_ind
-            type(c_ptr), intent(in), value :: coo_col_ind
+            type(c_ptr), intent(in), value :: vbr_val
+            type(c_ptr), intent(in), value :: vbr_val_ptr
+            type(c_ptr), intent(in), value :: vbr_row_ptr
+            type(c_ptr), intent(in), value :: vbr_col_ind
+            type(c_ptr), intent(in), value :: vbr_row_ptn
+            type(c_ptr), intent(in), value :: vbr_col_ptn
             type(c_ptr), intent(in), value :: x
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: y
-        end function rocsparse_ccoomv
+        end function rocsparse_cvbrmv
 
-        function rocsparse_zcoomv(handle, trans, m, n, nnz, alpha, descr, coo_val, &
-                coo_row_ind, coo_col_ind, x, beta, y) &
+        function rocsparse_zvbrmv(handle, dir, trans, mb, nb, nnzb, alpha, descr, &
+                vbr_val, vbr_val_ptr, vbr_row_ptr, vbr_col_ind, vbr_row_ptn, &
+                vbr_col_ptn, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zcoomv')
+                bind(c, name = 'rocsparse_zvbrmv')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: nnz
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: coo_val
-            type(c_ptr), intent(in), value :: coo_row_ind
-            type(c_ptr), intent(in), value :: coo_col_ind
+            type(c_ptr), intent(in), value :: vbr_val
+            type(c_ptr), intent(in), value :: vbr_val_ptr
+            type(c_ptr), intent(in), value :: vbr_row_ptr
+            type(c_ptr), intent(in), value :: vbr_col_ind
+            type(c_ptr), intent(in), value :: vbr_row_ptn
+            type(c_ptr), intent(in), value :: vbr_col_ptn
             type(c_ptr), intent(in), value :: x
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: y
-        end function rocsparse_zcoomv
+        end function rocsparse_zvbrmv
 
-!       rocsparse_csrmv_analysis
-        function rocsparse_scsrmv_analysis(handle, trans, m, n, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info) &
+!       rocsparse_csrdcmv
+        function rocsparse_scsrdcmv(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, delta_bits, csrdc_col_base, csrdc_delta, csrdc_exc_ptr, &
+                csrdc_exc_col, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_scsrmv_analysis')
+                bind(c, name = 'rocsparse_scsrdcmv')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
@@ -1157,17 +1274,25 @@ module rocsparse
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-        end function rocsparse_scsrmv_analysis
+            integer(c_int), value :: delta_bits
+            type(c_ptr), intent(in), value :: csrdc_col_base
+            type(c_ptr), intent(in), value :: csrdc_delta
+            type(c_ptr), intent(in), value :: csrdc_exc_ptr
+            type(c_ptr), intent(in), value :: csrdc_exc_col
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_scsrdcmv
 
-        function rocsparse_dcsrmv_analysis(handle, trans, m, n, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info) &
+        function rocsparse_dcsrdcmv(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, delta_bits, csrdc_col_base, csrdc_delta, csrdc_exc_ptr, &
+                csrdc_exc_col, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dcsrmv_analysis')
+                bind(c, name = 'rocsparse_dcsrdcmv')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
@@ -1175,108 +1300,25 @@ module rocsparse
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-        end function rocsparse_dcsrmv_analysis
-
-        function rocsparse_ccsrmv_analysis(handle, trans, m, n, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info) &
-                result(c_int) &
-                bind(c, name = 'rocsparse_ccsrmv_analysis')
-            use iso_c_binding
-            implicit none
-            type(c_ptr), intent(in), value :: handle
-            integer(c_int), intent(in), value :: trans
-            integer(c_int), intent(in), value :: m
-            integer(c_int), intent(in), value :: n
-            integer(c_int), intent(in), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-        end function rocsparse_ccsrmv_analysis
-
-        function rocsparse_zcsrmv_analysis(handle, trans, m, n, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info) &
-                result(c_int) &
-                bind(c, name = 'rocsparse_zcsrmv_analysis')
-            use iso_c_binding
-            implicit none
-            type(c_ptr), value :: handle
-            integer(c_int), value :: trans
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-        end function rocsparse_zcsrmv_analysis
-
-!       rocsparse_csrmv_clear
-        function rocsparse_csrmv_clear(handle, info) &
-                result(c_int) &
-                bind(c, name = 'rocsparse_csrmv_clear')
-            use iso_c_binding
-            implicit none
-            type(c_ptr), value :: handle
-            type(c_ptr), value :: info
-        end function rocsparse_csrmv_clear
-
-!       rocsparse_csrmv
-        function rocsparse_scsrmv(handle, trans, m, n, nnz, alpha, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, x, beta, y) &
-                result(c_int) &
-                bind(c, name = 'rocsparse_scsrmv')
-            use iso_c_binding
-            implicit none
-            type(c_ptr), value :: handle
-            integer(c_int), value :: trans
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-            type(c_ptr), intent(in), value :: x
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: y
-        end function rocsparse_scsrmv
-
-        function rocsparse_dcsrmv(handle, trans, m, n, nnz, alpha, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, x, beta, y) &
-                result(c_int) &
-                bind(c, name = 'rocsparse_dcsrmv')
-            use iso_c_binding
-            implicit none
-            type(c_ptr), value :: handle
-            integer(c_int), value :: trans
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
+            integer(c_int), value :: delta_bits
+            type(c_ptr), intent(in), value :: csrdc_col_base
+            type(c_ptr), intent(in), value :: csrdc_delta
+            type(c_ptr), intent(in), value :: csrdc_exc_ptr
+            type(c_ptr), intent(in), value :: csrdc_exc_col
             type(c_ptr), intent(in), value :: x
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: y
-        end function rocsparse_dcsrmv
+        end function rocsparse_dcsrdcmv
 
-        function rocsparse_ccsrmv(handle, trans, m, n, nnz, alpha, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, x, beta, y) &
+        function rocsparse_ccsrdcmv(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, delta_bits, csrdc_col_base, csrdc_delta, csrdc_exc_ptr, &
+                csrdc_exc_col, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_ccsrmv')
+                bind(c, name = 'rocsparse_ccsrdcmv')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
@@ -1288,17 +1330,21 @@ module rocsparse
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
+            integer(c_int), value :: delta_bits
+            type(c_ptr), intent(in), value :: csrdc_col_base
+            type(c_ptr), intent(in), value :: csrdc_delta
+            type(c_ptr), intent(in), value :: csrdc_exc_ptr
+            type(c_ptr), intent(in), value :: csrdc_exc_col
             type(c_ptr), intent(in), value :: x
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: y
-        end function rocsparse_ccsrmv
+        end function rocsparse_ccsrdcmv
 
-        function rocsparse_zcsrmv(handle, trans, m, n, nnz, alpha, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, x, beta, y) &
+        function rocsparse_zcsrdcmv(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, delta_bits, csrdc_col_base, csrdc_delta, csrdc_exc_ptr, &
+                csrdc_exc_col, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zcsrmv')
+                bind(c, name = 'rocsparse_zcsrdcmv')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
@@ -1310,1215 +1356,4800 @@ module rocsparse
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
+            integer(c_int), value :: delta_bits
+            type(c_ptr), intent(in), value :: csrdc_col_base
+            type(c_ptr), intent(in), value :: csrdc_delta
+            type(c_ptr), intent(in), value :: csrdc_exc_ptr
+            type(c_ptr), intent(in), value :: csrdc_exc_col
             type(c_ptr), intent(in), value :: x
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: y
-        end function rocsparse_zcsrmv
+        end function rocsparse_zcsrdcmv
 
-!       rocsparse_csrsv_zero_pivot
-        function rocsparse_csrsv_zero_pivot(handle, descr, info, position) &
+!       rocsparse_bsrsv_zero_pivot
+        function rocsparse_bsrsv_zero_pivot(handle, info, position) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_csrsv_zero_pivot')
+                bind(c, name = 'rocsparse_bsrsv_zero_pivot')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            type(c_ptr), intent(in), value :: descr
             type(c_ptr), value :: info
             type(c_ptr), value :: position
-        end function rocsparse_csrsv_zero_pivot
+        end function rocsparse_bsrsv_zero_pivot
 
-!       rocsparse_csrsv_buffer_size
-        function rocsparse_scsrsv_buffer_size(handle, trans, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
+!       rocsparse_bsrsv_buffer_size
+        function rocsparse_sbsrsv_buffer_size(handle, dir, trans, mb, nnzb, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, buffer_size) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_scsrsv_buffer_size')
+                bind(c, name = 'rocsparse_sbsrsv_buffer_size')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans
-            integer(c_int), value :: m
-            integer(c_int), value :: nnz
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: bsr_dim
             type(c_ptr), value :: info
             type(c_ptr), value :: buffer_size
-        end function rocsparse_scsrsv_buffer_size
+        end function rocsparse_sbsrsv_buffer_size
 
-        function rocsparse_dcsrsv_buffer_size(handle, trans, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
+        function rocsparse_dbsrsv_buffer_size(handle, dir, trans, mb, nnzb, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, buffer_size) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dcsrsv_buffer_size')
+                bind(c, name = 'rocsparse_dbsrsv_buffer_size')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans
-            integer(c_int), value :: m
-            integer(c_int), value :: nnz
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: bsr_dim
             type(c_ptr), value :: info
             type(c_ptr), value :: buffer_size
-        end function rocsparse_dcsrsv_buffer_size
+        end function rocsparse_dbsrsv_buffer_size
 
-        function rocsparse_ccsrsv_buffer_size(handle, trans, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
+        function rocsparse_cbsrsv_buffer_size(handle, dir, trans, mb, nnzb, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, buffer_size) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_ccsrsv_buffer_size')
+                bind(c, name = 'rocsparse_cbsrsv_buffer_size')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans
-            integer(c_int), value :: m
-            integer(c_int), value :: nnz
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: bsr_dim
             type(c_ptr), value :: info
             type(c_ptr), value :: buffer_size
-        end function rocsparse_ccsrsv_buffer_size
+        end function rocsparse_cbsrsv_buffer_size
 
-        function rocsparse_zcsrsv_buffer_size(handle, trans, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
+        function rocsparse_zbsrsv_buffer_size(handle, dir, trans, mb, nnzb, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, buffer_size) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zcsrsv_buffer_size')
+                bind(c, name = 'rocsparse_zbsrsv_buffer_size')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans
-            integer(c_int), value :: m
-            integer(c_int), value :: nnz
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: bsr_dim
             type(c_ptr), value :: info
             type(c_ptr), value :: buffer_size
-        end function rocsparse_zcsrsv_buffer_size
+        end function rocsparse_zbsrsv_buffer_size
 
-!       rocsparse_csrsv_analysis
-        function rocsparse_scsrsv_analysis(handle, trans, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+!       rocsparse_bsrsv_analysis
+        function rocsparse_sbsrsv_analysis(handle, dir, trans, mb, nnzb, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, analysis, solve, &
+                temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_scsrsv_analysis')
+                bind(c, name = 'rocsparse_sbsrsv_analysis')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans
-            integer(c_int), value :: m
-            integer(c_int), value :: nnz
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: bsr_dim
             type(c_ptr), value :: info
             integer(c_int), value :: analysis
             integer(c_int), value :: solve
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsrsv_analysis
+        end function rocsparse_sbsrsv_analysis
 
-        function rocsparse_dcsrsv_analysis(handle, trans, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+        function rocsparse_dbsrsv_analysis(handle, dir, trans, mb, nnzb, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, analysis, solve, &
+                temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dcsrsv_analysis')
+                bind(c, name = 'rocsparse_dbsrsv_analysis')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans
-            integer(c_int), value :: m
-            integer(c_int), value :: nnz
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: bsr_dim
             type(c_ptr), value :: info
             integer(c_int), value :: analysis
             integer(c_int), value :: solve
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsrsv_analysis
+        end function rocsparse_dbsrsv_analysis
 
-        function rocsparse_ccsrsv_analysis(handle, trans, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+        function rocsparse_cbsrsv_analysis(handle, dir, trans, mb, nnzb, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, analysis, solve, &
+                temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_ccsrsv_analysis')
+                bind(c, name = 'rocsparse_cbsrsv_analysis')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans
-            integer(c_int), value :: m
-            integer(c_int), value :: nnz
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: bsr_dim
             type(c_ptr), value :: info
             integer(c_int), value :: analysis
             integer(c_int), value :: solve
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsrsv_analysis
+        end function rocsparse_cbsrsv_analysis
 
-        function rocsparse_zcsrsv_analysis(handle, trans, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+        function rocsparse_zbsrsv_analysis(handle, dir, trans, mb, nnzb, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, analysis, solve, &
+                temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zcsrsv_analysis')
+                bind(c, name = 'rocsparse_zbsrsv_analysis')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans
-            integer(c_int), value :: m
-            integer(c_int), value :: nnz
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: bsr_dim
             type(c_ptr), value :: info
             integer(c_int), value :: analysis
             integer(c_int), value :: solve
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsrsv_analysis
+        end function rocsparse_zbsrsv_analysis
 
-!       rocsparse_csrsv_clear
-        function rocsparse_csrsv_clear(handle, descr, info) &
+!       rocsparse_bsrsv_clear
+        function rocsparse_bsrsv_clear(handle, info) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_csrsv_clear')
+                bind(c, name = 'rocsparse_bsrsv_clear')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            type(c_ptr), intent(in), value :: descr
             type(c_ptr), value :: info
-        end function rocsparse_csrsv_clear
+        end function rocsparse_bsrsv_clear
 
-!       rocsparse_csrsv_solve
-        function rocsparse_scsrsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+!       rocsparse_bsrsv_solve
+        function rocsparse_sbsrsv_solve(handle, dir, trans, mb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, x, y, policy, &
+                temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_scsrsv_solve')
+                bind(c, name = 'rocsparse_sbsrsv_solve')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans
-            integer(c_int), value :: m
-            integer(c_int), value :: nnz
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: bsr_dim
             type(c_ptr), value :: info
             type(c_ptr), intent(in), value :: x
             type(c_ptr), value :: y
             integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsrsv_solve
+        end function rocsparse_sbsrsv_solve
 
-        function rocsparse_dcsrsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+        function rocsparse_dbsrsv_solve(handle, dir, trans, mb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, x, y, policy, &
+                temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dcsrsv_solve')
+                bind(c, name = 'rocsparse_dbsrsv_solve')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans
-            integer(c_int), value :: m
-            integer(c_int), value :: nnz
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: bsr_dim
             type(c_ptr), value :: info
             type(c_ptr), intent(in), value :: x
             type(c_ptr), value :: y
             integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsrsv_solve
+        end function rocsparse_dbsrsv_solve
 
-        function rocsparse_ccsrsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+        function rocsparse_cbsrsv_solve(handle, dir, trans, mb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, x, y, policy, &
+                temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_ccsrsv_solve')
+                bind(c, name = 'rocsparse_cbsrsv_solve')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans
-            integer(c_int), value :: m
-            integer(c_int), value :: nnz
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: bsr_dim
             type(c_ptr), value :: info
             type(c_ptr), intent(in), value :: x
             type(c_ptr), value :: y
             integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsrsv_solve
+        end function rocsparse_cbsrsv_solve
 
-        function rocsparse_zcsrsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+        function rocsparse_zbsrsv_solve(handle, dir, trans, mb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, bsr_dim, info, x, y, policy, &
+                temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zcsrsv_solve')
+                bind(c, name = 'rocsparse_zbsrsv_solve')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans
-            integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            compleX(c_double_complex), intent(in) :: alpha
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: bsr_dim
             type(c_ptr), value :: info
             type(c_ptr), intent(in), value :: x
             type(c_ptr), value :: y
             integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsrsv_solve
+        end function rocsparse_zbsrsv_solve
 
-!       rocsparse_ellmv
-        function rocsparse_sellmv(handle, trans, m, n, alpha, descr, ell_val, &
-                ell_col_ind, ell_width, x, beta, y) &
+!       rocsparse_coomv
+        function rocsparse_scoomv(handle, trans, m, n, nnz, alpha, descr, coo_val, &
+                coo_row_ind, coo_col_ind, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_sellmv')
+                bind(c, name = 'rocsparse_scoomv')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: ell_val
-            type(c_ptr), intent(in), value :: ell_col_ind
-            integer(c_int), value :: ell_width
+            type(c_ptr), intent(in), value :: coo_val
+            type(c_ptr), intent(in), value :: coo_row_ind
+            type(c_ptr), intent(in), value :: coo_col_ind
             type(c_ptr), intent(in), value :: x
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: y
-        end function rocsparse_sellmv
+        end function rocsparse_scoomv
 
-        function rocsparse_dellmv(handle, trans, m, n, alpha, descr, ell_val, &
-                ell_col_ind, ell_width, x, beta, y) &
+        function rocsparse_dcoomv(handle, trans, m, n, nnz, alpha, descr, coo_val, &
+                coo_row_ind, coo_col_ind, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dellmv')
+                bind(c, name = 'rocsparse_dcoomv')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: ell_val
-            type(c_ptr), intent(in), value :: ell_col_ind
-            integer(c_int), value :: ell_width
+            type(c_ptr), intent(in), value :: coo_val
+            type(c_ptr), intent(in), value :: coo_row_ind
+            type(c_ptr), intent(in), value :: coo_col_ind
             type(c_ptr), intent(in), value :: x
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: y
-        end function rocsparse_dellmv
+        end function rocsparse_dcoomv
 
-        function rocsparse_cellmv(handle, trans, m, n, alpha, descr, ell_val, &
-                ell_col_ind, ell_width, x, beta, y) &
+        function rocsparse_ccoomv(handle, trans, m, n, nnz, alpha, descr, coo_val, &
+                coo_row_ind, coo_col_ind, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_cellmv')
+                bind(c, name = 'rocsparse_ccoomv')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: ell_val
-            type(c_ptr), intent(in), value :: ell_col_ind
-            integer(c_int), value :: ell_width
+            type(c_ptr), intent(in), value :: coo_val
+            type(c_ptr), intent(in), value :: coo_row_ind
+            type(c_ptr), intent(in), value :: coo_col_ind
             type(c_ptr), intent(in), value :: x
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: y
-        end function rocsparse_cellmv
+        end function rocsparse_ccoomv
 
-        function rocsparse_zellmv(handle, trans, m, n, alpha, descr, ell_val, &
-                ell_col_ind, ell_width, x, beta, y) &
+        function rocsparse_zcoomv(handle, trans, m, n, nnz, alpha, descr, coo_val, &
+                coo_row_ind, coo_col_ind, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zellmv')
+                bind(c, name = 'rocsparse_zcoomv')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: ell_val
-            type(c_ptr), intent(in), value :: ell_col_ind
-            integer(c_int), value :: ell_width
+            type(c_ptr), intent(in), value :: coo_val
+            type(c_ptr), intent(in), value :: coo_row_ind
+            type(c_ptr), intent(in), value :: coo_col_ind
             type(c_ptr), intent(in), value :: x
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: y
-        end function rocsparse_zellmv
+        end function rocsparse_zcoomv
 
-!       rocsparse_hybmv
-        function rocsparse_shybmv(handle, trans, alpha, descr, hyb, x, beta, y) &
+!       rocsparse_coomv_mixed
+        function rocsparse_shcoomv(handle, trans, m, n, nnz, alpha, descr, coo_val, &
+                coo_row_ind, coo_col_ind, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_shybmv')
+                bind(c, name = 'rocsparse_shcoomv')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: hyb
+            type(c_ptr), intent(in), value :: coo_val
+            type(c_ptr), intent(in), value :: coo_row_ind
+            type(c_ptr), intent(in), value :: coo_col_ind
             type(c_ptr), intent(in), value :: x
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: y
-        end function rocsparse_shybmv
+        end function rocsparse_shcoomv
 
-        function rocsparse_dhybmv(handle, trans, alpha, descr, hyb, x, beta, y) &
+        function rocsparse_sbcoomv(handle, trans, m, n, nnz, alpha, descr, coo_val, &
+                coo_row_ind, coo_col_ind, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dhybmv')
+                bind(c, name = 'rocsparse_sbcoomv')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: hyb
+            type(c_ptr), intent(in), value :: coo_val
+            type(c_ptr), intent(in), value :: coo_row_ind
+            type(c_ptr), intent(in), value :: coo_col_ind
             type(c_ptr), intent(in), value :: x
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), value :: y
-        end function rocsparse_dhybmv
+        end function rocsparse_sbcoomv
 
-        function rocsparse_chybmv(handle, trans, alpha, descr, hyb, x, beta, y) &
+!       rocsparse_csrmv_analysis
+        function rocsparse_scsrmv_analysis(handle, trans, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_chybmv')
+                bind(c, name = 'rocsparse_scsrmv_analysis')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: trans
-            type(c_ptr), intent(in), value :: alpha
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: hyb
-            type(c_ptr), intent(in), value :: x
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: y
-        end function rocsparse_chybmv
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+        end function rocsparse_scsrmv_analysis
 
-        function rocsparse_zhybmv(handle, trans, alpha, descr, hyb, x, beta, y) &
+        function rocsparse_dcsrmv_analysis(handle, trans, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zhybmv')
+                bind(c, name = 'rocsparse_dcsrmv_analysis')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: trans
-            type(c_ptr), intent(in), value :: alpha
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: hyb
-            type(c_ptr), intent(in), value :: x
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: y
-        end function rocsparse_zhybmv
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+        end function rocsparse_dcsrmv_analysis
 
-! ===========================================================================
-!   level 3 SPARSE
-! ===========================================================================
-!       rocsparse_bsrmm
-        function rocsparse_sbsrmm(handle, dir, trans_A, trans_B, mb, n, kb, nnzb, alpha, descr, &
-                bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, ldb, beta, C, ldc) &
+        function rocsparse_ccsrmv_analysis(handle, trans, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_sbsrmm')
+                bind(c, name = 'rocsparse_ccsrmv_analysis')
             use iso_c_binding
             implicit none
-            type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
-            integer(c_int), value :: mb
-            integer(c_int), value :: n
-            integer(c_int), value :: kb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: handle
+            integer(c_int), intent(in), value :: trans
+            integer(c_int), intent(in), value :: m
+            integer(c_int), intent(in), value :: n
+            integer(c_int), intent(in), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocsparse_sbsrmm
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+        end function rocsparse_ccsrmv_analysis
 
-        function rocsparse_dbsrmm(handle, dir, trans_A, trans_B, mb, n, kb, nnzb, alpha, descr, &
-                bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, ldb, beta, C, ldc) &
+        function rocsparse_zcsrmv_analysis(handle, trans, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dbsrmm')
+                bind(c, name = 'rocsparse_zcsrmv_analysis')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
-            integer(c_int), value :: mb
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: kb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: alpha
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocsparse_dbsrmm
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+        end function rocsparse_zcsrmv_analysis
 
-        function rocsparse_cbsrmm(handle, dir, trans_A, trans_B, mb, n, kb, nnzb, alpha, descr, &
-                bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, ldb, beta, C, ldc) &
+!       rocsparse_csrmv_analysis_i64
+        function rocsparse_scsrmv_analysis_i64(handle, trans, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_cbsrmm')
+                bind(c, name = 'rocsparse_scsrmv_analysis_i64')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
-            integer(c_int), value :: mb
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: kb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: alpha
+            integer(c_int64_t), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocsparse_cbsrmm
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+        end function rocsparse_scsrmv_analysis_i64
 
-        function rocsparse_zbsrmm(handle, dir, trans_A, trans_B, mb, n, kb, nnzb, alpha, descr, &
-                bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, ldb, beta, C, ldc) &
+        function rocsparse_dcsrmv_analysis_i64(handle, trans, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zbsrmm')
+                bind(c, name = 'rocsparse_dcsrmv_analysis_i64')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
-            integer(c_int), value :: mb
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: kb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: alpha
+            integer(c_int64_t), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocsparse_zbsrmm
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+        end function rocsparse_dcsrmv_analysis_i64
 
-!       rocsparse_csrmm
-        function rocsparse_scsrmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, descr, &
-                csr_val, csr_row_ptr, csr_col_ind, B, ldb, beta, C, ldc) &
+        function rocsparse_ccsrmv_analysis_i64(handle, trans, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_scsrmm')
+                bind(c, name = 'rocsparse_ccsrmv_analysis_i64')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: alpha
+            integer(c_int64_t), value :: nnz
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocsparse_scsrmm
+            type(c_ptr), value :: info
+        end function rocsparse_ccsrmv_analysis_i64
 
-        function rocsparse_dcsrmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, descr, &
-                csr_val, csr_row_ptr, csr_col_ind, B, ldb, beta, C, ldc) &
+        function rocsparse_zcsrmv_analysis_i64(handle, trans, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dcsrmm')
+                bind(c, name = 'rocsparse_zcsrmv_analysis_i64')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: alpha
+            integer(c_int64_t), value :: nnz
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocsparse_dcsrmm
+            type(c_ptr), value :: info
+        end function rocsparse_zcsrmv_analysis_i64
 
-        function rocsparse_ccsrmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, descr, &
-                csr_val, csr_row_ptr, csr_col_ind, B, ldb, beta, C, ldc) &
+!       rocsparse_csrmv_analysis_mixed
+        function rocsparse_shcsrmv_analysis(handle, trans, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_ccsrmm')
+                bind(c, name = 'rocsparse_shcsrmv_analysis')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocsparse_ccsrmm
+            type(c_ptr), value :: info
+        end function rocsparse_shcsrmv_analysis
 
-        function rocsparse_zcsrmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, descr, &
-                csr_val, csr_row_ptr, csr_col_ind, B, ldb, beta, C, ldc) &
+        function rocsparse_sbcsrmv_analysis(handle, trans, m, n, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zcsrmm')
+                bind(c, name = 'rocsparse_sbcsrmv_analysis')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocsparse_zcsrmm
+            type(c_ptr), value :: info
+        end function rocsparse_sbcsrmv_analysis
 
-!       rocsparse_csrsm_zero_pivot
-        function rocsparse_csrsm_zero_pivot(handle, info, position) &
+!       rocsparse_csrmv_clear
+        function rocsparse_csrmv_clear(handle, info) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_csrsm_zero_pivot')
+                bind(c, name = 'rocsparse_csrmv_clear')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             type(c_ptr), value :: info
-            type(c_ptr), value :: position
-        end function rocsparse_csrsm_zero_pivot
+        end function rocsparse_csrmv_clear
 
-!       rocsparse_csrsm_buffer_size
-        function rocsparse_scsrsm_buffer_size(handle, trans_A, trans_B, m, nrhs, nnz, &
-                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
-                buffer_size) &
+!       rocsparse_csrmv
+        function rocsparse_scsrmv(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_scsrsm_buffer_size')
+                bind(c, name = 'rocsparse_scsrmv')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: nrhs
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_scsrsm_buffer_size
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_scsrmv
 
-        function rocsparse_dcsrsm_buffer_size(handle, trans_A, trans_B, m, nrhs, nnz, &
-                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
-                buffer_size) &
+        function rocsparse_dcsrmv(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dcsrsm_buffer_size')
+                bind(c, name = 'rocsparse_dcsrmv')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: nrhs
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_dcsrsm_buffer_size
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_dcsrmv
 
-        function rocsparse_ccsrsm_buffer_size(handle, trans_A, trans_B, m, nrhs, nnz, &
-                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
-                buffer_size) &
+        function rocsparse_ccsrmv(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_ccsrsm_buffer_size')
+                bind(c, name = 'rocsparse_ccsrmv')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: nrhs
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_ccsrsm_buffer_size
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_ccsrmv
 
-        function rocsparse_zcsrsm_buffer_size(handle, trans_A, trans_B, m, nrhs, nnz, &
-                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
-                buffer_size) &
-                result(c_int) &
-                bind(c, name = 'rocsparse_zcsrsm_buffer_size')
+        function rocsparse_zcsrmv(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, beta, y) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrmv')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: nrhs
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_zcsrsm_buffer_size
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_zcsrmv
 
-!       rocsparse_csrsm_analysis
-        function rocsparse_scsrsm_analysis(handle, trans_A, trans_B, m, nrhs, nnz, &
-                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, &
-                analysis, policy, temp_buffer) &
+!       rocsparse_csrmv_i64
+        function rocsparse_scsrmv_i64(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_scsrsm_analysis')
+                bind(c, name = 'rocsparse_scsrmv_i64')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: nrhs
-            integer(c_int), value :: nnz
+            integer(c_int), value :: n
+            integer(c_int64_t), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsrsm_analysis
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_scsrmv_i64
 
-        function rocsparse_dcsrsm_analysis(handle, trans_A, trans_B, m, nrhs, nnz, &
-                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, &
-                analysis, policy, temp_buffer) &
+        function rocsparse_dcsrmv_i64(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dcsrsm_analysis')
+                bind(c, name = 'rocsparse_dcsrmv_i64')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: nrhs
-            integer(c_int), value :: nnz
+            integer(c_int), value :: n
+            integer(c_int64_t), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsrsm_analysis
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_dcsrmv_i64
 
-        function rocsparse_ccsrsm_analysis(handle, trans_A, trans_B, m, nrhs, nnz, &
-                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, &
-                analysis, policy, temp_buffer) &
+        function rocsparse_ccsrmv_i64(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_ccsrsm_analysis')
+                bind(c, name = 'rocsparse_ccsrmv_i64')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: nrhs
-            integer(c_int), value :: nnz
+            integer(c_int), value :: n
+            integer(c_int64_t), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsrsm_analysis
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_ccsrmv_i64
 
-        function rocsparse_zcsrsm_analysis(handle, trans_A, trans_B, m, nrhs, nnz, &
-                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, &
-                analysis, policy, temp_buffer) &
+        function rocsparse_zcsrmv_i64(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zcsrsm_analysis')
+                bind(c, name = 'rocsparse_zcsrmv_i64')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: nrhs
-            integer(c_int), value :: nnz
+            integer(c_int), value :: n
+            integer(c_int64_t), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsrsm_analysis
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_zcsrmv_i64
 
-!       rocsparse_csrsm_clear
-        function rocsparse_csrsm_clear(handle, info) &
+!       rocsparse_csrmv_mixed
+        function rocsparse_shcsrmv(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_csrsm_clear')
+                bind(c, name = 'rocsparse_shcsrmv')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-        end function rocsparse_csrsm_clear
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_shcsrmv
 
-!       rocsparse_csrsm_solve
-        function rocsparse_scsrsm_solve(handle, trans_A, trans_B, m, nrhs, nnz, alpha, &
-                descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
-                temp_buffer) &
+        function rocsparse_sbcsrmv(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, beta, y) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_scsrsm_solve')
+                bind(c, name = 'rocsparse_sbcsrmv')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: nrhs
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsrsm_solve
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_sbcsrmv
 
-        function rocsparse_dcsrsm_solve(handle, trans_A, trans_B, m, nrhs, nnz, alpha, &
-                descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
-                temp_buffer) &
+!       rocsparse_csrmv_dot
+        function rocsparse_scsrmv_dot(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, x, beta, y, dot_xy, dot_yy) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dcsrsm_solve')
+                bind(c, name = 'rocsparse_scsrmv_dot')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: nrhs
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsrsm_solve
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+            type(c_ptr), value :: dot_xy
+            type(c_ptr), value :: dot_yy
+        end function rocsparse_scsrmv_dot
 
-        function rocsparse_ccsrsm_solve(handle, trans_A, trans_B, m, nrhs, nnz, alpha, &
-                descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
-                temp_buffer) &
+        function rocsparse_dcsrmv_dot(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, x, beta, y, dot_xy, dot_yy) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_ccsrsm_solve')
+                bind(c, name = 'rocsparse_dcsrmv_dot')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: nrhs
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsrsm_solve
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+            type(c_ptr), value :: dot_xy
+            type(c_ptr), value :: dot_yy
+        end function rocsparse_dcsrmv_dot
 
-        function rocsparse_zcsrsm_solve(handle, trans_A, trans_B, m, nrhs, nnz, alpha, &
-                descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
-                temp_buffer) &
+        function rocsparse_ccsrmv_dot(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, x, beta, y, dot_xy, dot_yy) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zcsrsm_solve')
+                bind(c, name = 'rocsparse_ccsrmv_dot')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
-            integer(c_int), value :: nrhs
+            integer(c_int), value :: n
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsrsm_solve
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+            type(c_ptr), value :: dot_xy
+            type(c_ptr), value :: dot_yy
+        end function rocsparse_ccsrmv_dot
 
-!       rocsparse_gemmi
-        function rocsparse_sgemmi(handle, trans_A, trans_B, m, n, k, nnz, alpha, A, &
-                lda, descr, csr_val, csr_row_ptr, csr_col_ind, beta, C, ldc) &
+        function rocsparse_zcsrmv_dot(handle, trans, m, n, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, x, beta, y, dot_xy, dot_yy) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_sgemmi')
+                bind(c, name = 'rocsparse_zcsrmv_dot')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: x
             type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocsparse_sgemmi
+            type(c_ptr), value :: y
+            type(c_ptr), value :: dot_xy
+            type(c_ptr), value :: dot_yy
+        end function rocsparse_zcsrmv_dot
 
-        function rocsparse_dgemmi(handle, trans_A, trans_B, m, n, k, nnz, alpha, A, &
-                lda, descr, csr_val, csr_row_ptr, csr_col_ind, beta, C, ldc) &
+!       rocsparse_csrmv_format_analysis
+        function rocsparse_scsrmv_format_analysis(handle, trans, m, n, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, benchmark_iter, info) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dgemmi')
+                bind(c, name = 'rocsparse_scsrmv_format_analysis')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocsparse_dgemmi
+            integer(c_int), value :: benchmark_iter
+            type(c_ptr), value :: info
+        end function rocsparse_scsrmv_format_analysis
 
-        function rocsparse_cgemmi(handle, trans_A, trans_B, m, n, k, nnz, alpha, A, &
-                lda, descr, csr_val, csr_row_ptr, csr_col_ind, beta, C, ldc) &
+        function rocsparse_dcsrmv_format_analysis(handle, trans, m, n, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, benchmark_iter, info) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_cgemmi')
+                bind(c, name = 'rocsparse_dcsrmv_format_analysis')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocsparse_cgemmi
+            integer(c_int), value :: benchmark_iter
+            type(c_ptr), value :: info
+        end function rocsparse_dcsrmv_format_analysis
 
-        function rocsparse_zgemmi(handle, trans_A, trans_B, m, n, k, nnz, alpha, A, &
-                lda, descr, csr_val, csr_row_ptr, csr_col_ind, beta, C, ldc) &
+        function rocsparse_ccsrmv_format_analysis(handle, trans, m, n, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, benchmark_iter, info) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zgemmi')
+                bind(c, name = 'rocsparse_ccsrmv_format_analysis')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: A
-            integer(c_int), value :: lda
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function rocsparse_zgemmi
+            integer(c_int), value :: benchmark_iter
+            type(c_ptr), value :: info
+        end function rocsparse_ccsrmv_format_analysis
 
-! ===========================================================================
-!   extra SPARSE
-! ===========================================================================
+        function rocsparse_zcsrmv_format_analysis(handle, trans, m, n, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, benchmark_iter, info) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrmv_format_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: benchmark_iter
+            type(c_ptr), value :: info
+        end function rocsparse_zcsrmv_format_analysis
+
+!       rocsparse_csrmv_format_get_info
+        function rocsparse_csrmv_format_get_info(handle, info, format, bsr_dim, &
+                predicted_cost, measured_cost) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_csrmv_format_get_info')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), intent(in), value :: info
+            type(c_ptr), value :: format
+            type(c_ptr), value :: bsr_dim
+            type(c_ptr), value :: predicted_cost
+            type(c_ptr), value :: measured_cost
+        end function rocsparse_csrmv_format_get_info
+
+!       rocsparse_csrmv_format
+        function rocsparse_scsrmv_format(handle, trans, m, n, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, x, beta, y) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrmv_format')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_scsrmv_format
+
+        function rocsparse_dcsrmv_format(handle, trans, m, n, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, x, beta, y) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrmv_format')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_dcsrmv_format
+
+        function rocsparse_ccsrmv_format(handle, trans, m, n, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, x, beta, y) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrmv_format')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_ccsrmv_format
+
+        function rocsparse_zcsrmv_format(handle, trans, m, n, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, x, beta, y) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrmv_format')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_zcsrmv_format
+
+!       rocsparse_csrmv_format_clear
+        function rocsparse_csrmv_format_clear(handle, info) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_csrmv_format_clear')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+        end function rocsparse_csrmv_format_clear
+
+!       rocsparse_csrmv_strided_batched
+        function rocsparse_scsrmv_strided_batched(handle, trans, m, n, nnz, alpha, &
+                descr, csr_val, stride_val, csr_row_ptr, csr_col_ind, x, stride_x, beta, &
+                y, stride_y, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrmv_strided_batched')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            integer(c_int), value :: stride_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: stride_x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: stride_y
+            integer(c_int), value :: batch_count
+        end function rocsparse_scsrmv_strided_batched
+
+        function rocsparse_dcsrmv_strided_batched(handle, trans, m, n, nnz, alpha, &
+                descr, csr_val, stride_val, csr_row_ptr, csr_col_ind, x, stride_x, beta, &
+                y, stride_y, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrmv_strided_batched')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            integer(c_int), value :: stride_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: stride_x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: stride_y
+            integer(c_int), value :: batch_count
+        end function rocsparse_dcsrmv_strided_batched
+
+        function rocsparse_ccsrmv_strided_batched(handle, trans, m, n, nnz, alpha, &
+                descr, csr_val, stride_val, csr_row_ptr, csr_col_ind, x, stride_x, beta, &
+                y, stride_y, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrmv_strided_batched')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            integer(c_int), value :: stride_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: stride_x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: stride_y
+            integer(c_int), value :: batch_count
+        end function rocsparse_ccsrmv_strided_batched
+
+        function rocsparse_zcsrmv_strided_batched(handle, trans, m, n, nnz, alpha, &
+                descr, csr_val, stride_val, csr_row_ptr, csr_col_ind, x, stride_x, beta, &
+                y, stride_y, batch_count) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrmv_strided_batched')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            integer(c_int), value :: stride_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: stride_x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: stride_y
+            integer(c_int), value :: batch_count
+        end function rocsparse_zcsrmv_strided_batched
+
+!       rocsparse_csrsv_zero_pivot
+        function rocsparse_csrsv_zero_pivot(handle, descr, info, position) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_csrsv_zero_pivot')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_csrsv_zero_pivot
+
+!       rocsparse_csrsv_buffer_size
+        function rocsparse_scsrsv_buffer_size(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrsv_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsrsv_buffer_size
+
+        function rocsparse_dcsrsv_buffer_size(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrsv_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsrsv_buffer_size
+
+        function rocsparse_ccsrsv_buffer_size(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrsv_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrsv_buffer_size
+
+        function rocsparse_zcsrsv_buffer_size(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrsv_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrsv_buffer_size
+
+!       rocsparse_csrsv_buffer_size_i64
+        function rocsparse_scsrsv_buffer_size_i64(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrsv_buffer_size_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int64_t), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsrsv_buffer_size_i64
+
+        function rocsparse_dcsrsv_buffer_size_i64(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrsv_buffer_size_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int64_t), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsrsv_buffer_size_i64
+
+        function rocsparse_ccsrsv_buffer_size_i64(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrsv_buffer_size_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int64_t), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrsv_buffer_size_i64
+
+        function rocsparse_zcsrsv_buffer_size_i64(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrsv_buffer_size_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int64_t), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrsv_buffer_size_i64
+
+!       rocsparse_csrsv_analysis
+        function rocsparse_scsrsv_analysis(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrsv_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrsv_analysis
+
+        function rocsparse_dcsrsv_analysis(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrsv_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrsv_analysis
+
+        function rocsparse_ccsrsv_analysis(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrsv_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrsv_analysis
+
+        function rocsparse_zcsrsv_analysis(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrsv_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrsv_analysis
+
+!       rocsparse_csrsv_analysis_i64
+        function rocsparse_scsrsv_analysis_i64(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrsv_analysis_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int64_t), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrsv_analysis_i64
+
+        function rocsparse_dcsrsv_analysis_i64(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrsv_analysis_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int64_t), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrsv_analysis_i64
+
+        function rocsparse_ccsrsv_analysis_i64(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrsv_analysis_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int64_t), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrsv_analysis_i64
+
+        function rocsparse_zcsrsv_analysis_i64(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrsv_analysis_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int64_t), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrsv_analysis_i64
+
+!       rocsparse_csrsv_clear
+        function rocsparse_csrsv_clear(handle, descr, info) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_csrsv_clear')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: info
+        end function rocsparse_csrsv_clear
+
+!       rocsparse_csrsv_solve
+        function rocsparse_scsrsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrsv_solve')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrsv_solve
+
+        function rocsparse_dcsrsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrsv_solve')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrsv_solve
+
+        function rocsparse_ccsrsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrsv_solve')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrsv_solve
+
+        function rocsparse_zcsrsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrsv_solve')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            compleX(c_double_complex), intent(in) :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrsv_solve
+
+!       rocsparse_csrsv_solve_i64
+        function rocsparse_scsrsv_solve_i64(handle, trans, m, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrsv_solve_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int64_t), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrsv_solve_i64
+
+        function rocsparse_dcsrsv_solve_i64(handle, trans, m, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrsv_solve_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int64_t), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrsv_solve_i64
+
+        function rocsparse_ccsrsv_solve_i64(handle, trans, m, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrsv_solve_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int64_t), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrsv_solve_i64
+
+        function rocsparse_zcsrsv_solve_i64(handle, trans, m, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrsv_solve_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int64_t), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrsv_solve_i64
+
+!       rocsparse_csrsv_solve_mixed
+        function rocsparse_dscsrsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dscsrsv_solve')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dscsrsv_solve
+
+        function rocsparse_zccsrsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zccsrsv_solve')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zccsrsv_solve
+
+!       rocsparse_csrsv_strided_batched_buffer_size
+        function rocsparse_scsrsv_strided_batched_buffer_size(handle, trans, m, nnz, &
+                descr, csr_val, csr_row_ptr, csr_col_ind, info, batch_count, &
+                buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrsv_strided_batched_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsrsv_strided_batched_buffer_size
+
+        function rocsparse_dcsrsv_strided_batched_buffer_size(handle, trans, m, nnz, &
+                descr, csr_val, csr_row_ptr, csr_col_ind, info, batch_count, &
+                buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrsv_strided_batched_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsrsv_strided_batched_buffer_size
+
+        function rocsparse_ccsrsv_strided_batched_buffer_size(handle, trans, m, nnz, &
+                descr, csr_val, csr_row_ptr, csr_col_ind, info, batch_count, &
+                buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrsv_strided_batched_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrsv_strided_batched_buffer_size
+
+        function rocsparse_zcsrsv_strided_batched_buffer_size(handle, trans, m, nnz, &
+                descr, csr_val, csr_row_ptr, csr_col_ind, info, batch_count, &
+                buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrsv_strided_batched_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrsv_strided_batched_buffer_size
+
+!       rocsparse_csrsv_solve_strided_batched
+        function rocsparse_scsrsv_solve_strided_batched(handle, trans, m, nnz, alpha, &
+                descr, csr_val, stride_val, csr_row_ptr, csr_col_ind, info, x, stride_x, &
+                y, stride_y, batch_count, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrsv_solve_strided_batched')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            integer(c_int), value :: stride_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: stride_x
+            type(c_ptr), value :: y
+            integer(c_int), value :: stride_y
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrsv_solve_strided_batched
+
+        function rocsparse_dcsrsv_solve_strided_batched(handle, trans, m, nnz, alpha, &
+                descr, csr_val, stride_val, csr_row_ptr, csr_col_ind, info, x, stride_x, &
+                y, stride_y, batch_count, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrsv_solve_strided_batched')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            integer(c_int), value :: stride_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: stride_x
+            type(c_ptr), value :: y
+            integer(c_int), value :: stride_y
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrsv_solve_strided_batched
+
+        function rocsparse_ccsrsv_solve_strided_batched(handle, trans, m, nnz, alpha, &
+                descr, csr_val, stride_val, csr_row_ptr, csr_col_ind, info, x, stride_x, &
+                y, stride_y, batch_count, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrsv_solve_strided_batched')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            integer(c_int), value :: stride_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: stride_x
+            type(c_ptr), value :: y
+            integer(c_int), value :: stride_y
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrsv_solve_strided_batched
+
+        function rocsparse_zcsrsv_solve_strided_batched(handle, trans, m, nnz, alpha, &
+                descr, csr_val, stride_val, csr_row_ptr, csr_col_ind, info, x, stride_x, &
+                y, stride_y, batch_count, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrsv_solve_strided_batched')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            integer(c_int), value :: stride_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: stride_x
+            type(c_ptr), value :: y
+            integer(c_int), value :: stride_y
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrsv_solve_strided_batched
+
+!       rocsparse_diamv
+        function rocsparse_sdiamv(handle, trans, m, n, alpha, descr, dia_val, &
+                dia_offset, dia_num_diag, x, beta, y) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_sdiamv')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: dia_val
+            type(c_ptr), intent(in), value :: dia_offset
+            integer(c_int), value :: dia_num_diag
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_sdiamv
+
+        function rocsparse_ddiamv(handle, trans, m, n, alpha, descr, dia_val, &
+                dia_offset, dia_num_diag, x, beta, y) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ddiamv')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: dia_val
+            type(c_ptr), intent(in), value :: dia_offset
+            integer(c_int), value :: dia_num_diag
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_ddiamv
+
+        function rocsparse_cdiamv(handle, trans, m, n, alpha, descr, dia_val, &
+                dia_offset, dia_num_diag, x, beta, y) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_cdiamv')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: dia_val
+            type(c_ptr), intent(in), value :: dia_offset
+            integer(c_int), value :: dia_num_diag
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_cdiamv
+
+        function rocsparse_zdiamv(handle, trans, m, n, alpha, descr, dia_val, &
+                dia_offset, dia_num_diag, x, beta, y) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zdiamv')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: dia_val
+            type(c_ptr), intent(in), value :: dia_offset
+            integer(c_int), value :: dia_num_diag
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_zdiamv
+
+!       rocsparse_ellmv
+        function rocsparse_sellmv(handle, trans, m, n, alpha, descr, ell_val, &
+                ell_col_ind, ell_width, x, beta, y) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_sellmv')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: ell_val
+            type(c_ptr), intent(in), value :: ell_col_ind
+            integer(c_int), value :: ell_width
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_sellmv
+
+        function rocsparse_dellmv(handle, trans, m, n, alpha, descr, ell_val, &
+                ell_col_ind, ell_width, x, beta, y) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dellmv')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: ell_val
+            type(c_ptr), intent(in), value :: ell_col_ind
+            integer(c_int), value :: ell_width
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_dellmv
+
+        function rocsparse_cellmv(handle, trans, m, n, alpha, descr, ell_val, &
+                ell_col_ind, ell_width, x, beta, y) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_cellmv')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: ell_val
+            type(c_ptr), intent(in), value :: ell_col_ind
+            integer(c_int), value :: ell_width
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_cellmv
+
+        function rocsparse_zellmv(handle, trans, m, n, alpha, descr, ell_val, &
+                ell_col_ind, ell_width, x, beta, y) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zellmv')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: ell_val
+            type(c_ptr), intent(in), value :: ell_col_ind
+            integer(c_int), value :: ell_width
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_zellmv
+
+!       rocsparse_ellmv_mixed
+        function rocsparse_shellmv(handle, trans, m, n, alpha, descr, ell_val, &
+                ell_col_ind, ell_width, x, beta, y) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_shellmv')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: ell_val
+            type(c_ptr), intent(in), value :: ell_col_ind
+            integer(c_int), value :: ell_width
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_shellmv
+
+        function rocsparse_sbellmv(handle, trans, m, n, alpha, descr, ell_val, &
+                ell_col_ind, ell_width, x, beta, y) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_sbellmv')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: ell_val
+            type(c_ptr), intent(in), value :: ell_col_ind
+            integer(c_int), value :: ell_width
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_sbellmv
+
+!       rocsparse_ellmv_dot
+        function rocsparse_sellmv_dot(handle, trans, m, n, alpha, descr, ell_val, &
+                ell_col_ind, ell_width, x, beta, y, dot_xy, dot_yy) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_sellmv_dot')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: ell_val
+            type(c_ptr), intent(in), value :: ell_col_ind
+            integer(c_int), value :: ell_width
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+            type(c_ptr), value :: dot_xy
+            type(c_ptr), value :: dot_yy
+        end function rocsparse_sellmv_dot
+
+        function rocsparse_dellmv_dot(handle, trans, m, n, alpha, descr, ell_val, &
+                ell_col_ind, ell_width, x, beta, y, dot_xy, dot_yy) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dellmv_dot')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: ell_val
+            type(c_ptr), intent(in), value :: ell_col_ind
+            integer(c_int), value :: ell_width
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+            type(c_ptr), value :: dot_xy
+            type(c_ptr), value :: dot_yy
+        end function rocsparse_dellmv_dot
+
+        function rocsparse_cellmv_dot(handle, trans, m, n, alpha, descr, ell_val, &
+                ell_col_ind, ell_width, x, beta, y, dot_xy, dot_yy) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_cellmv_dot')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: ell_val
+            type(c_ptr), intent(in), value :: ell_col_ind
+            integer(c_int), value :: ell_width
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+            type(c_ptr), value :: dot_xy
+            type(c_ptr), value :: dot_yy
+        end function rocsparse_cellmv_dot
+
+        function rocsparse_zellmv_dot(handle, trans, m, n, alpha, descr, ell_val, &
+                ell_col_ind, ell_width, x, beta, y, dot_xy, dot_yy) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zellmv_dot')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: ell_val
+            type(c_ptr), intent(in), value :: ell_col_ind
+            integer(c_int), value :: ell_width
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+            type(c_ptr), value :: dot_xy
+            type(c_ptr), value :: dot_yy
+        end function rocsparse_zellmv_dot
+
+!       rocsparse_hybmv
+        function rocsparse_shybmv(handle, trans, alpha, descr, hyb, x, beta, y) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_shybmv')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: hyb
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_shybmv
+
+        function rocsparse_dhybmv(handle, trans, alpha, descr, hyb, x, beta, y) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dhybmv')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: hyb
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_dhybmv
+
+        function rocsparse_chybmv(handle, trans, alpha, descr, hyb, x, beta, y) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_chybmv')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: hyb
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_chybmv
+
+        function rocsparse_zhybmv(handle, trans, alpha, descr, hyb, x, beta, y) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zhybmv')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: hyb
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_zhybmv
+
+! ===========================================================================
+!   level 3 SPARSE
+! ===========================================================================
+!       rocsparse_bsrmm
+        function rocsparse_sbsrmm(handle, dir, trans_A, trans_B, mb, n, kb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, ldb, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_sbsrmm')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: n
+            integer(c_int), value :: kb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_sbsrmm
+
+        function rocsparse_dbsrmm(handle, dir, trans_A, trans_B, mb, n, kb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, ldb, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dbsrmm')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: n
+            integer(c_int), value :: kb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_dbsrmm
+
+        function rocsparse_cbsrmm(handle, dir, trans_A, trans_B, mb, n, kb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, ldb, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_cbsrmm')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: n
+            integer(c_int), value :: kb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_cbsrmm
+
+        function rocsparse_zbsrmm(handle, dir, trans_A, trans_B, mb, n, kb, nnzb, alpha, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, ldb, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zbsrmm')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: n
+            integer(c_int), value :: kb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_zbsrmm
+
+!       rocsparse_bsrmm_ex_analysis
+        function rocsparse_sbsrmm_ex_analysis(handle, dir, trans_A, mb, kb, nnzb, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, info) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_sbsrmm_ex_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: mb
+            integer(c_int), value :: kb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+        end function rocsparse_sbsrmm_ex_analysis
+
+        function rocsparse_dbsrmm_ex_analysis(handle, dir, trans_A, mb, kb, nnzb, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, info) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dbsrmm_ex_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: mb
+            integer(c_int), value :: kb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+        end function rocsparse_dbsrmm_ex_analysis
+
+        function rocsparse_cbsrmm_ex_analysis(handle, dir, trans_A, mb, kb, nnzb, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, info) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_cbsrmm_ex_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: mb
+            integer(c_int), value :: kb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+        end function rocsparse_cbsrmm_ex_analysis
+
+        function rocsparse_zbsrmm_ex_analysis(handle, dir, trans_A, mb, kb, nnzb, descr, &
+                bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, info) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zbsrmm_ex_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: mb
+            integer(c_int), value :: kb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+        end function rocsparse_zbsrmm_ex_analysis
+
+!       rocsparse_bsrmm_ex
+        function rocsparse_sbsrmm_ex(handle, dir, trans_A, trans_B, order_B, order_C, &
+                mb, n, kb, nnzb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, &
+                block_dim, info, B, ldb, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_sbsrmm_ex')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: order_B
+            integer(c_int), value :: order_C
+            integer(c_int), value :: mb
+            integer(c_int), value :: n
+            integer(c_int), value :: kb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_sbsrmm_ex
+
+        function rocsparse_dbsrmm_ex(handle, dir, trans_A, trans_B, order_B, order_C, &
+                mb, n, kb, nnzb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, &
+                block_dim, info, B, ldb, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dbsrmm_ex')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: order_B
+            integer(c_int), value :: order_C
+            integer(c_int), value :: mb
+            integer(c_int), value :: n
+            integer(c_int), value :: kb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_dbsrmm_ex
+
+        function rocsparse_cbsrmm_ex(handle, dir, trans_A, trans_B, order_B, order_C, &
+                mb, n, kb, nnzb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, &
+                block_dim, info, B, ldb, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_cbsrmm_ex')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: order_B
+            integer(c_int), value :: order_C
+            integer(c_int), value :: mb
+            integer(c_int), value :: n
+            integer(c_int), value :: kb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_cbsrmm_ex
+
+        function rocsparse_zbsrmm_ex(handle, dir, trans_A, trans_B, order_B, order_C, &
+                mb, n, kb, nnzb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, &
+                block_dim, info, B, ldb, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zbsrmm_ex')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: order_B
+            integer(c_int), value :: order_C
+            integer(c_int), value :: mb
+            integer(c_int), value :: n
+            integer(c_int), value :: kb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_zbsrmm_ex
+
+!       rocsparse_bsrmm_ex_clear
+        function rocsparse_bsrmm_ex_clear(handle, info) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_bsrmm_ex_clear')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+        end function rocsparse_bsrmm_ex_clear
+
+!       rocsparse_csrmm
+        function rocsparse_scsrmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, B, ldb, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrmm')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_scsrmm
+
+        function rocsparse_dcsrmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, B, ldb, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrmm')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_dcsrmm
+
+        function rocsparse_ccsrmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, B, ldb, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrmm')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_ccsrmm
+
+        function rocsparse_zcsrmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, B, ldb, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrmm')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_zcsrmm
+
+!       rocsparse_csrmm_mixed
+        function rocsparse_shcsrmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, B, ldb, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_shcsrmm')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_shcsrmm
+
+        function rocsparse_sbcsrmm(handle, trans_A, trans_B, m, n, k, nnz, alpha, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, B, ldb, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_sbcsrmm')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_sbcsrmm
+
+!       rocsparse_csrmm_ex_analysis
+        function rocsparse_scsrmm_ex_analysis(handle, trans_A, m, k, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrmm_ex_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: m
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+        end function rocsparse_scsrmm_ex_analysis
+
+        function rocsparse_dcsrmm_ex_analysis(handle, trans_A, m, k, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrmm_ex_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: m
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+        end function rocsparse_dcsrmm_ex_analysis
+
+        function rocsparse_ccsrmm_ex_analysis(handle, trans_A, m, k, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrmm_ex_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: m
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+        end function rocsparse_ccsrmm_ex_analysis
+
+        function rocsparse_zcsrmm_ex_analysis(handle, trans_A, m, k, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrmm_ex_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: m
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+        end function rocsparse_zcsrmm_ex_analysis
+
+!       rocsparse_csrmm_ex
+        function rocsparse_scsrmm_ex(handle, trans_A, trans_B, order_B, order_C, m, n, &
+                k, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, info, B, ldb, &
+                beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrmm_ex')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: order_B
+            integer(c_int), value :: order_C
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_scsrmm_ex
+
+        function rocsparse_dcsrmm_ex(handle, trans_A, trans_B, order_B, order_C, m, n, &
+                k, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, info, B, ldb, &
+                beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrmm_ex')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: order_B
+            integer(c_int), value :: order_C
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_dcsrmm_ex
+
+        function rocsparse_ccsrmm_ex(handle, trans_A, trans_B, order_B, order_C, m, n, &
+                k, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, info, B, ldb, &
+                beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrmm_ex')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: order_B
+            integer(c_int), value :: order_C
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_ccsrmm_ex
+
+        function rocsparse_zcsrmm_ex(handle, trans_A, trans_B, order_B, order_C, m, n, &
+                k, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, info, B, ldb, &
+                beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrmm_ex')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: order_B
+            integer(c_int), value :: order_C
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_zcsrmm_ex
+
+!       rocsparse_csrmm_ex_clear
+        function rocsparse_csrmm_ex_clear(handle, info) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_csrmm_ex_clear')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+        end function rocsparse_csrmm_ex_clear
+
+!       rocsparse_csrsm_zero_pivot
+        function rocsparse_csrsm_zero_pivot(handle, info, position) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_csrsm_zero_pivot')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_csrsm_zero_pivot
+
+!       rocsparse_csrsm_buffer_size
+        function rocsparse_scsrsm_buffer_size(handle, trans_A, trans_B, m, nrhs, nnz, &
+                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
+                buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrsm_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsrsm_buffer_size
+
+        function rocsparse_dcsrsm_buffer_size(handle, trans_A, trans_B, m, nrhs, nnz, &
+                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
+                buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrsm_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsrsm_buffer_size
+
+        function rocsparse_ccsrsm_buffer_size(handle, trans_A, trans_B, m, nrhs, nnz, &
+                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
+                buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrsm_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrsm_buffer_size
+
+        function rocsparse_zcsrsm_buffer_size(handle, trans_A, trans_B, m, nrhs, nnz, &
+                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
+                buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrsm_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrsm_buffer_size
+
+!       rocsparse_csrsm_buffer_size_mixed
+        function rocsparse_dscsrsm_buffer_size(handle, trans_A, trans_B, m, nrhs, nnz, &
+                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
+                buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dscsrsm_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dscsrsm_buffer_size
+
+        function rocsparse_zccsrsm_buffer_size(handle, trans_A, trans_B, m, nrhs, nnz, &
+                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
+                buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zccsrsm_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zccsrsm_buffer_size
+
+!       rocsparse_csrsm_analysis
+        function rocsparse_scsrsm_analysis(handle, trans_A, trans_B, m, nrhs, nnz, &
+                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, &
+                analysis, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrsm_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrsm_analysis
+
+        function rocsparse_dcsrsm_analysis(handle, trans_A, trans_B, m, nrhs, nnz, &
+                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, &
+                analysis, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrsm_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrsm_analysis
+
+        function rocsparse_ccsrsm_analysis(handle, trans_A, trans_B, m, nrhs, nnz, &
+                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, &
+                analysis, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrsm_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrsm_analysis
+
+        function rocsparse_zcsrsm_analysis(handle, trans_A, trans_B, m, nrhs, nnz, &
+                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, &
+                analysis, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrsm_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrsm_analysis
+
+!       rocsparse_csrsm_analysis_mixed
+        function rocsparse_dscsrsm_analysis(handle, trans_A, trans_B, m, nrhs, nnz, &
+                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, analysis, &
+                solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dscsrsm_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dscsrsm_analysis
+
+        function rocsparse_zccsrsm_analysis(handle, trans_A, trans_B, m, nrhs, nnz, &
+                alpha, descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, analysis, &
+                solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zccsrsm_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zccsrsm_analysis
+
+!       rocsparse_csrsm_clear
+        function rocsparse_csrsm_clear(handle, info) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_csrsm_clear')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+        end function rocsparse_csrsm_clear
+
+!       rocsparse_csrsm_solve
+        function rocsparse_scsrsm_solve(handle, trans_A, trans_B, m, nrhs, nnz, alpha, &
+                descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
+                temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrsm_solve')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrsm_solve
+
+        function rocsparse_dcsrsm_solve(handle, trans_A, trans_B, m, nrhs, nnz, alpha, &
+                descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
+                temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrsm_solve')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrsm_solve
+
+        function rocsparse_ccsrsm_solve(handle, trans_A, trans_B, m, nrhs, nnz, alpha, &
+                descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
+                temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrsm_solve')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrsm_solve
+
+        function rocsparse_zcsrsm_solve(handle, trans_A, trans_B, m, nrhs, nnz, alpha, &
+                descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
+                temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrsm_solve')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrsm_solve
+
+!       rocsparse_csrsm_solve_mixed
+        function rocsparse_dscsrsm_solve(handle, trans_A, trans_B, m, nrhs, nnz, alpha, &
+                descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
+                temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dscsrsm_solve')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dscsrsm_solve
+
+        function rocsparse_zccsrsm_solve(handle, trans_A, trans_B, m, nrhs, nnz, alpha, &
+                descr, csr_val, csr_row_ptr, csr_col_ind, B, ldb, info, policy, &
+                temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zccsrsm_solve')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zccsrsm_solve
+
+!       rocsparse_bsrsm_zero_pivot
+        function rocsparse_bsrsm_zero_pivot(handle, info, position) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_bsrsm_zero_pivot')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_bsrsm_zero_pivot
+
+!       rocsparse_bsrsm_buffer_size
+        function rocsparse_sbsrsm_buffer_size(handle, dir, trans_A, trans_B, mb, nrhs, &
+                nnzb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, &
+                ldb, info, policy, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_sbsrsm_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_sbsrsm_buffer_size
+
+        function rocsparse_dbsrsm_buffer_size(handle, dir, trans_A, trans_B, mb, nrhs, &
+                nnzb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, &
+                ldb, info, policy, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dbsrsm_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dbsrsm_buffer_size
+
+        function rocsparse_cbsrsm_buffer_size(handle, dir, trans_A, trans_B, mb, nrhs, &
+                nnzb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, &
+                ldb, info, policy, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_cbsrsm_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_cbsrsm_buffer_size
+
+        function rocsparse_zbsrsm_buffer_size(handle, dir, trans_A, trans_B, mb, nrhs, &
+                nnzb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, &
+                ldb, info, policy, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zbsrsm_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zbsrsm_buffer_size
+
+!       rocsparse_bsrsm_analysis
+        function rocsparse_sbsrsm_analysis(handle, dir, trans_A, trans_B, mb, nrhs, &
+                nnzb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, &
+                ldb, info, analysis, solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_sbsrsm_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sbsrsm_analysis
+
+        function rocsparse_dbsrsm_analysis(handle, dir, trans_A, trans_B, mb, nrhs, &
+                nnzb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, &
+                ldb, info, analysis, solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dbsrsm_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dbsrsm_analysis
+
+        function rocsparse_cbsrsm_analysis(handle, dir, trans_A, trans_B, mb, nrhs, &
+                nnzb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, &
+                ldb, info, analysis, solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_cbsrsm_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cbsrsm_analysis
+
+        function rocsparse_zbsrsm_analysis(handle, dir, trans_A, trans_B, mb, nrhs, &
+                nnzb, alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, &
+                ldb, info, analysis, solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zbsrsm_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zbsrsm_analysis
+
+!       rocsparse_bsrsm_clear
+        function rocsparse_bsrsm_clear(handle, info) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_bsrsm_clear')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+        end function rocsparse_bsrsm_clear
+
+!       rocsparse_bsrsm_solve
+        function rocsparse_sbsrsm_solve(handle, dir, trans_A, trans_B, mb, nrhs, nnzb, &
+                alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, ldb, &
+                info, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_sbsrsm_solve')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sbsrsm_solve
+
+        function rocsparse_dbsrsm_solve(handle, dir, trans_A, trans_B, mb, nrhs, nnzb, &
+                alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, ldb, &
+                info, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dbsrsm_solve')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dbsrsm_solve
+
+        function rocsparse_cbsrsm_solve(handle, dir, trans_A, trans_B, mb, nrhs, nnzb, &
+                alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, ldb, &
+                info, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_cbsrsm_solve')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cbsrsm_solve
+
+        function rocsparse_zbsrsm_solve(handle, dir, trans_A, trans_B, mb, nrhs, nnzb, &
+                alpha, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, B, ldb, &
+                info, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zbsrsm_solve')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: nrhs
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zbsrsm_solve
+
+!       rocsparse_gemmi
+        function rocsparse_sgemmi(handle, trans_A, trans_B, m, n, k, nnz, alpha, A, &
+                lda, descr, csr_val, csr_row_ptr, csr_col_ind, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_sgemmi')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_sgemmi
+
+        function rocsparse_dgemmi(handle, trans_A, trans_B, m, n, k, nnz, alpha, A, &
+                lda, descr, csr_val, csr_row_ptr, csr_col_ind, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dgemmi')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_dgemmi
+
+        function rocsparse_cgemmi(handle, trans_A, trans_B, m, n, k, nnz, alpha, A, &
+                lda, descr, csr_val, csr_row_ptr, csr_col_ind, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_cgemmi')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_cgemmi
+
+        function rocsparse_zgemmi(handle, trans_A, trans_B, m, n, k, nnz, alpha, A, &
+                lda, descr, csr_val, csr_row_ptr, csr_col_ind, beta, C, ldc) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zgemmi')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function rocsparse_zgemmi
+
+!       rocsparse_csrsddmm
+        function rocsparse_scsrsddmm(handle, order_A, order_B, m, n, k, alpha, A, lda, &
+                B, ldb, beta, descr, nnz, csr_val, csr_row_ptr, csr_col_ind) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrsddmm')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: order_A
+            integer(c_int), value :: order_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr
+            integer(c_int), value :: nnz
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+        end function rocsparse_scsrsddmm
+
+        function rocsparse_dcsrsddmm(handle, order_A, order_B, m, n, k, alpha, A, lda, &
+                B, ldb, beta, descr, nnz, csr_val, csr_row_ptr, csr_col_ind) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrsddmm')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: order_A
+            integer(c_int), value :: order_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr
+            integer(c_int), value :: nnz
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+        end function rocsparse_dcsrsddmm
+
+        function rocsparse_ccsrsddmm(handle, order_A, order_B, m, n, k, alpha, A, lda, &
+                B, ldb, beta, descr, nnz, csr_val, csr_row_ptr, csr_col_ind) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrsddmm')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: order_A
+            integer(c_int), value :: order_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr
+            integer(c_int), value :: nnz
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+        end function rocsparse_ccsrsddmm
+
+        function rocsparse_zcsrsddmm(handle, order_A, order_B, m, n, k, alpha, A, lda, &
+                B, ldb, beta, descr, nnz, csr_val, csr_row_ptr, csr_col_ind) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrsddmm')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: order_A
+            integer(c_int), value :: order_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr
+            integer(c_int), value :: nnz
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+        end function rocsparse_zcsrsddmm
+
+!       rocsparse_coosddmm
+        function rocsparse_scoosddmm(handle, order_A, order_B, m, n, k, alpha, A, lda, &
+                B, ldb, beta, descr, nnz, coo_val, coo_row_ind, coo_col_ind) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scoosddmm')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: order_A
+            integer(c_int), value :: order_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr
+            integer(c_int), value :: nnz
+            type(c_ptr), value :: coo_val
+            type(c_ptr), intent(in), value :: coo_row_ind
+            type(c_ptr), intent(in), value :: coo_col_ind
+        end function rocsparse_scoosddmm
+
+        function rocsparse_dcoosddmm(handle, order_A, order_B, m, n, k, alpha, A, lda, &
+                B, ldb, beta, descr, nnz, coo_val, coo_row_ind, coo_col_ind) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcoosddmm')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: order_A
+            integer(c_int), value :: order_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr
+            integer(c_int), value :: nnz
+            type(c_ptr), value :: coo_val
+            type(c_ptr), intent(in), value :: coo_row_ind
+            type(c_ptr), intent(in), value :: coo_col_ind
+        end function rocsparse_dcoosddmm
+
+        function rocsparse_ccoosddmm(handle, order_A, order_B, m, n, k, alpha, A, lda, &
+                B, ldb, beta, descr, nnz, coo_val, coo_row_ind, coo_col_ind) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccoosddmm')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: order_A
+            integer(c_int), value :: order_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr
+            integer(c_int), value :: nnz
+            type(c_ptr), value :: coo_val
+            type(c_ptr), intent(in), value :: coo_row_ind
+            type(c_ptr), intent(in), value :: coo_col_ind
+        end function rocsparse_ccoosddmm
+
+        function rocsparse_zcoosddmm(handle, order_A, order_B, m, n, k, alpha, A, lda, &
+                B, ldb, beta, descr, nnz, coo_val, coo_row_ind, coo_col_ind) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcoosddmm')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: order_A
+            integer(c_int), value :: order_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr
+            integer(c_int), value :: nnz
+            type(c_ptr), value :: coo_val
+            type(c_ptr), intent(in), value :: coo_row_ind
+            type(c_ptr), intent(in), value :: coo_col_ind
+        end function rocsparse_zcoosddmm
+
+! ===========================================================================
+!   extra SPARSE
+! ===========================================================================
+
+!       rocsparse_csrgeam_nnz
+        function rocsparse_csrgeam_nnz(handle, m, n, descr_A, nnz_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, csr_col_ind_B, descr_C, &
+                csr_row_ptr_C, nnz_C) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_csrgeam_nnz')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_row_ptr_C
+            type(c_ptr), value :: nnz_C
+        end function rocsparse_csrgeam_nnz
+
+!       rocsparse_csrgeam
+        function rocsparse_scsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
+                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
+                csr_col_ind_C) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrgeam')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+        end function rocsparse_scsrgeam
+
+        function rocsparse_dcsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
+                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
+                csr_col_ind_C) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrgeam')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+        end function rocsparse_dcsrgeam
+
+        function rocsparse_ccsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
+                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
+                csr_col_ind_C) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrgeam')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+        end function rocsparse_ccsrgeam
+
+        function rocsparse_zcsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
+                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
+                csr_col_ind_C) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrgeam')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+        end function rocsparse_zcsrgeam
+
+!       rocsparse_csrgemm_buffer_size
+        function rocsparse_scsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
+                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
+                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
+                buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrgemm_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), value :: info_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsrgemm_buffer_size
+
+        function rocsparse_dcsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
+                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
+                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
+                buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrgemm_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), value :: info_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsrgemm_buffer_size
+
+        function rocsparse_ccsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
+                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
+                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
+                buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrgemm_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), value :: info_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrgemm_buffer_size
+
+        function rocsparse_zcsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
+                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
+                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
+                buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrgemm_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), value :: info_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrgemm_buffer_size
+
+!       rocsparse_csrgemm_buffer_size_i64
+        function rocsparse_scsrgemm_buffer_size_i64(handle, trans_A, trans_B, m, n, k, &
+                alpha, descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, &
+                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, &
+                csr_col_ind_D, info_C, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrgemm_buffer_size_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int64_t), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int64_t), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int64_t), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), value :: info_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsrgemm_buffer_size_i64
+
+        function rocsparse_dcsrgemm_buffer_size_i64(handle, trans_A, trans_B, m, n, k, &
+                alpha, descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, &
+                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, &
+                csr_col_ind_D, info_C, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrgemm_buffer_size_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int64_t), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int64_t), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int64_t), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), value :: info_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsrgemm_buffer_size_i64
+
+        function rocsparse_ccsrgemm_buffer_size_i64(handle, trans_A, trans_B, m, n, k, &
+                alpha, descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, &
+                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, &
+                csr_col_ind_D, info_C, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrgemm_buffer_size_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int64_t), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int64_t), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int64_t), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), value :: info_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrgemm_buffer_size_i64
+
+        function rocsparse_zcsrgemm_buffer_size_i64(handle, trans_A, trans_B, m, n, k, &
+                alpha, descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, &
+                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, &
+                csr_col_ind_D, info_C, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrgemm_buffer_size_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int64_t), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int64_t), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int64_t), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), value :: info_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrgemm_buffer_size_i64
+
+!       rocsparse_csrgemm_nnz
+        function rocsparse_csrgemm_nnz(handle, trans_A, trans_B, m, n, k, descr_A, &
+                nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
+                csr_col_ind_B, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, descr_C, &
+                csr_row_ptr_C, nnz_C, info_C, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_csrgemm_nnz')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_row_ptr_C
+            type(c_ptr), value :: nnz_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_csrgemm_nnz
 
-!       rocsparse_csrgeam_nnz
-        function rocsparse_csrgeam_nnz(handle, m, n, descr_A, nnz_A, csr_row_ptr_A, &
-                csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, csr_col_ind_B, descr_C, &
-                csr_row_ptr_C, nnz_C) &
+!       rocsparse_csrgemm_nnz_i64
+        function rocsparse_csrgemm_nnz_i64(handle, trans_A, trans_B, m, n, k, descr_A, &
+                nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
+                csr_col_ind_B, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, descr_C, &
+                csr_row_ptr_C, nnz_C, info_C, temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_csrgeam_nnz')
+                bind(c, name = 'rocsparse_csrgemm_nnz_i64')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
+            integer(c_int64_t), value :: nnz_A
             type(c_ptr), intent(in), value :: csr_row_ptr_A
             type(c_ptr), intent(in), value :: csr_col_ind_A
             type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
+            integer(c_int64_t), value :: nnz_B
             type(c_ptr), intent(in), value :: csr_row_ptr_B
             type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int64_t), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
             type(c_ptr), intent(in), value :: descr_C
             type(c_ptr), value :: csr_row_ptr_C
             type(c_ptr), value :: nnz_C
-        end function rocsparse_csrgeam_nnz
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_csrgemm_nnz_i64
 
-!       rocsparse_csrgeam
-        function rocsparse_scsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
-                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
-                csr_col_ind_C) &
+!       rocsparse_csrgemm
+        function rocsparse_scsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
+                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
+                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+                temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_scsrgeam')
+                bind(c, name = 'rocsparse_scsrgemm')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr_A
             integer(c_int), value :: nnz_A
             type(c_ptr), intent(in), value :: csr_val_A
             type(c_ptr), intent(in), value :: csr_row_ptr_A
             type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr_B
             integer(c_int), value :: nnz_B
             type(c_ptr), intent(in), value :: csr_val_B
             type(c_ptr), intent(in), value :: csr_row_ptr_B
             type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
             type(c_ptr), intent(in), value :: descr_C
             type(c_ptr), value :: csr_val_C
             type(c_ptr), intent(in), value :: csr_row_ptr_C
             type(c_ptr), value :: csr_col_ind_C
-        end function rocsparse_scsrgeam
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrgemm
 
-        function rocsparse_dcsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
-                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
-                csr_col_ind_C) &
+        function rocsparse_dcsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
+                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
+                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+                temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dcsrgeam')
+                bind(c, name = 'rocsparse_dcsrgemm')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr_A
             integer(c_int), value :: nnz_A
             type(c_ptr), intent(in), value :: csr_val_A
             type(c_ptr), intent(in), value :: csr_row_ptr_A
             type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr_B
             integer(c_int), value :: nnz_B
             type(c_ptr), intent(in), value :: csr_val_B
             type(c_ptr), intent(in), value :: csr_row_ptr_B
             type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
             type(c_ptr), intent(in), value :: descr_C
             type(c_ptr), value :: csr_val_C
             type(c_ptr), intent(in), value :: csr_row_ptr_C
             type(c_ptr), value :: csr_col_ind_C
-        end function rocsparse_dcsrgeam
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrgemm
 
-        function rocsparse_ccsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
-                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
-                csr_col_ind_C) &
+        function rocsparse_ccsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
+                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
+                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+                temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_ccsrgeam')
+                bind(c, name = 'rocsparse_ccsrgemm')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr_A
             integer(c_int), value :: nnz_A
             type(c_ptr), intent(in), value :: csr_val_A
             type(c_ptr), intent(in), value :: csr_row_ptr_A
             type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr_B
             integer(c_int), value :: nnz_B
             type(c_ptr), intent(in), value :: csr_val_B
             type(c_ptr), intent(in), value :: csr_row_ptr_B
             type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
             type(c_ptr), intent(in), value :: descr_C
             type(c_ptr), value :: csr_val_C
             type(c_ptr), intent(in), value :: csr_row_ptr_C
             type(c_ptr), value :: csr_col_ind_C
-        end function rocsparse_ccsrgeam
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrgemm
 
-        function rocsparse_zcsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
-                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
-                csr_col_ind_C) &
+        function rocsparse_zcsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
+                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
+                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+                temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zcsrgeam')
+                bind(c, name = 'rocsparse_zcsrgemm')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr_A
             integer(c_int), value :: nnz_A
             type(c_ptr), intent(in), value :: csr_val_A
             type(c_ptr), intent(in), value :: csr_row_ptr_A
             type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr_B
             integer(c_int), value :: nnz_B
             type(c_ptr), intent(in), value :: csr_val_B
             type(c_ptr), intent(in), value :: csr_row_ptr_B
             type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
             type(c_ptr), intent(in), value :: descr_C
             type(c_ptr), value :: csr_val_C
             type(c_ptr), intent(in), value :: csr_row_ptr_C
             type(c_ptr), value :: csr_col_ind_C
-        end function rocsparse_zcsrgeam
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrgemm
 
-!       rocsparse_csrgemm_buffer_size
-        function rocsparse_scsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
-                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
-                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
-                buffer_size) &
+!       rocsparse_csrgemm_i64
+        function rocsparse_scsrgemm_i64(handle, trans_A, trans_B, m, n, k, alpha, &
+                descr_A, nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, &
+                csr_val_B, csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, &
+                csr_val_D, csr_row_ptr_D, csr_col_ind_D, descr_C, csr_val_C, &
+                csr_row_ptr_C, csr_col_ind_C, info_C, temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_scsrgemm_buffer_size')
+                bind(c, name = 'rocsparse_scsrgemm_i64')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
@@ -2529,28 +6160,36 @@ module rocsparse
             integer(c_int), value :: k
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
+            integer(c_int64_t), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
             type(c_ptr), intent(in), value :: csr_row_ptr_A
             type(c_ptr), intent(in), value :: csr_col_ind_A
             type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
+            integer(c_int64_t), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
             type(c_ptr), intent(in), value :: csr_row_ptr_B
             type(c_ptr), intent(in), value :: csr_col_ind_B
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
+            integer(c_int64_t), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
             type(c_ptr), intent(in), value :: csr_row_ptr_D
             type(c_ptr), intent(in), value :: csr_col_ind_D
-            type(c_ptr), value :: info_C
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_scsrgemm_buffer_size
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrgemm_i64
 
-        function rocsparse_dcsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
-                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
-                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
-                buffer_size) &
+        function rocsparse_dcsrgemm_i64(handle, trans_A, trans_B, m, n, k, alpha, &
+                descr_A, nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, &
+                csr_val_B, csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, &
+                csr_val_D, csr_row_ptr_D, csr_col_ind_D, descr_C, csr_val_C, &
+                csr_row_ptr_C, csr_col_ind_C, info_C, temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dcsrgemm_buffer_size')
+                bind(c, name = 'rocsparse_dcsrgemm_i64')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
@@ -2561,28 +6200,36 @@ module rocsparse
             integer(c_int), value :: k
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
+            integer(c_int64_t), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
             type(c_ptr), intent(in), value :: csr_row_ptr_A
             type(c_ptr), intent(in), value :: csr_col_ind_A
             type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
+            integer(c_int64_t), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
             type(c_ptr), intent(in), value :: csr_row_ptr_B
             type(c_ptr), intent(in), value :: csr_col_ind_B
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
+            integer(c_int64_t), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
             type(c_ptr), intent(in), value :: csr_row_ptr_D
             type(c_ptr), intent(in), value :: csr_col_ind_D
-            type(c_ptr), value :: info_C
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_dcsrgemm_buffer_size
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrgemm_i64
 
-        function rocsparse_ccsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
-                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
-                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
-                buffer_size) &
+        function rocsparse_ccsrgemm_i64(handle, trans_A, trans_B, m, n, k, alpha, &
+                descr_A, nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, &
+                csr_val_B, csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, &
+                csr_val_D, csr_row_ptr_D, csr_col_ind_D, descr_C, csr_val_C, &
+                csr_row_ptr_C, csr_col_ind_C, info_C, temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_ccsrgemm_buffer_size')
+                bind(c, name = 'rocsparse_ccsrgemm_i64')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
@@ -2593,28 +6240,36 @@ module rocsparse
             integer(c_int), value :: k
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
+            integer(c_int64_t), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
             type(c_ptr), intent(in), value :: csr_row_ptr_A
             type(c_ptr), intent(in), value :: csr_col_ind_A
             type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
+            integer(c_int64_t), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
             type(c_ptr), intent(in), value :: csr_row_ptr_B
             type(c_ptr), intent(in), value :: csr_col_ind_B
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
+            integer(c_int64_t), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
             type(c_ptr), intent(in), value :: csr_row_ptr_D
             type(c_ptr), intent(in), value :: csr_col_ind_D
-            type(c_ptr), value :: info_C
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_ccsrgemm_buffer_size
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrgemm_i64
 
-        function rocsparse_zcsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
-                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
-                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
-                buffer_size) &
+        function rocsparse_zcsrgemm_i64(handle, trans_A, trans_B, m, n, k, alpha, &
+                descr_A, nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, &
+                csr_val_B, csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, &
+                csr_val_D, csr_row_ptr_D, csr_col_ind_D, descr_C, csr_val_C, &
+                csr_row_ptr_C, csr_col_ind_C, info_C, temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zcsrgemm_buffer_size')
+                bind(c, name = 'rocsparse_zcsrgemm_i64')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
@@ -2625,216 +6280,232 @@ module rocsparse
             integer(c_int), value :: k
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
+            integer(c_int64_t), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
             type(c_ptr), intent(in), value :: csr_row_ptr_A
             type(c_ptr), intent(in), value :: csr_col_ind_A
             type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
+            integer(c_int64_t), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
             type(c_ptr), intent(in), value :: csr_row_ptr_B
             type(c_ptr), intent(in), value :: csr_col_ind_B
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
+            integer(c_int64_t), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
             type(c_ptr), intent(in), value :: csr_row_ptr_D
             type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrgemm_i64
+
+!       rocsparse_csrrap_buffer_size
+        function rocsparse_csrrap_buffer_size(handle, trans_R, m, n, k, descr_R, nnz_R, &
+                csr_row_ptr_R, csr_col_ind_R, descr_A, nnz_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_P, nnz_P, csr_row_ptr_P, csr_col_ind_P, info_C, &
+                buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_csrrap_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_R
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
             type(c_ptr), value :: info_C
             type(c_ptr), value :: buffer_size
-        end function rocsparse_zcsrgemm_buffer_size
+        end function rocsparse_csrrap_buffer_size
 
-!       rocsparse_csrgemm_nnz
-        function rocsparse_csrgemm_nnz(handle, trans_A, trans_B, m, n, k, descr_A, &
-                nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
-                csr_col_ind_B, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, descr_C, &
+!       rocsparse_csrrap_nnz
+        function rocsparse_csrrap_nnz(handle, trans_R, m, n, k, descr_R, nnz_R, &
+                csr_row_ptr_R, csr_col_ind_R, descr_A, nnz_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_P, nnz_P, csr_row_ptr_P, csr_col_ind_P, descr_C, &
                 csr_row_ptr_C, nnz_C, info_C, temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_csrgemm_nnz')
+                bind(c, name = 'rocsparse_csrrap_nnz')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans_R
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
             type(c_ptr), intent(in), value :: descr_A
             integer(c_int), value :: nnz_A
             type(c_ptr), intent(in), value :: csr_row_ptr_A
             type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
             type(c_ptr), intent(in), value :: descr_C
             type(c_ptr), value :: csr_row_ptr_C
             type(c_ptr), value :: nnz_C
             type(c_ptr), intent(in), value :: info_C
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_csrgemm_nnz
+        end function rocsparse_csrrap_nnz
 
-!       rocsparse_csrgemm
-        function rocsparse_scsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
-                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
-                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
-                temp_buffer) &
+!       rocsparse_csrrap
+        function rocsparse_scsrrap(handle, trans_R, m, n, k, descr_R, nnz_R, csr_val_R, &
+                csr_row_ptr_R, csr_col_ind_R, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_P, nnz_P, csr_val_P, csr_row_ptr_P, csr_col_ind_P, &
+                descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_scsrgemm')
+                bind(c, name = 'rocsparse_scsrrap')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans_R
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
-            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_val_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
             type(c_ptr), intent(in), value :: descr_A
             integer(c_int), value :: nnz_A
             type(c_ptr), intent(in), value :: csr_val_A
             type(c_ptr), intent(in), value :: csr_row_ptr_A
             type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_val_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_val_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_val_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
             type(c_ptr), intent(in), value :: descr_C
             type(c_ptr), value :: csr_val_C
             type(c_ptr), intent(in), value :: csr_row_ptr_C
             type(c_ptr), value :: csr_col_ind_C
             type(c_ptr), intent(in), value :: info_C
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsrgemm
+        end function rocsparse_scsrrap
 
-        function rocsparse_dcsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
-                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
-                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
-                temp_buffer) &
+        function rocsparse_dcsrrap(handle, trans_R, m, n, k, descr_R, nnz_R, csr_val_R, &
+                csr_row_ptr_R, csr_col_ind_R, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_P, nnz_P, csr_val_P, csr_row_ptr_P, csr_col_ind_P, &
+                descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dcsrgemm')
+                bind(c, name = 'rocsparse_dcsrrap')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans_R
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
-            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_val_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
             type(c_ptr), intent(in), value :: descr_A
             integer(c_int), value :: nnz_A
             type(c_ptr), intent(in), value :: csr_val_A
             type(c_ptr), intent(in), value :: csr_row_ptr_A
             type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_val_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_val_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_val_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
             type(c_ptr), intent(in), value :: descr_C
             type(c_ptr), value :: csr_val_C
             type(c_ptr), intent(in), value :: csr_row_ptr_C
             type(c_ptr), value :: csr_col_ind_C
             type(c_ptr), intent(in), value :: info_C
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsrgemm
+        end function rocsparse_dcsrrap
 
-        function rocsparse_ccsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
-                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
-                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
-                temp_buffer) &
+        function rocsparse_ccsrrap(handle, trans_R, m, n, k, descr_R, nnz_R, csr_val_R, &
+                csr_row_ptr_R, csr_col_ind_R, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_P, nnz_P, csr_val_P, csr_row_ptr_P, csr_col_ind_P, &
+                descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_ccsrgemm')
+                bind(c, name = 'rocsparse_ccsrrap')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans_R
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
-            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_val_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
             type(c_ptr), intent(in), value :: descr_A
             integer(c_int), value :: nnz_A
             type(c_ptr), intent(in), value :: csr_val_A
             type(c_ptr), intent(in), value :: csr_row_ptr_A
             type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_val_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_val_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_val_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
             type(c_ptr), intent(in), value :: descr_C
             type(c_ptr), value :: csr_val_C
             type(c_ptr), intent(in), value :: csr_row_ptr_C
             type(c_ptr), value :: csr_col_ind_C
             type(c_ptr), intent(in), value :: info_C
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsrgemm
+        end function rocsparse_ccsrrap
 
-        function rocsparse_zcsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
-                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
-                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
-                temp_buffer) &
+        function rocsparse_zcsrrap(handle, trans_R, m, n, k, descr_R, nnz_R, csr_val_R, &
+                csr_row_ptr_R, csr_col_ind_R, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_P, nnz_P, csr_val_P, csr_row_ptr_P, csr_col_ind_P, &
+                descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zcsrgemm')
+                bind(c, name = 'rocsparse_zcsrrap')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
+            integer(c_int), value :: trans_R
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
-            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_val_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
             type(c_ptr), intent(in), value :: descr_A
             integer(c_int), value :: nnz_A
             type(c_ptr), intent(in), value :: csr_val_A
             type(c_ptr), intent(in), value :: csr_row_ptr_A
             type(c_ptr), intent(in), value :: csr_col_ind_A
-            type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_val_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_val_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_val_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
             type(c_ptr), intent(in), value :: descr_C
             type(c_ptr), value :: csr_val_C
             type(c_ptr), intent(in), value :: csr_row_ptr_C
             type(c_ptr), value :: csr_col_ind_C
             type(c_ptr), intent(in), value :: info_C
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsrgemm
+        end function rocsparse_zcsrrap
 
 ! ===========================================================================
 !   preconditioner SPARSE
@@ -3084,25 +6755,289 @@ module rocsparse
             type(c_ptr), value :: temp_buffer	
         end function rocsparse_cbsric0	
 
-        function rocsparse_zbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &	
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &	
-                result(c_int) &	
-                bind(c, name = 'rocsparse_zbsric0')	
-            use iso_c_binding	
-            implicit none	
-            type(c_ptr), value :: handle	
-            integer(c_int), value :: dir	
-            integer(c_int), value :: mb	
-            integer(c_int), value :: nnzb	
-            type(c_ptr), intent(in), value :: descr	
-            type(c_ptr), intent(in), value :: bsr_val	
-            type(c_ptr), intent(in), value :: bsr_row_ptr	
-            type(c_ptr), intent(in), value :: bsr_col_ind	
-            integer(c_int), value :: block_dim	
-            type(c_ptr), value :: info	
-            integer(c_int), value :: policy	
-            type(c_ptr), value :: temp_buffer	
-        end function rocsparse_zbsric0
+        function rocsparse_zbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &	
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &	
+                result(c_int) &	
+                bind(c, name = 'rocsparse_zbsric0')	
+            use iso_c_binding	
+            implicit none	
+            type(c_ptr), value :: handle	
+            integer(c_int), value :: dir	
+            integer(c_int), value :: mb	
+            integer(c_int), value :: nnzb	
+            type(c_ptr), intent(in), value :: descr	
+            type(c_ptr), intent(in), value :: bsr_val	
+            type(c_ptr), intent(in), value :: bsr_row_ptr	
+            type(c_ptr), intent(in), value :: bsr_col_ind	
+            integer(c_int), value :: block_dim	
+            type(c_ptr), value :: info	
+            integer(c_int), value :: policy	
+            type(c_ptr), value :: temp_buffer	
+        end function rocsparse_zbsric0
+
+!       rocsparse_bsrilu0_zero_pivot
+        function rocsparse_bsrilu0_zero_pivot(handle, info, position) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_bsrilu0_zero_pivot')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_bsrilu0_zero_pivot
+
+!       rocsparse_bsrilu0_buffer_size
+        function rocsparse_sbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_sbsrilu0_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_sbsrilu0_buffer_size
+
+        function rocsparse_dbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dbsrilu0_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dbsrilu0_buffer_size
+
+        function rocsparse_cbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_cbsrilu0_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_cbsrilu0_buffer_size
+
+        function rocsparse_zbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zbsrilu0_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zbsrilu0_buffer_size
+
+!       rocsparse_bsrilu0_analysis
+        function rocsparse_sbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_sbsrilu0_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sbsrilu0_analysis
+
+        function rocsparse_dbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dbsrilu0_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dbsrilu0_analysis
+
+        function rocsparse_cbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_cbsrilu0_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cbsrilu0_analysis
+
+        function rocsparse_zbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zbsrilu0_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zbsrilu0_analysis
+
+!       rocsparse_bsrilu0_clear
+        function rocsparse_bsrilu0_clear(handle, info) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_bsrilu0_clear')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+        end function rocsparse_bsrilu0_clear
+
+!       rocsparse_bsrilu0
+        function rocsparse_sbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_sbsrilu0')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sbsrilu0
+
+        function rocsparse_dbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dbsrilu0')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dbsrilu0
+
+        function rocsparse_cbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_cbsrilu0')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cbsrilu0
+
+        function rocsparse_zbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zbsrilu0')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zbsrilu0
 
 
 !       rocsparse_csric0_zero_pivot
@@ -3345,6 +7280,45 @@ module rocsparse
             type(c_ptr), value :: temp_buffer
         end function rocsparse_zcsric0
 
+!       rocsparse_csric0_mixed
+        function rocsparse_dscsric0(handle, m, nnz, descr, csr_val, ic_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dscsric0')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), value :: ic_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dscsric0
+
+        function rocsparse_zccsric0(handle, m, nnz, descr, csr_val, ic_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zccsric0')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), value :: ic_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zccsric0
+
 !       rocsparse_csrilu0_zero_pivot
         function rocsparse_csrilu0_zero_pivot(handle, info, position) &
                 result(c_int) &
@@ -3377,7 +7351,182 @@ module rocsparse
         function rocsparse_dcsrilu0_buffer_size(handle, m, nnz, descr, csr_val, &
                 csr_row_ptr, csr_col_ind, info, buffer_size) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dcsrilu0_buffer_size')
+                bind(c, name = 'rocsparse_dcsrilu0_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsrilu0_buffer_size
+
+        function rocsparse_ccsrilu0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrilu0_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrilu0_buffer_size
+
+        function rocsparse_zcsrilu0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrilu0_buffer_size')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrilu0_buffer_size
+
+!       rocsparse_csrilu0_analysis
+        function rocsparse_scsrilu0_analysis(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrilu0_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrilu0_analysis
+
+        function rocsparse_dcsrilu0_analysis(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrilu0_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrilu0_analysis
+
+        function rocsparse_ccsrilu0_analysis(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrilu0_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrilu0_analysis
+
+        function rocsparse_zcsrilu0_analysis(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsrilu0_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrilu0_analysis
+
+!       rocsparse_csrilu0_clear
+        function rocsparse_csrilu0_clear(handle, info) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_csrilu0_clear')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+        end function rocsparse_csrilu0_clear
+
+!       rocsparse_csrilu0
+        function rocsparse_scsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsrilu0')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrilu0
+
+        function rocsparse_dcsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsrilu0')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrilu0
+
+        function rocsparse_ccsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsrilu0')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
@@ -3388,13 +7537,14 @@ module rocsparse
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_dcsrilu0_buffer_size
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrilu0
 
-        function rocsparse_ccsrilu0_buffer_size(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
+        function rocsparse_zcsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_ccsrilu0_buffer_size')
+                bind(c, name = 'rocsparse_zcsrilu0')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
@@ -3405,13 +7555,15 @@ module rocsparse
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_ccsrilu0_buffer_size
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrilu0
 
-        function rocsparse_zcsrilu0_buffer_size(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
+!       rocsparse_csrilu0_mixed
+        function rocsparse_dscsrilu0(handle, m, nnz, descr, csr_val, ilu_val, &
+                csr_row_ptr, csr_col_ind, info, policy, temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zcsrilu0_buffer_size')
+                bind(c, name = 'rocsparse_dscsrilu0')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
@@ -3419,17 +7571,18 @@ module rocsparse
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), value :: ilu_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_zcsrilu0_buffer_size
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dscsrilu0
 
-!       rocsparse_csrilu0_analysis
-        function rocsparse_scsrilu0_analysis(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+        function rocsparse_zccsrilu0(handle, m, nnz, descr, csr_val, ilu_val, &
+                csr_row_ptr, csr_col_ind, info, policy, temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_scsrilu0_analysis')
+                bind(c, name = 'rocsparse_zccsrilu0')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
@@ -3437,18 +7590,19 @@ module rocsparse
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), value :: ilu_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
+            integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsrilu0_analysis
+        end function rocsparse_zccsrilu0
 
-        function rocsparse_dcsrilu0_analysis(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+!       rocsparse_csrilu0_strided_batched_buffer_size
+        function rocsparse_scsrilu0_strided_batched_buffer_size(handle, m, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, batch_count, buffer_size) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dcsrilu0_analysis')
+                bind(c, name = 'rocsparse_scsrilu0_strided_batched_buffer_size')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
@@ -3459,15 +7613,14 @@ module rocsparse
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsrilu0_analysis
+            integer(c_int), value :: batch_count
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsrilu0_strided_batched_buffer_size
 
-        function rocsparse_ccsrilu0_analysis(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+        function rocsparse_dcsrilu0_strided_batched_buffer_size(handle, m, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, batch_count, buffer_size) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_ccsrilu0_analysis')
+                bind(c, name = 'rocsparse_dcsrilu0_strided_batched_buffer_size')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
@@ -3478,15 +7631,14 @@ module rocsparse
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsrilu0_analysis
+            integer(c_int), value :: batch_count
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsrilu0_strided_batched_buffer_size
 
-        function rocsparse_zcsrilu0_analysis(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+        function rocsparse_ccsrilu0_strided_batched_buffer_size(handle, m, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, batch_count, buffer_size) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zcsrilu0_analysis')
+                bind(c, name = 'rocsparse_ccsrilu0_strided_batched_buffer_size')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
@@ -3497,93 +7649,112 @@ module rocsparse
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsrilu0_analysis
+            integer(c_int), value :: batch_count
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrilu0_strided_batched_buffer_size
 
-!       rocsparse_csrilu0_clear
-        function rocsparse_csrilu0_clear(handle, info) &
+        function rocsparse_zcsrilu0_strided_batched_buffer_size(handle, m, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, info, batch_count, buffer_size) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_csrilu0_clear')
+                bind(c, name = 'rocsparse_zcsrilu0_strided_batched_buffer_size')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-        end function rocsparse_csrilu0_clear
+            integer(c_int), value :: batch_count
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrilu0_strided_batched_buffer_size
 
-!       rocsparse_csrilu0
-        function rocsparse_scsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, info, policy, temp_buffer) &
+!       rocsparse_csrilu0_strided_batched
+        function rocsparse_scsrilu0_strided_batched(handle, m, nnz, descr, csr_val, &
+                stride_val, csr_row_ptr, csr_col_ind, info, batch_count, policy, &
+                temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_scsrilu0')
+                bind(c, name = 'rocsparse_scsrilu0_strided_batched')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), value :: csr_val
+            integer(c_int), value :: stride_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
             integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsrilu0
+        end function rocsparse_scsrilu0_strided_batched
 
-        function rocsparse_dcsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, info, policy, temp_buffer) &
+        function rocsparse_dcsrilu0_strided_batched(handle, m, nnz, descr, csr_val, &
+                stride_val, csr_row_ptr, csr_col_ind, info, batch_count, policy, &
+                temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_dcsrilu0')
+                bind(c, name = 'rocsparse_dcsrilu0_strided_batched')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), value :: csr_val
+            integer(c_int), value :: stride_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
             integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsrilu0
+        end function rocsparse_dcsrilu0_strided_batched
 
-        function rocsparse_ccsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, info, policy, temp_buffer) &
+        function rocsparse_ccsrilu0_strided_batched(handle, m, nnz, descr, csr_val, &
+                stride_val, csr_row_ptr, csr_col_ind, info, batch_count, policy, &
+                temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_ccsrilu0')
+                bind(c, name = 'rocsparse_ccsrilu0_strided_batched')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), value :: csr_val
+            integer(c_int), value :: stride_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
             integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsrilu0
+        end function rocsparse_ccsrilu0_strided_batched
 
-        function rocsparse_zcsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, info, policy, temp_buffer) &
+        function rocsparse_zcsrilu0_strided_batched(handle, m, nnz, descr, csr_val, &
+                stride_val, csr_row_ptr, csr_col_ind, info, batch_count, policy, &
+                temp_buffer) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zcsrilu0')
+                bind(c, name = 'rocsparse_zcsrilu0_strided_batched')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), value :: csr_val
+            integer(c_int), value :: stride_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
             integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsrilu0
+        end function rocsparse_zcsrilu0_strided_batched
 
 ! ===========================================================================
 !   conversion SPARSE
@@ -4021,6 +8192,21 @@ module rocsparse
             integer(c_int), value :: idx_base
         end function rocsparse_csr2coo
 
+!       rocsparse_csr2coo_i64
+        function rocsparse_csr2coo_i64(handle, csr_row_ptr, nnz, m, coo_row_ind, &
+                idx_base) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_csr2coo_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            integer(c_int64_t), value :: nnz
+            integer(c_int), value :: m
+            type(c_ptr), value :: coo_row_ind
+            integer(c_int), value :: idx_base
+        end function rocsparse_csr2coo_i64
+
 !       rocsparse_csr2csc_buffer_size
         function rocsparse_csr2csc_buffer_size(handle, m, n, nnz, csr_row_ptr, &
                 csr_col_ind, copy_values, buffer_size) &
@@ -4038,6 +8224,23 @@ module rocsparse
             type(c_ptr), value :: buffer_size
         end function rocsparse_csr2csc_buffer_size
 
+!       rocsparse_csr2csc_buffer_size_i64
+        function rocsparse_csr2csc_buffer_size_i64(handle, m, n, nnz, csr_row_ptr, &
+                csr_col_ind, copy_values, buffer_size) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_csr2csc_buffer_size_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int64_t), value :: nnz
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: copy_values
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_csr2csc_buffer_size_i64
+
 !       rocsparse_csr2csc
         function rocsparse_scsr2csc(handle, m, n, nnz, csr_val, csr_row_ptr, &
                 csr_col_ind, csc_val, csc_row_ind, csc_col_ptr, copy_values, &
@@ -4127,6 +8330,95 @@ module rocsparse
             type(c_ptr), value :: temp_buffer
         end function rocsparse_zcsr2csc
 
+!       rocsparse_csr2csc_i64
+        function rocsparse_scsr2csc_i64(handle, m, n, nnz, csr_val, csr_row_ptr, &
+                csr_col_ind, csc_val, csc_row_ind, csc_col_ptr, copy_values, idx_base, &
+                temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsr2csc_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int64_t), value :: nnz
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: csc_val
+            type(c_ptr), value :: csc_row_ind
+            type(c_ptr), value :: csc_col_ptr
+            integer(c_int), value :: copy_values
+            integer(c_int), value :: idx_base
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsr2csc_i64
+
+        function rocsparse_dcsr2csc_i64(handle, m, n, nnz, csr_val, csr_row_ptr, &
+                csr_col_ind, csc_val, csc_row_ind, csc_col_ptr, copy_values, idx_base, &
+                temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsr2csc_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int64_t), value :: nnz
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: csc_val
+            type(c_ptr), value :: csc_row_ind
+            type(c_ptr), value :: csc_col_ptr
+            integer(c_int), value :: copy_values
+            integer(c_int), value :: idx_base
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsr2csc_i64
+
+        function rocsparse_ccsr2csc_i64(handle, m, n, nnz, csr_val, csr_row_ptr, &
+                csr_col_ind, csc_val, csc_row_ind, csc_col_ptr, copy_values, idx_base, &
+                temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsr2csc_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int64_t), value :: nnz
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: csc_val
+            type(c_ptr), value :: csc_row_ind
+            type(c_ptr), value :: csc_col_ptr
+            integer(c_int), value :: copy_values
+            integer(c_int), value :: idx_base
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsr2csc_i64
+
+        function rocsparse_zcsr2csc_i64(handle, m, n, nnz, csr_val, csr_row_ptr, &
+                csr_col_ind, csc_val, csc_row_ind, csc_col_ptr, copy_values, idx_base, &
+                temp_buffer) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsr2csc_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int64_t), value :: nnz
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: csc_val
+            type(c_ptr), value :: csc_row_ind
+            type(c_ptr), value :: csc_col_ptr
+            integer(c_int), value :: copy_values
+            integer(c_int), value :: idx_base
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsr2csc_i64
+
 !       rocsparse_csr2ell_width
         function rocsparse_csr2ell_width(handle, m, csr_descr, csr_row_ptr, &
                 ell_descr, ell_width) &
@@ -4179,41 +8471,131 @@ module rocsparse
             type(c_ptr), value :: ell_col_ind
         end function rocsparse_dcsr2ell
 
-        function rocsparse_ccsr2ell(handle, m, csr_descr, csr_val, csr_row_ptr, &
-                csr_col_ind, ell_descr, ell_width, ell_val, ell_col_ind) &
+        function rocsparse_ccsr2ell(handle, m, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind, ell_descr, ell_width, ell_val, ell_col_ind) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsr2ell')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: ell_descr
+            integer(c_int), value :: ell_width
+            type(c_ptr), value :: ell_val
+            type(c_ptr), value :: ell_col_ind
+        end function rocsparse_ccsr2ell
+
+        function rocsparse_zcsr2ell(handle, m, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind, ell_descr, ell_width, ell_val, ell_col_ind) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsr2ell')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: ell_descr
+            integer(c_int), value :: ell_width
+            type(c_ptr), value :: ell_val
+            type(c_ptr), value :: ell_col_ind
+        end function rocsparse_zcsr2ell
+
+!       rocsparse_csr2dia_ndiag
+        function rocsparse_csr2dia_ndiag(handle, m, n, csr_descr, csr_row_ptr, &
+                csr_col_ind, dia_num_diag, dia_fill) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_csr2dia_ndiag')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: dia_num_diag
+            type(c_ptr), value :: dia_fill
+        end function rocsparse_csr2dia_ndiag
+
+!       rocsparse_csr2dia
+        function rocsparse_scsr2dia(handle, m, n, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind, dia_num_diag, dia_val, dia_offset) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsr2dia')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: dia_num_diag
+            type(c_ptr), value :: dia_val
+            type(c_ptr), value :: dia_offset
+        end function rocsparse_scsr2dia
+
+        function rocsparse_dcsr2dia(handle, m, n, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind, dia_num_diag, dia_val, dia_offset) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsr2dia')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: dia_num_diag
+            type(c_ptr), value :: dia_val
+            type(c_ptr), value :: dia_offset
+        end function rocsparse_dcsr2dia
+
+        function rocsparse_ccsr2dia(handle, m, n, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind, dia_num_diag, dia_val, dia_offset) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_ccsr2ell')
+                bind(c, name = 'rocsparse_ccsr2dia')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
+            integer(c_int), value :: n
             type(c_ptr), intent(in), value :: csr_descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: ell_descr
-            integer(c_int), value :: ell_width
-            type(c_ptr), value :: ell_val
-            type(c_ptr), value :: ell_col_ind
-        end function rocsparse_ccsr2ell
+            integer(c_int), value :: dia_num_diag
+            type(c_ptr), value :: dia_val
+            type(c_ptr), value :: dia_offset
+        end function rocsparse_ccsr2dia
 
-        function rocsparse_zcsr2ell(handle, m, csr_descr, csr_val, csr_row_ptr, &
-                csr_col_ind, ell_descr, ell_width, ell_val, ell_col_ind) &
+        function rocsparse_zcsr2dia(handle, m, n, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind, dia_num_diag, dia_val, dia_offset) &
                 result(c_int) &
-                bind(c, name = 'rocsparse_zcsr2ell')
+                bind(c, name = 'rocsparse_zcsr2dia')
             use iso_c_binding
             implicit none
             type(c_ptr), value :: handle
             integer(c_int), value :: m
+            integer(c_int), value :: n
             type(c_ptr), intent(in), value :: csr_descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), intent(in), value :: ell_descr
-            integer(c_int), value :: ell_width
-            type(c_ptr), value :: ell_val
-            type(c_ptr), value :: ell_col_ind
-        end function rocsparse_zcsr2ell
+            integer(c_int), value :: dia_num_diag
+            type(c_ptr), value :: dia_val
+            type(c_ptr), value :: dia_offset
+        end function rocsparse_zcsr2dia
 
 !       rocsparse_csr2hyb
         function rocsparse_scsr2hyb(handle, m, n, descr, csr_val, csr_row_ptr, &
@@ -4288,6 +8670,63 @@ module rocsparse
             integer(c_int), value :: partition_type
         end function rocsparse_zcsr2hyb
 
+!       rocsparse_csr2hyb_ell_width_analysis
+        function rocsparse_scsr2hyb_ell_width_analysis(handle, m, descr, csr_row_ptr, &
+                ell_width, row_nnz_hist) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsr2hyb_ell_width_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), value :: ell_width
+            type(c_ptr), value :: row_nnz_hist
+        end function rocsparse_scsr2hyb_ell_width_analysis
+
+        function rocsparse_dcsr2hyb_ell_width_analysis(handle, m, descr, csr_row_ptr, &
+                ell_width, row_nnz_hist) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsr2hyb_ell_width_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), value :: ell_width
+            type(c_ptr), value :: row_nnz_hist
+        end function rocsparse_dcsr2hyb_ell_width_analysis
+
+        function rocsparse_ccsr2hyb_ell_width_analysis(handle, m, descr, csr_row_ptr, &
+                ell_width, row_nnz_hist) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsr2hyb_ell_width_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), value :: ell_width
+            type(c_ptr), value :: row_nnz_hist
+        end function rocsparse_ccsr2hyb_ell_width_analysis
+
+        function rocsparse_zcsr2hyb_ell_width_analysis(handle, m, descr, csr_row_ptr, &
+                ell_width, row_nnz_hist) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsr2hyb_ell_width_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), value :: ell_width
+            type(c_ptr), value :: row_nnz_hist
+        end function rocsparse_zcsr2hyb_ell_width_analysis
+
 !       rocsparse_csr2bsr_nnz
         function rocsparse_csr2bsr_nnz(handle, dir, m, n, csr_descr, csr_row_ptr, &
                 csr_col_ind, block_dim, bsr_descr, bsr_row_ptr, bsr_nnz) &
@@ -4393,6 +8832,280 @@ module rocsparse
             type(c_ptr), value :: bsr_col_ind
         end function rocsparse_zcsr2bsr
 
+!       rocsparse_csr2bsr_block_dim_analysis
+        function rocsparse_scsr2bsr_block_dim_analysis(handle, m, n, csr_descr, &
+                csr_row_ptr, csr_col_ind, num_block_dims, block_dims, sample_size, &
+                bsr_nnzb, fill_ratio, bsrmv_cost) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsr2bsr_block_dim_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: num_block_dims
+            type(c_ptr), intent(in), value :: block_dims
+            integer(c_int), value :: sample_size
+            type(c_ptr), value :: bsr_nnzb
+            type(c_ptr), value :: fill_ratio
+            type(c_ptr), value :: bsrmv_cost
+        end function rocsparse_scsr2bsr_block_dim_analysis
+
+        function rocsparse_dcsr2bsr_block_dim_analysis(handle, m, n, csr_descr, &
+                csr_row_ptr, csr_col_ind, num_block_dims, block_dims, sample_size, &
+                bsr_nnzb, fill_ratio, bsrmv_cost) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsr2bsr_block_dim_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: num_block_dims
+            type(c_ptr), intent(in), value :: block_dims
+            integer(c_int), value :: sample_size
+            type(c_ptr), value :: bsr_nnzb
+            type(c_ptr), value :: fill_ratio
+            type(c_ptr), value :: bsrmv_cost
+        end function rocsparse_dcsr2bsr_block_dim_analysis
+
+        function rocsparse_ccsr2bsr_block_dim_analysis(handle, m, n, csr_descr, &
+                csr_row_ptr, csr_col_ind, num_block_dims, block_dims, sample_size, &
+                bsr_nnzb, fill_ratio, bsrmv_cost) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsr2bsr_block_dim_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: num_block_dims
+            type(c_ptr), intent(in), value :: block_dims
+            integer(c_int), value :: sample_size
+            type(c_ptr), value :: bsr_nnzb
+            type(c_ptr), value :: fill_ratio
+            type(c_ptr), value :: bsrmv_cost
+        end function rocsparse_ccsr2bsr_block_dim_analysis
+
+        function rocsparse_zcsr2bsr_block_dim_analysis(handle, m, n, csr_descr, &
+                csr_row_ptr, csr_col_ind, num_block_dims, block_dims, sample_size, &
+                bsr_nnzb, fill_ratio, bsrmv_cost) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsr2bsr_block_dim_analysis')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: num_block_dims
+            type(c_ptr), intent(in), value :: block_dims
+            integer(c_int), value :: sample_size
+            type(c_ptr), value :: bsr_nnzb
+            type(c_ptr), value :: fill_ratio
+            type(c_ptr), value :: bsrmv_cost
+        end function rocsparse_zcsr2bsr_block_dim_analysis
+
+!       rocsparse_csr2vbr_partition
+        function rocsparse_csr2vbr_partition(handle, m, n, csr_descr, csr_row_ptr, &
+                csr_col_ind, vbr_descr, mb, nb, vbr_row_ptn, vbr_col_ptn) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_csr2vbr_partition')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: vbr_descr
+            type(c_ptr), value :: mb
+            type(c_ptr), value :: nb
+            type(c_ptr), value :: vbr_row_ptn
+            type(c_ptr), value :: vbr_col_ptn
+        end function rocsparse_csr2vbr_partition
+
+!       rocsparse_csr2vbr_nnz
+        function rocsparse_csr2vbr_nnz(handle, m, n, csr_descr, csr_row_ptr, &
+                csr_col_ind, mb, nb, vbr_descr, vbr_row_ptr, vbr_row_ptn, vbr_col_ptn, &
+                vbr_nnzb, vbr_nnz) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_csr2vbr_nnz')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            type(c_ptr), intent(in), value :: vbr_descr
+            type(c_ptr), value :: vbr_row_ptr
+            type(c_ptr), intent(in), value :: vbr_row_ptn
+            type(c_ptr), intent(in), value :: vbr_col_ptn
+            type(c_ptr), value :: vbr_nnzb
+            type(c_ptr), value :: vbr_nnz
+        end function rocsparse_csr2vbr_nnz
+
+!       rocsparse_csr2vbr
+        function rocsparse_scsr2vbr(handle, dir, m, n, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind, mb, nb, vbr_descr, vbr_val, vbr_val_ptr, vbr_row_ptr, &
+                vbr_col_ind, vbr_row_ptn, vbr_col_ptn) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_scsr2vbr')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            type(c_ptr), intent(in), value :: vbr_descr
+            type(c_ptr), value :: vbr_val
+            type(c_ptr), value :: vbr_val_ptr
+            type(c_ptr), value :: vbr_row_ptr
+            type(c_ptr), value :: vbr_col_ind
+            type(c_ptr), intent(in), value :: vbr_row_ptn
+            type(c_ptr), intent(in), value :: vbr_col_ptn
+        end function rocsparse_scsr2vbr
+
+        function rocsparse_dcsr2vbr(handle, dir, m, n, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind, mb, nb, vbr_descr, vbr_val, vbr_val_ptr, vbr_row_ptr, &
+                vbr_col_ind, vbr_row_ptn, vbr_col_ptn) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dcsr2vbr')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            type(c_ptr), intent(in), value :: vbr_descr
+            type(c_ptr), value :: vbr_val
+            type(c_ptr), value :: vbr_val_ptr
+            type(c_ptr), value :: vbr_row_ptr
+            type(c_ptr), value :: vbr_col_ind
+            type(c_ptr), intent(in), value :: vbr_row_ptn
+            type(c_ptr), intent(in), value :: vbr_col_ptn
+        end function rocsparse_dcsr2vbr
+
+        function rocsparse_ccsr2vbr(handle, dir, m, n, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind, mb, nb, vbr_descr, vbr_val, vbr_val_ptr, vbr_row_ptr, &
+                vbr_col_ind, vbr_row_ptn, vbr_col_ptn) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ccsr2vbr')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            type(c_ptr), intent(in), value :: vbr_descr
+            type(c_ptr), value :: vbr_val
+            type(c_ptr), value :: vbr_val_ptr
+            type(c_ptr), value :: vbr_row_ptr
+            type(c_ptr), value :: vbr_col_ind
+            type(c_ptr), intent(in), value :: vbr_row_ptn
+            type(c_ptr), intent(in), value :: vbr_col_ptn
+        end function rocsparse_ccsr2vbr
+
+        function rocsparse_zcsr2vbr(handle, dir, m, n, csr_descr, csr_val, csr_row_ptr, &
+                csr_col_ind, mb, nb, vbr_descr, vbr_val, vbr_val_ptr, vbr_row_ptr, &
+                vbr_col_ind, vbr_row_ptn, vbr_col_ptn) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zcsr2vbr')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            type(c_ptr), intent(in), value :: vbr_descr
+            type(c_ptr), value :: vbr_val
+            type(c_ptr), value :: vbr_val_ptr
+            type(c_ptr), value :: vbr_row_ptr
+            type(c_ptr), value :: vbr_col_ind
+            type(c_ptr), intent(in), value :: vbr_row_ptn
+            type(c_ptr), intent(in), value :: vbr_col_ptn
+        end function rocsparse_zcsr2vbr
+
+!       rocsparse_csr2csrdc_nnz
+        function rocsparse_csr2csrdc_nnz(handle, m, n, csr_descr, csr_row_ptr, &
+                csr_col_ind, delta_bits, csrdc_exc_ptr, csrdc_nnz_exc, &
+                compression_ratio) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_csr2csrdc_nnz')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: delta_bits
+            type(c_ptr), value :: csrdc_exc_ptr
+            type(c_ptr), value :: csrdc_nnz_exc
+            type(c_ptr), value :: compression_ratio
+        end function rocsparse_csr2csrdc_nnz
+
+!       rocsparse_csr2csrdc
+        function rocsparse_csr2csrdc(handle, m, n, csr_descr, csr_row_ptr, csr_col_ind, &
+                delta_bits, csrdc_col_base, csrdc_delta, csrdc_exc_ptr, csrdc_exc_col) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_csr2csrdc')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: delta_bits
+            type(c_ptr), value :: csrdc_col_base
+            type(c_ptr), value :: csrdc_delta
+            type(c_ptr), intent(in), value :: csrdc_exc_ptr
+            type(c_ptr), value :: csrdc_exc_col
+        end function rocsparse_csr2csrdc
+
 !       rocsparse_csr2csr_compress
         function rocsparse_scsr2csr_compress(handle, m, n, descr_A, csr_val_A, &
                 csr_col_ind_A, csr_row_ptr_A, nnz_A, nnz_per_row, csr_val_C, &
@@ -4496,6 +9209,21 @@ module rocsparse
             integer(c_int), value :: idx_base
         end function rocsparse_coo2csr
 
+!       rocsparse_coo2csr_i64
+        function rocsparse_coo2csr_i64(handle, coo_row_ind, nnz, m, csr_row_ptr, &
+                idx_base) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_coo2csr_i64')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), intent(in), value :: coo_row_ind
+            integer(c_int64_t), value :: nnz
+            integer(c_int), value :: m
+            type(c_ptr), value :: csr_row_ptr
+            integer(c_int), value :: idx_base
+        end function rocsparse_coo2csr_i64
+
 !       rocsparse_ell2csr_nnz
         function rocsparse_ell2csr_nnz(handle, m, n, ell_descr, ell_width, ell_col_ind, &
                 csr_descr, csr_row_ptr, csr_nnz) &
@@ -4591,6 +9319,96 @@ module rocsparse
             type(c_ptr), value :: csr_col_ind
         end function rocsparse_zell2csr
 
+!       rocsparse_dia2csr_nnz
+        function rocsparse_dia2csr_nnz(handle, m, n, dia_num_diag, dia_offset, &
+                csr_descr, csr_row_ptr, csr_nnz) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_dia2csr_nnz')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: dia_num_diag
+            type(c_ptr), intent(in), value :: dia_offset
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), value :: csr_row_ptr
+            type(c_ptr), value :: csr_nnz
+        end function rocsparse_dia2csr_nnz
+
+!       rocsparse_dia2csr
+        function rocsparse_sdia2csr(handle, m, n, dia_num_diag, dia_val, dia_offset, &
+                csr_descr, csr_val, csr_row_ptr, csr_col_ind) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_sdia2csr')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: dia_num_diag
+            type(c_ptr), intent(in), value :: dia_val
+            type(c_ptr), intent(in), value :: dia_offset
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), value :: csr_col_ind
+        end function rocsparse_sdia2csr
+
+        function rocsparse_ddia2csr(handle, m, n, dia_num_diag, dia_val, dia_offset, &
+                csr_descr, csr_val, csr_row_ptr, csr_col_ind) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_ddia2csr')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: dia_num_diag
+            type(c_ptr), intent(in), value :: dia_val
+            type(c_ptr), intent(in), value :: dia_offset
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), value :: csr_col_ind
+        end function rocsparse_ddia2csr
+
+        function rocsparse_cdia2csr(handle, m, n, dia_num_diag, dia_val, dia_offset, &
+                csr_descr, csr_val, csr_row_ptr, csr_col_ind) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_cdia2csr')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: dia_num_diag
+            type(c_ptr), intent(in), value :: dia_val
+            type(c_ptr), intent(in), value :: dia_offset
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), value :: csr_col_ind
+        end function rocsparse_cdia2csr
+
+        function rocsparse_zdia2csr(handle, m, n, dia_num_diag, dia_val, dia_offset, &
+                csr_descr, csr_val, csr_row_ptr, csr_col_ind) &
+                result(c_int) &
+                bind(c, name = 'rocsparse_zdia2csr')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: dia_num_diag
+            type(c_ptr), intent(in), value :: dia_val
+            type(c_ptr), intent(in), value :: dia_offset
+            type(c_ptr), intent(in), value :: csr_descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), value :: csr_col_ind
+        end function rocsparse_zdia2csr
+
 !       rocsparse_hyb2csr_buffer_size
         function rocsparse_hyb2csr_buffer_size(handle, descr, hyb, csr_row_ptr, &
                 buffer_size) &
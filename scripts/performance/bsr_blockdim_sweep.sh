@@ -0,0 +1,108 @@
+#!/usr/bin/env bash
+
+# Helper function
+function display_help()
+{
+    echo "rocSPARSE benchmark helper script"
+    echo "    [-h|--help] prints this help message"
+    echo "    [-d|--device] select device"
+    echo "    [-p|--path] path to rocsparse-bench"
+    echo "    [-r|--precision] floating point precision s, d, c or z"
+    echo "    [-b|--maxblockdim] largest BSR block dimension of the sweep"
+    echo "    [-D|--direction] BSR block storage, row = 0, column = 1"
+    echo "    [-n|--sizen] number of dense columns for bsrmm"
+    echo "    [-f|--file] rocalution matrix file, the default is a 3D laplacian"
+}
+
+# Check if getopt command is installed
+type getopt > /dev/null
+if [[ $? -ne 0 ]]; then
+    echo "This script uses getopt to parse arguments; try installing the util-linux package";
+    exit 1;
+fi
+
+dev=0
+path=../../build/release/clients/staging
+precision=d
+maxblockdim=64
+direction=0
+sizen=8
+file=
+
+# Parse command line parameters
+getopt -T
+if [[ $? -eq 4 ]]; then
+    GETOPT_PARSE=$(getopt --name "${0}" --longoptions help,device:,path:,precision:,maxblockdim:,direction:,sizen:,file: --options hd:p:r:b:D:n:f: -- "$@")
+else
+    echo "Need a new version of getopt"
+    exit 1
+fi
+
+if [[ $? -ne 0 ]]; then
+    echo "getopt invocation failed; could not parse the command line";
+    exit 1
+fi
+
+eval set -- "${GETOPT_PARSE}"
+
+while true; do
+    case "${1}" in
+        -h|--help)
+            display_help
+            exit 0
+            ;;
+        -d|--device)
+            dev=${2}
+            shift 2 ;;
+        -p|--path)
+            path=${2}
+            shift 2 ;;
+        -r|--precision)
+            precision=${2}
+            shift 2 ;;
+        -b|--maxblockdim)
+            maxblockdim=${2}
+            shift 2 ;;
+        -D|--direction)
+            direction=${2}
+            shift 2 ;;
+        -n|--sizen)
+            sizen=${2}
+            shift 2 ;;
+        -f|--file)
+            file=${2}
+            shift 2 ;;
+        --) shift ; break ;;
+        *)  echo "Unexpected command line parameter received; aborting";
+            exit 1
+            ;;
+    esac
+done
+
+bench=$path/rocsparse-bench
+
+# Check if binary is available
+if [ ! -f $bench ]; then
+    echo $bench not found, exit...
+    exit 1
+else
+    echo ">>" $(realpath $(ldd $bench | grep rocsparse | awk '{print $3;}'))
+fi
+
+# Matrix to be converted into BSR format
+if [ -z $file ]; then
+    matrix="--laplacian-dim 64 64 64"
+else
+    matrix="--rocalution $file"
+fi
+
+# Generate logfile name
+logname=${precision}bsr_blockdim_sweep_$(date +'%Y%m%d%H%M%S').log
+truncate -s 0 $logname
+
+# Run bsrmv and bsrmm for all BSR block dimensions of the sweep
+for function in bsrmv bsrmm; do
+    for blockdim in $(seq 1 $maxblockdim); do
+        $bench -f $function --precision $precision --device $dev --blockdim $blockdim --direction $direction --sizen $sizen --alpha 1 --beta 0 --iters 200 $matrix 2>&1 | tee -a $logname
+    done
+done